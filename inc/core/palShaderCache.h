@@ -69,6 +69,17 @@ struct ShaderCacheCreateInfo
 #endif
 };
 
+/// Reports runtime statistics about the pipeline binaries held in a shader cache.
+///
+/// @see IShaderCache::GetStats()
+struct ShaderCacheStats
+{
+    uint32 numEntries;     ///< Number of pipeline binaries currently stored in the cache.
+    uint64 totalDataSize;  ///< Total size of all stored pipeline binaries, in bytes.
+    uint64 numHits;        ///< Number of lookups which found a matching pipeline binary.
+    uint64 numMisses;      ///< Number of lookups which did not find a matching pipeline binary.
+};
+
 /**
  ***********************************************************************************************************************
  * @interface IShaderCache
@@ -113,6 +124,29 @@ public:
         uint32               numSrcCaches,
         const IShaderCache** ppSrcCaches) = 0;
 
+    /// Searches the shader cache for a pipeline binary which was previously added via IPipeline::AddShadersToCache(),
+    /// merged from another cache or loaded from the cache's initial data.  Entries are matched against the pipeline's
+    /// compiler hash (see PipelineInfo::compilerHash) and the settings of the device which owns this cache, so a
+    /// binary stored under different PAL settings will never be returned.
+    ///
+    /// @param [in]  compilerHash        Compiler hash of the pipeline being searched for.
+    /// @param [out] ppPipelineBinary    Receives a pointer to the cached pipeline ELF binary.  The data remains valid
+    ///                                  until this cache is reset or destroyed.
+    /// @param [out] pPipelineBinarySize Receives the size of the cached pipeline ELF binary, in bytes.
+    ///
+    /// @returns Success if a matching binary was found, NotFound if there is no matching binary, or ErrorInvalidPointer
+    ///          if ppPipelineBinary or pPipelineBinarySize is null.
+    virtual Result FindPipelineBinary(
+        uint64       compilerHash,
+        const void** ppPipelineBinary,
+        size_t*      pPipelineBinarySize) = 0;
+
+    /// Reports the number of stored pipeline binaries as well as the hit and miss counts of FindPipelineBinary().
+    ///
+    /// @param [out] pStats Receives the current shader cache statistics.
+    virtual void GetStats(
+        ShaderCacheStats* pStats) const = 0;
+
     /// Returns the value of the associated arbitrary client data pointer.
     /// Can be used to associate arbitrary data with a particular PAL object.
     ///
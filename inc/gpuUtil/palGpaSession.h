@@ -267,6 +267,30 @@ struct GpuClocksSample
     Pal::uint32 gpuMemoryClockSpeed; // Current speed of the gpu memory clock in MHz
 };
 
+/**
+***********************************************************************************************************************
+* @brief An abstract class that receives an RGP file from GpaSession::WriteRgpResults() one piece at a time, in file
+*        order.  This lets the client stream a trace to a file or a GPUOpen transfer block as it is produced instead
+*        of gathering the whole file in system memory first.
+***********************************************************************************************************************
+*/
+class RgpStream
+{
+public:
+    /// Destructor.
+    virtual ~RgpStream() {}
+
+    /// Called when the GpaSession wishes to append data to the RGP file.
+    ///
+    /// @param [in] pData       The data being written.  This may point directly into mapped GPU memory, so the stream
+    ///                         should copy it out rather than read it repeatedly.
+    /// @param [in] sizeInBytes The size of the data in bytes.
+    ///
+    /// @returns Success if the data was written.  Any other result stops the RGP file and is returned to the caller
+    ///          of WriteRgpResults().
+    virtual Pal::Result Write(const void* pData, size_t sizeInBytes) = 0;
+};
+
 /**
 ***********************************************************************************************************************
 * @class GpaSession
@@ -498,6 +522,23 @@ public:
         size_t*     pSizeInBytes,
         void*       pData) const;
 
+    /// Streams the results of a trace sample in the RGP file format.  Only valid for sessions in the _ready_ state.
+    ///
+    /// This produces the same file as GetResults() but hands each chunk to pStream as soon as it is built, with the
+    /// SQ thread trace data passed straight from the sample's mapped GPU memory.  The file is never held in system
+    /// memory as a whole, which matters for large multi-SE traces.
+    ///
+    /// @param [in] sampleId Sample to be reported.  Corresponds to value returned by BeginSample().
+    /// @param [in] pStream  Stream that receives the RGP file.
+    ///
+    /// @returns Success if the whole RGP file was written to pStream.  Otherwise, possible errors include:
+    ///          + ErrorInvalidPointer if pStream is null.
+    ///          + Unsupported if the sample is not a trace sample or has no SQ thread trace data.
+    ///          + Any error returned by pStream.
+    Pal::Result WriteRgpResults(
+        Pal::uint32 sampleId,
+        RgpStream*  pStream) const;
+
     /// Moves the session to the _reset_ state, marking all sessions resources as unused and available for reuse when
     /// the session is re-built.
     ///
@@ -758,6 +799,12 @@ private:
         void*                   pRgpOutput,
         size_t*                 pTraceSize) const;
 
+    // Write SQ thread trace data in rgp format to a stream
+    Pal::Result WriteRgpData(
+        const Pal::ThreadTraceLayout* pThreadTraceLayout,
+        const void*                   pResults,
+        RgpStream*                    pStream) const;
+
     // recycle used Gart rafts and put back to available pool
     void RecycleGartGpuMem();
 
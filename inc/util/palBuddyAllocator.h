@@ -32,7 +32,7 @@
 #pragma once
 
 #include "pal.h"
-#include "palList.h"
+#include "palInlineFuncs.h"
 
 namespace Util
 {
@@ -44,6 +44,11 @@ namespace Util
  * Responsible for managing small GPU memory requests by allocating a large base allocation and dividing it into
  * appropriately sized suballocation blocks.
  *
+ * The state of every block is tracked in per-order bitmaps which are allocated once by Init(): a free bitmap with a
+ * hierarchy of summary levels (so a free block of any order can be found without scanning) and a split bitmap (so the
+ * order of an allocated block can be recovered from its offset alone). Allocate() and Free() therefore run in time
+ * proportional to the number of orders and never allocate system memory.
+ *
  * @warning The buddy allocator is not thread-safe so thread-safety has to be handled on the caller side.
  ***********************************************************************************************************************
  */
@@ -73,9 +78,8 @@ public:
     /// @param [in]  alignment      The alignment requirements of the requested suballocation.
     /// @param [out] pOffset        The offset the suballocated block starts within the base allocation.
     ///
-    /// @returns Success if the allocation succeeded, @ref ErrorOutOfMemory if there isn't enough system memory to
-    ///          fulfill the request, or @ref ErrorOutOfGpuMemory if there isn't a large enough block free in the
-    ///          base allocation to fulfill the request.
+    /// @returns Success if the allocation succeeded, or @ref ErrorOutOfGpuMemory if there isn't a large enough block
+    ///          free in the base allocation to fulfill the request.
     Result Allocate(
         Pal::gpusize    size,
         Pal::gpusize    alignment,
@@ -101,15 +105,35 @@ public:
     /// Returns the size of the largest allocation that can be suballocated with this buddy allocator.
     Pal::gpusize MaximumAllocationSize() const;
 
+    /// Returns the number of blocks which are currently suballocated.
+    uint32 NumSuballocations() const { return m_numSuballocations; }
+
+    /// Returns the total size of all suballocated blocks. This includes the padding added to round each request up to
+    /// a power-of-two block size.
+    Pal::gpusize AllocatedSize() const { return m_allocatedSize; }
+
+    /// Returns the size of the largest free block, or zero if the base allocation is full. Comparing this against the
+    /// free size tells how fragmented the base allocation is.
+    Pal::gpusize LargestFreeBlockSize() const;
+
 private:
-    struct Block
+    // Maximum number of levels in a free bitmap hierarchy. Each level has one bit per 32-bit word of the level below
+    // it, so this supports up to 2^35 blocks per order.
+    static constexpr uint32 MaxBitmapLevels = 7;
+
+    // Tracks the blocks of one order (i.e., one k-value).
+    struct Order
     {
-        bool            isFree; // Indicates the in-use status of the block
-        Pal::gpusize    offset; // Byte offset from the base allocation address where this block begins
+        // pFreeBits[0] has one bit per block of this order which is set if the block is free. Each following level
+        // has one bit per word of the level below it which is set if that word is nonzero. The last level is a single
+        // word, so it says whether any block of this order is free.
+        uint32* pFreeBits[MaxBitmapLevels];
+        uint32  numLevels;
+
+        // One bit per block of this order which is set if the block has been split into two blocks of the order below.
+        uint32* pSplitBits;
     };
 
-    typedef Util::List<Block, Allocator> BlockList;
-
     Result GetNextFreeBlock(
         uint32              kval,
         Pal::gpusize*       pOffset);
@@ -118,18 +142,32 @@ private:
         uint32              kval,
         Pal::gpusize        offset);
 
+    bool FindFreeBlock(uint32 kval, Pal::gpusize* pBlockIdx) const;
+    bool IsBlockFree(uint32 kval, Pal::gpusize blockIdx) const;
+    void MarkBlockFree(uint32 kval, Pal::gpusize blockIdx);
+    void MarkBlockUsed(uint32 kval, Pal::gpusize blockIdx);
+
+    bool IsBlockSplit(uint32 kval, Pal::gpusize blockIdx) const;
+    void SetBlockSplit(uint32 kval, Pal::gpusize blockIdx, bool isSplit);
+
     PAL_INLINE Pal::gpusize KvalToSize(uint32 kVal) const { return (1ull << kVal); }
 
     PAL_INLINE uint32 SizeToKval(Pal::gpusize size) const { return Log2(size); }
 
+    PAL_INLINE Order* GetOrder(uint32 kval) const { return &m_pOrders[kval - m_minKval]; }
+
+    // Number of blocks of the given order which fit in the base allocation.
+    PAL_INLINE Pal::gpusize NumBlocks(uint32 kval) const { return (1ull << (m_baseAllocKval - kval)); }
+
     Allocator* const    m_pAllocator;
 
     const uint32        m_baseAllocKval;
     const uint32        m_minKval;
 
-    BlockList*          m_pBlockLists;
+    Order*              m_pOrders;  // One entry per k-value. The bitmaps are allocated in the same block of memory.
 
     uint32              m_numSuballocations;
+    Pal::gpusize        m_allocatedSize;
 
     PAL_DISALLOW_COPY_AND_ASSIGN(BuddyAllocator);
     PAL_DISALLOW_DEFAULT_CTOR(BuddyAllocator);
@@ -33,7 +33,6 @@
 
 #include "palBuddyAllocator.h"
 #include "palInlineFuncs.h"
-#include "palListImpl.h"
 #include "palSysMemory.h"
 
 namespace Util
@@ -49,8 +48,9 @@ BuddyAllocator<Allocator>::BuddyAllocator(
     m_pAllocator(pAllocator),
     m_baseAllocKval(SizeToKval(baseAllocSize)),
     m_minKval(SizeToKval(minAllocSize)),
-    m_pBlockLists(nullptr),
-    m_numSuballocations(0)
+    m_pOrders(nullptr),
+    m_numSuballocations(0),
+    m_allocatedSize(0)
 {
     // Allocator must be non-null
     PAL_ASSERT(m_pAllocator != nullptr);
@@ -66,24 +66,8 @@ BuddyAllocator<Allocator>::BuddyAllocator(
 template <typename Allocator>
 BuddyAllocator<Allocator>::~BuddyAllocator()
 {
-    if (m_pBlockLists != nullptr)
-    {
-        const uint32 numKvals = m_baseAllocKval - m_minKval;
-
-        for (uint32 i = 0; i < numKvals; ++i)
-        {
-            for (auto it = m_pBlockLists[i].Begin(); it.Get() != nullptr;)
-            {
-                m_pBlockLists[i].Erase(&it);
-            }
-
-            // Call the destructor
-            m_pBlockLists[i].~List();
-        }
-
-        // Free the block list array
-        PAL_SAFE_FREE(m_pBlockLists, m_pAllocator);
-    }
+    // The order array and all of the bitmaps share a single allocation.
+    PAL_SAFE_FREE(m_pOrders, m_pAllocator);
 }
 
 // =====================================================================================================================
@@ -96,49 +80,95 @@ Pal::gpusize BuddyAllocator<Allocator>::MaximumAllocationSize() const
     return KvalToSize(m_baseAllocKval - 1);
 }
 
+// =====================================================================================================================
+// Gets the size of the largest free block. The top level of each order's free bitmap is a single word which is nonzero
+// if any block of that order is free, so this only needs to look at one word per order.
+template <typename Allocator>
+Pal::gpusize BuddyAllocator<Allocator>::LargestFreeBlockSize() const
+{
+    PAL_ASSERT(m_pOrders != nullptr);
+
+    Pal::gpusize size = 0;
+
+    for (uint32 kval = m_baseAllocKval; kval > m_minKval; --kval)
+    {
+        const Order*const pOrder = GetOrder(kval - 1);
+
+        if (pOrder->pFreeBits[pOrder->numLevels - 1][0] != 0)
+        {
+            size = KvalToSize(kval - 1);
+            break;
+        }
+    }
+
+    return size;
+}
+
 // =====================================================================================================================
 // Initializes the buddy allocator.
 template <typename Allocator>
 Result BuddyAllocator<Allocator>::Init()
 {
-    PAL_ASSERT(m_pBlockLists == nullptr);
+    PAL_ASSERT(m_pOrders == nullptr);
+    PAL_ASSERT(m_baseAllocKval > m_minKval);
 
     Result result = Result::ErrorOutOfMemory;
 
     const uint32 numKvals = m_baseAllocKval - m_minKval;
 
-    // Allocate the block lists
-    m_pBlockLists = static_cast<BlockList*>(PAL_MALLOC(sizeof(BlockList) * numKvals,
-                                                       m_pAllocator,
-                                                       AllocInternal));
-
-    if (m_pBlockLists != nullptr)
+    // Size all of the bitmaps up front so that they can be placed in the same allocation as the order array.
+    size_t numWords = 0;
+    for (uint32 kval = m_minKval; kval < m_baseAllocKval; ++kval)
     {
-        for (uint32 i = 0; i < numKvals; ++i)
+        Pal::gpusize levelBits = NumBlocks(kval);
+        uint32       numLevels = 0;
+
+        do
         {
-            PAL_PLACEMENT_NEW(&m_pBlockLists[i]) BlockList(m_pAllocator);
+            levelBits  = RoundUpQuotient(levelBits, static_cast<Pal::gpusize>(32));
+            numWords  += static_cast<size_t>(levelBits);
+            numLevels++;
         }
+        while (levelBits > 1);
 
-        // We need to create the first two largest-size blocks and add them to the last block list
-        const uint32        blockKval = (m_baseAllocKval - 1);
-        const Pal::gpusize  blockSize = KvalToSize(blockKval);
+        PAL_ASSERT(numLevels <= MaxBitmapLevels);
 
-        BlockList* pBlockList = &m_pBlockLists[blockKval - m_minKval];
+        numWords += static_cast<size_t>(RoundUpQuotient(NumBlocks(kval), static_cast<Pal::gpusize>(32)));
+    }
 
-        Block block = {};
-        block.isFree = true;
-        block.offset = 0;
+    void*const pMemory = PAL_CALLOC((sizeof(Order) * numKvals) + (sizeof(uint32) * numWords),
+                                    m_pAllocator,
+                                    AllocInternal);
 
-        result = pBlockList->PushBack(block);
-        PAL_ASSERT(result == Result::Success);
+    if (pMemory != nullptr)
+    {
+        m_pOrders = static_cast<Order*>(pMemory);
 
-        block.offset = blockSize;
+        uint32* pWords = static_cast<uint32*>(VoidPtrInc(pMemory, sizeof(Order) * numKvals));
 
-        if (result == Result::Success)
+        for (uint32 kval = m_minKval; kval < m_baseAllocKval; ++kval)
         {
-            result = pBlockList->PushBack(block);
-            PAL_ASSERT(result == Result::Success);
+            Order*const  pOrder    = GetOrder(kval);
+            Pal::gpusize levelBits = NumBlocks(kval);
+
+            do
+            {
+                levelBits = RoundUpQuotient(levelBits, static_cast<Pal::gpusize>(32));
+
+                pOrder->pFreeBits[pOrder->numLevels++] = pWords;
+                pWords += levelBits;
+            }
+            while (levelBits > 1);
+
+            pOrder->pSplitBits = pWords;
+            pWords += RoundUpQuotient(NumBlocks(kval), static_cast<Pal::gpusize>(32));
         }
+
+        // Everything starts out as the two largest-size blocks, both of which are free.
+        MarkBlockFree(m_baseAllocKval - 1, 0);
+        MarkBlockFree(m_baseAllocKval - 1, 1);
+
+        result = Result::Success;
     }
 
     return result;
@@ -153,7 +183,7 @@ Result BuddyAllocator<Allocator>::Allocate(
     Pal::gpusize    alignment,
     Pal::gpusize*   pOffset)
 {
-    PAL_ASSERT(m_pBlockLists != nullptr);
+    PAL_ASSERT(m_pOrders != nullptr);
 
     PAL_ASSERT(size <= MaximumAllocationSize());
 
@@ -180,44 +210,33 @@ Result BuddyAllocator<Allocator>::GetNextFreeBlock(
 {
     Result result = Result::ErrorOutOfGpuMemory;
 
-    if (kval < m_baseAllocKval)
+    // Find the smallest order, at least as large as the one requested, which has a free block.
+    uint32       freeKval = kval;
+    Pal::gpusize blockIdx = 0;
+
+    while ((freeKval < m_baseAllocKval) && (FindFreeBlock(freeKval, &blockIdx) == false))
+    {
+        freeKval++;
+    }
+
+    if (freeKval < m_baseAllocKval)
     {
-        BlockList* pBlockList = &m_pBlockLists[kval - m_minKval];
+        MarkBlockUsed(freeKval, blockIdx);
 
-        for (auto it = pBlockList->Begin(); it.Get() != nullptr; it.Next())
+        // Split the block until it's the requested size. We always keep the lower half and free its buddy.
+        for (; freeKval > kval; --freeKval)
         {
-            if (it.Get()->isFree)
-            {
-                // Allocate this block and return it
-                it.Get()->isFree = false;
-                *pOffset = it.Get()->offset;
+            SetBlockSplit(freeKval, blockIdx, true);
 
-                result = Result::Success;
-                break;
-            }
+            blockIdx <<= 1;
+            MarkBlockFree(freeKval - 1, blockIdx + 1);
         }
 
-        if (result != Result::Success)
-        {
-            // If we didn't find any free blocks in the list then we need to get a block one size bigger and split it
-            result = GetNextFreeBlock(kval + 1, pOffset); // Determine the offset for the larger block
-            if (result == Result::Success)
-            {
-                // Now we need to create two blocks in that larger block's space. First, the block we'll return
-                Block block = {};
-                block.isFree = false;
-                block.offset = *pOffset;
-                result = pBlockList->PushBack(block);
-
-                if (result == Result::Success)
-                {
-                    // ... and its buddy which starts out as free
-                    block.isFree = true;
-                    block.offset = *pOffset + KvalToSize(kval);
-                    result = pBlockList->PushBack(block);
-                }
-            }
-        }
+        *pOffset = (blockIdx << kval);
+
+        m_allocatedSize += KvalToSize(kval);
+
+        result = Result::Success;
     }
 
     return result;
@@ -231,7 +250,7 @@ void BuddyAllocator<Allocator>::Free(
     Pal::gpusize    size,
     Pal::gpusize    alignment)
 {
-    PAL_ASSERT(m_pBlockLists != nullptr);
+    PAL_ASSERT(m_pOrders != nullptr);
 
     uint32 startKval = Max(SizeToKval(Pow2Pad(Max(size, alignment))), m_minKval);
 
@@ -245,7 +264,9 @@ void BuddyAllocator<Allocator>::Free(
 }
 
 // =====================================================================================================================
-// Frees a block with the matching offset.
+// Frees the allocated block which starts at the given offset and merges it with its buddies as far as possible. The
+// k-value is only a lower bound on the size of the block; its actual size is found by following the split bits down
+// from the largest order.
 template <typename Allocator>
 Result BuddyAllocator<Allocator>::FreeBlock(
     uint32          kval,
@@ -256,62 +277,143 @@ Result BuddyAllocator<Allocator>::FreeBlock(
     // If this assert is hit then something went wrong with the allocation patterns
     PAL_ASSERT((kval >= m_minKval) && (kval < m_baseAllocKval));
 
-    for (; (kval < m_baseAllocKval) && (result != Result::Success); ++kval)
+    uint32       blockKval = m_baseAllocKval - 1;
+    Pal::gpusize blockIdx  = (offset >> blockKval);
+
+    while ((blockKval > m_minKval) && IsBlockSplit(blockKval, blockIdx))
+    {
+        blockKval--;
+        blockIdx = (offset >> blockKval);
+    }
+
+    // The block must start exactly at the given offset, must be at least as large as the caller claims and must
+    // currently be allocated.
+    if ((blockIdx < NumBlocks(blockKval))            &&
+        ((blockIdx << blockKval) == offset)          &&
+        (blockKval >= kval)                          &&
+        (IsBlockFree(blockKval, blockIdx) == false))
     {
-        BlockList* pBlockList = &m_pBlockLists[kval - m_minKval];
+        m_allocatedSize -= KvalToSize(blockKval);
 
-        for (auto it = pBlockList->Begin(); it.Get() != nullptr; it.Next())
+        // If the buddy is free then merge both blocks into the next size up, unless we're at the largest block size.
+        // Because all offsets are zero relative and aligned to block size, the buddy's index can be simply calculated
+        // by flipping the lowest bit of the block's index.
+        while ((blockKval < (m_baseAllocKval - 1)) && IsBlockFree(blockKval, blockIdx ^ 1))
         {
-            Block* pBlock = it.Get();
-            if (pBlock->offset == offset)
-            {
-                // At this point this block should not be free
-                PAL_ASSERT(pBlock->isFree == false);
-
-                pBlock->isFree = true;
-
-                // Find the buddy block to see if it is free, and if so remove the blocks and free the next size up.
-                // Because all offsets are zero relative and aligned to block size, buddy offset can be simply
-                // calculated by XOR-ing the block offset with its size.
-                Pal::gpusize buddyOffset = (offset ^ KvalToSize(kval));
-
-                // Because buddies are always consecutive in the block list we can find the buddy block next to the
-                // current one.
-                if (buddyOffset > offset)
-                {
-                    it.Next();
-                }
-                else
-                {
-                    it.Prev();
-                }
-                PAL_ASSERT(it.Get() != nullptr && it.Get()->offset == buddyOffset);
-
-                // If the buddy is free then remove both blocks from the list, unless we're at the largest block size
-                if (it.Get()->isFree && (kval < m_baseAllocKval - 1))
-                {
-                    pBlockList->Erase(&it);
-
-                    // Erasing a node advances the iterator, if the next node is not our block, then we need to move
-                    // back one node
-                    if (it.Get() != pBlock)
-                    {
-                        it.Prev();
-                    }
-                    pBlockList->Erase(&it);
-
-                    // Recursively call this method again to free the next block size up
-                    FreeBlock(kval + 1, Min(offset, buddyOffset));
-                }
-
-                // Finished successfully
-                result = Result::Success;
-                break;
-            }
+            MarkBlockUsed(blockKval, blockIdx ^ 1);
+
+            blockKval++;
+            blockIdx >>= 1;
+
+            SetBlockSplit(blockKval, blockIdx, false);
         }
+
+        MarkBlockFree(blockKval, blockIdx);
+
+        // Finished successfully
+        result = Result::Success;
     }
 
     return result;
 }
 
+// =====================================================================================================================
+// Finds the lowest-offset free block of the given order by walking its free bitmap hierarchy from the top down.
+// Returns false if no block of this order is free.
+template <typename Allocator>
+bool BuddyAllocator<Allocator>::FindFreeBlock(
+    uint32          kval,
+    Pal::gpusize*   pBlockIdx
+    ) const
+{
+    const Order*const pOrder = GetOrder(kval);
+
+    Pal::gpusize wordIdx = 0;
+    bool         found   = true;
+
+    for (uint32 level = pOrder->numLevels; found && (level > 0); --level)
+    {
+        uint32 bitIdx = 0;
+        found   = BitMaskScanForward(&bitIdx, pOrder->pFreeBits[level - 1][wordIdx]);
+        wordIdx = (wordIdx << 5) + bitIdx;
+    }
+
+    *pBlockIdx = wordIdx;
+
+    return found;
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+bool BuddyAllocator<Allocator>::IsBlockFree(
+    uint32       kval,
+    Pal::gpusize blockIdx
+    ) const
+{
+    return ((GetOrder(kval)->pFreeBits[0][blockIdx >> 5] & (1u << (blockIdx & 31))) != 0);
+}
+
+// =====================================================================================================================
+// Sets the block's free bit and the summary bits of every level above it which were previously clear.
+template <typename Allocator>
+void BuddyAllocator<Allocator>::MarkBlockFree(
+    uint32       kval,
+    Pal::gpusize blockIdx)
+{
+    Order*const pOrder = GetOrder(kval);
+
+    bool wasEmpty = true;
+    for (uint32 level = 0; wasEmpty && (level < pOrder->numLevels); ++level)
+    {
+        uint32*const pWord = &pOrder->pFreeBits[level][blockIdx >> 5];
+
+        wasEmpty  = (*pWord == 0);
+        *pWord   |= (1u << (blockIdx & 31));
+        blockIdx >>= 5;
+    }
+}
+
+// =====================================================================================================================
+// Clears the block's free bit and the summary bits of every level above it whose words became empty.
+template <typename Allocator>
+void BuddyAllocator<Allocator>::MarkBlockUsed(
+    uint32       kval,
+    Pal::gpusize blockIdx)
+{
+    Order*const pOrder = GetOrder(kval);
+
+    bool isEmpty = true;
+    for (uint32 level = 0; isEmpty && (level < pOrder->numLevels); ++level)
+    {
+        uint32*const pWord = &pOrder->pFreeBits[level][blockIdx >> 5];
+
+        *pWord   &= ~(1u << (blockIdx & 31));
+        isEmpty   = (*pWord == 0);
+        blockIdx >>= 5;
+    }
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+bool BuddyAllocator<Allocator>::IsBlockSplit(
+    uint32       kval,
+    Pal::gpusize blockIdx
+    ) const
+{
+    return ((GetOrder(kval)->pSplitBits[blockIdx >> 5] & (1u << (blockIdx & 31))) != 0);
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+void BuddyAllocator<Allocator>::SetBlockSplit(
+    uint32       kval,
+    Pal::gpusize blockIdx,
+    bool         isSplit)
+{
+    uint32*const pWord = &GetOrder(kval)->pSplitBits[blockIdx >> 5];
+    const uint32 mask  = (1u << (blockIdx & 31));
+
+    *pWord = isSplit ? (*pWord | mask) : (*pWord & ~mask);
+}
+
 } // Pal
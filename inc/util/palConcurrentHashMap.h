@@ -0,0 +1,213 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2014-2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/**
+ ***********************************************************************************************************************
+ * @file  palConcurrentHashMap.h
+ * @brief PAL utility collection ConcurrentHashMap class declaration.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palHashMap.h"
+#include "palMutex.h"
+
+namespace Util
+{
+
+/**
+ ***********************************************************************************************************************
+ * @brief Templated, thread-safe hash map container made of independently locked shards.
+ *
+ * The key space is split into NumShards shards using the top bits of the key's (scrambled) hash.  Each shard is a
+ * regular @ref HashMap backed by its own @ref HashAllocator, guarded by its own RWLock, and padded to a cache line so
+ * that threads working on different shards neither contend on a lock nor false-share its cache line.  Lookups only take
+ * the owning shard's lock in shared mode, so concurrent readers never serialize.
+ *
+ * The simple operations (FindKey, Contains, Insert and Erase) lock internally and copy values in and out, so they are
+ * safe to call from any thread.  Read-modify-write sequences (e.g. reference counting) should instead lock the owning
+ * shard with a ConcurrentHashMapShardAuto and operate on the shard's HashMap directly while it is held.
+ *
+ * HashFunc and EqualFunc have the same meaning and built-in choices as they do for @ref HashMap.
+ *
+ * @warning Init() must be called before using this container.
+ ***********************************************************************************************************************
+ */
+template<typename Key,
+         typename Value,
+         typename Allocator,
+         template<typename> class HashFunc  = DefaultHashFunc,
+         template<typename> class EqualFunc = DefaultEqualFunc,
+         uint32 NumShards = 16,
+         size_t GroupSize = PAL_CACHE_LINE_BYTES * 2>
+class ConcurrentHashMap
+{
+public:
+    /// Convenience typedef for the hash map which stores the entries of a single shard.
+    typedef HashMap<Key, Value, Allocator, HashFunc, EqualFunc, HashAllocator<Allocator>, GroupSize> ShardMap;
+
+    /// Constructor
+    ///
+    /// @param [in] numBuckets Total number of buckets to allocate for this container.  They are divided evenly between
+    ///                        the shards.
+    /// @param [in] pAllocator Pointer to an allocator that will create system memory requested by this container.
+    explicit ConcurrentHashMap(uint32 numBuckets, Allocator*const pAllocator);
+    ~ConcurrentHashMap();
+
+    /// Initializes the hash container.  Not thread-safe.
+    ///
+    /// @returns @ref Success if the initialization completed successfully, or ErrorOutOfMemory if the operation failed
+    ///          due to an internal failure to allocate system memory.
+    Result Init();
+
+    /// Returns number of entries in the container.  The result is only a snapshot if other threads are modifying the
+    /// container concurrently.
+    uint32 GetNumEntries() const;
+
+    /// Copies out the value that matches the specified key.
+    ///
+    /// @param [in]  key    Key to search for.
+    /// @param [out] pValue Receives a copy of the matching value.  Not written if the key isn't present.
+    ///
+    /// @returns True if an entry for the key exists.
+    bool FindKey(const Key& key, Value* pValue) const;
+
+    /// Returns true if an entry for the specified key exists.
+    bool Contains(const Key& key) const;
+
+    /// Inserts a key/value pair entry if the key doesn't already exist in the hash map.
+    ///
+    /// @warning No action will be taken if an entry matching this key already exists, even if the specified value
+    ///          differs from the current value stored in the entry matching the specified key.
+    ///
+    /// @param [in] key   Key of the new entry to insert.
+    /// @param [in] value Value of the new entry to insert.
+    ///
+    /// @returns @ref Success if the operation completed successfully, or @ref ErrorOutOfMemory if the operation failed
+    ///          because an internal memory allocation failed.
+    Result Insert(const Key& key, const Value& value);
+
+    /// Removes an entry that matches the specified key.
+    ///
+    /// @param [in] key Key of the entry to erase.
+    ///
+    /// @returns True if the erase completed successfully, false if an entry for this key did not exist.
+    bool Erase(const Key& key);
+
+    /// Empties every shard.  Each shard is locked in turn, so entries inserted concurrently may survive the call.
+    void Reset();
+
+    /// Returns the index of the shard which owns the specified key.
+    uint32 GetShardIndex(const Key& key) const;
+
+    /// Number of shards the key space is divided into.
+    static constexpr uint32 ShardCount = NumShards;
+
+private:
+    static_assert(((NumShards > 1) && ((NumShards & (NumShards - 1)) == 0)), "NumShards must be a power of two.");
+
+    // A shard's lock and entries.  Shards are placed on separate cache lines.
+    struct Shard
+    {
+        Shard(uint32 numBuckets, Allocator*const pAllocator) : map(numBuckets, pAllocator) { }
+
+        RWLock   lock;
+        ShardMap map;
+    };
+
+    static constexpr size_t ShardStride = ((sizeof(Shard) + PAL_CACHE_LINE_BYTES - 1) &
+                                           ~static_cast<size_t>(PAL_CACHE_LINE_BYTES - 1));
+
+    Shard* GetShard(uint32 index) const
+        { return static_cast<Shard*>(VoidPtrInc(m_pShardMemory, index * ShardStride)); }
+
+    const HashFunc<Key> m_hashFunc;         // Hash functor object used to pick a shard.
+    Allocator*const     m_pAllocator;       // Allocator for the shards.
+    const uint32        m_bucketsPerShard;  // Number of buckets in each shard's hash map.
+    void*               m_pShardMemory;     // Storage for the NumShards shards.
+    uint32              m_numShardsBuilt;   // Number of shards which have been constructed in m_pShardMemory.
+
+    PAL_DISALLOW_DEFAULT_CTOR(ConcurrentHashMap);
+    PAL_DISALLOW_COPY_AND_ASSIGN(ConcurrentHashMap);
+
+    template<typename, RWLock::LockType> friend class ConcurrentHashMapShardAuto;
+};
+
+/// Selects the ConcurrentHashMapShardAuto constructor which locks a shard by its index instead of by one of its keys.
+/// A separate tag is needed because maps keyed by integers would otherwise pick the wrong constructor.
+struct ShardIndexTag { };
+
+/**
+ ***********************************************************************************************************************
+ * @brief A "resource acquisition is initialization" (RAII) wrapper which locks one shard of a ConcurrentHashMap.
+ *
+ * While this object is in scope the caller has shared (ReadOnly) or exclusive (ReadWrite) access to the shard's
+ * HashMap, which allows read-modify-write sequences and iteration without racing other threads.  Only keys owned by the
+ * locked shard may be inserted into the shard's map.  See the below example.
+ *
+ *     {
+ *         ConcurrentHashMapShardAuto<MapType, RWLock::ReadWrite> shard(&map, key);
+ *         uint32* pRefCount = shard.GetMap()->FindKey(key);
+ *         [Shard is protected]
+ *     }
+ ***********************************************************************************************************************
+ */
+template <typename Container, RWLock::LockType type>
+class ConcurrentHashMapShardAuto
+{
+public:
+    /// Locks the shard which owns the specified key.
+    template <typename Key>
+    ConcurrentHashMapShardAuto(const Container* pContainer, const Key& key)
+        :
+        m_pShard(pContainer->GetShard(pContainer->GetShardIndex(key))),
+        m_lock(&m_pShard->lock)
+    {
+    }
+
+    /// Locks the shard at the specified index, which must be less than Container::ShardCount.  Useful for visiting
+    /// every entry of the container one shard at a time.
+    ConcurrentHashMapShardAuto(const Container* pContainer, ShardIndexTag, uint32 shardIndex)
+        :
+        m_pShard(pContainer->GetShard(shardIndex)),
+        m_lock(&m_pShard->lock)
+    {
+        PAL_ASSERT(shardIndex < Container::ShardCount);
+    }
+
+    ~ConcurrentHashMapShardAuto() { }
+
+    /// Returns the locked shard's hash map.  It must not be modified if the shard was locked in ReadOnly mode.
+    typename Container::ShardMap* GetMap() const { return &m_pShard->map; }
+
+private:
+    typename Container::Shard*const m_pShard;  // The shard locked by this object.
+    RWLockAuto<type>                m_lock;    // Holds the shard's lock for the lifetime of this object.
+
+    PAL_DISALLOW_DEFAULT_CTOR(ConcurrentHashMapShardAuto);
+    PAL_DISALLOW_COPY_AND_ASSIGN(ConcurrentHashMapShardAuto);
+};
+
+} // Util
@@ -0,0 +1,253 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2014-2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/**
+ ***********************************************************************************************************************
+ * @file  palConcurrentHashMapImpl.h
+ * @brief PAL utility collection ConcurrentHashMap class implementation.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palConcurrentHashMap.h"
+#include "palHashMapImpl.h"
+
+namespace Util
+{
+
+// =====================================================================================================================
+template<typename Key,
+         typename Value,
+         typename Allocator,
+         template<typename> class HashFunc,
+         template<typename> class EqualFunc,
+         uint32 NumShards,
+         size_t GroupSize>
+PAL_INLINE ConcurrentHashMap<Key, Value, Allocator, HashFunc, EqualFunc, NumShards, GroupSize>::ConcurrentHashMap(
+    uint32          numBuckets,
+    Allocator*const pAllocator)
+    :
+    m_hashFunc(),
+    m_pAllocator(pAllocator),
+    m_bucketsPerShard(Max(numBuckets / NumShards, 1u)),
+    m_pShardMemory(nullptr),
+    m_numShardsBuilt(0)
+{
+}
+
+// =====================================================================================================================
+template<typename Key,
+         typename Value,
+         typename Allocator,
+         template<typename> class HashFunc,
+         template<typename> class EqualFunc,
+         uint32 NumShards,
+         size_t GroupSize>
+PAL_INLINE ConcurrentHashMap<Key, Value, Allocator, HashFunc, EqualFunc, NumShards, GroupSize>::~ConcurrentHashMap()
+{
+    for (uint32 i = 0; i < m_numShardsBuilt; ++i)
+    {
+        Destructor(GetShard(i));
+    }
+
+    PAL_SAFE_FREE(m_pShardMemory, m_pAllocator);
+}
+
+// =====================================================================================================================
+template<typename Key,
+         typename Value,
+         typename Allocator,
+         template<typename> class HashFunc,
+         template<typename> class EqualFunc,
+         uint32 NumShards,
+         size_t GroupSize>
+PAL_INLINE Result ConcurrentHashMap<Key, Value, Allocator, HashFunc, EqualFunc, NumShards, GroupSize>::Init()
+{
+    PAL_ASSERT(m_pShardMemory == nullptr);
+
+    m_pShardMemory = PAL_MALLOC_ALIGNED(ShardStride * NumShards, PAL_CACHE_LINE_BYTES, m_pAllocator, AllocInternal);
+
+    Result result = (m_pShardMemory != nullptr) ? Result::Success : Result::ErrorOutOfMemory;
+
+    for (; (result == Result::Success) && (m_numShardsBuilt < NumShards); ++m_numShardsBuilt)
+    {
+        Shard*const pShard = PAL_PLACEMENT_NEW(GetShard(m_numShardsBuilt)) Shard(m_bucketsPerShard, m_pAllocator);
+
+        result = pShard->lock.Init();
+
+        if (result == Result::Success)
+        {
+            result = pShard->map.Init();
+        }
+    }
+
+    PAL_ALERT(result != Result::Success);
+
+    return result;
+}
+
+// =====================================================================================================================
+// Picks the shard using the top bits of a multiplicative scramble of the key's hash.  The shard's HashMap buckets on
+// the low bits of the unscrambled hash, so the two choices stay independent.
+template<typename Key,
+         typename Value,
+         typename Allocator,
+         template<typename> class HashFunc,
+         template<typename> class EqualFunc,
+         uint32 NumShards,
+         size_t GroupSize>
+PAL_INLINE uint32 ConcurrentHashMap<Key, Value, Allocator, HashFunc, EqualFunc, NumShards, GroupSize>::GetShardIndex(
+    const Key& key
+    ) const
+{
+    const uint32 hash = m_hashFunc(&key, sizeof(key)) * 0x9E3779B9u;
+
+    return (hash >> (32 - Log2(NumShards)));
+}
+
+// =====================================================================================================================
+template<typename Key,
+         typename Value,
+         typename Allocator,
+         template<typename> class HashFunc,
+         template<typename> class EqualFunc,
+         uint32 NumShards,
+         size_t GroupSize>
+PAL_INLINE uint32 ConcurrentHashMap<Key, Value, Allocator, HashFunc, EqualFunc, NumShards, GroupSize>::GetNumEntries(
+    ) const
+{
+    uint32 numEntries = 0;
+
+    for (uint32 i = 0; i < m_numShardsBuilt; ++i)
+    {
+        Shard*const pShard = GetShard(i);
+        RWLockAuto<RWLock::ReadOnly> lock(&pShard->lock);
+
+        numEntries += pShard->map.GetNumEntries();
+    }
+
+    return numEntries;
+}
+
+// =====================================================================================================================
+// Copies out the value that matches the key.  Returns false if no entry is present matching the specified key.
+template<typename Key,
+         typename Value,
+         typename Allocator,
+         template<typename> class HashFunc,
+         template<typename> class EqualFunc,
+         uint32 NumShards,
+         size_t GroupSize>
+PAL_INLINE bool ConcurrentHashMap<Key, Value, Allocator, HashFunc, EqualFunc, NumShards, GroupSize>::FindKey(
+    const Key& key,
+    Value*     pValue
+    ) const
+{
+    PAL_ASSERT(pValue != nullptr);
+
+    ConcurrentHashMapShardAuto<ConcurrentHashMap, RWLock::ReadOnly> shard(this, key);
+
+    const Value*const pFound = shard.GetMap()->FindKey(key);
+
+    if (pFound != nullptr)
+    {
+        *pValue = *pFound;
+    }
+
+    return (pFound != nullptr);
+}
+
+// =====================================================================================================================
+template<typename Key,
+         typename Value,
+         typename Allocator,
+         template<typename> class HashFunc,
+         template<typename> class EqualFunc,
+         uint32 NumShards,
+         size_t GroupSize>
+PAL_INLINE bool ConcurrentHashMap<Key, Value, Allocator, HashFunc, EqualFunc, NumShards, GroupSize>::Contains(
+    const Key& key
+    ) const
+{
+    ConcurrentHashMapShardAuto<ConcurrentHashMap, RWLock::ReadOnly> shard(this, key);
+
+    return (shard.GetMap()->FindKey(key) != nullptr);
+}
+
+// =====================================================================================================================
+// Inserts a key/value pair entry if it doesn't already exist.
+template<typename Key,
+         typename Value,
+         typename Allocator,
+         template<typename> class HashFunc,
+         template<typename> class EqualFunc,
+         uint32 NumShards,
+         size_t GroupSize>
+PAL_INLINE Result ConcurrentHashMap<Key, Value, Allocator, HashFunc, EqualFunc, NumShards, GroupSize>::Insert(
+    const Key&   key,
+    const Value& value)
+{
+    ConcurrentHashMapShardAuto<ConcurrentHashMap, RWLock::ReadWrite> shard(this, key);
+
+    return shard.GetMap()->Insert(key, value);
+}
+
+// =====================================================================================================================
+// Removes an entry with the specified key.
+template<typename Key,
+         typename Value,
+         typename Allocator,
+         template<typename> class HashFunc,
+         template<typename> class EqualFunc,
+         uint32 NumShards,
+         size_t GroupSize>
+PAL_INLINE bool ConcurrentHashMap<Key, Value, Allocator, HashFunc, EqualFunc, NumShards, GroupSize>::Erase(
+    const Key& key)
+{
+    ConcurrentHashMapShardAuto<ConcurrentHashMap, RWLock::ReadWrite> shard(this, key);
+
+    return shard.GetMap()->Erase(key);
+}
+
+// =====================================================================================================================
+// Empty every shard.
+template<typename Key,
+         typename Value,
+         typename Allocator,
+         template<typename> class HashFunc,
+         template<typename> class EqualFunc,
+         uint32 NumShards,
+         size_t GroupSize>
+PAL_INLINE void ConcurrentHashMap<Key, Value, Allocator, HashFunc, EqualFunc, NumShards, GroupSize>::Reset()
+{
+    for (uint32 i = 0; i < m_numShardsBuilt; ++i)
+    {
+        ConcurrentHashMapShardAuto<ConcurrentHashMap, RWLock::ReadWrite> shard(this, ShardIndexTag(), i);
+
+        shard.GetMap()->Reset();
+    }
+}
+
+} // Util
@@ -77,9 +77,10 @@ public:
     /// Closes the current file memory mapping handle
     void Close();
 
-    /// Closes and reopens the current file memory mapping handle with the new size specified.
+    /// Grows the file backing the memory mapping to at least the new size specified.  The file is never shrunk, so
+    /// several processes sharing the file may call this concurrently.
     ///
-    /// @param  newSize  New size that the file mapping should be opened with.
+    /// @param  newSize  Minimum size that the file mapping should be opened with.
     ///
     /// @returns Success if the file mapping was successfully reloaded.
     Result ReloadMap(size_t newSize);
@@ -0,0 +1,267 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2014-2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/**
+ ***********************************************************************************************************************
+ * @file  palGrowableHashMap.h
+ * @brief PAL utility collection GrowableHashMap class declaration.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palHashMap.h"
+
+namespace Util
+{
+
+// Forward declarations.
+template<typename Key,
+         typename Value,
+         typename Allocator,
+         template<typename> class HashFunc,
+         template<typename> class EqualFunc> class GrowableHashMap;
+
+/**
+ ***********************************************************************************************************************
+ * @brief  Iterator for traversal of elements in a GrowableHashMap.
+ *
+ * Visits every live entry of the current table, followed by any entries of the previous table which have not been
+ * migrated yet.  Any non-const operation on the map invalidates the iterator.
+ ***********************************************************************************************************************
+ */
+template<typename Key,
+         typename Value,
+         typename Allocator,
+         template<typename> class HashFunc,
+         template<typename> class EqualFunc>
+class GrowableHashMapIterator
+{
+public:
+    /// Convenience typedef for the associated container for this templated iterator.
+    typedef GrowableHashMap<Key, Value, Allocator, HashFunc, EqualFunc> Container;
+
+    /// Convenience typedef for a templated entry of the associated container.
+    typedef HashMapEntry<Key, Value> Entry;
+
+    ~GrowableHashMapIterator() { }
+
+    /// Returns a pointer to current entry.  Will return null if the iterator has been advanced off the end of the
+    /// container.
+    Entry* Get() const { return m_pCurrentEntry; }
+
+    /// Advances the iterator to the next position (move forward).
+    void Next();
+
+private:
+    explicit GrowableHashMapIterator(const Container* pContainer);
+
+    void SeekOccupiedSlot();
+
+    const Container* const m_pContainer;     // Hash container that we're iterating over.
+    bool                   m_inOldTable;     // True once the iterator has moved on to the previous table.
+    uint32                 m_slot;           // Index of the current slot in the current table.
+    Entry*                 m_pCurrentEntry;  // Current entry we're at now.
+
+    PAL_DISALLOW_DEFAULT_CTOR(GrowableHashMapIterator);
+
+    // Although this is a transgression of coding standards, it means that Container does not need to have a public
+    // interface specifically to implement this class. The added encapsulation this provides is worthwhile.
+    friend class GrowableHashMap<Key, Value, Allocator, HashFunc, EqualFunc>;
+};
+
+/**
+ ***********************************************************************************************************************
+ * @brief Templated open-addressing hash map container which grows by incremental rehashing.
+ *
+ * Unlike @ref HashMap, whose bucket count is fixed at construction, this container stores its entries in a single
+ * power-of-two sized table which is probed linearly and doubled once the table exceeds its maximum load factor.  The
+ * rehash is amortized: when the table needs to grow, a new table is allocated and the previous one is kept alive while
+ * every subsequent FindAllocate, Insert and Erase migrates a small, fixed number of slots into the new table.  Lookups
+ * consult both tables until the migration completes.  No single operation therefore pays for the full rehash, which
+ * keeps the insertion latency flat for maps whose final size is unknown at Init() time.
+ *
+ * Supported operations:
+ *
+ * - Searching
+ * - Insertion
+ * - Deletion
+ * - Iteration
+ *
+ * HashFunc and EqualFunc have the same meaning as they do for @ref HashMap.  The hash value is scrambled with a
+ * multiplicative hash before it is used to pick a slot, so DefaultHashFunc is still a good choice for pointer keys even
+ * though consecutive pointers share most of their hash bits.  Keys of zero are allowed since slot occupancy is tracked
+ * in a separate control byte array.
+ *
+ * @warning This class is not thread-safe for Insert, FindAllocate, Erase, or iteration!
+ * @warning Init() must be called before using this container. Begin() and Reset() can be safely called before
+ *          initialization and Begin() will always return an iterator that points to null.
+ * @warning Entries may be moved by any non-const operation, so value pointers returned by FindAllocate or FindKey are
+ *          only valid until the next call to FindAllocate, Insert, Erase or Reset.
+ ***********************************************************************************************************************
+ */
+template<typename Key,
+         typename Value,
+         typename Allocator,
+         template<typename> class HashFunc  = DefaultHashFunc,
+         template<typename> class EqualFunc = DefaultEqualFunc>
+class GrowableHashMap
+{
+public:
+    /// Convenience typedef for a templated entry of this hash map.
+    typedef HashMapEntry<Key, Value> Entry;
+
+    /// Convenience typedef for iterators of this templated GrowableHashMap.
+    typedef GrowableHashMapIterator<Key, Value, Allocator, HashFunc, EqualFunc> Iterator;
+
+    /// Constructor
+    ///
+    /// @param [in] initialCapacity Number of entries the map should be able to hold before it has to grow for the first
+    ///                             time.
+    /// @param [in] pAllocator      Pointer to an allocator that will create system memory requested by this container.
+    explicit GrowableHashMap(uint32 initialCapacity, Allocator*const pAllocator);
+    ~GrowableHashMap();
+
+    /// Initializes the hash container.
+    ///
+    /// @returns @ref Success if the initialization completed successfully, or ErrorOutOfMemory if the operation failed
+    ///          due to an internal failure to allocate system memory.
+    Result Init();
+
+    /// Returns number of entries in the container.
+    uint32 GetNumEntries() const { return m_numEntries; }
+
+    /// Returns true if a previous growth of the table is still being migrated into the current table.
+    bool IsRehashing() const { return (m_oldTable.pMemory != nullptr); }
+
+    /// Returns an iterator pointing to the first entry.
+    Iterator Begin() const { return Iterator(this); }
+
+    /// Empty the hash container.  The current table is kept for reuse.
+    void Reset();
+
+    /// Finds a given entry; if no entry was found, allocate it.
+    ///
+    /// @param [in]  key      Key to search for.
+    /// @param [out] pExisted True if an entry for the specified key existed before this call was made.  False indicates
+    ///                       that a new entry was allocated as a result of this call.
+    /// @param [out] ppValue  Readable/writeable value in the hash map corresponding to the specified key.
+    ///
+    /// @returns @ref Success if the operation completed successfully, or @ref ErrorOutOfMemory if the operation failed
+    ///          because an internal memory allocation failed.
+    Result FindAllocate(const Key& key, bool* pExisted, Value** ppValue);
+
+    /// Gets a pointer to the value that matches the specified key.
+    ///
+    /// @param [in] key Key to search for.
+    ///
+    /// @returns A pointer to the value that matches the specified key or null if an entry for the key does not exist.
+    Value* FindKey(const Key& key) const;
+
+    /// Inserts a key/value pair entry if the key doesn't already exist in the hash map.
+    ///
+    /// @warning No action will be taken if an entry matching this key already exists, even if the specified value
+    ///          differs from the current value stored in the entry matching the specified key.
+    ///
+    /// @param [in] key   Key of the new entry to insert.
+    /// @param [in] value Value of the new entry to insert.
+    ///
+    /// @returns @ref Success if the operation completed successfully, or @ref ErrorOutOfMemory if the operation failed
+    ///          because an internal memory allocation failed.
+    Result Insert(const Key& key, const Value& value);
+
+    /// Removes an entry that matches the specified key.
+    ///
+    /// @param [in] key Key of the entry to erase.
+    ///
+    /// @returns True if the erase completed successfully, false if an entry for this key did not exist.
+    bool Erase(const Key& key);
+
+private:
+    // Occupancy state of a single slot, stored in the per-table control byte array.
+    enum SlotState : uint8
+    {
+        SlotEmpty    = 0,  // Slot has never held an entry since the table was last cleared; ends a probe sequence.
+        SlotOccupied = 1,  // Slot holds a live entry.
+        SlotDeleted  = 2,  // Slot held an entry which has been erased; probe sequences continue past it.
+    };
+
+    // Open-addressed table of entries.  Entries and their control bytes live in a single allocation.
+    struct Table
+    {
+        void*  pMemory;      // Base address of the allocation backing this table.
+        Entry* pEntries;     // Entry array.
+        uint8* pStates;      // Control byte array, one SlotState per entry.
+        uint32 capacity;     // Number of slots in the table; always a power of two.
+        uint32 shift;        // Right shift which reduces a scrambled 32-bit hash to a slot index.
+        uint32 numOccupied;  // Number of slots in the SlotOccupied state.
+        uint32 numDeleted;   // Number of slots in the SlotDeleted state.
+    };
+
+    // Smallest table we'll ever allocate.
+    static constexpr uint32 MinCapacity = 8;
+
+    // The table grows once (occupied + deleted) slots exceed this fraction of its capacity.
+    static constexpr uint32 MaxLoadNumerator   = 3;
+    static constexpr uint32 MaxLoadDenominator = 4;
+
+    // Number of slots of the previous table migrated by each non-const operation while a rehash is in progress.  This
+    // guarantees the migration completes long before the new table (which is at least twice as big as the number of
+    // live entries in the previous one) reaches its own maximum load.
+    static constexpr uint32 RehashSlotsPerOp = 8;
+
+    // Marks a failed table search.
+    static constexpr uint32 InvalidSlot = UINT32_MAX;
+
+    Result AllocateTable(uint32 capacity, Table* pTable);
+    void FreeTable(Table* pTable);
+
+    uint32 HashKey(const Key& key) const;
+    uint32 FindSlot(const Table& table, const Key& key, uint32 hash) const;
+    uint32 FindInsertSlot(const Table& table, uint32 hash) const;
+    bool NeedsGrowth() const;
+
+    Result BeginRehash();
+    void MigrateSlots(uint32 numSlots);
+    void FinishRehash() { MigrateSlots(m_oldTable.capacity); }
+
+    const HashFunc<Key>  m_hashFunc;         // Hash functor object.
+    const EqualFunc<Key> m_equalFunc;        // Key compare function object.
+    Allocator*const      m_pAllocator;       // Allocator for the tables.
+    const uint32         m_initialCapacity;  // Table capacity allocated by Init(); padded to a power of 2.
+
+    Table                m_table;            // Table receiving all new entries.
+    Table                m_oldTable;         // Table being migrated into m_table, if a rehash is in progress.
+    uint32               m_rehashSlot;       // Next slot of m_oldTable to migrate.
+    uint32               m_numEntries;       // Number of live entries across both tables.
+
+    PAL_DISALLOW_DEFAULT_CTOR(GrowableHashMap);
+    PAL_DISALLOW_COPY_AND_ASSIGN(GrowableHashMap);
+
+    // Although this is a transgression of coding standards, it prevents GrowableHashMapIterator requiring a public
+    // constructor; constructing a 'bare' iterator (i.e. without calling Begin()) can never be a legal operation.
+    friend class GrowableHashMapIterator<Key, Value, Allocator, HashFunc, EqualFunc>;
+};
+
+} // Util
@@ -0,0 +1,584 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2014-2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/**
+ ***********************************************************************************************************************
+ * @file  palGrowableHashMapImpl.h
+ * @brief PAL utility collection GrowableHashMap class implementation.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palHashBaseImpl.h"
+#include "palGrowableHashMap.h"
+
+namespace Util
+{
+
+// =====================================================================================================================
+template<typename Key,
+         typename Value,
+         typename Allocator,
+         template<typename> class HashFunc,
+         template<typename> class EqualFunc>
+PAL_INLINE GrowableHashMapIterator<Key, Value, Allocator, HashFunc, EqualFunc>::GrowableHashMapIterator(
+    const Container* pContainer)  // [retained] The hash container to iterate over
+    :
+    m_pContainer(pContainer),
+    m_inOldTable(false),
+    m_slot(0),
+    m_pCurrentEntry(nullptr)
+{
+    SeekOccupiedSlot();
+}
+
+// =====================================================================================================================
+// Proceeds to the next entry, null if to the end.
+template<typename Key,
+         typename Value,
+         typename Allocator,
+         template<typename> class HashFunc,
+         template<typename> class EqualFunc>
+PAL_INLINE void GrowableHashMapIterator<Key, Value, Allocator, HashFunc, EqualFunc>::Next()
+{
+    if (m_pCurrentEntry != nullptr)
+    {
+        m_slot++;
+        SeekOccupiedSlot();
+    }
+}
+
+// =====================================================================================================================
+// Starting at the current slot, finds the next occupied slot in either table and points the iterator at it.
+template<typename Key,
+         typename Value,
+         typename Allocator,
+         template<typename> class HashFunc,
+         template<typename> class EqualFunc>
+PAL_INLINE void GrowableHashMapIterator<Key, Value, Allocator, HashFunc, EqualFunc>::SeekOccupiedSlot()
+{
+    m_pCurrentEntry = nullptr;
+
+    while (m_pCurrentEntry == nullptr)
+    {
+        const auto& table = m_inOldTable ? m_pContainer->m_oldTable : m_pContainer->m_table;
+
+        for (; m_slot < table.capacity; ++m_slot)
+        {
+            if (table.pStates[m_slot] == Container::SlotOccupied)
+            {
+                m_pCurrentEntry = &table.pEntries[m_slot];
+                break;
+            }
+        }
+
+        if (m_pCurrentEntry == nullptr)
+        {
+            if (m_inOldTable || (m_pContainer->IsRehashing() == false))
+            {
+                break;
+            }
+
+            // Entries which haven't been migrated yet still live in the previous table.
+            m_inOldTable = true;
+            m_slot       = m_pContainer->m_rehashSlot;
+        }
+    }
+}
+
+// =====================================================================================================================
+template<typename Key,
+         typename Value,
+         typename Allocator,
+         template<typename> class HashFunc,
+         template<typename> class EqualFunc>
+PAL_INLINE GrowableHashMap<Key, Value, Allocator, HashFunc, EqualFunc>::GrowableHashMap(
+    uint32          initialCapacity,
+    Allocator*const pAllocator)
+    :
+    m_hashFunc(),
+    m_equalFunc(),
+    m_pAllocator(pAllocator),
+    m_initialCapacity(Pow2Pad(Max(MinCapacity,
+                                  ((initialCapacity * MaxLoadDenominator) / MaxLoadNumerator) + 1))),
+    m_rehashSlot(0),
+    m_numEntries(0)
+{
+    memset(&m_table,    0, sizeof(m_table));
+    memset(&m_oldTable, 0, sizeof(m_oldTable));
+}
+
+// =====================================================================================================================
+template<typename Key,
+         typename Value,
+         typename Allocator,
+         template<typename> class HashFunc,
+         template<typename> class EqualFunc>
+PAL_INLINE GrowableHashMap<Key, Value, Allocator, HashFunc, EqualFunc>::~GrowableHashMap()
+{
+    FreeTable(&m_oldTable);
+    FreeTable(&m_table);
+}
+
+// =====================================================================================================================
+template<typename Key,
+         typename Value,
+         typename Allocator,
+         template<typename> class HashFunc,
+         template<typename> class EqualFunc>
+PAL_INLINE Result GrowableHashMap<Key, Value, Allocator, HashFunc, EqualFunc>::Init()
+{
+    // The multiplicative scramble in HashKey() consumes all 32 hash bits, so unlike HashBase we don't need to ask the
+    // hash functor to guarantee a minimum number of effective low bits.
+    return AllocateTable(m_initialCapacity, &m_table);
+}
+
+// =====================================================================================================================
+// Allocates and clears a table with the specified number of slots.
+template<typename Key,
+         typename Value,
+         typename Allocator,
+         template<typename> class HashFunc,
+         template<typename> class EqualFunc>
+PAL_INLINE Result GrowableHashMap<Key, Value, Allocator, HashFunc, EqualFunc>::AllocateTable(
+    uint32 capacity,
+    Table* pTable)
+{
+    PAL_ASSERT(IsPowerOfTwo(capacity) && (capacity >= MinCapacity));
+
+    const size_t entriesSize = Pow2Align(sizeof(Entry) * capacity, PAL_DEFAULT_MEM_ALIGN);
+
+    // Zero out the memory to mark all slots empty.
+    void*const pMemory = PAL_CALLOC(entriesSize + capacity, m_pAllocator, AllocInternal);
+
+    Result result = Result::ErrorOutOfMemory;
+
+    if (pMemory != nullptr)
+    {
+        pTable->pMemory     = pMemory;
+        pTable->pEntries    = static_cast<Entry*>(pMemory);
+        pTable->pStates     = static_cast<uint8*>(VoidPtrInc(pMemory, entriesSize));
+        pTable->capacity    = capacity;
+        pTable->shift       = 32 - Log2(capacity);
+        pTable->numOccupied = 0;
+        pTable->numDeleted  = 0;
+
+        result = Result::Success;
+    }
+
+    PAL_ALERT(pMemory == nullptr);
+
+    return result;
+}
+
+// =====================================================================================================================
+template<typename Key,
+         typename Value,
+         typename Allocator,
+         template<typename> class HashFunc,
+         template<typename> class EqualFunc>
+PAL_INLINE void GrowableHashMap<Key, Value, Allocator, HashFunc, EqualFunc>::FreeTable(
+    Table* pTable)
+{
+    if (pTable->pMemory != nullptr)
+    {
+        PAL_FREE(pTable->pMemory, m_pAllocator);
+    }
+
+    memset(pTable, 0, sizeof(*pTable));
+}
+
+// =====================================================================================================================
+// Hashes the key with the client's hash functor, then applies a Fibonacci (multiplicative) scramble so that the high
+// bits, which are the ones used to select a slot, depend on every bit produced by the hash functor.
+template<typename Key,
+         typename Value,
+         typename Allocator,
+         template<typename> class HashFunc,
+         template<typename> class EqualFunc>
+PAL_INLINE uint32 GrowableHashMap<Key, Value, Allocator, HashFunc, EqualFunc>::HashKey(
+    const Key& key
+    ) const
+{
+    return (m_hashFunc(&key, sizeof(key)) * 0x9E3779B9u);
+}
+
+// =====================================================================================================================
+// Returns the slot in the specified table which holds the specified key, or InvalidSlot if it isn't present.
+template<typename Key,
+         typename Value,
+         typename Allocator,
+         template<typename> class HashFunc,
+         template<typename> class EqualFunc>
+PAL_INLINE uint32 GrowableHashMap<Key, Value, Allocator, HashFunc, EqualFunc>::FindSlot(
+    const Table& table,
+    const Key&   key,
+    uint32       hash
+    ) const
+{
+    uint32 foundSlot = InvalidSlot;
+
+    if (table.numOccupied > 0)
+    {
+        const uint32 mask = table.capacity - 1;
+
+        // The table is never allowed to fill completely, so this loop always finds an empty slot eventually.
+        for (uint32 slot = (hash >> table.shift); table.pStates[slot] != SlotEmpty; slot = ((slot + 1) & mask))
+        {
+            if ((table.pStates[slot] == SlotOccupied) && m_equalFunc(table.pEntries[slot].key, key))
+            {
+                foundSlot = slot;
+                break;
+            }
+        }
+    }
+
+    return foundSlot;
+}
+
+// =====================================================================================================================
+// Returns the first empty or deleted slot along the probe sequence for the specified hash.  The caller must have
+// already verified that the key isn't present in the table.
+template<typename Key,
+         typename Value,
+         typename Allocator,
+         template<typename> class HashFunc,
+         template<typename> class EqualFunc>
+PAL_INLINE uint32 GrowableHashMap<Key, Value, Allocator, HashFunc, EqualFunc>::FindInsertSlot(
+    const Table& table,
+    uint32       hash
+    ) const
+{
+    PAL_ASSERT((table.numOccupied + table.numDeleted) < table.capacity);
+
+    const uint32 mask = table.capacity - 1;
+
+    uint32 slot = (hash >> table.shift);
+    while (table.pStates[slot] == SlotOccupied)
+    {
+        slot = ((slot + 1) & mask);
+    }
+
+    return slot;
+}
+
+// =====================================================================================================================
+// Returns true if adding one more entry to the current table would push it past its maximum load factor.
+template<typename Key,
+         typename Value,
+         typename Allocator,
+         template<typename> class HashFunc,
+         template<typename> class EqualFunc>
+PAL_INLINE bool GrowableHashMap<Key, Value, Allocator, HashFunc, EqualFunc>::NeedsGrowth() const
+{
+    const uint32 usedSlots = m_table.numOccupied + m_table.numDeleted + 1;
+
+    return ((static_cast<uint64>(usedSlots) * MaxLoadDenominator) >
+            (static_cast<uint64>(m_table.capacity) * MaxLoadNumerator));
+}
+
+// =====================================================================================================================
+// Allocates a new table and retires the current one into m_oldTable, from which it will be migrated incrementally.  If
+// most of the used slots are tombstones the new table has the same size; otherwise it is twice as big.
+template<typename Key,
+         typename Value,
+         typename Allocator,
+         template<typename> class HashFunc,
+         template<typename> class EqualFunc>
+PAL_INLINE Result GrowableHashMap<Key, Value, Allocator, HashFunc, EqualFunc>::BeginRehash()
+{
+    // By construction the migration always finishes before the new table fills up, but if that ever stops being true
+    // just pay for the remainder of the previous rehash now.
+    PAL_ASSERT(IsRehashing() == false);
+    if (IsRehashing())
+    {
+        FinishRehash();
+    }
+
+    const uint32 newCapacity = (m_table.numOccupied >= (m_table.capacity / 4)) ? (m_table.capacity * 2)
+                                                                               : m_table.capacity;
+
+    Table newTable = { };
+    Result result  = AllocateTable(newCapacity, &newTable);
+
+    if (result == Result::Success)
+    {
+        m_oldTable   = m_table;
+        m_table      = newTable;
+        m_rehashSlot = 0;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Moves up to the specified number of slots' worth of entries from the previous table into the current one, freeing the
+// previous table once every slot has been visited.
+template<typename Key,
+         typename Value,
+         typename Allocator,
+         template<typename> class HashFunc,
+         template<typename> class EqualFunc>
+PAL_INLINE void GrowableHashMap<Key, Value, Allocator, HashFunc, EqualFunc>::MigrateSlots(
+    uint32 numSlots)
+{
+    if (IsRehashing())
+    {
+        const uint32 endSlot = Min(m_oldTable.capacity, m_rehashSlot + numSlots);
+
+        for (; m_rehashSlot < endSlot; ++m_rehashSlot)
+        {
+            if (m_oldTable.pStates[m_rehashSlot] == SlotOccupied)
+            {
+                const Entry& entry = m_oldTable.pEntries[m_rehashSlot];
+
+                // Every insertion checks the previous table first, so this key can't already be in the current one.
+                const uint32 slot = FindInsertSlot(m_table, HashKey(entry.key));
+
+                if (m_table.pStates[slot] == SlotDeleted)
+                {
+                    m_table.numDeleted--;
+                }
+
+                m_table.pEntries[slot] = entry;
+                m_table.pStates[slot]  = SlotOccupied;
+                m_table.numOccupied++;
+
+                // Leave a tombstone rather than an empty slot so that probe sequences for entries which haven't been
+                // migrated yet aren't cut short.
+                m_oldTable.pStates[m_rehashSlot] = SlotDeleted;
+                m_oldTable.numOccupied--;
+                m_oldTable.numDeleted++;
+            }
+        }
+
+        if (m_rehashSlot == m_oldTable.capacity)
+        {
+            PAL_ASSERT(m_oldTable.numOccupied == 0);
+            FreeTable(&m_oldTable);
+            m_rehashSlot = 0;
+        }
+    }
+}
+
+// =====================================================================================================================
+// Empty the hash table.
+template<typename Key,
+         typename Value,
+         typename Allocator,
+         template<typename> class HashFunc,
+         template<typename> class EqualFunc>
+PAL_INLINE void GrowableHashMap<Key, Value, Allocator, HashFunc, EqualFunc>::Reset()
+{
+    FreeTable(&m_oldTable);
+    m_rehashSlot = 0;
+
+    if (m_table.pMemory != nullptr)
+    {
+        memset(m_table.pStates, SlotEmpty, m_table.capacity);
+        m_table.numOccupied = 0;
+        m_table.numDeleted  = 0;
+    }
+
+    m_numEntries = 0;
+}
+
+// =====================================================================================================================
+// Gets a pointer to the value that matches the key.  If the key is not present, a pointer to empty space for the value
+// is returned.
+template<typename Key,
+         typename Value,
+         typename Allocator,
+         template<typename> class HashFunc,
+         template<typename> class EqualFunc>
+PAL_INLINE Result GrowableHashMap<Key, Value, Allocator, HashFunc, EqualFunc>::FindAllocate(
+    const Key& key,       // Key to search for.
+    bool*      pExisted,  // [out] True if a matching key was found.
+    Value**    ppValue)   // [out] Pointer to the value entry of the hash map's entry for the specified key.
+{
+    PAL_ASSERT(pExisted != nullptr);
+    PAL_ASSERT(ppValue != nullptr);
+    PAL_ASSERT(m_table.pMemory != nullptr);
+
+    Result result = Result::Success;
+
+    // Pay for a slice of any pending rehash before looking anything up so that the entry we return isn't moved.
+    MigrateSlots(RehashSlotsPerOp);
+
+    const uint32 hash = HashKey(key);
+
+    *pExisted = false;
+    *ppValue  = nullptr;
+
+    uint32 slot = FindSlot(m_table, key, hash);
+
+    if (slot != InvalidSlot)
+    {
+        *pExisted = true;
+        *ppValue  = &m_table.pEntries[slot].value;
+    }
+    else if (IsRehashing() && ((slot = FindSlot(m_oldTable, key, hash)) != InvalidSlot))
+    {
+        *pExisted = true;
+        *ppValue  = &m_oldTable.pEntries[slot].value;
+    }
+    else
+    {
+        if (NeedsGrowth())
+        {
+            result = BeginRehash();
+
+            // Failing to grow isn't fatal so long as the current table still has a free slot to terminate probing.
+            if ((result != Result::Success) && ((m_table.numOccupied + m_table.numDeleted + 1) < m_table.capacity))
+            {
+                result = Result::Success;
+            }
+        }
+
+        if (result == Result::Success)
+        {
+            slot = FindInsertSlot(m_table, hash);
+
+            if (m_table.pStates[slot] == SlotDeleted)
+            {
+                m_table.numDeleted--;
+            }
+
+            m_table.pEntries[slot].key = key;
+            m_table.pStates[slot]      = SlotOccupied;
+            m_table.numOccupied++;
+            m_numEntries++;
+
+            *ppValue = &m_table.pEntries[slot].value;
+        }
+    }
+
+    PAL_ASSERT(result == Result::Success);
+
+    return result;
+}
+
+// =====================================================================================================================
+// Gets a pointer to the value that matches the key.  Returns null if no entry is present matching the specified key.
+template<typename Key,
+         typename Value,
+         typename Allocator,
+         template<typename> class HashFunc,
+         template<typename> class EqualFunc>
+PAL_INLINE Value* GrowableHashMap<Key, Value, Allocator, HashFunc, EqualFunc>::FindKey(
+    const Key& key
+    ) const
+{
+    Value* pValue = nullptr;
+
+    if (m_numEntries > 0)
+    {
+        const uint32 hash = HashKey(key);
+        uint32       slot = FindSlot(m_table, key, hash);
+
+        if (slot != InvalidSlot)
+        {
+            pValue = &m_table.pEntries[slot].value;
+        }
+        else if (IsRehashing() && ((slot = FindSlot(m_oldTable, key, hash)) != InvalidSlot))
+        {
+            pValue = &m_oldTable.pEntries[slot].value;
+        }
+    }
+
+    return pValue;
+}
+
+// =====================================================================================================================
+// Inserts a key/value pair entry if it doesn't already exist.
+template<typename Key,
+         typename Value,
+         typename Allocator,
+         template<typename> class HashFunc,
+         template<typename> class EqualFunc>
+PAL_INLINE Result GrowableHashMap<Key, Value, Allocator, HashFunc, EqualFunc>::Insert(
+    const Key&   key,
+    const Value& value)
+{
+    bool   existed = true;
+    Value* pValue  = nullptr;
+
+    Result result = FindAllocate(key, &existed, &pValue);
+
+    // Add the new value if it did not exist already. If FindAllocate returns Success, pValue != nullptr.
+    if ((result == Result::Success) && (existed == false))
+    {
+        *pValue = value;
+    }
+
+    PAL_ASSERT(result == Result::Success);
+
+    return result;
+}
+
+// =====================================================================================================================
+// Removes an entry with the specified key.  The slot is turned into a tombstone so that probe sequences which pass
+// through it remain intact; tombstones are dropped the next time the table is rehashed.
+template<typename Key,
+         typename Value,
+         typename Allocator,
+         template<typename> class HashFunc,
+         template<typename> class EqualFunc>
+PAL_INLINE bool GrowableHashMap<Key, Value, Allocator, HashFunc, EqualFunc>::Erase(
+    const Key& key)
+{
+    bool erased = false;
+
+    if (m_numEntries > 0)
+    {
+        MigrateSlots(RehashSlotsPerOp);
+
+        const uint32 hash  = HashKey(key);
+        Table*       pTable = &m_table;
+        uint32       slot   = FindSlot(m_table, key, hash);
+
+        if ((slot == InvalidSlot) && IsRehashing())
+        {
+            pTable = &m_oldTable;
+            slot   = FindSlot(m_oldTable, key, hash);
+        }
+
+        if (slot != InvalidSlot)
+        {
+            pTable->pStates[slot] = SlotDeleted;
+            pTable->numOccupied--;
+            pTable->numDeleted++;
+
+            PAL_ASSERT(m_numEntries > 0);
+            m_numEntries--;
+
+            erased = true;
+        }
+    }
+
+    return erased;
+}
+
+} // Util
@@ -52,9 +52,9 @@ struct MemMapFileHeader
     uint32 headerSize;         ///< complete file header size for file type
     uint32 fileVersion;        ///< file version
 
-    // Navigation
-    size_t storageCapacity;    ///< How large the last successful memory mapping requested was
-    size_t storageEnd;         ///< current "end" of the cache file for appending new blocks
+    // Navigation.  Both values are updated with atomic operations, since several processes may share the header.
+    uint64 storageCapacity;    ///< How large the last successful memory mapping requested was
+    uint64 storageEnd;         ///< current "end" of the cache file for appending new blocks
     uint32 reserved[10];       ///< reserved for future expansion
 };
 
@@ -73,7 +73,8 @@ public:
     ~MemMapFile();
 
     /// Opens a memory mapped file for this expanding storage container that can be shared across processes. This
-    /// function will create a file that does not exist, but only if write access is specified.
+    /// function will create a file that does not exist, but only if write access is specified.  If DiscardContents is
+    /// specified, the contents of an existing file are thrown away and its header is reinitialized.
     ///
     /// @param  accessFlags     Bitmask of StorageAccessModeFlags.
     /// @param  mappingSize     Initial size of the container, can be set to zero to load the entire file for an
@@ -102,6 +103,20 @@ public:
     /// @returns Success if new space was successfully created.
     Result GetNewStorageSpace(size_t dataSize, bool advanceStorage, FileView* pOutView);
 
+    /// Atomically reserves storage space for new data at the end of the container.  Unlike GetNewStorageSpace(), this
+    /// is safe to call from several threads or processes sharing the same file: each caller receives a distinct range.
+    ///
+    /// @param       dataSize  Size, in bytes, of the storage to reserve.
+    /// @param [out] pOffset   Offset of the reserved range, suitable for GetExistingStorage().
+    /// @param       pOutView  Optional. File View that will be mapped onto the reserved range.
+    ///
+    /// @note If this fails after the range was reserved (e.g., because the file couldn't grow), the range is left
+    ///       behind as zero-filled or out-of-capacity space.  Readers must be prepared to skip such gaps and must not
+    ///       access storage beyond GetStorageSize().
+    ///
+    /// @returns Success if the space was reserved and is backed by the file.
+    Result ReserveStorageSpace(size_t dataSize, size_t* pOffset, FileView* pOutView);
+
     /// Gets a read-only FileView of the desired range in the expanding storage file.
     ///
     /// @param  dataOffset Offset into storage to create the FileView.
@@ -145,13 +160,24 @@ public:
     /// @return Size of the storage container, or -1 if the container is invalid.
     size_t GetStorageSize() const { return GetStorageCapacity() - GetHeaderSize(); }
 
+    /// Returns the number of bytes of storage which have been used so far (not counting the storage header).  This is
+    /// also the offset at which the next call to GetNewStorageSpace() will place its data.
+    ///
+    /// @return Used size of the storage container, or InvalidOffset if the container is invalid.
+    size_t GetUsedStorageSize() const
+    {
+        const size_t storageEnd = GetStorageEnd();
+        return (storageEnd == InvalidOffset) ? InvalidOffset : LocalToExternalOffset(storageEnd);
+    }
+
 private:
 
     /// Opens the memory mapping handle.
     Result OpenMemoryMapping(const char* pFileName, size_t mappingSize, bool validateHeader, const char* pSystemName);
     /// Closes the memory mapping handle.
     void CloseMemoryMapping();
-    /// Expands the available storage by reopening the memory mapping.
+    /// Expands the available storage by reopening the memory mapping.  The storage is never shrunk, even if another
+    /// instance expands it concurrently.
     Result ExpandStorage(size_t minimumNewSize);
 
     /// Accessor wrappings for memory mapped values (with full SEH)
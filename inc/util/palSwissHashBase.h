@@ -0,0 +1,223 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2014-2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/**
+ ***********************************************************************************************************************
+ * @file  palSwissHashBase.h
+ * @brief PAL utility collection shared class declarations used by the SwissHashMap and SwissHashSet containers.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palHashBase.h"
+
+namespace Util
+{
+
+// Forward declarations.
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc> class SwissHashBase;
+
+/**
+ ***********************************************************************************************************************
+ * @brief  Iterator for traversal of elements in a Swiss hash container.
+ *
+ * Backward iterating is not supported.  Any insertion or removal invalidates the iterator.
+ ***********************************************************************************************************************
+ */
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc>
+class SwissHashIterator
+{
+public:
+    /// Convenience typedef for the associated container for this templated iterator.
+    typedef SwissHashBase<Key, Entry, Allocator, HashFunc, EqualFunc> Container;
+
+    ~SwissHashIterator() { }
+
+    /// Returns a pointer to current entry.  Will return null if the iterator has been advanced off the end of the
+    /// container.
+    Entry* Get() const { return m_pCurrentEntry; }
+
+    /// Advances the iterator to the next position (move forward).
+    void Next();
+
+private:
+    SwissHashIterator(const Container* pContainer, uint32 startSlot);
+
+    void SeekFullSlot();
+
+    const Container* const m_pContainer;     // Hash container that we're iterating over.
+    uint32                 m_slot;           // Index of the current slot.
+    Entry*                 m_pCurrentEntry;  // Current entry we're at now.
+
+    PAL_DISALLOW_DEFAULT_CTOR(SwissHashIterator);
+
+    // Although this is a transgression of coding standards, it means that Container does not need to have a public
+    // interface specifically to implement this class. The added encapsulation this provides is worthwhile.
+    friend class SwissHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>;
+};
+
+/**
+ ***********************************************************************************************************************
+ * @brief Templated base class for SwissHashMap and SwissHashSet, supporting the ability to store, find, and remove
+ *        entries.
+ *
+ * This is an open-addressing table in the style of a "Swiss table".  Alongside the entry array the container keeps one
+ * control byte per slot: a slot is either empty, deleted (a tombstone) or full, in which case its control byte holds
+ * seven bits of the key's hash.  Slots are probed in aligned groups of sixteen; on SSE2-capable targets all sixteen
+ * control bytes of a group are compared against the hash fragment with a single byte compare, so only the (rare) slots
+ * whose fragment matches ever need their key compared with EqualFunc.  A miss usually ends after touching a single
+ * sixteen byte control group without reading any entries at all.  Targets without SSE2 fall back to an equivalent
+ * scalar loop.
+ *
+ * Because lookups rarely touch the entries, the table tolerates a 7/8 maximum load factor, after which it is rehashed
+ * into a table twice as big (or of the same size if most of the used slots are tombstones).
+ *
+ * Compared to @ref HashBase the following differences apply:
+ *
+ * - Keys of zero are allowed.
+ * - Entries are not limited to a fraction of a cache line, though small entries are still recommended.
+ * - Entries move when the table grows, so pointers to values are only valid until the next insertion.
+ ***********************************************************************************************************************
+ */
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc>
+class SwissHashBase
+{
+public:
+    /// Convenience typedef for iterators of this templated SwissHashBase.
+    typedef SwissHashIterator<Key, Entry, Allocator, HashFunc, EqualFunc> Iterator;
+
+    /// Initializes the hash container.
+    ///
+    /// @returns @ref Success if the initialization completed successfully, or ErrorOutOfMemory if the operation failed
+    ///          due to an internal failure to allocate system memory.
+    Result Init();
+
+    /// Returns number of entries in the container.
+    uint32 GetNumEntries() const { return m_numEntries; }
+
+    /// Returns an iterator pointing to the first entry.
+    Iterator Begin() const { return Iterator(this, 0); }
+
+    /// Empty the hash container.  The current table is kept for reuse.
+    void Reset();
+
+    /// Number of slots probed at once.
+    static constexpr uint32 GroupWidth = 16;
+
+protected:
+    /// @internal Constructor
+    ///
+    /// @param [in] initialCapacity Number of entries the container should be able to hold before it has to grow.
+    /// @param [in] pAllocator      The allocator that will allocate memory if required.
+    explicit SwissHashBase(uint32 initialCapacity, Allocator*const pAllocator);
+    virtual ~SwissHashBase() { PAL_SAFE_FREE(m_pMemory, m_pAllocator); }
+
+    /// @internal Finds the entry that matches the specified key.
+    ///
+    /// @param [in] key Key to search for.
+    ///
+    /// @returns Pointer to the matching entry or null if the key isn't present.
+    Entry* FindEntry(const Key& key) const;
+
+    /// @internal Finds the entry that matches the specified key; if no entry was found, allocate one and set its key.
+    ///
+    /// @param [in]  key      Key to search for.
+    /// @param [out] pExisted True if an entry for the specified key existed before this call was made.
+    /// @param [out] ppEntry  Matching or newly allocated entry.
+    ///
+    /// @returns @ref Success, or @ref ErrorOutOfMemory if the table needed to grow and the allocation failed.
+    Result FindAllocateEntry(const Key& key, bool* pExisted, Entry** ppEntry);
+
+    /// @internal Removes the entry that matches the specified key.
+    ///
+    /// @param [in] key Key of the entry to erase.
+    ///
+    /// @returns True if an entry was removed.
+    bool EraseEntry(const Key& key);
+
+    const HashFunc  m_hashFunc;    ///< @internal Hash functor object.
+    const EqualFunc m_equalFunc;   ///< @internal Key compare function object.
+    Allocator*const m_pAllocator;  ///< @internal Allocator for the table.
+
+private:
+    // Control byte values.  Full slots store the 7-bit hash fragment, so they always have the top bit clear.
+    static constexpr uint8 CtrlEmpty   = 0x80;
+    static constexpr uint8 CtrlDeleted = 0xFE;
+
+    // Smallest table we'll ever allocate.
+    static constexpr uint32 MinCapacity = GroupWidth;
+
+    // The table grows once (full + deleted) slots exceed this fraction of its capacity.
+    static constexpr uint32 MaxLoadNumerator   = 7;
+    static constexpr uint32 MaxLoadDenominator = 8;
+
+    // Marks a failed table search.
+    static constexpr uint32 InvalidSlot = UINT32_MAX;
+
+    static uint32 MatchByte(const uint8* pGroup, uint8 value);
+    static uint32 MatchEmpty(const uint8* pGroup) { return MatchByte(pGroup, CtrlEmpty); }
+    static uint32 MatchEmptyOrDeleted(const uint8* pGroup);
+
+    uint64 HashKey(const Key& key) const;
+    uint32 FindSlot(const Key& key, uint64 hash) const;
+    uint32 FindInsertSlot(uint64 hash) const;
+    Result Rehash(uint32 newCapacity);
+
+    // Returns the hash fragment stored in the control byte of a full slot.
+    static uint8 HashFragment(uint64 hash) { return static_cast<uint8>(hash >> 57); }
+
+    // Returns the group in which probing starts.
+    uint32 FirstGroup(uint64 hash) const { return (static_cast<uint32>(hash >> 32) & (m_numGroups - 1)); }
+
+    const uint32    m_initialCapacity;  // Capacity of the table allocated by Init().
+    uint32          m_capacity;         // Slots in the table; always a power of 2 and a multiple of GroupWidth.
+    uint32          m_numGroups;        // Number of control groups in the table.
+    uint32          m_numEntries;       // Number of full slots.
+    uint32          m_numDeleted;       // Number of slots holding tombstones.
+    void*           m_pMemory;          // Table allocation.
+    uint8*          m_pCtrl;            // Control byte array.
+    Entry*          m_pEntries;         // Entry array.
+
+    PAL_DISALLOW_DEFAULT_CTOR(SwissHashBase);
+    PAL_DISALLOW_COPY_AND_ASSIGN(SwissHashBase);
+
+    // Although this is a transgression of coding standards, it prevents SwissHashIterator requiring a public
+    // constructor; constructing a 'bare' iterator (i.e. without calling Begin()) can never be a legal operation.
+    friend class SwissHashIterator<Key, Entry, Allocator, HashFunc, EqualFunc>;
+};
+
+} // Util
@@ -0,0 +1,482 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2014-2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/**
+ ***********************************************************************************************************************
+ * @file  palSwissHashBaseImpl.h
+ * @brief PAL utility collection shared class implementations used by the SwissHashMap and SwissHashSet containers.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palHashBaseImpl.h"
+#include "palSwissHashBase.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define PAL_SWISS_HASH_SSE2 1
+#else
+#define PAL_SWISS_HASH_SSE2 0
+#endif
+
+namespace Util
+{
+
+// =====================================================================================================================
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc>
+PAL_INLINE SwissHashIterator<Key, Entry, Allocator, HashFunc, EqualFunc>::SwissHashIterator(
+    const Container* pContainer,  // [retained] The hash container to iterate over
+    uint32           startSlot)   // The beginning slot
+    :
+    m_pContainer(pContainer),
+    m_slot(startSlot),
+    m_pCurrentEntry(nullptr)
+{
+    SeekFullSlot();
+}
+
+// =====================================================================================================================
+// Proceeds to the next entry, null if to the end.
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc>
+PAL_INLINE void SwissHashIterator<Key, Entry, Allocator, HashFunc, EqualFunc>::Next()
+{
+    if (m_pCurrentEntry != nullptr)
+    {
+        m_slot++;
+        SeekFullSlot();
+    }
+}
+
+// =====================================================================================================================
+// Starting at the current slot, points the iterator at the next full slot.
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc>
+PAL_INLINE void SwissHashIterator<Key, Entry, Allocator, HashFunc, EqualFunc>::SeekFullSlot()
+{
+    m_pCurrentEntry = nullptr;
+
+    for (; m_slot < m_pContainer->m_capacity; ++m_slot)
+    {
+        // Full slots are the only ones with the top bit of their control byte clear.
+        if ((m_pContainer->m_pCtrl[m_slot] & 0x80) == 0)
+        {
+            m_pCurrentEntry = &m_pContainer->m_pEntries[m_slot];
+            break;
+        }
+    }
+}
+
+// =====================================================================================================================
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc>
+PAL_INLINE SwissHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::SwissHashBase(
+    uint32          initialCapacity,
+    Allocator*const pAllocator)
+    :
+    m_hashFunc(),
+    m_equalFunc(),
+    m_pAllocator(pAllocator),
+    m_initialCapacity(Pow2Pad(Max(MinCapacity,
+                                  ((initialCapacity * MaxLoadDenominator) / MaxLoadNumerator) + 1))),
+    m_capacity(0),
+    m_numGroups(0),
+    m_numEntries(0),
+    m_numDeleted(0),
+    m_pMemory(nullptr),
+    m_pCtrl(nullptr),
+    m_pEntries(nullptr)
+{
+}
+
+// =====================================================================================================================
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc>
+PAL_INLINE Result SwissHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::Init()
+{
+    return Rehash(m_initialCapacity);
+}
+
+// =====================================================================================================================
+// Empty the hash table.
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc>
+PAL_INLINE void SwissHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::Reset()
+{
+    if (m_pCtrl != nullptr)
+    {
+        memset(m_pCtrl, CtrlEmpty, m_capacity);
+    }
+
+    m_numEntries = 0;
+    m_numDeleted = 0;
+}
+
+// =====================================================================================================================
+// Returns a bitmask with bit i set if the i-th control byte in the group equals the specified value.
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc>
+PAL_INLINE uint32 SwissHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::MatchByte(
+    const uint8* pGroup,
+    uint8        value)
+{
+#if PAL_SWISS_HASH_SSE2
+    const __m128i ctrl = _mm_load_si128(reinterpret_cast<const __m128i*>(pGroup));
+    return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(static_cast<char>(value)))));
+#else
+    uint32 mask = 0;
+    for (uint32 i = 0; i < GroupWidth; ++i)
+    {
+        mask |= (static_cast<uint32>(pGroup[i] == value) << i);
+    }
+    return mask;
+#endif
+}
+
+// =====================================================================================================================
+// Returns a bitmask with bit i set if the i-th control byte in the group is empty or deleted.
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc>
+PAL_INLINE uint32 SwissHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::MatchEmptyOrDeleted(
+    const uint8* pGroup)
+{
+#if PAL_SWISS_HASH_SSE2
+    // Both special control values have their top bit set, which is exactly what movemask extracts.
+    const __m128i ctrl = _mm_load_si128(reinterpret_cast<const __m128i*>(pGroup));
+    return static_cast<uint32>(_mm_movemask_epi8(ctrl));
+#else
+    uint32 mask = 0;
+    for (uint32 i = 0; i < GroupWidth; ++i)
+    {
+        mask |= (static_cast<uint32>(pGroup[i] >> 7) << i);
+    }
+    return mask;
+#endif
+}
+
+// =====================================================================================================================
+// Hashes the key with the client's hash functor, then spreads the result over 64 bits with a multiplicative hash.  The
+// top 7 bits become the control byte fragment and bits 32 and up select the first group to probe.
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc>
+PAL_INLINE uint64 SwissHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::HashKey(
+    const Key& key
+    ) const
+{
+    return (static_cast<uint64>(m_hashFunc(&key, sizeof(key))) * 0x9E3779B97F4A7C15ull);
+}
+
+// =====================================================================================================================
+// Returns the slot which holds the specified key, or InvalidSlot if it isn't present.
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc>
+PAL_INLINE uint32 SwissHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::FindSlot(
+    const Key& key,
+    uint64     hash
+    ) const
+{
+    PAL_ASSERT(m_pMemory != nullptr);
+
+    const uint8 fragment  = HashFragment(hash);
+    uint32      foundSlot = InvalidSlot;
+    uint32      group     = FirstGroup(hash);
+
+    // Groups are visited in triangular order, which covers every group of a power-of-two sized table.  The table is
+    // never allowed to fill completely, so the probe always ends at a group containing an empty slot.
+    for (uint32 probe = 1; foundSlot == InvalidSlot; ++probe)
+    {
+        const uint8* pGroup = &m_pCtrl[group * GroupWidth];
+        uint32       match  = MatchByte(pGroup, fragment);
+        uint32       index  = 0;
+
+        while (BitMaskScanForward(&index, match))
+        {
+            const uint32 slot = (group * GroupWidth) + index;
+
+            if (m_equalFunc(m_pEntries[slot].key, key))
+            {
+                foundSlot = slot;
+                break;
+            }
+
+            match &= (match - 1);
+        }
+
+        if ((foundSlot != InvalidSlot) || (MatchEmpty(pGroup) != 0))
+        {
+            break;
+        }
+
+        group = (group + probe) & (m_numGroups - 1);
+    }
+
+    return foundSlot;
+}
+
+// =====================================================================================================================
+// Returns the first empty or deleted slot along the probe sequence for the specified hash.  The caller must have
+// already verified that the key isn't present in the table.
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc>
+PAL_INLINE uint32 SwissHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::FindInsertSlot(
+    uint64 hash
+    ) const
+{
+    PAL_ASSERT((m_numEntries + m_numDeleted) < m_capacity);
+
+    uint32 group = FirstGroup(hash);
+    uint32 index = 0;
+
+    for (uint32 probe = 1;
+         BitMaskScanForward(&index, MatchEmptyOrDeleted(&m_pCtrl[group * GroupWidth])) == false;
+         ++probe)
+    {
+        group = (group + probe) & (m_numGroups - 1);
+    }
+
+    return (group * GroupWidth) + index;
+}
+
+// =====================================================================================================================
+// Replaces the table with a new one of the specified capacity and reinserts every live entry, dropping tombstones.
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc>
+PAL_INLINE Result SwissHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::Rehash(
+    uint32 newCapacity)
+{
+    PAL_ASSERT(IsPowerOfTwo(newCapacity) && (newCapacity >= MinCapacity));
+
+    // The control bytes go first so that every group is aligned for the 16-byte vector loads.
+    const size_t ctrlSize = Pow2Align(static_cast<size_t>(newCapacity), Max<size_t>(alignof(Entry), GroupWidth));
+    void*const   pMemory  = PAL_MALLOC_ALIGNED(ctrlSize + (sizeof(Entry) * newCapacity),
+                                               Max<size_t>(alignof(Entry), GroupWidth),
+                                               m_pAllocator,
+                                               AllocInternal);
+
+    Result result = Result::ErrorOutOfMemory;
+
+    if (pMemory != nullptr)
+    {
+        void*const   pOldMemory  = m_pMemory;
+        const uint8* pOldCtrl    = m_pCtrl;
+        const Entry* pOldEntries = m_pEntries;
+        const uint32 oldCapacity = m_capacity;
+
+        m_pMemory    = pMemory;
+        m_pCtrl      = static_cast<uint8*>(pMemory);
+        m_pEntries   = static_cast<Entry*>(VoidPtrInc(pMemory, ctrlSize));
+        m_capacity   = newCapacity;
+        m_numGroups  = newCapacity / GroupWidth;
+        m_numDeleted = 0;
+
+        memset(m_pCtrl, CtrlEmpty, m_capacity);
+
+        for (uint32 oldSlot = 0; oldSlot < oldCapacity; ++oldSlot)
+        {
+            if ((pOldCtrl[oldSlot] & 0x80) == 0)
+            {
+                const Entry& entry = pOldEntries[oldSlot];
+                const uint32 slot  = FindInsertSlot(HashKey(entry.key));
+
+                m_pCtrl[slot]    = pOldCtrl[oldSlot];
+                m_pEntries[slot] = entry;
+            }
+        }
+
+        if (pOldMemory != nullptr)
+        {
+            PAL_FREE(pOldMemory, m_pAllocator);
+        }
+
+        result = Result::Success;
+    }
+
+    PAL_ALERT(pMemory == nullptr);
+
+    return result;
+}
+
+// =====================================================================================================================
+// Gets a pointer to the entry that matches the key.  Returns null if no entry is present matching the specified key.
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc>
+PAL_INLINE Entry* SwissHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::FindEntry(
+    const Key& key
+    ) const
+{
+    Entry* pEntry = nullptr;
+
+    if (m_numEntries > 0)
+    {
+        const uint32 slot = FindSlot(key, HashKey(key));
+
+        if (slot != InvalidSlot)
+        {
+            pEntry = &m_pEntries[slot];
+        }
+    }
+
+    return pEntry;
+}
+
+// =====================================================================================================================
+// Gets a pointer to the entry that matches the key.  If the key is not present, a new entry is allocated for it.
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc>
+PAL_INLINE Result SwissHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::FindAllocateEntry(
+    const Key& key,       // Key to search for.
+    bool*      pExisted,  // [out] True if a matching key was found.
+    Entry**    ppEntry)   // [out] Matching or newly allocated entry.
+{
+    PAL_ASSERT(pExisted != nullptr);
+    PAL_ASSERT(ppEntry != nullptr);
+
+    Result       result = Result::Success;
+    const uint64 hash   = HashKey(key);
+    uint32       slot   = FindSlot(key, hash);
+
+    *pExisted = (slot != InvalidSlot);
+    *ppEntry  = nullptr;
+
+    if (*pExisted == false)
+    {
+        const uint64 usedSlots = m_numEntries + m_numDeleted + 1;
+
+        if ((usedSlots * MaxLoadDenominator) > (static_cast<uint64>(m_capacity) * MaxLoadNumerator))
+        {
+            // Mostly tombstones?  Then a same-size rehash reclaims enough space.
+            const uint32 newCapacity = (m_numEntries >= (m_capacity / 2)) ? (m_capacity * 2) : m_capacity;
+
+            result = Rehash(newCapacity);
+
+            // Failing to grow isn't fatal so long as the table still has a free slot to terminate probing.
+            if ((result != Result::Success) && (usedSlots < m_capacity))
+            {
+                result = Result::Success;
+            }
+        }
+
+        if (result == Result::Success)
+        {
+            slot = FindInsertSlot(hash);
+
+            if (m_pCtrl[slot] == CtrlDeleted)
+            {
+                m_numDeleted--;
+            }
+
+            m_pCtrl[slot]        = HashFragment(hash);
+            m_pEntries[slot].key = key;
+            m_numEntries++;
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        *ppEntry = &m_pEntries[slot];
+    }
+
+    PAL_ASSERT(result == Result::Success);
+
+    return result;
+}
+
+// =====================================================================================================================
+// Removes the entry with the specified key.
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc>
+PAL_INLINE bool SwissHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::EraseEntry(
+    const Key& key)
+{
+    const uint32 slot = (m_numEntries > 0) ? FindSlot(key, HashKey(key)) : InvalidSlot;
+
+    if (slot != InvalidSlot)
+    {
+        // If the group still has an empty slot no probe sequence can ever have continued past it, so the slot can go
+        // straight back to empty.  Otherwise leave a tombstone to keep longer probe sequences intact.
+        if (MatchEmpty(&m_pCtrl[slot & ~(GroupWidth - 1)]) != 0)
+        {
+            m_pCtrl[slot] = CtrlEmpty;
+        }
+        else
+        {
+            m_pCtrl[slot] = CtrlDeleted;
+            m_numDeleted++;
+        }
+
+        PAL_ASSERT(m_numEntries > 0);
+        m_numEntries--;
+    }
+
+    return (slot != InvalidSlot);
+}
+
+} // Util
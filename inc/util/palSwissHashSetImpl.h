@@ -0,0 +1,59 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2014-2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/**
+ ***********************************************************************************************************************
+ * @file  palSwissHashSetImpl.h
+ * @brief PAL utility collection SwissHashSet class implementation.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palSwissHashBaseImpl.h"
+#include "palSwissHashSet.h"
+
+namespace Util
+{
+
+// =====================================================================================================================
+// Inserts an entry if it doesn't already exist.
+template<typename Key,
+         typename Allocator,
+         template<typename> class HashFunc,
+         template<typename> class EqualFunc>
+PAL_INLINE Result SwissHashSet<Key, Allocator, HashFunc, EqualFunc>::Insert(
+    const Key& key)
+{
+    bool   existed = false;
+    Entry* pEntry  = nullptr;
+
+    const Result result = this->FindAllocateEntry(key, &existed, &pEntry);
+
+    PAL_ASSERT(result == Result::Success);
+
+    return result;
+}
+
+} // Util
@@ -108,15 +108,21 @@ private:
 /// Defines an opaque key, visible to all threads, that is used to store and retrieve data local to the current thread.
 typedef pthread_key_t ThreadLocalKey;
 
+/// Function called when a thread which has a non-null value stored at a thread-local key exits.
+typedef void (*ThreadLocalDestructor)(void* pValue);
+
 /// Creates a new key for this process to store and retrieve thread-local data.  It is a good idea to use a small
 /// number of keys because some platforms may place low limits on the number of keys per process.
 ///
-/// @param [in,out] pKey Pointer to the key being created.
+/// @param [in,out] pKey          Pointer to the key being created.
+/// @param [in]     pfnDestructor Optional function called with a thread's value for this key when that thread exits.
+///                               It is not called for values which are null or for threads still running when the key
+///                               is deleted.
 ///
 /// @returns Success if the key was successfully created.  Otherwise, one of the following error codes may be returned.
 ///          + ErrorInvalidPointer if pKey is null.
 ///          + ErrorUnavailable if no more keys can be created.
-extern Result CreateThreadLocalKey(ThreadLocalKey* pKey);
+extern Result CreateThreadLocalKey(ThreadLocalKey* pKey, ThreadLocalDestructor pfnDestructor = nullptr);
 
 /// Deletes a key that was previously created by @ref CreateThreadLocalKey.  It is the caller's responsibility to free
 /// any thread-local dynamic allocations stored at this key.  The key is considered invalid after the call returns.
@@ -513,6 +513,11 @@ PAL_INLINE Result CollapseResults(Result lhs, Result rhs)
  * - HashMap: Fast map implementation.  Note that this implementation has some non-standard restrictions on the key
  *   (can't be 0) and value size (must fit in a cache line).
  * - HashSet: Fast set implementation.  Note the similar restrictions to HashMap.
+ * - SwissHashMap/SwissHashSet: Open-addressing variants of HashMap and HashSet which keep a hash fragment per slot and
+ *   probe sixteen slots at once (using SSE2 where available).  Best suited to lookup-dominated containers.
+ * - GrowableHashMap: Open-addressing map which grows by incremental rehashing.  A better fit than HashMap when the
+ *   number of entries isn't known up front, at the cost of value pointers only being stable until the next insert.
+ * - ConcurrentHashMap: Thread-safe map made of independently locked HashMap shards, for maps shared by many threads.
  * - IntervalTree: [Interval tree](http://en.wikipedia.org/wiki/Interval_tree) implementation.
  * - RingBuffer: A ringed buffer of variable length and size.
  *
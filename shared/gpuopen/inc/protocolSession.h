@@ -53,6 +53,23 @@ namespace DevDriver
 
         virtual Result Send(uint32 payloadSizeInBytes, const void* pPayload, uint32 timeoutInMs) = 0;
         virtual Result Receive(uint32 payloadSizeInBytes, void *pPayload, uint32 *pBytesReceived, uint32 timeoutInMs) = 0;
+
+        // Sends a single message whose payload is the header followed by the data region.
+        virtual Result SendGather(uint32      headerSizeInBytes,
+                                  const void* pHeader,
+                                  uint32      dataSizeInBytes,
+                                  const void* pData,
+                                  uint32      timeoutInMs) = 0;
+
+        // Receives a single message, splitting its payload between the header and the data region.
+        // pBytesReceived returns the total payload size.
+        virtual Result ReceiveScatter(uint32  headerSizeInBytes,
+                                      void*   pHeader,
+                                      uint32  dataSizeInBytes,
+                                      void*   pData,
+                                      uint32* pBytesReceived,
+                                      uint32  timeoutInMs) = 0;
+
         virtual void CloseSession(Result reason = Result::Error) = 0;
         virtual void OrphanSession() = 0;
 
@@ -64,6 +64,15 @@ namespace DevDriver
         private:
             void ResetState() override;
 
+            // Reads transfer data from a session that negotiated bulk transfers.
+            Result ReadBulkTransferData(uint8* pDstBuffer, size_t bufferSize, size_t* pBytesRead);
+
+            // Receives a single bulk data chunk, placing its data at pData.
+            Result ReceiveBulkChunk(uint32* pCommand, uint8* pData, uint32 dataSize, uint32* pBytesReceived);
+
+            // Receives the sentinel that terminates a bulk transfer.
+            Result ReceiveBulkSentinel();
+
             enum class TransferState : uint32
             {
                 Idle = 0,
@@ -75,12 +84,14 @@ namespace DevDriver
             struct ClientTransferContext
             {
                 TransferState state;
-                uint32 totalBytes;
+                uint64 totalBytes;
                 uint32 numChunks;
                 uint32 numChunksReceived;
                 TransferPayload lastPayload;
                 size_t dataChunkSizeInBytes;
                 size_t dataChunkBytesRead;
+                uint64 bytesReceived;  // Bulk transfers only: data bytes received from the server so far
+                uint64 bytesAcked;     // Bulk transfers only: data bytes covered by the last cumulative ack
             };
 
             ClientTransferContext m_transferContext;
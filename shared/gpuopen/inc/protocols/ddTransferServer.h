@@ -40,6 +40,7 @@ namespace DevDriver
     namespace TransferProtocol
     {
         class LocalBlock;
+        struct TransferSession;
 
         // The protocol server implementation for the transfer protocol.
         class TransferServer : public BaseProtocolServer
@@ -62,6 +63,9 @@ namespace DevDriver
             void UnregisterLocalBlock(const SharedPointer<LocalBlock>& pLocalBlock);
 
         private:
+            // Streams block data for a session that negotiated bulk transfers.
+            void UpdateBulkTransfer(const SharedPointer<ISession>& pSession, TransferSession* pSessionData);
+
             // Mutex used for synchronizing the registered blocks list.
             Platform::Mutex m_mutex;
 
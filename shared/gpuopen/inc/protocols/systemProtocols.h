@@ -58,6 +58,29 @@
 #define URI_RESPONSE_FORMATS_VERSION 2
 #define URI_INITIAL_VERSION 1
 
+/*
+***********************************************************************************************************************
+* Transfer Protocol
+***********************************************************************************************************************
+*/
+
+#define TRANSFER_PROTOCOL_MAJOR_VERSION 2
+#define TRANSFER_PROTOCOL_MINOR_VERSION 0
+
+#define TRANSFER_PROTOCOL_MINIMUM_MAJOR_VERSION 1
+
+/*
+***********************************************************************************************************************
+*| Version | Change Description                                                                                       |
+*| ------- | ---------------------------------------------------------------------------------------------------------|
+*|  2.0    | Bulk transfers: variably sized data chunks sent from the block's backing store and cumulative acks.      |
+*|  1.0    | Initial version                                                                                          |
+***********************************************************************************************************************
+*/
+
+#define TRANSFER_BULK_VERSION 2
+#define TRANSFER_INITIAL_VERSION 1
+
 namespace DevDriver
 {
 
@@ -256,6 +279,7 @@ namespace DevDriver
             TransferDataChunk,
             TransferDataSentinel,
             TransferAbort,
+            TransferDataAck,
             Count,
         };
 
@@ -263,6 +287,14 @@ namespace DevDriver
         //        The compiler pads out TransferMessage to 4 bytes when it's included in the payload struct.
         DD_STATIC_CONST Size kMaxTransferDataChunkSize = (kMaxPayloadSizeInBytes - sizeof(uint32));
 
+        // Size of the command header that precedes the data in a bulk transfer data chunk.
+        DD_STATIC_CONST Size kTransferHeaderSize = sizeof(uint32);
+
+        // In bulk transfers the server keeps at most this many bytes in flight beyond the client's last
+        // cumulative ack, and the client acks whenever this many bytes have arrived since its previous ack.
+        DD_STATIC_CONST uint32 kBulkTransferWindowSizeInBytes = (128 * kMaxTransferDataChunkSize);
+        DD_STATIC_CONST uint32 kBulkTransferAckIntervalInBytes = (32 * kMaxTransferDataChunkSize);
+
         ///////////////////////
         // Transfer Types
         typedef uint32_t BlockId;
@@ -282,9 +314,10 @@ namespace DevDriver
         {
             Result result;
             uint32 sizeInBytes;
+            uint32 sizeInBytesHi; // Bulk transfers only: upper 32 bits of the block size
         };
 
-        DD_CHECK_SIZE(TransferDataHeaderPayload, 8);
+        DD_CHECK_SIZE(TransferDataHeaderPayload, 12);
 
         DD_ALIGNED_STRUCT(4) TransferDataChunkPayload
         {
@@ -300,6 +333,16 @@ namespace DevDriver
 
         DD_CHECK_SIZE(TransferDataSentinelPayload, 4);
 
+        // The 64-bit byte count is split into two halves so the payload keeps the 4 byte alignment the rest of the
+        // transfer payload union is laid out for.
+        DD_ALIGNED_STRUCT(4) TransferDataAckPayload
+        {
+            uint32 bytesReceivedLo;
+            uint32 bytesReceivedHi;
+        };
+
+        DD_CHECK_SIZE(TransferDataAckPayload, 8);
+
         DD_ALIGNED_STRUCT(4) TransferPayload
         {
             TransferMessage  command;
@@ -311,6 +354,7 @@ namespace DevDriver
                 TransferDataHeaderPayload   transferDataHeader;
                 TransferDataChunkPayload    transferDataChunk;
                 TransferDataSentinelPayload transferDataSentinel;
+                TransferDataAckPayload      transferDataAck;
             };
         };
 
@@ -33,6 +33,7 @@
 #include "messageChannel.h"
 #include "protocolClient.h"
 #include "socketMsgTransport.h"
+#include "shmMsgTransport.h"
 #include "protocols/loggingClient.h"
 #include "protocols/settingsClient.h"
 #include "protocols/driverControlClient.h"
@@ -59,29 +60,49 @@ namespace DevDriver
     Result DevDriverClient::Initialize()
     {
         Result result = Result::Error;
-        if ((m_createInfo.transportCreateInfo.type == TransportType::Remote) |
-            (m_createInfo.transportCreateInfo.type == TransportType::Local))
+        if ((m_createInfo.transportCreateInfo.type == TransportType::Local) &&
+            (ShmMsgTransport::TestConnection(TransportType::Local, 0) == Result::Success))
+        {
+            // Prefer shared memory rings when the message bus offers them since they avoid a system call per message.
+            using MsgChannelShm = MessageChannel<ShmMsgTransport>;
+            m_pMsgChannel = DD_NEW(MsgChannelShm, m_createInfo.transportCreateInfo.allocCb)(m_createInfo.transportCreateInfo);
+
+            if (m_pMsgChannel != nullptr)
+            {
+                result = m_pMsgChannel->Register(kRegistrationTimeoutInMs);
+                if (result != Result::Success)
+                {
+                    // The bus may have gone away since it was tested, so fall back to the socket transport.
+                    DD_DELETE(m_pMsgChannel, m_createInfo.transportCreateInfo.allocCb);
+                    m_pMsgChannel = nullptr;
+                }
+            }
+        }
+
+        if ((m_pMsgChannel == nullptr) &&
+            ((m_createInfo.transportCreateInfo.type == TransportType::Remote) |
+             (m_createInfo.transportCreateInfo.type == TransportType::Local)))
         {
             using MsgChannelSocket = MessageChannel<SocketMsgTransport>;
             m_pMsgChannel = DD_NEW(MsgChannelSocket, m_createInfo.transportCreateInfo.allocCb)(m_createInfo.transportCreateInfo);
+
+            if (m_pMsgChannel != nullptr)
+            {
+                result = m_pMsgChannel->Register(kRegistrationTimeoutInMs);
+                if (result != Result::Success)
+                {
+                    // We failed to initialize so we need to destroy the message channel.
+                    DD_DELETE(m_pMsgChannel, m_createInfo.transportCreateInfo.allocCb);
+                    m_pMsgChannel = nullptr;
+                }
+            }
         }
-        else
+        else if (m_pMsgChannel == nullptr)
         {
             // Invalid transport type
             DD_ALERT_REASON("Invalid transport type specified");
         }
 
-        if (m_pMsgChannel != nullptr)
-        {
-            result = m_pMsgChannel->Register(kRegistrationTimeoutInMs);
-            if (result != Result::Success)
-            {
-                // We failed to initialize so we need to destroy the message channel.
-                DD_DELETE(m_pMsgChannel, m_createInfo.transportCreateInfo.allocCb);
-                m_pMsgChannel = nullptr;
-            }
-        }
-
         return result;
     }
 
@@ -41,6 +41,7 @@
 
 // The local transport implementation is only available on Windows.
 #include "socketMsgTransport.h"
+#include "shmMsgTransport.h"
 
 namespace DevDriver
 {
@@ -61,8 +62,35 @@ namespace DevDriver
 
         if (m_createInfo.transportCreateInfo.type == TransportType::Local)
         {
-            using MsgChannelSocket = MessageChannel<SocketMsgTransport>;
-            m_pMsgChannel = DD_NEW(MsgChannelSocket, m_createInfo.transportCreateInfo.allocCb)(m_createInfo.transportCreateInfo);
+            // Prefer shared memory rings when the message bus offers them since they avoid a system call per message.
+            if (ShmMsgTransport::TestConnection(TransportType::Local, 0) == Result::Success)
+            {
+                using MsgChannelShm = MessageChannel<ShmMsgTransport>;
+                m_pMsgChannel = DD_NEW(MsgChannelShm, m_createInfo.transportCreateInfo.allocCb)(m_createInfo.transportCreateInfo);
+
+                if (m_pMsgChannel != nullptr)
+                {
+                    result = m_pMsgChannel->Register(kInfiniteTimeout);
+
+                    if (result != Result::Success)
+                    {
+                        // The bus may have gone away since it was tested, so fall back to the socket transport.
+                        DD_DELETE(m_pMsgChannel, m_createInfo.transportCreateInfo.allocCb);
+                        m_pMsgChannel = nullptr;
+                    }
+                }
+            }
+
+            if (m_pMsgChannel == nullptr)
+            {
+                using MsgChannelSocket = MessageChannel<SocketMsgTransport>;
+                m_pMsgChannel = DD_NEW(MsgChannelSocket, m_createInfo.transportCreateInfo.allocCb)(m_createInfo.transportCreateInfo);
+
+                if (m_pMsgChannel != nullptr)
+                {
+                    result = m_pMsgChannel->Register(kInfiniteTimeout);
+                }
+            }
         }
         else
         {
@@ -72,8 +100,6 @@ namespace DevDriver
 
         if (m_pMsgChannel != nullptr)
         {
-            result = m_pMsgChannel->Register(kInfiniteTimeout);
-
             if (result == Result::Success)
             {
                 result = InitializeProtocols();
@@ -298,8 +324,12 @@ namespace DevDriver
         switch (type)
         {
             case TransportType::Local:
-                // on non windows platforms we try to use an AF_UNIX socket for communication
-                result = SocketMsgTransport::TestConnection(type, timeout);
+                // on non windows platforms we try shared memory first and then an AF_UNIX socket for communication
+                result = ShmMsgTransport::TestConnection(type, timeout);
+                if (result != Result::Success)
+                {
+                    result = SocketMsgTransport::TestConnection(type, timeout);
+                }
                 break;
             default:
                 // invalid value passed to the function
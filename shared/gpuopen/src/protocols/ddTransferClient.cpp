@@ -25,8 +25,8 @@
 #include "protocols/ddTransferClient.h"
 #include <cstring>
 
-#define TRANSFER_CLIENT_MIN_MAJOR_VERSION 1
-#define TRANSFER_CLIENT_MAX_MAJOR_VERSION 1
+#define TRANSFER_CLIENT_MIN_MAJOR_VERSION TRANSFER_PROTOCOL_MINIMUM_MAJOR_VERSION
+#define TRANSFER_CLIENT_MAX_MAJOR_VERSION TRANSFER_PROTOCOL_MAJOR_VERSION
 
 namespace DevDriver
 {
@@ -69,15 +69,24 @@ namespace DevDriver
                         result = payload.transferDataHeader.result;
                         if (result == Result::Success)
                         {
+                            // Only bulk transfer servers fill in the upper half of the block size.
+                            uint64 totalBytes = payload.transferDataHeader.sizeInBytes;
+                            if (GetSessionVersion() >= TRANSFER_BULK_VERSION)
+                            {
+                                totalBytes |= (static_cast<uint64>(payload.transferDataHeader.sizeInBytesHi) << 32);
+                            }
+
                             m_transferContext.state = TransferState::TransferInProgress;
-                            m_transferContext.totalBytes = payload.transferDataHeader.sizeInBytes;
-                            m_transferContext.numChunks = ((m_transferContext.totalBytes % kMaxTransferDataChunkSize) == 0) ? (m_transferContext.totalBytes / kMaxTransferDataChunkSize)
-                                                                                                                            : ((m_transferContext.totalBytes / kMaxTransferDataChunkSize) + 1);
+                            m_transferContext.totalBytes = totalBytes;
+                            m_transferContext.numChunks = static_cast<uint32>(((totalBytes % kMaxTransferDataChunkSize) == 0) ? (totalBytes / kMaxTransferDataChunkSize)
+                                                                                                                               : ((totalBytes / kMaxTransferDataChunkSize) + 1));
                             m_transferContext.numChunksReceived = 0;
                             m_transferContext.dataChunkSizeInBytes = 0;
                             m_transferContext.dataChunkBytesRead = 0;
+                            m_transferContext.bytesReceived = 0;
+                            m_transferContext.bytesAcked = 0;
 
-                            *pTransferSizeInBytes = payload.transferDataHeader.sizeInBytes;
+                            *pTransferSizeInBytes = static_cast<size_t>(totalBytes);
                         }
                         else
                         {
@@ -112,7 +121,11 @@ namespace DevDriver
             {
                 result = Result::Success;
 
-                if (m_transferContext.numChunks == 0)
+                if (GetSessionVersion() >= TRANSFER_BULK_VERSION)
+                {
+                    result = ReadBulkTransferData(pDstBuffer, bufferSize, pBytesRead);
+                }
+                else if (m_transferContext.numChunks == 0)
                 {
                     // There's no data to transfer, immediately return end of stream.
                     result = Result::EndOfStream;
@@ -161,7 +174,7 @@ namespace DevDriver
                                     if (m_transferContext.numChunksReceived == m_transferContext.numChunks)
                                     {
                                         m_transferContext.dataChunkSizeInBytes = (m_transferContext.totalBytes % kMaxTransferDataChunkSize == 0) ? kMaxTransferDataChunkSize
-                                                                                                                                                 : (m_transferContext.totalBytes % kMaxTransferDataChunkSize);
+                                                                                                                                                 : static_cast<size_t>(m_transferContext.totalBytes % kMaxTransferDataChunkSize);
 
                                         // Make sure we read the sentinel value before returning. It should always mark the end of the transfer data chunk stream.
                                         TransferPayload sentinelPayload = {};
@@ -227,9 +240,11 @@ namespace DevDriver
                 if (result == Result::Success)
                 {
                     // Discard all messages until we find the transfer data sentinel.
+                    // Bulk transfer data chunks are smaller than a full payload so the size isn't checked here.
                     while ((result == Result::Success) && (payload.command != TransferMessage::TransferDataSentinel))
                     {
-                        result = ReceivePayload(payload);
+                        uint32 bytesReceived = 0;
+                        result = ReceiveSizedPayload(&payload, sizeof(payload), &bytesReceived);
                     }
 
                     if ((result == Result::Success) &&
@@ -262,6 +277,165 @@ namespace DevDriver
             return result;
         }
 
+        // =====================================================================================================================
+        Result TransferClient::ReadBulkTransferData(uint8* pDstBuffer, size_t bufferSize, size_t* pBytesRead)
+        {
+            Result result = Result::Success;
+            size_t bytesRead = 0;
+
+            if (m_transferContext.totalBytes == 0)
+            {
+                // There's no data to transfer. Consume the sentinel and return end of stream.
+                result = ReceiveBulkSentinel();
+                if (result == Result::Success)
+                {
+                    result = Result::EndOfStream;
+                    m_transferContext.state = TransferState::Idle;
+                }
+            }
+
+            while ((bytesRead < bufferSize) && (m_transferContext.state == TransferState::TransferInProgress))
+            {
+                const size_t bytesStaged = (m_transferContext.dataChunkSizeInBytes - m_transferContext.dataChunkBytesRead);
+                if (bytesStaged > 0)
+                {
+                    // Hand out the remainder of a chunk that didn't fit into a previous caller's buffer.
+                    const size_t bytesToRead = Platform::Min((bufferSize - bytesRead), bytesStaged);
+                    const uint8* pData = (m_transferContext.lastPayload.transferDataChunk.data + m_transferContext.dataChunkBytesRead);
+                    memcpy(pDstBuffer + bytesRead, pData, bytesToRead);
+                    m_transferContext.dataChunkBytesRead += bytesToRead;
+                    bytesRead += bytesToRead;
+                }
+                else
+                {
+                    DD_ASSERT(m_transferContext.bytesReceived < m_transferContext.totalBytes);
+
+                    const uint32 chunkSize =
+                        static_cast<uint32>(Platform::Min(static_cast<uint64>(kMaxTransferDataChunkSize),
+                                                          (m_transferContext.totalBytes - m_transferContext.bytesReceived)));
+
+                    // Receive the chunk straight into the caller's buffer if all of it fits. Otherwise stage it.
+                    const bool receiveDirect = ((bufferSize - bytesRead) >= chunkSize);
+                    uint8* pChunkData = receiveDirect ? (pDstBuffer + bytesRead)
+                                                      : m_transferContext.lastPayload.transferDataChunk.data;
+
+                    uint32 command = 0;
+                    uint32 bytesReceived = 0;
+                    result = ReceiveBulkChunk(&command, pChunkData, chunkSize, &bytesReceived);
+
+                    if ((result == Result::Success) &&
+                        (command == static_cast<uint32>(TransferMessage::TransferDataChunk)) &&
+                        (bytesReceived == (kTransferHeaderSize + chunkSize)))
+                    {
+                        m_transferContext.bytesReceived += chunkSize;
+
+                        if (receiveDirect)
+                        {
+                            bytesRead += chunkSize;
+                        }
+                        else
+                        {
+                            m_transferContext.dataChunkSizeInBytes = chunkSize;
+                            m_transferContext.dataChunkBytesRead = 0;
+                        }
+
+                        if (m_transferContext.bytesReceived == m_transferContext.totalBytes)
+                        {
+                            // Make sure we read the sentinel value before returning. It should always mark the end of
+                            // the transfer data chunk stream.
+                            result = ReceiveBulkSentinel();
+                        }
+                        else if ((m_transferContext.bytesReceived - m_transferContext.bytesAcked) >= kBulkTransferAckIntervalInBytes)
+                        {
+                            // Acknowledge everything we've received so far so the server can keep its window full.
+                            TransferPayload payload = {};
+                            payload.command = TransferMessage::TransferDataAck;
+                            payload.transferDataAck.bytesReceivedLo = static_cast<uint32>(m_transferContext.bytesReceived);
+                            payload.transferDataAck.bytesReceivedHi = static_cast<uint32>(m_transferContext.bytesReceived >> 32);
+
+                            result = SendSizedPayload(&payload, static_cast<uint32>(kTransferHeaderSize + sizeof(payload.transferDataAck)));
+                            if (result == Result::Success)
+                            {
+                                m_transferContext.bytesAcked = m_transferContext.bytesReceived;
+                            }
+                        }
+
+                        if (result != Result::Success)
+                        {
+                            m_transferContext.state = TransferState::Error;
+                        }
+                    }
+                    else
+                    {
+                        // Failed to receive a transfer data chunk. Fail the transfer.
+                        m_transferContext.state = TransferState::Error;
+                        result = Result::Error;
+                    }
+                }
+
+                // If this is the last of the data for the transfer, return end of stream and return to the idle state.
+                if ((m_transferContext.state == TransferState::TransferInProgress) &&
+                    (m_transferContext.bytesReceived == m_transferContext.totalBytes) &&
+                    (m_transferContext.dataChunkBytesRead == m_transferContext.dataChunkSizeInBytes))
+                {
+                    result = Result::EndOfStream;
+                    m_transferContext.state = TransferState::Idle;
+                }
+            }
+
+            *pBytesRead = bytesRead;
+
+            return result;
+        }
+
+        // =====================================================================================================================
+        Result TransferClient::ReceiveBulkChunk(uint32* pCommand, uint8* pData, uint32 dataSize, uint32* pBytesReceived)
+        {
+            Result result = Result::Error;
+            uint32 timeElapsed = 0;
+
+            SharedPointer<ISession> pSession = m_pSession;
+            if (!pSession.IsNull())
+            {
+                do
+                {
+                    result = pSession->ReceiveScatter(kTransferHeaderSize,
+                                                      pCommand,
+                                                      dataSize,
+                                                      pData,
+                                                      pBytesReceived,
+                                                      kDefaultRetryTimeoutInMs);
+                    timeElapsed += kDefaultRetryTimeoutInMs;
+                } while ((result == Result::NotReady) & (timeElapsed <= kTransferChunkTimeoutInMs));
+            }
+
+            return result;
+        }
+
+        // =====================================================================================================================
+        Result TransferClient::ReceiveBulkSentinel()
+        {
+            TransferPayload payload = {};
+            uint32 bytesReceived = 0;
+            Result result = ReceiveSizedPayload(&payload, sizeof(payload), &bytesReceived, kTransferChunkTimeoutInMs);
+
+            if ((result == Result::Success) && (payload.command == TransferMessage::TransferDataSentinel))
+            {
+                result = payload.transferDataSentinel.result;
+            }
+            else
+            {
+                result = Result::Error;
+            }
+
+            if (result != Result::Success)
+            {
+                m_transferContext.state = TransferState::Error;
+            }
+
+            return result;
+        }
+
         // =====================================================================================================================
         void TransferClient::ResetState()
         {
@@ -26,8 +26,8 @@
 #include "ddTransferManager.h"
 #include "msgChannel.h"
 
-#define TRANSFER_SERVER_MIN_MAJOR_VERSION 1
-#define TRANSFER_SERVER_MAX_MAJOR_VERSION 1
+#define TRANSFER_SERVER_MIN_MAJOR_VERSION TRANSFER_PROTOCOL_MINIMUM_MAJOR_VERSION
+#define TRANSFER_SERVER_MAX_MAJOR_VERSION TRANSFER_PROTOCOL_MAJOR_VERSION
 
 namespace DevDriver
 {
@@ -48,6 +48,7 @@ namespace DevDriver
             Version version;
             size_t totalBytes;
             size_t bytesSent;
+            size_t bytesAcked;
             SharedPointer<LocalBlock> pBlock;
             TransferPayload payload;
 
@@ -56,6 +57,7 @@ namespace DevDriver
                 , version(0)
                 , totalBytes(0)
                 , bytesSent(0)
+                , bytesAcked(0)
             {
             }
         };
@@ -113,7 +115,10 @@ namespace DevDriver
 
                     if (result == Result::Success)
                     {
-                        DD_ASSERT(sizeof(pSessionData->payload) == bytesReceived);
+                        // Bulk transfer clients only send the part of the payload that's actually used.
+                        DD_ASSERT((sizeof(pSessionData->payload) == bytesReceived) ||
+                                  ((pSession->GetVersion() >= TRANSFER_BULK_VERSION) && (bytesReceived >= kTransferHeaderSize)));
+                        DD_UNUSED(bytesReceived);
                         pSessionData->state = SessionState::ProcessPayload;
                     }
 
@@ -141,30 +146,38 @@ namespace DevDriver
                                 pBlock = blockIter->value;
                             }
 
-                            // A block must be closed in order to be available for transfer.
-                            const bool blockIsAvailable = (!pBlock.IsNull() && pBlock->IsClosed());
+                            // A block must be closed in order to be available for transfer. Only bulk transfer
+                            // clients understand the upper half of the block size so larger blocks can't be sent to
+                            // older clients.
+                            const bool isBulkSession = (pSession->GetVersion() >= TRANSFER_BULK_VERSION);
+                            const bool blockIsAvailable =
+                                (!pBlock.IsNull() && pBlock->IsClosed() &&
+                                 (isBulkSession || ((static_cast<uint64>(pBlock->GetBlockDataSize()) >> 32) == 0)));
                             if (blockIsAvailable)
                             {
-                                // @todo: > 4GB block size support?
-                                const uint32 blockSizeInBytes = static_cast<uint32>(pBlock->GetBlockDataSize());
+                                const uint64 blockSizeInBytes = pBlock->GetBlockDataSize();
 
                                 pSessionData->payload.command = TransferMessage::TransferDataHeader;
                                 pSessionData->payload.transferDataHeader.result = Result::Success;
-                                pSessionData->payload.transferDataHeader.sizeInBytes = blockSizeInBytes;
+                                pSessionData->payload.transferDataHeader.sizeInBytes = static_cast<uint32>(blockSizeInBytes);
+                                pSessionData->payload.transferDataHeader.sizeInBytesHi =
+                                    isBulkSession ? static_cast<uint32>(blockSizeInBytes >> 32) : 0;
                                 pSessionData->state = SessionState::StartTransfer;
 
                                 // Notify the block that it's starting a new transfer.
                                 pBlock->BeginTransfer();
 
                                 pSessionData->pBlock = pBlock;
-                                pSessionData->totalBytes = blockSizeInBytes;
+                                pSessionData->totalBytes = static_cast<size_t>(blockSizeInBytes);
                                 pSessionData->bytesSent = 0;
+                                pSessionData->bytesAcked = 0;
                             }
                             else
                             {
                                 pSessionData->payload.command = TransferMessage::TransferDataHeader;
                                 pSessionData->payload.transferDataHeader.result = Result::Error;
                                 pSessionData->payload.transferDataHeader.sizeInBytes = 0;
+                                pSessionData->payload.transferDataHeader.sizeInBytesHi = 0;
                                 pSessionData->state = SessionState::SendPayload;
                             }
 
@@ -184,6 +197,15 @@ namespace DevDriver
                             break;
                         }
 
+                        case TransferMessage::TransferDataAck:
+                        {
+                            // A bulk transfer client may still have an ack in flight when the transfer completes.
+                            // There's nothing left to pace so it can be dropped.
+                            pSessionData->state = SessionState::ReceivePayload;
+
+                            break;
+                        }
+
                         default:
                         {
                             // Invalid command
@@ -197,6 +219,12 @@ namespace DevDriver
 
                 case SessionState::TransferData:
                 {
+                    if (pSession->GetVersion() >= TRANSFER_BULK_VERSION)
+                    {
+                        UpdateBulkTransfer(pSession, pSessionData);
+                        break;
+                    }
+
                     // Look for an abort request.
                     uint32 bytesReceived = 0;
                     const Result result = pSession->Receive(sizeof(pSessionData->payload), &pSessionData->payload, &bytesReceived, kNoWait);
@@ -300,6 +328,93 @@ namespace DevDriver
             }
         }
 
+        // =====================================================================================================================
+        void TransferServer::UpdateBulkTransfer(const SharedPointer<ISession>& pSession, TransferSession* pSessionData)
+        {
+            // Drain everything the client has sent us. Cumulative acks open up the send window and an abort request
+            // ends the transfer.
+            Result result = Result::Success;
+            while ((result == Result::Success) && (pSessionData->state == SessionState::TransferData))
+            {
+                uint32 bytesReceived = 0;
+                result = pSession->Receive(sizeof(pSessionData->payload), &pSessionData->payload, &bytesReceived, kNoWait);
+
+                if (result == Result::Success)
+                {
+                    DD_ASSERT(bytesReceived >= kTransferHeaderSize);
+
+                    if (pSessionData->payload.command == TransferMessage::TransferDataAck)
+                    {
+                        const TransferDataAckPayload& ack = pSessionData->payload.transferDataAck;
+                        const size_t bytesAcked =
+                            static_cast<size_t>((static_cast<uint64>(ack.bytesReceivedHi) << 32) | ack.bytesReceivedLo);
+                        DD_ASSERT(bytesAcked <= pSessionData->bytesSent);
+
+                        pSessionData->bytesAcked = Platform::Max(pSessionData->bytesAcked, bytesAcked);
+                    }
+                    else
+                    {
+                        if (pSessionData->payload.command == TransferMessage::TransferAbort)
+                        {
+                            pSessionData->payload.transferDataSentinel.result = Result::Aborted;
+                        }
+                        else
+                        {
+                            // We should only ever receive acks and abort requests in this state. Send back an error.
+                            pSessionData->payload.transferDataSentinel.result = Result::Error;
+
+                            DD_ALERT_REASON("Invalid response received");
+                        }
+
+                        pSessionData->pBlock->EndTransfer();
+                        pSessionData->pBlock.Clear();
+
+                        pSessionData->payload.command = TransferMessage::TransferDataSentinel;
+                        pSessionData->state = SessionState::SendPayload;
+                    }
+                }
+            }
+
+            // Keep the window full. Each chunk is gathered straight from the block's backing store into the session's
+            // send window so there's no intermediate copy into a transfer payload.
+            if ((result == Result::NotReady) && (pSessionData->state == SessionState::TransferData))
+            {
+                const uint32 chunkHeader = static_cast<uint32>(TransferMessage::TransferDataChunk);
+
+                while ((pSessionData->bytesSent < pSessionData->totalBytes) &&
+                       ((pSessionData->bytesSent - pSessionData->bytesAcked) < kBulkTransferWindowSizeInBytes))
+                {
+                    const uint8* pData = (pSessionData->pBlock->GetBlockData() + pSessionData->bytesSent);
+                    const size_t bytesRemaining = (pSessionData->totalBytes - pSessionData->bytesSent);
+                    const uint32 bytesToSend =
+                        static_cast<uint32>(Platform::Min(static_cast<size_t>(kMaxTransferDataChunkSize), bytesRemaining));
+
+                    const Result sendResult =
+                        pSession->SendGather(kTransferHeaderSize, &chunkHeader, bytesToSend, pData, kNoWait);
+                    if (sendResult == Result::Success)
+                    {
+                        pSessionData->bytesSent += bytesToSend;
+                    }
+                    else
+                    {
+                        break;
+                    }
+                }
+
+                // If we've finished transferring all block data, send the sentinel and free the block.
+                if (pSessionData->bytesSent == pSessionData->totalBytes)
+                {
+                    // Notify the block that a transfer is completing.
+                    pSessionData->pBlock->EndTransfer();
+
+                    pSessionData->payload.command = TransferMessage::TransferDataSentinel;
+                    pSessionData->payload.transferDataSentinel.result = Result::Success;
+                    pSessionData->pBlock.Clear();
+                    pSessionData->state = SessionState::SendPayload;
+                }
+            }
+        }
+
         // =====================================================================================================================
         void TransferServer::SessionTerminated(const SharedPointer<ISession>& pSession, Result terminationReason)
         {
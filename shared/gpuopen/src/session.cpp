@@ -306,13 +306,18 @@ namespace DevDriver
     Result Session::WriteMessageIntoSendWindow(
         SessionMessage message,
         uint32 payloadSizeInBytes,
-        const void* pPayload, uint32 timeoutInMs)
+        const void* pPayload,
+        uint32 dataSizeInBytes,
+        const void* pData,
+        uint32 timeoutInMs)
     {
         Result result = Result::Error;
 
         if (m_sessionState < SessionState::FinWait2)
         {
-            if (payloadSizeInBytes <= kMaxPayloadSizeInBytes)
+            // The optional data region is appended to the payload so callers can send a small header followed by
+            // data that lives elsewhere without first staging both in a temporary buffer.
+            if ((payloadSizeInBytes + dataSizeInBytes) <= kMaxPayloadSizeInBytes)
             {
                 result = m_sendWindow.semaphore.Wait(timeoutInMs);
 
@@ -334,6 +339,7 @@ namespace DevDriver
 
                     DD_ASSERT(m_sendWindow.valid[index] == false);
                     DD_ASSERT((payloadSizeInBytes > 0 && pPayload != nullptr) || (pPayload == nullptr && payloadSizeInBytes == 0));
+                    DD_ASSERT((dataSizeInBytes > 0 && pData != nullptr) || (pData == nullptr && dataSizeInBytes == 0));
 
                     MessageBuffer& messageBuffer = m_sendWindow.messages[index];
                     // Set up the message header.
@@ -348,7 +354,11 @@ namespace DevDriver
                     if ((pPayload != nullptr) & (payloadSizeInBytes > 0))
                     {
                         memcpy(&messageBuffer.payload[0], pPayload, payloadSizeInBytes);
-                        messageBuffer.header.payloadSize = payloadSizeInBytes;
+                        if (dataSizeInBytes > 0)
+                        {
+                            memcpy(&messageBuffer.payload[payloadSizeInBytes], pData, dataSizeInBytes);
+                        }
+                        messageBuffer.header.payloadSize = payloadSizeInBytes + dataSizeInBytes;
                     }
                     else
                     {
@@ -377,7 +387,7 @@ namespace DevDriver
         payload.minVersion     = m_pProtocolOwner->GetMinVersion();
         payload.maxVersion     = m_pProtocolOwner->GetMaxVersion();
         payload.sessionVersion = m_sessionVersion;
-        const Result result = WriteMessageIntoSendWindow(SessionMessage::Syn, sizeof(SynPayload), &payload, kInfiniteTimeout);
+        const Result result = WriteMessageIntoSendWindow(SessionMessage::Syn, sizeof(SynPayload), &payload, 0, nullptr, kInfiniteTimeout);
 
         if (result == Result::Success)
         {
@@ -403,6 +413,8 @@ namespace DevDriver
         const Result result = WriteMessageIntoSendWindow(SessionMessage::SynAck,
                                                          sizeof(SynAckPayload),
                                                          &payload,
+                                                         0,
+                                                         nullptr,
                                                          kInfiniteTimeout);
         if (result == Result::Success)
         {
@@ -763,7 +775,7 @@ namespace DevDriver
     {
         if (m_sessionState == SessionState::FinWait1)
         {
-            if (WriteMessageIntoSendWindow(SessionMessage::Fin, 0, nullptr, kInfiniteTimeout) == Result::Success)
+            if (WriteMessageIntoSendWindow(SessionMessage::Fin, 0, nullptr, 0, nullptr, kInfiniteTimeout) == Result::Success)
             {
                 m_sessionState = SessionState::FinWait2;
             }
@@ -793,10 +805,34 @@ namespace DevDriver
 
     Result Session::Send(uint32 payloadSizeInBytes, const void* pPayload, uint32 timeoutInMs)
     {
-        return WriteMessageIntoSendWindow(SessionMessage::Data, payloadSizeInBytes, pPayload, timeoutInMs);
+        return WriteMessageIntoSendWindow(SessionMessage::Data, payloadSizeInBytes, pPayload, 0, nullptr, timeoutInMs);
+    }
+
+    Result Session::SendGather(uint32      headerSizeInBytes,
+                               const void* pHeader,
+                               uint32      dataSizeInBytes,
+                               const void* pData,
+                               uint32      timeoutInMs)
+    {
+        return WriteMessageIntoSendWindow(SessionMessage::Data,
+                                          headerSizeInBytes,
+                                          pHeader,
+                                          dataSizeInBytes,
+                                          pData,
+                                          timeoutInMs);
     }
 
     Result Session::Receive(uint32 payloadSizeInBytes, void* pPayload, uint32* pBytesReceived, uint32 timeoutInMs)
+    {
+        return ReceiveScatter(payloadSizeInBytes, pPayload, 0, nullptr, pBytesReceived, timeoutInMs);
+    }
+
+    Result Session::ReceiveScatter(uint32  headerSizeInBytes,
+                                   void*   pHeader,
+                                   uint32  dataSizeInBytes,
+                                   void*   pData,
+                                   uint32* pBytesReceived,
+                                   uint32  timeoutInMs)
     {
         Result result = Result::Error;
 
@@ -813,15 +849,22 @@ namespace DevDriver
                 const Sequence index = m_receiveWindow.nextUnreadSequence % m_receiveWindow.GetWindowSize();
                 MessageBuffer& message = m_receiveWindow.messages[index];
 
-                if (payloadSizeInBytes >= message.header.payloadSize)
+                if ((headerSizeInBytes + dataSizeInBytes) >= message.header.payloadSize)
                 {
                     if (static_cast<SessionMessage>(message.header.messageId) == SessionMessage::Data)
                     {
-                        uint32 payloadSize = Platform::Min(message.header.payloadSize, payloadSizeInBytes);
+                        // The first headerSizeInBytes bytes of the payload land in pHeader and anything beyond that
+                        // lands in pData, which lets callers receive bulk data straight into its final location.
+                        const uint32 payloadSize = message.header.payloadSize;
+                        const uint32 headerSize  = Platform::Min(payloadSize, headerSizeInBytes);
 
                         DD_PRINT(LogLevel::Never, "Reading message number %u", m_receiveWindow.nextUnreadSequence);
                         DD_ASSERT(m_receiveWindow.valid[index] && m_receiveWindow.sequence[index] == m_receiveWindow.nextUnreadSequence);
-                        memcpy(pPayload, &message.payload[0], payloadSize);
+                        memcpy(pHeader, &message.payload[0], headerSize);
+                        if (payloadSize > headerSize)
+                        {
+                            memcpy(pData, &message.payload[headerSize], (payloadSize - headerSize));
+                        }
                         *pBytesReceived = payloadSize;
                     }
                     else
@@ -140,6 +140,17 @@ namespace DevDriver
 
         Result Send(uint32 payloadSizeInBytes, const void* pPayload, uint32 timeoutInMs) override;
         Result Receive(uint32 payloadSizeInBytes, void* pPayload, uint32* pBytesReceived, uint32 timeoutInMs) override;
+        Result SendGather(uint32      headerSizeInBytes,
+                          const void* pHeader,
+                          uint32      dataSizeInBytes,
+                          const void* pData,
+                          uint32      timeoutInMs) override;
+        Result ReceiveScatter(uint32  headerSizeInBytes,
+                              void*   pHeader,
+                              uint32  dataSizeInBytes,
+                              void*   pData,
+                              uint32* pBytesReceived,
+                              uint32  timeoutInMs) override;
         void   CloseSession(Result reason = Result::Error) override;
         void   OrphanSession() override;
 
@@ -171,7 +182,12 @@ namespace DevDriver
     private:
         Result MarkMessagesAsAcknowledged(Sequence maxSequenceNumber);
         Result WriteMessageIntoReceiveWindow(const MessageBuffer& messageBuffer);
-        Result WriteMessageIntoSendWindow(SessionProtocol::SessionMessage message, uint32 payloadSizeInBytes, const void* pPayload, uint32 timeoutInMs);
+        Result WriteMessageIntoSendWindow(SessionProtocol::SessionMessage message,
+                                          uint32                          payloadSizeInBytes,
+                                          const void*                     pPayload,
+                                          uint32                          dataSizeInBytes,
+                                          const void*                     pData,
+                                          uint32                          timeoutInMs);
 
         bool SendOrClose(const MessageBuffer& messageBuffer);
         bool SendControlMessage(SessionProtocol::SessionMessage command, Sequence sequenceNumber);
@@ -0,0 +1,496 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2016-2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+#include "shmMsgTransport.h"
+#include "ddPlatform.h"
+
+#include <cerrno>
+#include <cstring>
+#include <climits>
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+using namespace DevDriver::ShmTransport;
+
+namespace DevDriver
+{
+    static_assert((kShmRingSlotCount & (kShmRingSlotCount - 1)) == 0, "The ring slot count must be a power of two");
+
+    // Longest single sleep on a ring, so that a blocked reader or writer notices a bus which went away.
+    DD_STATIC_CONST uint32 kWaitSliceInMs = 100;
+
+    // ================================================================================================================
+    // Sleeps until *pAddress no longer holds expectedValue, a wake is posted on it or the timeout expires. The futex is
+    // deliberately not process-private since the other side of the transport lives in a different process.
+    static void FutexWait(volatile uint32* pAddress, uint32 expectedValue, uint32 timeoutInMs)
+    {
+        timespec timeout = {};
+        timeout.tv_sec  = static_cast<time_t>(timeoutInMs / 1000);
+        timeout.tv_nsec = static_cast<long>(timeoutInMs % 1000) * 1000000;
+
+        syscall(SYS_futex,
+                const_cast<uint32*>(pAddress),
+                FUTEX_WAIT,
+                expectedValue,
+                (timeoutInMs == kInfiniteTimeout) ? nullptr : &timeout,
+                nullptr,
+                0);
+    }
+
+    // ================================================================================================================
+    static void FutexWake(volatile uint32* pAddress)
+    {
+        syscall(SYS_futex, const_cast<uint32*>(pAddress), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+    }
+
+    // ================================================================================================================
+    // Returns the number of milliseconds left before deadline, or kInfiniteTimeout if there is no deadline.
+    static uint32 RemainingTime(uint64 deadline)
+    {
+        uint32 remaining = kInfiniteTimeout;
+
+        if (deadline != 0)
+        {
+            const uint64 now = Platform::GetCurrentTimeInMs();
+            remaining = (now < deadline) ? static_cast<uint32>(deadline - now) : 0;
+        }
+
+        return remaining;
+    }
+
+    // ================================================================================================================
+    // Returns false only if the process is known not to exist. Any other failure (e.g. no permission to signal it)
+    // means that the process is still there.
+    static bool IsProcessAlive(uint32 processId)
+    {
+        return (processId != 0) && ((kill(static_cast<pid_t>(processId), 0) == 0) || (errno != ESRCH));
+    }
+
+    // ================================================================================================================
+    // Returns Success if the service object was published by a compatible bus which is still running. The service object
+    // outlives a bus which crashed, so the magic and version alone don't mean that anyone will answer.
+    static Result CheckService(const ServiceHeader& service)
+    {
+        Result result = Result::VersionMismatch;
+
+        if ((service.magic == kShmMagic) && (service.version == kShmVersion))
+        {
+            result = IsProcessAlive(service.busProcessId) ? Result::Success : Result::Unavailable;
+        }
+
+        return result;
+    }
+
+    ShmMsgTransport::ShmMsgTransport(const TransportCreateInfo& createInfo) :
+        m_pSegment(nullptr),
+        m_connected(false)
+    {
+        DD_UNUSED(createInfo);
+        m_segmentName[0] = '\0';
+    }
+
+    ShmMsgTransport::~ShmMsgTransport()
+    {
+        Disconnect();
+    }
+
+    // ================================================================================================================
+    // Creates and initializes this client's connection segment.
+    Result ShmMsgTransport::CreateSegment()
+    {
+        static volatile uint32 s_segmentCounter = 0;
+
+        Result result = Result::Error;
+
+        Platform::Snprintf(m_segmentName,
+                           sizeof(m_segmentName),
+                           kShmSegmentNameFormat,
+                           Platform::GetProcessId(),
+                           __sync_fetch_and_add(&s_segmentCounter, 1));
+
+        const int fd = shm_open(m_segmentName, (O_CREAT | O_EXCL | O_RDWR), (S_IRUSR | S_IWUSR));
+
+        if (fd != -1)
+        {
+            if (ftruncate(fd, sizeof(Segment)) == 0)
+            {
+                void* pMemory = mmap(nullptr, sizeof(Segment), (PROT_READ | PROT_WRITE), MAP_SHARED, fd, 0);
+
+                if (pMemory != MAP_FAILED)
+                {
+                    // A freshly truncated object is zero filled, so only the identification needs to be written.
+                    m_pSegment          = static_cast<Segment*>(pMemory);
+                    m_pSegment->magic   = kShmMagic;
+                    m_pSegment->version = kShmVersion;
+                    result              = Result::Success;
+                }
+            }
+
+            close(fd);
+
+            if (result != Result::Success)
+            {
+                shm_unlink(m_segmentName);
+            }
+        }
+
+        return result;
+    }
+
+    // ================================================================================================================
+    // Hands this client's segment to the message bus and waits for it to be accepted.
+    Result ShmMsgTransport::RequestConnection(uint32 timeoutInMs)
+    {
+        Result result = Result::Unavailable;
+
+        const uint64 deadline = (timeoutInMs == kInfiniteTimeout) ? 0 : (Platform::GetCurrentTimeInMs() + timeoutInMs);
+        const uint32 processId = Platform::GetProcessId();
+
+        const int fd = shm_open(kShmServiceName, O_RDWR, 0);
+        ServiceHeader* pService = nullptr;
+
+        if (fd != -1)
+        {
+            void* pMemory = mmap(nullptr, sizeof(ServiceHeader), (PROT_READ | PROT_WRITE), MAP_SHARED, fd, 0);
+            close(fd);
+
+            if (pMemory != MAP_FAILED)
+            {
+                pService = static_cast<ServiceHeader*>(pMemory);
+                result   = CheckService(*pService);
+            }
+        }
+
+        if (result == Result::Success)
+        {
+            // Take the request lock. A client which died while holding it would block everyone else forever, so the
+            // lock is stolen from owners which no longer exist.
+            while (true)
+            {
+                const uint32 owner = __sync_val_compare_and_swap(&pService->requestLock, 0, processId);
+
+                if (owner == 0)
+                {
+                    break;
+                }
+                else if ((IsProcessAlive(owner) == false) &&
+                         (__sync_val_compare_and_swap(&pService->requestLock, owner, processId) == owner))
+                {
+                    break;
+                }
+                else if (RemainingTime(deadline) == 0)
+                {
+                    result = Result::NotReady;
+                    break;
+                }
+
+                Platform::Sleep(1);
+            }
+        }
+
+        if (result == Result::Success)
+        {
+            Platform::Strncpy(pService->segmentName, m_segmentName, sizeof(pService->segmentName));
+
+            const uint32 requestSeq = pService->requestSeq + 1;
+            __sync_synchronize();
+            pService->requestSeq = requestSeq;
+            __sync_synchronize();
+            FutexWake(&pService->requestSeq);
+
+            uint32 responseSeq = pService->responseSeq;
+            uint32 remaining   = RemainingTime(deadline);
+
+            // Wait in slices so that a bus which dies before answering can't block us forever, even without a timeout.
+            while ((responseSeq != requestSeq) && (remaining != 0) && IsProcessAlive(pService->busProcessId))
+            {
+                FutexWait(&pService->responseSeq,
+                          responseSeq,
+                          (remaining < kWaitSliceInMs) ? remaining : kWaitSliceInMs);
+                responseSeq = pService->responseSeq;
+                remaining   = RemainingTime(deadline);
+            }
+
+            __sync_synchronize();
+            result = (responseSeq == requestSeq) ? pService->responseResult : Result::NotReady;
+
+            if (result == Result::Success)
+            {
+                // Remember who answered, so that a bus which dies without closing the segment is noticed.
+                m_pSegment->busProcessId = pService->busProcessId;
+            }
+
+            __sync_val_compare_and_swap(&pService->requestLock, processId, 0);
+        }
+
+        if (pService != nullptr)
+        {
+            munmap(pService, sizeof(ServiceHeader));
+        }
+
+        return result;
+    }
+
+    // ================================================================================================================
+    // Returns false once the bus has dropped this client or its process no longer exists. A bus which crashed can't
+    // set busClosed, so this is checked on every wait slice in the same way as the request lock owner.
+    bool ShmMsgTransport::IsBusAlive() const
+    {
+        const uint32 busProcessId = m_pSegment->busProcessId;
+
+        return (m_pSegment->busClosed == 0) && ((busProcessId == 0) || IsProcessAlive(busProcessId));
+    }
+
+    // ================================================================================================================
+    void ShmMsgTransport::DestroySegment()
+    {
+        if (m_pSegment != nullptr)
+        {
+            munmap(m_pSegment, sizeof(Segment));
+            m_pSegment = nullptr;
+        }
+    }
+
+    Result ShmMsgTransport::Connect(ClientId* pClientId, uint32 timeoutInMs)
+    {
+        DD_UNUSED(pClientId);
+
+        Result result = Result::Error;
+
+        if (!m_connected)
+        {
+            result = CreateSegment();
+
+            if (result == Result::Success)
+            {
+                result = RequestConnection(timeoutInMs);
+
+                // Either the bus has the segment mapped by now or it never will; the name isn't needed either way.
+                shm_unlink(m_segmentName);
+
+                if (result != Result::Success)
+                {
+                    DestroySegment();
+                }
+            }
+
+            m_connected = (result == Result::Success);
+        }
+        return result;
+    }
+
+    Result ShmMsgTransport::Disconnect()
+    {
+        Result result = Result::Error;
+        if (m_connected)
+        {
+            m_connected = false;
+
+            // Let the bus know and wake any of its threads which are blocked on this connection's rings.
+            m_pSegment->clientClosed = 1;
+            __sync_synchronize();
+            FutexWake(&m_pSegment->rings[kClientToBusRing].writeIndex);
+            FutexWake(&m_pSegment->rings[kBusToClientRing].readIndex);
+
+            DestroySegment();
+            result = Result::Success;
+        }
+        return result;
+    }
+
+#if !DD_VERSION_SUPPORTS(GPUOPEN_DISTRIBUTED_STATUS_FLAGS_VERSION)
+    Result ShmMsgTransport::UpdateClientStatus(ClientId clientId, StatusFlags flags)
+    {
+        // not implemented
+        DD_UNUSED(clientId);
+        DD_UNUSED(flags);
+        return Result::Unavailable;
+    }
+#endif
+
+    Result ShmMsgTransport::ReadMessage(MessageBuffer &messageBuffer, uint32 timeoutInMs)
+    {
+        Result result = m_connected ? Result::NotReady : Result::Error;
+
+        if (result == Result::NotReady)
+        {
+            RingControl& ring = m_pSegment->rings[kBusToClientRing];
+            const uint32 readIndex = ring.readIndex;
+            const uint64 deadline = ((timeoutInMs == 0) || (timeoutInMs == kInfiniteTimeout))
+                                        ? 0
+                                        : (Platform::GetCurrentTimeInMs() + timeoutInMs);
+
+            uint32 writeIndex = ring.writeIndex;
+
+            // Only sleep while the ring is empty. The waiting flag has to be visible before writeIndex is checked
+            // again, otherwise the bus could publish a message without seeing that it needs to wake us.
+            while ((writeIndex == readIndex) && (timeoutInMs != 0) && IsBusAlive())
+            {
+                const uint32 remaining = RemainingTime(deadline);
+
+                if (remaining == 0)
+                {
+                    break;
+                }
+
+                ring.readerWaiting = 1;
+                __sync_synchronize();
+
+                if (ring.writeIndex == readIndex)
+                {
+                    FutexWait(&ring.writeIndex, readIndex, (remaining < kWaitSliceInMs) ? remaining : kWaitSliceInMs);
+                }
+
+                ring.readerWaiting = 0;
+                writeIndex = ring.writeIndex;
+            }
+
+            if (writeIndex != readIndex)
+            {
+                // Make sure the slot contents are read after the index which published them.
+                __sync_synchronize();
+
+                const Slot& slot = m_pSegment->slots[kBusToClientRing][readIndex % kShmRingSlotCount];
+
+                if (slot.size <= sizeof(MessageBuffer))
+                {
+                    memcpy(&messageBuffer, &slot.message, slot.size);
+                    result = Result::Success;
+                }
+                else
+                {
+                    DD_ALERT_REASON("Corrupt message in shared memory ring");
+                    result = Result::Error;
+                }
+
+                __sync_synchronize();
+                ring.readIndex = readIndex + 1;
+                __sync_synchronize();
+
+                if (ring.writerWaiting != 0)
+                {
+                    FutexWake(&ring.readIndex);
+                }
+            }
+            else if (IsBusAlive() == false)
+            {
+                result = Result::Error;
+            }
+        }
+        return result;
+    }
+
+    Result ShmMsgTransport::WriteMessage(const MessageBuffer &messageBuffer)
+    {
+        DD_ASSERT(m_connected);
+
+        Result result = Result::Error;
+
+        if (m_connected)
+        {
+            RingControl& ring = m_pSegment->rings[kClientToBusRing];
+            const uint32 writeIndex = ring.writeIndex;
+            uint32 readIndex = ring.readIndex;
+
+            result = Result::Success;
+
+            // Like a blocking socket send, wait for the bus to make room if the ring is full.
+            while ((writeIndex - readIndex) == kShmRingSlotCount)
+            {
+                if (IsBusAlive() == false)
+                {
+                    result = Result::Error;
+                    break;
+                }
+
+                ring.writerWaiting = 1;
+                __sync_synchronize();
+
+                if (ring.readIndex == readIndex)
+                {
+                    FutexWait(&ring.readIndex, readIndex, kWaitSliceInMs);
+                }
+
+                ring.writerWaiting = 0;
+                readIndex = ring.readIndex;
+            }
+
+            if (result == Result::Success)
+            {
+                Slot& slot = m_pSegment->slots[kClientToBusRing][writeIndex % kShmRingSlotCount];
+                const uint32 totalMsgSize =
+                    static_cast<uint32>(sizeof(MessageHeader) + messageBuffer.header.payloadSize);
+
+                DD_ASSERT(totalMsgSize <= sizeof(MessageBuffer));
+
+                slot.size = totalMsgSize;
+                memcpy(&slot.message, &messageBuffer, totalMsgSize);
+
+                // Publish the slot, then wake the bus if it went to sleep on an empty ring.
+                __sync_synchronize();
+                ring.writeIndex = writeIndex + 1;
+                __sync_synchronize();
+
+                if (ring.readerWaiting != 0)
+                {
+                    FutexWake(&ring.writeIndex);
+                }
+            }
+        }
+        return result;
+    }
+
+    // ================================================================================================================
+    // Tests to see if the message bus on this machine accepts shared memory connections.
+    Result ShmMsgTransport::TestConnection(TransportType type, uint32 timeoutInMs)
+    {
+        DD_UNUSED(timeoutInMs);
+
+        Result result = Result::Unavailable;
+
+        if (type == TransportType::Local)
+        {
+            const int fd = shm_open(kShmServiceName, O_RDONLY, 0);
+
+            if (fd != -1)
+            {
+                void* pMemory = mmap(nullptr, sizeof(ServiceHeader), PROT_READ, MAP_SHARED, fd, 0);
+                close(fd);
+
+                if (pMemory != MAP_FAILED)
+                {
+                    result = CheckService(*static_cast<const ServiceHeader*>(pMemory));
+
+                    munmap(pMemory, sizeof(ServiceHeader));
+                }
+            }
+        }
+        return result;
+    }
+} // DevDriver
@@ -0,0 +1,152 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2016-2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/**
+***********************************************************************************************************************
+* @file  shmMsgTransport.h
+* @brief Class declaration for ShmMsgTransport and the shared memory layout it exchanges with the message bus
+***********************************************************************************************************************
+*/
+
+#pragma once
+
+#include "msgTransport.h"
+#include "util/memory.h"
+
+namespace DevDriver
+{
+    // The shared memory transport moves messages between a same-host client and the message bus through a pair of
+    // single-producer/single-consumer rings in a segment mapped by both processes. The only system calls on the
+    // message path are futex wakes, and those are only made when the other side is actually asleep.
+    //
+    // Connecting works as follows:
+    //   1. The client creates and initializes its own segment (kShmSegmentNameFormat).
+    //   2. It takes the request lock in the bus's service object (kShmServiceName), writes the segment name, bumps
+    //      requestSeq and wakes the bus.
+    //   3. The bus maps the segment, writes responseResult, sets responseSeq to the request's sequence and wakes the
+    //      client. The client then unlinks the segment name; the mapping lives until both sides unmap it.
+    // Client registration and keep-alives then run over the rings exactly as they would over a socket.
+    namespace ShmTransport
+    {
+        DD_STATIC_CONST char   kShmServiceName[]       = "/AMD-Developer-Service-Shm";
+        DD_STATIC_CONST char   kShmSegmentNameFormat[] = "/AMD-Developer-Service-Shm.%u.%u";
+        DD_STATIC_CONST uint32 kShmMagic               = 0x4D485344; // 'DSHM'
+        DD_STATIC_CONST uint32 kShmVersion             = 2;
+        DD_STATIC_CONST uint32 kShmRingSlotCount       = 256;        // Must be a power of two.
+
+        // Rings within a segment.
+        DD_STATIC_CONST uint32 kClientToBusRing = 0;
+        DD_STATIC_CONST uint32 kBusToClientRing = 1;
+        DD_STATIC_CONST uint32 kNumRings        = 2;
+
+        // The rendezvous object created by the message bus.
+        struct ServiceHeader
+        {
+            uint32          magic;
+            uint32          version;
+            uint32          busProcessId;   // Process ID of the message bus which created this object.
+            volatile uint32 requestLock;    // Process ID of the client making a request, or zero.
+            volatile uint32 requestSeq;     // Bumped by a client once segmentName is valid; the bus waits on this.
+            volatile uint32 responseSeq;    // Set to requestSeq by the bus once it has answered; clients wait on this.
+            Result          responseResult; // Result of the most recent request.
+            char            segmentName[kMaxStringLength];
+        };
+
+        // Each index only ever increases and is written by one side: writeIndex by the producer and readIndex by the
+        // consumer. Slot (index % kShmRingSlotCount) holds the message at that index. The two indices live on separate
+        // cache lines so that the producer and consumer don't contend for one line.
+        struct RingControl
+        {
+            volatile uint32 writeIndex;
+            uint8           padding0[DD_CACHE_LINE_BYTES - sizeof(uint32)];
+            volatile uint32 readIndex;
+            uint8           padding1[DD_CACHE_LINE_BYTES - sizeof(uint32)];
+            volatile uint32 readerWaiting; // Nonzero while the consumer sleeps on writeIndex.
+            volatile uint32 writerWaiting; // Nonzero while the producer sleeps on readIndex.
+            uint8           padding2[DD_CACHE_LINE_BYTES - (2 * sizeof(uint32))];
+        };
+
+        struct Slot
+        {
+            uint32        size;            // Number of valid bytes in message.
+            uint32        reserved;
+            MessageBuffer message;
+        };
+
+        // The connection segment created by the client.
+        struct Segment
+        {
+            uint32          magic;
+            uint32          version;
+            volatile uint32 clientClosed;  // Set by the client when it disconnects.
+            volatile uint32 busClosed;     // Set by the bus when it drops the client.
+            uint32          busProcessId;  // Process ID of the bus which accepted the connection, or zero if unknown.
+            uint8           padding[DD_CACHE_LINE_BYTES - (5 * sizeof(uint32))];
+            RingControl     rings[kNumRings];
+            Slot            slots[kNumRings][kShmRingSlotCount];
+        };
+    }
+
+    class ShmMsgTransport : public IMsgTransport
+    {
+    public:
+        explicit ShmMsgTransport(const TransportCreateInfo& createInfo);
+        ~ShmMsgTransport();
+
+        Result Connect(ClientId* pClientId, uint32 timeoutInMs) override;
+        Result Disconnect() override;
+
+        Result ReadMessage(MessageBuffer &messageBuffer, uint32 timeoutInMs) override;
+        Result WriteMessage(const MessageBuffer &messageBuffer) override;
+
+#if !DD_VERSION_SUPPORTS(GPUOPEN_DISTRIBUTED_STATUS_FLAGS_VERSION)
+        Result UpdateClientStatus(ClientId clientId, StatusFlags flags) override;
+#endif
+
+        // Returns Success if a message bus on this machine accepts shared memory connections.
+        static Result TestConnection(TransportType type, uint32 timeoutInMs);
+
+        // A client which crashes can't mark its segment closed, so the bus still relies on keep-alives.
+        DD_STATIC_CONST bool RequiresKeepAlive()
+        {
+            return true;
+        }
+
+        DD_STATIC_CONST bool RequiresClientRegistration()
+        {
+            return true;
+        }
+
+    private:
+        Result CreateSegment();
+        Result RequestConnection(uint32 timeoutInMs);
+        void   DestroySegment();
+        bool   IsBusAlive() const;
+
+        ShmTransport::Segment* m_pSegment;
+        bool                   m_connected;
+        char                   m_segmentName[kMaxStringLength];
+    };
+
+} // DevDriver
@@ -24,8 +24,11 @@
 
 #include "core/addrMgr/addrMgr.h"
 #include "core/device.h"
+#include "core/image.h"
 #include "core/platform.h"
+#include "palConcurrentHashMapImpl.h"
 #include "palFormatInfo.h"
+#include "palMetroHash.h"
 #include "palSysMemory.h"
 
 using namespace Util;
@@ -41,6 +44,9 @@ static ADDR_E_RETURNCODE ADDR_API FreeSysMemCb(const ADDR_FREESYSMEM_INPUT* pInp
 static_assert(SwizzleEquationMaxBits == ADDR_MAX_EQUATION_BIT, "AddrLib equations are too long or too short!");
 static_assert(sizeof(SwizzleEquationBit) == sizeof(ADDR_CHANNEL_SETTING), "AddrLib equation bits are the wrong size!");
 
+// Number of hash buckets in the layout cache, divided evenly between its shards.
+constexpr uint32 LayoutCacheNumBuckets = 256;
+
 // =====================================================================================================================
 AddrMgr::AddrMgr(
     const Device* pDevice,
@@ -51,7 +57,12 @@ AddrMgr::AddrMgr(
     m_hAddrLib(nullptr),
     m_pSwizzleEquations(nullptr),
     m_numSwizzleEquations(0),
-    m_tileInfoBytes(tileInfoBytes)
+    m_tileInfoBytes(tileInfoBytes),
+    m_layoutCache(LayoutCacheNumBuckets, pDevice->GetPlatform()),
+    m_layoutCacheNumEntries(0),
+    m_layoutCacheNumBytes(0),
+    m_layoutCacheHits(0),
+    m_layoutCacheMisses(0)
 {
 }
 
@@ -65,6 +76,32 @@ AddrMgr::~AddrMgr()
     }
 
     PAL_SAFE_DELETE_ARRAY(m_pSwizzleEquations, m_pDevice->GetPlatform());
+
+#if PAL_ENABLE_PRINTS_ASSERTS
+    if ((m_layoutCacheHits + m_layoutCacheMisses) > 0)
+    {
+        PAL_DPINFO("Image layout cache: %llu hits, %llu misses, %u entries, %llu bytes",
+                   m_layoutCacheHits,
+                   m_layoutCacheMisses,
+                   m_layoutCacheNumEntries,
+                   m_layoutCacheNumBytes);
+    }
+#endif
+
+    // Entries can only exist if the layout cache was successfully initialized.
+    if (m_layoutCacheNumEntries > 0)
+    {
+        for (uint32 shardIdx = 0; shardIdx < LayoutCacheMap::ShardCount; ++shardIdx)
+        {
+            ConcurrentHashMapShardAuto<LayoutCacheMap, RWLock::ReadWrite>
+                shard(&m_layoutCache, ShardIndexTag(), shardIdx);
+
+            for (auto iter = shard.GetMap()->Begin(); iter.Get() != nullptr; iter.Next())
+            {
+                PAL_FREE(iter.Get()->value, m_pDevice->GetPlatform());
+            }
+        }
+    }
 }
 
 // =====================================================================================================================
@@ -145,6 +182,11 @@ Result AddrMgr::Init()
         }
     }
 
+    if (result == Result::Success)
+    {
+        result = m_layoutCache.Init();
+    }
+
     return result;
 }
 
@@ -211,6 +253,157 @@ uint32 AddrMgr::CalcBytesPerElement(
     return (pSubResInfo->bitsPerTexel == 96) ? 4 : (pSubResInfo->bitsPerTexel >> 3);
 }
 
+// =====================================================================================================================
+// Fills out the layout cache key for an Image. Returns false if the Image's layout must not be cached, either because
+// the layout cache is disabled or because the layout depends on more than the Image's creation parameters.
+bool AddrMgr::BuildLayoutKey(
+    const Image&     image,
+    ImageLayoutKey*  pKey
+    ) const
+{
+    const ImageCreateInfo&         createInfo   = image.GetImageCreateInfo();
+    const ImageInternalCreateInfo& internalInfo = image.GetImageInfo().internalCreateInfo;
+
+    // Peer Images and opened shared Images take their tiling parameters from some other Image.
+    const bool cacheable = (m_pDevice->Settings().imageLayoutCacheSize > 0) &&
+                           (internalInfo.pOriginalImage == nullptr)         &&
+                           (internalInfo.flags.useSharedTilingOverrides == 0);
+
+    if (cacheable)
+    {
+        memset(pKey, 0, sizeof(*pKey));
+
+        pKey->createFlags          = createInfo.flags.u32All;
+        pKey->usageFlags           = createInfo.usageFlags.u32All;
+        pKey->imageType            = static_cast<uint32>(createInfo.imageType);
+        pKey->format               = static_cast<uint32>(createInfo.swizzledFormat.format);
+        pKey->extent               = createInfo.extent;
+        pKey->mipLevels            = createInfo.mipLevels;
+        pKey->arraySize            = createInfo.arraySize;
+        pKey->samples              = createInfo.samples;
+        pKey->fragments            = createInfo.fragments;
+        pKey->tiling               = static_cast<uint32>(createInfo.tiling);
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 292
+        pKey->tilingPreference     = static_cast<uint32>(createInfo.tilingPreference);
+#endif
+        pKey->tilingOptMode        = static_cast<uint32>(createInfo.tilingOptMode);
+        pKey->tileSwizzle          = createInfo.tileSwizzle;
+        pKey->maxBaseAlign         = createInfo.maxBaseAlign;
+        pKey->rowPitch             = createInfo.rowPitch;
+        pKey->depthPitch           = createInfo.depthPitch;
+        pKey->internalFlags        = internalInfo.flags.value;
+        pKey->primaryTilingCaps    = internalInfo.primaryTilingCaps;
+        pKey->chromaPlaneOffset[0] = internalInfo.chromaPlaneOffset[0];
+        pKey->chromaPlaneOffset[1] = internalInfo.chromaPlaneOffset[1];
+    }
+
+    return cacheable;
+}
+
+// =====================================================================================================================
+static uint64 HashLayoutKey(
+    const ImageLayoutKey& key)
+{
+    uint64 hash = 0;
+    MetroHash64::Hash(reinterpret_cast<const uint8*>(&key), sizeof(key), reinterpret_cast<uint8*>(&hash));
+
+    return hash;
+}
+
+// =====================================================================================================================
+// Looks for a layout cached by an earlier Image with the same key. Returns the cached layout and writes its size to
+// pLayoutSize, or returns null if none was found. The returned layout stays valid for the lifetime of the AddrMgr.
+// Every call counts as either a hit or a miss.
+const void* AddrMgr::FindCachedLayout(
+    const ImageLayoutKey& key,
+    size_t*               pLayoutSize
+    ) const
+{
+    LayoutCacheEntry* pEntry  = nullptr;
+    const void*       pLayout = nullptr;
+
+    // Compare the whole key too so that a hash collision can never hand out the wrong layout.
+    if (m_layoutCache.FindKey(HashLayoutKey(key), &pEntry) &&
+        (memcmp(&pEntry->key, &key, sizeof(key)) == 0))
+    {
+        pLayout      = (pEntry + 1);
+        *pLayoutSize = pEntry->layoutSize;
+
+        AtomicAdd64(&m_layoutCacheHits, 1);
+    }
+    else
+    {
+        AtomicAdd64(&m_layoutCacheMisses, 1);
+    }
+
+    return pLayout;
+}
+
+// =====================================================================================================================
+// Adds a newly computed layout to the layout cache, unless it would push the cache over its size limit or another
+// Image got there first.
+void AddrMgr::AddCachedLayout(
+    const ImageLayoutKey& key,
+    const void*           pLayout,
+    size_t                layoutSize
+    ) const
+{
+    const size_t entrySize = sizeof(LayoutCacheEntry) + layoutSize;
+
+    // The size limit is approximate: threads which race past this check together may each add one more entry.
+    if ((m_layoutCacheNumBytes + entrySize) <= m_pDevice->Settings().imageLayoutCacheSize)
+    {
+        Platform*const    pPlatform = m_pDevice->GetPlatform();
+        LayoutCacheEntry* pEntry    = static_cast<LayoutCacheEntry*>(PAL_MALLOC(entrySize,
+                                                                                pPlatform,
+                                                                                SystemAllocType::AllocInternal));
+        if (pEntry != nullptr)
+        {
+            pEntry->key        = key;
+            pEntry->layoutSize = layoutSize;
+            memcpy((pEntry + 1), pLayout, layoutSize);
+
+            const uint64 hash     = HashLayoutKey(key);
+            bool         inserted = false;
+
+            {
+                ConcurrentHashMapShardAuto<LayoutCacheMap, RWLock::ReadWrite> shard(&m_layoutCache, hash);
+
+                bool               existed = false;
+                LayoutCacheEntry** ppValue = nullptr;
+
+                if ((shard.GetMap()->FindAllocate(hash, &existed, &ppValue) == Result::Success) && (existed == false))
+                {
+                    *ppValue = pEntry;
+                    inserted = true;
+                }
+            }
+
+            if (inserted)
+            {
+                AtomicIncrement(&m_layoutCacheNumEntries);
+                AtomicAdd64(&m_layoutCacheNumBytes, entrySize);
+            }
+            else
+            {
+                PAL_FREE(pEntry, pPlatform);
+            }
+        }
+    }
+}
+
+// =====================================================================================================================
+// Reports the layout cache's hit and miss counts.
+void AddrMgr::GetLayoutCacheStats(
+    ImageLayoutCacheStats* pStats
+    ) const
+{
+    pStats->numHits    = m_layoutCacheHits;
+    pStats->numMisses  = m_layoutCacheMisses;
+    pStats->numEntries = m_layoutCacheNumEntries;
+    pStats->numBytes   = m_layoutCacheNumBytes;
+}
+
 // =====================================================================================================================
 // Allocates memory for the AddrLib to use. Returns a pointer to allocated memory, or nullptr if failed.
 void* ADDR_API AllocSysMemCb(
@@ -25,6 +25,7 @@
 #pragma once
 
 #include "addrinterface.h"
+#include "palConcurrentHashMap.h"
 #include "palDevice.h"
 #include "palImage.h"
 
@@ -33,9 +34,46 @@ namespace Pal
 
 class  Device;
 class  Image;
+class  Platform;
 struct SubResourceInfo;
 struct SwizzleEquation;
 
+// =====================================================================================================================
+// Every Image creation parameter which the AddrLib calls made by an AddrMgr depend on. Images with identical keys get
+// identical AddrLib results, so those results are shared between them through the AddrMgr's layout cache. The key is
+// built field-by-field so that it never contains padding or pointers.
+struct ImageLayoutKey
+{
+    uint32   createFlags;           // ImageCreateFlags
+    uint32   usageFlags;            // ImageUsageFlags
+    uint32   imageType;
+    uint32   format;
+    Extent3d extent;
+    uint32   mipLevels;
+    uint32   arraySize;
+    uint32   samples;
+    uint32   fragments;
+    uint32   tiling;
+    uint32   tilingPreference;
+    uint32   tilingOptMode;
+    uint32   tileSwizzle;
+    uint32   maxBaseAlign;
+    uint32   rowPitch;
+    uint32   depthPitch;
+    uint32   internalFlags;         // InternalImageFlags
+    uint32   primaryTilingCaps;
+    gpusize  chromaPlaneOffset[2];
+};
+
+// Statistics reported by an AddrMgr's layout cache.
+struct ImageLayoutCacheStats
+{
+    uint64  numHits;     // Number of Images which reused a cached layout.
+    uint64  numMisses;   // Number of cacheable Images whose layout had to be computed.
+    uint32  numEntries;  // Number of layouts currently in the cache.
+    uint64  numBytes;    // Amount of system memory, in bytes, held by the cached layouts.
+};
+
 // =====================================================================================================================
 // Base class for abstracting address library support.
 class AddrMgr
@@ -73,6 +111,8 @@ public:
     // Returns the tile swizzle value for a particular subresource of an Image.
     virtual uint32 GetTileSwizzle(const Image* pImage, SubresId subresource) const = 0;
 
+    void GetLayoutCacheStats(ImageLayoutCacheStats* pStats) const;
+
 protected:
     AddrMgr(
         const Device* pDevice,
@@ -88,6 +128,10 @@ protected:
         ImageAspect        aspect,
         ImageMemoryLayout* pGpuMemLayout) const = 0;
 
+    bool BuildLayoutKey(const Image& image, ImageLayoutKey* pKey) const;
+    const void* FindCachedLayout(const ImageLayoutKey& key, size_t* pLayoutSize) const;
+    void AddCachedLayout(const ImageLayoutKey& key, const void* pLayout, size_t layoutSize) const;
+
     // Determine the 0-based plane index of a given aspect
     uint32 PlaneIndex(ImageAspect aspect) const
     {
@@ -106,6 +150,23 @@ private:
 
     const size_t        m_tileInfoBytes;            // Per-subresource stride used for tiling information
 
+    // One layout in the layout cache. The AddrMgr-specific layout data immediately follows this structure.
+    struct LayoutCacheEntry
+    {
+        ImageLayoutKey  key;
+        size_t          layoutSize;
+    };
+
+    // Layout cache entries are keyed by a hash of their ImageLayoutKey. They are never removed until the AddrMgr is
+    // destroyed, so lookups can copy a layout out of an entry without holding the shard lock.
+    typedef Util::ConcurrentHashMap<uint64, LayoutCacheEntry*, Platform> LayoutCacheMap;
+
+    mutable LayoutCacheMap   m_layoutCache;
+    mutable volatile uint32  m_layoutCacheNumEntries;
+    mutable volatile uint64  m_layoutCacheNumBytes;
+    mutable volatile uint64  m_layoutCacheHits;
+    mutable volatile uint64  m_layoutCacheMisses;
+
     PAL_DISALLOW_DEFAULT_CTOR(AddrMgr);
     PAL_DISALLOW_COPY_AND_ASSIGN(AddrMgr);
 };
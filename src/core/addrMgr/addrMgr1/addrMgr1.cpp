@@ -123,6 +123,44 @@ Result AddrMgr1::InitSubresourcesForImage(
 
     int32 stencilTileIdx = TileIndexUnused;
 
+    // The AddrLib results for small Images come from the layout cache. They are replayed in the order they were
+    // recorded, so everything else below (including the per-Image tile swizzle chosen by the GfxImage) still runs.
+    Platform*const  pPlatform       = GetDevice()->GetPlatform();
+    const size_t    numSubresources = pImage->GetImageInfo().numSubresources;
+    ImageLayoutKey  layoutKey;
+    LayoutRecorder  recorder        = { };
+    LayoutRecorder* pRecorder       = nullptr;
+
+    if ((numSubresources <= MaxCachedSubresources) && BuildLayoutKey(*pImage, &layoutKey))
+    {
+        // A cache hit only needs room for the cached records; the worst case is only allocated for recording.
+        size_t            cachedSize    = 0;
+        const void*const  pCachedLayout = FindCachedLayout(layoutKey, &cachedSize);
+
+        if (pCachedLayout != nullptr)
+        {
+            recorder.replay     = true;
+            recorder.maxRecords = static_cast<uint32>(cachedSize / sizeof(SurfInfoRecord));
+        }
+        else
+        {
+            recorder.maxRecords = static_cast<uint32>(numSubresources * MaxSurfInfoCallsPerSubresource);
+        }
+
+        recorder.pRecords = static_cast<SurfInfoRecord*>(PAL_MALLOC(sizeof(SurfInfoRecord) * recorder.maxRecords,
+                                                                    pPlatform,
+                                                                    SystemAllocType::AllocInternal));
+        if (recorder.pRecords != nullptr)
+        {
+            if (recorder.replay)
+            {
+                memcpy(recorder.pRecords, pCachedLayout, sizeof(SurfInfoRecord) * recorder.maxRecords);
+            }
+
+            pRecorder = &recorder;
+        }
+    }
+
     SubResIterator subResIt(*pImage);
     do
     {
@@ -134,7 +172,8 @@ Result AddrMgr1::InitSubresourcesForImage(
                                         subResIt.Index(),
                                         pGpuMemLayout,
                                         pDccUnsupported,
-                                        &stencilTileIdx);
+                                        &stencilTileIdx,
+                                        pRecorder);
         if (result != Result::Success)
         {
             break;
@@ -182,6 +221,21 @@ Result AddrMgr1::InitSubresourcesForImage(
         }
     } while (subResIt.Next());
 
+    if (pRecorder != nullptr)
+    {
+        // A replayed layout must be consumed exactly.
+        PAL_ASSERT((result != Result::Success) ||
+                   (recorder.replay == false)   ||
+                   (recorder.numRecords == recorder.maxRecords));
+
+        if ((result == Result::Success) && (recorder.replay == false) && (recorder.overflow == false))
+        {
+            AddCachedLayout(layoutKey, recorder.pRecords, sizeof(SurfInfoRecord) * recorder.numRecords);
+        }
+
+        PAL_FREE(recorder.pRecords, pPlatform);
+    }
+
     return result;
 }
 
@@ -380,6 +434,77 @@ static ADDR_SURFACE_FLAGS InitSurfaceInfoFlags(
     return flags;
 }
 
+// =====================================================================================================================
+// Calls AddrComputeSurfaceInfo, or replays its result from a cached layout. Results are recorded for the layout cache
+// unless pRecorder is null.
+ADDR_E_RETURNCODE AddrMgr1::ComputeSurfaceInfo(
+    LayoutRecorder*                         pRecorder,
+    const ADDR_COMPUTE_SURFACE_INFO_INPUT*  pSurfInfoInput,
+    ADDR_COMPUTE_SURFACE_INFO_OUTPUT*       pSurfInfoOutput
+    ) const
+{
+    ADDR_E_RETURNCODE addrRet = ADDR_OK;
+
+    ADDR_TILEINFO*const     pTileInfo   = pSurfInfoOutput->pTileInfo;
+    ADDR_QBSTEREOINFO*const pStereoInfo = pSurfInfoOutput->pStereoInfo;
+
+    if ((pRecorder != nullptr) && pRecorder->replay && (pRecorder->numRecords < pRecorder->maxRecords))
+    {
+        const SurfInfoRecord& record = pRecorder->pRecords[pRecorder->numRecords++];
+
+        addrRet          = record.addrRet;
+        *pSurfInfoOutput = record.surfInfoOut;
+
+        pSurfInfoOutput->pTileInfo   = pTileInfo;
+        pSurfInfoOutput->pStereoInfo = pStereoInfo;
+
+        if (pTileInfo != nullptr)
+        {
+            *pTileInfo = record.tileInfo;
+        }
+
+        if (pStereoInfo != nullptr)
+        {
+            *pStereoInfo = record.stereoInfo;
+        }
+    }
+    else
+    {
+        // Running out of records while replaying means the cached layout doesn't match this Image.
+        PAL_ASSERT((pRecorder == nullptr) || (pRecorder->replay == false));
+
+        addrRet = AddrComputeSurfaceInfo(AddrLibHandle(), pSurfInfoInput, pSurfInfoOutput);
+
+        if ((pRecorder != nullptr) && (pRecorder->numRecords < pRecorder->maxRecords))
+        {
+            SurfInfoRecord*const pRecord = &pRecorder->pRecords[pRecorder->numRecords++];
+
+            memset(pRecord, 0, sizeof(*pRecord));
+            pRecord->addrRet     = addrRet;
+            pRecord->surfInfoOut = *pSurfInfoOutput;
+
+            if (pTileInfo != nullptr)
+            {
+                pRecord->tileInfo = *pTileInfo;
+            }
+
+            if (pStereoInfo != nullptr)
+            {
+                pRecord->stereoInfo = *pStereoInfo;
+            }
+
+            pRecord->surfInfoOut.pTileInfo   = nullptr;
+            pRecord->surfInfoOut.pStereoInfo = nullptr;
+        }
+        else if (pRecorder != nullptr)
+        {
+            pRecorder->overflow = true;
+        }
+    }
+
+    return addrRet;
+}
+
 // =====================================================================================================================
 // So far we have calculated the independent aligned dimensions of both the Y and the chroma planes.  PAL considers
 // each plane to be its own subresource, but the HW considers both planes combined as one array slice.  Due to
@@ -390,7 +515,8 @@ Result AddrMgr1::AdjustChromaPlane(
     SubResourceInfo*    pSubResInfoList,
     void*               pSubResTileInfoList,
     uint32              subResIdx,
-    ImageMemoryLayout*  pGpuMemLayout
+    ImageMemoryLayout*  pGpuMemLayout,
+    LayoutRecorder*     pRecorder
     ) const
 {
     const ImageCreateInfo& imageCreateInfo   = pImage->GetImageCreateInfo();
@@ -443,7 +569,8 @@ Result AddrMgr1::AdjustChromaPlane(
                                                               &dccUnsupported,
                                                               &stencilTileIdx,
                                                               &surfInfoIn,
-                                                              &surfInfoOut);
+                                                              &surfInfoOut,
+                                                              pRecorder);
 
             if (addrRet == ADDR_OK)
             {
@@ -474,7 +601,8 @@ ADDR_E_RETURNCODE AddrMgr1::CalcSurfInfoOut(
     bool*                              pDccUnsupported,
     int32*                             pStencilTileIdx,
     ADDR_COMPUTE_SURFACE_INFO_INPUT*   pSurfInfoInput,
-    ADDR_COMPUTE_SURFACE_INFO_OUTPUT*  pSurfInfoOutput
+    ADDR_COMPUTE_SURFACE_INFO_OUTPUT*  pSurfInfoOutput,
+    LayoutRecorder*                    pRecorder
     ) const
 {
     const ImageCreateInfo& imageCreateInfo      = pImage->GetImageCreateInfo();
@@ -522,7 +650,8 @@ ADDR_E_RETURNCODE AddrMgr1::CalcSurfInfoOut(
                                                chromaSubResId,
                                                pGpuMemLayout,
                                                pDccUnsupported,
-                                               pStencilTileIdx);
+                                               pStencilTileIdx,
+                                               pRecorder);
 
         Extent3d log2Ratio = Formats::Log2SubsamplingRatio(imageCreateInfo.swizzledFormat.format, chromaSubRes.aspect);
 
@@ -617,7 +746,7 @@ ADDR_E_RETURNCODE AddrMgr1::CalcSurfInfoOut(
 
     pSurfInfoOutput->size = sizeof(*pSurfInfoOutput);
 
-    return AddrComputeSurfaceInfo(AddrLibHandle(), pSurfInfoInput, pSurfInfoOutput);
+    return ComputeSurfaceInfo(pRecorder, pSurfInfoInput, pSurfInfoOutput);
 }
 
 // =====================================================================================================================
@@ -629,7 +758,8 @@ Result AddrMgr1::ComputeSubResourceInfo(
     uint32             subResIdx,
     ImageMemoryLayout* pGpuMemLayout,
     bool*              pDccUnsupported,
-    int32*             pStencilTileIdx
+    int32*             pStencilTileIdx,
+    LayoutRecorder*    pRecorder
     ) const
 {
     const ImageCreateInfo&            imageCreateInfo = pImage->GetImageCreateInfo();
@@ -656,7 +786,8 @@ Result AddrMgr1::ComputeSubResourceInfo(
                                                 pDccUnsupported,
                                                 pStencilTileIdx,
                                                 &surfInfoIn,
-                                                &surfInfoOut);
+                                                &surfInfoOut,
+                                                pRecorder);
 
     if (addrRet == ADDR_OK)
     {
@@ -671,7 +802,7 @@ Result AddrMgr1::ComputeSubResourceInfo(
                 surfInfoIn.tileMode = ADDR_TM_1D_TILED_THIN1;
 
                 // Re-call into AddrLib to try again with 1D tiling.
-                addrRet = AddrComputeSurfaceInfo(AddrLibHandle(), &surfInfoIn, &surfInfoOut);
+                addrRet = ComputeSurfaceInfo(pRecorder, &surfInfoIn, &surfInfoOut);
             }
             else
             {
@@ -821,7 +952,12 @@ Result AddrMgr1::ComputeSubResourceInfo(
 
         if ((result == Result::Success) && isYuvPlanar && (pSubResInfo->subresId.aspect != ImageAspect::Y))
         {
-            result = AdjustChromaPlane(pImage, pSubResInfoList, pSubResTileInfoList, subResIdx, pGpuMemLayout);
+            result = AdjustChromaPlane(pImage,
+                                       pSubResInfoList,
+                                       pSubResTileInfoList,
+                                       subResIdx,
+                                       pGpuMemLayout,
+                                       pRecorder);
         }
 
 #if PAL_DEVELOPER_BUILD
@@ -268,12 +268,38 @@ protected:
         ImageMemoryLayout* pGpuMemLayout) const override;
 
 private:
+    // One AddrComputeSurfaceInfo result, as stored in the layout cache.
+    struct SurfInfoRecord
+    {
+        ADDR_E_RETURNCODE                 addrRet;
+        ADDR_COMPUTE_SURFACE_INFO_OUTPUT  surfInfoOut;  // pTileInfo and pStereoInfo are not valid in the cache
+        ADDR_TILEINFO                     tileInfo;
+        ADDR_QBSTEREOINFO                 stereoInfo;
+    };
+
+    // The AddrComputeSurfaceInfo calls made while computing one Image's layout, in the order they were made. These are
+    // either being recorded for the layout cache or replayed from it.
+    struct LayoutRecorder
+    {
+        SurfInfoRecord*  pRecords;
+        uint32           maxRecords;
+        uint32           numRecords;  // Number of records which have been recorded or replayed so far
+        bool             replay;      // Records come from the layout cache instead of AddrLib
+        bool             overflow;    // Too many calls were made to record; the layout won't be cached
+    };
+
+    ADDR_E_RETURNCODE ComputeSurfaceInfo(
+        LayoutRecorder*                         pRecorder,
+        const ADDR_COMPUTE_SURFACE_INFO_INPUT*  pSurfInfoInput,
+        ADDR_COMPUTE_SURFACE_INFO_OUTPUT*       pSurfInfoOutput) const;
+
     Result AdjustChromaPlane(
         Image*              pImage,
         SubResourceInfo*    pSubResInfoList,
         void*               pSubResTileInfoList,
         uint32              subResIdx,
-        ImageMemoryLayout*  pGpuMemLayout) const;
+        ImageMemoryLayout*  pGpuMemLayout,
+        LayoutRecorder*     pRecorder) const;
 
     ADDR_E_RETURNCODE CalcSurfInfoOut(
         Image*                             pImage,
@@ -286,7 +312,8 @@ private:
         bool*                              pDccUnsupported,
         int32*                             pStencilTileIdx,
         ADDR_COMPUTE_SURFACE_INFO_INPUT*   pSurfInfoInput,
-        ADDR_COMPUTE_SURFACE_INFO_OUTPUT*  pSurfInfoOutput) const;
+        ADDR_COMPUTE_SURFACE_INFO_OUTPUT*  pSurfInfoOutput,
+        LayoutRecorder*                    pRecorder) const;
 
     void InitTilingCaps(
         Image* pImage,
@@ -300,7 +327,8 @@ private:
         uint32             subResIdx,
         ImageMemoryLayout* pGpuMemLayout,
         bool*              pDccUnsupported,
-        int32*             pStencilTileIdx) const;
+        int32*             pStencilTileIdx,
+        LayoutRecorder*    pRecorder) const;
 
     void BuildTileToken(
         SubResourceInfo* pSubResInfo,
@@ -308,6 +336,13 @@ private:
 
     static constexpr uint32 Addr1TilingCaps = 0x1FF;
 
+    // Only Images with at most this many subresources use the layout cache, which bounds the size of each layout.
+    static constexpr uint32 MaxCachedSubresources = 256;
+
+    // Computing one subresource can take several AddrComputeSurfaceInfo calls: a retry with 1D tiling for
+    // depth/stencil, and extra passes over the chroma planes of YUV planar Images.
+    static constexpr uint32 MaxSurfInfoCallsPerSubresource = 4;
+
     PAL_DISALLOW_DEFAULT_CTOR(AddrMgr1);
     PAL_DISALLOW_COPY_AND_ASSIGN(AddrMgr1);
 };
@@ -145,6 +145,18 @@ void AddrMgr2::BuildTileToken(
     pSubResInfo->tileToken = token.u32All;
 }
 
+// Images have at most three planes (e.g., YV12).
+constexpr uint32 MaxNumPlanes = 3;
+
+// =====================================================================================================================
+// AddrLib's results for one plane of an Image, as stored in the layout cache.
+struct PlaneLayout
+{
+    ADDR2_GET_PREFERRED_SURF_SETTING_OUTPUT surfSetting;
+    ADDR2_COMPUTE_SURFACE_INFO_OUTPUT       surfInfo;    // pMipInfo is not valid in the cache
+    ADDR2_MIP_INFO                          mipInfo[MaxImageMipLevels];
+};
+
 // =====================================================================================================================
 // Initializes all subresources for an Image object.
 Result AddrMgr2::InitSubresourcesForImage(
@@ -165,6 +177,26 @@ Result AddrMgr2::InitSubresourcesForImage(
     const ImageCreateInfo& createInfo = pImage->GetImageCreateInfo();
     const ImageInfo&       imageInfo = pImage->GetImageInfo();
 
+    // Only the AddrLib outputs come from the layout cache. Everything derived from them (including the per-Image
+    // pipe-bank XOR computed by the GfxImage) is still computed below for every Image.
+    PAL_ASSERT(imageInfo.numPlanes <= MaxNumPlanes);
+
+    PlaneLayout    planeLayouts[MaxNumPlanes];
+    ImageLayoutKey layoutKey;
+    const bool     cacheable     = BuildLayoutKey(*pImage, &layoutKey);
+    const size_t   layoutSize    = (sizeof(PlaneLayout) * imageInfo.numPlanes);
+    size_t         cachedSize    = 0;
+    const void*    pCachedLayout = cacheable ? FindCachedLayout(layoutKey, &cachedSize) : nullptr;
+
+    // Identical keys should always produce layouts of the same size.
+    PAL_ASSERT((pCachedLayout == nullptr) || (cachedSize == layoutSize));
+
+    const bool cachedFound = (pCachedLayout != nullptr) && (cachedSize == layoutSize);
+    if (cachedFound)
+    {
+        memcpy(&planeLayouts[0], pCachedLayout, layoutSize);
+    }
+
     const uint32 subResourcesPerPlane = (createInfo.mipLevels * createInfo.arraySize);
     for (uint32 plane = 0; plane < imageInfo.numPlanes; ++plane)
     {
@@ -172,23 +204,32 @@ Result AddrMgr2::InitSubresourcesForImage(
         SubResourceInfo*const pBaseSubRes   = (pSubResInfoList + (plane * subResourcesPerPlane));
         TileInfo*const        pBaseTileInfo = NonConstTileInfo(pSubResTileInfoList, (plane * subResourcesPerPlane));
 
-        ADDR2_GET_PREFERRED_SURF_SETTING_OUTPUT surfSettingOut = { };
-        surfSettingOut.size = sizeof(surfSettingOut);
-
-        ADDR2_MIP_INFO mipInfo[MaxImageMipLevels] = { };
-        ADDR2_COMPUTE_SURFACE_INFO_OUTPUT surfInfoOut = { };
-        surfInfoOut.size     = sizeof(surfInfoOut);
-        surfInfoOut.pMipInfo = &mipInfo[0];
+        PlaneLayout*const                        pPlaneLayout   = &planeLayouts[plane];
+        ADDR2_GET_PREFERRED_SURF_SETTING_OUTPUT& surfSettingOut = pPlaneLayout->surfSetting;
+        ADDR2_COMPUTE_SURFACE_INFO_OUTPUT&       surfInfoOut    = pPlaneLayout->surfInfo;
 
-        result = ComputePlaneSwizzleMode<false>(pImage, pBaseSubRes, &surfSettingOut);
-        if (result == Result::Success)
+        if (cachedFound)
         {
-            // Use AddrLib to compute the padded and aligned dimensions of the entire mip-chain.
-            result = ComputeAlignedPlaneDimensions(pImage,
-                                                   pBaseSubRes,
-                                                   pBaseTileInfo,
-                                                   surfSettingOut.swizzleMode,
-                                                   &surfInfoOut);
+            surfInfoOut.pMipInfo  = &pPlaneLayout->mipInfo[0];
+            pBaseTileInfo->ePitch = CalcEpitch(&surfInfoOut);
+        }
+        else
+        {
+            memset(pPlaneLayout, 0, sizeof(*pPlaneLayout));
+            surfSettingOut.size  = sizeof(surfSettingOut);
+            surfInfoOut.size     = sizeof(surfInfoOut);
+            surfInfoOut.pMipInfo = &pPlaneLayout->mipInfo[0];
+
+            result = ComputePlaneSwizzleMode<false>(pImage, pBaseSubRes, &surfSettingOut);
+            if (result == Result::Success)
+            {
+                // Use AddrLib to compute the padded and aligned dimensions of the entire mip-chain.
+                result = ComputeAlignedPlaneDimensions(pImage,
+                                                       pBaseSubRes,
+                                                       pBaseTileInfo,
+                                                       surfSettingOut.swizzleMode,
+                                                       &surfInfoOut);
+            }
         }
 
         if (result == Result::Success)
@@ -292,6 +333,11 @@ Result AddrMgr2::InitSubresourcesForImage(
 
     } // End loop over aspect planes
 
+    if (cacheable && (cachedFound == false) && (result == Result::Success))
+    {
+        AddCachedLayout(layoutKey, &planeLayouts[0], layoutSize);
+    }
+
     // Depth/stencil and YUV images have different orderings of subresources and planes. To handle this, we'll loop
     // through again to compute the final offsets for each subresource.
     if (result == Result::Success)
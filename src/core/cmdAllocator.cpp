@@ -89,6 +89,7 @@ CmdAllocator::CmdAllocator(
     m_pDevice(pDevice),
     m_pChunkLock(nullptr),
     m_lastPagingFence(0),
+    m_resetsSinceTrim(0),
     m_pLinearAllocLock(nullptr)
 {
 #if PAL_ENABLE_PRINTS_ASSERTS
@@ -102,6 +103,9 @@ CmdAllocator::CmdAllocator(
     {
         m_flags.trackBusyChunks = m_flags.autoMemoryReuse;
     }
+    m_flags.adaptiveChunkSize = pDevice->Settings().cmdAllocatorAdaptiveChunkSize;
+
+    memset(const_cast<uint32*>(&m_streamSizeHistogram[0][0]), 0, sizeof(m_streamSizeHistogram));
 
     if (createInfo.flags.threadSafe)
     {
@@ -112,6 +116,14 @@ CmdAllocator::CmdAllocator(
 
     for (uint32 i = 0; i < CmdAllocatorTypeCount; ++i)
     {
+        memset(&m_gpuAllocInfo[i].ppAllocTable[0], 0, sizeof(m_gpuAllocInfo[i].ppAllocTable));
+        m_gpuAllocInfo[i].numAllocs       = 0;
+        m_gpuAllocInfo[i].freeStack       = 0;
+        m_gpuAllocInfo[i].retireStack     = 0;
+        m_gpuAllocInfo[i].chunksInUse     = 0;
+        m_gpuAllocInfo[i].peakChunksInUse = 0;
+        m_gpuAllocInfo[i].trimHighWater   = 0;
+
         memset(&m_gpuAllocInfo[i].allocCreateInfo, 0, sizeof(m_gpuAllocInfo[i].allocCreateInfo));
 
         m_gpuAllocInfo[i].allocCreateInfo.memObjCreateInfo.priority  = GpuMemPriority::Normal;
@@ -141,6 +153,7 @@ CmdAllocator::CmdAllocator(
         PAL_ASSERT(HighPart(createInfo.allocInfo[i].suballocSize) == 0);
 
         m_gpuAllocInfo[i].allocCreateInfo.chunkSize = LowPart(createInfo.allocInfo[i].suballocSize);
+        m_minChunkSize[i]                           = m_gpuAllocInfo[i].allocCreateInfo.chunkSize;
         m_gpuAllocInfo[i].allocCreateInfo.numChunks = LowPart(createInfo.allocInfo[i].allocSize /
                                                               createInfo.allocInfo[i].suballocSize);
 
@@ -162,6 +175,14 @@ CmdAllocator::CmdAllocator(
     // memory heaps selected.
     m_sysAllocInfo.allocCreateInfo = m_gpuAllocInfo[CommandDataAlloc].allocCreateInfo;
     m_sysAllocInfo.allocCreateInfo.memObjCreateInfo.heapCount = 0;
+
+    memset(&m_sysAllocInfo.ppAllocTable[0], 0, sizeof(m_sysAllocInfo.ppAllocTable));
+    m_sysAllocInfo.numAllocs       = 0;
+    m_sysAllocInfo.freeStack       = 0;
+    m_sysAllocInfo.retireStack     = 0;
+    m_sysAllocInfo.chunksInUse     = 0;
+    m_sysAllocInfo.peakChunksInUse = 0;
+    m_sysAllocInfo.trimHighWater   = 0;
 }
 
 // =====================================================================================================================
@@ -183,6 +204,7 @@ CmdAllocator::~CmdAllocator()
     }
 
     FreeAllChunks();
+    FreeAllocTables();
     FreeAllLinearAllocators();
 
 #if PAL_ENABLE_PRINTS_ASSERTS
@@ -200,26 +222,48 @@ CmdAllocator::~CmdAllocator()
 }
 
 // =====================================================================================================================
-// Transfers all chunks from the src list to the dst list after resetting the chunks in the src list.
-void CmdAllocator::TransferChunks(
-    ChunkList* pFreeList,
-    ChunkList* pSrcList)
+// Resets every chunk of the given type and rebuilds the free stack from them. The caller must guarantee that none of
+// the chunks are in use and that no other thread is accessing the allocator.
+void CmdAllocator::ReclaimAllChunks(
+    CmdAllocInfo* pAllocInfo)
 {
-    if (pSrcList->IsEmpty() == false)
+    const uint32    numChunks = pAllocInfo->allocCreateInfo.numChunks;
+    CmdStreamChunk* pFirst    = nullptr;
+    CmdStreamChunk* pLast     = nullptr;
+
+    for (auto iter = pAllocInfo->allocList.Begin(); iter.IsValid(); iter.Next())
     {
-        // Reset the allocator by moving all chunks from src list into the dst list. The chunks are reset prior to the
-        // move
-        for (auto iter = pSrcList->Begin(); iter.IsValid(); iter.Next())
+        CmdStreamChunk*const pChunks = iter.Get()->Chunks();
+
+        for (uint32 idx = 0; idx < numChunks; ++idx)
         {
             // The caller must guarantee that all of these chunks have expired so we should never have to check
             // the busy trackers. That being said, we should protect ourselves and validate the chunk busy
             // trackers in builds with asserts enabled.
-            PAL_ASSERT((TrackBusyChunks() == false) || iter.Get()->IsIdleOnGpu());
+            PAL_ASSERT((TrackBusyChunks() == false) || pChunks[idx].IsIdleOnGpu());
+
+            pChunks[idx].Reset(true);
 
-            iter.Get()->Reset(true);
+            if (pLast != nullptr)
+            {
+                pLast->SetNextStackId(pChunks[idx].StackId());
+            }
+            else
+            {
+                pFirst = &pChunks[idx];
+            }
+            pLast = &pChunks[idx];
         }
+    }
 
-        pFreeList->PushFrontList(pSrcList);
+    pAllocInfo->freeStack       = 0;
+    pAllocInfo->retireStack     = 0;
+    pAllocInfo->chunksInUse     = 0;
+    pAllocInfo->peakChunksInUse = 0;
+
+    if (pFirst != nullptr)
+    {
+        PushChunks(&pAllocInfo->freeStack, pFirst, pLast);
     }
 }
 
@@ -243,14 +287,14 @@ void CmdAllocator::FreeAllChunks()
     {
         for (uint32 i = 0; i < (CmdAllocatorTypeCount + 1); ++i)
         {
-            for (auto iter = pAllocInfo[i]->busyList.Begin(); iter.IsValid(); iter.Next())
-            {
-                PAL_ASSERT(iter.Get()->IsIdleOnGpu());
-            }
+            const uint32 numChunks = pAllocInfo[i]->allocCreateInfo.numChunks;
 
-            for (auto iter = pAllocInfo[i]->reuseList.Begin(); iter.IsValid(); iter.Next())
+            for (auto iter = pAllocInfo[i]->allocList.Begin(); iter.IsValid(); iter.Next())
             {
-                PAL_ASSERT(iter.Get()->IsIdleOnGpu());
+                for (uint32 idx = 0; idx < numChunks; ++idx)
+                {
+                    PAL_ASSERT(iter.Get()->Chunks()[idx].IsIdleOnGpu());
+                }
             }
         }
     }
@@ -260,10 +304,13 @@ void CmdAllocator::FreeAllChunks()
     // called in this loop can access those head chunks.
     for (uint32 i = 0; i < (CmdAllocatorTypeCount + 1); ++i)
     {
-        // Empty out the chunk lists so we can destroy the chunks.
-        pAllocInfo[i]->freeList.EraseAll();
-        pAllocInfo[i]->busyList.EraseAll();
-        pAllocInfo[i]->reuseList.EraseAll();
+        // Empty out the chunk stacks so we can destroy the chunks. The allocation table segments are kept around for
+        // the allocations we create after this.
+        pAllocInfo[i]->freeStack       = 0;
+        pAllocInfo[i]->retireStack     = 0;
+        pAllocInfo[i]->numAllocs       = 0;
+        pAllocInfo[i]->chunksInUse     = 0;
+        pAllocInfo[i]->peakChunksInUse = 0;
 
         // Destroy all allocations (which also destroys all chunks).
         for (auto iter = pAllocInfo[i]->allocList.Begin(); iter.IsValid();)
@@ -279,6 +326,28 @@ void CmdAllocator::FreeAllChunks()
     }
 }
 
+// =====================================================================================================================
+// Frees the allocation table segments. All allocations must have been destroyed first.
+void CmdAllocator::FreeAllocTables()
+{
+    CmdAllocInfo*const pAllocInfo[] =
+    {
+        &m_gpuAllocInfo[CommandDataAlloc],
+        &m_gpuAllocInfo[EmbeddedDataAlloc],
+        &m_sysAllocInfo,
+    };
+
+    for (uint32 i = 0; i < (CmdAllocatorTypeCount + 1); ++i)
+    {
+        PAL_ASSERT(pAllocInfo[i]->numAllocs == 0);
+
+        for (uint32 segment = 0; segment < AllocTableSegmentCount; ++segment)
+        {
+            PAL_SAFE_FREE(pAllocInfo[i]->ppAllocTable[segment], m_pDevice->GetPlatform());
+        }
+    }
+}
+
 // =====================================================================================================================
 // Removes all linear allocators from our lists and deletes them.
 void CmdAllocator::FreeAllLinearAllocators()
@@ -364,16 +433,18 @@ Result CmdAllocator::Reset()
         // We've been asked to simply destroy all of our allocations on each reset.
         FreeAllChunks();
     }
-    else
+
+    // Trim and resize allocations before the remaining chunks are reset and put back on the free stacks.
+    ApplyAllocPolicy();
+
+    if (freeOnReset == false)
     {
         for (uint32 i = 0; i < CmdAllocatorTypeCount; ++i)
         {
-            TransferChunks(&m_gpuAllocInfo[i].freeList, &m_gpuAllocInfo[i].busyList);
-            TransferChunks(&m_gpuAllocInfo[i].freeList, &m_gpuAllocInfo[i].reuseList);
+            ReclaimAllChunks(&m_gpuAllocInfo[i]);
         }
 
-        TransferChunks(&m_sysAllocInfo.freeList, &m_sysAllocInfo.busyList);
-        TransferChunks(&m_sysAllocInfo.freeList, &m_sysAllocInfo.reuseList);
+        ReclaimAllChunks(&m_sysAllocInfo);
     }
 
     if (m_pChunkLock != nullptr)
@@ -405,7 +476,8 @@ Result CmdAllocator::Reset()
 }
 
 // =====================================================================================================================
-// Takes an iterator to a list of CmdStreamChunk(s) and moves them to the reuse list for use later.
+// Takes an iterator to a list of CmdStreamChunk(s) and returns them to the allocator for use later. This never blocks:
+// the chunks are pushed onto the free stack if they are already idle or onto the retire stack otherwise.
 void CmdAllocator::ReuseChunks(
     CmdAllocType   allocType,
     bool           systemMemory,
@@ -414,47 +486,51 @@ void CmdAllocator::ReuseChunks(
     // System memory allocations are only allowed for command data!
     PAL_ASSERT((systemMemory == false) || (allocType == CommandDataAlloc));
 
-    if (AutomaticMemoryReuse())
+    if (m_flags.adaptiveChunkSize != 0)
     {
-        // If necessary, engage the chunk lock.
-        if (m_pChunkLock != nullptr)
-        {
-            m_pChunkLock->Lock();
-        }
+        SampleStreamSize(allocType, iter);
+    }
 
+    if (AutomaticMemoryReuse())
+    {
         auto*const pAllocInfo = (systemMemory ? &m_sysAllocInfo : &m_gpuAllocInfo[allocType]);
 
-        // If the root chunk is idle, we can reset and push all the chunks to the free list.
-        if (iter.Get()->IsIdle())
+        // If the root chunk is idle, we can reset all the chunks and push them to the free stack. Otherwise they are
+        // retired as one batch which GetNewChunk will recycle once their busy-trackers catch up.
+        const bool      isIdle    = iter.Get()->IsIdle();
+        CmdStreamChunk* pFirst    = nullptr;
+        CmdStreamChunk* pLast     = nullptr;
+        uint32          numChunks = 0;
+
+        while (iter.IsValid())
         {
-            while (iter.IsValid())
+            CmdStreamChunk*const pChunk = iter.Get();
+
+            // Remember that items on the free stack must be reset.
+            if (isIdle)
             {
-                // Move this chunk from the busy list to the front of the free list.
-                auto*const pNode = iter.Get()->ListNode();
-                pAllocInfo->busyList.Erase(pNode);
-                pAllocInfo->freeList.PushFront(pNode);
-
-                // Remember that items on the free list must be reset.
-                iter.Get()->Reset(true);
-                iter.Next();
+                pChunk->Reset(true);
             }
-        }
-        else
-        {
-            while (iter.IsValid())
-            {
-                // Move this chunk from the busy list to the front of the reuse list.
-                auto*const pNode = iter.Get()->ListNode();
-                pAllocInfo->busyList.Erase(pNode);
-                pAllocInfo->reuseList.PushFront(pNode);
 
-                iter.Next();
+            if (pLast != nullptr)
+            {
+                pLast->SetNextStackId(pChunk->StackId());
             }
+            else
+            {
+                pFirst = pChunk;
+            }
+            pLast = pChunk;
+
+            numChunks++;
+            iter.Next();
         }
 
-        if (m_pChunkLock != nullptr)
+        PushChunks((isIdle ? &pAllocInfo->freeStack : &pAllocInfo->retireStack), pFirst, pLast);
+
+        if (isIdle)
         {
-            m_pChunkLock->Unlock();
+            AtomicAdd(&pAllocInfo->chunksInUse, (0u - numChunks));
         }
     }
 }
@@ -469,23 +545,12 @@ Result CmdAllocator::GetNewChunk(
     // System memory allocations are only allowed for command data!
     PAL_ASSERT((systemMemory == false) || (allocType == CommandDataAlloc));
 
-    // If necessary, engage the chunk lock while we search for a free chunk.
-    if (m_pChunkLock != nullptr)
-    {
-        m_pChunkLock->Lock();
-    }
-
     Result result = FindFreeChunk(systemMemory ? &m_sysAllocInfo : &m_gpuAllocInfo[allocType], ppChunk);
     if (result == Result::Success)
     {
         (*ppChunk)->AddCommandStreamReference();
     }
 
-    if (m_pChunkLock != nullptr)
-    {
-        m_pChunkLock->Unlock();
-    }
-
     return result;
 }
 
@@ -512,65 +577,368 @@ CmdStreamChunk* CmdAllocator::GetDummyChunk()
 }
 
 // =====================================================================================================================
-// Searches the free and busy lists for a free chunk. A new CmdStreamAllocation will be created if needed.
+// Pops a chunk off of the free stack, recycling retired chunks if it is empty. A new CmdStreamAllocation will be
+// created if needed; that is the only case in which the chunk lock is taken.
 Result CmdAllocator::FindFreeChunk(
     CmdAllocInfo*    pAllocInfo,
     CmdStreamChunk** ppChunk)
 {
     Result result = Result::Success;
-    CmdStreamChunk* pChunk = nullptr;
+    CmdStreamChunk* pChunk = PopChunk(*pAllocInfo, &pAllocInfo->freeStack);
 
-    // Search the free-list first.
-    if (pAllocInfo->freeList.IsEmpty() == false)
+    if ((pChunk == nullptr) && AutomaticMemoryReuse())
     {
-        // Pop a chunk off of the free list because free chunks, by definition, are no longer in use by the CPU or GPU.
-        // Checking for IsIdle with automatic memory reuse disabled is undefined. The best we can do is check if it is
-        // idle on the GPU.
-        pChunk = pAllocInfo->freeList.Back();
-        PAL_ASSERT((AutomaticMemoryReuse() && pChunk->IsIdle()) || pChunk->IsIdleOnGpu());
+        // Sweep the retired chunks for any that expired after they were returned to us, then try again.
+        RetireChunks(pAllocInfo);
+        pChunk = PopChunk(*pAllocInfo, &pAllocInfo->freeStack);
+    }
 
-        // Move the chunk from the free list to the front of the busy list.
-        auto*const pNode = pChunk->ListNode();
-        pAllocInfo->freeList.Erase(pNode);
-        pAllocInfo->busyList.PushFront(pNode);
+    if (pChunk != nullptr)
+    {
+        // Free chunks, by definition, are no longer in use by the CPU or GPU. Checking for IsIdle with automatic
+        // memory reuse disabled is undefined. The best we can do is check if it is idle on the GPU.
+        PAL_ASSERT((AutomaticMemoryReuse() && pChunk->IsIdle()) || pChunk->IsIdleOnGpu());
     }
     else
     {
-        if (AutomaticMemoryReuse())
+        if (m_pChunkLock != nullptr)
         {
-            // Search the reuse list for a chunk that expired after it was returned to us. Start at the end because
-            // those chunks have been on the list the longest and are most likely to be idle.
-            for (auto reuseIter = pAllocInfo->reuseList.End(); reuseIter.IsValid(); reuseIter.Prev())
+            m_pChunkLock->Lock();
+        }
+
+        // All retired chunks were still in-use so we must create a new ChunkAllocation. It is possible for this call
+        // to fail in rare circumstances (e.g., out of GPU memory) but we do not expect it to occur.
+        result = CreateAllocation(pAllocInfo, false, &pChunk);
+
+        if (m_pChunkLock != nullptr)
+        {
+            m_pChunkLock->Unlock();
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        // This can race with other threads but the peak only needs to be roughly right for trimming.
+        const uint32 chunksInUse = AtomicIncrement(&pAllocInfo->chunksInUse);
+
+        if (chunksInUse > pAllocInfo->peakChunksInUse)
+        {
+            pAllocInfo->peakChunksInUse = chunksInUse;
+        }
+    }
+
+    *ppChunk = pChunk;
+    return result;
+}
+
+// =====================================================================================================================
+// Takes every chunk off of the retire stack in one batch and pushes the idle ones onto the free stack. Chunks whose
+// busy-trackers show outstanding GPU work go back onto the retire stack. Any number of threads may do this at once,
+// each of them simply gets a different (possibly empty) batch.
+void CmdAllocator::RetireChunks(
+    CmdAllocInfo* pAllocInfo)
+{
+    CmdStreamChunk* pChunk     = PopAllChunks(*pAllocInfo, &pAllocInfo->retireStack);
+    CmdStreamChunk* pIdleFirst = nullptr;
+    CmdStreamChunk* pIdleLast  = nullptr;
+    CmdStreamChunk* pBusyFirst = nullptr;
+    CmdStreamChunk* pBusyLast  = nullptr;
+    uint32          numIdle    = 0;
+
+    while (pChunk != nullptr)
+    {
+        const uint32 nextId = pChunk->NextStackId();
+
+        // Chunks from one command stream share the busy-tracker of their root chunk, so the first idle chunk of a
+        // batch resets the root and the rest of the batch immediately sees it as idle.
+        if (pChunk->IsIdle())
+        {
+            pChunk->Reset(true);
+
+            if (pIdleLast != nullptr)
+            {
+                pIdleLast->SetNextStackId(pChunk->StackId());
+            }
+            else
+            {
+                pIdleFirst = pChunk;
+            }
+            pIdleLast = pChunk;
+            numIdle++;
+        }
+        else
+        {
+            if (pBusyLast != nullptr)
+            {
+                pBusyLast->SetNextStackId(pChunk->StackId());
+            }
+            else
             {
-                if (reuseIter.Get()->IsIdle())
+                pBusyFirst = pChunk;
+            }
+            pBusyLast = pChunk;
+        }
+
+        pChunk = (nextId != 0) ? LookupChunk(*pAllocInfo, nextId) : nullptr;
+    }
+
+    PushChunks(&pAllocInfo->freeStack,   pIdleFirst, pIdleLast);
+    PushChunks(&pAllocInfo->retireStack, pBusyFirst, pBusyLast);
+
+    AtomicAdd(&pAllocInfo->chunksInUse, (0u - numIdle));
+}
+
+// =====================================================================================================================
+// Records how many bytes of chunk memory a command stream used before returning its chunks.
+void CmdAllocator::SampleStreamSize(
+    CmdAllocType allocType,
+    VectorIter   iter)
+{
+    uint64 bytesUsed = 0;
+
+    while (iter.IsValid())
+    {
+        bytesUsed += iter.Get()->DwordsAllocated() * sizeof(uint32);
+        iter.Next();
+    }
+
+    const uint32 bin = Min(Log2(Pow2Pad(Max(bytesUsed, uint64(1)))), StreamSizeBinCount - 1);
+
+    AtomicIncrement(&m_streamSizeHistogram[allocType][bin]);
+}
+
+// =====================================================================================================================
+// Called on each Reset to track each type's peak chunk usage. At the end of every trim interval this destroys idle
+// allocations beyond the interval's high-water mark and, if enabled, switches each type to its preferred chunk size.
+// The caller must hold the chunk lock and guarantee that none of the chunks are in use.
+void CmdAllocator::ApplyAllocPolicy()
+{
+    CmdAllocInfo*const pAllocInfo[] =
+    {
+        &m_gpuAllocInfo[CommandDataAlloc],
+        &m_gpuAllocInfo[EmbeddedDataAlloc],
+        &m_sysAllocInfo,
+    };
+
+    for (uint32 i = 0; i < (CmdAllocatorTypeCount + 1); ++i)
+    {
+        pAllocInfo[i]->trimHighWater = Max(pAllocInfo[i]->trimHighWater, pAllocInfo[i]->peakChunksInUse);
+    }
+
+    const uint32 trimInterval = m_pDevice->Settings().cmdAllocatorTrimInterval;
+
+    if ((trimInterval != 0) && (++m_resetsSinceTrim >= trimInterval))
+    {
+        if (m_flags.adaptiveChunkSize != 0)
+        {
+            for (uint32 i = 0; i < CmdAllocatorTypeCount; ++i)
+            {
+                const uint32 chunkSize = ChooseChunkSize(static_cast<CmdAllocType>(i));
+
+                if (chunkSize != m_gpuAllocInfo[i].allocCreateInfo.chunkSize)
                 {
-                    pChunk = reuseIter.Get();
-                    pChunk->Reset(true);
-
-                    // Move this chunk from the reuse list to the front of the busy list.
-                    auto*const pNode = pChunk->ListNode();
-                    pAllocInfo->reuseList.Erase(pNode);
-                    pAllocInfo->busyList.PushFront(pNode);
-                    break;
+                    ResizeChunks(&m_gpuAllocInfo[i], chunkSize);
+
+                    // System memory chunks stand in for GPU command chunks so they must always be the same size.
+                    if (i == CommandDataAlloc)
+                    {
+                        ResizeChunks(&m_sysAllocInfo, chunkSize);
+                    }
                 }
             }
         }
 
+        for (uint32 i = 0; i < (CmdAllocatorTypeCount + 1); ++i)
+        {
+            const uint32 numChunks = pAllocInfo[i]->allocCreateInfo.numChunks;
+
+            TrimAllocations(pAllocInfo[i], (pAllocInfo[i]->trimHighWater + numChunks - 1) / numChunks);
+            pAllocInfo[i]->trimHighWater = 0;
+        }
+
+        m_resetsSinceTrim = 0;
+    }
+}
+
+// =====================================================================================================================
+// Picks the chunk size for the given type which holds 90% of recently sampled command streams in a single chunk. The
+// result is always a power-of-two multiple of the client's suballocation size which evenly divides the allocation size.
+uint32 CmdAllocator::ChooseChunkSize(
+    CmdAllocType allocType)
+{
+    // Don't change anything until we've seen a reasonable number of streams.
+    constexpr uint32 MinSampleCount = 64;
+
+    volatile uint32*const pHistogram = &m_streamSizeHistogram[allocType][0];
+    uint32                chunkSize  = m_gpuAllocInfo[allocType].allocCreateInfo.chunkSize;
+    uint64                numSamples = 0;
+
+    for (uint32 bin = 0; bin < StreamSizeBinCount; ++bin)
+    {
+        numSamples += pHistogram[bin];
+    }
+
+    if (numSamples >= MinSampleCount)
+    {
+        const uint64 threshold  = (numSamples * 9 + 9) / 10;
+        uint64       cumulative = 0;
+        uint32       targetBin  = 0;
+
+        while ((targetBin < (StreamSizeBinCount - 1)) && ((cumulative + pHistogram[targetBin]) < threshold))
+        {
+            cumulative += pHistogram[targetBin];
+            targetBin++;
+        }
+
+        const gpusize targetSize = 1ull << targetBin;
+        const gpusize allocSize  = m_gpuAllocInfo[allocType].allocCreateInfo.memObjCreateInfo.size;
+
+        chunkSize = m_minChunkSize[allocType];
+
+        while ((chunkSize < targetSize) && ((2ull * chunkSize) <= allocSize) && ((allocSize % (2ull * chunkSize)) == 0))
+        {
+            chunkSize *= 2;
+        }
+
+        // Age the samples so that the policy follows changes in the application's behavior.
+        for (uint32 bin = 0; bin < StreamSizeBinCount; ++bin)
+        {
+            pHistogram[bin] /= 2;
+        }
+    }
+
+    return chunkSize;
+}
+
+// =====================================================================================================================
+// Switches one type of chunk to a new size. Every existing allocation of that type is destroyed since all allocations
+// of a type must be identical. The caller must guarantee that none of the chunks are in use.
+void CmdAllocator::ResizeChunks(
+    CmdAllocInfo* pAllocInfo,
+    uint32        chunkSize)
+{
+    TrimAllocations(pAllocInfo, 0);
+
+    const gpusize allocSize = pAllocInfo->allocCreateInfo.memObjCreateInfo.size;
+    PAL_ASSERT((allocSize % chunkSize) == 0);
+
+    pAllocInfo->allocCreateInfo.chunkSize = chunkSize;
+    pAllocInfo->allocCreateInfo.numChunks = LowPart(allocSize / chunkSize);
+    pAllocInfo->trimHighWater             = 0;
+}
+
+// =====================================================================================================================
+// Destroys the most recently created allocations of one type until only numAllocsToKeep remain. The allocation table
+// must stay dense, so allocations are always destroyed in reverse creation order. The caller must guarantee that none
+// of the chunks are in use; the free and retire stacks are left for ReclaimAllChunks to rebuild.
+void CmdAllocator::TrimAllocations(
+    CmdAllocInfo* pAllocInfo,
+    uint32        numAllocsToKeep)
+{
+    while (pAllocInfo->numAllocs > numAllocsToKeep)
+    {
+        CmdStreamAllocation*      pAlloc   = pAllocInfo->allocList.Back();
+        const uint32              allocIdx = pAllocInfo->numAllocs - 1;
+        const uint32              segment  = Log2(allocIdx + 1);
+
+        // Allocations are appended to the list as they are created so the back of the list is the newest allocation.
+        PAL_ASSERT(pAllocInfo->ppAllocTable[segment][allocIdx + 1 - (1u << segment)] == pAlloc->Chunks());
+
+        pAllocInfo->allocList.Erase(pAlloc->ListNode());
+        pAllocInfo->numAllocs--;
+
+        pAlloc->Destroy(m_pDevice);
+        PAL_SAFE_FREE(pAlloc, m_pDevice->GetPlatform());
+    }
+}
+
+// =====================================================================================================================
+// Resolves a nonzero stack ID to its chunk. Stack IDs are one plus the chunk's index across all allocations of a type.
+CmdStreamChunk* CmdAllocator::LookupChunk(
+    const CmdAllocInfo& allocInfo,
+    uint32              stackId)
+{
+    PAL_ASSERT(stackId != 0);
+
+    const uint32 numChunks = allocInfo.allocCreateInfo.numChunks;
+    const uint32 allocIdx  = (stackId - 1) / numChunks;
+    const uint32 segment   = Log2(allocIdx + 1);
+
+    return allocInfo.ppAllocTable[segment][allocIdx + 1 - (1u << segment)] + ((stackId - 1) % numChunks);
+}
+
+// =====================================================================================================================
+// Pushes a chain of chunks, already linked from pFirst to pLast through their next stack IDs, onto a chunk stack.
+void CmdAllocator::PushChunks(
+    ChunkStack*     pStack,
+    CmdStreamChunk* pFirst,
+    CmdStreamChunk* pLast)
+{
+    if (pFirst != nullptr)
+    {
+        uint64 oldHead = 0;
+        uint64 newHead = 0;
+
+        do
+        {
+            oldHead = *pStack;
+            pLast->SetNextStackId(LowPart(oldHead));
+            newHead = (static_cast<uint64>(HighPart(oldHead) + 1) << 32) | pFirst->StackId();
+        }
+        while (AtomicCompareAndSwap64(pStack, oldHead, newHead) != oldHead);
+    }
+}
+
+// =====================================================================================================================
+// Pops the top chunk off of a chunk stack. Returns null if the stack is empty.
+CmdStreamChunk* CmdAllocator::PopChunk(
+    const CmdAllocInfo& allocInfo,
+    ChunkStack*         pStack)
+{
+    CmdStreamChunk* pChunk  = nullptr;
+    uint64          oldHead = 0;
+    uint64          newHead = 0;
+
+    do
+    {
+        oldHead = *pStack;
+        pChunk  = (LowPart(oldHead) != 0) ? LookupChunk(allocInfo, LowPart(oldHead)) : nullptr;
+
         if (pChunk == nullptr)
         {
-            // All busy chunks were still in-use so we must create a new ChunkAllocation. It is possible for this call
-            // to fail in rare circumstances (e.g., out of GPU memory) but we do not expect it to occur.
-            result = CreateAllocation(pAllocInfo, false, &pChunk);
+            break;
         }
+
+        // If another thread pops this chunk before our swap the link we read here may be stale, but the head's tag
+        // will have changed too so the swap will fail and we'll try again.
+        newHead = (static_cast<uint64>(HighPart(oldHead) + 1) << 32) | pChunk->NextStackId();
     }
+    while (AtomicCompareAndSwap64(pStack, oldHead, newHead) != oldHead);
 
-    *ppChunk = pChunk;
-    return result;
+    return pChunk;
+}
+
+// =====================================================================================================================
+// Empties a chunk stack, returning its top chunk. The rest of the chunks remain linked through their next stack IDs.
+CmdStreamChunk* CmdAllocator::PopAllChunks(
+    const CmdAllocInfo& allocInfo,
+    ChunkStack*         pStack)
+{
+    uint64 oldHead = 0;
+
+    do
+    {
+        oldHead = *pStack;
+    }
+    while ((LowPart(oldHead) != 0) &&
+           (AtomicCompareAndSwap64(pStack, oldHead, static_cast<uint64>(HighPart(oldHead) + 1) << 32) != oldHead));
+
+    return (LowPart(oldHead) != 0) ? LookupChunk(allocInfo, LowPart(oldHead)) : nullptr;
 }
 
 // =====================================================================================================================
 // Creates a new command stream allocation and returns one of its chunks for immediate use. If the allocation contains
-// more than one chunk the rest will be pushed onto the free chunk list.
+// more than one chunk the rest will be pushed onto the free chunk stack. The caller must hold the chunk lock.
 Result CmdAllocator::CreateAllocation(
     CmdAllocInfo*    pAllocInfo,
     bool             dummyAlloc,
@@ -585,9 +953,32 @@ Result CmdAllocator::CreateAllocation(
     // that piece of memory
     allocCreateInfo.dummyAllocation = dummyAlloc;
 
-    void*const pPlacementAddr = PAL_MALLOC(CmdStreamAllocation::GetSize(allocCreateInfo),
-                                           m_pDevice->GetPlatform(),
-                                           AllocInternal);
+    // Find (or create) the allocation table slot for the new allocation. We also need every chunk to get a 32-bit
+    // stack ID, which in practice limits us to a few million allocations.
+    const uint32 allocIdx = pAllocInfo->numAllocs;
+    const uint32 segment  = Log2(allocIdx + 1);
+
+    if ((segment >= AllocTableSegmentCount) ||
+        ((static_cast<uint64>(allocIdx + 1) * allocCreateInfo.numChunks) > UINT_MAX))
+    {
+        result = Result::ErrorOutOfMemory;
+    }
+    else if (pAllocInfo->ppAllocTable[segment] == nullptr)
+    {
+        pAllocInfo->ppAllocTable[segment] = static_cast<CmdStreamChunk**>(
+            PAL_MALLOC((1ull << segment) * sizeof(CmdStreamChunk*), m_pDevice->GetPlatform(), AllocInternal));
+
+        if (pAllocInfo->ppAllocTable[segment] == nullptr)
+        {
+            result = Result::ErrorOutOfMemory;
+        }
+    }
+
+    void*const pPlacementAddr = (result == Result::Success)
+                                    ? PAL_MALLOC(CmdStreamAllocation::GetSize(allocCreateInfo),
+                                                 m_pDevice->GetPlatform(),
+                                                 AllocInternal)
+                                    : nullptr;
 
     Util::MutexAuto allocatorLock(m_pDevice->MemMgr()->GetAllocatorLock());
 
@@ -602,13 +993,29 @@ Result CmdAllocator::CreateAllocation(
         pAllocInfo->allocList.PushBack(pAlloc->ListNode());
 
         pChunk = pAlloc->Chunks();
-        for (uint32 idx = 1; idx < allocCreateInfo.numChunks; ++idx)
+        for (uint32 idx = 0; idx < allocCreateInfo.numChunks; ++idx)
         {
-            pAllocInfo->freeList.PushBack(pChunk[idx].ListNode());
+            pChunk[idx].SetStackId((allocIdx * allocCreateInfo.numChunks) + idx + 1);
+
+            if ((idx + 1) < allocCreateInfo.numChunks)
+            {
+                pChunk[idx].SetNextStackId(pChunk[idx].StackId() + 1);
+            }
         }
 
-        // Move the first newly created chunk to the busy list.
-        pAllocInfo->busyList.PushBack(pChunk->ListNode());
+        // The table slot must be written before any of these chunks can be found on a stack.
+        pAllocInfo->ppAllocTable[segment][allocIdx + 1 - (1u << segment)] = pChunk;
+        pAllocInfo->numAllocs++;
+
+        // The first newly created chunk is returned to the caller while the rest go onto the free stack.
+        if (allocCreateInfo.numChunks > 1)
+        {
+            PushChunks(&pAllocInfo->freeStack, &pChunk[1], &pChunk[allocCreateInfo.numChunks - 1]);
+        }
+    }
+    else if (result == Result::Success)
+    {
+        result = Result::ErrorOutOfMemory;
     }
 
     *ppChunk = pChunk;
@@ -43,7 +43,6 @@ class Platform;
 class CmdAllocator : public ICmdAllocator
 {
     typedef Util::IntrusiveList<CmdStreamAllocation>                  AllocList;
-    typedef Util::IntrusiveList<CmdStreamChunk>                       ChunkList;
     typedef Util::IntrusiveList<Util::VirtualLinearAllocatorWithNode> LinearAllocList;
     typedef Util::VectorIterator<CmdStreamChunk*, 16, Platform>       VectorIter;
 
@@ -89,14 +88,29 @@ public:
     uint64 LastPagingFence() const { return m_lastPagingFence; }
 
 private:
+    // A lock-free LIFO of chunks. The low half is the stack ID of the top chunk (or zero if the stack is empty) and the
+    // high half is a tag which is bumped by every update. The tag keeps a pop from succeeding against a head which was
+    // popped and pushed back again while the popping thread was reading the top chunk's link (the ABA problem).
+    typedef volatile uint64 ChunkStack;
+
+    // Allocations are indexed through a segmented table so that stack IDs can be resolved without a lock while other
+    // threads are creating allocations: segment N holds 2^N allocations and never moves once it has been published.
+    static constexpr uint32 AllocTableSegmentCount = 24;
+
     // Helper structure for managing a particular type of command allocator memory.
     struct CmdAllocInfo
     {
-        AllocList allocList; // Unordered list of allocations owned by the allocator.
-        ChunkList freeList;  // Unordered list of chunks that are reset and not in use (busy-tracker indicates idle).
-        ChunkList busyList;  // Unordered list of chunks that might be waiting for their busy-tracker to indicate
-                             // that the GPU has finished processing them.
-        ChunkList reuseList; // Unordered list of chunks that have been 'returned' to the allocator for reuse.
+        AllocList        allocList;   // Unordered list of allocations owned by the allocator.
+        CmdStreamChunk** ppAllocTable[AllocTableSegmentCount]; // Each allocation's chunks, in creation order.
+        uint32           numAllocs;   // Number of allocations in ppAllocTable.
+        ChunkStack       freeStack;   // Chunks that are reset and not in use (busy-tracker indicates idle).
+        ChunkStack       retireStack; // Chunks that have been returned to the allocator but might be waiting for their
+                                      // busy-tracker to indicate that the GPU has finished processing them.
+
+        // Chunk usage statistics which drive trimming. These are only approximate when several threads are recording.
+        volatile uint32  chunksInUse;     // Chunks handed out which haven't made it back to the free stack.
+        uint32           peakChunksInUse; // Largest value of chunksInUse since the last Reset.
+        uint32           trimHighWater;   // Largest value of peakChunksInUse in the current trim interval.
 
         // All allocations for each alloc type are identical, so we can build the create info up-front.
         CmdStreamAllocationCreateInfo allocCreateInfo;
@@ -105,9 +119,23 @@ private:
     // These internal functions are used to manage all types of chunks.
     Result FindFreeChunk(CmdAllocInfo* pAllocInfo, CmdStreamChunk** ppChunk);
     Result CreateAllocation(CmdAllocInfo* pAllocInfo, bool dummyAlloc, CmdStreamChunk** ppChunk);
+    void RetireChunks(CmdAllocInfo* pAllocInfo);
+    void ReclaimAllChunks(CmdAllocInfo* pAllocInfo);
+
+    // These internal functions implement the trimming and adaptive chunk size policies.
+    void SampleStreamSize(CmdAllocType allocType, VectorIter iter);
+    void ApplyAllocPolicy();
+    uint32 ChooseChunkSize(CmdAllocType allocType);
+    void ResizeChunks(CmdAllocInfo* pAllocInfo, uint32 chunkSize);
+    void TrimAllocations(CmdAllocInfo* pAllocInfo, uint32 numAllocsToKeep);
+
+    static CmdStreamChunk* LookupChunk(const CmdAllocInfo& allocInfo, uint32 stackId);
+    static void PushChunks(ChunkStack* pStack, CmdStreamChunk* pFirst, CmdStreamChunk* pLast);
+    static CmdStreamChunk* PopChunk(const CmdAllocInfo& allocInfo, ChunkStack* pStack);
+    static CmdStreamChunk* PopAllChunks(const CmdAllocInfo& allocInfo, ChunkStack* pStack);
 
-    void TransferChunks(ChunkList* pFreeList, ChunkList* pSrcList);
     void FreeAllChunks();
+    void FreeAllocTables();
     void FreeAllLinearAllocators();
 
 #if PAL_ENABLE_PRINTS_ASSERTS
@@ -118,23 +146,33 @@ private:
     {
         struct
         {
-            uint32 autoMemoryReuse :  1; // Indicates that the allocator will automatically recycle idle chunks.
-            uint32 trackBusyChunks :  1; // Indicates that the allocator will track which chunks are idle (for debugging
-                                         // purposes, or for supporting 'autoMemoryReuse').
-            uint32 reserved        : 30;
+            uint32 autoMemoryReuse   :  1; // Indicates that the allocator will automatically recycle idle chunks.
+            uint32 trackBusyChunks   :  1; // Indicates that the allocator will track which chunks are idle (for
+                                           // debugging purposes, or for supporting 'autoMemoryReuse').
+            uint32 adaptiveChunkSize :  1; // Indicates that the allocator picks its own chunk sizes at trim time.
+            uint32 reserved          : 29;
         };
         uint32 u32All;
     }  m_flags;
 
     Device*const    m_pDevice;
 
-    Util::Mutex*    m_pChunkLock;          // If non-null, this protects the allocator's command-chunk state.
+    Util::Mutex*    m_pChunkLock;          // If non-null, this serializes allocation creation and commit logging. The
+                                           // chunk stacks themselves are lock-free.
     CmdAllocInfo    m_gpuAllocInfo[CmdAllocatorTypeCount];
     CmdAllocInfo    m_sysAllocInfo;
 
     // Most-recent paging fence value returned from the OS when allocating command-chunk allocations
     uint64          m_lastPagingFence;
 
+    // Each bin counts the command streams which wrote up to 2^N bytes to chunks of a given type before returning them.
+    // Unlike the commit histograms below these are kept in all builds; they drive the adaptive chunk size policy.
+    static constexpr uint32 StreamSizeBinCount = 32;
+
+    volatile uint32 m_streamSizeHistogram[CmdAllocatorTypeCount][StreamSizeBinCount];
+    uint32          m_minChunkSize[CmdAllocatorTypeCount]; // The client's suballocation sizes.
+    uint32          m_resetsSinceTrim;                     // Resets since the allocation policy was last applied.
+
     Util::Mutex*    m_pLinearAllocLock;    // If non-null, this protects the allocator's linear allocator state.
     LinearAllocList m_linearAllocFreeList; // Unordered list of allocators that are reset and not in use.
     LinearAllocList m_linearAllocBusyList; // Unordered list of allocators that are being used by command buffers.
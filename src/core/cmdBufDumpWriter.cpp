@@ -0,0 +1,560 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#include "core/cmdBufDumpWriter.h"
+#include "core/platform.h"
+#include "palInlineFuncs.h"
+#include "palRingBufferImpl.h"
+#include "palSysMemory.h"
+#include "palVectorImpl.h"
+
+#if PAL_ENABLE_PRINTS_ASSERTS
+
+using namespace Util;
+
+namespace Pal
+{
+
+// Number of submissions which can be in flight between the submitting thread and the writer thread.
+constexpr uint32 NumDumpSlots = 8;
+
+// Maximum uncompressed size of each chunk. LZ4 offsets are limited to 64KB so larger chunks wouldn't compress better.
+constexpr uint32 DumpChunkSize = 64 * 1024;
+
+// Constants which describe the LZ4 block format.
+constexpr uint32 Lz4MinMatch      = 4;   // Shortest encodable match.
+constexpr uint32 Lz4LastLiterals  = 5;   // The last five bytes of a block must be literals.
+constexpr uint32 Lz4MatchLimit    = 12;  // The last match must start at least this many bytes before the block end.
+constexpr uint32 Lz4MaxOffset     = 65535;
+constexpr uint32 Lz4HashLog       = 12;
+constexpr uint32 Lz4HashTableSize = (1 << Lz4HashLog);
+
+// =====================================================================================================================
+static PAL_INLINE uint32 ReadUnaligned32(
+    const uint8* pSrc)
+{
+    uint32 value;
+    memcpy(&value, pSrc, sizeof(value));
+    return value;
+}
+
+// =====================================================================================================================
+static PAL_INLINE uint32 Lz4Hash(
+    uint32 sequence)
+{
+    return ((sequence * 2654435761u) >> (32 - Lz4HashLog));
+}
+
+// =====================================================================================================================
+// Emits an LZ4 length extension: a run of 255s terminated by the remainder.
+static PAL_INLINE uint8* Lz4WriteLength(
+    uint8* pDst,
+    size_t length)
+{
+    for (; length >= 255; length -= 255)
+    {
+        *pDst++ = 255;
+    }
+
+    *pDst++ = static_cast<uint8>(length);
+
+    return pDst;
+}
+
+// =====================================================================================================================
+// Compresses pSrc into a single LZ4 block using a greedy single-probe match finder. This is far from the best ratio
+// LZ4 can achieve, but command buffer dumps are dominated by repeated packet headers and register values, which this
+// catches cheaply. Returns the compressed size, or zero if the block doesn't fit in dstCapacity bytes.
+static size_t Lz4CompressBlock(
+    const uint8* pSrc,
+    size_t       srcSize,
+    uint8*       pDst,
+    size_t       dstCapacity,
+    uint32*      pHashTable)
+{
+    const uint8*const pSrcEnd = pSrc + srcSize;
+    const uint8*const pDstEnd = pDst + dstCapacity;
+    const uint8*      pAnchor = pSrc;
+    uint8*            pOut    = pDst;
+    bool              fits    = true;
+
+    if (srcSize > Lz4MatchLimit)
+    {
+        const uint8*const pMatchStartLimit = pSrcEnd - Lz4MatchLimit;
+        const uint8*const pMatchEndLimit   = pSrcEnd - Lz4LastLiterals;
+
+        memset(pHashTable, 0, sizeof(uint32) * Lz4HashTableSize);
+
+        const uint8* pIn = pSrc;
+        while (fits && (pIn < pMatchStartLimit))
+        {
+            const uint32       sequence = ReadUnaligned32(pIn);
+            const uint32       hash     = Lz4Hash(sequence);
+            const uint8*       pRef     = pSrc + pHashTable[hash];
+
+            pHashTable[hash] = static_cast<uint32>(pIn - pSrc);
+
+            if ((pRef < pIn) && ((pIn - pRef) <= Lz4MaxOffset) && (ReadUnaligned32(pRef) == sequence))
+            {
+                const uint8* pMatchEnd = pIn + Lz4MinMatch;
+                for (pRef += Lz4MinMatch; (pMatchEnd < pMatchEndLimit) && (*pMatchEnd == *pRef); ++pRef)
+                {
+                    ++pMatchEnd;
+                }
+
+                const size_t literalLength = (pIn - pAnchor);
+                const size_t matchCode     = (pMatchEnd - pIn) - Lz4MinMatch;
+                const size_t worstCaseSize = 1 + (literalLength / 255) + 1 + literalLength + 2 + (matchCode / 255) + 1;
+
+                if ((pOut + worstCaseSize) <= pDstEnd)
+                {
+                    uint8*const pToken = pOut++;
+                    *pToken = static_cast<uint8>(Min<size_t>(literalLength, 15) << 4);
+                    if (literalLength >= 15)
+                    {
+                        pOut = Lz4WriteLength(pOut, literalLength - 15);
+                    }
+
+                    memcpy(pOut, pAnchor, literalLength);
+                    pOut += literalLength;
+
+                    const uint32 offset = static_cast<uint32>(pMatchEnd - pRef);
+                    *pOut++ = static_cast<uint8>(offset & 0xFF);
+                    *pOut++ = static_cast<uint8>(offset >> 8);
+
+                    *pToken |= static_cast<uint8>(Min<size_t>(matchCode, 15));
+                    if (matchCode >= 15)
+                    {
+                        pOut = Lz4WriteLength(pOut, matchCode - 15);
+                    }
+
+                    pIn     = pMatchEnd;
+                    pAnchor = pIn;
+                }
+                else
+                {
+                    fits = false;
+                }
+            }
+            else
+            {
+                ++pIn;
+            }
+        }
+    }
+
+    if (fits)
+    {
+        // The block always ends with a literal-only sequence.
+        const size_t literalLength = (pSrcEnd - pAnchor);
+
+        if ((pOut + 1 + (literalLength / 255) + 1 + literalLength) <= pDstEnd)
+        {
+            *pOut++ = static_cast<uint8>(Min<size_t>(literalLength, 15) << 4);
+            if (literalLength >= 15)
+            {
+                pOut = Lz4WriteLength(pOut, literalLength - 15);
+            }
+
+            memcpy(pOut, pAnchor, literalLength);
+            pOut += literalLength;
+        }
+        else
+        {
+            fits = false;
+        }
+    }
+
+    return fits ? static_cast<size_t>(pOut - pDst) : 0;
+}
+
+// =====================================================================================================================
+// Appends data to the file or memory buffer behind this stream. Memory buffers grow geometrically as needed.
+Result CmdBufDumpStream::Write(
+    const void* pData,
+    size_t      dataSize)
+{
+    Result result = Result::Success;
+
+    if (m_pFile != nullptr)
+    {
+        result = m_pFile->Write(pData, dataSize);
+    }
+    else
+    {
+        const size_t requiredSize = m_pBuffer->size + dataSize;
+
+        if (requiredSize > m_pBuffer->capacity)
+        {
+            const size_t newCapacity = Max(requiredSize, Max<size_t>(m_pBuffer->capacity * 2, DumpChunkSize));
+            void*const   pNewData    = PAL_MALLOC(newCapacity, m_pPlatform, AllocInternal);
+
+            if (pNewData != nullptr)
+            {
+                if (m_pBuffer->size > 0)
+                {
+                    memcpy(pNewData, m_pBuffer->pData, m_pBuffer->size);
+                }
+
+                PAL_SAFE_FREE(m_pBuffer->pData, m_pPlatform);
+                m_pBuffer->pData    = pNewData;
+                m_pBuffer->capacity = newCapacity;
+            }
+            else
+            {
+                result = Result::ErrorOutOfMemory;
+            }
+        }
+
+        if (result == Result::Success)
+        {
+            memcpy(VoidPtrInc(m_pBuffer->pData, m_pBuffer->size), pData, dataSize);
+            m_pBuffer->size = requiredSize;
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+CmdBufDumpWriter::CmdBufDumpWriter(
+    Platform* pPlatform)
+    :
+    m_pPlatform(pPlatform),
+    m_fileOffset(0),
+    m_chunkSize(DumpChunkSize),
+    m_ring(NumDumpSlots, sizeof(DumpSlot), pPlatform),
+    m_ringValid(false),
+    m_pActiveSlot(nullptr),
+    m_writerActive(false),
+    m_pScratch(nullptr),
+    m_scratchSize(0),
+    m_pHashTable(nullptr),
+    m_index(pPlatform)
+{
+}
+
+// =====================================================================================================================
+CmdBufDumpWriter::~CmdBufDumpWriter()
+{
+    // Flush all pending records and shut down the writer thread before touching anything it owns.
+    if (m_writerActive)
+    {
+        PAL_ASSERT(m_writerThread.IsNotCurrentThread());
+        PAL_ASSERT(m_pActiveSlot == nullptr);
+
+        void* pBuffer = nullptr;
+        if (m_ring.GetBufferForWriting(UINT32_MAX, &pBuffer) == Result::Success)
+        {
+            static_cast<DumpSlot*>(pBuffer)->terminate = true;
+            m_ring.ReleaseWriteBuffer();
+
+            m_writerThread.Join();
+        }
+        else
+        {
+            // We failed to queue a terminate request so the writer thread isn't going to terminate.
+            PAL_ASSERT_ALWAYS();
+        }
+    }
+
+    if (m_file.IsOpen())
+    {
+        WriteIndex();
+        m_file.Close();
+    }
+
+    if (m_ringValid)
+    {
+        m_ring.Destroy(&DestroySlot, this);
+    }
+
+    PAL_SAFE_FREE(m_pScratch, m_pPlatform);
+    PAL_SAFE_FREE(m_pHashTable, m_pPlatform);
+}
+
+// =====================================================================================================================
+// Creates the container file, writes its header and launches the writer thread. The caller only needs to fill out the
+// fields of the header which identify the GPU, queue and dump mode.
+Result CmdBufDumpWriter::Init(
+    const char*                      pFilename,
+    const CmdBufDumpContainerHeader& queueInfo)
+{
+    CmdBufDumpContainerHeader header = queueInfo;
+    header.magic     = CmdBufDumpContainerMagic;
+    header.size      = static_cast<uint32>(sizeof(CmdBufDumpContainerHeader));
+    header.version   = CmdBufDumpContainerVersion;
+    header.chunkSize = m_chunkSize;
+
+    Result result = m_file.Open(pFilename, FileAccessMode::FileAccessWrite | FileAccessMode::FileAccessBinary);
+
+    if (result == Result::Success)
+    {
+        result = m_file.Write(&header, sizeof(header));
+        m_fileOffset = sizeof(header);
+    }
+
+    if (result == Result::Success)
+    {
+        m_pHashTable = static_cast<uint32*>(PAL_MALLOC(sizeof(uint32) * Lz4HashTableSize,
+                                                       m_pPlatform,
+                                                       AllocInternal));
+
+        result = (m_pHashTable != nullptr) ? Result::Success : Result::ErrorOutOfMemory;
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_ring.Init(&InitSlot, this);
+
+        if (result == Result::Success)
+        {
+            m_ringValid = true;
+        }
+        else
+        {
+            // The slots may not have been initialized, so only free the ring's storage.
+            m_ring.Destroy(nullptr, nullptr);
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        result         = m_writerThread.Begin(&WriterThreadCallback, this);
+        m_writerActive = m_writerThread.IsCreated();
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+CmdBufDumpBuffer* CmdBufDumpWriter::BeginRecord(
+    uint32 frame,
+    uint32 submitId)
+{
+    PAL_ASSERT(m_pActiveSlot == nullptr);
+
+    CmdBufDumpBuffer* pBuffer = nullptr;
+    void*             pSlot   = nullptr;
+
+    if (m_writerActive && (m_ring.GetBufferForWriting(UINT32_MAX, &pSlot) == Result::Success))
+    {
+        m_pActiveSlot = static_cast<DumpSlot*>(pSlot);
+
+        m_pActiveSlot->terminate   = false;
+        m_pActiveSlot->frame       = frame;
+        m_pActiveSlot->submitId    = submitId;
+        m_pActiveSlot->buffer.size = 0;
+
+        pBuffer = &m_pActiveSlot->buffer;
+    }
+
+    return pBuffer;
+}
+
+// =====================================================================================================================
+// Hands the slot filled since BeginRecord() off to the writer thread.
+void CmdBufDumpWriter::EndRecord()
+{
+    PAL_ASSERT(m_pActiveSlot != nullptr);
+
+    m_pActiveSlot = nullptr;
+    m_ring.ReleaseWriteBuffer();
+}
+
+// =====================================================================================================================
+bool PAL_STDCALL CmdBufDumpWriter::InitSlot(
+    uint32 slotIdx,
+    void*  pData,
+    void*  pBuffer)
+{
+    memset(pBuffer, 0, sizeof(DumpSlot));
+
+    return true;
+}
+
+// =====================================================================================================================
+bool PAL_STDCALL CmdBufDumpWriter::DestroySlot(
+    uint32 slotIdx,
+    void*  pData,
+    void*  pBuffer)
+{
+    CmdBufDumpWriter*const pThis = static_cast<CmdBufDumpWriter*>(pData);
+    DumpSlot*const         pSlot = static_cast<DumpSlot*>(pBuffer);
+
+    PAL_SAFE_FREE(pSlot->buffer.pData, pThis->m_pPlatform);
+
+    return true;
+}
+
+// =====================================================================================================================
+void CmdBufDumpWriter::WriterThreadCallback(
+    void* pParam)
+{
+    static_cast<CmdBufDumpWriter*>(pParam)->RunWriterThread();
+}
+
+// =====================================================================================================================
+// The writer thread's main loop: drains the ring in submission order until asked to terminate.
+void CmdBufDumpWriter::RunWriterThread()
+{
+    bool terminate = false;
+
+    while (terminate == false)
+    {
+        const void* pBuffer = nullptr;
+
+        if (m_ring.GetBufferForReading(UINT32_MAX, &pBuffer) == Result::Success)
+        {
+            const DumpSlot& slot = *static_cast<const DumpSlot*>(pBuffer);
+
+            if (slot.terminate)
+            {
+                terminate = true;
+            }
+            else if (slot.buffer.size > 0)
+            {
+                WriteRecord(slot);
+            }
+
+            m_ring.ReleaseReadBuffer();
+        }
+    }
+}
+
+// =====================================================================================================================
+// Compresses one captured submission chunk by chunk and appends it to the container as a single record.
+void CmdBufDumpWriter::WriteRecord(
+    const DumpSlot& slot)
+{
+    const size_t rawSize   = slot.buffer.size;
+    const uint32 numChunks = static_cast<uint32>(RoundUpQuotient(rawSize, static_cast<size_t>(m_chunkSize)));
+
+    // Chunks are never stored larger than their uncompressed size, which bounds the staging memory we need.
+    const size_t worstCaseSize = rawSize + (numChunks * sizeof(CmdBufDumpChunkHeader));
+
+    Result result = Result::Success;
+
+    if (worstCaseSize > m_scratchSize)
+    {
+        PAL_SAFE_FREE(m_pScratch, m_pPlatform);
+
+        m_pScratch    = PAL_MALLOC(worstCaseSize, m_pPlatform, AllocInternal);
+        m_scratchSize = (m_pScratch != nullptr) ? worstCaseSize : 0;
+        result        = (m_pScratch != nullptr) ? Result::Success : Result::ErrorOutOfMemory;
+    }
+
+    if (result == Result::Success)
+    {
+        const uint8* pSrc       = static_cast<const uint8*>(slot.buffer.pData);
+        uint8*       pDst       = static_cast<uint8*>(m_pScratch);
+        size_t       storedSize = 0;
+
+        for (size_t offset = 0; offset < rawSize; offset += m_chunkSize)
+        {
+            CmdBufDumpChunkHeader chunkHeader = {};
+            chunkHeader.rawSize = static_cast<uint32>(Min(rawSize - offset, static_cast<size_t>(m_chunkSize)));
+
+            uint8*const pChunkData = pDst + storedSize + sizeof(chunkHeader);
+
+            // Leave the chunk uncompressed unless compression actually saves space.
+            size_t chunkSize = Lz4CompressBlock(pSrc + offset,
+                                                chunkHeader.rawSize,
+                                                pChunkData,
+                                                chunkHeader.rawSize - 1,
+                                                m_pHashTable);
+            if (chunkSize == 0)
+            {
+                memcpy(pChunkData, pSrc + offset, chunkHeader.rawSize);
+                chunkSize = chunkHeader.rawSize;
+            }
+
+            chunkHeader.storedSize = static_cast<uint32>(chunkSize);
+            memcpy(pDst + storedSize, &chunkHeader, sizeof(chunkHeader));
+
+            storedSize += sizeof(chunkHeader) + chunkSize;
+        }
+
+        CmdBufDumpRecordHeader recordHeader = {};
+        recordHeader.magic      = CmdBufDumpRecordMagic;
+        recordHeader.frame      = slot.frame;
+        recordHeader.submitId   = slot.submitId;
+        recordHeader.numChunks  = numChunks;
+        recordHeader.rawSize    = rawSize;
+        recordHeader.storedSize = storedSize;
+
+        const CmdBufDumpIndexEntry entry = { slot.frame, slot.submitId, m_fileOffset };
+
+        result = m_file.Write(&recordHeader, sizeof(recordHeader));
+
+        if (result == Result::Success)
+        {
+            result = m_file.Write(m_pScratch, storedSize);
+        }
+
+        if (result == Result::Success)
+        {
+            m_fileOffset += sizeof(recordHeader) + storedSize;
+
+            // Losing an index entry isn't fatal; the record can still be found by walking the container.
+            const Result indexResult = m_index.PushBack(entry);
+            PAL_ALERT(indexResult != Result::Success);
+        }
+    }
+
+    // Don't bother returning an error if the record wasn't written correctly as we don't want this to affect
+    // operation of the "important" stuff...  but still make it apparent that the dump file isn't accurate.
+    PAL_ALERT(result != Result::Success);
+}
+
+// =====================================================================================================================
+// Appends the record index and the footer which locates it. Must only be called once the writer thread has exited.
+void CmdBufDumpWriter::WriteIndex()
+{
+    PAL_ASSERT(m_writerThread.IsNotCurrentThread());
+
+    CmdBufDumpIndexFooter footer = {};
+    footer.magic       = CmdBufDumpIndexMagic;
+    footer.numEntries  = m_index.NumElements();
+    footer.indexOffset = m_fileOffset;
+
+    Result result = Result::Success;
+
+    if (footer.numEntries > 0)
+    {
+        result = m_file.Write(&m_index.Front(), footer.numEntries * sizeof(CmdBufDumpIndexEntry));
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_file.Write(&footer, sizeof(footer));
+    }
+
+    PAL_ALERT(result != Result::Success);
+}
+
+} // Pal
+
+#endif
@@ -0,0 +1,211 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#pragma once
+
+#include "pal.h"
+#include "palFile.h"
+#include "palRingBuffer.h"
+#include "palThread.h"
+#include "palVector.h"
+
+#if PAL_ENABLE_PRINTS_ASSERTS
+
+namespace Pal
+{
+
+class Platform;
+
+// The following structures describe the streaming command buffer dump container written by CmdBufDumpWriter.
+//
+// Rather than producing one file per submission, each Queue appends all of its submit-time dumps to a single file:
+//
+//    * First comes a header (CmdBufDumpContainerHeader) which identifies the GPU, the queue and the dump mode.
+//    * Next comes one record per dumped submission. Each record starts with a CmdBufDumpRecordHeader followed by
+//      "numChunks" chunks. Each chunk starts with a CmdBufDumpChunkHeader followed by "storedSize" bytes of data.
+//      If "storedSize" is smaller than "rawSize" the data is an LZ4 block, otherwise the data is stored uncompressed.
+//      Concatenating the decompressed chunks of a record yields exactly what the per-submission dump file would have
+//      contained in the same dump mode.
+//    * When the Queue is destroyed, an array of CmdBufDumpIndexEntry structures is appended followed by a
+//      CmdBufDumpIndexFooter. The footer is optional: a truncated container can still be parsed by walking records.
+
+constexpr uint32 CmdBufDumpContainerMagic   = 0x44424350; // 'PCBD'
+constexpr uint32 CmdBufDumpRecordMagic      = 0x52424350; // 'PCBR'
+constexpr uint32 CmdBufDumpIndexMagic       = 0x49424350; // 'PCBI'
+constexpr uint32 CmdBufDumpContainerVersion = 1;
+
+// Structure defining the top of a command buffer dump container.
+struct CmdBufDumpContainerHeader
+{
+    uint32      magic;              // Must be CmdBufDumpContainerMagic.
+    uint32      size;               // Size of this structure in bytes.
+    uint32      version;            // Container version. Should be CmdBufDumpContainerVersion.
+    uint32      asicFamily;         // ASIC family
+    uint32      deviceId;           // PCI device ID
+    uint32      queueType;          // QueueType of the queue which owns this container.
+    uint32      engineType;         // EngineType of the queue which owns this container.
+    uint32      engineIndex;        // Engine index of the queue which owns this container.
+    uint32      dumpMode;           // CmdBufDumpMode used for every record in this container.
+    uint32      chunkSize;          // Maximum number of uncompressed bytes in each chunk.
+};
+
+// Structure defining the header of each dumped submission.
+struct CmdBufDumpRecordHeader
+{
+    uint32      magic;              // Must be CmdBufDumpRecordMagic.
+    uint32      frame;              // Frame in which the submission occurred.
+    uint32      submitId;           // The Nth submission of the frame on this queue.
+    uint32      numChunks;          // Number of chunks that follow.
+    uint64      rawSize;            // Uncompressed size of the record's data in bytes.
+    uint64      storedSize;         // Size of the chunks that follow (including their headers) in bytes.
+};
+
+// Structure defining the header of each chunk of a record.
+struct CmdBufDumpChunkHeader
+{
+    uint32      rawSize;            // Uncompressed size of this chunk in bytes.
+    uint32      storedSize;         // Size of the chunk data in bytes. Equal to rawSize if stored uncompressed.
+};
+
+// Structure locating one record in the container.
+struct CmdBufDumpIndexEntry
+{
+    uint32      frame;              // Frame in which the submission occurred.
+    uint32      submitId;           // The Nth submission of the frame on this queue.
+    uint64      offset;             // Byte offset of the record header from the start of the file.
+};
+
+// Structure defining the very end of a complete container.
+struct CmdBufDumpIndexFooter
+{
+    uint32      magic;              // Must be CmdBufDumpIndexMagic.
+    uint32      numEntries;         // Number of CmdBufDumpIndexEntry structures which precede this footer.
+    uint64      indexOffset;        // Byte offset of the first CmdBufDumpIndexEntry from the start of the file.
+};
+
+// Growable system memory buffer which receives the dump of a single submission.
+struct CmdBufDumpBuffer
+{
+    void*       pData;              // Buffer memory, owned by the CmdBufDumpWriter.
+    size_t      capacity;           // Size of the allocation behind pData in bytes.
+    size_t      size;               // Number of valid bytes in pData.
+};
+
+// =====================================================================================================================
+// Destination for command buffer dump data. A stream either writes straight through to a file (record-time dumps and
+// synchronous submit-time dumps) or appends to a CmdBufDumpBuffer which is later handed off to a CmdBufDumpWriter.
+class CmdBufDumpStream
+{
+public:
+    explicit CmdBufDumpStream(Util::File* pFile)
+        :
+        m_pFile(pFile),
+        m_pPlatform(nullptr),
+        m_pBuffer(nullptr)
+        { }
+
+    CmdBufDumpStream(Platform* pPlatform, CmdBufDumpBuffer* pBuffer)
+        :
+        m_pFile(nullptr),
+        m_pPlatform(pPlatform),
+        m_pBuffer(pBuffer)
+        { }
+
+    Result Write(const void* pData, size_t dataSize);
+
+private:
+    Util::File*const       m_pFile;
+    Platform*const         m_pPlatform;
+    CmdBufDumpBuffer*const m_pBuffer;
+
+    PAL_DISALLOW_DEFAULT_CTOR(CmdBufDumpStream);
+    PAL_DISALLOW_COPY_AND_ASSIGN(CmdBufDumpStream);
+};
+
+// =====================================================================================================================
+// Writes submit-time command buffer dumps to a single chunk-compressed container file on a background thread.
+//
+// The submitting thread captures each submission into a system memory buffer owned by one slot of a ring buffer; the
+// writer thread compresses the slot's contents and appends them to the container. This keeps file I/O and compression
+// off of the submission path. Slot buffers are kept around between submissions, so a steady stream of dumps doesn't
+// allocate any memory. The producer side is not thread-safe: it must be externally synchronized like Queue::Submit().
+class CmdBufDumpWriter
+{
+public:
+    explicit CmdBufDumpWriter(Platform* pPlatform);
+    ~CmdBufDumpWriter();
+
+    Result Init(const char* pFilename, const CmdBufDumpContainerHeader& queueInfo);
+
+    // Reserves the next slot of the ring, waiting for the writer thread if all slots are in flight. Returns the
+    // slot's empty buffer, or null if the writer is unusable. Every successful call must be paired with EndRecord().
+    CmdBufDumpBuffer* BeginRecord(uint32 frame, uint32 submitId);
+    void EndRecord();
+
+    Platform* GetPlatform() const { return m_pPlatform; }
+
+private:
+    // Each slot in the ring buffer is one of these.
+    struct DumpSlot
+    {
+        bool             terminate;     // If set, the writer thread should exit instead of writing a record.
+        uint32           frame;
+        uint32           submitId;
+        CmdBufDumpBuffer buffer;
+    };
+
+    static bool PAL_STDCALL InitSlot(uint32 slotIdx, void* pData, void* pBuffer);
+    static bool PAL_STDCALL DestroySlot(uint32 slotIdx, void* pData, void* pBuffer);
+
+    static void WriterThreadCallback(void* pParam);
+    void RunWriterThread();
+    void WriteRecord(const DumpSlot& slot);
+    void WriteIndex();
+
+    Platform*const              m_pPlatform;
+    Util::File                  m_file;           // The container file.
+    uint64                      m_fileOffset;     // Current size of the container file in bytes.
+    uint32                      m_chunkSize;      // Maximum uncompressed size of each chunk.
+
+    Util::RingBuffer<Platform>  m_ring;           // Ring of DumpSlot structures.
+    bool                        m_ringValid;      // True once the ring has been successfully initialized.
+    DumpSlot*                   m_pActiveSlot;    // Slot currently being filled by the submitting thread.
+
+    Util::Thread                m_writerThread;
+    bool                        m_writerActive;   // True if the writer thread must be terminated by our destructor.
+
+    // The following are only touched by the writer thread until it has been joined.
+    void*                       m_pScratch;       // Staging buffer for the compressed chunks of a record.
+    size_t                      m_scratchSize;
+    uint32*                     m_pHashTable;     // Match finder state for the compressor.
+    Util::Vector<CmdBufDumpIndexEntry, 64, Platform> m_index;
+
+    PAL_DISALLOW_DEFAULT_CTOR(CmdBufDumpWriter);
+    PAL_DISALLOW_COPY_AND_ASSIGN(CmdBufDumpWriter);
+};
+
+} // Pal
+
+#endif
@@ -38,6 +38,7 @@ namespace Util { class VirtualLinearAllocator; }
 namespace Pal
 {
 
+class      CmdBufDumpStream;
 class      CmdStream;
 enum class ShaderType : uint32;
 
@@ -744,7 +745,7 @@ public:
 
 #if PAL_ENABLE_PRINTS_ASSERTS
     // This function allows us to dump the contents of this command buffer to a file at submission time.
-    virtual void DumpCmdStreamsToFile(Util::File* pFile, CmdBufDumpMode mode) const = 0;
+    virtual void DumpCmdStreamsToFile(CmdBufDumpStream* pStream, CmdBufDumpMode mode) const = 0;
 
     // This function gets the directory from device settings and dump the file to the right directory.
     void OpenCmdBufDumpFile(const char* pFilename);
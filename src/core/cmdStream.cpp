@@ -23,14 +23,15 @@
  ******************************************************************************/
 
 #include "core/cmdAllocator.h"
+#include "core/cmdBufDumpWriter.h"
 #include "core/cmdStream.h"
 #include "core/device.h"
 #include "core/fence.h"
 #include "core/g_palSettings.h"
 #include "core/queue.h"
 #include "palFile.h"
-#include "palHashMapImpl.h"
 #include "palLinearAllocator.h"
+#include "palSwissHashMapImpl.h"
 #include "palVectorImpl.h"
 
 using namespace Util;
@@ -664,14 +665,15 @@ gpusize CmdStream::GetCurrentGpuVa()
 
 #if PAL_ENABLE_PRINTS_ASSERTS
 // =====================================================================================================================
-// Saves all the command data associated with this stream to the file pointed to by pFile.
+// Saves all the command data associated with this stream to the dump stream pointed to by pStream.
 //
-// It is the callers responsibility to verify that pFile is pointing to an open file. "pHeader" should point to a
-// string of the format "text = ". It will be appended with the number of DWORDs associated with this stream.
+// It is the callers responsibility to verify that pStream is pointing to an open file or a dump buffer. "pHeader"
+// should point to a string of the format "text = ". It will be appended with the number of DWORDs associated with this
+// stream.
 void CmdStream::DumpCommands(
-    File*          pFile,          // [in] pointer to an opened file object
-    const char*    pHeader,        // [in] pointer to a string that contains header info
-    CmdBufDumpMode mode            // [in] true if it's binary dump requested
+    CmdBufDumpStream* pStream,     // [in] pointer to an opened dump stream
+    const char*       pHeader,     // [in] pointer to a string that contains header info
+    CmdBufDumpMode    mode         // [in] true if it's binary dump requested
     ) const
 {
     Result result = Result::Success;
@@ -692,7 +694,7 @@ void CmdStream::DumpCommands(
         char line[MaxLineSize];
 
         Snprintf(line, MaxLineSize, "%s%llu\n", pHeader, streamSizeInDwords);
-        result = pFile->Write(line, strlen(line));
+        result = pStream->Write(line, strlen(line));
     }
 
     uint32 subEngineId = 0; // DE subengine ID
@@ -710,7 +712,7 @@ void CmdStream::DumpCommands(
     // Next, walk through all the chunks that make up this command stream and write their command to the file.
     for (auto iter = m_chunkList.Begin(); iter.IsValid() && (result == Result::Success); iter.Next())
     {
-        result = iter.Get()->WriteCommandsToFile(pFile, subEngineId, mode);
+        result = iter.Get()->WriteCommandsToFile(pStream, subEngineId, mode);
     }
 
     // Don't bother returning an error if the command stream wasn't dumped correctly as we don't want this to affect
@@ -26,12 +26,11 @@
 
 #include "core/cmdStreamAllocation.h"
 #include "core/platform.h"
-#include "palHashMap.h"
 #include "palIntrusiveList.h"
+#include "palSwissHashMap.h"
 #include "palVector.h"
 #include "g_palSettings.h"
 
-namespace Util { class File; }
 namespace Util { class VirtualLinearAllocator; }
 
 namespace Pal
@@ -39,6 +38,7 @@ namespace Pal
 
 // Forward declarations:
 class CmdAllocator;
+class CmdBufDumpStream;
 class Device;
 class GpuMemoryPatchList;
 class ICmdAllocator;
@@ -141,8 +141,9 @@ class CmdStream
     // A useful shorthand for a vector list of chunks.
     typedef ChunkVector<CmdStreamChunk*, 16, Platform> ChunkRefList;
 
-    // A useful shorthand for a hash map of nested command buffer chunk execute-counts.
-    typedef Util::HashMap<CmdStreamChunk*, NestedChunkData, Platform> NestedChunkMap;
+    // A useful shorthand for a hash map of nested command buffer chunk execute-counts.  This map is lookup-dominated,
+    // so it uses the SIMD-probed variant of HashMap.
+    typedef Util::SwissHashMap<CmdStreamChunk*, NestedChunkData, Platform> NestedChunkMap;
 
 public:
     CmdStream(
@@ -216,7 +217,7 @@ public:
     uint32 GetSizeAlignDwords() const { return m_sizeAlignDwords; }
 
 #if PAL_ENABLE_PRINTS_ASSERTS
-    void DumpCommands(Util::File* pFile, const char* pHeader, CmdBufDumpMode mode) const;
+    void DumpCommands(CmdBufDumpStream* pStream, const char* pHeader, CmdBufDumpMode mode) const;
 #endif
 
     void EnableDropIfSameContext(bool enable) { m_flags.dropIfSameContext = enable; }
@@ -27,6 +27,7 @@
 #include "core/internalMemMgr.h"
 #include "core/platform.h"
 #include "core/cmdBuffer.h"
+#include "core/cmdBufDumpWriter.h"
 #include "palFile.h"
 #include "palIntrusiveListImpl.h"
 #include "palSysMemory.h"
@@ -197,7 +198,8 @@ CmdStreamChunk::CmdStreamChunk(
     gpusize                    byteOffset)
     :
     m_allocation(allocation),
-    m_parentNode(this),
+    m_stackId(0),
+    m_nextStackId(0),
     m_pCpuAddr(pCpuAddr),
     m_pWriteAddr(pWriteAddr),
     m_offset(byteOffset),
@@ -462,11 +464,12 @@ bool CmdStreamChunk::ContainsAddress(
 
 #if PAL_ENABLE_PRINTS_ASSERTS
 // =====================================================================================================================
-// Writes the commands in this chunk to the given file. Each DWORD is expressed in hex and printed on its own line.
+// Writes the commands in this chunk to the given dump stream. Each DWORD is expressed in hex and printed on its own
+// line.
 Result CmdStreamChunk::WriteCommandsToFile(
-    File*          pFile,
-    uint32         subEngineId,
-    CmdBufDumpMode mode
+    CmdBufDumpStream* pStream,
+    uint32            subEngineId,
+    CmdBufDumpMode    mode
     ) const
 {
     Result result = Result::Success;
@@ -482,9 +485,9 @@ Result CmdStreamChunk::WriteCommandsToFile(
                 m_usedDataSizeDwords * static_cast<uint32>(sizeof(uint32)),
                 subEngineId
             };
-            pFile->Write(&chunkheader, sizeof(chunkheader));
+            pStream->Write(&chunkheader, sizeof(chunkheader));
         }
-        pFile->Write(m_pWriteAddr, m_usedDataSizeDwords * sizeof(uint32));
+        pStream->Write(m_pWriteAddr, m_usedDataSizeDwords * sizeof(uint32));
     }
     else
     {
@@ -496,7 +499,7 @@ Result CmdStreamChunk::WriteCommandsToFile(
         for (uint32 idx = 0; (idx < m_usedDataSizeDwords) && (result == Result::Success); ++idx)
         {
             Snprintf(line, MaxLineSize, "0x%08x\n", m_pWriteAddr[idx]);
-            result = pFile->Write(line, strlen(line));
+            result = pStream->Write(line, strlen(line));
         }
     }
 
@@ -31,11 +31,10 @@
 #include "palMutex.h"
 #include "palVector.h"
 
-namespace Util { class File; }
-
 namespace Pal
 {
 // Forward declarations
+class CmdBufDumpStream;
 class CmdStreamChunk;
 class Device;
 class Platform;
@@ -113,8 +112,6 @@ private:
 // command space for a block.
 class CmdStreamChunk
 {
-    typedef Util::IntrusiveList<CmdStreamChunk> ChunkList;
-
 public:
     CmdStreamChunk(const CmdStreamAllocation& allocation, uint32* pCpuAddr, uint32* pWriteAddr, gpusize byteOffset);
 
@@ -139,7 +136,12 @@ public:
 
     void IncrementSubmitCount(uint32 count = 1) { Util::AtomicAdd(&m_busyTracker.submitCount, count); }
 
-    ChunkList::Node* ListNode() { return &m_parentNode; }
+    // The parent CmdAllocator links free and retired chunks into lock-free stacks by ID rather than by pointer so that
+    // each stack head can carry an ABA tag in a single 64-bit word. Zero is never a valid ID.
+    uint32 StackId() const                 { return m_stackId; }
+    void   SetStackId(uint32 stackId)      { m_stackId = stackId; }
+    uint32 NextStackId() const             { return m_nextStackId; }
+    void   SetNextStackId(uint32 stackId)  { m_nextStackId = stackId; }
 
     const uint32* PeekNextCommandAddr() const { return &m_pWriteAddr[m_usedDataSizeDwords]; }
 
@@ -185,7 +187,7 @@ public:
     bool ContainsAddress(const uint32* pAddress) const;
 
 #if PAL_ENABLE_PRINTS_ASSERTS
-    Result WriteCommandsToFile(Util::File* pFile, uint32 subEngineId, CmdBufDumpMode mode) const;
+    Result WriteCommandsToFile(CmdBufDumpStream* pStream, uint32 subEngineId, CmdBufDumpMode mode) const;
 #endif
 
     // We need these intrusive getters so that we can apply the PM4 optimizer during finalization (and other things).
@@ -203,7 +205,8 @@ private:
 
     const CmdStreamAllocation& m_allocation; // This chunk is a section of this allocation.
 
-    ChunkList::Node m_parentNode;  // This chunk should always be owned by exactly one list using this node.
+    uint32          m_stackId;     // This chunk's ID within its parent CmdAllocator.
+    volatile uint32 m_nextStackId; // ID of the next chunk in the allocator stack holding this chunk, or zero.
     uint32*const    m_pCpuAddr;    // CPU virtual address of the allocation.
     uint32*const    m_pWriteAddr;  // All commands and embedded data must be written to this buffer. If this pointer
                                    // isn't equal to m_pCpuAddr then it points to a system memory staging buffer.
@@ -216,9 +219,9 @@ private:
     volatile uint32  m_referenceCount;
 
     // Each time a chunk is reset its generation is incremented. The busy tracker looks at its root chunk's generation
-    // to determine if it has been reset, implying that the root (and thus the local chunk) was idle on the GPU. This
-    // counter doesn't need to be volatile because it is only accessed within the allocator's thread-safe logic.
-    uint32 m_generation;
+    // to determine if it has been reset, implying that the root (and thus the local chunk) was idle on the GPU. Only
+    // the thread which currently owns this chunk resets it, but other threads may read it while retiring chunks.
+    volatile uint32 m_generation;
 
     struct
     {
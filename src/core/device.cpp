@@ -1319,6 +1319,13 @@ Result Device::Finalize(
         result = CreateEngines(finalizeInfo);
     }
 
+#if PAL_BUILD_GFX
+    if ((result == Result::Success) && (m_pGfxDevice != nullptr))
+    {
+        result = m_pGfxDevice->CreatePipelineUploadRing();
+    }
+#endif
+
 #if PAL_BUILD_GPUOPEN
     // If developer mode is enabled we need to initialize some internal resources.
     if ((result == Result::Success) && m_pPlatform->IsDeveloperModeEnabled())
@@ -3204,6 +3211,37 @@ Result Device::CreateInternalDepthStencilView(
         Result::ErrorUnavailable;
 }
 
+// =====================================================================================================================
+// Creates and initializes a new compute pipeline.
+Result Device::CreateComputePipeline(
+    const ComputePipelineCreateInfo& createInfo,
+    void*                            pPlacementAddr,
+    IPipeline**                      ppPipeline)
+{
+    Result result = Result::ErrorUnavailable;
+
+    if (m_pGfxDevice != nullptr)
+    {
+        // Only sample the clock when profiling so that pipeline creation doesn't pay for it otherwise.
+        PipelineCreateProfiler*const pProfiler = m_pGfxDevice->GetPipelineCreateProfiler();
+        const int64                  startTime = pProfiler->IsEnabled() ? GetPerfCpuTime() : 0;
+
+        result = m_pGfxDevice->CreateComputePipeline(createInfo, pPlacementAddr,
+#if (PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 309)
+                                                     createInfo.flags.clientInternal, ppPipeline);
+#else
+                                                     false, ppPipeline);
+#endif
+
+        if ((result == Result::Success) && pProfiler->IsEnabled())
+        {
+            pProfiler->Record(PipelineCreateType::Compute, startTime);
+        }
+    }
+
+    return result;
+}
+
 // =====================================================================================================================
 // Creates and initializes a new graphics pipeline.
 Result Device::CreateGraphicsPipeline(
@@ -3213,14 +3251,53 @@ Result Device::CreateGraphicsPipeline(
 {
     constexpr GraphicsPipelineInternalCreateInfo NullInternalInfo = {};
 
-    return (m_pGfxDevice != nullptr) ?
-            m_pGfxDevice->CreateGraphicsPipeline(createInfo, NullInternalInfo, pPlacementAddr,
+    Result result = Result::ErrorUnavailable;
+
+    if (m_pGfxDevice != nullptr)
+    {
+        PipelineCreateProfiler*const pProfiler = m_pGfxDevice->GetPipelineCreateProfiler();
+        const int64                  startTime = pProfiler->IsEnabled() ? GetPerfCpuTime() : 0;
+
+        result = m_pGfxDevice->CreateGraphicsPipeline(createInfo, NullInternalInfo, pPlacementAddr,
 #if (PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 309)
-                                                 createInfo.flags.clientInternal, ppPipeline) :
+                                                      createInfo.flags.clientInternal, ppPipeline);
 #else
-                                                 false, ppPipeline) :
+                                                      false, ppPipeline);
 #endif
-            Result::ErrorUnavailable;
+
+        if ((result == Result::Success) && pProfiler->IsEnabled())
+        {
+            pProfiler->Record(PipelineCreateType::Graphics, startTime);
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Creates a new pipeline from data previously stored by IPipeline::Store().
+Result Device::LoadPipeline(
+    const void* pData,
+    size_t      dataSize,
+    void*       pPlacementAddr,
+    IPipeline** ppPipeline)
+{
+    Result result = Result::ErrorUnavailable;
+
+    if (m_pGfxDevice != nullptr)
+    {
+        PipelineCreateProfiler*const pProfiler = m_pGfxDevice->GetPipelineCreateProfiler();
+        const int64                  startTime = pProfiler->IsEnabled() ? GetPerfCpuTime() : 0;
+
+        result = m_pGfxDevice->LoadPipeline(pData, dataSize, pPlacementAddr, ppPipeline);
+
+        if ((result == Result::Success) && pProfiler->IsEnabled())
+        {
+            pProfiler->Record(PipelineCreateType::Load, startTime);
+        }
+    }
+
+    return result;
 }
 
 // =====================================================================================================================
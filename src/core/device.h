@@ -1070,16 +1070,7 @@ public:
     virtual Result CreateComputePipeline(
         const ComputePipelineCreateInfo& createInfo,
         void*                            pPlacementAddr,
-        IPipeline**                      ppPipeline) override
-    {
-        return (m_pGfxDevice == nullptr) ? Result::ErrorUnavailable :
-                m_pGfxDevice->CreateComputePipeline(createInfo, pPlacementAddr,
-#if (PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 309)
-                                                    createInfo.flags.clientInternal, ppPipeline);
-#else
-                                                    false, ppPipeline);
-#endif
-    }
+        IPipeline**                      ppPipeline) override;
 
     // NOTE: Part of the public IDevice interface.
     virtual size_t GetGraphicsPipelineSize(
@@ -1102,11 +1093,7 @@ public:
         const void* pData,
         size_t      dataSize,
         void*       pPlacementAddr,
-        IPipeline** ppPipeline) override
-    {
-        return (m_pGfxDevice == nullptr) ? Result::ErrorUnavailable :
-                m_pGfxDevice->LoadPipeline(pData, dataSize, pPlacementAddr, ppPipeline);
-    }
+        IPipeline** ppPipeline) override;
 
     // NOTE: Part of the public IDevice interface.
     virtual size_t GetMsaaStateSize(
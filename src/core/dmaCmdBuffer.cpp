@@ -23,6 +23,7 @@
  ******************************************************************************/
 
 #include "core/cmdAllocator.h"
+#include "core/cmdBufDumpWriter.h"
 #include "core/device.h"
 #include "core/dmaCmdBuffer.h"
 #include "core/image.h"
@@ -180,7 +181,8 @@ Result DmaCmdBuffer::End()
                 DumpFile()->Write(&listHeader, sizeof(listHeader));
             }
 
-            DumpCmdStreamsToFile(DumpFile(), m_pDevice->Settings().submitTimeCmdBufDumpMode);
+            CmdBufDumpStream dumpStream(DumpFile());
+            DumpCmdStreamsToFile(&dumpStream, m_pDevice->Settings().submitTimeCmdBufDumpMode);
             DumpFile()->Close();
         }
 #endif
@@ -1296,11 +1298,11 @@ void DmaCmdBuffer::SetupDmaTypedBufferCopyInfo(
 // =====================================================================================================================
 // Dumps this command buffer's single command stream to the given file with an appropriate header.
 void DmaCmdBuffer::DumpCmdStreamsToFile(
-    File*          pFile,
-    CmdBufDumpMode mode
+    CmdBufDumpStream* pStream,
+    CmdBufDumpMode    mode
     ) const
 {
-    m_cmdStream.DumpCommands(pFile, "# DMA Queue - Command length = ", mode);
+    m_cmdStream.DumpCommands(pStream, "# DMA Queue - Command length = ", mode);
 }
 #endif
 
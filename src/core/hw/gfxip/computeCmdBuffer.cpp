@@ -23,6 +23,7 @@
  ******************************************************************************/
 
 #include "core/cmdAllocator.h"
+#include "core/cmdBufDumpWriter.h"
 #include "core/device.h"
 #include "core/hw/gfxip/computeCmdBuffer.h"
 #include "core/hw/gfxip/gfxDevice.h"
@@ -155,7 +156,8 @@ Result ComputeCmdBuffer::End()
                 DumpFile()->Write(&listHeader, sizeof(listHeader));
             }
 
-            DumpCmdStreamsToFile(DumpFile(), m_device.Parent()->Settings().submitTimeCmdBufDumpMode);
+            CmdBufDumpStream dumpStream(DumpFile());
+            DumpCmdStreamsToFile(&dumpStream, m_device.Parent()->Settings().submitTimeCmdBufDumpMode);
             DumpFile()->Close();
         }
 #endif
@@ -204,11 +206,11 @@ void ComputeCmdBuffer::CmdBindPipeline(
 // =====================================================================================================================
 // Dumps this command buffer's single command stream to the given file with an appropriate header.
 void ComputeCmdBuffer::DumpCmdStreamsToFile(
-    File*          pFile,
-    CmdBufDumpMode mode
+    CmdBufDumpStream* pStream,
+    CmdBufDumpMode    mode
     ) const
 {
-    m_pCmdStream->DumpCommands(pFile, "# Compute Queue - Command length = ", mode);
+    m_pCmdStream->DumpCommands(pStream, "# Compute Queue - Command length = ", mode);
 }
 #endif
 
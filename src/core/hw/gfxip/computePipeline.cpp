@@ -81,6 +81,11 @@ Result ComputePipeline::Init(
         result = InitFromPipelineBinary();
     }
 
+    if (result == Result::Success)
+    {
+        AddBinaryToShaderCache(createInfo.pShaderCache);
+    }
+
     return result;
 }
 
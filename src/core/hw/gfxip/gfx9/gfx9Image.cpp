@@ -2164,6 +2164,17 @@ void CpuProcessEq(
 
         eq.PrintEquation(pParent->GetDevice());
 
+        // Solving the equation bit-by-bit for every block would dominate the time spent here for anything but tiny
+        // surfaces, so use the compiled form of the equation and solve a chunk of each row at a time.
+        const CompiledMetaDataAddrEquation  compiledEq(eq);
+        constexpr uint32                    MaxCoordsPerChunk = 64;
+
+#if PAL_ENABLE_PRINTS_ASSERTS
+        const auto&  settings        = GetGfx9Settings(*pParent->GetDevice());
+        const bool   printProcessing = TestAnyFlagSet(settings.printMetaEquationInfo,
+                                                      Gfx9PrintMetaEquationInfoProcessing);
+#endif
+
         const uint32  log2MetaBlkWidth  = Log2(maskRamAddrOutput.metaBlkWidth);
         const uint32  log2MetaBlkHeight = Log2(maskRamAddrOutput.metaBlkHeight);
         const uint32  metaBlkSize       = maskRamAddrOutput.pitch * maskRamAddrOutput.height;
@@ -2188,76 +2199,115 @@ void CpuProcessEq(
             {
                 const uint32  yRelToMetaBlock = (maskRamMipInfo.startY + y) & (maskRamAddrOutput.metaBlkHeight - 1);
                 const uint32  metaY           = (y + maskRamMipInfo.startY) >> log2MetaBlkHeight;
+                const uint32  yOffset         = compiledEq.SolveComponent(MetaDataAddrCompY, yRelToMetaBlock);
 
-                for (uint32  x = 0; x < origMipLevelWidth; x += xInc)
+                // Solve the equation for a chunk of this row at a time.  The X contribution only depends on the
+                // position within the row, so it is solved once per chunk and then reused for every slice and sample.
+                for (uint32  chunkX = 0; chunkX < origMipLevelWidth; chunkX += xInc * MaxCoordsPerChunk)
                 {
-                    const uint32  xRelToMetaBlock = (maskRamMipInfo.startX + x) & (maskRamAddrOutput.metaBlkWidth - 1);
-                    const uint32  metaX           = (x + maskRamMipInfo.startX) >> log2MetaBlkWidth;
+                    uint32  xRelToMetaBlock[MaxCoordsPerChunk];
+                    uint32  metaXy[MaxCoordsPerChunk];
+                    uint32  xOffsets[MaxCoordsPerChunk];
+                    uint32  numCoords = 0;
+
+                    for (uint32  x = chunkX; (x < origMipLevelWidth) && (numCoords < MaxCoordsPerChunk); x += xInc)
+                    {
+                        const uint32  metaX = (x + maskRamMipInfo.startX) >> log2MetaBlkWidth;
+
+                        xRelToMetaBlock[numCoords] = (maskRamMipInfo.startX + x) & (maskRamAddrOutput.metaBlkWidth - 1);
+                        metaXy[numCoords]          = metaX + metaY * (maskRamAddrOutput.pitch >> log2MetaBlkWidth);
+                        xOffsets[numCoords]        = yOffset;
+                        numCoords++;
+                    }
+
+                    compiledEq.XorInComponent(MetaDataAddrCompX, numCoords, &xRelToMetaBlock[0], &xOffsets[0]);
 
                     // For volume surfaces, "numSlices" is the full depth of the surface
                     // For 2D array's, "numSlices" is the number of slices that the client is requesting that we clear.
                     for (uint32  sliceIdx = 0; sliceIdx < numSlices; sliceIdx += zInc)
                     {
-                        const uint32  absSlice  = firstSlice + sliceIdx;
-                        const uint32  metaZ     = (absSlice + maskRamMipInfo.startZ) >> log2MetaBlkDepth;
-                        const uint32  metaBlock = metaX +
-                                                  metaY * (maskRamAddrOutput.pitch >> log2MetaBlkWidth) +
-                                                  metaZ * sliceSize;
+                        const uint32  absSlice    = firstSlice + sliceIdx;
+                        const uint32  metaZ       = (absSlice + maskRamMipInfo.startZ) >> log2MetaBlkDepth;
+                        const uint32  sliceOffset = compiledEq.SolveComponent(MetaDataAddrCompZ, absSlice);
+
+                        uint32  metaBlocks[MaxCoordsPerChunk];
+                        uint32  sliceOffsets[MaxCoordsPerChunk];
+
+                        for (uint32  idx = 0; idx < numCoords; idx++)
+                        {
+                            metaBlocks[idx]   = metaXy[idx] + metaZ * sliceSize;
+                            sliceOffsets[idx] = xOffsets[idx] ^ sliceOffset;
+                        }
+
+                        compiledEq.XorInComponent(MetaDataAddrCompM, numCoords, &metaBlocks[0], &sliceOffsets[0]);
 
                         for (uint32  sample = 0; sample < numSamples; sample++)
                         {
-                            uint32 metaOffsetInNibbles = eq.CpuSolve(xRelToMetaBlock,
-                                                                     yRelToMetaBlock,
-                                                                     absSlice,
-                                                                     sample,
-                                                                     metaBlock);
+                            const uint32  sampleOffset = compiledEq.SolveComponent(MetaDataAddrCompS, sample);
 
-                            // Take care of any pipe/bank swizzling associated with this surface.  The pipeXormask
-                            // is in terms of bytes, so shift it up to get it in the correct position for a nibble
-                            // address.
-                            metaOffsetInNibbles ^= (pipeXorMask << 1);
+                            for (uint32  idx = 0; idx < numCoords; idx++)
+                            {
+                                uint32 metaOffsetInNibbles = sliceOffsets[idx] ^ sampleOffset;
 
-                            // Check that the offset is still valid...
-                            PAL_ASSERT (metaOffsetInNibbles < 2 * pMaskRam->TotalSize());
+#if PAL_ENABLE_PRINTS_ASSERTS
+                                // The processing info is only printed for tiny surfaces, so this is a good time to make
+                                // sure the compiled equation still matches the original one.
+                                if (printProcessing)
+                                {
+                                    PAL_ASSERT(metaOffsetInNibbles == eq.CpuSolve(xRelToMetaBlock[idx],
+                                                                                  yRelToMetaBlock,
+                                                                                  absSlice,
+                                                                                  sample,
+                                                                                  metaBlocks[idx]));
+                                }
+#endif
 
-                            // Make sure all the bits that we think we can ignore are still zero.
-                            PAL_ASSERT ((metaOffsetInNibbles & ((1 << firstEqBit) - 1)) == 0);
+                                // Take care of any pipe/bank swizzling associated with this surface.  The pipeXormask
+                                // is in terms of bytes, so shift it up to get it in the correct position for a nibble
+                                // address.
+                                metaOffsetInNibbles ^= (pipeXorMask << 1);
 
-                            // Determine which byte within the "MetaDataType" that we need to access.  If MetaDataType
-                            // is a byte quantity, this will be zero.
-                            const uint32  numBytesOver = (metaOffsetInNibbles & metaDataTypeByteMask) >> 1;
+                                // Check that the offset is still valid...
+                                PAL_ASSERT (metaOffsetInNibbles < 2 * pMaskRam->TotalSize());
 
-                            // Each nibble is four bits wide.  Find the amount we need to shift the clear data
-                            // to access the nibble within the MetaDataType that we are actually addressing.  Also
-                            // take into account the byte offset within MetaDataType.
-                            const uint32 bitShiftAmount = ((metaOffsetInNibbles & 1) << 2) + (numBytesOver << 3);
+                                // Make sure all the bits that we think we can ignore are still zero.
+                                PAL_ASSERT ((metaOffsetInNibbles & ((1 << firstEqBit) - 1)) == 0);
 
-                            // We need to get metaOffset back into the units of MetaDataType.  Remember that we're
-                            // shifting a nibble address here (i.e., two nibbles per byte).
-                            const uint32 metaOffset = metaOffsetInNibbles >> Log2(2 * sizeof(MetaDataType));
+                                // Determine which byte within the "MetaDataType" that we need to access.  If
+                                // MetaDataType is a byte quantity, this will be zero.
+                                const uint32  numBytesOver = (metaOffsetInNibbles & metaDataTypeByteMask) >> 1;
 
-                            const MetaDataType  andValue = ~(clearMask << bitShiftAmount);
-                            const MetaDataType  orValue  = ((clearValue & clearMask) << bitShiftAmount);
+                                // Each nibble is four bits wide.  Find the amount we need to shift the clear data
+                                // to access the nibble within the MetaDataType that we are actually addressing.  Also
+                                // take into account the byte offset within MetaDataType.
+                                const uint32 bitShiftAmount = ((metaOffsetInNibbles & 1) << 2) + (numBytesOver << 3);
 
-#if PAL_ENABLE_PRINTS_ASSERTS
-                            const auto&  settings = GetGfx9Settings(*pParent->GetDevice());
+                                // We need to get metaOffset back into the units of MetaDataType.  Remember that we're
+                                // shifting a nibble address here (i.e., two nibbles per byte).
+                                const uint32 metaOffset = metaOffsetInNibbles >> Log2(2 * sizeof(MetaDataType));
 
-                            if (TestAnyFlagSet(settings.printMetaEquationInfo, Gfx9PrintMetaEquationInfoProcessing))
-                            {
-                                // "sizeof" returns bytes, the width of a printf hex field is specified in nibbles
-                                const uint32  andOrPrintWidth = sizeof(MetaDataType) * 2;
-
-                                PAL_DPINFO(
-                                    "(%3d, %3d, %2d), (%3d, %3d, %3d, %3d, %3d) = (meta[0x%04X] & 0x%0*X) | 0x%0*X\n",
-                                    x, y, mipLevel,
-                                    xRelToMetaBlock, yRelToMetaBlock, absSlice, sample, metaBlock,
-                                    metaOffset * sizeof(MetaDataType),
-                                    andOrPrintWidth, andValue,
-                                    andOrPrintWidth, orValue);
-                            }
+                                const MetaDataType  andValue = ~(clearMask << bitShiftAmount);
+                                const MetaDataType  orValue  = ((clearValue & clearMask) << bitShiftAmount);
+
+#if PAL_ENABLE_PRINTS_ASSERTS
+                                if (printProcessing)
+                                {
+                                    // "sizeof" returns bytes, the width of a printf hex field is specified in nibbles
+                                    const uint32  andOrPrintWidth = sizeof(MetaDataType) * 2;
+
+                                    PAL_DPINFO(
+                                        "(%3d, %3d, %2d), (%3d, %3d, %3d, %3d, %3d) = "
+                                        "(meta[0x%04X] & 0x%0*X) | 0x%0*X\n",
+                                        chunkX + idx * xInc, y, mipLevel,
+                                        xRelToMetaBlock[idx], yRelToMetaBlock, absSlice, sample, metaBlocks[idx],
+                                        metaOffset * sizeof(MetaDataType),
+                                        andOrPrintWidth, andValue,
+                                        andOrPrintWidth, orValue);
+                                }
 #endif // PAL_ENABLE_PRINTS_ASSERTS
 
-                            pData[metaOffset] = (pData[metaOffset] & andValue) | orValue;
+                                pData[metaOffset] = (pData[metaOffset] & andValue) | orValue;
+                            } // end loop through the coordinates in this chunk
                         } // end loop through all the samples that actually affect this equation
                     } // end loop through all the slices associated with this mip level
                 } // end "width" loop through a mip level
@@ -28,6 +28,7 @@
 #include "core/hw/gfxip/gfx9/gfx9Device.h"
 #include "core/hw/gfxip/gfx9/gfx9Image.h"
 #include "core/hw/gfxip/gfx9/gfx9MetaEq.h"
+#include "core/hw/gfxip/gfx9/gfx9Sse2.h"
 #include "core/hw/gfxip/gfx9/g_gfx9PalSettings.h"
 
 using namespace Util;
@@ -1026,5 +1027,146 @@ uint32 MetaDataAddrEquation::GetNumComponents(
     return numComponents;
 }
 
+//=============== Implementation for CompiledMetaDataAddrEquation: =====================================================
+// =====================================================================================================================
+CompiledMetaDataAddrEquation::CompiledMetaDataAddrEquation(
+    const MetaDataAddrEquation&  eq)  // the equation to compile
+{
+    memset(&m_contribution[0][0], 0, sizeof(m_contribution));
+
+    for (uint32  compType = 0; compType < MetaDataAddrCompNumTypes; compType++)
+    {
+        uint32  usedCoordBits = 0;
+
+        for (uint32  bitPos = 0; bitPos < eq.GetNumValidBits(); bitPos++)
+        {
+            const uint32  mask = eq.Get(bitPos, compType);
+
+            usedCoordBits |= mask;
+
+            // Every coordinate bit referenced by this equation bit flips it.
+            uint32  coordBit = 0;
+            for (uint32  bits = mask; BitMaskScanForward(&coordBit, bits); bits &= (bits - 1))
+            {
+                m_contribution[compType][coordBit] |= (1u << bitPos);
+            }
+        }
+
+        m_numCoordBits[compType] = (usedCoordBits != 0) ? (Log2(usedCoordBits) + 1) : 0;
+    }
+
+#if PAL_ENABLE_PRINTS_ASSERTS
+    Validate(eq);
+#endif
+}
+
+// =====================================================================================================================
+// Solves the portion of the equation which depends on a single coordinate.  XOR'ing this together for all of the
+// coordinates gives the same result as MetaDataAddrEquation::CpuSolve.
+uint32 CompiledMetaDataAddrEquation::SolveComponent(
+    MetaDataAddrComponentType  compType,  // which coordinate "value" is
+    uint32                     value      // the coordinate itself
+    ) const
+{
+    const uint32*  pContribution = &m_contribution[compType][0];
+    uint32         result        = 0;
+
+    uint32  coordBit = 0;
+    for (uint32  bits = value; BitMaskScanForward(&coordBit, bits); bits &= (bits - 1))
+    {
+        result ^= pContribution[coordBit];
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// XOR's the contribution of each value in pValues into the corresponding entry of pOffsets.  Since the contribution
+// of each coordinate is independent of the others, calling this once per coordinate type on a zeroed pOffsets array
+// solves the equation for every set of coordinates.
+void CompiledMetaDataAddrEquation::XorInComponent(
+    MetaDataAddrComponentType  compType,   // which coordinate the values in pValues are
+    uint32                     numValues,  // the number of entries in pValues and pOffsets
+    const uint32*              pValues,    // the coordinates to solve for
+    uint32*                    pOffsets    // [in,out] the contributions are XOR'ed into these entries
+    ) const
+{
+    uint32  idx = 0;
+
+#if PAL_GFX9_SSE2
+    const uint32*  pContribution = &m_contribution[compType][0];
+    const uint32   numCoordBits  = m_numCoordBits[compType];
+    const __m128i  one           = _mm_set1_epi32(1);
+    const __m128i  zero          = _mm_setzero_si128();
+
+    // Solve four coordinates per iteration by walking the coordinate bits in lock-step: each lane's bit is turned into
+    // an all-ones or all-zeros mask which selects whether that bit's contribution is XOR'ed into the lane.
+    for (; (idx + 4) <= numValues; idx += 4)
+    {
+        __m128i*const  pDst   = reinterpret_cast<__m128i*>(pOffsets + idx);
+        __m128i        values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pValues + idx));
+        __m128i        result = _mm_loadu_si128(pDst);
+
+        for (uint32  coordBit = 0; coordBit < numCoordBits; coordBit++)
+        {
+            const __m128i  select = _mm_sub_epi32(zero, _mm_and_si128(values, one));
+
+            result = _mm_xor_si128(result, _mm_and_si128(select, _mm_set1_epi32(pContribution[coordBit])));
+            values = _mm_srli_epi32(values, 1);
+        }
+
+        _mm_storeu_si128(pDst, result);
+    }
+#endif
+
+    for (; idx < numValues; idx++)
+    {
+        pOffsets[idx] ^= SolveComponent(compType, pValues[idx]);
+    }
+}
+
+#if PAL_ENABLE_PRINTS_ASSERTS
+// =====================================================================================================================
+// Verifies that the compiled equation matches MetaDataAddrEquation::CpuSolve.  Both are linear over GF(2), so agreeing
+// on every single-bit coordinate means they agree on every possible input.
+void CompiledMetaDataAddrEquation::Validate(
+    const MetaDataAddrEquation&  eq
+    ) const
+{
+    PAL_ASSERT(Solve(0, 0, 0, 0, 0) == eq.CpuSolve(0, 0, 0, 0, 0));
+
+    for (uint32  compType = 0; compType < MetaDataAddrCompNumTypes; compType++)
+    {
+        const auto  type = static_cast<MetaDataAddrComponentType>(compType);
+
+        uint32  values[32]  = {};
+        uint32  offsets[32] = {};
+
+        for (uint32  coordBit = 0; coordBit < 32; coordBit++)
+        {
+            uint32  coords[MetaDataAddrCompNumTypes] = {};
+            coords[compType] = (1u << coordBit);
+
+            PAL_ASSERT(SolveComponent(type, coords[compType]) ==
+                       eq.CpuSolve(coords[MetaDataAddrCompX],
+                                   coords[MetaDataAddrCompY],
+                                   coords[MetaDataAddrCompZ],
+                                   coords[MetaDataAddrCompS],
+                                   coords[MetaDataAddrCompM]));
+
+            values[coordBit] = coords[compType];
+        }
+
+        // Run the batched path over the same coordinates to check it against the scalar path.
+        XorInComponent(type, 32, &values[0], &offsets[0]);
+
+        for (uint32  coordBit = 0; coordBit < 32; coordBit++)
+        {
+            PAL_ASSERT(offsets[coordBit] == SolveComponent(type, values[coordBit]));
+        }
+    }
+}
+#endif
+
 } // Gfx9
 } // Pal
@@ -240,5 +240,64 @@ private:
     uint32  m_equation[MaxNumMetaDataAddrBits][MetaDataAddrCompNumTypes];
 };
 
+// =====================================================================================================================
+// A compiled form of a MetaDataAddrEquation, used to solve the equation on the CPU for many coordinates at once.
+//
+// Every equation bit is the XOR of some coordinate bits, so the equation is a linear map over GF(2): solving it for
+// (x, y, z, sample, metaBlock) is the same as XOR'ing together one precomputed contribution for each set bit of each
+// coordinate.  That contribution is simply the set of equation bits which reference that coordinate bit.  i.e., for
+//    eq[1] = x5 ^ y5
+//    eq[0] = x4 ^ y4 ^ y5
+//
+// the X contributions are x4 -> 0x1 and x5 -> 0x2, and the Y contributions are y4 -> 0x1 and y5 -> 0x3.
+//
+// The results are always bit-exact with MetaDataAddrEquation::CpuSolve.
+class CompiledMetaDataAddrEquation
+{
+public:
+    explicit CompiledMetaDataAddrEquation(const MetaDataAddrEquation&  eq);
+    ~CompiledMetaDataAddrEquation() {}
+
+    uint32 Solve(
+        uint32  x,
+        uint32  y,
+        uint32  z,
+        uint32  sample,
+        uint32  metaBlock) const
+    {
+        return SolveComponent(MetaDataAddrCompX, x)      ^
+               SolveComponent(MetaDataAddrCompY, y)      ^
+               SolveComponent(MetaDataAddrCompZ, z)      ^
+               SolveComponent(MetaDataAddrCompS, sample) ^
+               SolveComponent(MetaDataAddrCompM, metaBlock);
+    }
+
+    uint32 SolveComponent(
+        MetaDataAddrComponentType  compType,
+        uint32                     value) const;
+
+    void XorInComponent(
+        MetaDataAddrComponentType  compType,
+        uint32                     numValues,
+        const uint32*              pValues,
+        uint32*                    pOffsets) const;
+
+private:
+#if PAL_ENABLE_PRINTS_ASSERTS
+    void Validate(const MetaDataAddrEquation&  eq) const;
+#endif
+
+    // m_contribution[compType][coordBit] is the set of equation bits which are flipped by bit "coordBit" of the
+    // "compType" coordinate.
+    uint32  m_contribution[MetaDataAddrCompNumTypes][32];
+
+    // The number of low coordinate bits which contribute to the equation for each component type; every higher
+    // coordinate bit has no contribution.
+    uint32  m_numCoordBits[MetaDataAddrCompNumTypes];
+
+    PAL_DISALLOW_DEFAULT_CTOR(CompiledMetaDataAddrEquation);
+    PAL_DISALLOW_COPY_AND_ASSIGN(CompiledMetaDataAddrEquation);
+};
+
 } // Gfx9
 } // Pal
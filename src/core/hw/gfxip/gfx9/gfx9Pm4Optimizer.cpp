@@ -25,6 +25,7 @@
 #include "core/hw/gfxip/gfx9/g_gfx9PalSettings.h"
 #include "core/hw/gfxip/gfx9/gfx9Device.h"
 #include "core/hw/gfxip/gfx9/gfx9Pm4Optimizer.h"
+#include "core/hw/gfxip/gfx9/gfx9Sse2.h"
 #include "palAutoBuffer.h"
 
 using namespace Util;
@@ -60,6 +61,67 @@ static bool UpdateRegState(
     return mustKeep;
 }
 
+// The vectorized path below reinterprets each RegState as a { flags, value } pair of DWORDs with the valid flag in
+// bit 0 and the mustWrite flag in bit 1, which is how every compiler we support lays out the bitfield.
+static_assert(sizeof(RegState) == (2 * sizeof(uint32)), "RegState must be exactly two DWORDs.");
+
+constexpr uint32 RegStateValidBit     = 0x1;
+constexpr uint32 RegStateMustWriteBit = 0x2;
+
+// =====================================================================================================================
+// Equivalent to calling UpdateRegState on each of a run of up to 32 sequential registers. Returns a mask with bit i set
+// if the i-th register must be written to HW.
+static uint32 UpdateRegStateRange(
+    const uint32* pNewRegVals,
+    uint32        numRegs,
+    RegState*     pCurRegState) // [in,out] Current state of the first register being set, will be updated.
+{
+    PAL_ASSERT(numRegs <= 32);
+
+    uint32 keepRegMask = 0;
+    uint32 regIdx      = 0;
+
+#if PAL_GFX9_SSE2
+    const __m128i validBit     = _mm_set1_epi32(RegStateValidBit);
+    const __m128i validOnlyVal = _mm_set1_epi32(RegStateValidBit);
+    const __m128i flagBits     = _mm_set1_epi32(RegStateValidBit | RegStateMustWriteBit);
+
+    // Diff four registers per iteration. Writing the new state unconditionally is fine: registers we skip already hold
+    // a valid copy of the new value.
+    for (; (regIdx + 4) <= numRegs; regIdx += 4)
+    {
+        __m128i*const pState  = reinterpret_cast<__m128i*>(pCurRegState + regIdx);
+        const __m128  state01 = _mm_castsi128_ps(_mm_loadu_si128(pState));
+        const __m128  state23 = _mm_castsi128_ps(_mm_loadu_si128(pState + 1));
+
+        const __m128i flags   = _mm_castps_si128(_mm_shuffle_ps(state01, state23, _MM_SHUFFLE(2, 0, 2, 0)));
+        const __m128i values  = _mm_castps_si128(_mm_shuffle_ps(state01, state23, _MM_SHUFFLE(3, 1, 3, 1)));
+        const __m128i newVals = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pNewRegVals + regIdx));
+
+        // A register can be skipped if it's valid, not mustWrite, and already has the new value.
+        const __m128i canSkip = _mm_and_si128(_mm_cmpeq_epi32(values, newVals),
+                                              _mm_cmpeq_epi32(_mm_and_si128(flags, flagBits), validOnlyVal));
+        const uint32  skipMask = static_cast<uint32>(_mm_movemask_ps(_mm_castsi128_ps(canSkip)));
+
+        keepRegMask |= ((~skipMask & 0xF) << regIdx);
+
+        const __m128i newFlags = _mm_or_si128(flags, validBit);
+        _mm_storeu_si128(pState,     _mm_unpacklo_epi32(newFlags, newVals));
+        _mm_storeu_si128(pState + 1, _mm_unpackhi_epi32(newFlags, newVals));
+    }
+#endif
+
+    for (; regIdx < numRegs; ++regIdx)
+    {
+        if (UpdateRegState(pNewRegVals[regIdx], pCurRegState + regIdx))
+        {
+            keepRegMask |= (1u << regIdx);
+        }
+    }
+
+    return keepRegMask;
+}
+
 // =====================================================================================================================
 Pm4Optimizer::Pm4Optimizer(
     const Device& device)
@@ -407,26 +469,81 @@ uint32* Pm4Optimizer::OptimizePm4SetReg(
     const uint32 regOffset = setData.bitfields2.reg_offset;
     RegState*    pRegState = pRegStateBase + regOffset;
 
-    // Determine which of the registers written by this set command can't be skipped because they must always be set or
-    // are taking on a new value.
+    // A clause of optimized registers starts with a non-skipped register and continues until either 1) there is a
+    // big enough gap in the non-skipped registers that we can start a new clause, or 2) the source packet ends.
     //
-    // We assume that no more than 32 registers are being set. Currently the driver only sets more than 32 registers in
-    // the viewport state object. Luckily, those registers are vector regisers so we can't optimize them anyway. If we
-    // ever encounter a set command with more than 32 registers that has redundant values the assert below will trigger.
-    uint32 keepRegCount = 0;
-    uint32 keepRegMask  = 0;
-    for (uint32 i = 0; i < numRegs; i++)
+    // The "big enough" gap size is set to the size of a SET_DATA command (two DWORDs). This prevents us from
+    // using more command space than an unoptimized command while conceeding that in some cases we may write
+    // redundant registers. The difference between clauseEndIdx and curRegIdx will be one greater than the gap size
+    // so we need to add one to the constant below.
+    const uint32 MinClauseIdxGap = Util::NumBytesToNumDwords(sizeof(SetDataPacket)) + 1;
+
+    // Determine which of the registers written by this set command can't be skipped because they must always be set or
+    // are taking on a new value. The registers are diffed against the shadow state in windows of 32 so that whole
+    // ranges can be compared at once; clauses are tracked across windows so long packets are split just like short
+    // ones. Nothing is written until we know at least one register can be skipped, which keeps the common case of a
+    // fully-kept packet a single copy.
+    uint32        keepRegCount   = 0;
+    bool          clauseOpen     = false;
+    uint32        clauseStartIdx = 0;
+    uint32        clauseEndIdx   = 0;
+    bool          splitPacket    = false;
+
+    for (uint32 windowIdx = 0; windowIdx < numRegs; windowIdx += 32)
     {
-        if (UpdateRegState(pRegData[i], pRegState + i))
+        const uint32 windowSize  = Min(numRegs - windowIdx, 32u);
+        uint32       keepRegMask = UpdateRegStateRange(pRegData + windowIdx, windowSize, pRegState + windowIdx);
+
+        keepRegCount += CountSetBits(keepRegMask);
+
+        // As long as nothing has been skipped yet the packet is emitted whole, so there is no clause to track.
+        if ((splitPacket == false) && (keepRegCount == (windowIdx + windowSize)))
         {
-            keepRegCount++;
-            keepRegMask |= 1 << i;
+            continue;
         }
-    }
 
-    PAL_ASSERT((keepRegCount == numRegs) || (numRegs <= 32));
+        if (splitPacket == false)
+        {
+            // This is the first window with skippable registers. Rebuild the keep mask for all registers before it,
+            // which are all kept, by treating them as one open clause.
+            splitPacket = true;
+
+            if (windowIdx > 0)
+            {
+                clauseOpen     = true;
+                clauseStartIdx = 0;
+                clauseEndIdx   = windowIdx - 1;
+            }
+        }
+
+        uint32 bitIdx = 0;
+        while (BitMaskScanForward(&bitIdx, keepRegMask))
+        {
+            keepRegMask &= ~(1u << bitIdx);
+
+            const uint32 curRegIdx = windowIdx + bitIdx;
+
+            if (clauseOpen && ((curRegIdx - clauseEndIdx) < MinClauseIdxGap))
+            {
+                // There isn't enough space to end the clause so we must continue it through the current index.
+                clauseEndIdx = curRegIdx;
+            }
+            else
+            {
+                if (clauseOpen)
+                {
+                    pDstCmd = WriteSetRegClause(setData, regOffset, clauseStartIdx, clauseEndIdx, pRegData, pDstCmd);
+                }
 
-    if ((keepRegCount == numRegs) || (numRegs > 32))
+                // The next clause begins at the current index.
+                clauseOpen     = true;
+                clauseStartIdx = curRegIdx;
+                clauseEndIdx   = curRegIdx;
+            }
+        }
+    }
+
+    if (splitPacket == false)
     {
         // No register writes can be skipped: emit all registers.
         memcpy(pDstCmd, &setData, sizeof(setData));
@@ -435,62 +552,43 @@ uint32* Pm4Optimizer::OptimizePm4SetReg(
         memmove(pDstCmd, pRegData, numRegs * sizeof(uint32));
         pDstCmd += numRegs;
     }
-    else if (keepRegCount > 0)
+    else if (clauseOpen)
     {
-        // A clause of optimized registers starts with a non-skipped register and continues until either 1) there is a
-        // big enough gap in the non-skipped registers that we can start a new clause, or 2) the source packet ends.
-        //
-        // The "big enough" gap size is set to the size of a SET_DATA command (two DWORDs). This prevents us from
-        // using more command space than an unoptimized command while conceeding that in some cases we may write
-        // redundant registers. The difference between clauseEndIdx and curRegIdx will be one greater than the gap size
-        // so we need to add one to the constant below.
-        const uint32 MinClauseIdxGap = Util::NumBytesToNumDwords(sizeof(SetDataPacket)) + 1;
-
-        // Since the keepRegCount is non-zero we must have at least one bit set, find it and use it to start a clause.
-        uint32 curRegIdx      = 0;
-        bool   foundNewIdx    = BitMaskScanForward(&curRegIdx, keepRegMask);
-        uint32 clauseStartIdx = curRegIdx;
-        uint32 clauseEndIdx   = curRegIdx;
-
-        do
-        {
-            // Find the next non-skipped register index, if any, for us to consider. We must mask off the bit that we
-            // queried last time to prevent an infinite loop.
-            keepRegMask &= ~(1 << curRegIdx);
-            foundNewIdx  = BitMaskScanForward(&curRegIdx, keepRegMask);
+        pDstCmd = WriteSetRegClause(setData, regOffset, clauseStartIdx, clauseEndIdx, pRegData, pDstCmd);
+    }
 
-            // Check our end-of-clause conditions as stated above.
-            if ((foundNewIdx == false) || (curRegIdx - clauseEndIdx >= MinClauseIdxGap))
-            {
-                const uint32 clauseRegCount = clauseEndIdx - clauseStartIdx + 1;
+    return pDstCmd;
+}
 
-                setData.header.count          = clauseRegCount;
-                setData.bitfields2.reg_offset = regOffset + clauseStartIdx;
+// =====================================================================================================================
+// Writes a SET packet for registers [clauseStartIdx, clauseEndIdx] of an optimized SET packet. Returns a pointer to the
+// next free location in the optimized command stream.
+template <typename SetDataPacket>
+uint32* Pm4Optimizer::WriteSetRegClause(
+    SetDataPacket setData,
+    uint32        regOffset,
+    uint32        clauseStartIdx,
+    uint32        clauseEndIdx,
+    const uint32* pRegData,
+    uint32*       pDstCmd
+    ) const
+{
+    const uint32 clauseRegCount = clauseEndIdx - clauseStartIdx + 1;
 
-                memcpy(pDstCmd, &setData, sizeof(setData));
-                pDstCmd += Util::NumBytesToNumDwords(sizeof(SetDataPacket));
+    setData.header.count          = clauseRegCount;
+    setData.bitfields2.reg_offset = regOffset + clauseStartIdx;
 
-                memmove(pDstCmd, pRegData + clauseStartIdx, clauseRegCount * sizeof(uint32));
-                pDstCmd += clauseRegCount;
+    memcpy(pDstCmd, &setData, sizeof(setData));
+    pDstCmd += Util::NumBytesToNumDwords(sizeof(SetDataPacket));
+
+    memmove(pDstCmd, pRegData + clauseStartIdx, clauseRegCount * sizeof(uint32));
+    pDstCmd += clauseRegCount;
 
 #if PAL_ENABLE_PRINTS_ASSERTS
-                // If we're reading and writing to the same buffer we can't write past the end of this clause's data.
-                PAL_ASSERT((m_dstContainsSrc == false) || (pDstCmd <= pRegData + clauseEndIdx + 1));
+    // If we're reading and writing to the same buffer we can't write past the end of this clause's data.
+    PAL_ASSERT((m_dstContainsSrc == false) || (pDstCmd <= pRegData + clauseEndIdx + 1));
 #endif
 
-                // The next clause begins at the current index.
-                clauseStartIdx = curRegIdx;
-                clauseEndIdx   = curRegIdx;
-            }
-            else
-            {
-                // There isn't enough space to end the clause so we must continue it through the current index.
-                clauseEndIdx = curRegIdx;
-            }
-        }
-        while (foundNewIdx);
-    }
-
     return pDstCmd;
 }
 
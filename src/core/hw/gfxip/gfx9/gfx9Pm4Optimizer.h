@@ -95,6 +95,15 @@ private:
     template <typename SetDataPacket>
     uint32* OptimizePm4SetReg(SetDataPacket setData, const uint32* pRegData, uint32* pDstCmd, RegState* pRegStateBase);
 
+    template <typename SetDataPacket>
+    uint32* WriteSetRegClause(
+        SetDataPacket setData,
+        uint32        regOffset,
+        uint32        clauseStartIdx,
+        uint32        clauseEndIdx,
+        const uint32* pRegData,
+        uint32*       pDstCmd) const;
+
     template <typename LoadDataPacket>
     void HandlePm4LoadReg(const LoadDataPacket& loadData, RegState* pRegStateBase);
 
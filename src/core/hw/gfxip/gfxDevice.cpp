@@ -29,6 +29,8 @@
 #include "core/hw/gfxip/gfxDevice.h"
 #include "core/hw/gfxip/gfxCmdBuffer.h"
 #include "core/hw/gfxip/palToScpcWrapper.h"
+#include "core/hw/gfxip/pipelineUploadRing.h"
+#include "core/hw/gfxip/shaderCodeHeap.h"
 #include "palShader.h"
 #include "palShaderCache.h"
 #include "core/hw/gfxip/rpm/rsrcProcMgr.h"
@@ -48,6 +50,8 @@ GfxDevice::GfxDevice(
     m_pParent(pDevice),
     m_pRsrcProcMgr(pRsrcProcMgr),
     m_pShaderCache(nullptr),
+    m_pShaderCodeHeap(nullptr),
+    m_pPipelineUploadRing(nullptr),
     m_frameCountGpuMem(),
     m_frameCntReg(frameCountRegOffset),
     m_useFixedLateAllocVsLimit(false),
@@ -71,6 +75,8 @@ GfxDevice::~GfxDevice()
 
     // This object must be destroyed in Cleanup().
     PAL_ASSERT(m_pShaderCache == nullptr);
+    PAL_ASSERT(m_pShaderCodeHeap == nullptr);
+    PAL_ASSERT(m_pPipelineUploadRing == nullptr);
 }
 
 // =====================================================================================================================
@@ -95,6 +101,14 @@ Result GfxDevice::Cleanup()
         PAL_SAFE_FREE(m_pShaderCache, GetPlatform());
     }
 
+    m_pipelineCreateProfiler.Report(*m_pParent->MemMgr());
+
+    // All pipelines (including RPM's) must have been destroyed by now, so the code heap should be empty.
+    PAL_SAFE_DELETE(m_pShaderCodeHeap, GetPlatform());
+
+    // This must be destroyed after the code heap because freeing uploaded code may need to wait on the ring.
+    PAL_SAFE_DELETE(m_pPipelineUploadRing, GetPlatform());
+
     for (uint32 i = 0; i < QueueType::QueueTypeCount; i++)
     {
         if (m_pFrameCountCmdBuffer[i] != nullptr)
@@ -151,9 +165,56 @@ Result GfxDevice::LateInit()
         }
     }
 
+    if (Parent()->Settings().pipelineCreateProfilingEnable)
+    {
+        m_pipelineCreateProfiler.Enable(Parent()->MemMgr());
+    }
+
+    if (Parent()->Settings().shaderCodeDedupEnable)
+    {
+        m_pShaderCodeHeap = PAL_NEW(ShaderCodeHeap, GetPlatform(), AllocInternal)(Parent());
+
+        if ((m_pShaderCodeHeap == nullptr) || (m_pShaderCodeHeap->Init() != Result::Success))
+        {
+            // NOTE: Code deduplication is only an optimization; if the heap can't be set up, pipelines just fall back
+            // to uploading private copies of their code.
+            PAL_ALERT_ALWAYS();
+            PAL_SAFE_DELETE(m_pShaderCodeHeap, GetPlatform());
+        }
+    }
+
     return result;
 }
 
+// =====================================================================================================================
+// Creates the pipeline upload ring if DMA pipeline uploads are enabled.  This can't be done in Finalize() because the
+// ring needs a DMA queue, which can only be created once the parent device has created its engines.  Any pipelines
+// created before this point (e.g., RPM's) are uploaded directly by the CPU.
+Result GfxDevice::CreatePipelineUploadRing()
+{
+    PAL_ASSERT(m_pPipelineUploadRing == nullptr);
+
+    if (Parent()->Settings().pipelineDmaUploadEnable &&
+        (Parent()->EngineProperties().perEngine[EngineTypeDma].numAvailable > 0))
+    {
+        // RPM's warm-up threads may be creating pipelines right now, so the ring must not be visible to them until it
+        // has been fully initialized.
+        PipelineUploadRing* pRing = PAL_NEW(PipelineUploadRing, GetPlatform(), AllocInternal)(Parent());
+
+        if ((pRing == nullptr) || (pRing->Init() != Result::Success))
+        {
+            // NOTE: DMA uploads are only an optimization; if the ring can't be set up, pipelines just fall back to
+            // being uploaded by the CPU.
+            PAL_ALERT_ALWAYS();
+            PAL_SAFE_DELETE(pRing, GetPlatform());
+        }
+
+        AtomicExchangePointer(reinterpret_cast<void*volatile*>(&m_pPipelineUploadRing), pRing);
+    }
+
+    return Result::Success;
+}
+
 // =====================================================================================================================
 // Finalizes any chip properties which depend on settings being read.
 void GfxDevice::FinalizeChipProperties(
@@ -334,7 +395,10 @@ Result GfxDevice::CreateShaderCache(
 {
     ShaderCache* pShaderCache = PAL_PLACEMENT_NEW(pPlacementAddr) ShaderCache(*Parent());
 
-    Result result = pShaderCache->Init(createInfo, false);
+    // Client caches are backed by the on-disk cache in the same way as the internal cache.
+    const bool enableDiskCache = (Parent()->GetPublicSettings()->shaderCacheMode == ShaderCacheOnDisk);
+
+    Result result = pShaderCache->Init(createInfo, enableDiskCache);
 
     if (result != Result::Success)
     {
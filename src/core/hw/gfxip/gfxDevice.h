@@ -28,6 +28,7 @@
 #include "palMetroHash.h"
 #include "core/cmdStream.h"
 #include "core/platform.h"
+#include "core/hw/gfxip/pipelineCreateProfiler.h"
 #include "palHashMap.h"
 
 typedef union _ADDR_CREATE_FLAGS ADDR_CREATE_FLAGS;
@@ -64,6 +65,7 @@ class      IPipeline;
 class      IQueryPool;
 class      IShader;
 class      MsaaState;
+class      PipelineUploadRing;
 class      Platform;
 class      Queue;
 class      QueueContext;
@@ -72,6 +74,7 @@ class      RsrcProcMgr;
 class      ScissorState;
 class      Shader;
 class      ShaderCache;
+class      ShaderCodeHeap;
 class      ViewportState;
 
 struct     BorderColorPaletteCreateInfo;
@@ -455,6 +458,11 @@ public:
         const ImageTiling tiling) const = 0;
 
     ShaderCache* GetShaderCache() const { return m_pShaderCache; }
+    ShaderCodeHeap* GetShaderCodeHeap() const { return m_pShaderCodeHeap; }
+    PipelineUploadRing* GetPipelineUploadRing() const { return m_pPipelineUploadRing; }
+    PipelineCreateProfiler* GetPipelineCreateProfiler() { return &m_pipelineCreateProfiler; }
+
+    Result CreatePipelineUploadRing();
 
     // Helper function that disables a specific CU mask within the UMD managed range.
     uint16 GetCuEnableMask(uint16 disabledCuMmask, uint32 enabledCuMaskSetting) const;
@@ -567,6 +575,9 @@ protected:
     FlglRegSeq              m_flglRegSeq[FlglRegSeqMax]; // Holder for FLGL sync register sequences
 
     ShaderCache* m_pShaderCache;
+    ShaderCodeHeap* m_pShaderCodeHeap;  // Shared shader code storage for all pipelines, or null if disabled.
+    PipelineUploadRing* m_pPipelineUploadRing;  // Uploads pipeline code using a DMA queue, or null if disabled.
+    PipelineCreateProfiler m_pipelineCreateProfiler;
 
 #if DEBUG
     // Sometimes it is useful to temporarily hang the GPU during debugging to dump command buffers, etc.  This piece of
@@ -107,6 +107,11 @@ Result GraphicsPipeline::Init(
         result = InitFromPipelineBinary(createInfo, internalInfo);
     }
 
+    if (result == Result::Success)
+    {
+        AddBinaryToShaderCache(createInfo.pShaderCache);
+    }
+
     return result;
 }
 
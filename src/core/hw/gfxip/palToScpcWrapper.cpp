@@ -23,8 +23,14 @@
  ******************************************************************************/
 
 #include "core/device.h"
+#include "core/platform.h"
+#include "core/hw/gfxip/gfxDevice.h"
 #include "core/hw/gfxip/palToScpcWrapper.h"
+#include "core/hw/gfxip/pipeline.h"
+#include "core/hw/gfxip/pipelineDiskCache.h"
 #include "palAutoBuffer.h"
+#include "palDbgPrint.h"
+#include "palGrowableHashMapImpl.h"
 #include "palSysUtil.h"
 
 using namespace Util;
@@ -36,6 +42,35 @@ static const char CacheFileSubPath[] = "/.AMD/PalCache/";
 
 static const char ClientStr[] = "XGL";
 
+// Identifies a blob produced by ShaderCache::Serialize().  Spells "PALC" in memory.
+static constexpr uint32 SerializedCacheMagic   = 0x434C4150;
+// Incremented whenever the layout of the serialized cache data changes.
+static constexpr uint32 SerializedCacheVersion = 1;
+
+// Number of entries the cache can hold before its hash map needs to grow for the first time.
+static constexpr uint32 DefaultNumCacheEntries = 256;
+
+// Header which precedes the serialized cache entries.  A blob whose header doesn't match the loading device and PAL
+// build is silently ignored, just as an invalid serialized pipeline would be rejected by Pipeline::ValidateLoad().
+struct SerializedCacheHeader
+{
+    uint32        magic;       // Must equal SerializedCacheMagic.
+    uint32        version;     // Must equal SerializedCacheVersion.
+    uint32        deviceId;    // As in DeviceProperties.
+    uint32        numEntries;  // Number of entries which follow this header.
+    BuildUniqueId buildId;     // Identifies the PAL build which serialized the cache.
+};
+
+// Each serialized entry is followed by its pipeline binary, padded to SerializedEntryAlignment bytes.
+struct SerializedCacheEntry
+{
+    uint64          compilerHash;
+    MetroHash::Hash settingsHash;
+    uint64          binarySize;
+};
+
+static constexpr size_t SerializedEntryAlignment = sizeof(uint64);
+
 // =====================================================================================================================
 size_t Shader::GetSize(
     const Device&           device,
@@ -100,10 +135,10 @@ size_t ShaderCache::GetSize(
 {
     if (pResult != nullptr)
     {
-        (*pResult) = Result::ErrorUnavailable;
+        (*pResult) = Result::Success;
     }
 
-    return 0;
+    return sizeof(ShaderCache);
 }
 
 // =====================================================================================================================
@@ -111,17 +146,84 @@ ShaderCache::ShaderCache(
     const Device& device)
     :
     m_device(device),
+    m_pPlatform(device.GetPlatform()),
     m_pfnGetValue(nullptr),
-    m_pfnStoreValue(nullptr)
+    m_pfnStoreValue(nullptr),
+    m_pDiskCache(nullptr),
+    m_ownsDiskCache(false),
+    m_entries(DefaultNumCacheEntries, device.GetPlatform()),
+    m_totalDataSize(0),
+    m_numHits(0),
+    m_numMisses(0)
 {
 }
 
+// =====================================================================================================================
+ShaderCache::~ShaderCache()
+{
+    FreeEntries();
+
+    if (m_ownsDiskCache)
+    {
+        PAL_SAFE_DELETE(m_pDiskCache, m_pPlatform);
+    }
+}
+
 // =====================================================================================================================
 Result ShaderCache::Init(
     const ShaderCacheCreateInfo& createInfo,
     bool                         enableDiskCache)
 {
-    return Result::ErrorUnavailable;
+    m_pfnGetValue   = createInfo.pfnGetValueFunc;
+    m_pfnStoreValue = createInfo.pfnStoreValueFunc;
+
+    Result result = m_lock.Init();
+
+    if (result == Result::Success)
+    {
+        result = m_entries.Init();
+    }
+
+    if ((result == Result::Success) && (createInfo.pInitialData != nullptr) && (createInfo.initialDataSize > 0))
+    {
+        result = LoadInitialData(createInfo.pInitialData, createInfo.initialDataSize);
+    }
+
+    if ((result == Result::Success) && enableDiskCache)
+    {
+        InitDiskCache();
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Opens the on-disk pipeline cache, or shares the one opened by the device's internal cache.  Client caches are always
+// destroyed before the device, so the shared disk cache outlives them.  The cache keeps working in memory only if the
+// disk cache can't be opened.
+void ShaderCache::InitDiskCache()
+{
+    const char*const   pCachePath     = m_device.GetCacheFilePath();
+    const ShaderCache* pInternalCache = m_device.GetGfxDevice()->GetShaderCache();
+
+    if ((pInternalCache != nullptr) && (pInternalCache != this) && (pInternalCache->GetDiskCache() != nullptr))
+    {
+        m_pDiskCache = pInternalCache->GetDiskCache();
+    }
+    else if (pCachePath != nullptr)
+    {
+        char directory[512];
+        Snprintf(&directory[0], sizeof(directory), "%s%s", pCachePath, CacheFileSubPath);
+
+        m_pDiskCache    = PAL_NEW(PipelineDiskCache, m_pPlatform, AllocInternal)(m_device);
+        m_ownsDiskCache = true;
+
+        if ((m_pDiskCache != nullptr) && (m_pDiskCache->Init(&directory[0]) != Result::Success))
+        {
+            PAL_ALERT_ALWAYS();
+            PAL_SAFE_DELETE(m_pDiskCache, m_pPlatform);
+        }
+    }
 }
 
 // =====================================================================================================================
@@ -131,25 +233,354 @@ void ShaderCache::Destroy()
     this->~ShaderCache();
 }
 
+// =====================================================================================================================
+// Populates the cache from a blob previously produced by Serialize().  Data which was serialized by a different
+// device or PAL build is ignored rather than reported as an error, since a stale on-disk cache is expected whenever
+// the driver is updated.
+Result ShaderCache::LoadInitialData(
+    const void* pData,
+    size_t      dataSize)
+{
+    Result result = Result::Success;
+
+    const auto*const pHeader = static_cast<const SerializedCacheHeader*>(pData);
+
+    BuildUniqueId buildId;
+    Pipeline::GetBuildId(&buildId);
+
+    if ((dataSize >= sizeof(SerializedCacheHeader))            &&
+        (pHeader->magic    == SerializedCacheMagic)            &&
+        (pHeader->version  == SerializedCacheVersion)          &&
+        (pHeader->deviceId == m_device.ChipProperties().deviceId) &&
+        (memcmp(&pHeader->buildId, &buildId, sizeof(BuildUniqueId)) == 0))
+    {
+        const MetroHash::Hash settingsHash = m_device.GetSettingsHash();
+
+        const void*const pDataEnd = VoidPtrInc(pData, dataSize);
+        const void*      pCur     = VoidPtrInc(pData, sizeof(SerializedCacheHeader));
+
+        for (uint32 i = 0; (i < pHeader->numEntries) && (result == Result::Success); ++i)
+        {
+            const auto*const pEntry   = static_cast<const SerializedCacheEntry*>(pCur);
+            const size_t     bytesLeft = VoidPtrDiff(pDataEnd, pCur);
+
+            if ((bytesLeft < sizeof(SerializedCacheEntry)) ||
+                ((bytesLeft - sizeof(SerializedCacheEntry)) < pEntry->binarySize))
+            {
+                // The blob is truncated; keep whatever has been loaded so far.
+                PAL_ALERT_ALWAYS();
+                break;
+            }
+
+            const void*const pBinary = VoidPtrInc(pCur, sizeof(SerializedCacheEntry));
+            const size_t     binarySize = static_cast<size_t>(pEntry->binarySize);
+
+            // Entries created under different PAL settings can never be returned by this device, so don't bother
+            // keeping them around.
+            if (memcmp(&pEntry->settingsHash, &settingsHash, sizeof(MetroHash::Hash)) == 0)
+            {
+                const EntryKey key = { pEntry->compilerHash, pEntry->settingsHash };
+                result = AddEntry(key, pBinary, binarySize);
+            }
+
+            const size_t entrySize = Pow2Align(sizeof(SerializedCacheEntry) + binarySize, SerializedEntryAlignment);
+            pCur = VoidPtrInc(pCur, Min(entrySize, bytesLeft));
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Copies a pipeline binary into the cache under the given key.  The existing copy is kept if the key is already
+// present.
+Result ShaderCache::AddEntry(
+    const EntryKey& key,
+    const void*     pBinary,
+    size_t          binarySize)
+{
+    RWLockAuto<RWLock::ReadWrite> lock(&m_lock);
+
+    bool       existed = false;
+    EntryData* pData   = nullptr;
+    Result     result  = m_entries.FindAllocate(key, &existed, &pData);
+
+    if ((result == Result::Success) && (existed == false))
+    {
+        void* pCopy = PAL_MALLOC(binarySize, m_pPlatform, AllocInternal);
+
+        if (pCopy != nullptr)
+        {
+            memcpy(pCopy, pBinary, binarySize);
+
+            pData->pBinary    = pCopy;
+            pData->binarySize = binarySize;
+
+            m_totalDataSize += binarySize;
+        }
+        else
+        {
+            m_entries.Erase(key);
+            result = Result::ErrorOutOfMemory;
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Adds a pipeline ELF binary to the cache, keyed by the pipeline's compiler hash and the owning device's settings hash.
+Result ShaderCache::AddPipelineBinary(
+    uint64      compilerHash,
+    const void* pPipelineBinary,
+    size_t      pipelineBinarySize)
+{
+    Result result = Result::ErrorInvalidPointer;
+
+    if (pPipelineBinary != nullptr)
+    {
+        const EntryKey key = { compilerHash, m_device.GetSettingsHash() };
+        result = AddEntry(key, pPipelineBinary, pipelineBinarySize);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+Result ShaderCache::FindPipelineBinary(
+    uint64       compilerHash,
+    const void** ppPipelineBinary,
+    size_t*      pPipelineBinarySize)
+{
+    Result result = Result::ErrorInvalidPointer;
+
+    if ((ppPipelineBinary != nullptr) && (pPipelineBinarySize != nullptr))
+    {
+        const EntryKey key = { compilerHash, m_device.GetSettingsHash() };
+
+        RWLockAuto<RWLock::ReadOnly> lock(&m_lock);
+
+        const EntryData*const pData = m_entries.FindKey(key);
+
+        if (pData != nullptr)
+        {
+            (*ppPipelineBinary)    = pData->pBinary;
+            (*pPipelineBinarySize) = pData->binarySize;
+
+            AtomicAdd64(&m_numHits, 1);
+            result = Result::Success;
+        }
+        else
+        {
+            result = Result::NotFound;
+        }
+    }
+
+    if ((result == Result::NotFound) && (m_pDiskCache != nullptr))
+    {
+        // Pull the binary from the disk cache into memory, so the returned pointer stays valid after the file view is
+        // unmapped.
+        FileView    view;
+        const void* pBinary    = nullptr;
+        size_t      binarySize = 0;
+
+        Result diskResult = m_pDiskCache->FindPipelineBinary(compilerHash, &view, &pBinary, &binarySize);
+
+        if (diskResult == Result::Success)
+        {
+            diskResult = AddPipelineBinary(compilerHash, pBinary, binarySize);
+            view.UnMap(false);
+        }
+
+        if (diskResult == Result::Success)
+        {
+            const EntryKey key = { compilerHash, m_device.GetSettingsHash() };
+
+            RWLockAuto<RWLock::ReadOnly> lock(&m_lock);
+
+            const EntryData*const pData = m_entries.FindKey(key);
+            PAL_ASSERT(pData != nullptr);
+
+            (*ppPipelineBinary)    = pData->pBinary;
+            (*pPipelineBinarySize) = pData->binarySize;
+
+            AtomicAdd64(&m_numHits, 1);
+            result = Result::Success;
+        }
+    }
+
+    if (result == Result::NotFound)
+    {
+        AtomicAdd64(&m_numMisses, 1);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+void ShaderCache::GetStats(
+    ShaderCacheStats* pStats
+    ) const
+{
+    PAL_ASSERT(pStats != nullptr);
+
+    RWLockAuto<RWLock::ReadOnly> lock(&m_lock);
+
+    pStats->numEntries    = m_entries.GetNumEntries();
+    pStats->totalDataSize = m_totalDataSize;
+    pStats->numHits       = m_numHits;
+    pStats->numMisses     = m_numMisses;
+}
+
+// =====================================================================================================================
+// Returns the number of bytes Serialize() needs to store every entry.  The caller must hold m_lock.
+size_t ShaderCache::GetSerializedSize() const
+{
+    size_t size = sizeof(SerializedCacheHeader);
+
+    for (auto iter = m_entries.Begin(); iter.Get() != nullptr; iter.Next())
+    {
+        size += Pow2Align(sizeof(SerializedCacheEntry) + iter.Get()->value.binarySize, SerializedEntryAlignment);
+    }
+
+    return size;
+}
+
 // =====================================================================================================================
 Result ShaderCache::Serialize(
     void*   pBlob,
     size_t* pSize)
 {
-    return Result::ErrorUnavailable;
+    Result result = Result::ErrorInvalidPointer;
+
+    if (pSize != nullptr)
+    {
+        RWLockAuto<RWLock::ReadOnly> lock(&m_lock);
+
+        const size_t requiredSize = GetSerializedSize();
+
+        if ((*pSize) == 0)
+        {
+            (*pSize) = requiredSize;
+            result   = Result::NotReady;
+        }
+        else if (pBlob == nullptr)
+        {
+            result = Result::ErrorInvalidPointer;
+        }
+        else if ((*pSize) < requiredSize)
+        {
+            result = Result::ErrorInvalidMemorySize;
+        }
+        else
+        {
+            auto*const pHeader = static_cast<SerializedCacheHeader*>(pBlob);
+
+            pHeader->magic      = SerializedCacheMagic;
+            pHeader->version    = SerializedCacheVersion;
+            pHeader->deviceId   = m_device.ChipProperties().deviceId;
+            pHeader->numEntries = m_entries.GetNumEntries();
+            Pipeline::GetBuildId(&pHeader->buildId);
+
+            void* pCur = VoidPtrInc(pBlob, sizeof(SerializedCacheHeader));
+
+            for (auto iter = m_entries.Begin(); iter.Get() != nullptr; iter.Next())
+            {
+                const EntryKey&  key  = iter.Get()->key;
+                const EntryData& data = iter.Get()->value;
+
+                auto*const pEntry = static_cast<SerializedCacheEntry*>(pCur);
+                pEntry->compilerHash = key.compilerHash;
+                pEntry->settingsHash = key.settingsHash;
+                pEntry->binarySize   = data.binarySize;
+
+                void*const   pBinary   = VoidPtrInc(pCur, sizeof(SerializedCacheEntry));
+                const size_t entrySize = Pow2Align(sizeof(SerializedCacheEntry) + data.binarySize,
+                                                   SerializedEntryAlignment);
+
+                memcpy(pBinary, data.pBinary, data.binarySize);
+                memset(VoidPtrInc(pBinary, data.binarySize),
+                       0,
+                       entrySize - sizeof(SerializedCacheEntry) - data.binarySize);
+
+                pCur = VoidPtrInc(pCur, entrySize);
+            }
+
+            (*pSize) = requiredSize;
+            result   = Result::Success;
+        }
+    }
+
+    return result;
 }
 
 // =====================================================================================================================
+// Copies every entry of the source caches which this cache doesn't have yet.  Each source is serialized into a
+// temporary blob first so that this cache's lock is never held at the same time as a source cache's lock; two caches
+// being merged into each other concurrently therefore can't deadlock.
 Result ShaderCache::Merge(
     uint32               numSrcCaches,
     const IShaderCache** ppSrcCaches)
 {
-    return Result::ErrorUnavailable;
+    Result result = Result::Success;
+
+    for (uint32 i = 0; (i < numSrcCaches) && (result == Result::Success); ++i)
+    {
+        // IShaderCache::Serialize() is non-const, but it doesn't modify the cache.
+        ShaderCache*const pSrcCache = const_cast<ShaderCache*>(static_cast<const ShaderCache*>(ppSrcCaches[i]));
+
+        if ((pSrcCache != nullptr) && (pSrcCache != this))
+        {
+            // The source may grow between querying its size and serializing it, so retry until the blob is large
+            // enough.
+            void*  pBlob    = nullptr;
+            size_t blobSize = 0;
+
+            do
+            {
+                PAL_SAFE_FREE(pBlob, m_pPlatform);
+
+                blobSize = 0;
+                pSrcCache->Serialize(nullptr, &blobSize);
+
+                pBlob = PAL_MALLOC(blobSize, m_pPlatform, AllocInternalTemp);
+
+                result = (pBlob != nullptr) ? pSrcCache->Serialize(pBlob, &blobSize) : Result::ErrorOutOfMemory;
+            } while (result == Result::ErrorInvalidMemorySize);
+
+            if (result == Result::Success)
+            {
+                result = LoadInitialData(pBlob, blobSize);
+            }
+
+            PAL_SAFE_FREE(pBlob, m_pPlatform);
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Frees the pipeline binaries owned by every entry.  The caller is responsible for emptying m_entries afterwards.
+void ShaderCache::FreeEntries()
+{
+    for (auto iter = m_entries.Begin(); iter.Get() != nullptr; iter.Next())
+    {
+        PAL_FREE(iter.Get()->value.pBinary, m_pPlatform);
+    }
 }
 
 // =====================================================================================================================
 void ShaderCache::Reset()
 {
+    RWLockAuto<RWLock::ReadWrite> lock(&m_lock);
+
+    FreeEntries();
+    m_entries.Reset();
+
+    m_totalDataSize = 0;
+    m_numHits       = 0;
+    m_numMisses     = 0;
 }
 
 } // Pal
@@ -24,6 +24,9 @@
 
 #pragma once
 
+#include "palGrowableHashMap.h"
+#include "palMetroHash.h"
+#include "palMutex.h"
 #include "palShader.h"
 #include "palShaderCache.h"
 
@@ -31,6 +34,8 @@ namespace Pal
 {
 
 class Device;
+class PipelineDiskCache;
+class Platform;
 
 // =====================================================================================================================
 // Simple class which acts as a PAL wrapper around an SCPC shader object.  This class is only needed temporarily, and
@@ -63,8 +68,17 @@ private:
 };
 
 // =====================================================================================================================
-// Simple class which acts as a PAL wrapper around an SCPC shader cache object.  This class is only needed temporarily,
-// and can be removed from PAL after the transition to SCPC is complete.
+// In-process cache of pipeline ELF binaries.  Entries are keyed by the pipeline's compiler hash together with the
+// settings hash of the owning device, so a binary is never handed back to a device whose PAL settings differ from the
+// ones it was created with.  The binaries are stored exactly as they were passed to pipeline creation, which means any
+// cached binary can be fed straight back into IDevice::CreateComputePipeline() or IDevice::CreateGraphicsPipeline().
+//
+// All public methods are thread-safe.  Lookups only take the lock in shared mode, so concurrent pipeline creation on
+// a warm cache does not serialize on it.
+//
+// If the disk cache is enabled, the in-process cache is backed by a PipelineDiskCache shared with other processes:
+// lookups which miss in memory fall back to the disk cache, and pipelines added to the cache are also stored on disk.
+// The device's internal cache owns the PipelineDiskCache; client caches share it rather than opening the file again.
 class ShaderCache : public IShaderCache
 {
 public:
@@ -76,6 +90,18 @@ public:
     virtual Result Serialize(void* pBlob, size_t* pSize) override;
     virtual Result Merge(uint32 numSrcCaches, const IShaderCache** ppSrcCaches) override;
     virtual void Reset() override;
+    virtual Result FindPipelineBinary(
+        uint64       compilerHash,
+        const void** ppPipelineBinary,
+        size_t*      pPipelineBinarySize) override;
+    virtual void GetStats(ShaderCacheStats* pStats) const override;
+
+    Result AddPipelineBinary(
+        uint64      compilerHash,
+        const void* pPipelineBinary,
+        size_t      pipelineBinarySize);
+
+    PipelineDiskCache* GetDiskCache() const { return m_pDiskCache; }
 
     ShaderCacheGetValue GetValueFunc() const { return m_pfnGetValue; }
     ShaderCacheStoreValue StoreValueFunc() const { return m_pfnStoreValue; }
@@ -86,13 +112,46 @@ public:
         Result*                      pResult);
 
 private:
-    virtual ~ShaderCache() { }
+    virtual ~ShaderCache();
+
+    // Uniquely identifies a cached pipeline binary.
+    struct EntryKey
+    {
+        uint64                compilerHash;  // Compiler hash of the pipeline (see PipelineInfo::compilerHash).
+        Util::MetroHash::Hash settingsHash;  // Hash of the PAL settings the pipeline was created with.
+    };
+
+    // Describes the cached copy of a pipeline binary.
+    struct EntryData
+    {
+        void*  pBinary;     // Pipeline ELF binary, allocated from the platform.
+        size_t binarySize;  // Size of the pipeline ELF binary, in bytes.
+    };
+
+    typedef Util::GrowableHashMap<EntryKey, EntryData, Platform, Util::JenkinsHashFunc> EntryMap;
 
-    const Device&        m_device;
+    Result AddEntry(const EntryKey& key, const void* pBinary, size_t binarySize);
+    void   InitDiskCache();
+    Result LoadInitialData(const void* pData, size_t dataSize);
+    size_t GetSerializedSize() const;
+    void FreeEntries();
+
+    const Device&          m_device;
+    Platform*const         m_pPlatform;
 
     ShaderCacheGetValue    m_pfnGetValue;
     ShaderCacheStoreValue  m_pfnStoreValue;
 
+    PipelineDiskCache*     m_pDiskCache;      // Persistent backing store, or null if the disk cache is disabled.
+    bool                   m_ownsDiskCache;   // True if this cache created m_pDiskCache and must destroy it.
+
+    mutable Util::RWLock   m_lock;            // Serializes modification of m_entries against lookups.
+    EntryMap               m_entries;         // Maps each key to its cached pipeline binary.
+    uint64                 m_totalDataSize;   // Sum of the sizes of every binary in m_entries.
+
+    volatile uint64        m_numHits;         // Number of successful FindPipelineBinary() calls.
+    volatile uint64        m_numMisses;       // Number of FindPipelineBinary() calls which found no entry.
+
     PAL_DISALLOW_DEFAULT_CTOR(ShaderCache);
     PAL_DISALLOW_COPY_AND_ASSIGN(ShaderCache);
 };
@@ -28,6 +28,8 @@
 #include "core/hw/gfxip/gfxDevice.h"
 #include "core/hw/gfxip/palToScpcWrapper.h"
 #include "core/hw/gfxip/pipeline.h"
+#include "core/hw/gfxip/pipelineDiskCache.h"
+#include "core/hw/gfxip/pipelineUploadRing.h"
 #include "palElfPackagerImpl.h"
 #include "palFile.h"
 #include "palPipelineAbiProcessorImpl.h"
@@ -73,8 +75,8 @@ struct SerializedData
 };
 
 // =====================================================================================================================
-// Helper function which returns the time & date that pipeline.cpp was compiled.
-static void PAL_STDCALL GetBuildTime(
+// Returns the time & date that pipeline.cpp was compiled, which identifies the PAL build that serialized a pipeline.
+void Pipeline::GetBuildId(
     BuildUniqueId* pBuildId)
 {
     const char DateString[] = __DATE__;
@@ -93,6 +95,9 @@ Pipeline::Pipeline(
     m_pDevice(pDevice),
     m_gpuMem(),
     m_gpuMemSize(0),
+    m_codeGpuMem(),
+    m_codeGpuMemSize(0),
+    m_codeUploadToken(0),
     m_pPipelineBinary(nullptr),
     m_pipelineBinaryLen(0),
     m_apiHwMapping()
@@ -105,6 +110,7 @@ Pipeline::Pipeline(
     memset(&m_info, 0, sizeof(m_info));
     memset(&m_shaderMetaData, 0, sizeof(m_shaderMetaData));
     memset(&m_perfDataInfo, 0, sizeof(m_perfDataInfo));
+    memset(&m_codeKey, 0, sizeof(m_codeKey));
 }
 
 // =====================================================================================================================
@@ -116,6 +122,21 @@ Pipeline::~Pipeline()
         m_gpuMem.Update(nullptr, 0);
     }
 
+    if (m_codeGpuMem.IsBound())
+    {
+        const GfxDevice& gfxDevice = *m_pDevice->GetGfxDevice();
+
+        if (m_flags.sharedCode)
+        {
+            gfxDevice.GetShaderCodeHeap()->Release(m_codeKey);
+            m_codeGpuMem.Update(nullptr, 0);
+        }
+        else
+        {
+            gfxDevice.GetPipelineUploadRing()->Free(&m_codeGpuMem, m_codeUploadToken);
+        }
+    }
+
     {
         PAL_SAFE_FREE(m_pPipelineBinary, m_pDevice->GetPlatform());
     }
@@ -176,7 +197,7 @@ Result Pipeline::Store(
 
     header.deviceId = m_pDevice->ChipProperties().deviceId;
 
-    GetBuildTime(&header.buildId);
+    GetBuildId(&header.buildId);
 
     header.settingsHash = m_pDevice->GetSettingsHash();
 
@@ -232,7 +253,7 @@ Result Pipeline::ValidateLoad(
         else if (pHeader->generator == SerializedPipelineGenerator::Pal)
         {
             Util::BuildUniqueId buildId;
-            GetBuildTime(&buildId);
+            GetBuildId(&buildId);
 
             if ((memcmp(pHeader->buildId.buildDate, buildId.buildDate, sizeof(buildId.buildDate)) != 0) ||
                 (memcmp(pHeader->buildId.buildTime, buildId.buildTime, sizeof(buildId.buildTime)) != 0))
@@ -323,6 +344,12 @@ Result Pipeline::GetLoadedSectionData(
 // =====================================================================================================================
 // Allocates GPU memory for this pipeline and uploads the code and data contain in the ELF binary to it.  Any ELF
 // relocations are also applied to the memory during this operation.
+//
+// The code addresses the data section relative to itself, so the two must stay in one allocation.  For pipelines
+// without a data section, the code can be placed elsewhere: if the device has a ShaderCodeHeap, the code goes there so
+// that pipelines with identical code share a single copy of it.  Otherwise, if the device has a PipelineUploadRing, the
+// code is placed in its own invisible allocation and copied by the DMA engine.  The (relocated) data section and the
+// performance data buffers always go in private memory.
 Result Pipeline::PerformRelocationsAndUploadToGpuMemory(
     const AbiProcessor& abiProcessor,
     gpusize*            pCodeGpuVirtAddr,
@@ -347,43 +374,103 @@ Result Pipeline::PerformRelocationsAndUploadToGpuMemory(
     size_t      codeLength  = 0;
     abiProcessor.GetPipelineCode(&pCodeBuffer, &codeLength);
 
-    createInfo.size = codeLength;
-
     const void* pDataBuffer   = nullptr;
     size_t      dataLength    = 0;
     gpusize     dataAlignment = 0;
 
     abiProcessor.GetData(&pDataBuffer, &dataLength, &dataAlignment);
 
+    Result result = Result::Success;
+
+    const GfxDevice&         gfxDevice   = *m_pDevice->GetGfxDevice();
+    ShaderCodeHeap*const     pCodeHeap   = gfxDevice.GetShaderCodeHeap();
+    PipelineUploadRing*const pUploadRing = gfxDevice.GetPipelineUploadRing();
+
+    // The code expects the data section to immediately follow it at the next dataAlignment boundary, so it can only be
+    // moved to a separate allocation if there is no data section.
+    const bool canSeparateCode = (codeLength > 0) && (dataLength == 0);
+
+    if ((pCodeHeap != nullptr) && canSeparateCode)
+    {
+        if (pCodeHeap->Acquire(pCodeBuffer, codeLength, &m_codeKey, &m_codeGpuMem) == Result::Success)
+        {
+            m_flags.sharedCode = 1;
+        }
+        else
+        {
+            // Fall back to an unshared copy of the code.
+            PAL_ALERT_ALWAYS();
+        }
+    }
+
+    if ((m_codeGpuMem.IsBound() == false) && (pUploadRing != nullptr) && canSeparateCode)
+    {
+        if (pUploadRing->AllocateAndUpload(pCodeBuffer,
+                                           codeLength,
+                                           GpuMemByteAlign,
+                                           &m_codeGpuMem,
+                                           &m_codeUploadToken) != Result::Success)
+        {
+            // Fall back to uploading the code with the CPU.
+            PAL_ALERT_ALWAYS();
+        }
+    }
+
+    const bool separateCode = m_codeGpuMem.IsBound();
+
+    if (separateCode)
+    {
+        m_codeGpuMemSize = codeLength;
+    }
+
+    createInfo.size = separateCode ? 0 : codeLength;
+
+    gpusize dataOffset = 0;
     if (dataLength > 0)
     {
-        createInfo.size += Pow2Align(dataLength, dataAlignment);
+        dataOffset      = Pow2Align(createInfo.size, dataAlignment);
+        createInfo.size = dataOffset + dataLength;
     }
 
     const gpusize perfDataOffset = createInfo.size;
     createInfo.size += PerformanceDataSize(abiProcessor);
 
-    GpuMemory* pGpuMem = nullptr;
-    gpusize    offset  = 0;
-    Result result = m_pDevice->MemMgr()->AllocateGpuMem(createInfo, internalInfo, false, &pGpuMem, &offset);
-    if (result == Result::Success)
+    if (createInfo.size > 0)
     {
-        m_gpuMemSize = createInfo.size;
-        m_gpuMem.Update(pGpuMem, offset);
+        GpuMemory* pGpuMem = nullptr;
+        gpusize    offset  = 0;
 
+        result = m_pDevice->MemMgr()->AllocateGpuMem(createInfo, internalInfo, false, &pGpuMem, &offset);
+        if (result == Result::Success)
+        {
+            m_gpuMemSize = createInfo.size;
+            m_gpuMem.Update(pGpuMem, offset);
+        }
+    }
+
+    if (separateCode)
+    {
+        (*pCodeGpuVirtAddr) = m_codeGpuMem.GpuVirtAddr();
+    }
+
+    if ((result == Result::Success) && m_gpuMem.IsBound())
+    {
         void* pMappedPtr = nullptr;
         result = m_gpuMem.Map(&pMappedPtr);
         if (result == Result::Success)
         {
-            (*pCodeGpuVirtAddr) = m_gpuMem.GpuVirtAddr();
-            memcpy(pMappedPtr, pCodeBuffer, codeLength);
+            if (separateCode == false)
+            {
+                (*pCodeGpuVirtAddr) = m_gpuMem.GpuVirtAddr();
+                memcpy(pMappedPtr, pCodeBuffer, codeLength);
+            }
 
             if (dataLength > 0)
             {
-                void* pDataPtr = VoidPtrAlign(VoidPtrInc(pMappedPtr, codeLength), static_cast<size_t>(dataAlignment));
+                void* pDataPtr = VoidPtrInc(pMappedPtr, static_cast<size_t>(dataOffset));
                 memcpy(pDataPtr, pDataBuffer, dataLength);
 
-                (*pDataGpuVirtAddr) = ((*pCodeGpuVirtAddr) + Pow2Align(codeLength, dataAlignment));
+                (*pDataGpuVirtAddr) = (m_gpuMem.GpuVirtAddr() + dataOffset);
                 abiProcessor.ApplyRelocations(pDataPtr, dataLength, Abi::AbiSectionType::Data, (*pDataGpuVirtAddr));
             }
 
@@ -466,15 +553,32 @@ Result Pipeline::QueryAllocationInfo(
 
     if (pNumEntries != nullptr)
     {
-        (*pNumEntries) = 1;
+        size_t numEntries = 0;
+
+        if (m_gpuMem.IsBound())
+        {
+            if (pGpuMemList != nullptr)
+            {
+                pGpuMemList[numEntries].offset     = m_gpuMem.Offset();
+                pGpuMemList[numEntries].pGpuMemory = m_gpuMem.Memory();
+                pGpuMemList[numEntries].size       = m_gpuMemSize;
+            }
+            ++numEntries;
+        }
 
-        if (pGpuMemList != nullptr)
+        if (m_codeGpuMem.IsBound())
         {
-            pGpuMemList[0].offset     = m_gpuMem.Offset();
-            pGpuMemList[0].pGpuMemory = m_gpuMem.Memory();
-            pGpuMemList[0].size       = m_gpuMemSize;
+            if (pGpuMemList != nullptr)
+            {
+                pGpuMemList[numEntries].offset     = m_codeGpuMem.Offset();
+                pGpuMemList[numEntries].pGpuMemory = m_codeGpuMem.Memory();
+                pGpuMemList[numEntries].size       = m_codeGpuMemSize;
+            }
+            ++numEntries;
         }
 
+        (*pNumEntries) = numEntries;
+
         result = Result::Success;
     }
 
@@ -599,11 +703,40 @@ Result Pipeline::AddShadersToCache(
     PAL_ASSERT(pShaderCache != nullptr);
     Result result = Result::ErrorUnavailable;
 
-    // NOTE: There's currently no way to extract entries for a shader cache from a precompiled pipeline binary.
+    // NOTE: There's currently no way to extract entries for individual shaders from a precompiled pipeline binary, so
+    // the whole pipeline ELF is cached instead.  The ELF is cached exactly as it was provided at creation time, before
+    // any relocations were applied, so it can be used to create this pipeline again on a later run.
+    if (m_pPipelineBinary != nullptr)
+    {
+        // The layers unwrap client shader caches (see NextShaderCache()), so this is always a core shader cache.
+        ShaderCache*const pCache = static_cast<ShaderCache*>(pShaderCache);
+
+        result = pCache->AddPipelineBinary(m_info.compilerHash, m_pPipelineBinary, m_pipelineBinaryLen);
+
+        // Pipelines which another process already stored on disk are not serialized again.
+        if ((result == Result::Success) && (pCache->GetDiskCache() != nullptr))
+        {
+            result = pCache->GetDiskCache()->AddPipeline(m_info.compilerHash, this);
+        }
+    }
 
     return result;
 }
 
+// =====================================================================================================================
+// Helper method called once a client pipeline has been successfully created, which records its binary in the shader
+// cache provided at creation time.  Only the client can look binaries up, so pipelines created without a shader cache
+// aren't cached anywhere.  Failing to cache the binary only costs a future cache miss, so errors are not reported to
+// the caller.
+void Pipeline::AddBinaryToShaderCache(
+    IShaderCache* pShaderCache)
+{
+    if ((pShaderCache != nullptr) && (IsInternal() == false) && (AddShadersToCache(pShaderCache) != Result::Success))
+    {
+        PAL_ALERT_ALWAYS();
+    }
+}
+
 // =====================================================================================================================
 // Helper method which extracts shader statistics from the pipeline ELF binary for a particular hardware stage.
 Result Pipeline::GetShaderStatsForStage(
@@ -27,6 +27,7 @@
 
 #include "core/device.h"
 #include "core/gpuMemory.h"
+#include "core/hw/gfxip/shaderCodeHeap.h"
 #include "palElfPackager.h"
 #include "palLib.h"
 #include "palMetroHash.h"
@@ -111,6 +112,7 @@ public:
     virtual Result Store(size_t* pDataSize, void* pData) override;
     Result Store(Util::ElfWriteContext<Platform>* pContext);
 
+    static void    GetBuildId(Util::BuildUniqueId* pBuildId);
     static Result  ValidateLoad(const Device* pDevice, const Util::ElfReadContext<Platform>& context);
     virtual Result LoadInit(const Util::ElfReadContext<Platform>& context);
 
@@ -154,6 +156,8 @@ protected:
 
     bool IsInternal() const { return m_flags.isInternal != 0; }
 
+    void AddBinaryToShaderCache(IShaderCache* pShaderCache);
+
     Result PerformRelocationsAndUploadToGpuMemory(
         const AbiProcessor& abiProcessor,
         gpusize*            pCodeGpuVirtAddr,
@@ -189,8 +193,12 @@ protected:
     PipelineInfo    m_info;             // Public info structure available to the client.
     ShaderMetadata  m_shaderMetaData;   // Metadata flags for each shader type.
 
-    BoundGpuMemory  m_gpuMem;
+    BoundGpuMemory  m_gpuMem;           // Private memory for the data section, perf data and (if unshared) the code.
     gpusize         m_gpuMemSize;
+    BoundGpuMemory  m_codeGpuMem;       // Code stored outside of m_gpuMem (shared or uploaded by DMA), if any.
+    gpusize         m_codeGpuMemSize;
+    ShaderCodeKey   m_codeKey;          // Identifies the shared code in the ShaderCodeHeap.
+    uint64          m_codeUploadToken;  // PipelineUploadRing batch which uploads unshared code, if any.
 
     void*   m_pPipelineBinary;      // Buffer containing the pipeline binary data (Pipeline ELF ABI).
     size_t  m_pipelineBinaryLen;    // Size of the pipeline binary data, in bytes.
@@ -205,7 +213,8 @@ private:
         struct
         {
             uint32  isInternal       :  1;  // True if this Pipeline object was created internally by PAL.
-            uint32  reserved         : 31;
+            uint32  sharedCode       :  1;  // True if m_codeGpuMem is owned by the device's ShaderCodeHeap.
+            uint32  reserved         : 30;
         };
         uint32  value;  // Flags packed as a uint32.
     } m_flags;
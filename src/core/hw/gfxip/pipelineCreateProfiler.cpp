@@ -0,0 +1,175 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+#include "core/internalMemMgr.h"
+#include "core/hw/gfxip/pipelineCreateProfiler.h"
+#include "palDbgPrint.h"
+#include "palInlineFuncs.h"
+#include "palMutex.h"
+#include "palSysUtil.h"
+
+using namespace Util;
+
+namespace Pal
+{
+
+// =====================================================================================================================
+PipelineCreateProfiler::PipelineCreateProfiler()
+    :
+    m_enabled(false),
+    m_firstStartTime(0),
+    m_lastEndTime(0),
+    m_maxTime(0),
+    m_totalTime(0),
+    m_baseLockContentions(0),
+    m_baseLockWaitTime(0)
+{
+    memset(const_cast<uint64*>(&m_numPipelines[0]),     0, sizeof(m_numPipelines));
+    memset(const_cast<uint64*>(&m_latencyHistogram[0]), 0, sizeof(m_latencyHistogram));
+}
+
+// =====================================================================================================================
+void PipelineCreateProfiler::Enable(
+    InternalMemMgr* pMemMgr)
+{
+    pMemMgr->EnableLockProfiling();
+
+    m_baseLockContentions = pMemMgr->GetAllocatorLockContentions();
+    m_baseLockWaitTime    = pMemMgr->GetAllocatorLockWaitTime();
+    m_enabled             = true;
+}
+
+// =====================================================================================================================
+// Records one pipeline creation call which began at startTime and ends now.
+void PipelineCreateProfiler::Record(
+    PipelineCreateType type,
+    int64              startTime)
+{
+    PAL_ASSERT(type < PipelineCreateType::Count);
+
+    if (m_enabled)
+    {
+        const uint64 endTime  = static_cast<uint64>(GetPerfCpuTime());
+        const uint64 duration = endTime - static_cast<uint64>(startTime);
+
+        AtomicAdd64(&m_numPipelines[static_cast<uint32>(type)], 1);
+        AtomicAdd64(&m_totalTime, duration);
+
+        const uint64 micros = (duration * 1000000ull) / static_cast<uint64>(GetPerfFrequency());
+        const uint32 bucket = (micros > 0) ? Min(Log2(micros), PipelineCreateLatencyBuckets - 1) : 0;
+        AtomicAdd64(&m_latencyHistogram[bucket], 1);
+
+        // There is no 64-bit atomic min/max, so the remaining values are only approximate when creation calls race.
+        // That's acceptable for throughput numbers gathered over thousands of pipelines.
+        if ((m_firstStartTime == 0) || (static_cast<uint64>(startTime) < m_firstStartTime))
+        {
+            AtomicExchange64(&m_firstStartTime, static_cast<uint64>(startTime));
+        }
+
+        if (endTime > m_lastEndTime)
+        {
+            AtomicExchange64(&m_lastEndTime, endTime);
+        }
+
+        if (duration > m_maxTime)
+        {
+            AtomicExchange64(&m_maxTime, duration);
+        }
+    }
+}
+
+// =====================================================================================================================
+void PipelineCreateProfiler::GetStats(
+    const InternalMemMgr& memMgr,
+    PipelineCreateStats*  pStats
+    ) const
+{
+    PAL_ASSERT(pStats != nullptr);
+
+    for (uint32 idx = 0; idx < static_cast<uint32>(PipelineCreateType::Count); ++idx)
+    {
+        pStats->numPipelines[idx] = m_numPipelines[idx];
+    }
+
+    pStats->totalTime             = m_totalTime;
+    pStats->maxTime               = m_maxTime;
+    pStats->wallTime              = (m_lastEndTime > m_firstStartTime) ? (m_lastEndTime - m_firstStartTime) : 0;
+    pStats->memMgrLockContentions = memMgr.GetAllocatorLockContentions() - m_baseLockContentions;
+    pStats->memMgrLockWaitTime    = memMgr.GetAllocatorLockWaitTime() - m_baseLockWaitTime;
+
+    for (uint32 idx = 0; idx < PipelineCreateLatencyBuckets; ++idx)
+    {
+        pStats->latencyHistogram[idx] = m_latencyHistogram[idx];
+    }
+}
+
+// =====================================================================================================================
+// Prints the collected statistics.  Does nothing if the profiler is disabled or no pipelines were created.
+void PipelineCreateProfiler::Report(
+    const InternalMemMgr& memMgr
+    ) const
+{
+#if PAL_ENABLE_PRINTS_ASSERTS
+    PipelineCreateStats stats = {};
+    GetStats(memMgr, &stats);
+
+    const uint64 numGraphics  = stats.numPipelines[static_cast<uint32>(PipelineCreateType::Graphics)];
+    const uint64 numCompute   = stats.numPipelines[static_cast<uint32>(PipelineCreateType::Compute)];
+    const uint64 numLoaded    = stats.numPipelines[static_cast<uint32>(PipelineCreateType::Load)];
+    const uint64 numPipelines = numGraphics + numCompute + numLoaded;
+
+    if (m_enabled && (numPipelines > 0))
+    {
+        const double ticksPerMs = static_cast<double>(GetPerfFrequency()) / 1000.0;
+        const double wallMs     = stats.wallTime / ticksPerMs;
+
+        PAL_DPINFO("Pipeline creation: %llu graphics + %llu compute + %llu loaded in %.3f ms (%.1f pipelines/s)",
+                   numGraphics,
+                   numCompute,
+                   numLoaded,
+                   wallMs,
+                   (wallMs > 0.0) ? ((numPipelines * 1000.0) / wallMs) : 0.0);
+        PAL_DPINFO("Pipeline creation latency: average %.3f ms, max %.3f ms",
+                   (stats.totalTime / ticksPerMs) / numPipelines,
+                   stats.maxTime / ticksPerMs);
+
+        for (uint32 idx = 0; idx < PipelineCreateLatencyBuckets; ++idx)
+        {
+            if (stats.latencyHistogram[idx] > 0)
+            {
+                PAL_DPINFO("    %8llu us - %8llu us: %llu",
+                           (idx == 0) ? 0ull : (1ull << idx),
+                           (1ull << (idx + 1)),
+                           stats.latencyHistogram[idx]);
+            }
+        }
+
+        PAL_DPINFO("Internal memory manager lock: %llu contended acquisitions, %.3f ms waiting",
+                   stats.memMgrLockContentions,
+                   stats.memMgrLockWaitTime / ticksPerMs);
+    }
+#endif
+}
+
+} // Pal
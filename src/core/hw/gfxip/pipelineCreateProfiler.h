@@ -0,0 +1,95 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include "pal.h"
+
+namespace Pal
+{
+
+class InternalMemMgr;
+
+// Identifies the kind of pipeline creation call being profiled.
+enum class PipelineCreateType : uint32
+{
+    Graphics = 0,  // IDevice::CreateGraphicsPipeline()
+    Compute,       // IDevice::CreateComputePipeline()
+    Load,          // IDevice::LoadPipeline()
+    Count
+};
+
+// Number of buckets in the pipeline creation latency histogram.  Bucket N counts the creations which took between
+// 2^N and 2^(N+1) microseconds; the first bucket also counts anything faster and the last bucket anything slower.
+constexpr uint32 PipelineCreateLatencyBuckets = 24;
+
+// Statistics about client pipeline creation collected by a PipelineCreateProfiler.  All times are in ticks of
+// Util::GetPerfCpuTime().
+struct PipelineCreateStats
+{
+    uint64 numPipelines[static_cast<uint32>(PipelineCreateType::Count)];  // Successful calls of each type.
+    uint64 totalTime;              // Sum of the time spent in every creation call.
+    uint64 maxTime;                // Duration of the slowest creation call.
+    uint64 wallTime;               // Approximate time between the start of the first and the end of the last call.
+    uint64 memMgrLockContentions;  // Number of times the internal memory manager's lock was contended.
+    uint64 memMgrLockWaitTime;     // Total time spent waiting for the internal memory manager's lock.
+    uint64 latencyHistogram[PipelineCreateLatencyBuckets];
+};
+
+// =====================================================================================================================
+// Collects throughput and latency statistics for client pipeline creation when the PipelineCreateProfilingEnable
+// setting is set.  Everything is tracked with atomics so that the profiler itself doesn't serialize the multi-threaded
+// creation paths it is meant to measure.  The statistics are reported through the debug print interface when the
+// device is cleaned up.
+class PipelineCreateProfiler
+{
+public:
+    PipelineCreateProfiler();
+    ~PipelineCreateProfiler() { }
+
+    void Enable(InternalMemMgr* pMemMgr);
+    bool IsEnabled() const { return m_enabled; }
+
+    void Record(PipelineCreateType type, int64 startTime);
+
+    void GetStats(const InternalMemMgr& memMgr, PipelineCreateStats* pStats) const;
+    void Report(const InternalMemMgr& memMgr) const;
+
+private:
+    bool            m_enabled;
+    volatile uint64 m_firstStartTime;
+    volatile uint64 m_lastEndTime;
+    volatile uint64 m_maxTime;
+    volatile uint64 m_totalTime;
+    volatile uint64 m_numPipelines[static_cast<uint32>(PipelineCreateType::Count)];
+    volatile uint64 m_latencyHistogram[PipelineCreateLatencyBuckets];
+
+    // Lock statistics from before profiling began, so that only the contention during profiling is reported.
+    uint64          m_baseLockContentions;
+    uint64          m_baseLockWaitTime;
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(PipelineCreateProfiler);
+};
+
+} // Pal
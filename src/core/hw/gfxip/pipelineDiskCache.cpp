@@ -0,0 +1,566 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+#include "core/device.h"
+#include "core/platform.h"
+#include "core/hw/gfxip/pipeline.h"
+#include "core/hw/gfxip/pipelineDiskCache.h"
+#include "palDbgPrint.h"
+#include "palElfPackagerImpl.h"
+#include "palGrowableHashMapImpl.h"
+#include "palMetroHash.h"
+#include "palSysUtil.h"
+
+using namespace Util;
+
+namespace Pal
+{
+
+// Identifies a pipeline disk cache file.  Spells "PALD" in memory.
+static constexpr uint32 DiskCacheFileMagic   = 0x444C4150;
+// Incremented whenever the layout of the pipeline disk cache file changes.
+static constexpr uint32 DiskCacheFileVersion = 1;
+
+// Marks a record whose data is still being written.  Such records are skipped when building the index.
+static constexpr uint32 RecordPendingMagic   = 0x50434552;
+// Marks a record which has been completely written.
+static constexpr uint32 RecordValidMagic     = 0x56434552;
+
+// Records are padded so that every record header is naturally aligned.
+static constexpr size_t RecordAlignment      = sizeof(uint64);
+
+// Size of a newly created cache file.  The file grows as needed.
+static constexpr size_t InitialFileSize      = 1024 * 1024;
+
+// Number of records the index can hold before it needs to grow for the first time.
+static constexpr uint32 InitialIndexCapacity = 256;
+
+// Index value of a pipeline which is being written to the file by a thread in this process.
+static constexpr size_t PendingRecordOffset  = MemMapFile::InvalidOffset;
+
+// A record which stays incomplete for this long is assumed to be abandoned by a writer which died or couldn't grow the
+// file, and is skipped.
+static constexpr uint32 IncompleteRecordTimeoutMs = 5000;
+
+// Written once at the start of the storage.  A file created by a different device or PAL build is discarded when it is
+// opened, since none of its records could pass validation anyway and the log would otherwise grow forever.
+struct DiskCacheFileHeader
+{
+    uint32        magic;     // Must equal DiskCacheFileMagic.
+    uint32        version;   // Must equal DiskCacheFileVersion.
+    uint32        deviceId;  // As in DeviceProperties.
+    uint32        reserved;
+    BuildUniqueId buildId;   // Identifies the PAL build which created the file.
+};
+
+// Precedes the output of Pipeline::Store() for each cached pipeline.
+struct DiskCacheRecordHeader
+{
+    uint32          magic;         // RecordPendingMagic or RecordValidMagic.
+    uint32          reserved;
+    uint64          compilerHash;  // Compiler hash of the stored pipeline (see PipelineInfo::compilerHash).
+    MetroHash::Hash settingsHash;  // Hash of the PAL settings the pipeline was created with.
+    uint64          dataSize;      // Size of the Pipeline::Store() data following this header, in bytes.
+    uint64          dataChecksum;  // MetroHash64 of the Pipeline::Store() data.
+};
+
+// Storage offset of the first record.
+static constexpr size_t FirstRecordOffset =
+    ((sizeof(DiskCacheFileHeader) + RecordAlignment - 1) / RecordAlignment) * RecordAlignment;
+
+// =====================================================================================================================
+PipelineDiskCache::PipelineDiskCache(
+    const Device& device)
+    :
+    m_device(device),
+    m_index(InitialIndexCapacity, device.GetPlatform()),
+    m_scannedEnd(FirstRecordOffset),
+    m_incompleteOffset(MemMapFile::InvalidOffset),
+    m_incompleteTime(0)
+{
+    m_fileName[0] = '\0';
+}
+
+// =====================================================================================================================
+// Opens (or creates) the cache file for this device in the given directory and indexes its records.
+Result PipelineDiskCache::Init(
+    const char* pDirectory)  // Directory which holds the cache file.  Must end with a path separator.
+{
+    Result result = m_lock.Init();
+
+    if (result == Result::Success)
+    {
+        result = m_index.Init();
+    }
+
+    if (result == Result::Success)
+    {
+        result = MkDirRecursively(pDirectory);
+        result = (result == Result::AlreadyExists) ? Result::Success : result;
+    }
+
+    if (result == Result::Success)
+    {
+        Snprintf(&m_fileName[0],
+                 sizeof(m_fileName),
+                 "%sPipelineCache_%x.bin",
+                 pDirectory,
+                 m_device.ChipProperties().deviceId);
+
+        result = OpenFile(false);
+
+        if ((result != Result::Success) || (ValidateFileHeader() != Result::Success))
+        {
+            // The file is corrupt or was created by a different device or PAL build: start over with an empty log.
+            m_file.CloseStorageFile();
+            result = OpenFile(true);
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        MutexAuto lock(&m_lock);
+        RefreshIndex();
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Maps the cache file and writes the file header if the storage is empty.
+Result PipelineDiskCache::OpenFile(
+    bool discardContents)  // If true, the existing contents of the file are thrown away.
+{
+    const bool   keepContents = (discardContents == false) && File::Exists(&m_fileName[0]);
+    const uint32 accessFlags  = StorageAccessModeFlags::Writeable                                           |
+                                StorageAccessModeFlags::AllowGrowth                                         |
+                                (discardContents ? StorageAccessModeFlags::DiscardContents : 0);
+
+    Result result = m_file.OpenStorageFile(accessFlags,
+                                           (keepContents ? 0 : InitialFileSize),
+                                           &m_fileName[0],
+                                           nullptr);
+
+    if ((result == Result::Success) && (m_file.GetUsedStorageSize() == 0))
+    {
+        // If another process is creating the file at the same time, only the one which reserves offset zero writes the
+        // header.  The space reserved by the other is zero-filled, so RefreshIndex() eventually skips it.
+        FileView view;
+        size_t   offset = 0;
+        result = m_file.ReserveStorageSpace(FirstRecordOffset, &offset, &view);
+
+        if ((result == Result::Success) && (offset == 0))
+        {
+            auto*const pHeader = static_cast<DiskCacheFileHeader*>(view.Ptr());
+
+            memset(pHeader, 0, FirstRecordOffset);
+            pHeader->magic    = DiskCacheFileMagic;
+            pHeader->version  = DiskCacheFileVersion;
+            pHeader->deviceId = m_device.ChipProperties().deviceId;
+            Pipeline::GetBuildId(&pHeader->buildId);
+
+            view.UnMap(false);
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Checks that the cache file was created by this device and PAL build.
+Result PipelineDiskCache::ValidateFileHeader() const
+{
+    Result result = Result::ErrorIncompatibleLibrary;
+
+    const size_t usedSize = m_file.GetUsedStorageSize();
+
+    if ((usedSize != MemMapFile::InvalidOffset) && (usedSize >= FirstRecordOffset))
+    {
+        FileView view;
+
+        if (m_file.GetExistingStorage(0, sizeof(DiskCacheFileHeader), &view) == Result::Success)
+        {
+            const auto*const pHeader = static_cast<const DiskCacheFileHeader*>(view.Ptr());
+
+            BuildUniqueId buildId;
+            Pipeline::GetBuildId(&buildId);
+
+            if ((pHeader->magic    == DiskCacheFileMagic)                &&
+                (pHeader->version  == DiskCacheFileVersion)              &&
+                (pHeader->deviceId == m_device.ChipProperties().deviceId) &&
+                (memcmp(&pHeader->buildId, &buildId, sizeof(BuildUniqueId)) == 0))
+            {
+                result = Result::Success;
+            }
+
+            view.UnMap(false);
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Adds every record which was appended since the last refresh (by this or any other process) to the index.  The caller
+// must hold m_lock.
+void PipelineDiskCache::RefreshIndex()
+{
+    bool reloaded = false;
+
+    if (m_file.ReloadIfNeeded(&reloaded) == Result::Success)
+    {
+        // Space which was reserved but couldn't be backed by the file must never be accessed.
+        size_t usedSize = m_file.GetUsedStorageSize();
+        if (usedSize != MemMapFile::InvalidOffset)
+        {
+            usedSize = Min(usedSize, m_file.GetStorageSize());
+        }
+
+        if ((usedSize != MemMapFile::InvalidOffset) && (usedSize > m_scannedEnd))
+        {
+            FileView view;
+
+            if (m_file.GetExistingStorage(m_scannedEnd, usedSize - m_scannedEnd, &view) == Result::Success)
+            {
+                const MetroHash::Hash settingsHash = m_device.GetSettingsHash();
+
+                size_t offset       = m_scannedEnd;
+                bool   stopScanning = false;
+
+                while ((stopScanning == false) && ((offset + sizeof(DiskCacheRecordHeader)) <= usedSize))
+                {
+                    const auto*const pRecord =
+                        static_cast<const DiskCacheRecordHeader*>(VoidPtrInc(view.Ptr(), offset - m_scannedEnd));
+
+                    const size_t remaining  = usedSize - offset - sizeof(DiskCacheRecordHeader);
+                    const size_t recordSize = Pow2Align(sizeof(DiskCacheRecordHeader) +
+                                                        static_cast<size_t>(pRecord->dataSize), RecordAlignment);
+                    size_t       nextOffset = offset;
+                    bool         resync     = false;
+
+                    if (((pRecord->magic != 0) && (pRecord->magic != RecordPendingMagic) &&
+                         (pRecord->magic != RecordValidMagic)) ||
+                        ((pRecord->magic != 0) && (pRecord->dataSize > remaining)))
+                    {
+                        // Space is reserved atomically, so this means the file itself is damaged.
+                        PAL_ALERT_ALWAYS();
+                        resync = true;
+                    }
+                    else if (pRecord->magic != RecordValidMagic)
+                    {
+                        // The record is still being written, unless its writer has gone away.  A reserved record whose
+                        // header was never written can't tell us its size.
+                        if (SkipIncompleteRecord(offset))
+                        {
+                            resync     = (pRecord->magic == 0);
+                            nextOffset = resync ? offset : (offset + recordSize);
+                        }
+                    }
+                    else
+                    {
+                        if (memcmp(&pRecord->settingsHash, &settingsHash, sizeof(MetroHash::Hash)) == 0)
+                        {
+                            // If the same pipeline was stored more than once, the oldest record wins.
+                            m_index.Insert(pRecord->compilerHash, offset);
+                        }
+
+                        nextOffset = offset + recordSize;
+                    }
+
+                    if (resync)
+                    {
+                        // Resume at the next record which is complete and intact.  Stale data which merely looks like
+                        // a record header won't pass the checksum.  If there is none yet, stay put and try again on
+                        // the next refresh.
+                        for (size_t candidate = offset + RecordAlignment;
+                             (candidate + sizeof(DiskCacheRecordHeader)) <= usedSize;
+                             candidate += RecordAlignment)
+                        {
+                            const auto*const pCandidate = static_cast<const DiskCacheRecordHeader*>(
+                                VoidPtrInc(view.Ptr(), candidate - m_scannedEnd));
+                            const size_t candidateRemaining = usedSize - candidate - sizeof(DiskCacheRecordHeader);
+
+                            if ((pCandidate->magic == RecordValidMagic) && (pCandidate->dataSize <= candidateRemaining))
+                            {
+                                uint64 checksum = 0;
+                                MetroHash64::Hash(static_cast<const uint8*>(VoidPtrInc(pCandidate,
+                                                                                      sizeof(DiskCacheRecordHeader))),
+                                                  pCandidate->dataSize,
+                                                  reinterpret_cast<uint8* const>(&checksum));
+
+                                if (checksum == pCandidate->dataChecksum)
+                                {
+                                    nextOffset = candidate;
+                                    break;
+                                }
+                            }
+                        }
+                    }
+
+                    // An incomplete record which isn't skipped yet stops the scan; it is looked at again on the next
+                    // refresh.
+                    stopScanning = (nextOffset == offset);
+                    offset       = nextOffset;
+                }
+
+                m_scannedEnd = Min(offset, usedSize);
+
+                view.UnMap(false);
+            }
+        }
+    }
+}
+
+// =====================================================================================================================
+// Returns true if the incomplete record at the given offset should be skipped because it has stayed incomplete for
+// longer than IncompleteRecordTimeoutMs.  The caller must hold m_lock.
+bool PipelineDiskCache::SkipIncompleteRecord(
+    size_t offset)
+{
+    const int64 now  = GetPerfCpuTime();
+    bool        skip = false;
+
+    if (m_incompleteOffset != offset)
+    {
+        m_incompleteOffset = offset;
+        m_incompleteTime   = now;
+    }
+    else
+    {
+        skip = (((now - m_incompleteTime) * 1000) / GetPerfFrequency()) >= IncompleteRecordTimeoutMs;
+    }
+
+    return skip;
+}
+
+// =====================================================================================================================
+// Returns true if the cache file holds a pipeline with the given compiler hash which was stored under the current PAL
+// settings.
+bool PipelineDiskCache::Contains(
+    uint64 compilerHash)
+{
+    MutexAuto lock(&m_lock);
+
+    RefreshIndex();
+
+    const size_t*const pOffset = m_index.FindKey(compilerHash);
+
+    return ((pOffset != nullptr) && (*pOffset != PendingRecordOffset));
+}
+
+// =====================================================================================================================
+// Searches the cache file for a pipeline with the given compiler hash.  On success, the stored pipeline has passed
+// Pipeline::ValidateLoad() and the returned binary points into pView, so it remains valid until the caller unmaps
+// pView.
+Result PipelineDiskCache::FindPipelineBinary(
+    uint64       compilerHash,
+    FileView*    pView,                // [out] Mapped onto the record holding the pipeline.
+    const void** ppPipelineBinary,     // [out] Pipeline ELF binary extracted from the stored pipeline.
+    size_t*      pPipelineBinarySize)  // [out] Size of the pipeline ELF binary, in bytes.
+{
+    PAL_ASSERT((pView != nullptr) && (ppPipelineBinary != nullptr) && (pPipelineBinarySize != nullptr));
+
+    MutexAuto lock(&m_lock);
+
+    RefreshIndex();
+
+    Result             result  = Result::NotFound;
+    const size_t*const pOffset = m_index.FindKey(compilerHash);
+
+    // A pending record is still being written by another thread in this process.
+    if ((pOffset != nullptr) && (*pOffset != PendingRecordOffset))
+    {
+        const size_t offset   = *pOffset;
+        uint64       dataSize = 0;
+        const void*  pData    = nullptr;
+
+        {
+            FileView headerView;
+            result = m_file.GetExistingStorage(offset, sizeof(DiskCacheRecordHeader), &headerView);
+
+            if (result == Result::Success)
+            {
+                dataSize = static_cast<const DiskCacheRecordHeader*>(headerView.Ptr())->dataSize;
+                headerView.UnMap(false);
+            }
+        }
+
+        if (result == Result::Success)
+        {
+            result = m_file.GetExistingStorage(offset,
+                                               sizeof(DiskCacheRecordHeader) + static_cast<size_t>(dataSize),
+                                               pView);
+        }
+
+        if (result == Result::Success)
+        {
+            pData = VoidPtrInc(pView->Ptr(), sizeof(DiskCacheRecordHeader));
+
+            uint64 checksum = 0;
+            MetroHash64::Hash(static_cast<const uint8*>(pData),
+                              dataSize,
+                              reinterpret_cast<uint8* const>(&checksum));
+
+            const auto*const pRecord = static_cast<const DiskCacheRecordHeader*>(pView->Ptr());
+
+            if ((pRecord->magic != RecordValidMagic) || (pRecord->dataChecksum != checksum))
+            {
+                result = Result::ErrorInvalidFormat;
+            }
+        }
+
+        ElfReadContext<Platform> context(m_device.GetPlatform());
+
+        if (result == Result::Success)
+        {
+            size_t readSize = 0;
+            result = context.ReadFromBuffer(pData, &readSize);
+        }
+
+        if (result == Result::Success)
+        {
+            result = Pipeline::ValidateLoad(&m_device, context);
+        }
+
+        if (result == Result::Success)
+        {
+            result = Pipeline::GetLoadedSectionData(context,
+                                                    ".pipelineBinary",
+                                                    ppPipelineBinary,
+                                                    pPipelineBinarySize);
+        }
+
+        if (result != Result::Success)
+        {
+            // This record can't be used by this process; forget about it so that AddPipeline() stores a usable one.
+            m_index.Erase(compilerHash);
+            pView->UnMap(false);
+            result = Result::NotFound;
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Appends the output of Pipeline::Store() for the given pipeline to the cache file, unless the file already holds a
+// usable copy of it.  In the latter case the pipeline isn't serialized at all.  The pipeline is serialized without
+// holding m_lock, so concurrent pipeline creation doesn't serialize on the disk cache.
+Result PipelineDiskCache::AddPipeline(
+    uint64    compilerHash,
+    Pipeline* pPipeline)
+{
+    Result result = Result::Success;
+    bool   claimed = false;
+
+    {
+        MutexAuto lock(&m_lock);
+
+        RefreshIndex();
+
+        if (m_index.FindKey(compilerHash) == nullptr)
+        {
+            // Claim the pipeline so that other threads creating it at the same time don't store it as well.
+            result  = m_index.Insert(compilerHash, PendingRecordOffset);
+            claimed = (result == Result::Success);
+        }
+    }
+
+    if (claimed)
+    {
+        size_t offset = 0;
+        result = WriteRecord(compilerHash, pPipeline, &offset);
+
+        MutexAuto lock(&m_lock);
+
+        size_t*const pOffset = m_index.FindKey(compilerHash);
+        PAL_ASSERT(pOffset != nullptr);
+
+        if (result == Result::Success)
+        {
+            (*pOffset) = offset;
+        }
+        else
+        {
+            m_index.Erase(compilerHash);
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Reserves a record in the cache file and writes the output of Pipeline::Store() for the given pipeline to it.  This
+// doesn't touch the index, so it may be called without holding m_lock.
+Result PipelineDiskCache::WriteRecord(
+    uint64    compilerHash,
+    Pipeline* pPipeline,
+    size_t*   pOffset)       // [out] Storage offset of the new record.
+{
+    size_t dataSize = 0;
+    Result result   = pPipeline->Store(&dataSize, nullptr);
+
+    const size_t recordSize = Pow2Align(sizeof(DiskCacheRecordHeader) + dataSize, RecordAlignment);
+
+    FileView view;
+
+    if (result == Result::Success)
+    {
+        result = m_file.ReserveStorageSpace(recordSize, pOffset, &view);
+    }
+
+    if (result == Result::Success)
+    {
+        auto*const pRecord = static_cast<DiskCacheRecordHeader*>(view.Ptr());
+        void*const pData   = VoidPtrInc(pRecord, sizeof(DiskCacheRecordHeader));
+
+        // The header goes in before the magic, so that readers can skip this record by its size if the rest of it is
+        // never written.
+        pRecord->dataSize     = dataSize;
+        pRecord->reserved     = 0;
+        pRecord->compilerHash = compilerHash;
+        pRecord->settingsHash = m_device.GetSettingsHash();
+        MemoryBarrier();
+        pRecord->magic        = RecordPendingMagic;
+
+        result = pPipeline->Store(&dataSize, pData);
+
+        if (result == Result::Success)
+        {
+            MetroHash64::Hash(static_cast<const uint8*>(pData),
+                              dataSize,
+                              reinterpret_cast<uint8* const>(&pRecord->dataChecksum));
+
+            // Publishing the record must be the very last write.
+            MemoryBarrier();
+            pRecord->magic = RecordValidMagic;
+        }
+
+        view.UnMap(false);
+    }
+
+    return result;
+}
+
+} // Pal
@@ -0,0 +1,93 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include "palGrowableHashMap.h"
+#include "palMemMapFile.h"
+#include "palMutex.h"
+
+namespace Pal
+{
+
+class Device;
+class Pipeline;
+class Platform;
+
+// =====================================================================================================================
+// Persistent, cross-process cache of serialized pipelines backed by a Util::MemMapFile.
+//
+// The file is an append-only log: a small header identifying the device and PAL build which created it, followed by
+// one record per pipeline holding the output of Pipeline::Store().  Every process which opens the file builds its own
+// in-memory index from compiler hash to record offset, and picks up records appended by other processes the next time
+// it searches the index.  A stored pipeline is only handed out after it passes the same checks as
+// Pipeline::ValidateLoad(), so records written under different settings or GPU VA layouts are never used.
+//
+// Space for each record is reserved atomically in the shared file header, so appends from different threads and
+// processes never overlap and pipelines are serialized without holding any lock.  Each record is checksummed and is
+// only marked valid once it has been written completely.  A record whose writer died (or couldn't grow the file) is
+// skipped once it has stayed incomplete for a while, so it can't hide the records appended after it.
+class PipelineDiskCache
+{
+public:
+    explicit PipelineDiskCache(const Device& device);
+    ~PipelineDiskCache() { }
+
+    Result Init(const char* pDirectory);
+
+    bool Contains(uint64 compilerHash);
+
+    Result FindPipelineBinary(
+        uint64          compilerHash,
+        Util::FileView* pView,
+        const void**    ppPipelineBinary,
+        size_t*         pPipelineBinarySize);
+
+    Result AddPipeline(uint64 compilerHash, Pipeline* pPipeline);
+
+private:
+    typedef Util::GrowableHashMap<uint64, size_t, Platform> RecordIndex;
+
+    Result OpenFile(bool discardContents);
+    Result ValidateFileHeader() const;
+    void   RefreshIndex();
+    bool   SkipIncompleteRecord(size_t offset);
+    Result WriteRecord(uint64 compilerHash, Pipeline* pPipeline, size_t* pOffset);
+
+    const Device&    m_device;
+    char             m_fileName[256];
+
+    Util::Mutex      m_lock;             // Serializes access to the index within this process.
+    Util::MemMapFile m_file;             // Memory mapped log of serialized pipelines.
+    RecordIndex      m_index;            // Maps compiler hashes to the storage offset of their record.
+    size_t           m_scannedEnd;       // Storage offset up to which records have been added to m_index.
+
+    size_t           m_incompleteOffset; // Offset of the incomplete record which last stopped RefreshIndex().
+    int64            m_incompleteTime;   // Time at which that record was first seen incomplete, in perf counter ticks.
+
+    PAL_DISALLOW_DEFAULT_CTOR(PipelineDiskCache);
+    PAL_DISALLOW_COPY_AND_ASSIGN(PipelineDiskCache);
+};
+
+} // Pal
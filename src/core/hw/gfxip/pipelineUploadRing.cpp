@@ -0,0 +1,485 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+#include "core/cmdAllocator.h"
+#include "core/device.h"
+#include "core/internalMemMgr.h"
+#include "core/platform.h"
+#include "core/hw/gfxip/pipelineUploadRing.h"
+#include "palCmdBuffer.h"
+#include "palFence.h"
+#include "palQueue.h"
+#include "palQueueSemaphore.h"
+
+using namespace Util;
+
+namespace Pal
+{
+
+// How long to wait for a batch to go idle before giving up.
+static constexpr uint64 BatchTimeoutNs = 2000000000ull;
+
+// =====================================================================================================================
+PipelineUploadRing::PipelineUploadRing(
+    Device* pDevice)
+    :
+    m_pDevice(pDevice),
+    m_pPlacementMem(nullptr),
+    m_pQueue(nullptr),
+    m_pUploadComplete(nullptr),
+    m_pStagingMem(nullptr),
+    m_pStagingCpuAddr(nullptr),
+    m_pOpenBatch(nullptr),
+    m_nextToken(1),
+    m_submittedToken(0),
+    m_lastUploadToken(0)
+{
+    memset(m_batch, 0, sizeof(m_batch));
+}
+
+// =====================================================================================================================
+PipelineUploadRing::~PipelineUploadRing()
+{
+    if (m_pOpenBatch != nullptr)
+    {
+        // Nothing may reference the pending copies anymore, but the command buffer must still be closed.
+        m_pOpenBatch->pCmdBuffer->End();
+        m_pOpenBatch = nullptr;
+    }
+
+    if (m_pQueue != nullptr)
+    {
+        // We must wait for our queue to be idle before destroying it or any other objects.
+        const Result result = m_pQueue->WaitIdle();
+        PAL_ASSERT(result == Result::Success);
+
+        m_pQueue->Destroy();
+    }
+
+    if (m_pUploadComplete != nullptr)
+    {
+        m_pUploadComplete->Destroy();
+    }
+
+    for (uint32 idx = 0; idx < BatchRingSize; ++idx)
+    {
+        if (m_batch[idx].pCmdBuffer != nullptr)
+        {
+            m_batch[idx].pCmdBuffer->Destroy();
+        }
+
+        if (m_batch[idx].pFence != nullptr)
+        {
+            m_batch[idx].pFence->Destroy();
+        }
+    }
+
+    if (m_pStagingMem != nullptr)
+    {
+        if (m_pStagingCpuAddr != nullptr)
+        {
+            m_pStagingMem->Unmap();
+        }
+
+        IGpuMemory*const pGpuMemory = m_pStagingMem;
+        const Result     result     = m_pDevice->RemoveGpuMemoryReferences(1, &pGpuMemory, nullptr);
+        PAL_ASSERT(result == Result::Success);
+
+        m_pStagingMem->DestroyInternal();
+    }
+
+    PAL_SAFE_FREE(m_pPlacementMem, m_pDevice->GetPlatform());
+}
+
+// =====================================================================================================================
+// Creates the DMA queue and everything needed to record and track batches.  Must be called after the device's engines
+// have been created.
+Result PipelineUploadRing::Init()
+{
+    QueueCreateInfo queueInfo = {};
+    queueInfo.queueType  = QueueTypeDma;
+    queueInfo.engineType = EngineTypeDma;
+
+    QueueSemaphoreCreateInfo semaphoreInfo = {};
+    semaphoreInfo.maxCount = m_pDevice->MaxQueueSemaphoreCount();
+
+    CmdBufferCreateInfo cmdBufferInfo = {};
+    cmdBufferInfo.queueType     = QueueTypeDma;
+    cmdBufferInfo.engineType    = EngineTypeDma;
+    cmdBufferInfo.pCmdAllocator = m_pDevice->InternalCmdAllocator(EngineTypeDma);
+
+    FenceCreateInfo fenceInfo = {};
+    fenceInfo.flags.signaled  = 1;
+
+    const size_t queueSize     = m_pDevice->GetQueueSize(queueInfo, nullptr);
+    const size_t semaphoreSize = m_pDevice->GetQueueSemaphoreSize(semaphoreInfo, nullptr);
+    const size_t cmdBufferSize = m_pDevice->GetCmdBufferSize(cmdBufferInfo, nullptr);
+    const size_t fenceSize     = m_pDevice->GetFenceSize(nullptr);
+
+    Result result = m_lock.Init();
+
+    if ((result == Result::Success) && (m_pDevice->GetEngine(queueInfo.engineType, queueInfo.engineIndex) == nullptr))
+    {
+        // If the client didn't request a DMA engine when they finalized the device, we need to create it.
+        result = m_pDevice->CreateEngine(queueInfo.engineType, queueInfo.engineIndex);
+    }
+
+    if (result == Result::Success)
+    {
+        m_pPlacementMem = PAL_MALLOC(queueSize + semaphoreSize + (BatchRingSize * (cmdBufferSize + fenceSize)),
+                                     m_pDevice->GetPlatform(),
+                                     AllocInternal);
+
+        if (m_pPlacementMem == nullptr)
+        {
+            result = Result::ErrorOutOfMemory;
+        }
+    }
+
+    void* pPlacementAddr = m_pPlacementMem;
+
+    if (result == Result::Success)
+    {
+        result         = m_pDevice->CreateQueue(queueInfo, pPlacementAddr, &m_pQueue);
+        pPlacementAddr = VoidPtrInc(pPlacementAddr, queueSize);
+    }
+
+    if (result == Result::Success)
+    {
+        result         = m_pDevice->CreateQueueSemaphore(semaphoreInfo, pPlacementAddr, &m_pUploadComplete);
+        pPlacementAddr = VoidPtrInc(pPlacementAddr, semaphoreSize);
+    }
+
+    if (result == Result::Success)
+    {
+        GpuMemoryCreateInfo createInfo = {};
+        createInfo.size      = BatchRingSize * BatchStagingBytes;
+        createInfo.alignment = StagingAlignment;
+        createInfo.vaRange   = VaRange::Default;
+        createInfo.priority  = GpuMemPriority::Normal;
+        createInfo.heapCount = 1;
+        createInfo.heaps[0]  = GpuHeapGartUswc;
+
+        GpuMemoryInternalCreateInfo internalInfo = {};
+
+        result = m_pDevice->CreateInternalGpuMemory(createInfo, internalInfo, &m_pStagingMem);
+    }
+
+    if (result == Result::Success)
+    {
+        GpuMemoryRef memRef = {};
+        memRef.flags.readOnly = 1;
+        memRef.pGpuMemory     = m_pStagingMem;
+
+        result = m_pDevice->AddGpuMemoryReferences(1, &memRef, nullptr, GpuMemoryRefCantTrim);
+    }
+
+    if (result == Result::Success)
+    {
+        // The staging ring stays mapped for the lifetime of this object.
+        result = m_pStagingMem->Map(&m_pStagingCpuAddr);
+    }
+
+    for (uint32 idx = 0; (idx < BatchRingSize) && (result == Result::Success); ++idx)
+    {
+        m_batch[idx].stagingOffset = idx * BatchStagingBytes;
+
+        result         = m_pDevice->CreateCmdBuffer(cmdBufferInfo, pPlacementAddr, &m_batch[idx].pCmdBuffer);
+        pPlacementAddr = VoidPtrInc(pPlacementAddr, cmdBufferSize);
+
+        if (result == Result::Success)
+        {
+            result         = m_pDevice->CreateFence(fenceInfo, pPlacementAddr, &m_batch[idx].pFence);
+            pPlacementAddr = VoidPtrInc(pPlacementAddr, fenceSize);
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Starts recording the next batch in the ring.  The batch's previous copies must be idle before its staging memory can
+// be overwritten, so this may stall if uploads are issued faster than the DMA engine can execute them.
+Result PipelineUploadRing::OpenBatch()
+{
+    PAL_ASSERT(m_pOpenBatch == nullptr);
+
+    Batch*const pBatch = &m_batch[m_nextToken % BatchRingSize];
+
+    // If the alert trips we should increase the size of the batch ring.
+    PAL_ALERT(pBatch->pFence->GetStatus() == Result::NotReady);
+
+    Result result = m_pDevice->WaitForFences(1, &pBatch->pFence, true, BatchTimeoutNs);
+
+    if (result == Result::Success)
+    {
+        result = m_pDevice->ResetFences(1, &pBatch->pFence);
+    }
+
+    if (result == Result::Success)
+    {
+        CmdBufferBuildInfo buildInfo = {};
+        buildInfo.flags.optimizeOneTimeSubmit = 1;
+
+        result = pBatch->pCmdBuffer->Begin(buildInfo);
+    }
+
+    if (result == Result::Success)
+    {
+        pBatch->token     = m_nextToken++;
+        pBatch->usedBytes = 0;
+        pBatch->numCopies = 0;
+
+        m_pOpenBatch = pBatch;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Ends the open batch and submits it to the DMA queue.
+Result PipelineUploadRing::SubmitBatch()
+{
+    PAL_ASSERT(m_pOpenBatch != nullptr);
+
+    Batch*const pBatch = m_pOpenBatch;
+    m_pOpenBatch = nullptr;
+
+    Result result = pBatch->pCmdBuffer->End();
+
+    if (result == Result::Success)
+    {
+        SubmitInfo submitInfo = {};
+        submitInfo.cmdBufferCount = 1;
+        submitInfo.ppCmdBuffers   = &pBatch->pCmdBuffer;
+        submitInfo.pFence         = pBatch->pFence;
+
+        result = m_pQueue->Submit(submitInfo);
+    }
+
+    if (result == Result::Success)
+    {
+        m_submittedToken = pBatch->token;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Blocks until the batch with the given token has finished executing, submitting it first if necessary.
+Result PipelineUploadRing::WaitForBatch(
+    uint64 token)
+{
+    Result result = Result::Success;
+
+    if ((m_pOpenBatch != nullptr) && (m_pOpenBatch->token == token))
+    {
+        result = SubmitBatch();
+    }
+
+    Batch*const pBatch = &m_batch[token % BatchRingSize];
+
+    // If the batch has since been reopened for a later token, it must already have been idle.  If it was never
+    // submitted, its fence will never signal but none of its copies will execute either.
+    if ((result == Result::Success) && (pBatch->token == token) && (token <= m_submittedToken))
+    {
+        result = m_pDevice->WaitForFences(1, &pBatch->pFence, true, BatchTimeoutNs);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Copies the given data into staging memory and records DMA copies into the destination memory.
+Result PipelineUploadRing::Upload(
+    const void*           pData,
+    size_t                dataSize,
+    const BoundGpuMemory& dst,
+    uint64*               pToken)
+{
+    Result result        = Result::Success;
+    size_t uploadedBytes = 0;
+
+    // Uploads larger than what's left of the open batch are split across multiple batches.
+    while ((result == Result::Success) && (uploadedBytes < dataSize))
+    {
+        if (m_pOpenBatch == nullptr)
+        {
+            result = OpenBatch();
+        }
+
+        if (result == Result::Success)
+        {
+            Batch*const pBatch   = m_pOpenBatch;
+            const size_t copySize = static_cast<size_t>(Min(static_cast<gpusize>(dataSize - uploadedBytes),
+                                                            BatchStagingBytes - pBatch->usedBytes));
+
+            const gpusize stagingOffset = pBatch->stagingOffset + pBatch->usedBytes;
+            memcpy(VoidPtrInc(m_pStagingCpuAddr, static_cast<size_t>(stagingOffset)),
+                   VoidPtrInc(pData, uploadedBytes),
+                   copySize);
+
+            MemoryCopyRegion region = {};
+            region.srcOffset = stagingOffset;
+            region.dstOffset = dst.Offset() + uploadedBytes;
+            region.copySize  = copySize;
+
+            pBatch->pCmdBuffer->CmdCopyMemory(*m_pStagingMem, *dst.Memory(), 1, &region);
+
+            pBatch->usedBytes = Pow2Align(pBatch->usedBytes + copySize, StagingAlignment);
+            pBatch->numCopies++;
+            uploadedBytes    += copySize;
+
+            (*pToken)         = pBatch->token;
+            m_lastUploadToken = pBatch->token;
+
+            if ((pBatch->usedBytes >= BatchStagingBytes) || (pBatch->numCopies >= MaxCopiesPerBatch))
+            {
+                result = SubmitBatch();
+            }
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Allocates GPU memory in the invisible heap and schedules an upload of the given data into it.  The returned token
+// must be passed to Free() when the memory is no longer needed.
+Result PipelineUploadRing::AllocateAndUpload(
+    const void*     pData,
+    size_t          dataSize,
+    gpusize         alignment,
+    BoundGpuMemory* pGpuMem,  // [out] Bound to the destination GPU memory.
+    uint64*         pToken)   // [out] Identifies the batch which will write the destination memory.
+{
+    PAL_ASSERT((pData != nullptr) && (pGpuMem != nullptr) && (pToken != nullptr));
+
+    GpuMemoryCreateInfo createInfo = {};
+    createInfo.size      = dataSize;
+    createInfo.alignment = alignment;
+    createInfo.vaRange   = VaRange::DescriptorTable;
+    createInfo.heaps[0]  = GpuHeapInvisible;
+    createInfo.heaps[1]  = GpuHeapLocal;
+    createInfo.heapCount = 2;
+    createInfo.priority  = GpuMemPriority::High;
+
+    GpuMemoryInternalCreateInfo internalInfo = {};
+    internalInfo.flags.alwaysResident = 1;
+
+    GpuMemory* pGpuMemory = nullptr;
+    gpusize    offset     = 0;
+
+    Result result = m_pDevice->MemMgr()->AllocateGpuMem(createInfo, internalInfo, false, &pGpuMemory, &offset);
+
+    if (result == Result::Success)
+    {
+        pGpuMem->Update(pGpuMemory, offset);
+
+        MutexAuto lock(&m_lock);
+        result = Upload(pData, dataSize, *pGpuMem, pToken);
+
+        if (result != Result::Success)
+        {
+            // Some of the copies may already be recorded or in flight, so wait for them before freeing the memory.
+            WaitForBatch((m_pOpenBatch != nullptr) ? m_pOpenBatch->token : m_submittedToken);
+        }
+    }
+
+    if ((result != Result::Success) && pGpuMem->IsBound())
+    {
+        m_pDevice->MemMgr()->FreeGpuMem(pGpuMem->Memory(), pGpuMem->Offset());
+        pGpuMem->Update(nullptr, 0);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Frees GPU memory returned by AllocateAndUpload() once the batch which writes it is idle.
+void PipelineUploadRing::Free(
+    BoundGpuMemory* pGpuMem,
+    uint64          token)
+{
+    PAL_ASSERT((pGpuMem != nullptr) && pGpuMem->IsBound());
+
+    {
+        MutexAuto lock(&m_lock);
+
+        const Result result = WaitForBatch(token);
+        PAL_ASSERT(result == Result::Success);
+    }
+
+    m_pDevice->MemMgr()->FreeGpuMem(pGpuMem->Memory(), pGpuMem->Offset());
+    pGpuMem->Update(nullptr, 0);
+}
+
+// =====================================================================================================================
+// Called before a queue submits work which may execute uploaded code.  Submits any pending copies and, if the queue
+// hasn't waited for every submitted batch yet, makes the queue wait for the DMA queue.
+Result PipelineUploadRing::SyncQueue(
+    IQueue* pQueue,
+    uint64* pSyncedToken)  // [in,out] Token of the last batch the queue is known to have waited for.
+{
+    PAL_ASSERT((pQueue != nullptr) && (pSyncedToken != nullptr));
+
+    Result result = Result::Success;
+
+    // Skip the lock unless something was uploaded since this queue last synchronized.  Any upload which the submitted
+    // command buffers depend on happened-before this submit, so its token is already visible here.
+    if (m_lastUploadToken > (*pSyncedToken))
+    {
+        MutexAuto lock(&m_lock);
+
+        if ((m_pOpenBatch != nullptr) && (m_pOpenBatch->numCopies > 0))
+        {
+            result = SubmitBatch();
+        }
+
+        if ((result == Result::Success) && (m_submittedToken > (*pSyncedToken)))
+        {
+            // Batches execute in order, so only the most recent one needs to be checked.
+            const Batch& lastBatch = m_batch[m_submittedToken % BatchRingSize];
+
+            if (lastBatch.pFence->GetStatus() != Result::Success)
+            {
+                result = m_pQueue->SignalQueueSemaphore(m_pUploadComplete);
+
+                if (result == Result::Success)
+                {
+                    result = pQueue->WaitQueueSemaphore(m_pUploadComplete);
+                }
+            }
+
+            if (result == Result::Success)
+            {
+                (*pSyncedToken) = m_submittedToken;
+            }
+        }
+    }
+
+    return result;
+}
+
+} // Pal
@@ -0,0 +1,111 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include "core/gpuMemory.h"
+#include "palMutex.h"
+
+namespace Pal
+{
+
+class Device;
+class ICmdBuffer;
+class IFence;
+class IQueue;
+class IQueueSemaphore;
+
+// =====================================================================================================================
+// Uploads pipeline code to invisible local memory using a DMA queue.  Instead of mapping each pipeline's GPU memory and
+// copying the code with the CPU, the code is written into a persistently mapped staging ring and a DMA copy into the
+// final location is recorded.  Copies are batched: a batch is only submitted once its share of the staging ring is
+// full or when a queue which may execute the uploaded code submits work.
+//
+// Every upload returns a token identifying the batch which contains it.  Destination memory must not be freed until
+// the batch is idle; use Free() rather than releasing the memory directly.
+//
+// All methods are thread-safe.
+class PipelineUploadRing
+{
+public:
+    explicit PipelineUploadRing(Device* pDevice);
+    ~PipelineUploadRing();
+
+    Result Init();
+
+    Result AllocateAndUpload(
+        const void*     pData,
+        size_t          dataSize,
+        gpusize         alignment,
+        BoundGpuMemory* pGpuMem,
+        uint64*         pToken);
+
+    void Free(
+        BoundGpuMemory* pGpuMem,
+        uint64          token);
+
+    Result SyncQueue(
+        IQueue* pQueue,
+        uint64* pSyncedToken);
+
+private:
+    // A DMA command buffer plus the slice of the staging ring it copies from.
+    struct Batch
+    {
+        ICmdBuffer* pCmdBuffer;
+        IFence*     pFence;         // Signaled when the batch's copies are done.
+        uint64      token;          // Token assigned when the batch was last opened, or zero if never used.
+        gpusize     stagingOffset;  // Offset of this batch's slice of the staging ring.
+        gpusize     usedBytes;      // Number of bytes of the slice consumed so far.
+        uint32      numCopies;      // Number of copies recorded so far.
+    };
+
+    Result Upload(const void* pData, size_t dataSize, const BoundGpuMemory& dst, uint64* pToken);
+    Result OpenBatch();
+    Result SubmitBatch();
+    Result WaitForBatch(uint64 token);
+
+    static constexpr uint32  BatchRingSize     = 4;
+    static constexpr gpusize BatchStagingBytes = 1024 * 1024;  // Size of each batch's slice of the staging ring.
+    static constexpr gpusize StagingAlignment  = 256;          // Alignment of each copy's source in the staging ring.
+    static constexpr uint32  MaxCopiesPerBatch = 256;          // Bounds the size of each DMA command buffer.
+
+    Device*const     m_pDevice;
+    Util::Mutex      m_lock;
+    void*            m_pPlacementMem;    // Backing storage for the queue, semaphore, command buffers and fences.
+    IQueue*          m_pQueue;           // All copies are executed on this DMA queue.
+    IQueueSemaphore* m_pUploadComplete;  // Signaled on m_pQueue each time another queue must wait for the uploads.
+    GpuMemory*       m_pStagingMem;
+    void*            m_pStagingCpuAddr;
+    Batch            m_batch[BatchRingSize];
+    Batch*           m_pOpenBatch;       // Batch currently accepting copies, or null if none is open.
+    uint64           m_nextToken;        // Token which will be assigned to the next batch which is opened.
+    uint64           m_submittedToken;   // Token of the most recently submitted batch.
+    volatile uint64  m_lastUploadToken;  // Token of the batch containing the most recent upload; read without the lock.
+
+    PAL_DISALLOW_DEFAULT_CTOR(PipelineUploadRing);
+    PAL_DISALLOW_COPY_AND_ASSIGN(PipelineUploadRing);
+};
+
+} // Pal
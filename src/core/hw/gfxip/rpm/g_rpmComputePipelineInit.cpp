@@ -35,11 +35,11 @@ namespace Pal
 
 // =====================================================================================================================
 // Helper function to create compute pipelines.
-Result CreateRpmComputePipeline(
+static Result CreateRpmComputePipelineFromTable(
     RpmComputePipeline    pipelineType,
     GfxDevice*            pDevice,
     const PipelineBinary* pTable,
-    ComputePipeline**     pPipelineMem)
+    ComputePipeline**     ppPipeline)
 {
     const uint32 index = static_cast<uint32>(pipelineType);
 
@@ -51,17 +51,20 @@ Result CreateRpmComputePipeline(
 
     return pDevice->CreateComputePipelineInternal(
         pipeInfo,
-        &pPipelineMem[index],
+        ppPipeline,
         AllocInternal);
 }
 
 // =====================================================================================================================
-// Creates all compute pipeline objects required by RsrcProcMgr.
-Result CreateRpmComputePipelines(
-    GfxDevice*        pDevice,
-    ComputePipeline** pPipelineMem)
+// Creates the given compute pipeline object required by RsrcProcMgr. Pipelines which aren't used by this device's
+// GFXIP level are not created and leave *ppPipeline set to null.
+Result CreateRpmComputePipeline(
+    GfxDevice*         pDevice,
+    RpmComputePipeline pipelineType,
+    ComputePipeline**  ppPipeline)
 {
     Result result = Result::Success;
+    *ppPipeline = nullptr;
 
     const GpuChipProperties& properties = pDevice->Parent()->ChipProperties();
 
@@ -127,599 +130,137 @@ Result CreateRpmComputePipelines(
 
     if (result == Result::Success)
     {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::ClearBuffer, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::ClearImage1d, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::ClearImage2d, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::ClearImage3d, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::CopyBufferByte, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::CopyBufferDword, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::CopyImage2d, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::CopyImage2dms2x, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::CopyImage2dms4x, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::CopyImage2dms8x, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::CopyImage2dShaderMipLevel, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::CopyImageGammaCorrect2d, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::CopyImgToMem1d, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::CopyImgToMem2d, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::CopyImgToMem2dms2x, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::CopyImgToMem2dms4x, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::CopyImgToMem2dms8x, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::CopyImgToMem3d, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::CopyMemToImg1d, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::CopyMemToImg2d, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::CopyMemToImg2dms2x, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::CopyMemToImg2dms4x, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::CopyMemToImg2dms8x, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::CopyMemToImg3d, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::CopyTypedBuffer1d, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::CopyTypedBuffer2d, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::CopyTypedBuffer3d, pDevice, pTable, pPipelineMem);
-    }
-
-    if ((properties.gfxLevel >= GfxIpLevel::GfxIp8) &&
-        (properties.gfxLevel <= GfxIpLevel::GfxIp9) &&
-        (result == Result::Success))
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::ExpandMaskRam, pDevice, pTable, pPipelineMem);
-    }
-
-    if ((properties.gfxLevel >= GfxIpLevel::GfxIp8) &&
-        (properties.gfxLevel <= GfxIpLevel::GfxIp9) &&
-        (result == Result::Success))
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::ExpandMaskRamMs2x, pDevice, pTable, pPipelineMem);
-    }
-
-    if ((properties.gfxLevel >= GfxIpLevel::GfxIp8) &&
-        (properties.gfxLevel <= GfxIpLevel::GfxIp9) &&
-        (result == Result::Success))
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::ExpandMaskRamMs4x, pDevice, pTable, pPipelineMem);
-    }
-
-    if ((properties.gfxLevel >= GfxIpLevel::GfxIp8) &&
-        (properties.gfxLevel <= GfxIpLevel::GfxIp9) &&
-        (result == Result::Success))
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::ExpandMaskRamMs8x, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::FastDepthClear, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::FastDepthExpClear, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::FastDepthStExpClear, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::FillMem4xDword, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::FillMemDword, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::HtileCopyAndFixUp, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::MsaaFmaskCopyImage, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::MsaaFmaskCopyImageOptimized, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::MsaaFmaskExpand2x, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::MsaaFmaskExpand4x, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::MsaaFmaskExpand8x, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::MsaaFmaskResolve1xEqaa, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::MsaaFmaskResolve2x, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::MsaaFmaskResolve2xEqaa, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::MsaaFmaskResolve2xEqaaMax, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::MsaaFmaskResolve2xEqaaMin, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::MsaaFmaskResolve2xMax, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::MsaaFmaskResolve2xMin, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::MsaaFmaskResolve4x, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::MsaaFmaskResolve4xEqaa, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::MsaaFmaskResolve4xEqaaMax, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::MsaaFmaskResolve4xEqaaMin, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::MsaaFmaskResolve4xMax, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::MsaaFmaskResolve4xMin, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::MsaaFmaskResolve8x, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::MsaaFmaskResolve8xEqaa, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::MsaaFmaskResolve8xEqaaMax, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::MsaaFmaskResolve8xEqaaMin, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::MsaaFmaskResolve8xMax, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::MsaaFmaskResolve8xMin, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::MsaaFmaskScaledCopy, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::MsaaResolve2x, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::MsaaResolve2xMax, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::MsaaResolve2xMin, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::MsaaResolve4x, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::MsaaResolve4xMax, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::MsaaResolve4xMin, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::MsaaResolve8x, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::MsaaResolve8xMax, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::MsaaResolve8xMin, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::PackedPixelComposite, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::ResolveOcclusionQuery, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::ResolvePipelineStatsQuery, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::ResolveStreamoutStatsQuery, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::RgbToYuvPacked, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::RgbToYuvPlanar, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::ScaledCopyImage2d, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::ScaledCopyImage3d, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::YuvIntToRgb, pDevice, pTable, pPipelineMem);
-    }
-
-    if (result == Result::Success)
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::YuvToRgb, pDevice, pTable, pPipelineMem);
-    }
-
-    if ((properties.gfxLevel >= GfxIpLevel::GfxIp6) &&
-        (properties.gfxLevel <= GfxIpLevel::GfxIp8_1) &&
-        (result == Result::Success))
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::Gfx6GenerateCmdDispatch, pDevice, pTable, pPipelineMem);
-    }
-
-    if ((properties.gfxLevel >= GfxIpLevel::GfxIp6) &&
-        (properties.gfxLevel <= GfxIpLevel::GfxIp8_1) &&
-        (result == Result::Success))
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::Gfx6GenerateCmdDraw, pDevice, pTable, pPipelineMem);
-    }
+        switch (pipelineType)
+        {
+        case RpmComputePipeline::ClearBuffer:
+        case RpmComputePipeline::ClearImage1d:
+        case RpmComputePipeline::ClearImage2d:
+        case RpmComputePipeline::ClearImage3d:
+        case RpmComputePipeline::CopyBufferByte:
+        case RpmComputePipeline::CopyBufferDword:
+        case RpmComputePipeline::CopyImage2d:
+        case RpmComputePipeline::CopyImage2dms2x:
+        case RpmComputePipeline::CopyImage2dms4x:
+        case RpmComputePipeline::CopyImage2dms8x:
+        case RpmComputePipeline::CopyImage2dShaderMipLevel:
+        case RpmComputePipeline::CopyImageGammaCorrect2d:
+        case RpmComputePipeline::CopyImgToMem1d:
+        case RpmComputePipeline::CopyImgToMem2d:
+        case RpmComputePipeline::CopyImgToMem2dms2x:
+        case RpmComputePipeline::CopyImgToMem2dms4x:
+        case RpmComputePipeline::CopyImgToMem2dms8x:
+        case RpmComputePipeline::CopyImgToMem3d:
+        case RpmComputePipeline::CopyMemToImg1d:
+        case RpmComputePipeline::CopyMemToImg2d:
+        case RpmComputePipeline::CopyMemToImg2dms2x:
+        case RpmComputePipeline::CopyMemToImg2dms4x:
+        case RpmComputePipeline::CopyMemToImg2dms8x:
+        case RpmComputePipeline::CopyMemToImg3d:
+        case RpmComputePipeline::CopyTypedBuffer1d:
+        case RpmComputePipeline::CopyTypedBuffer2d:
+        case RpmComputePipeline::CopyTypedBuffer3d:
+            result = CreateRpmComputePipelineFromTable(pipelineType, pDevice, pTable, ppPipeline);
+            break;
+
+        case RpmComputePipeline::ExpandMaskRam:
+        case RpmComputePipeline::ExpandMaskRamMs2x:
+        case RpmComputePipeline::ExpandMaskRamMs4x:
+        case RpmComputePipeline::ExpandMaskRamMs8x:
+            if ((properties.gfxLevel >= GfxIpLevel::GfxIp8) &&
+                (properties.gfxLevel <= GfxIpLevel::GfxIp9))
+            {
+                result = CreateRpmComputePipelineFromTable(pipelineType, pDevice, pTable, ppPipeline);
+            }
+            break;
+
+        case RpmComputePipeline::FastDepthClear:
+        case RpmComputePipeline::FastDepthExpClear:
+        case RpmComputePipeline::FastDepthStExpClear:
+        case RpmComputePipeline::FillMem4xDword:
+        case RpmComputePipeline::FillMemDword:
+        case RpmComputePipeline::HtileCopyAndFixUp:
+        case RpmComputePipeline::MsaaFmaskCopyImage:
+        case RpmComputePipeline::MsaaFmaskCopyImageOptimized:
+        case RpmComputePipeline::MsaaFmaskExpand2x:
+        case RpmComputePipeline::MsaaFmaskExpand4x:
+        case RpmComputePipeline::MsaaFmaskExpand8x:
+        case RpmComputePipeline::MsaaFmaskResolve1xEqaa:
+        case RpmComputePipeline::MsaaFmaskResolve2x:
+        case RpmComputePipeline::MsaaFmaskResolve2xEqaa:
+        case RpmComputePipeline::MsaaFmaskResolve2xEqaaMax:
+        case RpmComputePipeline::MsaaFmaskResolve2xEqaaMin:
+        case RpmComputePipeline::MsaaFmaskResolve2xMax:
+        case RpmComputePipeline::MsaaFmaskResolve2xMin:
+        case RpmComputePipeline::MsaaFmaskResolve4x:
+        case RpmComputePipeline::MsaaFmaskResolve4xEqaa:
+        case RpmComputePipeline::MsaaFmaskResolve4xEqaaMax:
+        case RpmComputePipeline::MsaaFmaskResolve4xEqaaMin:
+        case RpmComputePipeline::MsaaFmaskResolve4xMax:
+        case RpmComputePipeline::MsaaFmaskResolve4xMin:
+        case RpmComputePipeline::MsaaFmaskResolve8x:
+        case RpmComputePipeline::MsaaFmaskResolve8xEqaa:
+        case RpmComputePipeline::MsaaFmaskResolve8xEqaaMax:
+        case RpmComputePipeline::MsaaFmaskResolve8xEqaaMin:
+        case RpmComputePipeline::MsaaFmaskResolve8xMax:
+        case RpmComputePipeline::MsaaFmaskResolve8xMin:
+        case RpmComputePipeline::MsaaFmaskScaledCopy:
+        case RpmComputePipeline::MsaaResolve2x:
+        case RpmComputePipeline::MsaaResolve2xMax:
+        case RpmComputePipeline::MsaaResolve2xMin:
+        case RpmComputePipeline::MsaaResolve4x:
+        case RpmComputePipeline::MsaaResolve4xMax:
+        case RpmComputePipeline::MsaaResolve4xMin:
+        case RpmComputePipeline::MsaaResolve8x:
+        case RpmComputePipeline::MsaaResolve8xMax:
+        case RpmComputePipeline::MsaaResolve8xMin:
+        case RpmComputePipeline::PackedPixelComposite:
+        case RpmComputePipeline::ResolveOcclusionQuery:
+        case RpmComputePipeline::ResolvePipelineStatsQuery:
+        case RpmComputePipeline::ResolveStreamoutStatsQuery:
+        case RpmComputePipeline::RgbToYuvPacked:
+        case RpmComputePipeline::RgbToYuvPlanar:
+        case RpmComputePipeline::ScaledCopyImage2d:
+        case RpmComputePipeline::ScaledCopyImage3d:
+        case RpmComputePipeline::YuvIntToRgb:
+        case RpmComputePipeline::YuvToRgb:
+            result = CreateRpmComputePipelineFromTable(pipelineType, pDevice, pTable, ppPipeline);
+            break;
+
+        case RpmComputePipeline::Gfx6GenerateCmdDispatch:
+        case RpmComputePipeline::Gfx6GenerateCmdDraw:
+            if ((properties.gfxLevel >= GfxIpLevel::GfxIp6) &&
+                (properties.gfxLevel <= GfxIpLevel::GfxIp8_1))
+            {
+                result = CreateRpmComputePipelineFromTable(pipelineType, pDevice, pTable, ppPipeline);
+            }
+            break;
 
 #if PAL_BUILD_GFX9
-    if ((properties.gfxLevel == GfxIpLevel::GfxIp9) && (result == Result::Success))
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::Gfx9BuildHtileLookupTable, pDevice, pTable, pPipelineMem);
-    }
-
-    if ((properties.gfxLevel == GfxIpLevel::GfxIp9) && (result == Result::Success))
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::Gfx9ClearDccMultiSample2d, pDevice, pTable, pPipelineMem);
-    }
-
-    if ((properties.gfxLevel == GfxIpLevel::GfxIp9) && (result == Result::Success))
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::Gfx9ClearDccOptimized2d, pDevice, pTable, pPipelineMem);
-    }
-
-    if ((properties.gfxLevel == GfxIpLevel::GfxIp9) && (result == Result::Success))
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::Gfx9ClearDccSingleSample2d, pDevice, pTable, pPipelineMem);
-    }
-
-    if ((properties.gfxLevel == GfxIpLevel::GfxIp9) && (result == Result::Success))
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::Gfx9ClearDccSingleSample3d, pDevice, pTable, pPipelineMem);
-    }
-
-    if ((properties.gfxLevel == GfxIpLevel::GfxIp9) && (result == Result::Success))
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::Gfx9ClearHtileFast, pDevice, pTable, pPipelineMem);
-    }
-
-    if ((properties.gfxLevel == GfxIpLevel::GfxIp9) && (result == Result::Success))
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::Gfx9ClearHtileMultiSample, pDevice, pTable, pPipelineMem);
-    }
-
-    if ((properties.gfxLevel == GfxIpLevel::GfxIp9) && (result == Result::Success))
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::Gfx9ClearHtileOptimized2d, pDevice, pTable, pPipelineMem);
-    }
-
-    if ((properties.gfxLevel == GfxIpLevel::GfxIp9) && (result == Result::Success))
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::Gfx9ClearHtileSingleSample, pDevice, pTable, pPipelineMem);
-    }
-
-    if ((properties.gfxLevel == GfxIpLevel::GfxIp9) && (result == Result::Success))
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::Gfx9Fill4x4Dword, pDevice, pTable, pPipelineMem);
-    }
-
-    if ((properties.gfxLevel == GfxIpLevel::GfxIp9) && (result == Result::Success))
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::Gfx9GenerateCmdDispatch, pDevice, pTable, pPipelineMem);
-    }
-
-    if ((properties.gfxLevel == GfxIpLevel::GfxIp9) && (result == Result::Success))
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::Gfx9GenerateCmdDraw, pDevice, pTable, pPipelineMem);
-    }
-
-    if ((properties.gfxLevel == GfxIpLevel::GfxIp9) && (result == Result::Success))
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::Gfx9HtileCopyAndFixUp, pDevice, pTable, pPipelineMem);
-    }
+        case RpmComputePipeline::Gfx9BuildHtileLookupTable:
+        case RpmComputePipeline::Gfx9ClearDccMultiSample2d:
+        case RpmComputePipeline::Gfx9ClearDccOptimized2d:
+        case RpmComputePipeline::Gfx9ClearDccSingleSample2d:
+        case RpmComputePipeline::Gfx9ClearDccSingleSample3d:
+        case RpmComputePipeline::Gfx9ClearHtileFast:
+        case RpmComputePipeline::Gfx9ClearHtileMultiSample:
+        case RpmComputePipeline::Gfx9ClearHtileOptimized2d:
+        case RpmComputePipeline::Gfx9ClearHtileSingleSample:
+        case RpmComputePipeline::Gfx9Fill4x4Dword:
+        case RpmComputePipeline::Gfx9GenerateCmdDispatch:
+        case RpmComputePipeline::Gfx9GenerateCmdDraw:
+        case RpmComputePipeline::Gfx9HtileCopyAndFixUp:
+        case RpmComputePipeline::Gfx9InitCmaskSingleSample:
+            if (properties.gfxLevel == GfxIpLevel::GfxIp9)
+            {
+                result = CreateRpmComputePipelineFromTable(pipelineType, pDevice, pTable, ppPipeline);
+            }
+            break;
+#endif
 
-    if ((properties.gfxLevel == GfxIpLevel::GfxIp9) && (result == Result::Success))
-    {
-        result = CreateRpmComputePipeline(
-            RpmComputePipeline::Gfx9InitCmaskSingleSample, pDevice, pTable, pPipelineMem);
+        default:
+            break;
+        }
     }
-#endif
 
     return result;
 }
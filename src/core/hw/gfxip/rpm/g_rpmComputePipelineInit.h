@@ -137,6 +137,6 @@ enum class RpmComputePipeline : uint32
     Count
 };
 
-Result CreateRpmComputePipelines(GfxDevice* pDevice, ComputePipeline** pPipelineMem);
+Result CreateRpmComputePipeline(GfxDevice* pDevice, RpmComputePipeline pipelineType, ComputePipeline** ppPipeline);
 
 } // Pal
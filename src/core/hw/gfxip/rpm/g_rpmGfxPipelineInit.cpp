@@ -34,12 +34,15 @@ namespace Pal
 {
 
 // =====================================================================================================================
-// Creates all graphics pipeline objects required by RsrcProcMgr.
-Result CreateRpmGraphicsPipelines(
+// Creates the given graphics pipeline object required by RsrcProcMgr. Pipelines which aren't used by this device's
+// GFXIP level are not created and leave *ppPipeline set to null.
+Result CreateRpmGraphicsPipeline(
     GfxDevice*         pDevice,
-    GraphicsPipeline** pPipelineMem)
+    RpmGfxPipeline     pipelineType,
+    GraphicsPipeline** ppPipeline)
 {
     Result result = Result::Success;
+    *ppPipeline = nullptr;
 
     GraphicsPipelineCreateInfo               pipeInfo         = { };
     GraphicsPipelineInternalCreateInfo       internalInfo     = { };
@@ -106,2306 +109,2226 @@ Result CreateRpmGraphicsPipelines(
 
     if (result == Result::Success)
     {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[Copy2xMsaaDepth].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[Copy2xMsaaDepth].size;
+        switch (pipelineType)
+        {
+        case Copy2xMsaaDepth:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[Copy2xMsaaDepth].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[Copy2xMsaaDepth].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.dbState.swizzledFormat.format  = ChNumFormat::X32_Float;
-        pipeInfo.dbState.swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
+            pipeInfo.dbState.swizzledFormat.format  = ChNumFormat::X32_Float;
+            pipeInfo.dbState.swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
-        pipeInfo.rsState.numSamples      = 2;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.rsState.numSamples      = 2;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[Copy2xMsaaDepth],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[Copy2xMsaaDepthStencil].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[Copy2xMsaaDepthStencil].size;
+        case Copy2xMsaaDepthStencil:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[Copy2xMsaaDepthStencil].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[Copy2xMsaaDepthStencil].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.dbState.swizzledFormat.format  = ChNumFormat::D32_Float_S8_Uint;
-        pipeInfo.dbState.swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
+            pipeInfo.dbState.swizzledFormat.format  = ChNumFormat::D32_Float_S8_Uint;
+            pipeInfo.dbState.swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
-        pipeInfo.rsState.numSamples      = 2;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.rsState.numSamples      = 2;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[Copy2xMsaaDepthStencil],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[Copy2xMsaaStencil].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[Copy2xMsaaStencil].size;
+        case Copy2xMsaaStencil:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[Copy2xMsaaStencil].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[Copy2xMsaaStencil].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[0].blendEnable            = false;
-        pipeInfo.cbState.target[0].channelWriteMask       = 0x1;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8_Uint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
+            pipeInfo.cbState.target[0].blendEnable            = false;
+            pipeInfo.cbState.target[0].channelWriteMask       = 0x1;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8_Uint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
-        pipeInfo.rsState.numSamples      = 2;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.rsState.numSamples      = 2;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[Copy2xMsaaStencil],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[Copy4xMsaaDepth].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[Copy4xMsaaDepth].size;
+        case Copy4xMsaaDepth:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[Copy4xMsaaDepth].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[Copy4xMsaaDepth].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.dbState.swizzledFormat.format  = ChNumFormat::X32_Float;
-        pipeInfo.dbState.swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
+            pipeInfo.dbState.swizzledFormat.format  = ChNumFormat::X32_Float;
+            pipeInfo.dbState.swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
-        pipeInfo.rsState.numSamples      = 4;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.rsState.numSamples      = 4;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[Copy4xMsaaDepth],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[Copy4xMsaaDepthStencil].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[Copy4xMsaaDepthStencil].size;
+        case Copy4xMsaaDepthStencil:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[Copy4xMsaaDepthStencil].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[Copy4xMsaaDepthStencil].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.dbState.swizzledFormat.format  = ChNumFormat::D32_Float_S8_Uint;
-        pipeInfo.dbState.swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
+            pipeInfo.dbState.swizzledFormat.format  = ChNumFormat::D32_Float_S8_Uint;
+            pipeInfo.dbState.swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
-        pipeInfo.rsState.numSamples      = 4;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.rsState.numSamples      = 4;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[Copy4xMsaaDepthStencil],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[Copy4xMsaaStencil].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[Copy4xMsaaStencil].size;
+        case Copy4xMsaaStencil:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[Copy4xMsaaStencil].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[Copy4xMsaaStencil].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[0].blendEnable            = false;
-        pipeInfo.cbState.target[0].channelWriteMask       = 0x1;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8_Uint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
+            pipeInfo.cbState.target[0].blendEnable            = false;
+            pipeInfo.cbState.target[0].channelWriteMask       = 0x1;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8_Uint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
-        pipeInfo.rsState.numSamples      = 4;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.rsState.numSamples      = 4;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[Copy4xMsaaStencil],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[Copy8xMsaaDepth].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[Copy8xMsaaDepth].size;
+        case Copy8xMsaaDepth:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[Copy8xMsaaDepth].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[Copy8xMsaaDepth].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.dbState.swizzledFormat.format  = ChNumFormat::X32_Float;
-        pipeInfo.dbState.swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
+            pipeInfo.dbState.swizzledFormat.format  = ChNumFormat::X32_Float;
+            pipeInfo.dbState.swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
-        pipeInfo.rsState.numSamples      = 8;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.rsState.numSamples      = 8;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[Copy8xMsaaDepth],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[Copy8xMsaaDepthStencil].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[Copy8xMsaaDepthStencil].size;
+        case Copy8xMsaaDepthStencil:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[Copy8xMsaaDepthStencil].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[Copy8xMsaaDepthStencil].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.dbState.swizzledFormat.format  = ChNumFormat::D32_Float_S8_Uint;
-        pipeInfo.dbState.swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
+            pipeInfo.dbState.swizzledFormat.format  = ChNumFormat::D32_Float_S8_Uint;
+            pipeInfo.dbState.swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
-        pipeInfo.rsState.numSamples      = 8;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.rsState.numSamples      = 8;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[Copy8xMsaaDepthStencil],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[Copy8xMsaaStencil].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[Copy8xMsaaStencil].size;
+        case Copy8xMsaaStencil:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[Copy8xMsaaStencil].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[Copy8xMsaaStencil].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[0].blendEnable            = false;
-        pipeInfo.cbState.target[0].channelWriteMask       = 0x1;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8_Uint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
+            pipeInfo.cbState.target[0].blendEnable            = false;
+            pipeInfo.cbState.target[0].channelWriteMask       = 0x1;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8_Uint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
-        pipeInfo.rsState.numSamples      = 8;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.rsState.numSamples      = 8;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[Copy8xMsaaStencil],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if ((properties.gfxLevel >= GfxIpLevel::GfxIp8) && (result == Result::Success))
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[DccDecompress].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[DccDecompress].size;
+        case DccDecompress:
+            if (properties.gfxLevel >= GfxIpLevel::GfxIp8)
+            {
+                pipeInfo = { };
+                pipeInfo.pPipelineBinary    = pTable[DccDecompress].pBuffer;
+                pipeInfo.pipelineBinarySize = pTable[DccDecompress].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+                PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+                pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+                pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
+                pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                    { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+                pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+                pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        internalInfo = { };
-        internalInfo.flags.dccDecompress = true;
+                internalInfo = { };
+                internalInfo.flags.dccDecompress = true;
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            internalInfo,
-            &pPipelineMem[DccDecompress],
-            AllocInternal);
-    }
+                result = pDevice->CreateGraphicsPipelineInternal(
+                    pipeInfo,
+                    internalInfo,
+                    ppPipeline,
+                    AllocInternal);
+            }
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[DepthExpand].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[DepthExpand].size;
+        case DepthExpand:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[DepthExpand].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[DepthExpand].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[DepthExpand],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[DepthResummarize].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[DepthResummarize].size;
+        case DepthResummarize:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[DepthResummarize].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[DepthResummarize].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[DepthResummarize],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[DepthSlowDraw].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[DepthSlowDraw].size;
+        case DepthSlowDraw:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[DepthSlowDraw].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[DepthSlowDraw].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[DepthSlowDraw],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[FastClearElim].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[FastClearElim].size;
+        case FastClearElim:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[FastClearElim].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[FastClearElim].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        internalInfo = { };
-        internalInfo.flags.fastClearElim = true;
+            internalInfo = { };
+            internalInfo.flags.fastClearElim = true;
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            internalInfo,
-            &pPipelineMem[FastClearElim],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                internalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[FmaskDecompress].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[FmaskDecompress].size;
+        case FmaskDecompress:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[FmaskDecompress].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[FmaskDecompress].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        internalInfo = { };
-        internalInfo.flags.fmaskDecompress = true;
+            internalInfo = { };
+            internalInfo.flags.fmaskDecompress = true;
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            internalInfo,
-            &pPipelineMem[FmaskDecompress],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                internalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[Copy_32ABGR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[Copy_32ABGR].size;
+        case Copy_32ABGR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[Copy_32ABGR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[Copy_32ABGR].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[Copy_32ABGR],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[Copy_32GR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[Copy_32GR].size;
+        case Copy_32GR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[Copy_32GR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[Copy_32GR].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[0].channelWriteMask       = 0x3;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
+            pipeInfo.cbState.target[0].channelWriteMask       = 0x3;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[Copy_32GR],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[Copy_32R].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[Copy_32R].size;
+        case Copy_32R:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[Copy_32R].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[Copy_32R].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[0].channelWriteMask       = 0x1;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32_Uint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
+            pipeInfo.cbState.target[0].channelWriteMask       = 0x1;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32_Uint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[Copy_32R],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[Copy_FP16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[Copy_FP16].size;
+        case Copy_FP16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[Copy_FP16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[Copy_FP16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[Copy_FP16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[Copy_SINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[Copy_SINT16].size;
+        case Copy_SINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[Copy_SINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[Copy_SINT16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[Copy_SINT16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[Copy_SNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[Copy_SNORM16].size;
+        case Copy_SNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[Copy_SNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[Copy_SNORM16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[Copy_SNORM16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[Copy_UINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[Copy_UINT16].size;
+        case Copy_UINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[Copy_UINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[Copy_UINT16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[Copy_UINT16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[Copy_UNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[Copy_UNORM16].size;
+        case Copy_UNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[Copy_UNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[Copy_UNORM16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[Copy_UNORM16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear0_32ABGR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear0_32ABGR].size;
+        case SlowColorClear0_32ABGR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear0_32ABGR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear0_32ABGR].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear0_32ABGR],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear0_32GR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear0_32GR].size;
+        case SlowColorClear0_32GR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear0_32GR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear0_32GR].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[0].channelWriteMask       = 0x3;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
+            pipeInfo.cbState.target[0].channelWriteMask       = 0x3;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear0_32GR],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear0_32R].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear0_32R].size;
+        case SlowColorClear0_32R:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear0_32R].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear0_32R].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[0].channelWriteMask       = 0x1;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32_Uint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
+            pipeInfo.cbState.target[0].channelWriteMask       = 0x1;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32_Uint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear0_32R],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear0_FP16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear0_FP16].size;
+        case SlowColorClear0_FP16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear0_FP16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear0_FP16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear0_FP16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear0_SINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear0_SINT16].size;
+        case SlowColorClear0_SINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear0_SINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear0_SINT16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear0_SINT16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear0_SNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear0_SNORM16].size;
+        case SlowColorClear0_SNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear0_SNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear0_SNORM16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear0_SNORM16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear0_UINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear0_UINT16].size;
+        case SlowColorClear0_UINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear0_UINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear0_UINT16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear0_UINT16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear0_UNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear0_UNORM16].size;
+        case SlowColorClear0_UNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear0_UNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear0_UNORM16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear0_UNORM16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear1_32ABGR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear1_32ABGR].size;
+        case SlowColorClear1_32ABGR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear1_32ABGR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear1_32ABGR].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[1].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[1].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
-        pipeInfo.cbState.target[1].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[1].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[1].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
+            pipeInfo.cbState.target[1].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear1_32ABGR],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear1_32GR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear1_32GR].size;
+        case SlowColorClear1_32GR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear1_32GR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear1_32GR].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[1].channelWriteMask       = 0x3;
-        pipeInfo.cbState.target[1].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
-        pipeInfo.cbState.target[1].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
+            pipeInfo.cbState.target[1].channelWriteMask       = 0x3;
+            pipeInfo.cbState.target[1].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
+            pipeInfo.cbState.target[1].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear1_32GR],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear1_32R].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear1_32R].size;
+        case SlowColorClear1_32R:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear1_32R].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear1_32R].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[1].channelWriteMask       = 0x1;
-        pipeInfo.cbState.target[1].swizzledFormat.format  = ChNumFormat::X32_Uint;
-        pipeInfo.cbState.target[1].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
+            pipeInfo.cbState.target[1].channelWriteMask       = 0x1;
+            pipeInfo.cbState.target[1].swizzledFormat.format  = ChNumFormat::X32_Uint;
+            pipeInfo.cbState.target[1].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear1_32R],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear1_FP16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear1_FP16].size;
+        case SlowColorClear1_FP16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear1_FP16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear1_FP16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[1].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[1].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
-        pipeInfo.cbState.target[1].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[1].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[1].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
+            pipeInfo.cbState.target[1].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear1_FP16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear1_SINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear1_SINT16].size;
+        case SlowColorClear1_SINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear1_SINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear1_SINT16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[1].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[1].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
-        pipeInfo.cbState.target[1].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[1].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[1].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
+            pipeInfo.cbState.target[1].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear1_SINT16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear1_SNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear1_SNORM16].size;
+        case SlowColorClear1_SNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear1_SNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear1_SNORM16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[1].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[1].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
-        pipeInfo.cbState.target[1].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[1].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[1].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
+            pipeInfo.cbState.target[1].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear1_SNORM16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear1_UINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear1_UINT16].size;
+        case SlowColorClear1_UINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear1_UINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear1_UINT16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[1].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[1].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
-        pipeInfo.cbState.target[1].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[1].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[1].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
+            pipeInfo.cbState.target[1].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear1_UINT16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear1_UNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear1_UNORM16].size;
+        case SlowColorClear1_UNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear1_UNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear1_UNORM16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[1].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[1].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
-        pipeInfo.cbState.target[1].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[1].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[1].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
+            pipeInfo.cbState.target[1].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear1_UNORM16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear2_32ABGR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear2_32ABGR].size;
+        case SlowColorClear2_32ABGR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear2_32ABGR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear2_32ABGR].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[2].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[2].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
-        pipeInfo.cbState.target[2].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[2].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[2].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
+            pipeInfo.cbState.target[2].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear2_32ABGR],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear2_32GR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear2_32GR].size;
+        case SlowColorClear2_32GR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear2_32GR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear2_32GR].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[2].channelWriteMask       = 0x3;
-        pipeInfo.cbState.target[2].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
-        pipeInfo.cbState.target[2].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
+            pipeInfo.cbState.target[2].channelWriteMask       = 0x3;
+            pipeInfo.cbState.target[2].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
+            pipeInfo.cbState.target[2].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear2_32GR],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear2_32R].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear2_32R].size;
+        case SlowColorClear2_32R:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear2_32R].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear2_32R].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[2].channelWriteMask       = 0x1;
-        pipeInfo.cbState.target[2].swizzledFormat.format  = ChNumFormat::X32_Uint;
-        pipeInfo.cbState.target[2].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
+            pipeInfo.cbState.target[2].channelWriteMask       = 0x1;
+            pipeInfo.cbState.target[2].swizzledFormat.format  = ChNumFormat::X32_Uint;
+            pipeInfo.cbState.target[2].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear2_32R],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear2_FP16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear2_FP16].size;
+        case SlowColorClear2_FP16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear2_FP16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear2_FP16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[2].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[2].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
-        pipeInfo.cbState.target[2].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[2].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[2].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
+            pipeInfo.cbState.target[2].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear2_FP16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear2_SINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear2_SINT16].size;
+        case SlowColorClear2_SINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear2_SINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear2_SINT16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[2].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[2].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
-        pipeInfo.cbState.target[2].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[2].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[2].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
+            pipeInfo.cbState.target[2].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear2_SINT16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear2_SNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear2_SNORM16].size;
+        case SlowColorClear2_SNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear2_SNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear2_SNORM16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[2].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[2].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
-        pipeInfo.cbState.target[2].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[2].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[2].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
+            pipeInfo.cbState.target[2].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear2_SNORM16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear2_UINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear2_UINT16].size;
+        case SlowColorClear2_UINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear2_UINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear2_UINT16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[2].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[2].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
-        pipeInfo.cbState.target[2].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[2].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[2].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
+            pipeInfo.cbState.target[2].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear2_UINT16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear2_UNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear2_UNORM16].size;
+        case SlowColorClear2_UNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear2_UNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear2_UNORM16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[2].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[2].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
-        pipeInfo.cbState.target[2].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[2].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[2].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
+            pipeInfo.cbState.target[2].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear2_UNORM16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear3_32ABGR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear3_32ABGR].size;
+        case SlowColorClear3_32ABGR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear3_32ABGR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear3_32ABGR].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[3].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[3].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
-        pipeInfo.cbState.target[3].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[3].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[3].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
+            pipeInfo.cbState.target[3].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear3_32ABGR],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear3_32GR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear3_32GR].size;
+        case SlowColorClear3_32GR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear3_32GR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear3_32GR].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[3].channelWriteMask       = 0x3;
-        pipeInfo.cbState.target[3].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
-        pipeInfo.cbState.target[3].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
+            pipeInfo.cbState.target[3].channelWriteMask       = 0x3;
+            pipeInfo.cbState.target[3].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
+            pipeInfo.cbState.target[3].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear3_32GR],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear3_32R].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear3_32R].size;
+        case SlowColorClear3_32R:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear3_32R].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear3_32R].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[3].channelWriteMask       = 0x1;
-        pipeInfo.cbState.target[3].swizzledFormat.format  = ChNumFormat::X32_Uint;
-        pipeInfo.cbState.target[3].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
+            pipeInfo.cbState.target[3].channelWriteMask       = 0x1;
+            pipeInfo.cbState.target[3].swizzledFormat.format  = ChNumFormat::X32_Uint;
+            pipeInfo.cbState.target[3].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear3_32R],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear3_FP16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear3_FP16].size;
+        case SlowColorClear3_FP16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear3_FP16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear3_FP16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[3].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[3].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
-        pipeInfo.cbState.target[3].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[3].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[3].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
+            pipeInfo.cbState.target[3].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear3_FP16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear3_SINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear3_SINT16].size;
+        case SlowColorClear3_SINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear3_SINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear3_SINT16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[3].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[3].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
-        pipeInfo.cbState.target[3].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[3].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[3].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
+            pipeInfo.cbState.target[3].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear3_SINT16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear3_SNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear3_SNORM16].size;
+        case SlowColorClear3_SNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear3_SNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear3_SNORM16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[3].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[3].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
-        pipeInfo.cbState.target[3].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[3].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[3].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
+            pipeInfo.cbState.target[3].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear3_SNORM16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear3_UINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear3_UINT16].size;
+        case SlowColorClear3_UINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear3_UINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear3_UINT16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[3].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[3].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
-        pipeInfo.cbState.target[3].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[3].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[3].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
+            pipeInfo.cbState.target[3].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear3_UINT16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear3_UNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear3_UNORM16].size;
+        case SlowColorClear3_UNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear3_UNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear3_UNORM16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[3].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[3].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
-        pipeInfo.cbState.target[3].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[3].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[3].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
+            pipeInfo.cbState.target[3].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear3_UNORM16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear4_32ABGR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear4_32ABGR].size;
+        case SlowColorClear4_32ABGR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear4_32ABGR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear4_32ABGR].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[4].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[4].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
-        pipeInfo.cbState.target[4].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[4].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[4].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
+            pipeInfo.cbState.target[4].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear4_32ABGR],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear4_32GR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear4_32GR].size;
+        case SlowColorClear4_32GR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear4_32GR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear4_32GR].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[4].channelWriteMask       = 0x3;
-        pipeInfo.cbState.target[4].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
-        pipeInfo.cbState.target[4].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
+            pipeInfo.cbState.target[4].channelWriteMask       = 0x3;
+            pipeInfo.cbState.target[4].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
+            pipeInfo.cbState.target[4].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear4_32GR],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear4_32R].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear4_32R].size;
+        case SlowColorClear4_32R:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear4_32R].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear4_32R].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[4].channelWriteMask       = 0x1;
-        pipeInfo.cbState.target[4].swizzledFormat.format  = ChNumFormat::X32_Uint;
-        pipeInfo.cbState.target[4].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
+            pipeInfo.cbState.target[4].channelWriteMask       = 0x1;
+            pipeInfo.cbState.target[4].swizzledFormat.format  = ChNumFormat::X32_Uint;
+            pipeInfo.cbState.target[4].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear4_32R],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear4_FP16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear4_FP16].size;
+        case SlowColorClear4_FP16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear4_FP16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear4_FP16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[4].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[4].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
-        pipeInfo.cbState.target[4].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[4].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[4].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
+            pipeInfo.cbState.target[4].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear4_FP16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear4_SINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear4_SINT16].size;
+        case SlowColorClear4_SINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear4_SINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear4_SINT16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[4].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[4].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
-        pipeInfo.cbState.target[4].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[4].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[4].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
+            pipeInfo.cbState.target[4].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear4_SINT16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear4_SNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear4_SNORM16].size;
+        case SlowColorClear4_SNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear4_SNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear4_SNORM16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[4].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[4].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
-        pipeInfo.cbState.target[4].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[4].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[4].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
+            pipeInfo.cbState.target[4].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear4_SNORM16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear4_UINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear4_UINT16].size;
+        case SlowColorClear4_UINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear4_UINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear4_UINT16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[4].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[4].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
-        pipeInfo.cbState.target[4].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[4].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[4].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
+            pipeInfo.cbState.target[4].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear4_UINT16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear4_UNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear4_UNORM16].size;
+        case SlowColorClear4_UNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear4_UNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear4_UNORM16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[4].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[4].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
-        pipeInfo.cbState.target[4].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[4].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[4].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
+            pipeInfo.cbState.target[4].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear4_UNORM16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear5_32ABGR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear5_32ABGR].size;
+        case SlowColorClear5_32ABGR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear5_32ABGR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear5_32ABGR].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[5].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[5].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
-        pipeInfo.cbState.target[5].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[5].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[5].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
+            pipeInfo.cbState.target[5].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear5_32ABGR],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear5_32GR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear5_32GR].size;
+        case SlowColorClear5_32GR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear5_32GR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear5_32GR].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[5].channelWriteMask       = 0x3;
-        pipeInfo.cbState.target[5].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
-        pipeInfo.cbState.target[5].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
+            pipeInfo.cbState.target[5].channelWriteMask       = 0x3;
+            pipeInfo.cbState.target[5].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
+            pipeInfo.cbState.target[5].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear5_32GR],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear5_32R].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear5_32R].size;
+        case SlowColorClear5_32R:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear5_32R].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear5_32R].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[5].channelWriteMask       = 0x1;
-        pipeInfo.cbState.target[5].swizzledFormat.format  = ChNumFormat::X32_Uint;
-        pipeInfo.cbState.target[5].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
+            pipeInfo.cbState.target[5].channelWriteMask       = 0x1;
+            pipeInfo.cbState.target[5].swizzledFormat.format  = ChNumFormat::X32_Uint;
+            pipeInfo.cbState.target[5].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear5_32R],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear5_FP16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear5_FP16].size;
+        case SlowColorClear5_FP16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear5_FP16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear5_FP16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[5].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[5].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
-        pipeInfo.cbState.target[5].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[5].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[5].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
+            pipeInfo.cbState.target[5].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear5_FP16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear5_SINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear5_SINT16].size;
+        case SlowColorClear5_SINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear5_SINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear5_SINT16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[5].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[5].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
-        pipeInfo.cbState.target[5].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[5].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[5].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
+            pipeInfo.cbState.target[5].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear5_SINT16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear5_SNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear5_SNORM16].size;
+        case SlowColorClear5_SNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear5_SNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear5_SNORM16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[5].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[5].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
-        pipeInfo.cbState.target[5].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[5].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[5].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
+            pipeInfo.cbState.target[5].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear5_SNORM16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear5_UINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear5_UINT16].size;
+        case SlowColorClear5_UINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear5_UINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear5_UINT16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[5].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[5].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
-        pipeInfo.cbState.target[5].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[5].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[5].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
+            pipeInfo.cbState.target[5].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear5_UINT16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear5_UNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear5_UNORM16].size;
+        case SlowColorClear5_UNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear5_UNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear5_UNORM16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[5].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[5].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
-        pipeInfo.cbState.target[5].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[5].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[5].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
+            pipeInfo.cbState.target[5].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear5_UNORM16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear6_32ABGR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear6_32ABGR].size;
+        case SlowColorClear6_32ABGR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear6_32ABGR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear6_32ABGR].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[6].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[6].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
-        pipeInfo.cbState.target[6].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[6].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[6].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
+            pipeInfo.cbState.target[6].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear6_32ABGR],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear6_32GR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear6_32GR].size;
+        case SlowColorClear6_32GR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear6_32GR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear6_32GR].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[6].channelWriteMask       = 0x3;
-        pipeInfo.cbState.target[6].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
-        pipeInfo.cbState.target[6].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
+            pipeInfo.cbState.target[6].channelWriteMask       = 0x3;
+            pipeInfo.cbState.target[6].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
+            pipeInfo.cbState.target[6].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear6_32GR],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear6_32R].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear6_32R].size;
+        case SlowColorClear6_32R:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear6_32R].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear6_32R].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[6].channelWriteMask       = 0x1;
-        pipeInfo.cbState.target[6].swizzledFormat.format  = ChNumFormat::X32_Uint;
-        pipeInfo.cbState.target[6].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
+            pipeInfo.cbState.target[6].channelWriteMask       = 0x1;
+            pipeInfo.cbState.target[6].swizzledFormat.format  = ChNumFormat::X32_Uint;
+            pipeInfo.cbState.target[6].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear6_32R],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear6_FP16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear6_FP16].size;
+        case SlowColorClear6_FP16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear6_FP16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear6_FP16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[6].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[6].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
-        pipeInfo.cbState.target[6].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[6].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[6].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
+            pipeInfo.cbState.target[6].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear6_FP16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear6_SINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear6_SINT16].size;
+        case SlowColorClear6_SINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear6_SINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear6_SINT16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[6].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[6].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
-        pipeInfo.cbState.target[6].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[6].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[6].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
+            pipeInfo.cbState.target[6].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear6_SINT16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear6_SNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear6_SNORM16].size;
+        case SlowColorClear6_SNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear6_SNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear6_SNORM16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[6].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[6].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
-        pipeInfo.cbState.target[6].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[6].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[6].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
+            pipeInfo.cbState.target[6].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear6_SNORM16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear6_UINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear6_UINT16].size;
+        case SlowColorClear6_UINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear6_UINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear6_UINT16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[6].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[6].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
-        pipeInfo.cbState.target[6].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[6].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[6].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
+            pipeInfo.cbState.target[6].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear6_UINT16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear6_UNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear6_UNORM16].size;
+        case SlowColorClear6_UNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear6_UNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear6_UNORM16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[6].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[6].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
-        pipeInfo.cbState.target[6].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[6].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[6].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
+            pipeInfo.cbState.target[6].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear6_UNORM16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear7_32ABGR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear7_32ABGR].size;
+        case SlowColorClear7_32ABGR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear7_32ABGR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear7_32ABGR].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[7].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[7].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
-        pipeInfo.cbState.target[7].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[7].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[7].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
+            pipeInfo.cbState.target[7].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear7_32ABGR],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear7_32GR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear7_32GR].size;
+        case SlowColorClear7_32GR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear7_32GR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear7_32GR].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[7].channelWriteMask       = 0x3;
-        pipeInfo.cbState.target[7].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
-        pipeInfo.cbState.target[7].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
+            pipeInfo.cbState.target[7].channelWriteMask       = 0x3;
+            pipeInfo.cbState.target[7].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
+            pipeInfo.cbState.target[7].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear7_32GR],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear7_32R].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear7_32R].size;
+        case SlowColorClear7_32R:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear7_32R].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear7_32R].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[7].channelWriteMask       = 0x1;
-        pipeInfo.cbState.target[7].swizzledFormat.format  = ChNumFormat::X32_Uint;
-        pipeInfo.cbState.target[7].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
+            pipeInfo.cbState.target[7].channelWriteMask       = 0x1;
+            pipeInfo.cbState.target[7].swizzledFormat.format  = ChNumFormat::X32_Uint;
+            pipeInfo.cbState.target[7].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear7_32R],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear7_FP16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear7_FP16].size;
+        case SlowColorClear7_FP16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear7_FP16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear7_FP16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[7].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[7].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
-        pipeInfo.cbState.target[7].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[7].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[7].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
+            pipeInfo.cbState.target[7].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear7_FP16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear7_SINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear7_SINT16].size;
+        case SlowColorClear7_SINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear7_SINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear7_SINT16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[7].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[7].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
-        pipeInfo.cbState.target[7].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[7].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[7].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
+            pipeInfo.cbState.target[7].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear7_SINT16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear7_SNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear7_SNORM16].size;
+        case SlowColorClear7_SNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear7_SNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear7_SNORM16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[7].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[7].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
-        pipeInfo.cbState.target[7].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[7].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[7].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
+            pipeInfo.cbState.target[7].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear7_SNORM16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear7_UINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear7_UINT16].size;
+        case SlowColorClear7_UINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear7_UINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear7_UINT16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[7].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[7].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
-        pipeInfo.cbState.target[7].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[7].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[7].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
+            pipeInfo.cbState.target[7].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear7_UINT16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear7_UNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear7_UNORM16].size;
+        case SlowColorClear7_UNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear7_UNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear7_UNORM16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[7].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[7].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
-        pipeInfo.cbState.target[7].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[7].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[7].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
+            pipeInfo.cbState.target[7].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear7_UNORM16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[ResolveDepth].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[ResolveDepth].size;
+        case ResolveDepth:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[ResolveDepth].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[ResolveDepth].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.dbState.swizzledFormat.format  = ChNumFormat::D32_Float_S8_Uint;
-        pipeInfo.dbState.swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
+            pipeInfo.dbState.swizzledFormat.format  = ChNumFormat::D32_Float_S8_Uint;
+            pipeInfo.dbState.swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[ResolveDepth],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[ResolveDepthCopy].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[ResolveDepthCopy].size;
+        case ResolveDepthCopy:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[ResolveDepthCopy].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[ResolveDepthCopy].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[0].blendEnable            = false;
-        pipeInfo.cbState.target[0].channelWriteMask       = 0x1;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32_Float;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
+            pipeInfo.cbState.target[0].blendEnable            = false;
+            pipeInfo.cbState.target[0].channelWriteMask       = 0x1;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32_Float;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[ResolveDepthCopy],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[ResolveFixedFunc].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[ResolveFixedFunc].size;
+        case ResolveFixedFunc:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[ResolveFixedFunc].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[ResolveFixedFunc].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[0].blendEnable            = false;
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[0].blendEnable            = false;
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        internalInfo = { };
-        internalInfo.flags.resolveFixedFunc = true;
+            internalInfo = { };
+            internalInfo.flags.resolveFixedFunc = true;
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            internalInfo,
-            &pPipelineMem[ResolveFixedFunc],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                internalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[ResolveStencil].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[ResolveStencil].size;
+        case ResolveStencil:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[ResolveStencil].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[ResolveStencil].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.dbState.swizzledFormat.format  = ChNumFormat::D32_Float_S8_Uint;
-        pipeInfo.dbState.swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
+            pipeInfo.dbState.swizzledFormat.format  = ChNumFormat::D32_Float_S8_Uint;
+            pipeInfo.dbState.swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[ResolveStencil],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[ResolveStencilCopy].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[ResolveStencilCopy].size;
+        case ResolveStencilCopy:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[ResolveStencilCopy].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[ResolveStencilCopy].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.target[0].blendEnable            = false;
-        pipeInfo.cbState.target[0].channelWriteMask       = 0x2;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8Y8_Uint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::Y, ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::One };
+            pipeInfo.cbState.target[0].blendEnable            = false;
+            pipeInfo.cbState.target[0].channelWriteMask       = 0x2;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8Y8_Uint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::Y, ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::One };
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 310
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
 #endif
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[ResolveStencilCopy],
-            AllocInternal);
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        default:
+            break;
+        }
     }
 
     return result;
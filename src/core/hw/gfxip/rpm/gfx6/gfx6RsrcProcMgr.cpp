@@ -306,6 +306,7 @@ const SPI_SHADER_EX_FORMAT RsrcProcMgr::DeterminePsExportFmt(
 // Some blts need to use GFXIP-specific algorithms to pick the proper graphics state. The basePipeline is the first
 // graphics state in a series of states that vary only on target format and target index.
 const Pal::GraphicsPipeline* RsrcProcMgr::GetGfxPipelineByTargetIndexAndFormat(
+    GfxCmdBuffer*  pCmdBuffer,
     RpmGfxPipeline basePipeline,
     uint32         targetIndex,
     SwizzledFormat format
@@ -326,13 +327,14 @@ const Pal::GraphicsPipeline* RsrcProcMgr::GetGfxPipelineByTargetIndexAndFormat(
     const int32 pipelineOffset = ExportStateMapping[exportFormat];
     PAL_ASSERT(pipelineOffset >= 0);
 
-    return GetGfxPipeline(static_cast<RpmGfxPipeline>(basePipeline + pipelineOffset + targetIndex * NumExportFormats));
+    return GetGfxPipeline(pCmdBuffer,
+                          static_cast<RpmGfxPipeline>(basePipeline + pipelineOffset + targetIndex * NumExportFormats));
 }
 
 // =====================================================================================================================
 const Pal::ComputePipeline* RsrcProcMgr::GetCmdGenerationPipeline(
-    const Pal::IndirectCmdGenerator& generator,
-    const CmdBuffer&                 cmdBuffer
+    GfxCmdBuffer*                    pCmdBuffer,
+    const Pal::IndirectCmdGenerator& generator
     ) const
 {
     RpmComputePipeline pipeline = RpmComputePipeline::Count;
@@ -341,7 +343,7 @@ const Pal::ComputePipeline* RsrcProcMgr::GetCmdGenerationPipeline(
     {
     case GeneratorType::Draw:
     case GeneratorType::DrawIndexed:
-        PAL_ASSERT(cmdBuffer.GetEngineType() == EngineTypeUniversal);
+        PAL_ASSERT(pCmdBuffer->GetEngineType() == EngineTypeUniversal);
         pipeline = RpmComputePipeline::Gfx6GenerateCmdDraw;
         break;
 
@@ -354,7 +356,7 @@ const Pal::ComputePipeline* RsrcProcMgr::GetCmdGenerationPipeline(
         break;
     }
 
-    return GetPipeline(pipeline);
+    return GetPipeline(pCmdBuffer, pipeline);
 }
 
 // =====================================================================================================================
@@ -759,7 +761,7 @@ void RsrcProcMgr::CmdResolveQueryComputeShader(
     {
     case QueryPoolType::Occlusion:
         // The occlusion query shader needs the stride of a set of zPass counters.
-        pPipeline    = GetPipeline(RpmComputePipeline::ResolveOcclusionQuery);
+        pPipeline    = GetPipeline(pCmdBuffer, RpmComputePipeline::ResolveOcclusionQuery);
         pipelineData = static_cast<uint32>(queryPool.GetGpuResultSizeInBytes(1));
 
         constData[3]    = pipelineData;
@@ -770,7 +772,7 @@ void RsrcProcMgr::CmdResolveQueryComputeShader(
 
     case QueryPoolType::PipelineStats:
         // The pipeline stats query shader needs the mask of enabled pipeline stats.
-        pPipeline    = GetPipeline(RpmComputePipeline::ResolvePipelineStatsQuery);
+        pPipeline    = GetPipeline(pCmdBuffer, RpmComputePipeline::ResolvePipelineStatsQuery);
         pipelineData = queryPool.CreateInfo().enabledStats;
 
         constData[3]    = pipelineData;
@@ -785,7 +787,7 @@ void RsrcProcMgr::CmdResolveQueryComputeShader(
 
         PAL_ASSERT(flags == (QueryResult64Bit | QueryResultWait));
 
-        pPipeline = GetPipeline(RpmComputePipeline::ResolveStreamoutStatsQuery);
+        pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::ResolveStreamoutStatsQuery);
 
         constData[0]    = queryCount;
         constData[1]    = static_cast<uint32>(dstStride);
@@ -802,36 +804,37 @@ void RsrcProcMgr::CmdResolveQueryComputeShader(
         break;
     }
 
-    PAL_ASSERT(pPipeline != nullptr);
-
-    // Save current command buffer state and bind the pipeline.
-    pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
-    pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
+    if (pPipeline != nullptr)
+    {
+        // Save current command buffer state and bind the pipeline.
+        pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
+        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
 
-    // Create an embedded user-data table and bind it to user data 0. We need buffer views for the source and dest.
-    uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
-                                                               SrdDwordAlignment() * 2,
-                                                               SrdDwordAlignment(),
-                                                               PipelineBindPoint::Compute,
-                                                               0);
+        // Create an embedded user-data table and bind it to user data 0. We need buffer views for the source and dest.
+        uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
+                                                                   SrdDwordAlignment() * 2,
+                                                                   SrdDwordAlignment(),
+                                                                   PipelineBindPoint::Compute,
+                                                                   0);
 
-    // Populate the table with raw buffer views, by convention the destination is placed before the source.
-    BufferViewInfo rawBufferView = {};
-    RpmUtil::BuildRawBufferViewInfo(&rawBufferView, dstGpuMemory, dstOffset);
-    m_pDevice->Parent()->CreateUntypedBufferViewSrds(1, &rawBufferView, pSrdTable);
-    pSrdTable += SrdDwordAlignment();
+        // Populate the table with raw buffer views, by convention the destination is placed before the source.
+        BufferViewInfo rawBufferView = {};
+        RpmUtil::BuildRawBufferViewInfo(&rawBufferView, dstGpuMemory, dstOffset);
+        m_pDevice->Parent()->CreateUntypedBufferViewSrds(1, &rawBufferView, pSrdTable);
+        pSrdTable += SrdDwordAlignment();
 
-    RpmUtil::BuildRawBufferViewInfo(&rawBufferView, queryPool.GpuMemory(), queryPool.GetQueryOffset(startQuery));
-    m_pDevice->Parent()->CreateUntypedBufferViewSrds(1, &rawBufferView, pSrdTable);
+        RpmUtil::BuildRawBufferViewInfo(&rawBufferView, queryPool.GpuMemory(), queryPool.GetQueryOffset(startQuery));
+        m_pDevice->Parent()->CreateUntypedBufferViewSrds(1, &rawBufferView, pSrdTable);
 
-    pCmdBuffer->CmdSetUserData(PipelineBindPoint::Compute, 1, constEntryCount, constData);
+        pCmdBuffer->CmdSetUserData(PipelineBindPoint::Compute, 1, constEntryCount, constData);
 
-    // Issue a dispatch with one thread per query slot.
-    const uint32 threadGroups = RpmUtil::MinThreadGroups(queryCount, pPipeline->ThreadsPerGroup());
-    pCmdBuffer->CmdDispatch(threadGroups, 1, 1);
+        // Issue a dispatch with one thread per query slot.
+        const uint32 threadGroups = RpmUtil::MinThreadGroups(queryCount, pPipeline->ThreadsPerGroup());
+        pCmdBuffer->CmdDispatch(threadGroups, 1, 1);
 
-    // Restore the command buffer's state.
-    pCmdBuffer->CmdRestoreComputeState(ComputeStatePipelineAndUserData);
+        // Restore the command buffer's state.
+        pCmdBuffer->CmdRestoreComputeState(ComputeStatePipelineAndUserData);
+    }
 }
 
 // =====================================================================================================================
@@ -865,84 +868,87 @@ void RsrcProcMgr::ExpandDepthStencil(
         (supportsComputePath && (TestAnyFlagSet(Image::UseComputeExpand, UseComputeExpandAlways))))
     {
         const auto&  createInfo        = image.GetImageCreateInfo();
-        const auto*  pPipeline         = GetComputeMaskRamExpandPipeline(image);
+        const auto*  pPipeline         = GetComputeMaskRamExpandPipeline(pCmdBuffer, image);
         const auto*  pHtile            = pGfxImage->GetHtile(range.startSubres);
         auto*        pComputeCmdStream = pCmdBuffer->GetCmdStreamByEngine(CmdBufferEngineSupport::Compute);
 
-        pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
-        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
-
-        // Compute the number of thread groups needed to launch one thread per texel.
-        uint32 threadsPerGroup[3] = {};
-        pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
-
-        bool         earlyExit      = false;
-        SubresRange  remainingRange = range;
-        for (uint32  mipIdx = 0; ((earlyExit == false) && (mipIdx < range.numMips)); mipIdx++)
+        if (pPipeline != nullptr)
         {
-            const SubresId  mipBaseSubResId =  { range.startSubres.aspect, range.startSubres.mipLevel + mipIdx, 0 };
-            const auto*     pBaseSubResInfo = image.SubresourceInfo(mipBaseSubResId);
+            pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
+            pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
 
-            PAL_ASSERT(pBaseSubResInfo->flags.supportMetaDataTexFetch);
-
-            const uint32  threadGroupsX = RpmUtil::MinThreadGroups(pBaseSubResInfo->extentElements.width,
-                                                                   threadsPerGroup[0]);
-            const uint32  threadGroupsY = RpmUtil::MinThreadGroups(pBaseSubResInfo->extentElements.height,
-                                                                   threadsPerGroup[1]);
+            // Compute the number of thread groups needed to launch one thread per texel.
+            uint32 threadsPerGroup[3] = {};
+            pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
 
-            const uint32 constData[] =
+            bool         earlyExit      = false;
+            SubresRange  remainingRange = range;
+            for (uint32  mipIdx = 0; ((earlyExit == false) && (mipIdx < range.numMips)); mipIdx++)
             {
-                // start cb0[0]
-                pBaseSubResInfo->extentElements.width,
-                pBaseSubResInfo->extentElements.height,
-            };
+                const SubresId  mipBaseSubResId =  { range.startSubres.aspect, range.startSubres.mipLevel + mipIdx, 0 };
+                const auto*     pBaseSubResInfo = image.SubresourceInfo(mipBaseSubResId);
 
-            const uint32 sizeConstDataDwords = NumBytesToNumDwords(sizeof(constData));
+                PAL_ASSERT(pBaseSubResInfo->flags.supportMetaDataTexFetch);
 
-            for (uint32  sliceIdx = 0; sliceIdx < range.numSlices; sliceIdx++)
-            {
-                const SubresId     subResId =  { mipBaseSubResId.aspect,
-                                                 mipBaseSubResId.mipLevel,
-                                                 range.startSubres.arraySlice + sliceIdx };
-                const SubresRange  viewRange = { subResId, 1, 1 };
+                const uint32  threadGroupsX = RpmUtil::MinThreadGroups(pBaseSubResInfo->extentElements.width,
+                                                                       threadsPerGroup[0]);
+                const uint32  threadGroupsY = RpmUtil::MinThreadGroups(pBaseSubResInfo->extentElements.height,
+                                                                       threadsPerGroup[1]);
 
-                // Create an embedded user-data table and bind it to user data 0. We will need two views.
-                uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(
-                                        pCmdBuffer,
-                                        2 * SrdDwordAlignment() + sizeConstDataDwords,
-                                        SrdDwordAlignment(),
-                                        PipelineBindPoint::Compute,
-                                        0);
-
-                ImageViewInfo imageView[2] = {};
-                RpmUtil::BuildImageViewInfo(
-                    &imageView[0], image, viewRange, createInfo.swizzledFormat, false, device.TexOptLevel()); // src
-                RpmUtil::BuildImageViewInfo(
-                    &imageView[1], image, viewRange, createInfo.swizzledFormat, true, device.TexOptLevel());  // dst
-                device.CreateImageViewSrds(2, &imageView[0], pSrdTable);
-
-                pSrdTable += 2 * SrdDwordAlignment();
-                memcpy(pSrdTable, constData, sizeof(constData));
-
-                // Execute the dispatch.
-                pCmdBuffer->CmdDispatch(threadGroupsX, threadGroupsY, 1);
-            } // end loop through all the slices
-        } // end loop through all the mip levels
-
-        // Allow the rewrite of depth data to complete
-        uint32* pComputeCmdSpace  = pComputeCmdStream->ReserveCommands();
-        pComputeCmdSpace += m_cmdUtil.BuildEventWrite(CS_PARTIAL_FLUSH, pComputeCmdSpace);
-        pComputeCmdStream->CommitCommands(pComputeCmdSpace);
-
-        // Mark all the hTile data as fully expanded
-        ClearHtile(pCmdBuffer, *pGfxImage, range, pHtile->GetInitialValue());
+                const uint32 constData[] =
+                {
+                    // start cb0[0]
+                    pBaseSubResInfo->extentElements.width,
+                    pBaseSubResInfo->extentElements.height,
+                };
 
-        // And wait for that to finish...
-        pComputeCmdSpace  = pComputeCmdStream->ReserveCommands();
-        pComputeCmdSpace += m_cmdUtil.BuildEventWrite(CS_PARTIAL_FLUSH, pComputeCmdSpace);
-        pComputeCmdStream->CommitCommands(pComputeCmdSpace);
+                const uint32 sizeConstDataDwords = NumBytesToNumDwords(sizeof(constData));
 
-        pCmdBuffer->CmdRestoreComputeState(ComputeStatePipelineAndUserData);
+                for (uint32  sliceIdx = 0; sliceIdx < range.numSlices; sliceIdx++)
+                {
+                    const SubresId     subResId =  { mipBaseSubResId.aspect,
+                                                     mipBaseSubResId.mipLevel,
+                                                     range.startSubres.arraySlice + sliceIdx };
+                    const SubresRange  viewRange = { subResId, 1, 1 };
+
+                    // Create an embedded user-data table and bind it to user data 0. We will need two views.
+                    uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(
+                                            pCmdBuffer,
+                                            2 * SrdDwordAlignment() + sizeConstDataDwords,
+                                            SrdDwordAlignment(),
+                                            PipelineBindPoint::Compute,
+                                            0);
+
+                    ImageViewInfo imageView[2] = {};
+                    RpmUtil::BuildImageViewInfo(
+                        &imageView[0], image, viewRange, createInfo.swizzledFormat, false, device.TexOptLevel()); // src
+                    RpmUtil::BuildImageViewInfo(
+                        &imageView[1], image, viewRange, createInfo.swizzledFormat, true, device.TexOptLevel());  // dst
+                    device.CreateImageViewSrds(2, &imageView[0], pSrdTable);
+
+                    pSrdTable += 2 * SrdDwordAlignment();
+                    memcpy(pSrdTable, constData, sizeof(constData));
+
+                    // Execute the dispatch.
+                    pCmdBuffer->CmdDispatch(threadGroupsX, threadGroupsY, 1);
+                } // end loop through all the slices
+            } // end loop through all the mip levels
+
+            // Allow the rewrite of depth data to complete
+            uint32* pComputeCmdSpace  = pComputeCmdStream->ReserveCommands();
+            pComputeCmdSpace += m_cmdUtil.BuildEventWrite(CS_PARTIAL_FLUSH, pComputeCmdSpace);
+            pComputeCmdStream->CommitCommands(pComputeCmdSpace);
+
+            // Mark all the hTile data as fully expanded
+            ClearHtile(pCmdBuffer, *pGfxImage, range, pHtile->GetInitialValue());
+
+            // And wait for that to finish...
+            pComputeCmdSpace  = pComputeCmdStream->ReserveCommands();
+            pComputeCmdSpace += m_cmdUtil.BuildEventWrite(CS_PARTIAL_FLUSH, pComputeCmdSpace);
+            pComputeCmdStream->CommitCommands(pComputeCmdSpace);
+
+            pCmdBuffer->CmdRestoreComputeState(ComputeStatePipelineAndUserData);
+        }
     }
     else
     {
@@ -1192,138 +1198,142 @@ void RsrcProcMgr::HwlHtileCopyAndFixUp(
 
     if (gfx6SrcImage.HasHtileData() && gfx6DstImage.HasHtileData())
     {
-        // Save the command buffer's state.
-        pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
-
         // Use the HtileCopyAndFixUp shader
-        const ComputePipeline*const pPipeline = GetPipeline(RpmComputePipeline::HtileCopyAndFixUp);
-
-        // Bind the pipeline.
-        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
-
-        SubresId dstSubresId = {};
+        const ComputePipeline*const pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::HtileCopyAndFixUp);
 
-        for (uint32 i = 0; i < mergedCount; ++i)
+        if (pPipeline != nullptr)
         {
-            const ImageResolveRegion* pCurRegion = fixUpRegionList[i].pResolveRegion;
+            // Save the command buffer's state.
+            pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
 
-            uint32 dstMipLevel = pCurRegion->dstMipLevel;
-            dstSubresId.aspect = pCurRegion->dstAspect;
-            dstSubresId.mipLevel = dstMipLevel;
-            dstSubresId.arraySlice = pCurRegion->dstSlice;
-            const SubResourceInfo* pDstSubresInfo = dstImage.SubresourceInfo(dstSubresId);
-            const Gfx6Htile* pDstHtile = gfx6DstImage.GetHtile(dstSubresId);
+            // Bind the pipeline.
+            pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
 
-            uint32 htileMask = 0;
-            uint32 htileDecompressValue = 0;
+            SubresId dstSubresId = {};
 
-            if (fixUpRegionList[i].resolveDepth)
+            for (uint32 i = 0; i < mergedCount; ++i)
             {
-                uint32 htileDataDepth = 0;
-                uint32 htileMaskDepth = 0;
+                const ImageResolveRegion* pCurRegion = fixUpRegionList[i].pResolveRegion;
 
-                pDstHtile->GetAspectInitialValue(ImageAspect::Depth, &htileDataDepth, &htileMaskDepth);
+                uint32 dstMipLevel = pCurRegion->dstMipLevel;
+                dstSubresId.aspect = pCurRegion->dstAspect;
+                dstSubresId.mipLevel = dstMipLevel;
+                dstSubresId.arraySlice = pCurRegion->dstSlice;
+                const SubResourceInfo* pDstSubresInfo = dstImage.SubresourceInfo(dstSubresId);
+                const Gfx6Htile* pDstHtile = gfx6DstImage.GetHtile(dstSubresId);
 
-                htileDecompressValue |= htileDataDepth;
-                htileMask |= htileMaskDepth;
-            }
-
-            if (fixUpRegionList[i].resolveStencil)
-            {
-                uint32 htileDataStencil = 0;
-                uint32 htileMaskStencil = 0;
+                uint32 htileMask = 0;
+                uint32 htileDecompressValue = 0;
 
-                pDstHtile->GetAspectInitialValue(ImageAspect::Stencil, &htileDataStencil, &htileMaskStencil);
-
-                htileDecompressValue |= htileDataStencil;
-                htileMask |= htileMaskStencil;
-            }
-
-            PAL_ASSERT(pCurRegion->srcOffset.x == pCurRegion->dstOffset.x);
-            PAL_ASSERT(pCurRegion->srcOffset.y == pCurRegion->dstOffset.y);
+                if (fixUpRegionList[i].resolveDepth)
+                {
+                    uint32 htileDataDepth = 0;
+                    uint32 htileMaskDepth = 0;
 
-            PAL_ASSERT(pCurRegion->dstOffset.x == 0);
-            PAL_ASSERT(pCurRegion->dstOffset.y == 0);
+                    pDstHtile->GetAspectInitialValue(ImageAspect::Depth, &htileDataDepth, &htileMaskDepth);
 
-            PAL_ASSERT(pCurRegion->extent.width == pDstSubresInfo->extentTexels.width);
-            PAL_ASSERT(pCurRegion->extent.height == pDstSubresInfo->extentTexels.height);
+                    htileDecompressValue |= htileDataDepth;
+                    htileMask |= htileMaskDepth;
+                }
 
-            GpuMemory* pSrcGpuMemory = nullptr;
-            gpusize    srcOffset = 0;
-            gpusize    srcDataSize = 0;
+                if (fixUpRegionList[i].resolveStencil)
+                {
+                    uint32 htileDataStencil = 0;
+                    uint32 htileMaskStencil = 0;
 
-            gfx6SrcImage.GetHtileBufferInfo(0,
-                                            pCurRegion->srcSlice,
-                                            pCurRegion->numSlices,
-                                            HtileBufferUsage::Clear,
-                                            &pSrcGpuMemory,
-                                            &srcOffset,
-                                            &srcDataSize);
+                    pDstHtile->GetAspectInitialValue(ImageAspect::Stencil, &htileDataStencil, &htileMaskStencil);
 
-            GpuMemory* pDstGpuMemory = nullptr;
-            gpusize    dstOffset = 0;
-            gpusize    dstDataSize = 0;
+                    htileDecompressValue |= htileDataStencil;
+                    htileMask |= htileMaskStencil;
+                }
 
-            gfx6DstImage.GetHtileBufferInfo(pCurRegion->dstMipLevel,
-                                            pCurRegion->dstSlice,
-                                            pCurRegion->numSlices,
-                                            HtileBufferUsage::Clear,
-                                            &pDstGpuMemory,
-                                            &dstOffset,
-                                            &dstDataSize);
+                PAL_ASSERT(pCurRegion->srcOffset.x == pCurRegion->dstOffset.x);
+                PAL_ASSERT(pCurRegion->srcOffset.y == pCurRegion->dstOffset.y);
 
-            // It is expected that src htile and dst htile has exactly same layout, so dataSize shall be same at least.
-            PAL_ASSERT(srcDataSize == dstDataSize);
+                PAL_ASSERT(pCurRegion->dstOffset.x == 0);
+                PAL_ASSERT(pCurRegion->dstOffset.y == 0);
 
-            BufferViewInfo htileBufferView[2] = {};
+                PAL_ASSERT(pCurRegion->extent.width == pDstSubresInfo->extentTexels.width);
+                PAL_ASSERT(pCurRegion->extent.height == pDstSubresInfo->extentTexels.height);
 
-            htileBufferView[0].gpuAddr = pDstGpuMemory->Desc().gpuVirtAddr + dstOffset;
-            htileBufferView[0].range = dstDataSize;
-            htileBufferView[0].stride = 1;
-            htileBufferView[0].swizzledFormat = UndefinedSwizzledFormat;
+                GpuMemory* pSrcGpuMemory = nullptr;
+                gpusize    srcOffset = 0;
+                gpusize    srcDataSize = 0;
 
-            htileBufferView[1].gpuAddr = pSrcGpuMemory->Desc().gpuVirtAddr + srcOffset;
-            htileBufferView[1].range = srcDataSize;
-            htileBufferView[1].stride = 1;
-            htileBufferView[1].swizzledFormat = UndefinedSwizzledFormat;
+                gfx6SrcImage.GetHtileBufferInfo(0,
+                                                pCurRegion->srcSlice,
+                                                pCurRegion->numSlices,
+                                                HtileBufferUsage::Clear,
+                                                &pSrcGpuMemory,
+                                                &srcOffset,
+                                                &srcDataSize);
 
-            BufferSrd srd[2] = {};
-            m_pDevice->Parent()->CreateUntypedBufferViewSrds(2, htileBufferView, srd);
+                GpuMemory* pDstGpuMemory = nullptr;
+                gpusize    dstOffset = 0;
+                gpusize    dstDataSize = 0;
 
-            const uint32 constData[] =
-            {
-                htileDecompressValue, // zsDecompressedValue
-                htileMask,            // htileMask
-                0u,                   // padding
-                0u                    // padding
-            };
+                gfx6DstImage.GetHtileBufferInfo(pCurRegion->dstMipLevel,
+                                                pCurRegion->dstSlice,
+                                                pCurRegion->numSlices,
+                                                HtileBufferUsage::Clear,
+                                                &pDstGpuMemory,
+                                                &dstOffset,
+                                                &dstDataSize);
 
-            static const uint32 sizeBufferSrdDwords = NumBytesToNumDwords(sizeof(BufferSrd));
-            static const uint32 sizeConstDataDwords = NumBytesToNumDwords(sizeof(constData));
+                // It is expected that src htile and dst htile has exactly same layout, so dataSize shall be same at
+                // least.
+                PAL_ASSERT(srcDataSize == dstDataSize);
 
-            uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
-                sizeBufferSrdDwords * 2 + sizeConstDataDwords,
-                sizeBufferSrdDwords,
-                PipelineBindPoint::Compute,
-                0);
+                BufferViewInfo htileBufferView[2] = {};
 
-            // Put the SRDs for the hTile buffer into shader-accessible memory
-            memcpy(pSrdTable, &srd[0], sizeof(srd));
-            pSrdTable += sizeBufferSrdDwords * 2;
+                htileBufferView[0].gpuAddr = pDstGpuMemory->Desc().gpuVirtAddr + dstOffset;
+                htileBufferView[0].range = dstDataSize;
+                htileBufferView[0].stride = 1;
+                htileBufferView[0].swizzledFormat = UndefinedSwizzledFormat;
 
-            // Provide the shader with all kinds of fun dimension info
-            memcpy(pSrdTable, &constData, sizeof(constData));
+                htileBufferView[1].gpuAddr = pSrcGpuMemory->Desc().gpuVirtAddr + srcOffset;
+                htileBufferView[1].range = srcDataSize;
+                htileBufferView[1].stride = 1;
+                htileBufferView[1].swizzledFormat = UndefinedSwizzledFormat;
 
-            // Issue a dispatch with one thread per HTile DWORD.
-            const uint32 htileDwords = static_cast<uint32>(dstDataSize / sizeof(uint32));
-            // We'll launch cs thread that does not check boundary. So let the driver be the safe guard.
-            PAL_ASSERT(IsPow2Aligned(htileDwords, 64) && (htileDwords >= 64));
-            const uint32 threadGroups = RpmUtil::MinThreadGroups(htileDwords, pPipeline->ThreadsPerGroup());
-            pCmdBuffer->CmdDispatch(threadGroups, 1, 1);
-        } // End of for
+                BufferSrd srd[2] = {};
+                m_pDevice->Parent()->CreateUntypedBufferViewSrds(2, htileBufferView, srd);
 
-        // Restore the command buffer's state.
-        pCmdBuffer->CmdRestoreComputeState(ComputeStatePipelineAndUserData);
+                const uint32 constData[] =
+                {
+                    htileDecompressValue, // zsDecompressedValue
+                    htileMask,            // htileMask
+                    0u,                   // padding
+                    0u                    // padding
+                };
+
+                static const uint32 sizeBufferSrdDwords = NumBytesToNumDwords(sizeof(BufferSrd));
+                static const uint32 sizeConstDataDwords = NumBytesToNumDwords(sizeof(constData));
+
+                uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
+                    sizeBufferSrdDwords * 2 + sizeConstDataDwords,
+                    sizeBufferSrdDwords,
+                    PipelineBindPoint::Compute,
+                    0);
+
+                // Put the SRDs for the hTile buffer into shader-accessible memory
+                memcpy(pSrdTable, &srd[0], sizeof(srd));
+                pSrdTable += sizeBufferSrdDwords * 2;
+
+                // Provide the shader with all kinds of fun dimension info
+                memcpy(pSrdTable, &constData, sizeof(constData));
+
+                // Issue a dispatch with one thread per HTile DWORD.
+                const uint32 htileDwords = static_cast<uint32>(dstDataSize / sizeof(uint32));
+                // We'll launch cs thread that does not check boundary. So let the driver be the safe guard.
+                PAL_ASSERT(IsPow2Aligned(htileDwords, 64) && (htileDwords >= 64));
+                const uint32 threadGroups = RpmUtil::MinThreadGroups(htileDwords, pPipeline->ThreadsPerGroup());
+                pCmdBuffer->CmdDispatch(threadGroups, 1, 1);
+            } // End of for
+
+            // Restore the command buffer's state.
+            pCmdBuffer->CmdRestoreComputeState(ComputeStatePipelineAndUserData);
+        }
     }
 }
 
@@ -1967,50 +1977,53 @@ void RsrcProcMgr::HwlExpandHtileHiZRange(
     else
     {
         // Use the depth-clear read-write shader.
-        const ComputePipeline*const pPipeline = GetPipeline(RpmComputePipeline::FastDepthClear);
-
-        // Bind the pipeline.
-        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
-
-        // Put the new HTile data in user data 4 and the old HTile data mask in user data 5.
-        const uint32 htileUserData[2] = { htileValue & htileMask, ~htileMask };
-        pCmdBuffer->CmdSetUserData(PipelineBindPoint::Compute, 4, 2, htileUserData);
+        const ComputePipeline*const pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::FastDepthClear);
 
-        // For each mipmap level: create a temporary buffer object bound to the location in video memory where that
-        // mip's HTile buffer resides. Then, issue a dispatch to update the HTile contents to reflect the
-        // "full HiZ range" state.
-        const uint32 lastMip = range.startSubres.mipLevel + range.numMips - 1;
-        for (uint32 mip = range.startSubres.mipLevel; mip <= lastMip; ++mip)
+        if (pPipeline != nullptr)
         {
-            GpuMemory* pGpuMemory = nullptr;
-            gpusize    offset     = 0;
-            gpusize    dataSize   = 0;
-
-            gfx6Image.GetHtileBufferInfo(mip,
-                                     range.startSubres.arraySlice,
-                                     range.numSlices,
-                                     HtileBufferUsage::Clear,
-                                     &pGpuMemory,
-                                     &offset,
-                                     &dataSize);
-
-            BufferViewInfo htileBufferView = {};
-            htileBufferView.gpuAddr        = pGpuMemory->Desc().gpuVirtAddr + offset;
-            htileBufferView.range          = dataSize;
-            htileBufferView.stride         = sizeof(uint32);
-            htileBufferView.swizzledFormat.format  = ChNumFormat::X32_Uint;
-            htileBufferView.swizzledFormat.swizzle =
-                { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
-
-            BufferSrd srd = { };
-            m_pDevice->Parent()->CreateTypedBufferViewSrds(1, &htileBufferView, &srd);
-
-            pCmdBuffer->CmdSetUserData(PipelineBindPoint::Compute, 0, 4, &srd.word0.u32All);
-
-            // Issue a dispatch with one thread per HTile DWORD.
-            const uint32 htileDwords  = static_cast<uint32>(htileBufferView.range / sizeof(uint32));
-            const uint32 threadGroups = RpmUtil::MinThreadGroups(htileDwords, pPipeline->ThreadsPerGroup());
-            pCmdBuffer->CmdDispatch(threadGroups, 1, 1);
+            // Bind the pipeline.
+            pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
+
+            // Put the new HTile data in user data 4 and the old HTile data mask in user data 5.
+            const uint32 htileUserData[2] = { htileValue & htileMask, ~htileMask };
+            pCmdBuffer->CmdSetUserData(PipelineBindPoint::Compute, 4, 2, htileUserData);
+
+            // For each mipmap level: create a temporary buffer object bound to the location in video memory where that
+            // mip's HTile buffer resides. Then, issue a dispatch to update the HTile contents to reflect the
+            // "full HiZ range" state.
+            const uint32 lastMip = range.startSubres.mipLevel + range.numMips - 1;
+            for (uint32 mip = range.startSubres.mipLevel; mip <= lastMip; ++mip)
+            {
+                GpuMemory* pGpuMemory = nullptr;
+                gpusize    offset     = 0;
+                gpusize    dataSize   = 0;
+
+                gfx6Image.GetHtileBufferInfo(mip,
+                                         range.startSubres.arraySlice,
+                                         range.numSlices,
+                                         HtileBufferUsage::Clear,
+                                         &pGpuMemory,
+                                         &offset,
+                                         &dataSize);
+
+                BufferViewInfo htileBufferView = {};
+                htileBufferView.gpuAddr        = pGpuMemory->Desc().gpuVirtAddr + offset;
+                htileBufferView.range          = dataSize;
+                htileBufferView.stride         = sizeof(uint32);
+                htileBufferView.swizzledFormat.format  = ChNumFormat::X32_Uint;
+                htileBufferView.swizzledFormat.swizzle =
+                    { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
+
+                BufferSrd srd = { };
+                m_pDevice->Parent()->CreateTypedBufferViewSrds(1, &htileBufferView, &srd);
+
+                pCmdBuffer->CmdSetUserData(PipelineBindPoint::Compute, 0, 4, &srd.word0.u32All);
+
+                // Issue a dispatch with one thread per HTile DWORD.
+                const uint32 htileDwords  = static_cast<uint32>(htileBufferView.range / sizeof(uint32));
+                const uint32 threadGroups = RpmUtil::MinThreadGroups(htileDwords, pPipeline->ThreadsPerGroup());
+                pCmdBuffer->CmdDispatch(threadGroups, 1, 1);
+            }
         }
     }
 
@@ -2061,7 +2074,8 @@ void RsrcProcMgr::FastDepthStencilClearCompute(
     pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
 
     // Determine which pipeline to use for this clear.
-    const ComputePipeline* pPipeline = GetLinearHtileClearPipeline(m_pDevice->Settings().dbPerTileExpClearEnable,
+    const ComputePipeline* pPipeline = GetLinearHtileClearPipeline(pCmdBuffer,
+                                                                   m_pDevice->Settings().dbPerTileExpClearEnable,
                                                                    pBaseHtile->TileStencilDisabled(),
                                                                    htileMask);
 
@@ -2229,131 +2243,135 @@ void RsrcProcMgr::DepthStencilClearGraphics(
     bindTargetsInfo.depthTarget.depthLayout   = depthLayout;
     bindTargetsInfo.depthTarget.stencilLayout = stencilLayout;
 
-    // Save current command buffer state and bind graphics state which is common for all mipmap levels.
-    pCmdBuffer->PushGraphicsState();
-
     // Bind the depth expand state because it's just a full image quad and a zero PS (with no internal flags) which
     // is also what we need for the clear.
-    pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Graphics, GetGfxPipeline(DepthExpand), });
-    pCmdBuffer->CmdBindMsaaState(GetMsaaState(dstImage.Parent()->GetImageCreateInfo().samples,
-                                              dstImage.Parent()->GetImageCreateInfo().fragments));
-    pCmdBuffer->CmdSetDepthBiasState(depthBias);
-    pCmdBuffer->CmdSetInputAssemblyState(inputAssemblyState);
-    pCmdBuffer->CmdSetPointLineRasterState(pointLineRasterState);
-    pCmdBuffer->CmdSetStencilRefMasks(stencilRefMasks);
-    pCmdBuffer->CmdSetTriangleRasterState(triangleRasterState);
+    const Pal::GraphicsPipeline*const pPipeline = GetGfxPipeline(pCmdBuffer, DepthExpand);
 
-    // Select a depth/stencil state object for this clear:
-    if (clearDepth && clearStencil)
-    {
-        pCmdBuffer->CmdBindDepthStencilState(m_pDepthStencilClearState);
-    }
-    else if (clearDepth)
-    {
-        pCmdBuffer->CmdBindDepthStencilState(m_pDepthClearState);
-    }
-    else if (clearStencil)
-    {
-        pCmdBuffer->CmdBindDepthStencilState(m_pStencilClearState);
-    }
-
-    // All mip levels share the same depth export value, so only need to do it once.
-    RpmUtil::WriteVsZOut(pCmdBuffer, depth);
-
-    // Box of partial clear is only valid when number of mip-map is equal to 1.
-    PAL_ASSERT((boxCnt == 0) || ((pBox != nullptr) && (range.numMips == 1)));
-    uint32 scissorCnt = (boxCnt > 0) ? boxCnt : 1;
-
-    // Each mipmap level has to be fast-cleared individually because a depth target view can only be tied to a
-    //single mipmap level of the destination Image.
-    const uint32 lastMip = (range.startSubres.mipLevel + range.numMips - 1);
-    for (depthViewInfo.mipLevel  = range.startSubres.mipLevel;
-         depthViewInfo.mipLevel <= lastMip;
-         ++depthViewInfo.mipLevel)
+    if (pPipeline != nullptr)
     {
-        const SubresId         subres     = { range.startSubres.aspect, depthViewInfo.mipLevel, 0 };
-        const SubResourceInfo& subResInfo = *dstImage.Parent()->SubresourceInfo(subres);
-
-        // All slices of the same mipmap level can re-use the same viewport and scissor state.
-        viewportInfo.viewports[0].width  = static_cast<float>(subResInfo.extentTexels.width);
-        viewportInfo.viewports[0].height = static_cast<float>(subResInfo.extentTexels.height);
+        // Save current command buffer state and bind graphics state which is common for all mipmap levels.
+        pCmdBuffer->PushGraphicsState();
+        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Graphics, pPipeline, });
+        pCmdBuffer->CmdBindMsaaState(GetMsaaState(dstImage.Parent()->GetImageCreateInfo().samples,
+                                                  dstImage.Parent()->GetImageCreateInfo().fragments));
+        pCmdBuffer->CmdSetDepthBiasState(depthBias);
+        pCmdBuffer->CmdSetInputAssemblyState(inputAssemblyState);
+        pCmdBuffer->CmdSetPointLineRasterState(pointLineRasterState);
+        pCmdBuffer->CmdSetStencilRefMasks(stencilRefMasks);
+        pCmdBuffer->CmdSetTriangleRasterState(triangleRasterState);
+
+        // Select a depth/stencil state object for this clear:
+        if (clearDepth && clearStencil)
+        {
+            pCmdBuffer->CmdBindDepthStencilState(m_pDepthStencilClearState);
+        }
+        else if (clearDepth)
+        {
+            pCmdBuffer->CmdBindDepthStencilState(m_pDepthClearState);
+        }
+        else if (clearStencil)
+        {
+            pCmdBuffer->CmdBindDepthStencilState(m_pStencilClearState);
+        }
 
-        scissorInfo.scissors[0].extent.width  = subResInfo.extentTexels.width;
-        scissorInfo.scissors[0].extent.height = subResInfo.extentTexels.height;
+        // All mip levels share the same depth export value, so only need to do it once.
+        RpmUtil::WriteVsZOut(pCmdBuffer, depth);
 
-        pCmdBuffer->CmdSetViewports(viewportInfo);
+        // Box of partial clear is only valid when number of mip-map is equal to 1.
+        PAL_ASSERT((boxCnt == 0) || ((pBox != nullptr) && (range.numMips == 1)));
+        uint32 scissorCnt = (boxCnt > 0) ? boxCnt : 1;
 
-        // If these flags are set, then the DB will do a fast-clear.  With them not set, then we wind up doing a
-        // slow clear with the Z-value being exported by the VS.
-        //
-        //     [If the surface can be bound as a texture, ] then we cannot do fast clears to a value that
-        //     isn't 0.0 or 1.0.  In this case, you would need a medium rate clear, which can be done
-        //     with CLEAR_DISALLOWED (assuming that feature works), or by setting CLEAR_ENABLE=0, and rendering
-        //     a full screen rect that has the clear value this will become a set of fast_set tiles, which are
-        //     faster than a slow clear, but not as fast as a real fast clear
-        //
-        //     Z_INFO and STENCIL_INFO CLEAR_DISALLOWED were never reliably working on GFX8 or 9.  Although the
-        //     bit is not implemented, it does actually connect into logic.  In block regressions, some tests
-        //     worked but many tests did not work using this bit.  Please do not set this bit
-
-        depthViewInfoInternal.flags.isDepthClear   = (fastClear && clearDepth);
-        depthViewInfoInternal.flags.isStencilClear = (fastClear && clearStencil);
-
-        // Issue a fast clear draw for each slice of the current mip level.
-        const uint32 lastSlice = (range.startSubres.arraySlice + range.numSlices - 1);
-        for (depthViewInfo.baseArraySlice  = range.startSubres.arraySlice;
-             depthViewInfo.baseArraySlice <= lastSlice;
-             ++depthViewInfo.baseArraySlice)
+        // Each mipmap level has to be fast-cleared individually because a depth target view can only be tied to a
+        //single mipmap level of the destination Image.
+        const uint32 lastMip = (range.startSubres.mipLevel + range.numMips - 1);
+        for (depthViewInfo.mipLevel  = range.startSubres.mipLevel;
+             depthViewInfo.mipLevel <= lastMip;
+             ++depthViewInfo.mipLevel)
         {
-            LinearAllocatorAuto<VirtualLinearAllocator> sliceAllocator(pCmdBuffer->Allocator(), false);
-
-            IDepthStencilView* pDepthView = nullptr;
-            void* pDepthViewMem =
-                PAL_MALLOC(m_pDevice->GetDepthStencilViewSize(nullptr), &sliceAllocator, AllocInternalTemp);
-
-            if (pDepthViewMem == nullptr)
-            {
-                pCmdBuffer->NotifyAllocFailure();
-            }
-            else
+            const SubresId         subres     = { range.startSubres.aspect, depthViewInfo.mipLevel, 0 };
+            const SubResourceInfo& subResInfo = *dstImage.Parent()->SubresourceInfo(subres);
+
+            // All slices of the same mipmap level can re-use the same viewport and scissor state.
+            viewportInfo.viewports[0].width  = static_cast<float>(subResInfo.extentTexels.width);
+            viewportInfo.viewports[0].height = static_cast<float>(subResInfo.extentTexels.height);
+
+            scissorInfo.scissors[0].extent.width  = subResInfo.extentTexels.width;
+            scissorInfo.scissors[0].extent.height = subResInfo.extentTexels.height;
+
+            pCmdBuffer->CmdSetViewports(viewportInfo);
+
+            // If these flags are set, then the DB will do a fast-clear.  With them not set, then we wind up doing a
+            // slow clear with the Z-value being exported by the VS.
+            //
+            //     [If the surface can be bound as a texture, ] then we cannot do fast clears to a value that
+            //     isn't 0.0 or 1.0.  In this case, you would need a medium rate clear, which can be done
+            //     with CLEAR_DISALLOWED (assuming that feature works), or by setting CLEAR_ENABLE=0, and rendering
+            //     a full screen rect that has the clear value this will become a set of fast_set tiles, which are
+            //     faster than a slow clear, but not as fast as a real fast clear
+            //
+            //     Z_INFO and STENCIL_INFO CLEAR_DISALLOWED were never reliably working on GFX8 or 9.  Although the
+            //     bit is not implemented, it does actually connect into logic.  In block regressions, some tests
+            //     worked but many tests did not work using this bit.  Please do not set this bit
+
+            depthViewInfoInternal.flags.isDepthClear   = (fastClear && clearDepth);
+            depthViewInfoInternal.flags.isStencilClear = (fastClear && clearStencil);
+
+            // Issue a fast clear draw for each slice of the current mip level.
+            const uint32 lastSlice = (range.startSubres.arraySlice + range.numSlices - 1);
+            for (depthViewInfo.baseArraySlice  = range.startSubres.arraySlice;
+                 depthViewInfo.baseArraySlice <= lastSlice;
+                 ++depthViewInfo.baseArraySlice)
             {
-                Result result = m_pDevice->CreateDepthStencilView(depthViewInfo,
-                                                                  depthViewInfoInternal,
-                                                                  pDepthViewMem,
-                                                                  &pDepthView);
-                PAL_ASSERT(result == Result::Success);
+                LinearAllocatorAuto<VirtualLinearAllocator> sliceAllocator(pCmdBuffer->Allocator(), false);
 
-                // Bind the depth view for this mip and slice.
-                bindTargetsInfo.depthTarget.pDepthStencilView = pDepthView;
-                pCmdBuffer->CmdBindTargets(bindTargetsInfo);
+                IDepthStencilView* pDepthView = nullptr;
+                void* pDepthViewMem =
+                    PAL_MALLOC(m_pDevice->GetDepthStencilViewSize(nullptr), &sliceAllocator, AllocInternalTemp);
 
-                for (uint32 i = 0; i < scissorCnt; i++)
+                if (pDepthViewMem == nullptr)
+                {
+                    pCmdBuffer->NotifyAllocFailure();
+                }
+                else
                 {
-                    if (boxCnt > 0)
+                    Result result = m_pDevice->CreateDepthStencilView(depthViewInfo,
+                                                                      depthViewInfoInternal,
+                                                                      pDepthViewMem,
+                                                                      &pDepthView);
+                    PAL_ASSERT(result == Result::Success);
+
+                    // Bind the depth view for this mip and slice.
+                    bindTargetsInfo.depthTarget.pDepthStencilView = pDepthView;
+                    pCmdBuffer->CmdBindTargets(bindTargetsInfo);
+
+                    for (uint32 i = 0; i < scissorCnt; i++)
                     {
-                        scissorInfo.scissors[0].offset.x      = pBox[i].offset.x;
-                        scissorInfo.scissors[0].offset.y      = pBox[i].offset.y;
-                        scissorInfo.scissors[0].extent.width  = pBox[i].extent.width;
-                        scissorInfo.scissors[0].extent.height = pBox[i].extent.height;
-                    }
+                        if (boxCnt > 0)
+                        {
+                            scissorInfo.scissors[0].offset.x      = pBox[i].offset.x;
+                            scissorInfo.scissors[0].offset.y      = pBox[i].offset.y;
+                            scissorInfo.scissors[0].extent.width  = pBox[i].extent.width;
+                            scissorInfo.scissors[0].extent.height = pBox[i].extent.height;
+                        }
 
-                    pCmdBuffer->CmdSetScissorRects(scissorInfo);
+                        pCmdBuffer->CmdSetScissorRects(scissorInfo);
 
-                    // Draw a fullscreen quad.
-                    pCmdBuffer->CmdDraw(0, 3, 0, 1);
-                }
+                        // Draw a fullscreen quad.
+                        pCmdBuffer->CmdDraw(0, 3, 0, 1);
+                    }
 
-                // Unbind the depth view and destroy it.
-                bindTargetsInfo.depthTarget.pDepthStencilView = nullptr;
-                pCmdBuffer->CmdBindTargets(bindTargetsInfo);
+                    // Unbind the depth view and destroy it.
+                    bindTargetsInfo.depthTarget.pDepthStencilView = nullptr;
+                    pCmdBuffer->CmdBindTargets(bindTargetsInfo);
 
-                PAL_SAFE_FREE(pDepthViewMem, &sliceAllocator);
-            }
-        } // End for each slice.
-    } // End for each mip.
+                    PAL_SAFE_FREE(pDepthViewMem, &sliceAllocator);
+                }
+            } // End for each slice.
+        } // End for each mip.
 
-    // Restore original command buffer state and destroy the depth/stencil state.
-    pCmdBuffer->PopGraphicsState();
+        // Restore original command buffer state and destroy the depth/stencil state.
+        pCmdBuffer->PopGraphicsState();
+    }
 }
 
 // =====================================================================================================================
@@ -2699,71 +2717,75 @@ void RsrcProcMgr::ClearHtileAspect(
 #endif
 
     // Use the fast depth clear pipeline.
-    const ComputePipeline* pPipeline = GetPipeline(RpmComputePipeline::FastDepthClear);
+    const ComputePipeline* pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::FastDepthClear);
 
-    // Bind the pipeline.
-    pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
-
-    // Put the new HTile data in user data 4 and the old HTile data mask in user data 5.
-    const uint32 htileUserData[2] = { htileValue & htileMask, ~htileMask };
-    pCmdBuffer->CmdSetUserData(PipelineBindPoint::Compute, 4, 2, htileUserData);
-
-    // For each mipmap level: create a temporary buffer object bound to the location in video memory where that
-    // mip's HTile buffer resides. Then, issue a dispatch to update the HTile contents to reflect the initialized
-    // state.
-    const uint32 lastMip = range.startSubres.mipLevel + range.numMips - 1;
-    for (uint32 mip = range.startSubres.mipLevel; mip <= lastMip; ++mip)
+    if (pPipeline != nullptr)
     {
-        GpuMemory* pGpuMemory = nullptr;
-        gpusize    offset     = 0;
-        gpusize    dataSize   = 0;
+        // Bind the pipeline.
+        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
 
-        dstImage.GetHtileBufferInfo(mip,
-                                    range.startSubres.arraySlice,
-                                    range.numSlices,
-                                    HtileBufferUsage::Init,
-                                    &pGpuMemory,
-                                    &offset,
-                                    &dataSize);
+        // Put the new HTile data in user data 4 and the old HTile data mask in user data 5.
+        const uint32 htileUserData[2] = { htileValue & htileMask, ~htileMask };
+        pCmdBuffer->CmdSetUserData(PipelineBindPoint::Compute, 4, 2, htileUserData);
 
-        BufferViewInfo htileBufferView = {};
-        htileBufferView.gpuAddr        = pGpuMemory->Desc().gpuVirtAddr + offset;
-        htileBufferView.range          = dataSize;
-        htileBufferView.stride         = sizeof(uint32);
-        htileBufferView.swizzledFormat.format  = ChNumFormat::X32_Uint;
-        htileBufferView.swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
+        // For each mipmap level: create a temporary buffer object bound to the location in video memory where that
+        // mip's HTile buffer resides. Then, issue a dispatch to update the HTile contents to reflect the initialized
+        // state.
+        const uint32 lastMip = range.startSubres.mipLevel + range.numMips - 1;
+        for (uint32 mip = range.startSubres.mipLevel; mip <= lastMip; ++mip)
+        {
+            GpuMemory* pGpuMemory = nullptr;
+            gpusize    offset     = 0;
+            gpusize    dataSize   = 0;
 
-        BufferSrd srd = {};
-        m_pDevice->Parent()->CreateTypedBufferViewSrds(1, &htileBufferView, &srd);
+            dstImage.GetHtileBufferInfo(mip,
+                                        range.startSubres.arraySlice,
+                                        range.numSlices,
+                                        HtileBufferUsage::Init,
+                                        &pGpuMemory,
+                                        &offset,
+                                        &dataSize);
 
-        pCmdBuffer->CmdSetUserData(PipelineBindPoint::Compute, 0, 4, &srd.word0.u32All);
+            BufferViewInfo htileBufferView = {};
+            htileBufferView.gpuAddr        = pGpuMemory->Desc().gpuVirtAddr + offset;
+            htileBufferView.range          = dataSize;
+            htileBufferView.stride         = sizeof(uint32);
+            htileBufferView.swizzledFormat.format  = ChNumFormat::X32_Uint;
+            htileBufferView.swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
 
-        // Issue a dispatch with one thread per HTile DWORD.
-        const uint32 htileDwords  = static_cast<uint32>(htileBufferView.range / sizeof(uint32));
-        const uint32 threadGroups = RpmUtil::MinThreadGroups(htileDwords, pPipeline->ThreadsPerGroup());
-        pCmdBuffer->CmdDispatch(threadGroups, 1, 1);
-    }
+            BufferSrd srd = {};
+            m_pDevice->Parent()->CreateTypedBufferViewSrds(1, &htileBufferView, &srd);
 
-    // Note: When performing a stencil-only or depth-only initialization on an Image which has both aspects, we have a
-    // potential problem because the two separate aspects utilize the same HTile memory. Single-aspect initializations
-    // perform a read-modify-write of HTile memory, which can cause synchronization issues later-on because no
-    // resource transition is needed on the depth aspect when initializing stencil (and vice-versa). The solution
-    // is to add a CS_PARTIAL_FLUSH and a Texture Cache Flush after executing a single-aspect initialization.
-    if (pHtile->GetHtileContents() == HtileContents::DepthStencil)
-    {
-        regCP_COHER_CNTL cpCoherCntl;
-        cpCoherCntl.u32All = CpCoherCntlTexCacheMask;
+            pCmdBuffer->CmdSetUserData(PipelineBindPoint::Compute, 0, 4, &srd.word0.u32All);
 
-        uint32* pCmdSpace = pCmdStream->ReserveCommands();
-        pCmdSpace += m_cmdUtil.BuildEventWrite(CS_PARTIAL_FLUSH, pCmdSpace);
-        pCmdSpace += m_cmdUtil.BuildGenericSync(cpCoherCntl,
-                                                SURFACE_SYNC_ENGINE_ME,
-                                                FullSyncBaseAddr,
-                                                FullSyncSize,
-                                                pCmdStream->GetEngineType() == EngineTypeCompute,
-                                                pCmdSpace);
-        pCmdStream->CommitCommands(pCmdSpace);
+            // Issue a dispatch with one thread per HTile DWORD.
+            const uint32 htileDwords  = static_cast<uint32>(htileBufferView.range / sizeof(uint32));
+            const uint32 threadGroups = RpmUtil::MinThreadGroups(htileDwords, pPipeline->ThreadsPerGroup());
+            pCmdBuffer->CmdDispatch(threadGroups, 1, 1);
+        }
+
+        // Note: When performing a stencil-only or depth-only initialization on an Image which has both aspects, we
+        // have a potential problem because the two separate aspects utilize the same HTile memory. Single-aspect
+        // initializations perform a read-modify-write of HTile memory, which can cause synchronization issues
+        // later-on because no resource transition is needed on the depth aspect when initializing stencil (and
+        // vice-versa). The solution is to add a CS_PARTIAL_FLUSH and a Texture Cache Flush after executing a
+        // single-aspect initialization.
+        if (pHtile->GetHtileContents() == HtileContents::DepthStencil)
+        {
+            regCP_COHER_CNTL cpCoherCntl;
+            cpCoherCntl.u32All = CpCoherCntlTexCacheMask;
+
+            uint32* pCmdSpace = pCmdStream->ReserveCommands();
+            pCmdSpace += m_cmdUtil.BuildEventWrite(CS_PARTIAL_FLUSH, pCmdSpace);
+            pCmdSpace += m_cmdUtil.BuildGenericSync(cpCoherCntl,
+                                                    SURFACE_SYNC_ENGINE_ME,
+                                                    FullSyncBaseAddr,
+                                                    FullSyncSize,
+                                                    pCmdStream->GetEngineType() == EngineTypeCompute,
+                                                    pCmdSpace);
+            pCmdStream->CommitCommands(pCmdSpace);
+        }
     }
 }
 
@@ -2885,7 +2907,7 @@ void RsrcProcMgr::DccDecompressOnCompute(
 
     const auto&  device            = *m_pDevice->Parent();
     const auto&  parentImg         = *image.Parent();
-    const auto*  pPipeline         = GetComputeMaskRamExpandPipeline(parentImg);
+    const auto*  pPipeline         = GetComputeMaskRamExpandPipeline(pCmdBuffer, parentImg);
     auto*        pComputeCmdStream = pCmdBuffer->GetCmdStreamByEngine(CmdBufferEngineSupport::Compute);
     uint32*      pComputeCmdSpace  = nullptr;
     const auto&  createInfo        = parentImg.GetImageCreateInfo();
@@ -2893,92 +2915,96 @@ void RsrcProcMgr::DccDecompressOnCompute(
     // If this trips, we have a big problem...
     PAL_ASSERT(pComputeCmdStream != nullptr);
 
-    // Compute the number of thread groups needed to launch one thread per texel.
-    uint32 threadsPerGroup[3] = {};
-    pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
+    if (pPipeline != nullptr)
+    {
+        // Compute the number of thread groups needed to launch one thread per texel.
+        uint32 threadsPerGroup[3] = {};
+        pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
 
-    pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
-    pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
+        pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
+        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
 
-    const uint32 lastMip    = range.startSubres.mipLevel + range.numMips - 1;
-    bool         earlyExit  = false;
+        const uint32 lastMip    = range.startSubres.mipLevel + range.numMips - 1;
+        bool         earlyExit  = false;
 
-    for (uint32  mipLevel = range.startSubres.mipLevel; ((earlyExit == false) && (mipLevel <= lastMip)); mipLevel++)
-    {
-        const SubresId              mipBaseSubResId = { range.startSubres.aspect, mipLevel, 0 };
-        const SubResourceInfo*const pBaseSubResInfo = image.Parent()->SubresourceInfo(mipBaseSubResId);
+        for (uint32  mipLevel = range.startSubres.mipLevel; ((earlyExit == false) && (mipLevel <= lastMip)); mipLevel++)
+        {
+            const SubresId              mipBaseSubResId = { range.startSubres.aspect, mipLevel, 0 };
+            const SubResourceInfo*const pBaseSubResInfo = image.Parent()->SubresourceInfo(mipBaseSubResId);
 
-        // Blame the caller if this trips...
-        PAL_ASSERT(pBaseSubResInfo->flags.supportMetaDataTexFetch);
+            // Blame the caller if this trips...
+            PAL_ASSERT(pBaseSubResInfo->flags.supportMetaDataTexFetch);
 
-        const uint32  threadGroupsX = RpmUtil::MinThreadGroups(pBaseSubResInfo->extentElements.width,
-                                                               threadsPerGroup[0]);
-        const uint32  threadGroupsY = RpmUtil::MinThreadGroups(pBaseSubResInfo->extentElements.height,
-                                                               threadsPerGroup[1]);
-        const uint32 constData[] =
-        {
-            // start cb0[0]
-            pBaseSubResInfo->extentElements.width,
-            pBaseSubResInfo->extentElements.height,
-        };
+            const uint32  threadGroupsX = RpmUtil::MinThreadGroups(pBaseSubResInfo->extentElements.width,
+                                                                   threadsPerGroup[0]);
+            const uint32  threadGroupsY = RpmUtil::MinThreadGroups(pBaseSubResInfo->extentElements.height,
+                                                                   threadsPerGroup[1]);
+            const uint32 constData[] =
+            {
+                // start cb0[0]
+                pBaseSubResInfo->extentElements.width,
+                pBaseSubResInfo->extentElements.height,
+            };
 
-        const uint32 sizeConstDataDwords = NumBytesToNumDwords(sizeof(constData));
+            const uint32 sizeConstDataDwords = NumBytesToNumDwords(sizeof(constData));
 
-        for (uint32  sliceIdx = 0; sliceIdx < range.numSlices; sliceIdx++)
-        {
-            const SubresId     subResId =  { mipBaseSubResId.aspect,
-                                             mipBaseSubResId.mipLevel,
-                                             range.startSubres.arraySlice + sliceIdx };
-            const SubresRange  viewRange = { subResId, 1, 1 };
-
-            // Create an embedded user-data table and bind it to user data 0. We will need two views.
-            uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
-                                                                        2 * SrdDwordAlignment() + sizeConstDataDwords,
-                                                                        SrdDwordAlignment(),
-                                                                        PipelineBindPoint::Compute,
-                                                                        0);
-
-            ImageViewInfo imageView[2] = {};
-            RpmUtil::BuildImageViewInfo(
-                &imageView[0], parentImg, viewRange, createInfo.swizzledFormat, false, device.TexOptLevel()); // src
-            RpmUtil::BuildImageViewInfo(
-                &imageView[1], parentImg, viewRange, createInfo.swizzledFormat, true, device.TexOptLevel());  // dst
-            device.CreateImageViewSrds(2, &imageView[0], pSrdTable);
-
-            pSrdTable += 2 * SrdDwordAlignment();
-            memcpy(pSrdTable, constData, sizeof(constData));
-
-            // Execute the dispatch.
-            pCmdBuffer->CmdDispatch(threadGroupsX, threadGroupsY, 1);
-        } // end loop through all the slices
-
-        // We have to mark this mip level as actually being DCC decompressed
-        pComputeCmdSpace = pComputeCmdStream->ReserveCommands();
-        pComputeCmdSpace += m_cmdUtil.BuildWriteData(image.GetDccStateMetaDataAddr(mipLevel),
-                                                     NumBytesToNumDwords(sizeof(MipDccStateMetaData)),
-                                                     0,     // engine select, ignored for compute
-                                                     WRITE_DATA_DST_SEL_MEMORY_ASYNC,
-                                                     1,     // write confirm
-                                                     reinterpret_cast<const uint32*>(&zero),
-                                                     PredDisable,
-                                                     pComputeCmdSpace);
-        pComputeCmdStream->CommitCommands(pComputeCmdSpace);
-    }
+            for (uint32  sliceIdx = 0; sliceIdx < range.numSlices; sliceIdx++)
+            {
+                const SubresId     subResId =  { mipBaseSubResId.aspect,
+                                                 mipBaseSubResId.mipLevel,
+                                                 range.startSubres.arraySlice + sliceIdx };
+                const SubresRange  viewRange = { subResId, 1, 1 };
 
-    // Make sure that the decompressed image data has been written before we start fixing up DCC memory.
-    pComputeCmdSpace  = pComputeCmdStream->ReserveCommands();
-    pComputeCmdSpace += m_cmdUtil.BuildEventWrite(CS_PARTIAL_FLUSH, pComputeCmdSpace);
-    pComputeCmdStream->CommitCommands(pComputeCmdSpace);
+                // Create an embedded user-data table and bind it to user data 0. We will need two views.
+                uint32* pSrdTable =
+                    RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
+                                                           2 * SrdDwordAlignment() + sizeConstDataDwords,
+                                                           SrdDwordAlignment(),
+                                                           PipelineBindPoint::Compute,
+                                                           0);
 
-    // Put DCC memory itself back into a "fully decompressed" state.
-    ClearDcc(pCmdBuffer, pCmdStream, image, range, Gfx6Dcc::InitialValue, DccClearPurpose::Init);
+                ImageViewInfo imageView[2] = {};
+                RpmUtil::BuildImageViewInfo(
+                    &imageView[0], parentImg, viewRange, createInfo.swizzledFormat, false, device.TexOptLevel()); // src
+                RpmUtil::BuildImageViewInfo(
+                    &imageView[1], parentImg, viewRange, createInfo.swizzledFormat, true, device.TexOptLevel());  // dst
+                device.CreateImageViewSrds(2, &imageView[0], pSrdTable);
 
-    // And let the DCC fixup finish as well
-    pComputeCmdSpace  = pComputeCmdStream->ReserveCommands();
-    pComputeCmdSpace += m_cmdUtil.BuildEventWrite(CS_PARTIAL_FLUSH, pComputeCmdSpace);
-    pComputeCmdStream->CommitCommands(pComputeCmdSpace);
+                pSrdTable += 2 * SrdDwordAlignment();
+                memcpy(pSrdTable, constData, sizeof(constData));
 
-    pCmdBuffer->CmdRestoreComputeState(ComputeStatePipelineAndUserData);
+                // Execute the dispatch.
+                pCmdBuffer->CmdDispatch(threadGroupsX, threadGroupsY, 1);
+            } // end loop through all the slices
+
+            // We have to mark this mip level as actually being DCC decompressed
+            pComputeCmdSpace = pComputeCmdStream->ReserveCommands();
+            pComputeCmdSpace += m_cmdUtil.BuildWriteData(image.GetDccStateMetaDataAddr(mipLevel),
+                                                         NumBytesToNumDwords(sizeof(MipDccStateMetaData)),
+                                                         0,     // engine select, ignored for compute
+                                                         WRITE_DATA_DST_SEL_MEMORY_ASYNC,
+                                                         1,     // write confirm
+                                                         reinterpret_cast<const uint32*>(&zero),
+                                                         PredDisable,
+                                                         pComputeCmdSpace);
+            pComputeCmdStream->CommitCommands(pComputeCmdSpace);
+        }
+
+        // Make sure that the decompressed image data has been written before we start fixing up DCC memory.
+        pComputeCmdSpace  = pComputeCmdStream->ReserveCommands();
+        pComputeCmdSpace += m_cmdUtil.BuildEventWrite(CS_PARTIAL_FLUSH, pComputeCmdSpace);
+        pComputeCmdStream->CommitCommands(pComputeCmdSpace);
+
+        // Put DCC memory itself back into a "fully decompressed" state.
+        ClearDcc(pCmdBuffer, pCmdStream, image, range, Gfx6Dcc::InitialValue, DccClearPurpose::Init);
+
+        // And let the DCC fixup finish as well
+        pComputeCmdSpace  = pComputeCmdStream->ReserveCommands();
+        pComputeCmdSpace += m_cmdUtil.BuildEventWrite(CS_PARTIAL_FLUSH, pComputeCmdSpace);
+        pComputeCmdStream->CommitCommands(pComputeCmdSpace);
+
+        pCmdBuffer->CmdRestoreComputeState(ComputeStatePipelineAndUserData);
+    }
 }
 
 // =====================================================================================================================
@@ -3123,15 +3149,15 @@ void RsrcProcMgr::FmaskColorExpand(
         switch (createInfo.fragments)
         {
         case 2:
-            pPipeline = GetPipeline(RpmComputePipeline::MsaaFmaskExpand2x);
+            pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaFmaskExpand2x);
             break;
 
         case 4:
-            pPipeline = GetPipeline(RpmComputePipeline::MsaaFmaskExpand4x);
+            pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaFmaskExpand4x);
             break;
 
         case 8:
-            pPipeline = GetPipeline(RpmComputePipeline::MsaaFmaskExpand8x);
+            pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaFmaskExpand8x);
             break;
 
         default:
@@ -3139,75 +3165,77 @@ void RsrcProcMgr::FmaskColorExpand(
             break;
         }
 
-        PAL_ASSERT(pPipeline != nullptr);
+        if (pPipeline != nullptr)
+        {
+            // Compute the number of thread groups needed to launch one thread per texel.
+            uint32 threadsPerGroup[3] = {};
+            pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
 
-        // Compute the number of thread groups needed to launch one thread per texel.
-        uint32 threadsPerGroup[3] = {};
-        pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
+            const uint32 threadGroupsX = RpmUtil::MinThreadGroups(createInfo.extent.width,  threadsPerGroup[0]);
+            const uint32 threadGroupsY = RpmUtil::MinThreadGroups(createInfo.extent.height, threadsPerGroup[1]);
 
-        const uint32 threadGroupsX = RpmUtil::MinThreadGroups(createInfo.extent.width,  threadsPerGroup[0]);
-        const uint32 threadGroupsY = RpmUtil::MinThreadGroups(createInfo.extent.height, threadsPerGroup[1]);
+            // Save current command buffer state and bind the pipeline.
+            pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
+            pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
 
-        // Save current command buffer state and bind the pipeline.
-        pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
-        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
+            // Select the appropriate value to indicate that FMask is fully expanded and place it in user data 8-9.
+            // Put the low part is user data 8 and the high part in user data 9.
+            // The fmask bits is placed in user data 10
+            const uint32 expandedValueData[3] =
+            {
+                LowPart(FmaskExpandedValues[log2Fragments][log2Samples]),
+                HighPart(FmaskExpandedValues[log2Fragments][log2Samples]),
+                numFmaskBits
+            };
 
-        // Select the appropriate value to indicate that FMask is fully expanded and place it in user data 8-9.
-        // Put the low part is user data 8 and the high part in user data 9.
-        // The fmask bits is placed in user data 10
-        const uint32 expandedValueData[3] =
-        {
-            LowPart(FmaskExpandedValues[log2Fragments][log2Samples]),
-            HighPart(FmaskExpandedValues[log2Fragments][log2Samples]),
-            numFmaskBits
-        };
+            pCmdBuffer->CmdSetUserData(PipelineBindPoint::Compute, 1, 3, expandedValueData);
 
-        pCmdBuffer->CmdSetUserData(PipelineBindPoint::Compute, 1, 3, expandedValueData);
+            // Because we are setting up the MSAA surface as a 3D UAV, we need to have a separate dispatch for each
+            // slice.
+            SubresRange  viewRange = { range.startSubres, 1, 1 };
+            const uint32 lastSlice = range.startSubres.arraySlice + range.numSlices - 1;
 
-        // Because we are setting up the MSAA surface as a 3D UAV, we need to have a separate dispatch for each slice.
-        SubresRange  viewRange = { range.startSubres, 1, 1 };
-        const uint32 lastSlice = range.startSubres.arraySlice + range.numSlices - 1;
+            SwizzledFormat format   = createInfo.swizzledFormat;
+            // For srgb we will get wrong data for gamma correction, here we use unorm instead.
+            if (Formats::IsSrgb(format.format))
+            {
+                format.format = Formats::ConvertToUnorm(format.format);
+            }
 
-        SwizzledFormat format   = createInfo.swizzledFormat;
-        // For srgb we will get wrong data for gamma correction, here we use unorm instead.
-        if (Formats::IsSrgb(format.format))
-        {
-            format.format = Formats::ConvertToUnorm(format.format);
-        }
+            for (; viewRange.startSubres.arraySlice <= lastSlice; ++viewRange.startSubres.arraySlice)
+            {
+                // Create an embedded user-data table and bind it to user data 0. We will need two views.
+                uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
+                                                                           SrdDwordAlignment() * 2,
+                                                                           SrdDwordAlignment(),
+                                                                           PipelineBindPoint::Compute,
+                                                                           0);
 
-        for (; viewRange.startSubres.arraySlice <= lastSlice; ++viewRange.startSubres.arraySlice)
-        {
-            // Create an embedded user-data table and bind it to user data 0. We will need two views.
-            uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
-                                                                       SrdDwordAlignment() * 2,
-                                                                       SrdDwordAlignment(),
-                                                                       PipelineBindPoint::Compute,
-                                                                       0);
-
-            // Populate the table with and image view and an FMask view for the current slice.
-            ImageViewInfo imageView = {};
-            RpmUtil::BuildImageViewInfo(&imageView, *image.Parent(), viewRange, format, true, device.TexOptLevel());
-            imageView.viewType = ImageViewType::Tex2d;
-
-            device.CreateImageViewSrds(1, &imageView, pSrdTable);
-            pSrdTable += SrdDwordAlignment();
-
-            FmaskViewInfo fmaskView = {};
-            fmaskView.pImage               = image.Parent();
-            fmaskView.baseArraySlice       = viewRange.startSubres.arraySlice;
-            fmaskView.arraySize            = 1;
-            fmaskView.flags.shaderWritable = 1;
-
-            FmaskViewInternalInfo fmaskViewInternal = {};
-            fmaskViewInternal.flags.fmaskAsUav = 1;
-
-            m_pDevice->CreateFmaskViewSrds(1, &fmaskView, &fmaskViewInternal, pSrdTable);
-
-            // Execute the dispatch.
-            pCmdBuffer->CmdDispatch(threadGroupsX, threadGroupsY, 1);
-        }
+                // Populate the table with and image view and an FMask view for the current slice.
+                ImageViewInfo imageView = {};
+                RpmUtil::BuildImageViewInfo(&imageView, *image.Parent(), viewRange, format, true, device.TexOptLevel());
+                imageView.viewType = ImageViewType::Tex2d;
 
-        pCmdBuffer->CmdRestoreComputeState(ComputeStatePipelineAndUserData);
+                device.CreateImageViewSrds(1, &imageView, pSrdTable);
+                pSrdTable += SrdDwordAlignment();
+
+                FmaskViewInfo fmaskView = {};
+                fmaskView.pImage               = image.Parent();
+                fmaskView.baseArraySlice       = viewRange.startSubres.arraySlice;
+                fmaskView.arraySize            = 1;
+                fmaskView.flags.shaderWritable = 1;
+
+                FmaskViewInternalInfo fmaskViewInternal = {};
+                fmaskViewInternal.flags.fmaskAsUav = 1;
+
+                m_pDevice->CreateFmaskViewSrds(1, &fmaskView, &fmaskViewInternal, pSrdTable);
+
+                // Execute the dispatch.
+                pCmdBuffer->CmdDispatch(threadGroupsX, threadGroupsY, 1);
+            }
+
+            pCmdBuffer->CmdRestoreComputeState(ComputeStatePipelineAndUserData);
+        }
     }
 }
 
@@ -142,13 +142,14 @@ public:
 
 protected:
     virtual const Pal::GraphicsPipeline* GetGfxPipelineByTargetIndexAndFormat(
+        GfxCmdBuffer*  pCmdBuffer,
         RpmGfxPipeline basePipeline,
         uint32         targetIndex,
         SwizzledFormat format) const override;
 
     virtual const Pal::ComputePipeline* GetCmdGenerationPipeline(
-        const Pal::IndirectCmdGenerator& generator,
-        const CmdBuffer&                 cmdBuffer) const;
+        GfxCmdBuffer*                    pCmdBuffer,
+        const Pal::IndirectCmdGenerator& generator) const;
 
 private:
     virtual void HwlFastColorClear(
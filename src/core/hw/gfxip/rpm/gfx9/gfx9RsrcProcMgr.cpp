@@ -525,7 +525,8 @@ void RsrcProcMgr::CmdFillMemoryGraphics(
         {
             const uint32 convertedColor[4] = { data, 0, 0, 0 };
 
-            const auto*  pPipeline = GetGfxPipelineByTargetIndexAndFormat(SlowColorClear0_32ABGR,
+            const auto*  pPipeline = GetGfxPipelineByTargetIndexAndFormat(pCmdBuffer,
+                                                                          SlowColorClear0_32ABGR,
                                                                           0, // target index
                                                                           colorViewInfo.swizzledFormat);
             ScissorRectParams                scissorInfo          = {};
@@ -565,25 +566,28 @@ void RsrcProcMgr::CmdFillMemoryGraphics(
             bindTargetsInfo.colorTargetCount                    = 1;
             bindTargetsInfo.depthTarget.pDepthStencilView       = nullptr;
 
-            // Save current command buffer state and bind graphics state which is common for all mipmap levels.
-            pCmdBuffer->PushGraphicsState();
-            RpmUtil::WriteVsZOut(pCmdBuffer, 1.0f);
-            pCmdBuffer->CmdBindTargets(bindTargetsInfo);
-            pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Graphics, pPipeline, });
-            pCmdBuffer->CmdSetUserData(PipelineBindPoint::Graphics, RpmPsClearFirstUserData, 4, &convertedColor[0]);
-            pCmdBuffer->CmdBindColorBlendState(m_pBlendDisableState);
-            pCmdBuffer->CmdBindDepthStencilState(m_pDepthDisableState);
-            pCmdBuffer->CmdBindMsaaState(GetMsaaState(1, 1)); // No MSAA with buffers
-            pCmdBuffer->CmdSetDepthBiasState(depthBias);
-            pCmdBuffer->CmdSetInputAssemblyState(inputAssemblyState);
-            pCmdBuffer->CmdSetPointLineRasterState(pointLineRasterState);
-            pCmdBuffer->CmdSetTriangleRasterState(triangleRasterState);
-            pCmdBuffer->CmdSetScissorRects(scissorInfo);
-            pCmdBuffer->CmdSetViewports(viewportInfo);
-            pCmdBuffer->CmdDraw(0, 3, 0, 1);
-
-            // Restore original command buffer state.
-            pCmdBuffer->PopGraphicsState();
+            if (pPipeline != nullptr)
+            {
+                // Save current command buffer state and bind graphics state which is common for all mipmap levels.
+                pCmdBuffer->PushGraphicsState();
+                RpmUtil::WriteVsZOut(pCmdBuffer, 1.0f);
+                pCmdBuffer->CmdBindTargets(bindTargetsInfo);
+                pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Graphics, pPipeline, });
+                pCmdBuffer->CmdSetUserData(PipelineBindPoint::Graphics, RpmPsClearFirstUserData, 4, &convertedColor[0]);
+                pCmdBuffer->CmdBindColorBlendState(m_pBlendDisableState);
+                pCmdBuffer->CmdBindDepthStencilState(m_pDepthDisableState);
+                pCmdBuffer->CmdBindMsaaState(GetMsaaState(1, 1)); // No MSAA with buffers
+                pCmdBuffer->CmdSetDepthBiasState(depthBias);
+                pCmdBuffer->CmdSetInputAssemblyState(inputAssemblyState);
+                pCmdBuffer->CmdSetPointLineRasterState(pointLineRasterState);
+                pCmdBuffer->CmdSetTriangleRasterState(triangleRasterState);
+                pCmdBuffer->CmdSetScissorRects(scissorInfo);
+                pCmdBuffer->CmdSetViewports(viewportInfo);
+                pCmdBuffer->CmdDraw(0, 3, 0, 1);
+
+                // Restore original command buffer state.
+                pCmdBuffer->PopGraphicsState();
+            }
         }
 
         PAL_SAFE_FREE(pColorViewMem, &colorViewAlloc);
@@ -846,7 +850,7 @@ void RsrcProcMgr::CmdResolveQueryComputeShader(
     {
     case QueryPoolType::Occlusion:
         // The occlusion query shader needs the stride of a set of zPass counters.
-        pPipeline       = GetPipeline(RpmComputePipeline::ResolveOcclusionQuery);
+        pPipeline       = GetPipeline(pCmdBuffer, RpmComputePipeline::ResolveOcclusionQuery);
         constData[3]    = static_cast<uint32>(queryPool.GetGpuResultSizeInBytes(1));
         constEntryCount = 4;
 
@@ -855,7 +859,7 @@ void RsrcProcMgr::CmdResolveQueryComputeShader(
 
     case QueryPoolType::PipelineStats:
         // The pipeline stats query shader needs the mask of enabled pipeline stats.
-        pPipeline       = GetPipeline(RpmComputePipeline::ResolvePipelineStatsQuery);
+        pPipeline       = GetPipeline(pCmdBuffer, RpmComputePipeline::ResolvePipelineStatsQuery);
         constData[3]    = queryPool.CreateInfo().enabledStats;
         constEntryCount = 4;
 
@@ -867,7 +871,7 @@ void RsrcProcMgr::CmdResolveQueryComputeShader(
     case QueryPoolType::StreamoutStats:
         PAL_ASSERT(flags == (QueryResult64Bit | QueryResultWait));
 
-        pPipeline    = GetPipeline(RpmComputePipeline::ResolveStreamoutStatsQuery);
+        pPipeline    = GetPipeline(pCmdBuffer, RpmComputePipeline::ResolveStreamoutStatsQuery);
 
         constData[0]    = queryCount;
         constData[1]    = static_cast<uint32>(dstStride);
@@ -884,36 +888,38 @@ void RsrcProcMgr::CmdResolveQueryComputeShader(
         break;
     }
 
-    PAL_ASSERT(pPipeline != nullptr);
-
-    // Save current command buffer state and bind the pipeline.
-    pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
-    pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
+    if (pPipeline != nullptr)
+    {
+        // Save current command buffer state and bind the pipeline.
+        pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
+        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
 
-    // Create an embedded user-data table and bind it to user data 0-1. We need buffer views for the source and dest.
-    uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
-                                                               SrdDwordAlignment() * 2,
-                                                               SrdDwordAlignment(),
-                                                               PipelineBindPoint::Compute,
-                                                               0);
+        // Create an embedded user-data table and bind it to user data 0-1. We need buffer views for the source and
+        // dest.
+        uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
+                                                                   SrdDwordAlignment() * 2,
+                                                                   SrdDwordAlignment(),
+                                                                   PipelineBindPoint::Compute,
+                                                                   0);
 
-    // Populate the table with raw buffer views, by convention the destination is placed before the source.
-    BufferViewInfo rawBufferView = {};
-    RpmUtil::BuildRawBufferViewInfo(&rawBufferView, dstGpuMemory, dstOffset);
-    m_pDevice->Parent()->CreateUntypedBufferViewSrds(1, &rawBufferView, pSrdTable);
-    pSrdTable += SrdDwordAlignment();
+        // Populate the table with raw buffer views, by convention the destination is placed before the source.
+        BufferViewInfo rawBufferView = {};
+        RpmUtil::BuildRawBufferViewInfo(&rawBufferView, dstGpuMemory, dstOffset);
+        m_pDevice->Parent()->CreateUntypedBufferViewSrds(1, &rawBufferView, pSrdTable);
+        pSrdTable += SrdDwordAlignment();
 
-    RpmUtil::BuildRawBufferViewInfo(&rawBufferView, queryPool.GpuMemory(), queryPool.GetQueryOffset(startQuery));
-    m_pDevice->Parent()->CreateUntypedBufferViewSrds(1, &rawBufferView, pSrdTable);
+        RpmUtil::BuildRawBufferViewInfo(&rawBufferView, queryPool.GpuMemory(), queryPool.GetQueryOffset(startQuery));
+        m_pDevice->Parent()->CreateUntypedBufferViewSrds(1, &rawBufferView, pSrdTable);
 
-    pCmdBuffer->CmdSetUserData(PipelineBindPoint::Compute, 1, constEntryCount, constData);
+        pCmdBuffer->CmdSetUserData(PipelineBindPoint::Compute, 1, constEntryCount, constData);
 
-    // Issue a dispatch with one thread per query slot.
-    const uint32 threadGroups = RpmUtil::MinThreadGroups(queryCount, pPipeline->ThreadsPerGroup());
-    pCmdBuffer->CmdDispatch(threadGroups, 1, 1);
+        // Issue a dispatch with one thread per query slot.
+        const uint32 threadGroups = RpmUtil::MinThreadGroups(queryCount, pPipeline->ThreadsPerGroup());
+        pCmdBuffer->CmdDispatch(threadGroups, 1, 1);
 
-    // Restore the command buffer's state.
-    pCmdBuffer->CmdRestoreComputeState(ComputeStatePipelineAndUserData);
+        // Restore the command buffer's state.
+        pCmdBuffer->CmdRestoreComputeState(ComputeStatePipelineAndUserData);
+    }
 }
 
 // ====================================================================================================================
@@ -1180,95 +1186,99 @@ void RsrcProcMgr::BuildHtileLookupTable(
         PAL_ASSERT(pipeBankXor == pBaseHtile->CalcPipeXorMask(dstImage, ImageAspect::Stencil));
     }
 
-    const ComputePipeline* pPipeline = GetPipeline(RpmComputePipeline::Gfx9BuildHtileLookupTable);
+    const ComputePipeline* pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::Gfx9BuildHtileLookupTable);
 
-    pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
+    if (pPipeline != nullptr)
+    {
+        pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
 
-    // Save the command buffer's state
-    pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
+        // Save the command buffer's state
+        pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
 
-    // Bind Compute Pipeline used for the clear.
-    pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
+        // Bind Compute Pipeline used for the clear.
+        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
 
-    // Create a view of the hTile equation so that the shader can access it.
-    BufferViewInfo hTileEqBufferView = {};
-    pBaseHtile->BuildEqBufferView(dstImage, &hTileEqBufferView);
-    pParentDev->CreateUntypedBufferViewSrds(1, &hTileEqBufferView, &bufferSrds[1]);
+        // Create a view of the hTile equation so that the shader can access it.
+        BufferViewInfo hTileEqBufferView = {};
+        pBaseHtile->BuildEqBufferView(dstImage, &hTileEqBufferView);
+        pParentDev->CreateUntypedBufferViewSrds(1, &hTileEqBufferView, &bufferSrds[1]);
 
-    const uint32 lastMip = range.startSubres.mipLevel + range.numMips - 1;
-    SubresId subresId = {};
-    subresId.aspect = range.startSubres.aspect;
-    for (uint32 mipLevel = range.startSubres.mipLevel; mipLevel <= lastMip; ++mipLevel)
-    {
-        // Fid the lookup table view for specified mip level
-        BufferViewInfo hTileLookupTableBuferView = {};
-        dstImage.BuildMedaDataLookupTableBufferView(&hTileLookupTableBuferView, mipLevel);
-        pParentDev->CreateUntypedBufferViewSrds(1, &hTileLookupTableBuferView, &bufferSrds[0]);
+        const uint32 lastMip = range.startSubres.mipLevel + range.numMips - 1;
+        SubresId subresId = {};
+        subresId.aspect = range.startSubres.aspect;
+        for (uint32 mipLevel = range.startSubres.mipLevel; mipLevel <= lastMip; ++mipLevel)
+        {
+            // Fid the lookup table view for specified mip level
+            BufferViewInfo hTileLookupTableBuferView = {};
+            dstImage.BuildMedaDataLookupTableBufferView(&hTileLookupTableBuferView, mipLevel);
+            pParentDev->CreateUntypedBufferViewSrds(1, &hTileLookupTableBuferView, &bufferSrds[0]);
 
-        const auto&   hTileMipInfo = pBaseHtile->GetAddrMipInfo(mipLevel);
+            const auto&   hTileMipInfo = pBaseHtile->GetAddrMipInfo(mipLevel);
 
-        subresId.mipLevel = mipLevel;
-        subresId.arraySlice = range.startSubres.arraySlice;
-        uint32 mipLevelWidth = dstImage.Parent()->SubresourceInfo(subresId)->extentTexels.width;
-        uint32 mipLevelHeight = dstImage.Parent()->SubresourceInfo(subresId)->extentTexels.height;
+            subresId.mipLevel = mipLevel;
+            subresId.arraySlice = range.startSubres.arraySlice;
+            uint32 mipLevelWidth = dstImage.Parent()->SubresourceInfo(subresId)->extentTexels.width;
+            uint32 mipLevelHeight = dstImage.Parent()->SubresourceInfo(subresId)->extentTexels.height;
 
-        const uint32 constData[] =
-        {
-            // start cb0[0]
-            hTileMipInfo.startX,
-            hTileMipInfo.startY,
-            range.startSubres.arraySlice,
-            sliceSize,
-            // start cb0[1]
-            log2MetaBlkWidth,
-            log2MetaBlkHeight,
-            0, // depth surfaces are always 2D
-            hTileAddrOutput.pitch >> log2MetaBlkWidth,
-            // start cb0[2]
-            mipLevelWidth,
-            mipLevelHeight,
-            0,
-            0,
-            // start cb0[3]
-            pipeBankXor,
-            effectiveSamples,
-            Pow2Align(mipLevelWidth, 8u) / 8u,
-            Pow2Align(mipLevelHeight, 8u) / 8u
-        };
+            const uint32 constData[] =
+            {
+                // start cb0[0]
+                hTileMipInfo.startX,
+                hTileMipInfo.startY,
+                range.startSubres.arraySlice,
+                sliceSize,
+                // start cb0[1]
+                log2MetaBlkWidth,
+                log2MetaBlkHeight,
+                0, // depth surfaces are always 2D
+                hTileAddrOutput.pitch >> log2MetaBlkWidth,
+                // start cb0[2]
+                mipLevelWidth,
+                mipLevelHeight,
+                0,
+                0,
+                // start cb0[3]
+                pipeBankXor,
+                effectiveSamples,
+                Pow2Align(mipLevelWidth, 8u) / 8u,
+                Pow2Align(mipLevelHeight, 8u) / 8u
+            };
 
-        // Create an embedded user-data table and bind it to user data 0.
-        static const uint32 sizeBufferSrdDwords = NumBytesToNumDwords(sizeof(BufferSrd));
-        static const uint32 sizeConstDataDwords = NumBytesToNumDwords(sizeof(constData));
-        uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
-                                                                   (sizeBufferSrdDwords * 2) + sizeConstDataDwords,
-                                                                   sizeBufferSrdDwords,
-                                                                   PipelineBindPoint::Compute,
-                                                                   0);
+            // Create an embedded user-data table and bind it to user data 0.
+            static const uint32 sizeBufferSrdDwords = NumBytesToNumDwords(sizeof(BufferSrd));
+            static const uint32 sizeConstDataDwords = NumBytesToNumDwords(sizeof(constData));
+            uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
+                                                                       (sizeBufferSrdDwords * 2) + sizeConstDataDwords,
+                                                                       sizeBufferSrdDwords,
+                                                                       PipelineBindPoint::Compute,
+                                                                       0);
 
-        // Put the SRDs for the hTile buffer and hTile equation into shader-accessible memory
-        memcpy(pSrdTable, &bufferSrds[0], sizeof(bufferSrds));
-        pSrdTable += Util::NumBytesToNumDwords(sizeof(bufferSrds));
+            // Put the SRDs for the hTile buffer and hTile equation into shader-accessible memory
+            memcpy(pSrdTable, &bufferSrds[0], sizeof(bufferSrds));
+            pSrdTable += Util::NumBytesToNumDwords(sizeof(bufferSrds));
 
-        // Provide the shader with all kinds of fun dimension info
-        memcpy(pSrdTable, &constData[0], sizeof(constData));
+            // Provide the shader with all kinds of fun dimension info
+            memcpy(pSrdTable, &constData[0], sizeof(constData));
 
-        MetaDataDispatch(pCmdBuffer,
-                         dstImage,
-                         pBaseHtile,
-                         mipLevelWidth,
-                         mipLevelHeight,
-                         range.numSlices,
-                         threadsPerGroup);
-    }
+            MetaDataDispatch(pCmdBuffer,
+                             dstImage,
+                             pBaseHtile,
+                             mipLevelWidth,
+                             mipLevelHeight,
+                             range.numSlices,
+                             threadsPerGroup);
+        }
 
-    // Restore the command buffer's state.
-    pCmdBuffer->CmdRestoreComputeState(ComputeStatePipelineAndUserData);
+        // Restore the command buffer's state.
+        pCmdBuffer->CmdRestoreComputeState(ComputeStatePipelineAndUserData);
+    }
 }
 
 // =====================================================================================================================
 // Some blts need to use GFXIP-specific algorithms to pick the proper graphics pipeline. The basePipeline is the first
 // graphics state in a series of states that vary only on target format and target index.
 const Pal::GraphicsPipeline* RsrcProcMgr::GetGfxPipelineByTargetIndexAndFormat(
+    GfxCmdBuffer*  pCmdBuffer,
     RpmGfxPipeline basePipeline,
     uint32         targetIndex,
     SwizzledFormat format
@@ -1286,13 +1296,14 @@ const Pal::GraphicsPipeline* RsrcProcMgr::GetGfxPipelineByTargetIndexAndFormat(
     const int32 pipelineOffset = ExportStateMapping[exportFormat];
     PAL_ASSERT(pipelineOffset >= 0);
 
-    return GetGfxPipeline(static_cast<RpmGfxPipeline>(basePipeline + pipelineOffset + targetIndex * NumExportFormats));
+    return GetGfxPipeline(pCmdBuffer,
+                          static_cast<RpmGfxPipeline>(basePipeline + pipelineOffset + targetIndex * NumExportFormats));
 }
 
 // =====================================================================================================================
 const Pal::ComputePipeline* RsrcProcMgr::GetCmdGenerationPipeline(
-    const Pal::IndirectCmdGenerator& generator,
-    const CmdBuffer&                 cmdBuffer
+    GfxCmdBuffer*                    pCmdBuffer,
+    const Pal::IndirectCmdGenerator& generator
     ) const
 {
     RpmComputePipeline pipeline = RpmComputePipeline::Count;
@@ -1301,7 +1312,7 @@ const Pal::ComputePipeline* RsrcProcMgr::GetCmdGenerationPipeline(
     {
     case GeneratorType::Draw:
     case GeneratorType::DrawIndexed:
-        PAL_ASSERT(cmdBuffer.GetEngineType() == EngineTypeUniversal);
+        PAL_ASSERT(pCmdBuffer->GetEngineType() == EngineTypeUniversal);
         pipeline = RpmComputePipeline::Gfx9GenerateCmdDraw;
         break;
 
@@ -1314,7 +1325,7 @@ const Pal::ComputePipeline* RsrcProcMgr::GetCmdGenerationPipeline(
         break;
     }
 
-    return GetPipeline(pipeline);
+    return GetPipeline(pCmdBuffer, pipeline);
 }
 
 // =====================================================================================================================
@@ -1393,85 +1404,88 @@ void RsrcProcMgr::ExpandDepthStencil(
         (supportsComputePath && (TestAnyFlagSet(Image::UseComputeExpand, UseComputeExpandAlways))))
     {
         const auto&       createInfo        = image.GetImageCreateInfo();
-        const auto*       pPipeline         = GetComputeMaskRamExpandPipeline(image);
+        const auto*       pPipeline         = GetComputeMaskRamExpandPipeline(pCmdBuffer, image);
         const auto*       pHtile            = pGfxImage->GetHtile();
         auto*             pComputeCmdStream = pCmdBuffer->GetCmdStreamByEngine(CmdBufferEngineSupport::Compute);
         const EngineType  engineType        = pCmdBuffer->GetEngineType();
 
-        pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
-        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
-
-        // Compute the number of thread groups needed to launch one thread per texel.
-        uint32 threadsPerGroup[3] = {};
-        pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
-
-        bool         earlyExit      = false;
-        SubresRange  remainingRange = range;
-        for (uint32  mipIdx = 0; ((earlyExit == false) && (mipIdx < range.numMips)); mipIdx++)
+        if (pPipeline != nullptr)
         {
-            const SubresId  mipBaseSubResId =  { range.startSubres.aspect, range.startSubres.mipLevel + mipIdx, 0 };
-            const auto*     pBaseSubResInfo = image.SubresourceInfo(mipBaseSubResId);
-
-            PAL_ASSERT(pBaseSubResInfo->flags.supportMetaDataTexFetch);
-
-            const uint32  threadGroupsX = RpmUtil::MinThreadGroups(pBaseSubResInfo->extentElements.width,
-                                                                   threadsPerGroup[0]);
-            const uint32  threadGroupsY = RpmUtil::MinThreadGroups(pBaseSubResInfo->extentElements.height,
-                                                                   threadsPerGroup[1]);
-
-            const uint32 constData[] =
-            {
-                // start cb0[0]
-                pBaseSubResInfo->extentElements.width,
-                pBaseSubResInfo->extentElements.height,
-            };
+            pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
+            pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
 
-            const uint32 sizeConstDataDwords = NumBytesToNumDwords(sizeof(constData));
+            // Compute the number of thread groups needed to launch one thread per texel.
+            uint32 threadsPerGroup[3] = {};
+            pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
 
-            for (uint32  sliceIdx = 0; sliceIdx < range.numSlices; sliceIdx++)
+            bool         earlyExit      = false;
+            SubresRange  remainingRange = range;
+            for (uint32  mipIdx = 0; ((earlyExit == false) && (mipIdx < range.numMips)); mipIdx++)
             {
-                const SubresId     subResId =  { mipBaseSubResId.aspect,
-                                                 mipBaseSubResId.mipLevel,
-                                                 range.startSubres.arraySlice + sliceIdx };
-                const SubresRange  viewRange = { subResId, 1, 1 };
-
-                // Create an embedded user-data table and bind it to user data 0. We will need two views.
-                uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(
-                                        pCmdBuffer,
-                                        2 * SrdDwordAlignment() + sizeConstDataDwords,
-                                        SrdDwordAlignment(),
-                                        PipelineBindPoint::Compute,
-                                        0);
-
-                ImageViewInfo imageView[2] = {};
-                RpmUtil::BuildImageViewInfo(
-                    &imageView[0], image, viewRange, createInfo.swizzledFormat, false, device.TexOptLevel()); // src
-                RpmUtil::BuildImageViewInfo(
-                    &imageView[1], image, viewRange, createInfo.swizzledFormat, true, device.TexOptLevel());  // dst
-                device.CreateImageViewSrds(2, &imageView[0], pSrdTable);
+                const SubresId  mipBaseSubResId =  { range.startSubres.aspect, range.startSubres.mipLevel + mipIdx, 0 };
+                const auto*     pBaseSubResInfo = image.SubresourceInfo(mipBaseSubResId);
 
-                pSrdTable += 2 * SrdDwordAlignment();
-                memcpy(pSrdTable, constData, sizeof(constData));
-
-                // Execute the dispatch.
-                pCmdBuffer->CmdDispatch(threadGroupsX, threadGroupsY, 1);
-            } // end loop through all the slices
-        } // end loop through all the mip levels
+                PAL_ASSERT(pBaseSubResInfo->flags.supportMetaDataTexFetch);
 
-        // Allow the rewrite of depth data to complete
-        uint32* pComputeCmdSpace  = pComputeCmdStream->ReserveCommands();
-        pComputeCmdSpace += m_cmdUtil.BuildNonSampleEventWrite(CS_PARTIAL_FLUSH, engineType, pComputeCmdSpace);
-        pComputeCmdStream->CommitCommands(pComputeCmdSpace);
+                const uint32  threadGroupsX = RpmUtil::MinThreadGroups(pBaseSubResInfo->extentElements.width,
+                                                                       threadsPerGroup[0]);
+                const uint32  threadGroupsY = RpmUtil::MinThreadGroups(pBaseSubResInfo->extentElements.height,
+                                                                       threadsPerGroup[1]);
 
-        // Mark all the hTile data as fully expanded
-        InitHtile(pCmdBuffer, pComputeCmdStream, *pGfxImage, range);
+                const uint32 constData[] =
+                {
+                    // start cb0[0]
+                    pBaseSubResInfo->extentElements.width,
+                    pBaseSubResInfo->extentElements.height,
+                };
 
-        // And wait for that to finish...
-        pComputeCmdSpace  = pComputeCmdStream->ReserveCommands();
-        pComputeCmdSpace += m_cmdUtil.BuildNonSampleEventWrite(CS_PARTIAL_FLUSH, engineType, pComputeCmdSpace);
-        pComputeCmdStream->CommitCommands(pComputeCmdSpace);
+                const uint32 sizeConstDataDwords = NumBytesToNumDwords(sizeof(constData));
 
-        pCmdBuffer->CmdRestoreComputeState(ComputeStatePipelineAndUserData);
+                for (uint32  sliceIdx = 0; sliceIdx < range.numSlices; sliceIdx++)
+                {
+                    const SubresId     subResId =  { mipBaseSubResId.aspect,
+                                                     mipBaseSubResId.mipLevel,
+                                                     range.startSubres.arraySlice + sliceIdx };
+                    const SubresRange  viewRange = { subResId, 1, 1 };
+
+                    // Create an embedded user-data table and bind it to user data 0. We will need two views.
+                    uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(
+                                            pCmdBuffer,
+                                            2 * SrdDwordAlignment() + sizeConstDataDwords,
+                                            SrdDwordAlignment(),
+                                            PipelineBindPoint::Compute,
+                                            0);
+
+                    ImageViewInfo imageView[2] = {};
+                    RpmUtil::BuildImageViewInfo(
+                        &imageView[0], image, viewRange, createInfo.swizzledFormat, false, device.TexOptLevel()); // src
+                    RpmUtil::BuildImageViewInfo(
+                        &imageView[1], image, viewRange, createInfo.swizzledFormat, true, device.TexOptLevel());  // dst
+                    device.CreateImageViewSrds(2, &imageView[0], pSrdTable);
+
+                    pSrdTable += 2 * SrdDwordAlignment();
+                    memcpy(pSrdTable, constData, sizeof(constData));
+
+                    // Execute the dispatch.
+                    pCmdBuffer->CmdDispatch(threadGroupsX, threadGroupsY, 1);
+                } // end loop through all the slices
+            } // end loop through all the mip levels
+
+            // Allow the rewrite of depth data to complete
+            uint32* pComputeCmdSpace  = pComputeCmdStream->ReserveCommands();
+            pComputeCmdSpace += m_cmdUtil.BuildNonSampleEventWrite(CS_PARTIAL_FLUSH, engineType, pComputeCmdSpace);
+            pComputeCmdStream->CommitCommands(pComputeCmdSpace);
+
+            // Mark all the hTile data as fully expanded
+            InitHtile(pCmdBuffer, pComputeCmdStream, *pGfxImage, range);
+
+            // And wait for that to finish...
+            pComputeCmdSpace  = pComputeCmdStream->ReserveCommands();
+            pComputeCmdSpace += m_cmdUtil.BuildNonSampleEventWrite(CS_PARTIAL_FLUSH, engineType, pComputeCmdSpace);
+            pComputeCmdStream->CommitCommands(pComputeCmdSpace);
+
+            pCmdBuffer->CmdRestoreComputeState(ComputeStatePipelineAndUserData);
+        }
     }
     else
     {
@@ -1725,135 +1739,140 @@ void RsrcProcMgr::HwlHtileCopyAndFixUp(
         const auto& srcCreateInfo = srcImage.GetImageCreateInfo();
         const auto& dstCreateInfo = dstImage.GetImageCreateInfo();
 
-        // Save the command buffer's state
-        pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
-
-        const ComputePipeline* pPipeline = GetPipeline(RpmComputePipeline::Gfx9HtileCopyAndFixUp);
-
-        uint32 threadsPerGroup[3] = {};
-        pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
-
-        // Bind Compute Pipeline used for the clear.
-        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
+        const ComputePipeline* pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::Gfx9HtileCopyAndFixUp);
 
-        for (uint32 i = 0; i < mergedCount; ++i)
+        if (pPipeline != nullptr)
         {
-            BufferViewInfo bufferView[4] = {};
-            BufferSrd      bufferSrds[4] = {};
+            // Save the command buffer's state
+            pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
 
-            const ImageResolveRegion* pCurRegion = fixUpRegionList[i].pResolveRegion;
-            uint32 dstMipLevel = pCurRegion->dstMipLevel;
+            uint32 threadsPerGroup[3] = {};
+            pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
 
-            dstSubresId.aspect = pCurRegion->dstAspect;
-            dstSubresId.mipLevel = dstMipLevel;
-            dstSubresId.arraySlice = pCurRegion->dstSlice;
-            const SubResourceInfo* pDstSubresInfo = dstImage.SubresourceInfo(dstSubresId);
+            // Bind Compute Pipeline used for the clear.
+            pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
 
-            // Dst htile surface
-            const Gfx9Htile* pDstHtile = pGfxDstImage->GetHtile();
-            pDstHtile->BuildSurfBufferView(*pGfxDstImage, &bufferView[0]);
-            dstImage.GetDevice()->CreateUntypedBufferViewSrds(1, &bufferView[0], &bufferSrds[0]);
-
-            // Src htile surface
-            const Gfx9Htile* pSrcHtile = pGfxSrcImage->GetHtile();
-            pSrcHtile->BuildSurfBufferView(*pGfxSrcImage, &bufferView[1]);
-            srcImage.GetDevice()->CreateUntypedBufferViewSrds(1, &bufferView[1], &bufferSrds[1]);
-
-            // Src htile lookup table
-            pGfxSrcImage->BuildMedaDataLookupTableBufferView(&bufferView[2], 0);
-            srcImage.GetDevice()->CreateUntypedBufferViewSrds(1, &bufferView[2], &bufferSrds[2]);
+            for (uint32 i = 0; i < mergedCount; ++i)
+            {
+                BufferViewInfo bufferView[4] = {};
+                BufferSrd      bufferSrds[4] = {};
 
-            // Dst htile lookup table
-            pGfxDstImage->BuildMedaDataLookupTableBufferView(&bufferView[3], dstMipLevel);
-            dstImage.GetDevice()->CreateUntypedBufferViewSrds(1, &bufferView[3], &bufferSrds[3]);
+                const ImageResolveRegion* pCurRegion = fixUpRegionList[i].pResolveRegion;
+                uint32 dstMipLevel = pCurRegion->dstMipLevel;
 
-            static const uint32 HtileTexelAlign = 8;
+                dstSubresId.aspect = pCurRegion->dstAspect;
+                dstSubresId.mipLevel = dstMipLevel;
+                dstSubresId.arraySlice = pCurRegion->dstSlice;
+                const SubResourceInfo* pDstSubresInfo = dstImage.SubresourceInfo(dstSubresId);
 
-            // Htile copy and fixup require offset and extent to be 8 pixel alignment, or the copy region
-            // covers full right-bottom part of dst image.
-            PAL_ASSERT(IsPow2Aligned(pCurRegion->srcOffset.x, HtileTexelAlign));
-            PAL_ASSERT(IsPow2Aligned(pCurRegion->srcOffset.y, HtileTexelAlign));
+                // Dst htile surface
+                const Gfx9Htile* pDstHtile = pGfxDstImage->GetHtile();
+                pDstHtile->BuildSurfBufferView(*pGfxDstImage, &bufferView[0]);
+                dstImage.GetDevice()->CreateUntypedBufferViewSrds(1, &bufferView[0], &bufferSrds[0]);
 
-            PAL_ASSERT(IsPow2Aligned(pCurRegion->dstOffset.x, HtileTexelAlign));
-            PAL_ASSERT(IsPow2Aligned(pCurRegion->dstOffset.y, HtileTexelAlign));
+                // Src htile surface
+                const Gfx9Htile* pSrcHtile = pGfxSrcImage->GetHtile();
+                pSrcHtile->BuildSurfBufferView(*pGfxSrcImage, &bufferView[1]);
+                srcImage.GetDevice()->CreateUntypedBufferViewSrds(1, &bufferView[1], &bufferSrds[1]);
 
-            PAL_ASSERT(IsPow2Aligned(pCurRegion->extent.width, HtileTexelAlign) ||
-                       ((pCurRegion->extent.width + pCurRegion->dstOffset.x) == pDstSubresInfo->extentTexels.width));
+                // Src htile lookup table
+                pGfxSrcImage->BuildMedaDataLookupTableBufferView(&bufferView[2], 0);
+                srcImage.GetDevice()->CreateUntypedBufferViewSrds(1, &bufferView[2], &bufferSrds[2]);
 
-            PAL_ASSERT(IsPow2Aligned(pCurRegion->extent.height, HtileTexelAlign) ||
-                       ((pCurRegion->extent.height + pCurRegion->dstOffset.y) == pDstSubresInfo->extentTexels.height));
-            PAL_ASSERT((pCurRegion->dstOffset.x >= 0) && (pCurRegion->dstOffset.y >= 0));
+                // Dst htile lookup table
+                pGfxDstImage->BuildMedaDataLookupTableBufferView(&bufferView[3], dstMipLevel);
+                dstImage.GetDevice()->CreateUntypedBufferViewSrds(1, &bufferView[3], &bufferSrds[3]);
 
-            const uint32  htileExtentX = (Pow2Align(pCurRegion->extent.width, HtileTexelAlign) / HtileTexelAlign);
-            const uint32  htileExtentY = (Pow2Align(pCurRegion->extent.height, HtileTexelAlign) / HtileTexelAlign);
-            const uint32  htileExtentZ = pCurRegion->numSlices;
+                static const uint32 HtileTexelAlign = 8;
 
-            uint32 coveredAspects = 0;
+                // Htile copy and fixup require offset and extent to be 8 pixel alignment, or the copy region
+                // covers full right-bottom part of dst image.
+                PAL_ASSERT(IsPow2Aligned(pCurRegion->srcOffset.x, HtileTexelAlign));
+                PAL_ASSERT(IsPow2Aligned(pCurRegion->srcOffset.y, HtileTexelAlign));
 
-            if (fixUpRegionList[i].resolveDepth)
-            {
-                coveredAspects |= HtileAspectMask::HtileAspectDepth;
-            }
+                PAL_ASSERT(IsPow2Aligned(pCurRegion->dstOffset.x, HtileTexelAlign));
+                PAL_ASSERT(IsPow2Aligned(pCurRegion->dstOffset.y, HtileTexelAlign));
 
-            if (fixUpRegionList[i].resolveStencil)
-            {
-                coveredAspects |= HtileAspectMask::HtileAspectStencil;
-            }
+                PAL_ASSERT(IsPow2Aligned(pCurRegion->extent.width, HtileTexelAlign) ||
+                           ((pCurRegion->extent.width + pCurRegion->dstOffset.x) ==
+                            pDstSubresInfo->extentTexels.width));
 
-            const uint32 htileMask = pDstHtile->GetAspectMask(coveredAspects);
+                PAL_ASSERT(IsPow2Aligned(pCurRegion->extent.height, HtileTexelAlign) ||
+                           ((pCurRegion->extent.height + pCurRegion->dstOffset.y) ==
+                            pDstSubresInfo->extentTexels.height));
+                PAL_ASSERT((pCurRegion->dstOffset.x >= 0) && (pCurRegion->dstOffset.y >= 0));
 
-            uint32 htileExpandValue = 0;
+                const uint32  htileExtentX = (Pow2Align(pCurRegion->extent.width, HtileTexelAlign) / HtileTexelAlign);
+                const uint32  htileExtentY = (Pow2Align(pCurRegion->extent.height, HtileTexelAlign) / HtileTexelAlign);
+                const uint32  htileExtentZ = pCurRegion->numSlices;
 
-            const uint32 constData[] =
-            {
-                // start cb1[0]
-                pCurRegion->srcOffset.x / HtileTexelAlign,                                   //srcHtileOffset.x
-                pCurRegion->srcOffset.y / HtileTexelAlign,                                   //srcHtileOffset.y
-                pCurRegion->srcSlice,                                                        //srcHtileOffset.z
-                htileExtentX,                                                                //resolveExtentX
-                // start cb1[1]
-                pCurRegion->dstOffset.x / HtileTexelAlign,                                   //dstHtileOffset.x
-                pCurRegion->dstOffset.y / HtileTexelAlign,                                   //dstHtileOffset.y
-                pCurRegion->dstSlice,                                                        //dstHtileOffset.z
-                htileExtentY,                                                                //resolveExtentY,
-                // start cb1[2]
-                Pow2Align(srcCreateInfo.extent.width, HtileTexelAlign) / HtileTexelAlign,    //srcMipLevelHtileDim.x
-                Pow2Align(srcCreateInfo.extent.height, HtileTexelAlign) / HtileTexelAlign,   //srcMipLevelHtileDim.y
-                Pow2Align(pDstSubresInfo->extentTexels.width, HtileTexelAlign)
-                    / HtileTexelAlign,                                                       //dstMipLevelHtileDim.x
-                Pow2Align(pDstSubresInfo->extentTexels.height, HtileTexelAlign)
-                    / HtileTexelAlign,                                                       //dstMipLevelHtileDim.y
-                // start cb1[3]
-                pDstHtile->GetInitialValue() & htileMask,                                    //zsDecompressedValue
-                htileMask,                                                                   //htileMask
-                0u,                                                                          //Padding
-                0u,                                                                          //Padding
-            };
+                uint32 coveredAspects = 0;
 
-            // Create an embedded user-data table and bind it to user data 0.
-            static const uint32 sizeBufferSrdDwords = NumBytesToNumDwords(sizeof(BufferSrd));
-            static const uint32 sizeConstDataDwords = NumBytesToNumDwords(sizeof(constData));
-            uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
-                sizeBufferSrdDwords * 4 + sizeConstDataDwords,
-                sizeBufferSrdDwords,
-                PipelineBindPoint::Compute,
-                0);
+                if (fixUpRegionList[i].resolveDepth)
+                {
+                    coveredAspects |= HtileAspectMask::HtileAspectDepth;
+                }
 
-            // Put the SRDs for the hTile buffer and hTile lookup table into shader-accessible memory
-            memcpy(pSrdTable, &bufferSrds[0], sizeof(bufferSrds));
-            pSrdTable += sizeBufferSrdDwords * 4;
+                if (fixUpRegionList[i].resolveStencil)
+                {
+                    coveredAspects |= HtileAspectMask::HtileAspectStencil;
+                }
 
-            // Provide the shader with all kinds of fun dimension info
-            memcpy(pSrdTable, &constData, sizeof(constData));
+                const uint32 htileMask = pDstHtile->GetAspectMask(coveredAspects);
 
-            // Now that we have the dimensions in terms of compressed pixels, launch as many thread groups as we need to
-            // get to them all.
-            pCmdBuffer->CmdDispatch(RpmUtil::MinThreadGroups(htileExtentX, threadsPerGroup[0]),
-                RpmUtil::MinThreadGroups(htileExtentY, threadsPerGroup[1]),
-                RpmUtil::MinThreadGroups(htileExtentZ, threadsPerGroup[2]));
-        } // End of for
+                uint32 htileExpandValue = 0;
 
-        pCmdBuffer->CmdRestoreComputeState(ComputeStatePipelineAndUserData);
+                const uint32 constData[] =
+                {
+                    // start cb1[0]
+                    pCurRegion->srcOffset.x / HtileTexelAlign,                                   //srcHtileOffset.x
+                    pCurRegion->srcOffset.y / HtileTexelAlign,                                   //srcHtileOffset.y
+                    pCurRegion->srcSlice,                                                        //srcHtileOffset.z
+                    htileExtentX,                                                                //resolveExtentX
+                    // start cb1[1]
+                    pCurRegion->dstOffset.x / HtileTexelAlign,                                   //dstHtileOffset.x
+                    pCurRegion->dstOffset.y / HtileTexelAlign,                                   //dstHtileOffset.y
+                    pCurRegion->dstSlice,                                                        //dstHtileOffset.z
+                    htileExtentY,                                                                //resolveExtentY,
+                    // start cb1[2]
+                    Pow2Align(srcCreateInfo.extent.width, HtileTexelAlign) / HtileTexelAlign,    //srcMipLevelHtileDim.x
+                    Pow2Align(srcCreateInfo.extent.height, HtileTexelAlign) / HtileTexelAlign,   //srcMipLevelHtileDim.y
+                    Pow2Align(pDstSubresInfo->extentTexels.width, HtileTexelAlign)
+                        / HtileTexelAlign,                                                       //dstMipLevelHtileDim.x
+                    Pow2Align(pDstSubresInfo->extentTexels.height, HtileTexelAlign)
+                        / HtileTexelAlign,                                                       //dstMipLevelHtileDim.y
+                    // start cb1[3]
+                    pDstHtile->GetInitialValue() & htileMask,                                    //zsDecompressedValue
+                    htileMask,                                                                   //htileMask
+                    0u,                                                                          //Padding
+                    0u,                                                                          //Padding
+                };
+
+                // Create an embedded user-data table and bind it to user data 0.
+                static const uint32 sizeBufferSrdDwords = NumBytesToNumDwords(sizeof(BufferSrd));
+                static const uint32 sizeConstDataDwords = NumBytesToNumDwords(sizeof(constData));
+                uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
+                    sizeBufferSrdDwords * 4 + sizeConstDataDwords,
+                    sizeBufferSrdDwords,
+                    PipelineBindPoint::Compute,
+                    0);
+
+                // Put the SRDs for the hTile buffer and hTile lookup table into shader-accessible memory
+                memcpy(pSrdTable, &bufferSrds[0], sizeof(bufferSrds));
+                pSrdTable += sizeBufferSrdDwords * 4;
+
+                // Provide the shader with all kinds of fun dimension info
+                memcpy(pSrdTable, &constData, sizeof(constData));
+
+                // Now that we have the dimensions in terms of compressed pixels, launch as many thread groups as we
+                // need to get to them all.
+                pCmdBuffer->CmdDispatch(RpmUtil::MinThreadGroups(htileExtentX, threadsPerGroup[0]),
+                    RpmUtil::MinThreadGroups(htileExtentY, threadsPerGroup[1]),
+                    RpmUtil::MinThreadGroups(htileExtentZ, threadsPerGroup[2]));
+            } // End of for
+
+            pCmdBuffer->CmdRestoreComputeState(ComputeStatePipelineAndUserData);
+        }
     } // End of if
 }
 
@@ -2630,130 +2649,134 @@ void RsrcProcMgr::DepthStencilClearGraphics(
     bindTargetsInfo.depthTarget.depthLayout   = depthLayout;
     bindTargetsInfo.depthTarget.stencilLayout = stencilLayout;
 
-    pCmdBuffer->PushGraphicsState();
-
     // Bind the depth expand state because it's just a full image quad and a zero PS (with no internal flags) which
     // is also what we need for the clear.
-    pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Graphics, GetGfxPipeline(DepthExpand), });
-    pCmdBuffer->CmdBindMsaaState(GetMsaaState(dstImage.Parent()->GetImageCreateInfo().samples,
-                                              dstImage.Parent()->GetImageCreateInfo().fragments));
-    pCmdBuffer->CmdSetDepthBiasState(depthBias);
-    pCmdBuffer->CmdSetInputAssemblyState(inputAssemblyState);
-    pCmdBuffer->CmdSetPointLineRasterState(pointLineRasterState);
-    pCmdBuffer->CmdSetStencilRefMasks(stencilRefMasks);
-    pCmdBuffer->CmdSetTriangleRasterState(triangleRasterState);
-
-    // Select a depth/stencil state object for this clear:
-    if (clearDepth && clearStencil)
-    {
-        pCmdBuffer->CmdBindDepthStencilState(m_pDepthStencilClearState);
-    }
-    else if (clearDepth)
-    {
-        pCmdBuffer->CmdBindDepthStencilState(m_pDepthClearState);
-    }
-    else if (clearStencil)
-    {
-        pCmdBuffer->CmdBindDepthStencilState(m_pStencilClearState);
-    }
-
-    // All mip levels share the same depth export value, so only need to do it once.
-    RpmUtil::WriteVsZOut(pCmdBuffer, depth);
+    const Pal::GraphicsPipeline*const pPipeline = GetGfxPipeline(pCmdBuffer, DepthExpand);
 
-    // Box of partial clear is only valid when number of mip-map is equal to 1.
-    PAL_ASSERT((boxCnt == 0) || ((pBox != nullptr) && (range.numMips == 1)));
-    uint32 scissorCnt = (boxCnt > 0) ? boxCnt : 1;
-
-    // Each mipmap level has to be fast-cleared individually because a depth target view can only be tied to a
-    // single mipmap level of the destination Image.
-    const uint32 lastMip = (range.startSubres.mipLevel + range.numMips - 1);
-    for (depthViewInfo.mipLevel  = range.startSubres.mipLevel;
-         depthViewInfo.mipLevel <= lastMip;
-         ++depthViewInfo.mipLevel)
+    if (pPipeline != nullptr)
     {
-        const SubresId         subres     = { range.startSubres.aspect, depthViewInfo.mipLevel, 0 };
-        const SubResourceInfo& subResInfo = *dstImage.Parent()->SubresourceInfo(subres);
-
-        // All slices of the same mipmap level can re-use the same viewport and scissor state.
-        viewportInfo.viewports[0].width  = static_cast<float>(subResInfo.extentTexels.width);
-        viewportInfo.viewports[0].height = static_cast<float>(subResInfo.extentTexels.height);
+        pCmdBuffer->PushGraphicsState();
+        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Graphics, pPipeline, });
+        pCmdBuffer->CmdBindMsaaState(GetMsaaState(dstImage.Parent()->GetImageCreateInfo().samples,
+                                                  dstImage.Parent()->GetImageCreateInfo().fragments));
+        pCmdBuffer->CmdSetDepthBiasState(depthBias);
+        pCmdBuffer->CmdSetInputAssemblyState(inputAssemblyState);
+        pCmdBuffer->CmdSetPointLineRasterState(pointLineRasterState);
+        pCmdBuffer->CmdSetStencilRefMasks(stencilRefMasks);
+        pCmdBuffer->CmdSetTriangleRasterState(triangleRasterState);
+
+        // Select a depth/stencil state object for this clear:
+        if (clearDepth && clearStencil)
+        {
+            pCmdBuffer->CmdBindDepthStencilState(m_pDepthStencilClearState);
+        }
+        else if (clearDepth)
+        {
+            pCmdBuffer->CmdBindDepthStencilState(m_pDepthClearState);
+        }
+        else if (clearStencil)
+        {
+            pCmdBuffer->CmdBindDepthStencilState(m_pStencilClearState);
+        }
 
-        scissorInfo.scissors[0].extent.width  = subResInfo.extentTexels.width;
-        scissorInfo.scissors[0].extent.height = subResInfo.extentTexels.height;
+        // All mip levels share the same depth export value, so only need to do it once.
+        RpmUtil::WriteVsZOut(pCmdBuffer, depth);
 
-        pCmdBuffer->CmdSetViewports(viewportInfo);
+        // Box of partial clear is only valid when number of mip-map is equal to 1.
+        PAL_ASSERT((boxCnt == 0) || ((pBox != nullptr) && (range.numMips == 1)));
+        uint32 scissorCnt = (boxCnt > 0) ? boxCnt : 1;
 
-        // If these flags are set, then the DB will do a fast-clear.  With them not set, then we wind up doing a
-        // slow clear with the Z-value being exported by the VS.
-        //
-        //     [If the surface can be bound as a texture, ] then we cannot do fast clears to a value that
-        //     isn't 0.0 or 1.0.  In this case, you would need a medium rate clear, which can be done
-        //     with CLEAR_DISALLOWED (assuming that feature works), or by setting CLEAR_ENABLE=0, and rendering
-        //     a full screen rect that has the clear value this will become a set of fast_set tiles, which are
-        //     faster than a slow clear, but not as fast as a real fast clear
-        //
-        //     Z_INFO and STENCIL_INFO CLEAR_DISALLOWED were never reliably working on GFX8 or 9.  Although the
-        //     bit is not implemented, it does actually connect into logic.  In block regressions, some tests
-        //     worked but many tests did not work using this bit.  Please do not set this bit
-
-        depthViewInfoInternal.flags.isDepthClear   = (fastClear && clearDepth);
-        depthViewInfoInternal.flags.isStencilClear = (fastClear && clearStencil);
-
-        // Issue a fast clear draw for each slice of the current mip level.
-        const uint32 lastSlice = (range.startSubres.arraySlice + range.numSlices - 1);
-        for (depthViewInfo.baseArraySlice  = range.startSubres.arraySlice;
-             depthViewInfo.baseArraySlice <= lastSlice;
-             ++depthViewInfo.baseArraySlice)
+        // Each mipmap level has to be fast-cleared individually because a depth target view can only be tied to a
+        // single mipmap level of the destination Image.
+        const uint32 lastMip = (range.startSubres.mipLevel + range.numMips - 1);
+        for (depthViewInfo.mipLevel  = range.startSubres.mipLevel;
+             depthViewInfo.mipLevel <= lastMip;
+             ++depthViewInfo.mipLevel)
         {
-            LinearAllocatorAuto<VirtualLinearAllocator> sliceAllocator(pCmdBuffer->Allocator(), false);
+            const SubresId         subres     = { range.startSubres.aspect, depthViewInfo.mipLevel, 0 };
+            const SubResourceInfo& subResInfo = *dstImage.Parent()->SubresourceInfo(subres);
 
-            IDepthStencilView* pDepthView = nullptr;
-            void* pDepthViewMem =
-                PAL_MALLOC(m_pDevice->GetDepthStencilViewSize(nullptr), &sliceAllocator, AllocInternalTemp);
+            // All slices of the same mipmap level can re-use the same viewport and scissor state.
+            viewportInfo.viewports[0].width  = static_cast<float>(subResInfo.extentTexels.width);
+            viewportInfo.viewports[0].height = static_cast<float>(subResInfo.extentTexels.height);
 
-            if (pDepthViewMem == nullptr)
-            {
-                pCmdBuffer->NotifyAllocFailure();
-            }
-            else
+            scissorInfo.scissors[0].extent.width  = subResInfo.extentTexels.width;
+            scissorInfo.scissors[0].extent.height = subResInfo.extentTexels.height;
+
+            pCmdBuffer->CmdSetViewports(viewportInfo);
+
+            // If these flags are set, then the DB will do a fast-clear.  With them not set, then we wind up doing a
+            // slow clear with the Z-value being exported by the VS.
+            //
+            //     [If the surface can be bound as a texture, ] then we cannot do fast clears to a value that
+            //     isn't 0.0 or 1.0.  In this case, you would need a medium rate clear, which can be done
+            //     with CLEAR_DISALLOWED (assuming that feature works), or by setting CLEAR_ENABLE=0, and rendering
+            //     a full screen rect that has the clear value this will become a set of fast_set tiles, which are
+            //     faster than a slow clear, but not as fast as a real fast clear
+            //
+            //     Z_INFO and STENCIL_INFO CLEAR_DISALLOWED were never reliably working on GFX8 or 9.  Although the
+            //     bit is not implemented, it does actually connect into logic.  In block regressions, some tests
+            //     worked but many tests did not work using this bit.  Please do not set this bit
+
+            depthViewInfoInternal.flags.isDepthClear   = (fastClear && clearDepth);
+            depthViewInfoInternal.flags.isStencilClear = (fastClear && clearStencil);
+
+            // Issue a fast clear draw for each slice of the current mip level.
+            const uint32 lastSlice = (range.startSubres.arraySlice + range.numSlices - 1);
+            for (depthViewInfo.baseArraySlice  = range.startSubres.arraySlice;
+                 depthViewInfo.baseArraySlice <= lastSlice;
+                 ++depthViewInfo.baseArraySlice)
             {
-                Result result = m_pDevice->CreateDepthStencilView(depthViewInfo,
-                                                                  depthViewInfoInternal,
-                                                                  pDepthViewMem,
-                                                                  &pDepthView);
-                PAL_ASSERT(result == Result::Success);
+                LinearAllocatorAuto<VirtualLinearAllocator> sliceAllocator(pCmdBuffer->Allocator(), false);
 
-                // Bind the depth view for this mip and slice.
-                bindTargetsInfo.depthTarget.pDepthStencilView = pDepthView;
-                pCmdBuffer->CmdBindTargets(bindTargetsInfo);
+                IDepthStencilView* pDepthView = nullptr;
+                void* pDepthViewMem =
+                    PAL_MALLOC(m_pDevice->GetDepthStencilViewSize(nullptr), &sliceAllocator, AllocInternalTemp);
 
-                for (uint32 i = 0; i < scissorCnt; i++)
+                if (pDepthViewMem == nullptr)
+                {
+                    pCmdBuffer->NotifyAllocFailure();
+                }
+                else
                 {
-                    if (boxCnt > 0)
+                    Result result = m_pDevice->CreateDepthStencilView(depthViewInfo,
+                                                                      depthViewInfoInternal,
+                                                                      pDepthViewMem,
+                                                                      &pDepthView);
+                    PAL_ASSERT(result == Result::Success);
+
+                    // Bind the depth view for this mip and slice.
+                    bindTargetsInfo.depthTarget.pDepthStencilView = pDepthView;
+                    pCmdBuffer->CmdBindTargets(bindTargetsInfo);
+
+                    for (uint32 i = 0; i < scissorCnt; i++)
                     {
-                        scissorInfo.scissors[0].offset.x      = pBox[i].offset.x;
-                        scissorInfo.scissors[0].offset.y      = pBox[i].offset.y;
-                        scissorInfo.scissors[0].extent.width  = pBox[i].extent.width;
-                        scissorInfo.scissors[0].extent.height = pBox[i].extent.height;
-                    }
+                        if (boxCnt > 0)
+                        {
+                            scissorInfo.scissors[0].offset.x      = pBox[i].offset.x;
+                            scissorInfo.scissors[0].offset.y      = pBox[i].offset.y;
+                            scissorInfo.scissors[0].extent.width  = pBox[i].extent.width;
+                            scissorInfo.scissors[0].extent.height = pBox[i].extent.height;
+                        }
 
-                    pCmdBuffer->CmdSetScissorRects(scissorInfo);
+                        pCmdBuffer->CmdSetScissorRects(scissorInfo);
 
-                    // Draw a fullscreen quad.
-                    pCmdBuffer->CmdDraw(0, 3, 0, 1);
-                }
+                        // Draw a fullscreen quad.
+                        pCmdBuffer->CmdDraw(0, 3, 0, 1);
+                    }
 
-                // Unbind the depth view and destroy it.
-                bindTargetsInfo.depthTarget.pDepthStencilView = nullptr;
-                pCmdBuffer->CmdBindTargets(bindTargetsInfo);
+                    // Unbind the depth view and destroy it.
+                    bindTargetsInfo.depthTarget.pDepthStencilView = nullptr;
+                    pCmdBuffer->CmdBindTargets(bindTargetsInfo);
 
-                PAL_SAFE_FREE(pDepthViewMem, &sliceAllocator);
-            }
-        } // End for each slice.
-    } // End for each mip.
+                    PAL_SAFE_FREE(pDepthViewMem, &sliceAllocator);
+                }
+            } // End for each slice.
+        } // End for each mip.
 
-    // Restore original command buffer state and destroy the depth/stencil state.
-    pCmdBuffer->PopGraphicsState();
+        // Restore original command buffer state and destroy the depth/stencil state.
+        pCmdBuffer->PopGraphicsState();
+    }
 }
 
 // =====================================================================================================================
@@ -2825,7 +2848,7 @@ void RsrcProcMgr::DccDecompressOnCompute(
 {
     const auto&  device            = *m_pDevice->Parent();
     const auto&  parentImg         = *image.Parent();
-    const auto*  pPipeline         = GetComputeMaskRamExpandPipeline(parentImg);
+    const auto*  pPipeline         = GetComputeMaskRamExpandPipeline(pCmdBuffer, parentImg);
     auto*        pComputeCmdStream = pCmdBuffer->GetCmdStreamByEngine(CmdBufferEngineSupport::Compute);
     uint32*      pComputeCmdSpace  = nullptr;
     const auto&  createInfo        = parentImg.GetImageCreateInfo();
@@ -2833,86 +2856,90 @@ void RsrcProcMgr::DccDecompressOnCompute(
     // If this trips, we have a big problem...
     PAL_ASSERT(pComputeCmdStream != nullptr);
 
-    // Compute the number of thread groups needed to launch one thread per texel.
-    uint32 threadsPerGroup[3] = {};
-    pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
-
-    pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
-    pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
-
-    const EngineType engineType = pCmdBuffer->GetEngineType();
-    const uint32     lastMip    = range.startSubres.mipLevel + range.numMips - 1;
-    bool             earlyExit  = false;
-
-    for (uint32  mipLevel = range.startSubres.mipLevel; ((earlyExit == false) && (mipLevel <= lastMip)); mipLevel++)
+    if (pPipeline != nullptr)
     {
-        const SubresId              mipBaseSubResId = { range.startSubres.aspect, mipLevel, 0 };
-        const SubResourceInfo*const pBaseSubResInfo = image.Parent()->SubresourceInfo(mipBaseSubResId);
-
-        // Blame the caller if this trips...
-        PAL_ASSERT(pBaseSubResInfo->flags.supportMetaDataTexFetch);
+        // Compute the number of thread groups needed to launch one thread per texel.
+        uint32 threadsPerGroup[3] = {};
+        pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
 
-        const uint32  threadGroupsX = RpmUtil::MinThreadGroups(pBaseSubResInfo->extentElements.width,
-                                                               threadsPerGroup[0]);
-        const uint32  threadGroupsY = RpmUtil::MinThreadGroups(pBaseSubResInfo->extentElements.height,
-                                                               threadsPerGroup[1]);
-        const uint32 constData[] =
-        {
-            // start cb0[0]
-            pBaseSubResInfo->extentElements.width,
-            pBaseSubResInfo->extentElements.height,
-        };
+        pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
+        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
 
-        const uint32 sizeConstDataDwords = NumBytesToNumDwords(sizeof(constData));
+        const EngineType engineType = pCmdBuffer->GetEngineType();
+        const uint32     lastMip    = range.startSubres.mipLevel + range.numMips - 1;
+        bool             earlyExit  = false;
 
-        for (uint32  sliceIdx = 0; sliceIdx < range.numSlices; sliceIdx++)
+        for (uint32  mipLevel = range.startSubres.mipLevel; ((earlyExit == false) && (mipLevel <= lastMip)); mipLevel++)
         {
-            const SubresId     subResId =  { mipBaseSubResId.aspect,
-                                             mipBaseSubResId.mipLevel,
-                                             range.startSubres.arraySlice + sliceIdx };
-            const SubresRange  viewRange = { subResId, 1, 1 };
+            const SubresId              mipBaseSubResId = { range.startSubres.aspect, mipLevel, 0 };
+            const SubResourceInfo*const pBaseSubResInfo = image.Parent()->SubresourceInfo(mipBaseSubResId);
 
-            // Create an embedded user-data table and bind it to user data 0. We will need two views.
-            uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
-                                                                       2 * SrdDwordAlignment() + sizeConstDataDwords,
-                                                                       SrdDwordAlignment(),
-                                                                       PipelineBindPoint::Compute,
-                                                                       0);
+            // Blame the caller if this trips...
+            PAL_ASSERT(pBaseSubResInfo->flags.supportMetaDataTexFetch);
 
-            ImageViewInfo imageView[2] = {};
-            RpmUtil::BuildImageViewInfo(
-                &imageView[0], parentImg, viewRange, createInfo.swizzledFormat, false, device.TexOptLevel()); // src
-            RpmUtil::BuildImageViewInfo(
-                &imageView[1], parentImg, viewRange, createInfo.swizzledFormat, true, device.TexOptLevel());  // dst
-            device.CreateImageViewSrds(2, &imageView[0], pSrdTable);
+            const uint32  threadGroupsX = RpmUtil::MinThreadGroups(pBaseSubResInfo->extentElements.width,
+                                                                   threadsPerGroup[0]);
+            const uint32  threadGroupsY = RpmUtil::MinThreadGroups(pBaseSubResInfo->extentElements.height,
+                                                                   threadsPerGroup[1]);
+            const uint32 constData[] =
+            {
+                // start cb0[0]
+                pBaseSubResInfo->extentElements.width,
+                pBaseSubResInfo->extentElements.height,
+            };
 
-            pSrdTable += 2 * SrdDwordAlignment();
-            memcpy(pSrdTable, constData, sizeof(constData));
+            const uint32 sizeConstDataDwords = NumBytesToNumDwords(sizeof(constData));
 
-            // Execute the dispatch.
-            pCmdBuffer->CmdDispatch(threadGroupsX, threadGroupsY, 1);
-        } // end loop through all the slices
-    }
+            for (uint32  sliceIdx = 0; sliceIdx < range.numSlices; sliceIdx++)
+            {
+                const SubresId     subResId =  { mipBaseSubResId.aspect,
+                                                 mipBaseSubResId.mipLevel,
+                                                 range.startSubres.arraySlice + sliceIdx };
+                const SubresRange  viewRange = { subResId, 1, 1 };
 
-    // We have to mark this mip level as actually being DCC decompressed
-    image.UpdateDccStateMetaData(pCmdStream, range, nullptr, false, engineType, PredDisable);
+                // Create an embedded user-data table and bind it to user data 0. We will need two views.
+                uint32* pSrdTable =
+                    RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
+                                                           2 * SrdDwordAlignment() + sizeConstDataDwords,
+                                                           SrdDwordAlignment(),
+                                                           PipelineBindPoint::Compute,
+                                                           0);
 
-    // Make sure that the decompressed image data has been written before we start fixing up DCC memory.
-    pComputeCmdSpace  = pComputeCmdStream->ReserveCommands();
-    pComputeCmdSpace += m_cmdUtil.BuildNonSampleEventWrite(CS_PARTIAL_FLUSH, engineType, pComputeCmdSpace);
-    pComputeCmdStream->CommitCommands(pComputeCmdSpace);
+                ImageViewInfo imageView[2] = {};
+                RpmUtil::BuildImageViewInfo(
+                    &imageView[0], parentImg, viewRange, createInfo.swizzledFormat, false, device.TexOptLevel()); // src
+                RpmUtil::BuildImageViewInfo(
+                    &imageView[1], parentImg, viewRange, createInfo.swizzledFormat, true, device.TexOptLevel());  // dst
+                device.CreateImageViewSrds(2, &imageView[0], pSrdTable);
 
-    pCmdBuffer->CmdRestoreComputeState(ComputeStatePipelineAndUserData);
+                pSrdTable += 2 * SrdDwordAlignment();
+                memcpy(pSrdTable, constData, sizeof(constData));
 
-    // Put DCC memory itself back into a "fully decompressed" state, since only compressed fragments needed
-    // to be written, as initialization of dcc memory will write to uncompressed fragment and hence
-    // they don't need to be written here. Change from init to fastclear.
-    ClearDcc(pCmdBuffer, pCmdStream, image, range, Gfx9Dcc::InitialValue, DccClearPurpose::FastClear);
+                // Execute the dispatch.
+                pCmdBuffer->CmdDispatch(threadGroupsX, threadGroupsY, 1);
+            } // end loop through all the slices
+        }
 
-    // And let the DCC fixup finish as well
-    pComputeCmdSpace  = pComputeCmdStream->ReserveCommands();
-    pComputeCmdSpace += m_cmdUtil.BuildNonSampleEventWrite(CS_PARTIAL_FLUSH, engineType, pComputeCmdSpace);
-    pComputeCmdStream->CommitCommands(pComputeCmdSpace);
+        // We have to mark this mip level as actually being DCC decompressed
+        image.UpdateDccStateMetaData(pCmdStream, range, nullptr, false, engineType, PredDisable);
+
+        // Make sure that the decompressed image data has been written before we start fixing up DCC memory.
+        pComputeCmdSpace  = pComputeCmdStream->ReserveCommands();
+        pComputeCmdSpace += m_cmdUtil.BuildNonSampleEventWrite(CS_PARTIAL_FLUSH, engineType, pComputeCmdSpace);
+        pComputeCmdStream->CommitCommands(pComputeCmdSpace);
+
+        pCmdBuffer->CmdRestoreComputeState(ComputeStatePipelineAndUserData);
+
+        // Put DCC memory itself back into a "fully decompressed" state, since only compressed fragments needed
+        // to be written, as initialization of dcc memory will write to uncompressed fragment and hence
+        // they don't need to be written here. Change from init to fastclear.
+        ClearDcc(pCmdBuffer, pCmdStream, image, range, Gfx9Dcc::InitialValue, DccClearPurpose::FastClear);
+
+        // And let the DCC fixup finish as well
+        pComputeCmdSpace  = pComputeCmdStream->ReserveCommands();
+        pComputeCmdSpace += m_cmdUtil.BuildNonSampleEventWrite(CS_PARTIAL_FLUSH, engineType, pComputeCmdSpace);
+        pComputeCmdStream->CommitCommands(pComputeCmdSpace);
+    }
 }
 
 // =====================================================================================================================
@@ -3077,54 +3104,57 @@ void RsrcProcMgr::ClearFmask(
     const auto*  pParent            = dstImage.Parent();
     const auto*  pFmask             = dstImage.GetFmask();
     const auto&  imageCreateInfo    = pParent->GetImageCreateInfo();
-    const auto   pPipeline          = GetPipeline(RpmComputePipeline::ClearImage2d);
+    const auto   pPipeline          = GetPipeline(pCmdBuffer, RpmComputePipeline::ClearImage2d);
     uint32       threadsPerGroup[3] = {};
 
-    pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
+    if (pPipeline != nullptr)
+    {
+        pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
 
-    // NOTE: MSAA Images do not support multiple mipmpap levels, so we can make some assumptions here.
-    PAL_ASSERT(imageCreateInfo.mipLevels == 1);
-    PAL_ASSERT((clearRange.startSubres.mipLevel == 0) && (clearRange.numMips == 1));
+        // NOTE: MSAA Images do not support multiple mipmpap levels, so we can make some assumptions here.
+        PAL_ASSERT(imageCreateInfo.mipLevels == 1);
+        PAL_ASSERT((clearRange.startSubres.mipLevel == 0) && (clearRange.numMips == 1));
 
-    pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
+        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
 
-    const uint32  userData[] =
-    {
-        // color
-        LowPart(clearValue), HighPart(clearValue), 0, 0,
-        // (x,y) offset, (width,height)
-        0, 0, imageCreateInfo.extent.width, imageCreateInfo.extent.height,
-        // ignored
-        0, 0, 0
-    };
+        const uint32  userData[] =
+        {
+            // color
+            LowPart(clearValue), HighPart(clearValue), 0, 0,
+            // (x,y) offset, (width,height)
+            0, 0, imageCreateInfo.extent.width, imageCreateInfo.extent.height,
+            // ignored
+            0, 0, 0
+        };
+
+        const uint32  DataDwords = NumBytesToNumDwords(sizeof(userData));
+
+        // Create an embedded user-data table and bind it to user data 0.
+        uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
+                                                                   SrdDwordAlignment() + DataDwords,
+                                                                   SrdDwordAlignment(),
+                                                                   PipelineBindPoint::Compute,
+                                                                   0);
+
+        // We need an image view for the fMask surface
+        FmaskViewInfo fmaskBufferView        = { };
+        fmaskBufferView.pImage               = pParent;
+        fmaskBufferView.baseArraySlice       = clearRange.startSubres.arraySlice;
+        fmaskBufferView.arraySize            = clearRange.numSlices;
+        fmaskBufferView.flags.shaderWritable = 1;
+
+        FmaskViewInternalInfo fmaskViewInternal = {};
+        fmaskViewInternal.flags.fmaskAsUav = 1;
 
-    const uint32  DataDwords = NumBytesToNumDwords(sizeof(userData));
-
-    // Create an embedded user-data table and bind it to user data 0.
-    uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
-                                                               SrdDwordAlignment() + DataDwords,
-                                                               SrdDwordAlignment(),
-                                                               PipelineBindPoint::Compute,
-                                                               0);
-
-    // We need an image view for the fMask surface
-    FmaskViewInfo fmaskBufferView        = { };
-    fmaskBufferView.pImage               = pParent;
-    fmaskBufferView.baseArraySlice       = clearRange.startSubres.arraySlice;
-    fmaskBufferView.arraySize            = clearRange.numSlices;
-    fmaskBufferView.flags.shaderWritable = 1;
-
-    FmaskViewInternalInfo fmaskViewInternal = {};
-    fmaskViewInternal.flags.fmaskAsUav = 1;
-
-    m_pDevice->CreateFmaskViewSrdsInternal(1, &fmaskBufferView, &fmaskViewInternal, pSrdTable);
-    pSrdTable += SrdDwordAlignment();
-    memcpy(pSrdTable, &userData[0], sizeof(userData));
-
-    // And hit the "go" button...
-    pCmdBuffer->CmdDispatch(RpmUtil::MinThreadGroups(imageCreateInfo.extent.width,  threadsPerGroup[0]),
-                            RpmUtil::MinThreadGroups(imageCreateInfo.extent.height, threadsPerGroup[1]),
-                            RpmUtil::MinThreadGroups(clearRange.numSlices,          threadsPerGroup[2]));
+        m_pDevice->CreateFmaskViewSrdsInternal(1, &fmaskBufferView, &fmaskViewInternal, pSrdTable);
+        pSrdTable += SrdDwordAlignment();
+        memcpy(pSrdTable, &userData[0], sizeof(userData));
+
+        // And hit the "go" button...
+        pCmdBuffer->CmdDispatch(RpmUtil::MinThreadGroups(imageCreateInfo.extent.width,  threadsPerGroup[0]),
+                                RpmUtil::MinThreadGroups(imageCreateInfo.extent.height, threadsPerGroup[1]),
+                                RpmUtil::MinThreadGroups(clearRange.numSlices,          threadsPerGroup[2]));
+    }
 }
 
 // =====================================================================================================================
@@ -3161,15 +3191,15 @@ void RsrcProcMgr::FmaskColorExpand(
         switch (createInfo.fragments)
         {
         case 2:
-            pPipeline = GetPipeline(RpmComputePipeline::MsaaFmaskExpand2x);
+            pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaFmaskExpand2x);
             break;
 
         case 4:
-            pPipeline = GetPipeline(RpmComputePipeline::MsaaFmaskExpand4x);
+            pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaFmaskExpand4x);
             break;
 
         case 8:
-            pPipeline = GetPipeline(RpmComputePipeline::MsaaFmaskExpand8x);
+            pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaFmaskExpand8x);
             break;
 
         default:
@@ -3177,71 +3207,73 @@ void RsrcProcMgr::FmaskColorExpand(
             break;
         }
 
-        PAL_ASSERT(pPipeline != nullptr);
-
-        // Compute the number of thread groups needed to launch one thread per texel.
-        uint32 threadsPerGroup[3] = {};
-        pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
+        if (pPipeline != nullptr)
+        {
+            // Compute the number of thread groups needed to launch one thread per texel.
+            uint32 threadsPerGroup[3] = {};
+            pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
 
-        const uint32 threadGroupsX = RpmUtil::MinThreadGroups(createInfo.extent.width,  threadsPerGroup[0]);
-        const uint32 threadGroupsY = RpmUtil::MinThreadGroups(createInfo.extent.height, threadsPerGroup[1]);
+            const uint32 threadGroupsX = RpmUtil::MinThreadGroups(createInfo.extent.width,  threadsPerGroup[0]);
+            const uint32 threadGroupsY = RpmUtil::MinThreadGroups(createInfo.extent.height, threadsPerGroup[1]);
 
-        // Save current command buffer state and bind the pipeline.
-        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
+            // Save current command buffer state and bind the pipeline.
+            pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
 
-        // Select the appropriate value to indicate that FMask is fully expanded and place it in user data 8-9.
-        // Put the low part in user data 8 and the high part in user data 9.
-        // The fmask bits is placed in user data 10
-        const uint32 expandedValueData[3] =
-        {
-            LowPart(FmaskExpandedValues[log2Fragments][log2Samples]),
-            HighPart(FmaskExpandedValues[log2Fragments][log2Samples]),
-            numFmaskBits
-        };
+            // Select the appropriate value to indicate that FMask is fully expanded and place it in user data 8-9.
+            // Put the low part in user data 8 and the high part in user data 9.
+            // The fmask bits is placed in user data 10
+            const uint32 expandedValueData[3] =
+            {
+                LowPart(FmaskExpandedValues[log2Fragments][log2Samples]),
+                HighPart(FmaskExpandedValues[log2Fragments][log2Samples]),
+                numFmaskBits
+            };
 
-        pCmdBuffer->CmdSetUserData(PipelineBindPoint::Compute, 1, 3, expandedValueData);
+            pCmdBuffer->CmdSetUserData(PipelineBindPoint::Compute, 1, 3, expandedValueData);
 
-        // Because we are setting up the MSAA surface as a 3D UAV, we need to have a separate dispatch for each slice.
-        SubresRange  viewRange = { range.startSubres, 1, 1 };
-        const uint32 lastSlice = range.startSubres.arraySlice + range.numSlices - 1;
+            // Because we are setting up the MSAA surface as a 3D UAV, we need to have a separate dispatch for each
+            // slice.
+            SubresRange  viewRange = { range.startSubres, 1, 1 };
+            const uint32 lastSlice = range.startSubres.arraySlice + range.numSlices - 1;
 
-        SwizzledFormat format   = createInfo.swizzledFormat;
-        // For srgb we will get wrong data for gamma correction, here we use unorm instead.
-        if (Formats::IsSrgb(format.format))
-        {
-            format.format = Formats::ConvertToUnorm(format.format);
-        }
+            SwizzledFormat format   = createInfo.swizzledFormat;
+            // For srgb we will get wrong data for gamma correction, here we use unorm instead.
+            if (Formats::IsSrgb(format.format))
+            {
+                format.format = Formats::ConvertToUnorm(format.format);
+            }
 
-        for (; viewRange.startSubres.arraySlice <= lastSlice; ++viewRange.startSubres.arraySlice)
-        {
-            // Create an embedded user-data table and bind it to user data 0. We will need two views.
-            uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
-                                                                       SrdDwordAlignment() * 2,
-                                                                       SrdDwordAlignment(),
-                                                                       PipelineBindPoint::Compute,
-                                                                       0);
+            for (; viewRange.startSubres.arraySlice <= lastSlice; ++viewRange.startSubres.arraySlice)
+            {
+                // Create an embedded user-data table and bind it to user data 0. We will need two views.
+                uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
+                                                                           SrdDwordAlignment() * 2,
+                                                                           SrdDwordAlignment(),
+                                                                           PipelineBindPoint::Compute,
+                                                                           0);
 
-            // Populate the table with and image view and an FMask view for the current slice.
-            ImageViewInfo imageView = {};
-            RpmUtil::BuildImageViewInfo(&imageView, *image.Parent(), viewRange, format, true, device.TexOptLevel());
-            imageView.viewType = ImageViewType::Tex2d;
+                // Populate the table with and image view and an FMask view for the current slice.
+                ImageViewInfo imageView = {};
+                RpmUtil::BuildImageViewInfo(&imageView, *image.Parent(), viewRange, format, true, device.TexOptLevel());
+                imageView.viewType = ImageViewType::Tex2d;
 
-            device.CreateImageViewSrds(1, &imageView, pSrdTable);
-            pSrdTable += SrdDwordAlignment();
+                device.CreateImageViewSrds(1, &imageView, pSrdTable);
+                pSrdTable += SrdDwordAlignment();
 
-            FmaskViewInfo fmaskView = {};
-            fmaskView.pImage               = image.Parent();
-            fmaskView.baseArraySlice       = viewRange.startSubres.arraySlice;
-            fmaskView.arraySize            = 1;
-            fmaskView.flags.shaderWritable = 1;
+                FmaskViewInfo fmaskView = {};
+                fmaskView.pImage               = image.Parent();
+                fmaskView.baseArraySlice       = viewRange.startSubres.arraySlice;
+                fmaskView.arraySize            = 1;
+                fmaskView.flags.shaderWritable = 1;
 
-            FmaskViewInternalInfo fmaskViewInternal = {};
-            fmaskViewInternal.flags.fmaskAsUav = 1;
+                FmaskViewInternalInfo fmaskViewInternal = {};
+                fmaskViewInternal.flags.fmaskAsUav = 1;
 
-            m_pDevice->CreateFmaskViewSrdsInternal(1, &fmaskView, &fmaskViewInternal, pSrdTable);
+                m_pDevice->CreateFmaskViewSrdsInternal(1, &fmaskView, &fmaskViewInternal, pSrdTable);
 
-            // Execute the dispatch.
-            pCmdBuffer->CmdDispatch(threadGroupsX, threadGroupsY, 1);
+                // Execute the dispatch.
+                pCmdBuffer->CmdDispatch(threadGroupsX, threadGroupsY, 1);
+            }
         }
     }
 
@@ -3482,70 +3514,73 @@ void Gfx9RsrcProcMgr::ClearHtileAllBytes(
         // Bind the GFX9 Fill 4x4 Dword pipeline
         uint32 threadsPerGroup[3] = {};
 
-        const auto*const pPipeline = GetPipeline(RpmComputePipeline::Gfx9Fill4x4Dword);
-
-        pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
-
-        // Bind Compute Pipeline used for the clear.
-        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
+        const auto*const pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::Gfx9Fill4x4Dword);
 
-        // On GFX9, we create a single view of the hTile buffer that points to the base mip level.  It's
-        // up to the equation to "find" each mip level and slice from that base location.
-        BufferViewInfo hTileSurfBufferView = {};
-        pHtile->BuildSurfBufferView(dstImage, &hTileSurfBufferView);
-        // Make it Structured
-        hTileSurfBufferView.swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
-        hTileSurfBufferView.swizzledFormat.swizzle =
-           {ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W};
-        hTileSurfBufferView.stride = sizeof(uint32)* 4;
-
-        if (sliceStart > 0)
+        if (pPipeline != nullptr)
         {
-            uint32 metaOffsetInBytes     = hTileAddrOutput.sliceSize * sliceStart;
-            hTileSurfBufferView.gpuAddr += metaOffsetInBytes;
-            PAL_ASSERT(hTileSurfBufferView.range > metaOffsetInBytes);
-            hTileSurfBufferView.range   -= metaOffsetInBytes;
-        }
+            pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
+
+            // Bind Compute Pipeline used for the clear.
+            pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
+
+            // On GFX9, we create a single view of the hTile buffer that points to the base mip level.  It's
+            // up to the equation to "find" each mip level and slice from that base location.
+            BufferViewInfo hTileSurfBufferView = {};
+            pHtile->BuildSurfBufferView(dstImage, &hTileSurfBufferView);
+            // Make it Structured
+            hTileSurfBufferView.swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
+            hTileSurfBufferView.swizzledFormat.swizzle =
+               {ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W};
+            hTileSurfBufferView.stride = sizeof(uint32)* 4;
+
+            if (sliceStart > 0)
+            {
+                uint32 metaOffsetInBytes     = hTileAddrOutput.sliceSize * sliceStart;
+                hTileSurfBufferView.gpuAddr += metaOffsetInBytes;
+                PAL_ASSERT(hTileSurfBufferView.range > metaOffsetInBytes);
+                hTileSurfBufferView.range   -= metaOffsetInBytes;
+            }
 
-        PAL_ASSERT((hTileSurfBufferView.range & 0xf) == 0);
+            PAL_ASSERT((hTileSurfBufferView.range & 0xf) == 0);
 
-        uint32 clearBytes = hTileAddrOutput.sliceSize * numSlices;
-        // Divide by 16 since we clear 4 Dwords in each compute thread
-        uint32 metaThreadX = clearBytes >> 4;
+            uint32 clearBytes = hTileAddrOutput.sliceSize * numSlices;
+            // Divide by 16 since we clear 4 Dwords in each compute thread
+            uint32 metaThreadX = clearBytes >> 4;
 
-        // Create Buffer Srds (UAV in our case)
-        BufferSrd     bufferSrds[1] = {};
-        pDevice->CreateTypedBufferViewSrds(1, &hTileSurfBufferView, &bufferSrds[0]);
+            // Create Buffer Srds (UAV in our case)
+            BufferSrd     bufferSrds[1] = {};
+            pDevice->CreateTypedBufferViewSrds(1, &hTileSurfBufferView, &bufferSrds[0]);
 
-        // Constant data
-        const uint32 constData[] =
-        {
-            // start cb0[0]
-            htileValue,
-        };
+            // Constant data
+            const uint32 constData[] =
+            {
+                // start cb0[0]
+                htileValue,
+            };
 
-        // Create an embedded user-data table and bind it to user data 0.
-        const uint32  sizeConstDataDwords = NumBytesToNumDwords(sizeof(constData));
-        uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
-                                                                   SrdDwordAlignment() * 2 + sizeConstDataDwords,
-                                                                   SrdDwordAlignment(),
-                                                                   PipelineBindPoint::Compute,
-                                                                   0);
+            // Create an embedded user-data table and bind it to user data 0.
+            const uint32  sizeConstDataDwords = NumBytesToNumDwords(sizeof(constData));
+            uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
+                                                                       SrdDwordAlignment() * 2 + sizeConstDataDwords,
+                                                                       SrdDwordAlignment(),
+                                                                       PipelineBindPoint::Compute,
+                                                                       0);
+
+            // Supply the shader with a copy of our SRDs for the htile buffer
+            memcpy(pSrdTable, &bufferSrds[0], sizeof(bufferSrds));
+            pSrdTable += Util::NumBytesToNumDwords(sizeof(bufferSrds));
 
-        // Supply the shader with a copy of our SRDs for the htile buffer
-        memcpy(pSrdTable, &bufferSrds[0], sizeof(bufferSrds));
-        pSrdTable += Util::NumBytesToNumDwords(sizeof(bufferSrds));
+            // Pass to shader all kinds of Information related to meta data equation
+            memcpy(pSrdTable, &constData[0], sizeof(constData));
 
-        // Pass to shader all kinds of Information related to meta data equation
-        memcpy(pSrdTable, &constData[0], sizeof(constData));
+            uint32 numThreadGroupsX = 1;
+            if (metaThreadX != 0)
+            {
+                numThreadGroupsX = RpmUtil::MinThreadGroups(metaThreadX, threadsPerGroup[0]);
+            }
 
-        uint32 numThreadGroupsX = 1;
-        if (metaThreadX != 0)
-        {
-            numThreadGroupsX = RpmUtil::MinThreadGroups(metaThreadX, threadsPerGroup[0]);
+            pCmdBuffer->CmdDispatch(numThreadGroupsX, 1, 1);
         }
-
-        pCmdBuffer->CmdDispatch(numThreadGroupsX, 1, 1);
     }
     else
     {
@@ -3556,121 +3591,124 @@ void Gfx9RsrcProcMgr::ClearHtileAllBytes(
         // parameters
         uint32        threadsPerGroup[3] = {};
 
-        const auto*const pPipeline = GetPipeline(RpmComputePipeline::Gfx9ClearDccOptimized2d);
-
-        pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
-
-        // Bind Compute Pipeline used for the clear.
-        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
+        const auto*const pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::Gfx9ClearDccOptimized2d);
 
-        // Create an SRD for the htile surface itself. This is a constant across all mip-levels as it's the shaders
-        // job to calculate the proper address for each pixel of each mip level.
-        BufferViewInfo hTileSurfBufferView = {};
-        pHtile->BuildSurfBufferView(dstImage, &hTileSurfBufferView);
-        // Make it Structured
-        hTileSurfBufferView.swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
-        hTileSurfBufferView.swizzledFormat.swizzle =
-           {ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W};
-        hTileSurfBufferView.stride = sizeof(uint32)* 4;
-
-        uint32 metaBlockOffset = 0;
-        uint32 metaThreadX     = 0;
-        uint32 metaThreadY     = 1;
-        uint32 metaThreadZ     = 1;
-
-        uint32 mipChainPitchInMetaBlk  = 0;
-        uint32 mipChainHeightInMetaBlk = 0;
-        uint32 mipSlicePitchInMetaBlk  = 0;
-
-        if (createInfo.mipLevels == 1)
+        if (pPipeline != nullptr)
         {
-            // Check if we need to add any offset to our metablock address calculation
-            metaBlockOffset   = sliceStart * hTileAddrOutput.metaBlkNumPerSlice;
-            uint32 clearBytes = hTileAddrOutput.sliceSize * numSlices;
+            pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
+
+            // Bind Compute Pipeline used for the clear.
+            pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
+
+            // Create an SRD for the htile surface itself. This is a constant across all mip-levels as it's the shaders
+            // job to calculate the proper address for each pixel of each mip level.
+            BufferViewInfo hTileSurfBufferView = {};
+            pHtile->BuildSurfBufferView(dstImage, &hTileSurfBufferView);
+            // Make it Structured
+            hTileSurfBufferView.swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
+            hTileSurfBufferView.swizzledFormat.swizzle =
+               {ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W};
+            hTileSurfBufferView.stride = sizeof(uint32)* 4;
+
+            uint32 metaBlockOffset = 0;
+            uint32 metaThreadX     = 0;
+            uint32 metaThreadY     = 1;
+            uint32 metaThreadZ     = 1;
+
+            uint32 mipChainPitchInMetaBlk  = 0;
+            uint32 mipChainHeightInMetaBlk = 0;
+            uint32 mipSlicePitchInMetaBlk  = 0;
+
+            if (createInfo.mipLevels == 1)
+            {
+                // Check if we need to add any offset to our metablock address calculation
+                metaBlockOffset   = sliceStart * hTileAddrOutput.metaBlkNumPerSlice;
+                uint32 clearBytes = hTileAddrOutput.sliceSize * numSlices;
 
-            // Divide by 16 since we clear 4 Dwords in each compute thread
-            metaThreadX = clearBytes >> 4;
-        }
-        else
-        {
-            mipChainPitchInMetaBlk  = hTileAddrOutput.pitch / hTileAddrOutput.metaBlkWidth;
-            mipChainHeightInMetaBlk = hTileAddrOutput.height / hTileAddrOutput.metaBlkHeight;
+                // Divide by 16 since we clear 4 Dwords in each compute thread
+                metaThreadX = clearBytes >> 4;
+            }
+            else
+            {
+                mipChainPitchInMetaBlk  = hTileAddrOutput.pitch / hTileAddrOutput.metaBlkWidth;
+                mipChainHeightInMetaBlk = hTileAddrOutput.height / hTileAddrOutput.metaBlkHeight;
 
-            PAL_ASSERT((mipChainPitchInMetaBlk * mipChainHeightInMetaBlk) == hTileAddrOutput.metaBlkNumPerSlice);
+                PAL_ASSERT((mipChainPitchInMetaBlk * mipChainHeightInMetaBlk) == hTileAddrOutput.metaBlkNumPerSlice);
 
-            const auto&   hTileMipInfo = pHtile->GetAddrMipInfo(range.startSubres.mipLevel);
+                const auto&   hTileMipInfo = pHtile->GetAddrMipInfo(range.startSubres.mipLevel);
 
-            uint32 mipStartZInBlk = hTileMipInfo.startZ;
-            uint32 mipStartYInBlk = hTileMipInfo.startY / hTileAddrOutput.metaBlkHeight;
-            uint32 mipStartXInBlk = hTileMipInfo.startX / hTileAddrOutput.metaBlkWidth;
+                uint32 mipStartZInBlk = hTileMipInfo.startZ;
+                uint32 mipStartYInBlk = hTileMipInfo.startY / hTileAddrOutput.metaBlkHeight;
+                uint32 mipStartXInBlk = hTileMipInfo.startX / hTileAddrOutput.metaBlkWidth;
 
-            metaBlockOffset = (mipStartZInBlk + sliceStart) * hTileAddrOutput.metaBlkNumPerSlice +
-                               mipStartYInBlk * mipChainPitchInMetaBlk +
-                               mipStartXInBlk;
+                metaBlockOffset = (mipStartZInBlk + sliceStart) * hTileAddrOutput.metaBlkNumPerSlice +
+                                   mipStartYInBlk * mipChainPitchInMetaBlk +
+                                   mipStartXInBlk;
 
-            mipSlicePitchInMetaBlk = mipChainPitchInMetaBlk * mipChainHeightInMetaBlk;
+                mipSlicePitchInMetaBlk = mipChainPitchInMetaBlk * mipChainHeightInMetaBlk;
 
-            uint32 metaBlkSize = hTileAddrOutput.sliceSize / hTileAddrOutput.metaBlkNumPerSlice;
+                uint32 metaBlkSize = hTileAddrOutput.sliceSize / hTileAddrOutput.metaBlkNumPerSlice;
 
-            metaThreadX = (hTileMipInfo.width / hTileAddrOutput.metaBlkWidth) * metaBlkSize >> 4;
-            metaThreadY = hTileMipInfo.height / hTileAddrOutput.metaBlkHeight;
-            metaThreadZ = numSlices;
-        }
+                metaThreadX = (hTileMipInfo.width / hTileAddrOutput.metaBlkWidth) * metaBlkSize >> 4;
+                metaThreadY = hTileMipInfo.height / hTileAddrOutput.metaBlkHeight;
+                metaThreadZ = numSlices;
+            }
 
-        PAL_ASSERT((hTileSurfBufferView.range & 0xf) == 0);
+            PAL_ASSERT((hTileSurfBufferView.range & 0xf) == 0);
 
-        // Create Buffer Srds (UAV in our case)
-        BufferSrd     bufferSrds[1] = {};
-        pDevice->CreateTypedBufferViewSrds(1, &hTileSurfBufferView, &bufferSrds[0]);
+            // Create Buffer Srds (UAV in our case)
+            BufferSrd     bufferSrds[1] = {};
+            pDevice->CreateTypedBufferViewSrds(1, &hTileSurfBufferView, &bufferSrds[0]);
 
-        // Constant data
-        const uint32 constData[] =
-        {
-            // start cb0[0]
-            htileValue,
-            // start cb0[1]
-            metaClearConstEqParam.metablockSizeLog2,
-            metaClearConstEqParam.metablockSizeLog2BitMask,
-            metaClearConstEqParam.combinedOffsetLowBits,
-            metaClearConstEqParam.combinedOffsetLowBitsMask,
-            // start cb0[2]
-            metaClearConstEqParam.metaBlockLsb,
-            metaClearConstEqParam.metaBlockLsbBitMask,
-            metaClearConstEqParam.metaBlockHighBitShift,
-            metaClearConstEqParam.combinedOffsetHighBitShift,
-            // start cb0[3]
-            metaBlockOffset,
-            mipChainPitchInMetaBlk,
-            mipSlicePitchInMetaBlk,
-        };
+            // Constant data
+            const uint32 constData[] =
+            {
+                // start cb0[0]
+                htileValue,
+                // start cb0[1]
+                metaClearConstEqParam.metablockSizeLog2,
+                metaClearConstEqParam.metablockSizeLog2BitMask,
+                metaClearConstEqParam.combinedOffsetLowBits,
+                metaClearConstEqParam.combinedOffsetLowBitsMask,
+                // start cb0[2]
+                metaClearConstEqParam.metaBlockLsb,
+                metaClearConstEqParam.metaBlockLsbBitMask,
+                metaClearConstEqParam.metaBlockHighBitShift,
+                metaClearConstEqParam.combinedOffsetHighBitShift,
+                // start cb0[3]
+                metaBlockOffset,
+                mipChainPitchInMetaBlk,
+                mipSlicePitchInMetaBlk,
+            };
 
-        // Create an embedded user-data table and bind it to user data 0.
-        const uint32  sizeConstDataDwords = NumBytesToNumDwords(sizeof(constData));
-        uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
-                                                                   SrdDwordAlignment() * 2 + sizeConstDataDwords,
-                                                                   SrdDwordAlignment(),
-                                                                   PipelineBindPoint::Compute,
-                                                                   0);
+            // Create an embedded user-data table and bind it to user data 0.
+            const uint32  sizeConstDataDwords = NumBytesToNumDwords(sizeof(constData));
+            uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
+                                                                       SrdDwordAlignment() * 2 + sizeConstDataDwords,
+                                                                       SrdDwordAlignment(),
+                                                                       PipelineBindPoint::Compute,
+                                                                       0);
 
-        // Supply the shader with a copy of our SRDs for the DCC buffer
-        memcpy(pSrdTable, &bufferSrds[0], sizeof(bufferSrds));
-        pSrdTable += Util::NumBytesToNumDwords(sizeof(bufferSrds));
+            // Supply the shader with a copy of our SRDs for the DCC buffer
+            memcpy(pSrdTable, &bufferSrds[0], sizeof(bufferSrds));
+            pSrdTable += Util::NumBytesToNumDwords(sizeof(bufferSrds));
 
-        // Pass to shader all kinds of Information realted to meta data equation
-        memcpy(pSrdTable, &constData[0], sizeof(constData));
+            // Pass to shader all kinds of Information realted to meta data equation
+            memcpy(pSrdTable, &constData[0], sizeof(constData));
 
-        uint32 numThreadGroupsX = 1;
-        uint32 numThreadGroupsY = 1;
-        uint32 numThreadGroupsZ = 1;
+            uint32 numThreadGroupsX = 1;
+            uint32 numThreadGroupsY = 1;
+            uint32 numThreadGroupsZ = 1;
 
-        if (metaThreadX != 0)
-        {
-            numThreadGroupsX = RpmUtil::MinThreadGroups(metaThreadX, threadsPerGroup[0]);
-            numThreadGroupsY = RpmUtil::MinThreadGroups(metaThreadY, threadsPerGroup[1]);
-            numThreadGroupsZ = RpmUtil::MinThreadGroups(metaThreadZ, threadsPerGroup[2]);
-        }
+            if (metaThreadX != 0)
+            {
+                numThreadGroupsX = RpmUtil::MinThreadGroups(metaThreadX, threadsPerGroup[0]);
+                numThreadGroupsY = RpmUtil::MinThreadGroups(metaThreadY, threadsPerGroup[1]);
+                numThreadGroupsZ = RpmUtil::MinThreadGroups(metaThreadZ, threadsPerGroup[2]);
+            }
 
-        pCmdBuffer->CmdDispatch(numThreadGroupsX, numThreadGroupsY, numThreadGroupsZ);
+            pCmdBuffer->CmdDispatch(numThreadGroupsX, numThreadGroupsY, numThreadGroupsZ);
+        }
     }
 }
 
@@ -3706,71 +3744,74 @@ void Gfx9RsrcProcMgr::ClearHtileSelectedBytes(
         // Bind the simple pipeline since all offsetbits are under metablock bits
         uint32 threadsPerGroup[3] = {};
 
-        const auto*const pPipeline = GetPipeline(RpmComputePipeline::Gfx9ClearHtileFast);
-
-        pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
-
-        // Bind Compute Pipeline used for the clear.
-        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
+        const auto*const pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::Gfx9ClearHtileFast);
 
-        // On GFX9, we create a single view of the hTile buffer that points to the base mip level.  It's
-        // up to the equation to "find" each mip level and slice from that base location.
-        BufferViewInfo hTileSurfBufferView = {};
-        pHtile->BuildSurfBufferView(dstImage, &hTileSurfBufferView);
-        // Make it Structured
-        hTileSurfBufferView.swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
-        hTileSurfBufferView.swizzledFormat.swizzle =
-           {ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W};
-        hTileSurfBufferView.stride = sizeof(uint32)* 4;
-
-        if (sliceStart > 0)
+        if (pPipeline != nullptr)
         {
-            uint32 metaOffsetInBytes = hTileAddrOutput.sliceSize * sliceStart;
-            hTileSurfBufferView.gpuAddr += metaOffsetInBytes;
-            PAL_ASSERT(hTileSurfBufferView.range > metaOffsetInBytes);
-            hTileSurfBufferView.range -= metaOffsetInBytes;
-        }
+            pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
+
+            // Bind Compute Pipeline used for the clear.
+            pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
+
+            // On GFX9, we create a single view of the hTile buffer that points to the base mip level.  It's
+            // up to the equation to "find" each mip level and slice from that base location.
+            BufferViewInfo hTileSurfBufferView = {};
+            pHtile->BuildSurfBufferView(dstImage, &hTileSurfBufferView);
+            // Make it Structured
+            hTileSurfBufferView.swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
+            hTileSurfBufferView.swizzledFormat.swizzle =
+               {ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W};
+            hTileSurfBufferView.stride = sizeof(uint32)* 4;
+
+            if (sliceStart > 0)
+            {
+                uint32 metaOffsetInBytes = hTileAddrOutput.sliceSize * sliceStart;
+                hTileSurfBufferView.gpuAddr += metaOffsetInBytes;
+                PAL_ASSERT(hTileSurfBufferView.range > metaOffsetInBytes);
+                hTileSurfBufferView.range -= metaOffsetInBytes;
+            }
 
-        PAL_ASSERT((hTileSurfBufferView.range & 0xf) == 0);
+            PAL_ASSERT((hTileSurfBufferView.range & 0xf) == 0);
 
-        uint32 clearBytes = hTileAddrOutput.sliceSize * numSlices;
-        // Divide by 16 since we clear 4 Dwords in each compute thread
-        uint32 metaThreadX = clearBytes >> 4;
+            uint32 clearBytes = hTileAddrOutput.sliceSize * numSlices;
+            // Divide by 16 since we clear 4 Dwords in each compute thread
+            uint32 metaThreadX = clearBytes >> 4;
 
-        // Create Buffer Srds (UAV in our case)
-        BufferSrd     bufferSrds[1] = {};
-        pDevice->CreateTypedBufferViewSrds(1, &hTileSurfBufferView, &bufferSrds[0]);
+            // Create Buffer Srds (UAV in our case)
+            BufferSrd     bufferSrds[1] = {};
+            pDevice->CreateTypedBufferViewSrds(1, &hTileSurfBufferView, &bufferSrds[0]);
 
-        // Constant data
-        const uint32 constData[] =
-        {
-            // start cb0[0]
-            htileValue & htileMask,
-            ~htileMask,
-        };
+            // Constant data
+            const uint32 constData[] =
+            {
+                // start cb0[0]
+                htileValue & htileMask,
+                ~htileMask,
+            };
 
-        // Create an embedded user-data table and bind it to user data 0.
-        const uint32  sizeConstDataDwords = NumBytesToNumDwords(sizeof(constData));
-        uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
-                                                                   SrdDwordAlignment() * 2 + sizeConstDataDwords,
-                                                                   SrdDwordAlignment(),
-                                                                   PipelineBindPoint::Compute,
-                                                                   0);
+            // Create an embedded user-data table and bind it to user data 0.
+            const uint32  sizeConstDataDwords = NumBytesToNumDwords(sizeof(constData));
+            uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
+                                                                       SrdDwordAlignment() * 2 + sizeConstDataDwords,
+                                                                       SrdDwordAlignment(),
+                                                                       PipelineBindPoint::Compute,
+                                                                       0);
 
-        // Supply the shader with a copy of our SRDs for the htile buffer
-        memcpy(pSrdTable, &bufferSrds[0], sizeof(bufferSrds));
-        pSrdTable += Util::NumBytesToNumDwords(sizeof(bufferSrds));
+            // Supply the shader with a copy of our SRDs for the htile buffer
+            memcpy(pSrdTable, &bufferSrds[0], sizeof(bufferSrds));
+            pSrdTable += Util::NumBytesToNumDwords(sizeof(bufferSrds));
 
-        // Pass to shader all kinds of Information realted to meta data equation
-        memcpy(pSrdTable, &constData[0], sizeof(constData));
+            // Pass to shader all kinds of Information realted to meta data equation
+            memcpy(pSrdTable, &constData[0], sizeof(constData));
 
-        uint32 numThreadGroupsX = 1;
-        if (metaThreadX != 0)
-        {
-            numThreadGroupsX = RpmUtil::MinThreadGroups(metaThreadX, threadsPerGroup[0]);
-        }
+            uint32 numThreadGroupsX = 1;
+            if (metaThreadX != 0)
+            {
+                numThreadGroupsX = RpmUtil::MinThreadGroups(metaThreadX, threadsPerGroup[0]);
+            }
 
-        pCmdBuffer->CmdDispatch(numThreadGroupsX, 1, 1);
+            pCmdBuffer->CmdDispatch(numThreadGroupsX, 1, 1);
+        }
     }
     else
     {
@@ -3779,126 +3820,129 @@ void Gfx9RsrcProcMgr::ClearHtileSelectedBytes(
 
         uint32        threadsPerGroup[3] = {};
 
-        const auto*const pPipeline = GetPipeline(RpmComputePipeline::Gfx9ClearHtileOptimized2d);
-
-        pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
-
-        // Bind Compute Pipeline used for the clear.
-        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
+        const auto*const pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::Gfx9ClearHtileOptimized2d);
 
-        // Create an SRD for the htile surface itself.  This is a constant across all mip-levels as it's the shaders
-        // job to calculate the proper address for each pixel of each mip level.
-        BufferViewInfo hTileSurfBufferView = {};
-        pHtile->BuildSurfBufferView(dstImage, &hTileSurfBufferView);
-        // Make it Structured
-        hTileSurfBufferView.swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
-        hTileSurfBufferView.swizzledFormat.swizzle =
-           {ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W};
-        hTileSurfBufferView.stride = sizeof(uint32)* 4;
-
-        uint32 metaBlockOffset = 0;
-        uint32 metaThreadX     = 0;
-        uint32 metaThreadY     = 1;
-        uint32 metaThreadZ     = 1;
-
-        uint32 mipChainPitchInMetaBlk  = 0;
-        uint32 mipChainHeightInMetaBlk = 0;
-        uint32 mipSlicePitchInMetaBlk  = 0;
-
-        if (createInfo.mipLevels == 1)
+        if (pPipeline != nullptr)
         {
-            // Check if we need to add any offset to our metablock address calculation
-            metaBlockOffset   = sliceStart * hTileAddrOutput.metaBlkNumPerSlice;
-            uint32 clearBytes = hTileAddrOutput.sliceSize * numSlices;
+            pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
+
+            // Bind Compute Pipeline used for the clear.
+            pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
+
+            // Create an SRD for the htile surface itself.  This is a constant across all mip-levels as it's the shaders
+            // job to calculate the proper address for each pixel of each mip level.
+            BufferViewInfo hTileSurfBufferView = {};
+            pHtile->BuildSurfBufferView(dstImage, &hTileSurfBufferView);
+            // Make it Structured
+            hTileSurfBufferView.swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
+            hTileSurfBufferView.swizzledFormat.swizzle =
+               {ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W};
+            hTileSurfBufferView.stride = sizeof(uint32)* 4;
+
+            uint32 metaBlockOffset = 0;
+            uint32 metaThreadX     = 0;
+            uint32 metaThreadY     = 1;
+            uint32 metaThreadZ     = 1;
+
+            uint32 mipChainPitchInMetaBlk  = 0;
+            uint32 mipChainHeightInMetaBlk = 0;
+            uint32 mipSlicePitchInMetaBlk  = 0;
+
+            if (createInfo.mipLevels == 1)
+            {
+                // Check if we need to add any offset to our metablock address calculation
+                metaBlockOffset   = sliceStart * hTileAddrOutput.metaBlkNumPerSlice;
+                uint32 clearBytes = hTileAddrOutput.sliceSize * numSlices;
 
-            // Divide by 16 since we clear 4 Dwords in each compute thread
-            metaThreadX = clearBytes >> 4;
-        }
-        else
-        {
-            // This path is not yet tested since Microbench doesn't expose it and neither does apps I tested
-            // But this is expected to work. So, for now just put an assert.
-            PAL_NOT_TESTED();
+                // Divide by 16 since we clear 4 Dwords in each compute thread
+                metaThreadX = clearBytes >> 4;
+            }
+            else
+            {
+                // This path is not yet tested since Microbench doesn't expose it and neither does apps I tested
+                // But this is expected to work. So, for now just put an assert.
+                PAL_NOT_TESTED();
 
-            mipChainPitchInMetaBlk  = hTileAddrOutput.pitch / hTileAddrOutput.metaBlkWidth;
-            mipChainHeightInMetaBlk = hTileAddrOutput.height / hTileAddrOutput.metaBlkHeight;
+                mipChainPitchInMetaBlk  = hTileAddrOutput.pitch / hTileAddrOutput.metaBlkWidth;
+                mipChainHeightInMetaBlk = hTileAddrOutput.height / hTileAddrOutput.metaBlkHeight;
 
-            PAL_ASSERT((mipChainPitchInMetaBlk * mipChainHeightInMetaBlk) == hTileAddrOutput.metaBlkNumPerSlice);
+                PAL_ASSERT((mipChainPitchInMetaBlk * mipChainHeightInMetaBlk) == hTileAddrOutput.metaBlkNumPerSlice);
 
-            const auto&   hTileMipInfo = pHtile->GetAddrMipInfo(range.startSubres.mipLevel);
+                const auto&   hTileMipInfo = pHtile->GetAddrMipInfo(range.startSubres.mipLevel);
 
-            uint32 mipStartZInBlk = hTileMipInfo.startZ;
-            uint32 mipStartYInBlk = hTileMipInfo.startY / hTileAddrOutput.metaBlkHeight;
-            uint32 mipStartXInBlk = hTileMipInfo.startX / hTileAddrOutput.metaBlkWidth;
+                uint32 mipStartZInBlk = hTileMipInfo.startZ;
+                uint32 mipStartYInBlk = hTileMipInfo.startY / hTileAddrOutput.metaBlkHeight;
+                uint32 mipStartXInBlk = hTileMipInfo.startX / hTileAddrOutput.metaBlkWidth;
 
-            metaBlockOffset = (mipStartZInBlk + sliceStart) * hTileAddrOutput.metaBlkNumPerSlice +
-                               mipStartYInBlk * mipChainPitchInMetaBlk +
-                               mipStartXInBlk;
+                metaBlockOffset = (mipStartZInBlk + sliceStart) * hTileAddrOutput.metaBlkNumPerSlice +
+                                   mipStartYInBlk * mipChainPitchInMetaBlk +
+                                   mipStartXInBlk;
 
-            mipSlicePitchInMetaBlk = mipChainPitchInMetaBlk * mipChainHeightInMetaBlk;
+                mipSlicePitchInMetaBlk = mipChainPitchInMetaBlk * mipChainHeightInMetaBlk;
 
-            uint32 metaBlkSize = hTileAddrOutput.sliceSize / hTileAddrOutput.metaBlkNumPerSlice;
+                uint32 metaBlkSize = hTileAddrOutput.sliceSize / hTileAddrOutput.metaBlkNumPerSlice;
 
-            metaThreadX = (hTileMipInfo.width / hTileAddrOutput.metaBlkWidth) * metaBlkSize >> 4;
-            metaThreadY = hTileMipInfo.height / hTileAddrOutput.metaBlkHeight;
-            metaThreadZ = numSlices;
-        }
+                metaThreadX = (hTileMipInfo.width / hTileAddrOutput.metaBlkWidth) * metaBlkSize >> 4;
+                metaThreadY = hTileMipInfo.height / hTileAddrOutput.metaBlkHeight;
+                metaThreadZ = numSlices;
+            }
 
-        PAL_ASSERT((hTileSurfBufferView.range & 0xf) == 0);
+            PAL_ASSERT((hTileSurfBufferView.range & 0xf) == 0);
 
-        // Create Buffer Srds (UAV in our case)
-        BufferSrd     bufferSrds[1] = {};
-        pDevice->CreateTypedBufferViewSrds(1, &hTileSurfBufferView, &bufferSrds[0]);
+            // Create Buffer Srds (UAV in our case)
+            BufferSrd     bufferSrds[1] = {};
+            pDevice->CreateTypedBufferViewSrds(1, &hTileSurfBufferView, &bufferSrds[0]);
 
-        // Constant data
-        const uint32 constData[] =
-        {
-            // start cb0[0]
-            htileValue & htileMask,
-            ~htileMask,
-            // start cb0[1]
-            metaClearConstEqParam.metablockSizeLog2,
-            metaClearConstEqParam.metablockSizeLog2BitMask,
-            metaClearConstEqParam.combinedOffsetLowBits,
-            metaClearConstEqParam.combinedOffsetLowBitsMask,
-            // start cb0[2]
-            metaClearConstEqParam.metaBlockLsb,
-            metaClearConstEqParam.metaBlockLsbBitMask,
-            metaClearConstEqParam.metaBlockHighBitShift,
-            metaClearConstEqParam.combinedOffsetHighBitShift,
-            // start cb0[3]
-            metaBlockOffset,
-            mipChainPitchInMetaBlk,
-            mipSlicePitchInMetaBlk,
-        };
+            // Constant data
+            const uint32 constData[] =
+            {
+                // start cb0[0]
+                htileValue & htileMask,
+                ~htileMask,
+                // start cb0[1]
+                metaClearConstEqParam.metablockSizeLog2,
+                metaClearConstEqParam.metablockSizeLog2BitMask,
+                metaClearConstEqParam.combinedOffsetLowBits,
+                metaClearConstEqParam.combinedOffsetLowBitsMask,
+                // start cb0[2]
+                metaClearConstEqParam.metaBlockLsb,
+                metaClearConstEqParam.metaBlockLsbBitMask,
+                metaClearConstEqParam.metaBlockHighBitShift,
+                metaClearConstEqParam.combinedOffsetHighBitShift,
+                // start cb0[3]
+                metaBlockOffset,
+                mipChainPitchInMetaBlk,
+                mipSlicePitchInMetaBlk,
+            };
 
-        // Create an embedded user-data table and bind it to user data 0.
-        const uint32  sizeConstDataDwords = NumBytesToNumDwords(sizeof(constData));
-        uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
-                                                                   SrdDwordAlignment() * 2 + sizeConstDataDwords,
-                                                                   SrdDwordAlignment(),
-                                                                   PipelineBindPoint::Compute,
-                                                                   0);
+            // Create an embedded user-data table and bind it to user data 0.
+            const uint32  sizeConstDataDwords = NumBytesToNumDwords(sizeof(constData));
+            uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
+                                                                       SrdDwordAlignment() * 2 + sizeConstDataDwords,
+                                                                       SrdDwordAlignment(),
+                                                                       PipelineBindPoint::Compute,
+                                                                       0);
 
-        // Supply the shader with a copy of our SRDs for the DCC buffer
-        memcpy(pSrdTable, &bufferSrds[0], sizeof(bufferSrds));
-        pSrdTable += Util::NumBytesToNumDwords(sizeof(bufferSrds));
+            // Supply the shader with a copy of our SRDs for the DCC buffer
+            memcpy(pSrdTable, &bufferSrds[0], sizeof(bufferSrds));
+            pSrdTable += Util::NumBytesToNumDwords(sizeof(bufferSrds));
 
-        // Pass to shader all kinds of Information realted to meta data equation
-        memcpy(pSrdTable, &constData[0], sizeof(constData));
+            // Pass to shader all kinds of Information realted to meta data equation
+            memcpy(pSrdTable, &constData[0], sizeof(constData));
 
-        uint32 numThreadGroupsX = 1;
-        uint32 numThreadGroupsY = 1;
-        uint32 numThreadGroupsZ = 1;
+            uint32 numThreadGroupsX = 1;
+            uint32 numThreadGroupsY = 1;
+            uint32 numThreadGroupsZ = 1;
 
-        if (metaThreadX != 0)
-        {
-            numThreadGroupsX = RpmUtil::MinThreadGroups(metaThreadX, threadsPerGroup[0]);
-            numThreadGroupsY = RpmUtil::MinThreadGroups(metaThreadY, threadsPerGroup[1]);
-            numThreadGroupsZ = RpmUtil::MinThreadGroups(metaThreadZ, threadsPerGroup[2]);
-        }
+            if (metaThreadX != 0)
+            {
+                numThreadGroupsX = RpmUtil::MinThreadGroups(metaThreadX, threadsPerGroup[0]);
+                numThreadGroupsY = RpmUtil::MinThreadGroups(metaThreadY, threadsPerGroup[1]);
+                numThreadGroupsZ = RpmUtil::MinThreadGroups(metaThreadZ, threadsPerGroup[2]);
+            }
 
-        pCmdBuffer->CmdDispatch(numThreadGroupsX, numThreadGroupsY, numThreadGroupsZ);
+            pCmdBuffer->CmdDispatch(numThreadGroupsX, numThreadGroupsY, numThreadGroupsZ);
+        }
     }
 }
 
@@ -3935,107 +3979,110 @@ void Gfx9RsrcProcMgr::DoFastClear(
                                           : ((effectiveSamples > 1) ? RpmComputePipeline::Gfx9ClearDccMultiSample2d
                                           : RpmComputePipeline::Gfx9ClearDccSingleSample2d));
 
-    const auto*const pPipeline    = GetPipeline(pipeline);
+    const auto*const pPipeline    = GetPipeline(pCmdBuffer, pipeline);
     const uint32     pipeBankXor  = pDcc->CalcPipeXorMask(dstImage, clearRange.startSubres.aspect);
 
-    BufferSrd     bufferSrds[2] = {};
-    uint32        xInc = 0;
-    uint32        yInc = 0;
-    uint32        zInc = 0;
-    pDcc->GetXyzInc(dstImage, &xInc, &yInc, &zInc);
-
-    uint32        threadsPerGroup[3] = {};
-    pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
-
-    // Bind Compute Pipeline used for the clear.
-    pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
-
-    // Create an SRD for the DCC surface itself.  This is a constant across all mip-levels as it's the shaders
-    // job to calculate the proper address for each pixel of each mip level.
-    BufferViewInfo bufferViewDccSurf = {};
-    pDcc->BuildSurfBufferView(dstImage, &bufferViewDccSurf);
-    pDevice->CreateUntypedBufferViewSrds(1, &bufferViewDccSurf, &bufferSrds[0]);
-
-    // Create an SRD for the DCC equation.  Again, this is a constant as there is only one equation
-    BufferViewInfo bufferViewDccEq = {};
-    pDcc->BuildEqBufferView(dstImage, &bufferViewDccEq);
-    pDevice->CreateUntypedBufferViewSrds(1, &bufferViewDccEq, &bufferSrds[1]);
-
-    // Clear each mip level invidually.  Create a constant buffer so the compute shader knows the
-    // dimensions and location of each mip level.
-    const uint32 lastMip = clearRange.startSubres.mipLevel + clearRange.numMips - 1;
-    for (uint32 mipLevel = clearRange.startSubres.mipLevel; mipLevel <= lastMip; ++mipLevel)
+    if (pPipeline != nullptr)
     {
-        const SubresId  subResId       = { ImageAspect::Color, mipLevel, 0 };
-        const auto*     pSubResInfo    = pPalImage->SubresourceInfo(subResId);
-        const auto&     dccMipInfo     = pDcc->GetAddrMipInfo(mipLevel);
-        const uint32    mipLevelHeight = pSubResInfo->extentTexels.height;
-        const uint32    mipLevelWidth  = pSubResInfo->extentTexels.width;
-        const uint32    depthToClear   = GetClearDepth(dstImage, clearRange, mipLevel);
-
-        const uint32 constData[] =
-        {
-            // start cb0[0]
-            dccMipInfo.startX,
-            dccMipInfo.startY,
-            firstSlice,
-            clearCode,
-            // start cb0[1]
-            log2MetaBlkWidth,
-            log2MetaBlkHeight,
-            Log2(dccAddrOutput.metaBlkDepth),
-            dccAddrOutput.pitch >> log2MetaBlkWidth,
-            // start cb0[2]
-            mipLevelWidth,
-            mipLevelHeight,
-            depthToClear,
-            sliceSize,
-            // start cb0[3]
-            Log2(xInc),
-            Log2(yInc),
-            Log2(zInc),
-            // start cb0[4]
-            pipeBankXor,
-            effectiveSamples
-        };
+        BufferSrd     bufferSrds[2] = {};
+        uint32        xInc = 0;
+        uint32        yInc = 0;
+        uint32        zInc = 0;
+        pDcc->GetXyzInc(dstImage, &xInc, &yInc, &zInc);
 
-        // Create an embedded user-data table and bind it to user data 0.
-        const uint32  sizeConstDataDwords = NumBytesToNumDwords(sizeof(constData));
-        uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
-                                                                   SrdDwordAlignment() * 2 + sizeConstDataDwords,
-                                                                   SrdDwordAlignment(),
-                                                                   PipelineBindPoint::Compute,
-                                                                   0);
+        uint32        threadsPerGroup[3] = {};
+        pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
 
-        // Supply the shader with a copy of our SRDs for the DCC buffer and DCC equation
-        memcpy(pSrdTable, &bufferSrds[0], sizeof(bufferSrds));
-        pSrdTable += Util::NumBytesToNumDwords(sizeof(bufferSrds));
+        // Bind Compute Pipeline used for the clear.
+        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
 
-        // And give the shader all kinds of useful dimension info
-        memcpy(pSrdTable, &constData[0], sizeof(constData));
+        // Create an SRD for the DCC surface itself.  This is a constant across all mip-levels as it's the shaders
+        // job to calculate the proper address for each pixel of each mip level.
+        BufferViewInfo bufferViewDccSurf = {};
+        pDcc->BuildSurfBufferView(dstImage, &bufferViewDccSurf);
+        pDevice->CreateUntypedBufferViewSrds(1, &bufferViewDccSurf, &bufferSrds[0]);
 
-        MetaDataDispatch(pCmdBuffer,
-                         dstImage,
-                         pDcc,
-                         mipLevelWidth,
-                         mipLevelHeight,
-                         depthToClear,
-                         threadsPerGroup);
-    }
-}
+        // Create an SRD for the DCC equation.  Again, this is a constant as there is only one equation
+        BufferViewInfo bufferViewDccEq = {};
+        pDcc->BuildEqBufferView(dstImage, &bufferViewDccEq);
+        pDevice->CreateUntypedBufferViewSrds(1, &bufferViewDccEq, &bufferSrds[1]);
 
-// ====================================================================================================================
-// Executes a compute shader for initializing cmask. The cmask memory is cleared with initialValue in an optimized
-// way. This path is best for performance.
-void Gfx9RsrcProcMgr::DoOptimizedCmaskInit(
-    GfxCmdBuffer*      pCmdBuffer,
-    Pal::CmdStream*    pCmdStream,
-    const Image&       image,
-    const SubresRange& range,
-    uint8              initValue
-    ) const
-{
-    const Pal::Image*      pPalImage       = image.Parent();
+        // Clear each mip level invidually.  Create a constant buffer so the compute shader knows the
+        // dimensions and location of each mip level.
+        const uint32 lastMip = clearRange.startSubres.mipLevel + clearRange.numMips - 1;
+        for (uint32 mipLevel = clearRange.startSubres.mipLevel; mipLevel <= lastMip; ++mipLevel)
+        {
+            const SubresId  subResId       = { ImageAspect::Color, mipLevel, 0 };
+            const auto*     pSubResInfo    = pPalImage->SubresourceInfo(subResId);
+            const auto&     dccMipInfo     = pDcc->GetAddrMipInfo(mipLevel);
+            const uint32    mipLevelHeight = pSubResInfo->extentTexels.height;
+            const uint32    mipLevelWidth  = pSubResInfo->extentTexels.width;
+            const uint32    depthToClear   = GetClearDepth(dstImage, clearRange, mipLevel);
+
+            const uint32 constData[] =
+            {
+                // start cb0[0]
+                dccMipInfo.startX,
+                dccMipInfo.startY,
+                firstSlice,
+                clearCode,
+                // start cb0[1]
+                log2MetaBlkWidth,
+                log2MetaBlkHeight,
+                Log2(dccAddrOutput.metaBlkDepth),
+                dccAddrOutput.pitch >> log2MetaBlkWidth,
+                // start cb0[2]
+                mipLevelWidth,
+                mipLevelHeight,
+                depthToClear,
+                sliceSize,
+                // start cb0[3]
+                Log2(xInc),
+                Log2(yInc),
+                Log2(zInc),
+                // start cb0[4]
+                pipeBankXor,
+                effectiveSamples
+            };
+
+            // Create an embedded user-data table and bind it to user data 0.
+            const uint32  sizeConstDataDwords = NumBytesToNumDwords(sizeof(constData));
+            uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
+                                                                       SrdDwordAlignment() * 2 + sizeConstDataDwords,
+                                                                       SrdDwordAlignment(),
+                                                                       PipelineBindPoint::Compute,
+                                                                       0);
+
+            // Supply the shader with a copy of our SRDs for the DCC buffer and DCC equation
+            memcpy(pSrdTable, &bufferSrds[0], sizeof(bufferSrds));
+            pSrdTable += Util::NumBytesToNumDwords(sizeof(bufferSrds));
+
+            // And give the shader all kinds of useful dimension info
+            memcpy(pSrdTable, &constData[0], sizeof(constData));
+
+            MetaDataDispatch(pCmdBuffer,
+                             dstImage,
+                             pDcc,
+                             mipLevelWidth,
+                             mipLevelHeight,
+                             depthToClear,
+                             threadsPerGroup);
+        }
+    }
+}
+
+// ====================================================================================================================
+// Executes a compute shader for initializing cmask. The cmask memory is cleared with initialValue in an optimized
+// way. This path is best for performance.
+void Gfx9RsrcProcMgr::DoOptimizedCmaskInit(
+    GfxCmdBuffer*      pCmdBuffer,
+    Pal::CmdStream*    pCmdStream,
+    const Image&       image,
+    const SubresRange& range,
+    uint8              initValue
+    ) const
+{
+    const Pal::Image*      pPalImage       = image.Parent();
     const Pal::Device*     pDevice         = pPalImage->GetDevice();
     const Gfx9PalSettings& settings        = GetGfx9Settings(*pDevice);
     const auto&            createInfo      = pPalImage->GetImageCreateInfo();
@@ -4060,68 +4107,72 @@ void Gfx9RsrcProcMgr::DoOptimizedCmaskInit(
     {
         // Bind the GFX9 Fill 4x4 Dword pipeline
         uint32 threadsPerGroup[3] = {};
-        const auto*const pPipeline = GetPipeline(RpmComputePipeline::Gfx9Fill4x4Dword);
-        pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
-
-        // Bind Compute Pipeline used for the clear.
-        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
+        const auto*const pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::Gfx9Fill4x4Dword);
 
-        // Create an SRD for the cmask surface itself.  This is a constant across all mip-levels as it's the shaders
-        // job to calculate the proper address for each pixel of each mip level.
-        BufferViewInfo bufferViewCmaskSurf = {};
-        pCmask->BuildSurfBufferView(image, &bufferViewCmaskSurf);
-        // Make it Structured
-        bufferViewCmaskSurf.swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
-        bufferViewCmaskSurf.swizzledFormat.swizzle =
-           {ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W};
-        bufferViewCmaskSurf.stride = sizeof(uint32) * 4;
-
-        if (sliceStart > 0)
+        if (pPipeline != nullptr)
         {
-            uint32 metaOffsetInBytes     = cmaskAddrOutput.sliceSize * sliceStart;
-            bufferViewCmaskSurf.gpuAddr += metaOffsetInBytes;
-            PAL_ASSERT(bufferViewCmaskSurf.range > metaOffsetInBytes);
-            bufferViewCmaskSurf.range   -= metaOffsetInBytes;
-        }
+            pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
+
+            // Bind Compute Pipeline used for the clear.
+            pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
+
+            // Create an SRD for the cmask surface itself.  This is a constant across all mip-levels as it's the shaders
+            // job to calculate the proper address for each pixel of each mip level.
+            BufferViewInfo bufferViewCmaskSurf = {};
+            pCmask->BuildSurfBufferView(image, &bufferViewCmaskSurf);
+            // Make it Structured
+            bufferViewCmaskSurf.swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
+            bufferViewCmaskSurf.swizzledFormat.swizzle =
+               {ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W};
+            bufferViewCmaskSurf.stride = sizeof(uint32) * 4;
+
+            if (sliceStart > 0)
+            {
+                uint32 metaOffsetInBytes     = cmaskAddrOutput.sliceSize * sliceStart;
+                bufferViewCmaskSurf.gpuAddr += metaOffsetInBytes;
+                PAL_ASSERT(bufferViewCmaskSurf.range > metaOffsetInBytes);
+                bufferViewCmaskSurf.range   -= metaOffsetInBytes;
+            }
 
-        PAL_ASSERT((bufferViewCmaskSurf.range & 0xf) == 0);
+            PAL_ASSERT((bufferViewCmaskSurf.range & 0xf) == 0);
 
-        uint32 clearBytes  = cmaskAddrOutput.sliceSize * numSlices;
-        // Divide by 16 since we clear 4 Dwords in each compute thread
-        uint32 metaThreadX = clearBytes >> 4;
+            uint32 clearBytes  = cmaskAddrOutput.sliceSize * numSlices;
+            // Divide by 16 since we clear 4 Dwords in each compute thread
+            uint32 metaThreadX = clearBytes >> 4;
 
-        // Create Buffer Srds (UAV in our case)
-        BufferSrd     bufferSrds[1] = {};
-        pDevice->CreateTypedBufferViewSrds(1, &bufferViewCmaskSurf, &bufferSrds[0]);
+            // Create Buffer Srds (UAV in our case)
+            BufferSrd     bufferSrds[1] = {};
+            pDevice->CreateTypedBufferViewSrds(1, &bufferViewCmaskSurf, &bufferSrds[0]);
 
-        // Constant data
-        const uint32 constData[] =
-        {
-            // start cb0[0]
-            clearColor,
-        };
+            // Constant data
+            const uint32 constData[] =
+            {
+                // start cb0[0]
+                clearColor,
+            };
 
-        // Create an embedded user-data table and bind it to user data 0.
-        const uint32  sizeConstDataDwords = NumBytesToNumDwords(sizeof(constData));
-        uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
-                                                                   SrdDwordAlignment() * 2 + sizeConstDataDwords,
-                                                                   SrdDwordAlignment(),
-                                                                   PipelineBindPoint::Compute,
-                                                                   0);
+            // Create an embedded user-data table and bind it to user data 0.
+            const uint32  sizeConstDataDwords = NumBytesToNumDwords(sizeof(constData));
+            uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
+                                                                       SrdDwordAlignment() * 2 + sizeConstDataDwords,
+                                                                       SrdDwordAlignment(),
+                                                                       PipelineBindPoint::Compute,
+                                                                       0);
 
-        // Supply the shader with a copy of our SRDs for the cmask buffer
-        memcpy(pSrdTable, &bufferSrds[0], sizeof(bufferSrds));
-        pSrdTable += Util::NumBytesToNumDwords(sizeof(bufferSrds));
+            // Supply the shader with a copy of our SRDs for the cmask buffer
+            memcpy(pSrdTable, &bufferSrds[0], sizeof(bufferSrds));
+            pSrdTable += Util::NumBytesToNumDwords(sizeof(bufferSrds));
 
-        // Pass to shader all kinds of Information related to meta data equation
-        memcpy(pSrdTable, &constData[0], sizeof(constData));
+            // Pass to shader all kinds of Information related to meta data equation
+            memcpy(pSrdTable, &constData[0], sizeof(constData));
 
-        uint32 numThreadGroupsX = 1;
-        if (metaThreadX != 0)
-        {
-            numThreadGroupsX = RpmUtil::MinThreadGroups(metaThreadX, threadsPerGroup[0]);
+            uint32 numThreadGroupsX = 1;
+            if (metaThreadX != 0)
+            {
+                numThreadGroupsX = RpmUtil::MinThreadGroups(metaThreadX, threadsPerGroup[0]);
+            }
+            pCmdBuffer->CmdDispatch(numThreadGroupsX, 1, 1);
         }
-        pCmdBuffer->CmdDispatch(numThreadGroupsX, 1, 1);
     }
     else
     {
@@ -4130,78 +4181,82 @@ void Gfx9RsrcProcMgr::DoOptimizedCmaskInit(
 
         // Bind the Optimized DCC Pipeline which writes 4 Dwords to destination memory
         uint32  threadsPerGroup[3] = {};
-        const auto*const pPipeline = GetPipeline(RpmComputePipeline::Gfx9ClearDccOptimized2d);
-        pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
-
-        // Bind Compute Pipeline used for the clear.
-        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
+        const auto*const pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::Gfx9ClearDccOptimized2d);
 
-        // Create an SRD for the cmask surface itself.  This is a constant across all mip-levels as it's the shaders
-        // job to calculate the proper address for each pixel of each mip level.
-        BufferViewInfo bufferViewCmaskSurf = {};
-        pCmask->BuildSurfBufferView(image, &bufferViewCmaskSurf);
-        // Make it Structured
-        bufferViewCmaskSurf.swizzledFormat.format  = Pal::ChNumFormat::X32Y32Z32W32_Uint;
-        bufferViewCmaskSurf.swizzledFormat.swizzle =
-            {ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W};
-        bufferViewCmaskSurf.stride = sizeof(uint32) * 4;
-
-        // Check if we need to add any offset to our metablock address calculation
-        uint32 metaBlockOffset = sliceStart * cmaskAddrOutput.metaBlkNumPerSlice;
-        uint32 clearBytes      = cmaskAddrOutput.sliceSize * numSlices;
-        // Divide by 16 since we clear 4 Dwords in each compute thread
-        uint32 metaThreadX     = clearBytes >> 4;
-
-        PAL_ASSERT((bufferViewCmaskSurf.range & 0xf) == 0);
-
-        // Create Buffer Srds (UAV in our case)
-        BufferSrd     bufferSrds[1] = {};
-        pDevice->CreateTypedBufferViewSrds(1, &bufferViewCmaskSurf, &bufferSrds[0]);
-
-        // Constant data
-        const uint32 constData[] =
+        if (pPipeline != nullptr)
         {
-            // start cb0[0]
-            clearColor,
-            // start cb0[1]
-            metaClearConstEqParam.metablockSizeLog2,
-            metaClearConstEqParam.metablockSizeLog2BitMask,
-            metaClearConstEqParam.combinedOffsetLowBits,
-            metaClearConstEqParam.combinedOffsetLowBitsMask,
-            // start cb0[2]
-            metaClearConstEqParam.metaBlockLsb,
-            metaClearConstEqParam.metaBlockLsbBitMask,
-            metaClearConstEqParam.metaBlockHighBitShift,
-            metaClearConstEqParam.combinedOffsetHighBitShift,
-            // start cb0[3]
-            metaBlockOffset,
-            0,
-            0,
-        };
+            pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
 
-        // Create an embedded user-data table and bind it to user data 0.
-        const uint32  sizeConstDataDwords = NumBytesToNumDwords(sizeof(constData));
-        uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
-                                                                   SrdDwordAlignment() * 2 + sizeConstDataDwords,
-                                                                   SrdDwordAlignment(),
-                                                                   PipelineBindPoint::Compute,
-                                                                   0);
+            // Bind Compute Pipeline used for the clear.
+            pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
 
-        // Supply the shader with a copy of our SRDs for the DCC buffer
-        memcpy(pSrdTable, &bufferSrds[0], sizeof(bufferSrds));
-        pSrdTable += Util::NumBytesToNumDwords(sizeof(bufferSrds));
+            // Create an SRD for the cmask surface itself.  This is a constant across all mip-levels as it's the shaders
+            // job to calculate the proper address for each pixel of each mip level.
+            BufferViewInfo bufferViewCmaskSurf = {};
+            pCmask->BuildSurfBufferView(image, &bufferViewCmaskSurf);
+            // Make it Structured
+            bufferViewCmaskSurf.swizzledFormat.format  = Pal::ChNumFormat::X32Y32Z32W32_Uint;
+            bufferViewCmaskSurf.swizzledFormat.swizzle =
+                {ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W};
+            bufferViewCmaskSurf.stride = sizeof(uint32) * 4;
 
-        // Pass to shader all kinds of Information realted to meta data equation
-        memcpy(pSrdTable, &constData[0], sizeof(constData));
+            // Check if we need to add any offset to our metablock address calculation
+            uint32 metaBlockOffset = sliceStart * cmaskAddrOutput.metaBlkNumPerSlice;
+            uint32 clearBytes      = cmaskAddrOutput.sliceSize * numSlices;
+            // Divide by 16 since we clear 4 Dwords in each compute thread
+            uint32 metaThreadX     = clearBytes >> 4;
 
-        uint32 numThreadGroupsX = 1;
+            PAL_ASSERT((bufferViewCmaskSurf.range & 0xf) == 0);
 
-        if (metaThreadX != 0)
-        {
-            numThreadGroupsX = RpmUtil::MinThreadGroups(metaThreadX, threadsPerGroup[0]);
-        }
+            // Create Buffer Srds (UAV in our case)
+            BufferSrd     bufferSrds[1] = {};
+            pDevice->CreateTypedBufferViewSrds(1, &bufferViewCmaskSurf, &bufferSrds[0]);
+
+            // Constant data
+            const uint32 constData[] =
+            {
+                // start cb0[0]
+                clearColor,
+                // start cb0[1]
+                metaClearConstEqParam.metablockSizeLog2,
+                metaClearConstEqParam.metablockSizeLog2BitMask,
+                metaClearConstEqParam.combinedOffsetLowBits,
+                metaClearConstEqParam.combinedOffsetLowBitsMask,
+                // start cb0[2]
+                metaClearConstEqParam.metaBlockLsb,
+                metaClearConstEqParam.metaBlockLsbBitMask,
+                metaClearConstEqParam.metaBlockHighBitShift,
+                metaClearConstEqParam.combinedOffsetHighBitShift,
+                // start cb0[3]
+                metaBlockOffset,
+                0,
+                0,
+            };
+
+            // Create an embedded user-data table and bind it to user data 0.
+            const uint32  sizeConstDataDwords = NumBytesToNumDwords(sizeof(constData));
+            uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
+                                                                       SrdDwordAlignment() * 2 + sizeConstDataDwords,
+                                                                       SrdDwordAlignment(),
+                                                                       PipelineBindPoint::Compute,
+                                                                       0);
+
+            // Supply the shader with a copy of our SRDs for the DCC buffer
+            memcpy(pSrdTable, &bufferSrds[0], sizeof(bufferSrds));
+            pSrdTable += Util::NumBytesToNumDwords(sizeof(bufferSrds));
+
+            // Pass to shader all kinds of Information realted to meta data equation
+            memcpy(pSrdTable, &constData[0], sizeof(constData));
+
+            uint32 numThreadGroupsX = 1;
 
-        pCmdBuffer->CmdDispatch(numThreadGroupsX, 1, 1);
+            if (metaThreadX != 0)
+            {
+                numThreadGroupsX = RpmUtil::MinThreadGroups(metaThreadX, threadsPerGroup[0]);
+            }
+
+            pCmdBuffer->CmdDispatch(numThreadGroupsX, 1, 1);
+        }
     }
 }
 
@@ -4249,68 +4304,72 @@ void Gfx9RsrcProcMgr::DoOptimizedFastClear(
     {
         // Bind the GFX9 Fill 4x4 Dword pipeline
         uint32 threadsPerGroup[3]  = {};
-        const auto*const pPipeline = GetPipeline(RpmComputePipeline::Gfx9Fill4x4Dword);
-        pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
+        const auto*const pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::Gfx9Fill4x4Dword);
 
-        // Bind Compute Pipeline used for the clear.
-        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
-
-        // Create an SRD for the DCC surface itself.  This is a constant across all mip-levels as it's the shaders
-        // job to calculate the proper address for each pixel of each mip level.
-        BufferViewInfo bufferViewDccSurf = {};
-        pDcc->BuildSurfBufferView(dstImage, &bufferViewDccSurf);
-        // Make it Structured
-        bufferViewDccSurf.swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
-        bufferViewDccSurf.swizzledFormat.swizzle =
-           {ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W};
-        bufferViewDccSurf.stride = sizeof(uint32) * 4;
-
-        if (sliceStart > 0)
+        if (pPipeline != nullptr)
         {
-            uint32 metaOffsetInBytes = dccAddrOutput.fastClearSizePerSlice * sliceStart;
-            bufferViewDccSurf.gpuAddr += metaOffsetInBytes;
-            PAL_ASSERT(bufferViewDccSurf.range > metaOffsetInBytes);
-            bufferViewDccSurf.range   -= metaOffsetInBytes;
-        }
+            pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
+
+            // Bind Compute Pipeline used for the clear.
+            pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
+
+            // Create an SRD for the DCC surface itself.  This is a constant across all mip-levels as it's the shaders
+            // job to calculate the proper address for each pixel of each mip level.
+            BufferViewInfo bufferViewDccSurf = {};
+            pDcc->BuildSurfBufferView(dstImage, &bufferViewDccSurf);
+            // Make it Structured
+            bufferViewDccSurf.swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
+            bufferViewDccSurf.swizzledFormat.swizzle =
+               {ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W};
+            bufferViewDccSurf.stride = sizeof(uint32) * 4;
+
+            if (sliceStart > 0)
+            {
+                uint32 metaOffsetInBytes = dccAddrOutput.fastClearSizePerSlice * sliceStart;
+                bufferViewDccSurf.gpuAddr += metaOffsetInBytes;
+                PAL_ASSERT(bufferViewDccSurf.range > metaOffsetInBytes);
+                bufferViewDccSurf.range   -= metaOffsetInBytes;
+            }
 
-        PAL_ASSERT((bufferViewDccSurf.range & 0xf) == 0);
+            PAL_ASSERT((bufferViewDccSurf.range & 0xf) == 0);
 
-        uint32 clearBytes = dccAddrOutput.fastClearSizePerSlice * numSlices;
-        // Divide by 16 since we clear 4 Dwords in each compute thread
-        uint32 metaThreadX = clearBytes >> 4;
+            uint32 clearBytes = dccAddrOutput.fastClearSizePerSlice * numSlices;
+            // Divide by 16 since we clear 4 Dwords in each compute thread
+            uint32 metaThreadX = clearBytes >> 4;
 
-        // Create Buffer Srds (UAV in our case)
-        BufferSrd     bufferSrds[1] = {};
-        pDevice->CreateTypedBufferViewSrds(1, &bufferViewDccSurf, &bufferSrds[0]);
+            // Create Buffer Srds (UAV in our case)
+            BufferSrd     bufferSrds[1] = {};
+            pDevice->CreateTypedBufferViewSrds(1, &bufferViewDccSurf, &bufferSrds[0]);
 
-        // Constant data
-        const uint32 constData[] =
-        {
-            // start cb0[0]
-            clearColor,
-        };
+            // Constant data
+            const uint32 constData[] =
+            {
+                // start cb0[0]
+                clearColor,
+            };
 
-        // Create an embedded user-data table and bind it to user data 0.
-        const uint32  sizeConstDataDwords = NumBytesToNumDwords(sizeof(constData));
-        uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
-                                                                   SrdDwordAlignment() * 2 + sizeConstDataDwords,
-                                                                   SrdDwordAlignment(),
-                                                                   PipelineBindPoint::Compute,
-                                                                   0);
+            // Create an embedded user-data table and bind it to user data 0.
+            const uint32  sizeConstDataDwords = NumBytesToNumDwords(sizeof(constData));
+            uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
+                                                                       SrdDwordAlignment() * 2 + sizeConstDataDwords,
+                                                                       SrdDwordAlignment(),
+                                                                       PipelineBindPoint::Compute,
+                                                                       0);
 
-        // Supply the shader with a copy of our SRDs for the dcc buffer
-        memcpy(pSrdTable, &bufferSrds[0], sizeof(bufferSrds));
-        pSrdTable += Util::NumBytesToNumDwords(sizeof(bufferSrds));
+            // Supply the shader with a copy of our SRDs for the dcc buffer
+            memcpy(pSrdTable, &bufferSrds[0], sizeof(bufferSrds));
+            pSrdTable += Util::NumBytesToNumDwords(sizeof(bufferSrds));
 
-        // Pass to shader all kinds of Information related to meta data equation
-        memcpy(pSrdTable, &constData[0], sizeof(constData));
+            // Pass to shader all kinds of Information related to meta data equation
+            memcpy(pSrdTable, &constData[0], sizeof(constData));
 
-        uint32 numThreadGroupsX = 1;
-        if (metaThreadX != 0)
-        {
-            numThreadGroupsX = RpmUtil::MinThreadGroups(metaThreadX, threadsPerGroup[0]);
+            uint32 numThreadGroupsX = 1;
+            if (metaThreadX != 0)
+            {
+                numThreadGroupsX = RpmUtil::MinThreadGroups(metaThreadX, threadsPerGroup[0]);
+            }
+            pCmdBuffer->CmdDispatch(numThreadGroupsX, 1, 1);
         }
-        pCmdBuffer->CmdDispatch(numThreadGroupsX, 1, 1);
     }
     else
     {
@@ -4319,120 +4378,124 @@ void Gfx9RsrcProcMgr::DoOptimizedFastClear(
 
         // Bind the Optimized DCC Pipeline
         uint32  threadsPerGroup[3] = {};
-        const auto*const pPipeline = GetPipeline(RpmComputePipeline::Gfx9ClearDccOptimized2d);
-        pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
-
-        // Bind Compute Pipeline used for the clear.
-        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
+        const auto*const pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::Gfx9ClearDccOptimized2d);
 
-        // Create an SRD for the DCC surface itself.  This is a constant across all mip-levels as it's the shaders
-        // job to calculate the proper address for each pixel of each mip level.
-        BufferViewInfo bufferViewDccSurf = {};
-        pDcc->BuildSurfBufferView(dstImage, &bufferViewDccSurf);
-        // Make it Structured
-        bufferViewDccSurf.swizzledFormat.format = Pal::ChNumFormat::X32Y32Z32W32_Uint;
-        bufferViewDccSurf.swizzledFormat.swizzle =
-           {ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W};
-        bufferViewDccSurf.stride = sizeof(uint32)* 4;
-
-        uint32 metaBlockOffset = 0;
-        uint32 metaThreadX     = 0;
-        uint32 metaThreadY     = 1;
-        uint32 metaThreadZ     = 1;
-
-        uint32 mipChainPitchInMetaBlk  = 0;
-        uint32 mipChainHeightInMetaBlk = 0;
-        uint32 mipSlicePitchInMetaBlk  = 0;
-
-        if (createInfo.mipLevels == 1)
+        if (pPipeline != nullptr)
         {
-            // Check if we need to add any offset to our metablock address calculation
-            metaBlockOffset   = sliceStart * dccAddrOutput.metaBlkNumPerSlice;
-            uint32 clearBytes = dccAddrOutput.fastClearSizePerSlice * numSlices;
+            pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
+
+            // Bind Compute Pipeline used for the clear.
+            pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
+
+            // Create an SRD for the DCC surface itself.  This is a constant across all mip-levels as it's the shaders
+            // job to calculate the proper address for each pixel of each mip level.
+            BufferViewInfo bufferViewDccSurf = {};
+            pDcc->BuildSurfBufferView(dstImage, &bufferViewDccSurf);
+            // Make it Structured
+            bufferViewDccSurf.swizzledFormat.format = Pal::ChNumFormat::X32Y32Z32W32_Uint;
+            bufferViewDccSurf.swizzledFormat.swizzle =
+               {ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W};
+            bufferViewDccSurf.stride = sizeof(uint32)* 4;
+
+            uint32 metaBlockOffset = 0;
+            uint32 metaThreadX     = 0;
+            uint32 metaThreadY     = 1;
+            uint32 metaThreadZ     = 1;
+
+            uint32 mipChainPitchInMetaBlk  = 0;
+            uint32 mipChainHeightInMetaBlk = 0;
+            uint32 mipSlicePitchInMetaBlk  = 0;
+
+            if (createInfo.mipLevels == 1)
+            {
+                // Check if we need to add any offset to our metablock address calculation
+                metaBlockOffset   = sliceStart * dccAddrOutput.metaBlkNumPerSlice;
+                uint32 clearBytes = dccAddrOutput.fastClearSizePerSlice * numSlices;
 
-            // Divide by 16 since we clear 4 Dwords in each compute thread
-            metaThreadX = clearBytes >> 4;
-        }
-        else
-        {
-            mipChainPitchInMetaBlk  = dccAddrOutput.pitch / dccAddrOutput.metaBlkWidth;
-            mipChainHeightInMetaBlk = dccAddrOutput.height / dccAddrOutput.metaBlkHeight;
+                // Divide by 16 since we clear 4 Dwords in each compute thread
+                metaThreadX = clearBytes >> 4;
+            }
+            else
+            {
+                mipChainPitchInMetaBlk  = dccAddrOutput.pitch / dccAddrOutput.metaBlkWidth;
+                mipChainHeightInMetaBlk = dccAddrOutput.height / dccAddrOutput.metaBlkHeight;
 
-            PAL_ASSERT((mipChainPitchInMetaBlk * mipChainHeightInMetaBlk) == dccAddrOutput.metaBlkNumPerSlice);
+                PAL_ASSERT((mipChainPitchInMetaBlk * mipChainHeightInMetaBlk) == dccAddrOutput.metaBlkNumPerSlice);
 
-            const auto&  dccMipInfo = pDcc->GetAddrMipInfo(clearRange.startSubres.mipLevel);
+                const auto&  dccMipInfo = pDcc->GetAddrMipInfo(clearRange.startSubres.mipLevel);
 
-            uint32 mipStartZInBlk = dccMipInfo.startZ / dccAddrOutput.metaBlkDepth;
-            uint32 mipStartYInBlk = dccMipInfo.startY / dccAddrOutput.metaBlkHeight;
-            uint32 mipStartXInBlk = dccMipInfo.startX / dccAddrOutput.metaBlkWidth;
+                uint32 mipStartZInBlk = dccMipInfo.startZ / dccAddrOutput.metaBlkDepth;
+                uint32 mipStartYInBlk = dccMipInfo.startY / dccAddrOutput.metaBlkHeight;
+                uint32 mipStartXInBlk = dccMipInfo.startX / dccAddrOutput.metaBlkWidth;
 
-            metaBlockOffset = (mipStartZInBlk + sliceStart) * dccAddrOutput.metaBlkNumPerSlice +
-                               mipStartYInBlk * mipChainPitchInMetaBlk +
-                               mipStartXInBlk;
+                metaBlockOffset = (mipStartZInBlk + sliceStart) * dccAddrOutput.metaBlkNumPerSlice +
+                                   mipStartYInBlk * mipChainPitchInMetaBlk +
+                                   mipStartXInBlk;
 
-            mipSlicePitchInMetaBlk = mipChainPitchInMetaBlk * mipChainHeightInMetaBlk;
+                mipSlicePitchInMetaBlk = mipChainPitchInMetaBlk * mipChainHeightInMetaBlk;
 
-            uint32 metaBlkSize = dccAddrOutput.fastClearSizePerSlice / dccAddrOutput.metaBlkNumPerSlice;
+                uint32 metaBlkSize = dccAddrOutput.fastClearSizePerSlice / dccAddrOutput.metaBlkNumPerSlice;
 
-            metaThreadX = (dccMipInfo.width / dccAddrOutput.metaBlkWidth) * metaBlkSize >> 4;
-            metaThreadY = dccMipInfo.height / dccAddrOutput.metaBlkHeight;
-            metaThreadZ = numSlices;
-        }
+                metaThreadX = (dccMipInfo.width / dccAddrOutput.metaBlkWidth) * metaBlkSize >> 4;
+                metaThreadY = dccMipInfo.height / dccAddrOutput.metaBlkHeight;
+                metaThreadZ = numSlices;
+            }
 
-        PAL_ASSERT((bufferViewDccSurf.range & 0xf) == 0);
+            PAL_ASSERT((bufferViewDccSurf.range & 0xf) == 0);
 
-        // Create Buffer Srds (UAV in our case)
-        BufferSrd     bufferSrds[1] = {};
-        pDevice->CreateTypedBufferViewSrds(1, &bufferViewDccSurf, &bufferSrds[0]);
+            // Create Buffer Srds (UAV in our case)
+            BufferSrd     bufferSrds[1] = {};
+            pDevice->CreateTypedBufferViewSrds(1, &bufferViewDccSurf, &bufferSrds[0]);
 
-        // Constant data
-        const uint32 constData[] =
-        {
-            // start cb0[0]
-            clearColor,
-            // start cb0[1]
-            metaClearConstEqParam.metablockSizeLog2,
-            metaClearConstEqParam.metablockSizeLog2BitMask,
-            metaClearConstEqParam.combinedOffsetLowBits,
-            metaClearConstEqParam.combinedOffsetLowBitsMask,
-            // start cb0[2]
-            metaClearConstEqParam.metaBlockLsb,
-            metaClearConstEqParam.metaBlockLsbBitMask,
-            metaClearConstEqParam.metaBlockHighBitShift,
-            metaClearConstEqParam.combinedOffsetHighBitShift,
-            // start cb0[3]
-            metaBlockOffset,
-            mipChainPitchInMetaBlk,
-            mipSlicePitchInMetaBlk,
-        };
+            // Constant data
+            const uint32 constData[] =
+            {
+                // start cb0[0]
+                clearColor,
+                // start cb0[1]
+                metaClearConstEqParam.metablockSizeLog2,
+                metaClearConstEqParam.metablockSizeLog2BitMask,
+                metaClearConstEqParam.combinedOffsetLowBits,
+                metaClearConstEqParam.combinedOffsetLowBitsMask,
+                // start cb0[2]
+                metaClearConstEqParam.metaBlockLsb,
+                metaClearConstEqParam.metaBlockLsbBitMask,
+                metaClearConstEqParam.metaBlockHighBitShift,
+                metaClearConstEqParam.combinedOffsetHighBitShift,
+                // start cb0[3]
+                metaBlockOffset,
+                mipChainPitchInMetaBlk,
+                mipSlicePitchInMetaBlk,
+            };
 
-        // Create an embedded user-data table and bind it to user data 0.
-        const uint32  sizeConstDataDwords = NumBytesToNumDwords(sizeof(constData));
-        uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
-                                                                   SrdDwordAlignment() * 2 + sizeConstDataDwords,
-                                                                   SrdDwordAlignment(),
-                                                                   PipelineBindPoint::Compute,
-                                                                   0);
+            // Create an embedded user-data table and bind it to user data 0.
+            const uint32  sizeConstDataDwords = NumBytesToNumDwords(sizeof(constData));
+            uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
+                                                                       SrdDwordAlignment() * 2 + sizeConstDataDwords,
+                                                                       SrdDwordAlignment(),
+                                                                       PipelineBindPoint::Compute,
+                                                                       0);
 
-        // Supply the shader with a copy of our SRDs for the DCC buffer
-        memcpy(pSrdTable, &bufferSrds[0], sizeof(bufferSrds));
-        pSrdTable += Util::NumBytesToNumDwords(sizeof(bufferSrds));
+            // Supply the shader with a copy of our SRDs for the DCC buffer
+            memcpy(pSrdTable, &bufferSrds[0], sizeof(bufferSrds));
+            pSrdTable += Util::NumBytesToNumDwords(sizeof(bufferSrds));
 
-        // Pass to shader all kinds of Information realted to meta data equation
-        memcpy(pSrdTable, &constData[0], sizeof(constData));
+            // Pass to shader all kinds of Information realted to meta data equation
+            memcpy(pSrdTable, &constData[0], sizeof(constData));
 
-        uint32 numThreadGroupsX = 1;
-        uint32 numThreadGroupsY = 1;
-        uint32 numThreadGroupsZ = 1;
+            uint32 numThreadGroupsX = 1;
+            uint32 numThreadGroupsY = 1;
+            uint32 numThreadGroupsZ = 1;
 
-        if (metaThreadX != 0)
-        {
-            numThreadGroupsX = RpmUtil::MinThreadGroups(metaThreadX, threadsPerGroup[0]);
-            numThreadGroupsY = RpmUtil::MinThreadGroups(metaThreadY, threadsPerGroup[1]);
-            numThreadGroupsZ = RpmUtil::MinThreadGroups(metaThreadZ, threadsPerGroup[2]);
-        }
+            if (metaThreadX != 0)
+            {
+                numThreadGroupsX = RpmUtil::MinThreadGroups(metaThreadX, threadsPerGroup[0]);
+                numThreadGroupsY = RpmUtil::MinThreadGroups(metaThreadY, threadsPerGroup[1]);
+                numThreadGroupsZ = RpmUtil::MinThreadGroups(metaThreadZ, threadsPerGroup[2]);
+            }
 
-        pCmdBuffer->CmdDispatch(numThreadGroupsX, numThreadGroupsY, numThreadGroupsZ);
+            pCmdBuffer->CmdDispatch(numThreadGroupsX, numThreadGroupsY, numThreadGroupsZ);
+        }
     }
 }
 
@@ -4495,86 +4558,90 @@ void Gfx9RsrcProcMgr::ExecuteHtileEquation(
         uint32          threadsPerGroup[3] = {};
 
         // TODO: need to obey the "dbPerTileExpClearEnable" setting here.
-        const ComputePipeline* pPipeline = GetPipeline((effectiveSamples > 1)
+        const ComputePipeline* pPipeline = GetPipeline(pCmdBuffer, (effectiveSamples > 1)
                                                        ? RpmComputePipeline::Gfx9ClearHtileMultiSample
                                                        : RpmComputePipeline::Gfx9ClearHtileSingleSample);
 
-        pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
-
-        // Save the command buffer's state
-        pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
+        if (pPipeline != nullptr)
+        {
+            pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
 
-        // Bind Compute Pipeline used for the clear.
-        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
+            // Save the command buffer's state
+            pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
 
-        // On GFX9, we create a single view of the hTile buffer that points to the base mip level.  It's
-        // up to the equation to "find" each mip level and slice from that base location.
-        BufferViewInfo hTileSurfBufferView = { };
-        pBaseHtile->BuildSurfBufferView(dstImage, &hTileSurfBufferView);
-        pParentDev->CreateUntypedBufferViewSrds(1, &hTileSurfBufferView, &bufferSrds[0]);
+            // Bind Compute Pipeline used for the clear.
+            pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
 
-        // Create a view of the hTile equation so that the shader can access it.
-        BufferViewInfo hTileEqBufferView = { };
-        pBaseHtile->BuildEqBufferView(dstImage, &hTileEqBufferView);
-        pParentDev->CreateUntypedBufferViewSrds(1, &hTileEqBufferView, &bufferSrds[1]);
+            // On GFX9, we create a single view of the hTile buffer that points to the base mip level.  It's
+            // up to the equation to "find" each mip level and slice from that base location.
+            BufferViewInfo hTileSurfBufferView = { };
+            pBaseHtile->BuildSurfBufferView(dstImage, &hTileSurfBufferView);
+            pParentDev->CreateUntypedBufferViewSrds(1, &hTileSurfBufferView, &bufferSrds[0]);
 
-        const uint32 lastMip = range.startSubres.mipLevel + range.numMips - 1;
-        for (uint32 mipLevel = range.startSubres.mipLevel; mipLevel <= lastMip; ++mipLevel)
-        {
-            const SubresId  subResId       = { range.startSubres.aspect, mipLevel, 0 };
-            const auto*     pSubResInfo    = pParentImg->SubresourceInfo(subResId);
-            const auto&     hTileMipInfo   = pBaseHtile->GetAddrMipInfo(mipLevel);
-            const uint32    mipLevelHeight = pSubResInfo->extentTexels.height;
-            const uint32    mipLevelWidth  = pSubResInfo->extentTexels.width;
+            // Create a view of the hTile equation so that the shader can access it.
+            BufferViewInfo hTileEqBufferView = { };
+            pBaseHtile->BuildEqBufferView(dstImage, &hTileEqBufferView);
+            pParentDev->CreateUntypedBufferViewSrds(1, &hTileEqBufferView, &bufferSrds[1]);
 
-            const uint32 constData[] =
+            const uint32 lastMip = range.startSubres.mipLevel + range.numMips - 1;
+            for (uint32 mipLevel = range.startSubres.mipLevel; mipLevel <= lastMip; ++mipLevel)
             {
-                // start cb0[0]
-                hTileMipInfo.startX,
-                hTileMipInfo.startY,
-                range.startSubres.arraySlice,
-                sliceSize,
-                // start cb0[1]
-                log2MetaBlkWidth,
-                log2MetaBlkHeight,
-                0, // depth surfaces are always 2D
-                hTileAddrOutput.pitch >> log2MetaBlkWidth,
-                // start cb0[2]
-                mipLevelWidth,
-                mipLevelHeight,
-                htileValue & htileMask,
-                ~htileMask,
-                // start cb0[3]
-                pipeBankXor,
-                effectiveSamples,
-            };
+                const SubresId  subResId       = { range.startSubres.aspect, mipLevel, 0 };
+                const auto*     pSubResInfo    = pParentImg->SubresourceInfo(subResId);
+                const auto&     hTileMipInfo   = pBaseHtile->GetAddrMipInfo(mipLevel);
+                const uint32    mipLevelHeight = pSubResInfo->extentTexels.height;
+                const uint32    mipLevelWidth  = pSubResInfo->extentTexels.width;
 
-            // Create an embedded user-data table and bind it to user data 0.
-            const uint32  sizeConstDataDwords = NumBytesToNumDwords(sizeof(constData));
-            uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
-                                                                       SrdDwordAlignment() * 2 + sizeConstDataDwords,
-                                                                       SrdDwordAlignment(),
-                                                                       PipelineBindPoint::Compute,
-                                                                       0);
-
-            // Put the SRDs for the hTile buffer and hTile equation into shader-accessible memory
-            memcpy(pSrdTable, &bufferSrds[0], sizeof(bufferSrds));
-            pSrdTable += Util::NumBytesToNumDwords(sizeof(bufferSrds));
-
-            // Provide the shader with all kinds of fun dimension info
-            memcpy(pSrdTable, &constData[0], sizeof(constData));
+                const uint32 constData[] =
+                {
+                    // start cb0[0]
+                    hTileMipInfo.startX,
+                    hTileMipInfo.startY,
+                    range.startSubres.arraySlice,
+                    sliceSize,
+                    // start cb0[1]
+                    log2MetaBlkWidth,
+                    log2MetaBlkHeight,
+                    0, // depth surfaces are always 2D
+                    hTileAddrOutput.pitch >> log2MetaBlkWidth,
+                    // start cb0[2]
+                    mipLevelWidth,
+                    mipLevelHeight,
+                    htileValue & htileMask,
+                    ~htileMask,
+                    // start cb0[3]
+                    pipeBankXor,
+                    effectiveSamples,
+                };
+
+                // Create an embedded user-data table and bind it to user data 0.
+                const uint32  sizeConstDataDwords = NumBytesToNumDwords(sizeof(constData));
+                uint32* pSrdTable =
+                    RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
+                                                           SrdDwordAlignment() * 2 + sizeConstDataDwords,
+                                                           SrdDwordAlignment(),
+                                                           PipelineBindPoint::Compute,
+                                                           0);
+
+                // Put the SRDs for the hTile buffer and hTile equation into shader-accessible memory
+                memcpy(pSrdTable, &bufferSrds[0], sizeof(bufferSrds));
+                pSrdTable += Util::NumBytesToNumDwords(sizeof(bufferSrds));
+
+                // Provide the shader with all kinds of fun dimension info
+                memcpy(pSrdTable, &constData[0], sizeof(constData));
+
+                MetaDataDispatch(pCmdBuffer,
+                                 dstImage,
+                                 pBaseHtile,
+                                 mipLevelWidth,
+                                 mipLevelHeight,
+                                 range.numSlices,
+                                 threadsPerGroup);
+            }
 
-            MetaDataDispatch(pCmdBuffer,
-                             dstImage,
-                             pBaseHtile,
-                             mipLevelWidth,
-                             mipLevelHeight,
-                             range.numSlices,
-                             threadsPerGroup);
+            // Restore the command buffer's state.
+            pCmdBuffer->CmdRestoreComputeState(ComputeStatePipelineAndUserData);
         }
-
-        // Restore the command buffer's state.
-        pCmdBuffer->CmdRestoreComputeState(ComputeStatePipelineAndUserData);
     }
     else
     {
@@ -4786,60 +4853,63 @@ void Gfx9RsrcProcMgr::InitCmask(
 
         // Does cMask *ever* depend on the number of samples?  If so, our shader is going to need some tweaking.
         PAL_ASSERT (pCmask->GetNumEffectiveSamples() == 1);
-        const auto*const pPipeline  = GetPipeline(RpmComputePipeline::Gfx9InitCmaskSingleSample);
+        const auto*const pPipeline  = GetPipeline(pCmdBuffer, RpmComputePipeline::Gfx9InitCmaskSingleSample);
 
-        pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
+        if (pPipeline != nullptr)
+        {
+            pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
 
-        // Save the command buffer's state.
-        pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
+            // Save the command buffer's state.
+            pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
 
-        // Bind Compute Pipeline used for the clear.
-        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
+            // Bind Compute Pipeline used for the clear.
+            pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
 
-        BufferViewInfo bufferViewCmaskSurf = { };
-        pCmask->BuildSurfBufferView(image, &bufferViewCmaskSurf);
-        BufferViewInfo bufferViewCmaskEq   = { };
-        pCmask->BuildEqBufferView(image, &bufferViewCmaskEq);
+            BufferViewInfo bufferViewCmaskSurf = { };
+            pCmask->BuildSurfBufferView(image, &bufferViewCmaskSurf);
+            BufferViewInfo bufferViewCmaskEq   = { };
+            pCmask->BuildEqBufferView(image, &bufferViewCmaskEq);
 
-        const uint32 constData[] =
-        {
-            // start cb0[0]
-            log2MetaBlkWidth,
-            log2MetaBlkHeight,
-            0, // 2D image, no depth
-            cMaskAddrOutput.pitch >> log2MetaBlkWidth,
-            // start cb0[1]
-            createInfo.extent.width,
-            createInfo.extent.height,
-            sliceSize,
-            pipeBankXor
-        };
+            const uint32 constData[] =
+            {
+                // start cb0[0]
+                log2MetaBlkWidth,
+                log2MetaBlkHeight,
+                0, // 2D image, no depth
+                cMaskAddrOutput.pitch >> log2MetaBlkWidth,
+                // start cb0[1]
+                createInfo.extent.width,
+                createInfo.extent.height,
+                sliceSize,
+                pipeBankXor
+            };
 
-        // Create an embedded user-data table and bind it to user data 0.
-        const uint32  sizeConstDataDwords = NumBytesToNumDwords(sizeof(constData));
-        uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
-                                                                   SrdDwordAlignment() * 2 + sizeConstDataDwords,
-                                                                   SrdDwordAlignment(),
-                                                                   PipelineBindPoint::Compute,
-                                                                   0);
+            // Create an embedded user-data table and bind it to user data 0.
+            const uint32  sizeConstDataDwords = NumBytesToNumDwords(sizeof(constData));
+            uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
+                                                                       SrdDwordAlignment() * 2 + sizeConstDataDwords,
+                                                                       SrdDwordAlignment(),
+                                                                       PipelineBindPoint::Compute,
+                                                                       0);
 
-        // We need buffer views for both the DCC surface and the addressing equation
-        pDevice->CreateUntypedBufferViewSrds(1, &bufferViewCmaskSurf, pSrdTable);
-        pSrdTable += SrdDwordAlignment();
-        pDevice->CreateUntypedBufferViewSrds(1, &bufferViewCmaskEq, pSrdTable);
-        pSrdTable += SrdDwordAlignment();
-        memcpy(pSrdTable, &constData[0], sizeof(constData));
+            // We need buffer views for both the DCC surface and the addressing equation
+            pDevice->CreateUntypedBufferViewSrds(1, &bufferViewCmaskSurf, pSrdTable);
+            pSrdTable += SrdDwordAlignment();
+            pDevice->CreateUntypedBufferViewSrds(1, &bufferViewCmaskEq, pSrdTable);
+            pSrdTable += SrdDwordAlignment();
+            memcpy(pSrdTable, &constData[0], sizeof(constData));
 
-        MetaDataDispatch(pCmdBuffer,
-                         image,
-                         pCmask,
-                         createInfo.extent.width,
-                         createInfo.extent.height,
-                         initRange.numSlices,
-                         threadsPerGroup);
+            MetaDataDispatch(pCmdBuffer,
+                             image,
+                             pCmask,
+                             createInfo.extent.width,
+                             createInfo.extent.height,
+                             initRange.numSlices,
+                             threadsPerGroup);
 
-        // Restore the command buffer's state.
-        pCmdBuffer->CmdRestoreComputeState(ComputeStatePipelineAndUserData);
+            // Restore the command buffer's state.
+            pCmdBuffer->CmdRestoreComputeState(ComputeStatePipelineAndUserData);
+        }
     }
     else
     {
@@ -159,6 +159,7 @@ protected:
     virtual ~RsrcProcMgr() {}
 
     virtual const Pal::GraphicsPipeline* GetGfxPipelineByTargetIndexAndFormat(
+        GfxCmdBuffer*  pCmdBuffer,
         RpmGfxPipeline basePipeline,
         uint32         targetIndex,
         SwizzledFormat format) const override;
@@ -167,8 +168,8 @@ protected:
         { return (RsrcProcMgr::UseMipLevelInSrd && (isCompressed == false)); }
 
     virtual const Pal::ComputePipeline* GetCmdGenerationPipeline(
-        const Pal::IndirectCmdGenerator& generator,
-        const CmdBuffer&                 cmdBuffer) const;
+        GfxCmdBuffer*                    pCmdBuffer,
+        const Pal::IndirectCmdGenerator& generator) const;
 
     virtual void ClearDccCompute(
         GfxCmdBuffer*      pCmdBuffer,
@@ -72,18 +72,37 @@ RsrcProcMgr::RsrcProcMgr(
     m_pStencilResolveState(nullptr),
     m_pDepthStencilResolveState(nullptr),
     m_pDevice(pDevice),
-    m_srdAlignment(0)
+    m_srdAlignment(0),
+    m_warmUpNextIndex(0)
 {
     memset(&m_pMsaaState[0], 0, sizeof(m_pMsaaState));
-    memset(&m_pComputePipelines[0], 0, sizeof(m_pComputePipelines));
-    memset(&m_pGraphicsPipelines[0], 0, sizeof(m_pGraphicsPipelines));
+
+    for (uint32 idx = 0; idx < RpmComputePipelineCount; ++idx)
+    {
+        m_pComputePipelines[idx] = nullptr;
+    }
+
+    for (uint32 idx = 0; idx < RpmGfxPipelineCount; ++idx)
+    {
+        m_pGraphicsPipelines[idx] = nullptr;
+    }
+
+    for (uint32 idx = 0; idx < RpmPipelineCount; ++idx)
+    {
+        m_pipelineState[idx] = PipelineNotCreated;
+    }
 }
 
 // =====================================================================================================================
 RsrcProcMgr::~RsrcProcMgr()
 {
     // These objects must be destroyed in Cleanup().
-    for (uint32 idx = 0; idx < static_cast<uint32>(RpmComputePipeline::Count); ++idx)
+    for (uint32 idx = 0; idx < MaxRpmWarmUpThreads; ++idx)
+    {
+        PAL_ASSERT(m_warmUpThreads[idx].IsCreated() == false);
+    }
+
+    for (uint32 idx = 0; idx < RpmComputePipelineCount; ++idx)
     {
         PAL_ASSERT(m_pComputePipelines[idx] == nullptr);
     }
@@ -118,8 +137,11 @@ RsrcProcMgr::~RsrcProcMgr()
 // this object.
 void RsrcProcMgr::Cleanup()
 {
+    // The warm-up threads may still be creating pipelines, so they must be stopped before anything is destroyed.
+    StopWarmUpThreads();
+
     // Destroy all compute pipeline objects.
-    for (uint32 idx = 0; idx < static_cast<uint32>(RpmComputePipeline::Count); ++idx)
+    for (uint32 idx = 0; idx < RpmComputePipelineCount; ++idx)
     {
         if (m_pComputePipelines[idx] != nullptr)
         {
@@ -138,6 +160,11 @@ void RsrcProcMgr::Cleanup()
         }
     }
 
+    for (uint32 idx = 0; idx < RpmPipelineCount; ++idx)
+    {
+        m_pipelineState[idx] = PipelineNotCreated;
+    }
+
     // Destoy all state objects.
     if (m_pBlendDisableState != nullptr)
     {
@@ -192,7 +219,14 @@ Result RsrcProcMgr::EarlyInit()
     // Round up to the size of a DWORD.
     m_srdAlignment = Util::NumBytesToNumDwords(m_srdAlignment);
 
-    return Result::Success;
+    Result result = m_pipelineLock.Init();
+
+    if (result == Result::Success)
+    {
+        result = m_pipelineCreated.Init();
+    }
+
+    return result;
 }
 
 // =====================================================================================================================
@@ -201,24 +235,175 @@ Result RsrcProcMgr::LateInit()
 {
     Result result = Result::Success;
 
-    if (m_pDevice->Parent()->GetPublicSettings()->disableResourceProcessingManager == false)
-    {
-        result = CreateRpmComputePipelines(m_pDevice, m_pComputePipelines);
+    const PalSettings& settings = m_pDevice->Parent()->Settings();
 
-        if (result == Result::Success)
+    if (m_pDevice->Parent()->GetPublicSettings()->disableResourceProcessingManager)
+    {
+        // No pipelines will ever be created, so there's no point in trying to create them on first use either.
+        for (uint32 idx = 0; idx < RpmPipelineCount; ++idx)
+        {
+            m_pipelineState[idx] = PipelineReady;
+        }
+    }
+    else
+    {
+        if (settings.rpmLazyPipelineCreation == false)
         {
-            result = CreateRpmGraphicsPipelines(m_pDevice, m_pGraphicsPipelines);
+            for (uint32 idx = 0; (idx < RpmComputePipelineCount) && (result == Result::Success); ++idx)
+            {
+                ComputePipeline* pPipeline = nullptr;
+                result = CreateRpmComputePipeline(m_pDevice, static_cast<RpmComputePipeline>(idx), &pPipeline);
+
+                m_pComputePipelines[idx] = pPipeline;
+                m_pipelineState[idx]     = PipelineReady;
+            }
+
+            for (uint32 idx = 0; (idx < RpmGfxPipelineCount) && (result == Result::Success); ++idx)
+            {
+                GraphicsPipeline* pPipeline = nullptr;
+                result = CreateRpmGraphicsPipeline(m_pDevice, static_cast<RpmGfxPipeline>(idx), &pPipeline);
+
+                m_pGraphicsPipelines[idx]                      = pPipeline;
+                m_pipelineState[RpmComputePipelineCount + idx] = PipelineReady;
+            }
         }
 
         if (result == Result::Success)
         {
             result = CreateCommonStateObjects();
         }
+
+        // Warming up is best-effort: if some threads can't be started, the rest of the pipelines are still created
+        // by the threads which did start or on first use.
+        if ((result == Result::Success) && settings.rpmLazyPipelineCreation)
+        {
+            const uint32 numThreads = Min(settings.rpmPipelineWarmUpThreads, MaxRpmWarmUpThreads);
+
+            m_warmUpNextIndex = 0;
+
+            for (uint32 idx = 0; idx < numThreads; ++idx)
+            {
+                m_warmUpThreads[idx].Begin(&WarmUpThreadCallback, this);
+            }
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Makes sure the internal pipeline with the given index (see RpmPipelineCount) has been created. Exactly one thread
+// creates each pipeline at a time; any other threads which need the same pipeline in the meantime wait for it. If the
+// creation fails, the pipeline goes back to PipelineNotCreated so that the next thread to need it tries again.
+Result RsrcProcMgr::InitPipeline(
+    uint32 index
+    ) const
+{
+    PAL_ASSERT(index < RpmPipelineCount);
+
+    Result result = Result::Success;
+
+    while ((result == Result::Success) && (m_pipelineState[index] != PipelineReady))
+    {
+        if (AtomicCompareAndSwap(&m_pipelineState[index], PipelineNotCreated, PipelineCreating) == PipelineNotCreated)
+        {
+            result = CreatePipeline(index);
+
+            // The state must change under the lock so that no waiter can miss the wake-up.
+            MutexAuto lock(&m_pipelineLock);
+            AtomicExchange(&m_pipelineState[index], (result == Result::Success) ? PipelineReady : PipelineNotCreated);
+            m_pipelineCreated.WakeAll();
+        }
+        else
+        {
+            MutexAuto lock(&m_pipelineLock);
+
+            while (m_pipelineState[index] == PipelineCreating)
+            {
+                m_pipelineCreated.Wait(&m_pipelineLock, UINT32_MAX);
+            }
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Makes sure the internal pipeline with the given index has been created on behalf of a command buffer which is about
+// to use it. A failure puts the command buffer into an error state.
+void RsrcProcMgr::InitPipeline(
+    GfxCmdBuffer* pCmdBuffer,
+    uint32        index
+    ) const
+{
+    if (InitPipeline(index) != Result::Success)
+    {
+        pCmdBuffer->NotifyAllocFailure();
+    }
+}
+
+// =====================================================================================================================
+// Creates the internal pipeline with the given index. Pipelines which aren't supported by this device are left null.
+Result RsrcProcMgr::CreatePipeline(
+    uint32 index
+    ) const
+{
+    Result result = Result::Success;
+
+    if (index < RpmComputePipelineCount)
+    {
+        ComputePipeline* pPipeline = nullptr;
+        result = CreateRpmComputePipeline(m_pDevice, static_cast<RpmComputePipeline>(index), &pPipeline);
+
+        m_pComputePipelines[index] = (result == Result::Success) ? pPipeline : nullptr;
+    }
+    else
+    {
+        const uint32      gfxIndex  = index - RpmComputePipelineCount;
+        GraphicsPipeline* pPipeline = nullptr;
+        result = CreateRpmGraphicsPipeline(m_pDevice, static_cast<RpmGfxPipeline>(gfxIndex), &pPipeline);
+
+        m_pGraphicsPipelines[gfxIndex] = (result == Result::Success) ? pPipeline : nullptr;
     }
 
+    // Internal pipelines are built from binaries embedded in PAL, so this can only fail if we run out of memory.
+    PAL_ALERT(result != Result::Success);
+
     return result;
 }
 
+// =====================================================================================================================
+void RsrcProcMgr::WarmUpThreadCallback(
+    void* pParam)
+{
+    RsrcProcMgr*const pRpm = static_cast<RsrcProcMgr*>(pParam);
+
+    // Each thread repeatedly claims the next pipeline index until every pipeline has been claimed.
+    for (uint32 index = AtomicIncrement(&pRpm->m_warmUpNextIndex) - 1;
+         index < RpmPipelineCount;
+         index = AtomicIncrement(&pRpm->m_warmUpNextIndex) - 1)
+    {
+        // A pipeline which can't be created now is left for the first thread which needs it to try again.
+        if (pRpm->m_pipelineState[index] != PipelineReady)
+        {
+            pRpm->InitPipeline(index);
+        }
+    }
+}
+
+// =====================================================================================================================
+// Stops any warm-up threads once they finish the pipelines they're currently creating.
+void RsrcProcMgr::StopWarmUpThreads()
+{
+    // Claiming every remaining index makes the threads exit.
+    AtomicExchange(&m_warmUpNextIndex, RpmPipelineCount);
+
+    for (uint32 idx = 0; idx < MaxRpmWarmUpThreads; ++idx)
+    {
+        m_warmUpThreads[idx].Join();
+    }
+}
+
 // =====================================================================================================================
 // Builds commands to copy one or more regions from one GPU memory location to another with a compute shader.
 void RsrcProcMgr::CopyMemoryCs(
@@ -312,28 +497,31 @@ void RsrcProcMgr::CopyMemoryCs(
         const uint32 regionUserData[3] = { srcOffset, dstOffset, copySize };
         pCmdBuffer->CmdSetUserData(PipelineBindPoint::Compute, 1, 3, regionUserData);
 
-        // Get the pipeline object and number of thread groups.
+        // Get the pipeline object and number of elements to copy.
         const ComputePipeline* pPipeline = nullptr;
-        uint32 numThreadGroups = 0;
+        uint32 numElements = 0;
 
         if (IsPow2Aligned(srcOffset, sizeof(uint32)) &&
             IsPow2Aligned(dstOffset, sizeof(uint32)) &&
             IsPow2Aligned(copySize,  sizeof(uint32)))
         {
             // Offsets and copySize are DWORD aligned so we can use the DWORD copy pipeline.
-            pPipeline       = GetPipeline(RpmComputePipeline::CopyBufferDword);
-            numThreadGroups = RpmUtil::MinThreadGroups(copySize / sizeof(uint32), pPipeline->ThreadsPerGroup());
+            pPipeline   = GetPipeline(pCmdBuffer, RpmComputePipeline::CopyBufferDword);
+            numElements = copySize / sizeof(uint32);
         }
         else
         {
             // Since the offsets and copySize are not all DWORD aligned we have to use the byte copy pipeline.
-            pPipeline       = GetPipeline(RpmComputePipeline::CopyBufferByte);
-            numThreadGroups = RpmUtil::MinThreadGroups(copySize, pPipeline->ThreadsPerGroup());
+            pPipeline   = GetPipeline(pCmdBuffer, RpmComputePipeline::CopyBufferByte);
+            numElements = copySize;
         }
 
         // Bind pipeline and dispatch.
-        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
-        pCmdBuffer->CmdDispatch(numThreadGroups, 1, 1);
+        if (pPipeline != nullptr)
+        {
+            pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
+            pCmdBuffer->CmdDispatch(RpmUtil::MinThreadGroups(numElements, pPipeline->ThreadsPerGroup()), 1, 1);
+        }
     }
 
     if (p2pBltInfoRequired)
@@ -532,132 +720,138 @@ void RsrcProcMgr::CopyColorImageGraphics(
         colorViewInfo.swizzledFormat = dstFormat;
 
         // Only switch to the appropriate graphics pipeline if it differs from the previous region's pipeline.
-        const GraphicsPipeline*const pPipeline = GetGfxPipelineByTargetIndexAndFormat(Copy_32ABGR, 0, dstFormat);
-        if (pPreviousPipeline != pPipeline)
+        const GraphicsPipeline*const pPipeline =
+            GetGfxPipelineByTargetIndexAndFormat(pCmdBuffer, Copy_32ABGR, 0, dstFormat);
+        if (pPipeline != nullptr)
         {
-            pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Graphics, pPipeline, });
-            pCmdBuffer->CmdOverwriteRbPlusFormatForBlits(dstFormat, 0);
-            pPreviousPipeline = pPipeline;
-        }
-
-        // We'll setup both 2D and 3D src images as a 2D view.
-        //
-        // Is it legal for the shader to view 3D images as 2D?
-        ImageViewInfo imageView = {};
-        RpmUtil::BuildImageViewInfo(&imageView, srcImage, viewRange, srcFormat, false, device.TexOptLevel());
-
-        // Create an embedded SRD table and bind it to user data 1 for pixel work.
-        uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
-                                                                   SrdDwordAlignment(),
-                                                                   SrdDwordAlignment(),
-                                                                   PipelineBindPoint::Graphics,
-                                                                   1);
-
-        // Populate the table with an image view of the source image.
-        device.CreateImageViewSrds(1, &imageView, pSrdTable);
-
-        // Give the gfxip layer a chance to optimize the hardware before we start copying.
-        const uint32 bitsPerPixel = Formats::BitsPerPixel(dstFormat.format);
-        restoreMask              |= HwlBeginGraphicsCopy(pCmdBuffer, pPipeline, dstImage, bitsPerPixel);
+            if (pPreviousPipeline != pPipeline)
+            {
+                pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Graphics, pPipeline, });
+                pCmdBuffer->CmdOverwriteRbPlusFormatForBlits(dstFormat, 0);
+                pPreviousPipeline = pPipeline;
+            }
 
-        // 3D images can't have slices and non-3D images shouldn't specify depth > 1 so we expect at least one
-        // of them to be set to 1.
-        PAL_ASSERT((srcCreateInfo.imageType != dstCreateInfo.imageType) ||
-                   (copyRegion.numSlices == 1) || (copyRegion.extent.depth == 1));
+            // We'll setup both 2D and 3D src images as a 2D view.
+            //
+            // Is it legal for the shader to view 3D images as 2D?
+            ImageViewInfo imageView = {};
+            RpmUtil::BuildImageViewInfo(&imageView, srcImage, viewRange, srcFormat, false, device.TexOptLevel());
 
-        // When copying from 2D to 3D, the number of slices should match the depth.
-        PAL_ASSERT((srcCreateInfo.imageType == dstCreateInfo.imageType) ||
-                   (((srcCreateInfo.imageType == ImageType::Tex3d && dstCreateInfo.imageType == ImageType::Tex2d) ||
-                     (srcCreateInfo.imageType == ImageType::Tex2d && dstCreateInfo.imageType == ImageType::Tex3d)) &&
-                    (copyRegion.numSlices == copyRegion.extent.depth)));
+            // Create an embedded SRD table and bind it to user data 1 for pixel work.
+            uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
+                                                                       SrdDwordAlignment(),
+                                                                       SrdDwordAlignment(),
+                                                                       PipelineBindPoint::Graphics,
+                                                                       1);
 
-        copyRegion.srcOffset.x  *= texelScale;
-        copyRegion.dstOffset.x  *= texelScale;
-        copyRegion.extent.width *= texelScale;
+            // Populate the table with an image view of the source image.
+            device.CreateImageViewSrds(1, &imageView, pSrdTable);
 
-        // Setup the viewport and scissor to restrict rendering to the destination region being copied.
-        viewportInfo.viewports[0].originX = static_cast<float>(copyRegion.dstOffset.x);
-        viewportInfo.viewports[0].originY = static_cast<float>(copyRegion.dstOffset.y);
-        viewportInfo.viewports[0].width   = static_cast<float>(copyRegion.extent.width);
-        viewportInfo.viewports[0].height  = static_cast<float>(copyRegion.extent.height);
+            // Give the gfxip layer a chance to optimize the hardware before we start copying.
+            const uint32 bitsPerPixel = Formats::BitsPerPixel(dstFormat.format);
+            restoreMask              |= HwlBeginGraphicsCopy(pCmdBuffer, pPipeline, dstImage, bitsPerPixel);
+
+            // 3D images can't have slices and non-3D images shouldn't specify depth > 1 so we expect at least one
+            // of them to be set to 1.
+            PAL_ASSERT((srcCreateInfo.imageType != dstCreateInfo.imageType) ||
+                       (copyRegion.numSlices == 1) || (copyRegion.extent.depth == 1));
+
+            // When copying from 2D to 3D, the number of slices should match the depth.
+            PAL_ASSERT((srcCreateInfo.imageType == dstCreateInfo.imageType) ||
+                       ((((srcCreateInfo.imageType == ImageType::Tex3d) &&
+                          (dstCreateInfo.imageType == ImageType::Tex2d)) ||
+                         ((srcCreateInfo.imageType == ImageType::Tex2d) &&
+                          (dstCreateInfo.imageType == ImageType::Tex3d))) &&
+                        (copyRegion.numSlices == copyRegion.extent.depth)));
+
+            copyRegion.srcOffset.x  *= texelScale;
+            copyRegion.dstOffset.x  *= texelScale;
+            copyRegion.extent.width *= texelScale;
+
+            // Setup the viewport and scissor to restrict rendering to the destination region being copied.
+            viewportInfo.viewports[0].originX = static_cast<float>(copyRegion.dstOffset.x);
+            viewportInfo.viewports[0].originY = static_cast<float>(copyRegion.dstOffset.y);
+            viewportInfo.viewports[0].width   = static_cast<float>(copyRegion.extent.width);
+            viewportInfo.viewports[0].height  = static_cast<float>(copyRegion.extent.height);
+
+            scissorInfo.scissors[0].offset.x      = copyRegion.dstOffset.x;
+            scissorInfo.scissors[0].offset.y      = copyRegion.dstOffset.y;
+            scissorInfo.scissors[0].extent.width  = copyRegion.extent.width;
+            scissorInfo.scissors[0].extent.height = copyRegion.extent.height;
 
-        scissorInfo.scissors[0].offset.x      = copyRegion.dstOffset.x;
-        scissorInfo.scissors[0].offset.y      = copyRegion.dstOffset.y;
-        scissorInfo.scissors[0].extent.width  = copyRegion.extent.width;
-        scissorInfo.scissors[0].extent.height = copyRegion.extent.height;
+            pCmdBuffer->CmdSetViewports(viewportInfo);
+            pCmdBuffer->CmdSetScissorRects(scissorInfo);
 
-        pCmdBuffer->CmdSetViewports(viewportInfo);
-        pCmdBuffer->CmdSetScissorRects(scissorInfo);
+            // Copy may happen between the layers of a 2d image and the slices of a 3d image.
+            const uint32 numSlices = Max(copyRegion.numSlices, copyRegion.extent.depth);
 
-        // Copy may happen between the layers of a 2d image and the slices of a 3d image.
-        const uint32 numSlices = Max(copyRegion.numSlices, copyRegion.extent.depth);
-
-        // Each slice is copied individually, we can optimize this into fewer draw calls if it becomes a
-        // performance bottleneck, but for now this is simpler.
-        for (uint32 sliceOffset = 0; sliceOffset < numSlices; ++sliceOffset)
-        {
-            // The shader will calculate src coordinates by adding a delta to the dst coordinates. The user data should
-            // contain those deltas which are (srcOffset-dstOffset) for X & Y and the z offset (slice) in the 3rd
-            // register.
-            const int32  xOffset     = (copyRegion.srcOffset.x - copyRegion.dstOffset.x);
-            const int32  yOffset     = (copyRegion.srcOffset.y - copyRegion.dstOffset.y);
-            const uint32 srcSlice    = ((srcCreateInfo.imageType == ImageType::Tex3d)
-                                        ? copyRegion.srcOffset.z          + sliceOffset
-                                        : copyRegion.srcSubres.arraySlice + sliceOffset);
-            const uint32 userData[4] =
+            // Each slice is copied individually, we can optimize this into fewer draw calls if it becomes a
+            // performance bottleneck, but for now this is simpler.
+            for (uint32 sliceOffset = 0; sliceOffset < numSlices; ++sliceOffset)
             {
-                reinterpret_cast<const uint32&>(xOffset),
-                reinterpret_cast<const uint32&>(yOffset),
-                srcSlice,
-                copyRegion.srcSubres.mipLevel
-            };
+                // The shader will calculate src coordinates by adding a delta to the dst coordinates. The user data
+                // should contain those deltas which are (srcOffset-dstOffset) for X & Y and the z offset (slice) in
+                // the 3rd register.
+                const int32  xOffset     = (copyRegion.srcOffset.x - copyRegion.dstOffset.x);
+                const int32  yOffset     = (copyRegion.srcOffset.y - copyRegion.dstOffset.y);
+                const uint32 srcSlice    = ((srcCreateInfo.imageType == ImageType::Tex3d)
+                                            ? copyRegion.srcOffset.z          + sliceOffset
+                                            : copyRegion.srcSubres.arraySlice + sliceOffset);
+                const uint32 userData[4] =
+                {
+                    reinterpret_cast<const uint32&>(xOffset),
+                    reinterpret_cast<const uint32&>(yOffset),
+                    srcSlice,
+                    copyRegion.srcSubres.mipLevel
+                };
 
-            pCmdBuffer->CmdSetUserData(PipelineBindPoint::Graphics, 2, 4, &userData[0]);
+                pCmdBuffer->CmdSetUserData(PipelineBindPoint::Graphics, 2, 4, &userData[0]);
 
-            colorViewInfo.imageInfo.baseSubRes = copyRegion.dstSubres;
+                colorViewInfo.imageInfo.baseSubRes = copyRegion.dstSubres;
 
-            if (dstCreateInfo.imageType == ImageType::Tex3d)
-            {
-                colorViewInfo.zRange.offset = copyRegion.dstOffset.z + sliceOffset;
-            }
-            else
-            {
-                colorViewInfo.imageInfo.baseSubRes.arraySlice = copyRegion.dstSubres.arraySlice + sliceOffset;
-            }
+                if (dstCreateInfo.imageType == ImageType::Tex3d)
+                {
+                    colorViewInfo.zRange.offset = copyRegion.dstOffset.z + sliceOffset;
+                }
+                else
+                {
+                    colorViewInfo.imageInfo.baseSubRes.arraySlice = copyRegion.dstSubres.arraySlice + sliceOffset;
+                }
 
-            // Create and bind a color-target view for this slice.
-            LinearAllocatorAuto<VirtualLinearAllocator> sliceAlloc(pCmdBuffer->Allocator(), false);
+                // Create and bind a color-target view for this slice.
+                LinearAllocatorAuto<VirtualLinearAllocator> sliceAlloc(pCmdBuffer->Allocator(), false);
 
-            IColorTargetView* pColorView = nullptr;
-            void* pColorViewMem =
-                PAL_MALLOC(m_pDevice->GetColorTargetViewSize(nullptr), &sliceAlloc, AllocInternalTemp);
+                IColorTargetView* pColorView = nullptr;
+                void* pColorViewMem =
+                    PAL_MALLOC(m_pDevice->GetColorTargetViewSize(nullptr), &sliceAlloc, AllocInternalTemp);
 
-            if (pColorViewMem == nullptr)
-            {
-                pCmdBuffer->NotifyAllocFailure();
-            }
-            else
-            {
-                // Since our color target view can only bind 1 slice at a time, we have to issue a separate draw for
-                // each slice in extent.z. We can keep the same src image view since we pass the explicit slice to
-                // read from in user data, but we'll need to create a new color target view each time.
-                Result result = m_pDevice->CreateColorTargetView(colorViewInfo,
-                                                                 colorViewInfoInternal,
-                                                                 pColorViewMem,
-                                                                 &pColorView);
-                PAL_ASSERT(result == Result::Success);
+                if (pColorViewMem == nullptr)
+                {
+                    pCmdBuffer->NotifyAllocFailure();
+                }
+                else
+                {
+                    // Since our color target view can only bind 1 slice at a time, we have to issue a separate draw for
+                    // each slice in extent.z. We can keep the same src image view since we pass the explicit slice to
+                    // read from in user data, but we'll need to create a new color target view each time.
+                    Result result = m_pDevice->CreateColorTargetView(colorViewInfo,
+                                                                     colorViewInfoInternal,
+                                                                     pColorViewMem,
+                                                                     &pColorView);
+                    PAL_ASSERT(result == Result::Success);
 
-                bindTargetsInfo.colorTargets[0].pColorTargetView = pColorView;
-                bindTargetsInfo.colorTargetCount = 1;
-                pCmdBuffer->CmdBindTargets(bindTargetsInfo);
+                    bindTargetsInfo.colorTargets[0].pColorTargetView = pColorView;
+                    bindTargetsInfo.colorTargetCount = 1;
+                    pCmdBuffer->CmdBindTargets(bindTargetsInfo);
 
-                // Draw a fullscreen quad.
-                pCmdBuffer->CmdDraw(0, 3, 0, 1);
+                    // Draw a fullscreen quad.
+                    pCmdBuffer->CmdDraw(0, 3, 0, 1);
 
-                // Unbind the color-target view.
-                bindTargetsInfo.colorTargetCount = 0;
-                pCmdBuffer->CmdBindTargets(bindTargetsInfo);
-                PAL_SAFE_FREE(pColorViewMem, &sliceAlloc);
+                    // Unbind the color-target view.
+                    bindTargetsInfo.colorTargetCount = 0;
+                    pCmdBuffer->CmdBindTargets(bindTargetsInfo);
+                    PAL_SAFE_FREE(pColorViewMem, &sliceAlloc);
+                }
             }
         }
     }
@@ -813,10 +1007,15 @@ void RsrcProcMgr::CopyDepthStencilImageGraphics(
                 }
             }
 
-            pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Graphics,
-                GetCopyDepthStencilMsaaPipeline(isDepth,
-                    isDepthStencil,
-                    srcImage.GetImageCreateInfo().samples), });
+            const GraphicsPipeline*const pPipeline =
+                GetCopyDepthStencilMsaaPipeline(pCmdBuffer, isDepth, isDepthStencil, srcCreateInfo.samples);
+
+            if (pPipeline == nullptr)
+            {
+                continue;
+            }
+
+            pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Graphics, pPipeline, });
 
             // Determine which format we should use to view the source image.
             SwizzledFormat srcFormat =
@@ -982,12 +1181,12 @@ void RsrcProcMgr::CopyImageCompute(
              (srcImgMemLayout.metadataSize + srcImgMemLayout.metadataHeaderSize)) &&
              (m_pDevice->Parent()->ChipProperties().gfxLevel >= GfxIpLevel::GfxIp9))
         {
-            pPipeline = GetPipeline(RpmComputePipeline::MsaaFmaskCopyImageOptimized);
+            pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaFmaskCopyImageOptimized);
             isFmaskCopyOptimized = true;
         }
         else
         {
-            pPipeline = GetPipeline(RpmComputePipeline::MsaaFmaskCopyImage);
+            pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaFmaskCopyImage);
         }
 
         isFmaskCopy = true;
@@ -997,25 +1196,25 @@ void RsrcProcMgr::CopyImageCompute(
         switch (srcCreateInfo.fragments)
         {
         case 2:
-            pPipeline = GetPipeline(RpmComputePipeline::CopyImage2dms2x);
+            pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::CopyImage2dms2x);
             break;
 
         case 4:
-            pPipeline = GetPipeline(RpmComputePipeline::CopyImage2dms4x);
+            pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::CopyImage2dms4x);
             break;
 
         case 8:
-            pPipeline = GetPipeline(RpmComputePipeline::CopyImage2dms8x);
+            pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::CopyImage2dms8x);
             break;
 
         default:
             if (useMipInSrd)
             {
-                pPipeline = GetPipeline(RpmComputePipeline::CopyImage2d);
+                pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::CopyImage2d);
             }
             else
             {
-                pPipeline = GetPipeline(RpmComputePipeline::CopyImage2dShaderMipLevel);
+                pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::CopyImage2dShaderMipLevel);
             }
             break;
         }
@@ -1028,191 +1227,195 @@ void RsrcProcMgr::CopyImageCompute(
     // no need to change pipelines in that case.
     if (isSrgbDst && TestAnyFlagSet(flags, CopyFormatConversion))
     {
-        pPipeline = GetPipeline(RpmComputePipeline::CopyImageGammaCorrect2d);
+        pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::CopyImageGammaCorrect2d);
     }
 
-    // Get number of threads per groups in each dimension, we will need this data later.
-    uint32 threadsPerGroup[3] = {};
-    pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
-
-    bool p2pBltInfoRequired = m_pDevice->Parent()->IsP2pBltWaRequired(*dstImage.GetBoundGpuMemory().Memory());
-
-    uint32 newRegionCount = 0;
-    if (p2pBltInfoRequired)
+    if (pPipeline != nullptr)
     {
-        m_pDevice->P2pBltWaModifyRegionListImage(srcImage,
-                                                 dstImage,
-                                                 regionCount,
-                                                 pRegions,
-                                                 &newRegionCount,
-                                                 nullptr,
-                                                 nullptr);
-    }
+        // Get number of threads per groups in each dimension, we will need this data later.
+        uint32 threadsPerGroup[3] = {};
+        pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
 
-    AutoBuffer<ImageCopyRegion, 32, Platform> newRegions(newRegionCount, m_pDevice->GetPlatform());
-    AutoBuffer<gpusize, 32, Platform> chunkAddrs(newRegionCount, m_pDevice->GetPlatform());
+        bool p2pBltInfoRequired = m_pDevice->Parent()->IsP2pBltWaRequired(*dstImage.GetBoundGpuMemory().Memory());
 
-    if (p2pBltInfoRequired)
-    {
-        if ((newRegions.Capacity() >= newRegionCount) && (chunkAddrs.Capacity() >= newRegionCount))
+        uint32 newRegionCount = 0;
+        if (p2pBltInfoRequired)
         {
             m_pDevice->P2pBltWaModifyRegionListImage(srcImage,
                                                      dstImage,
                                                      regionCount,
                                                      pRegions,
                                                      &newRegionCount,
-                                                     &newRegions[0],
-                                                     &chunkAddrs[0]);
-
-            regionCount = newRegionCount;
-            pRegions    = &newRegions[0];
-
-            pCmdBuffer->P2pBltWaCopyBegin(dstImage.GetBoundGpuMemory().Memory(), regionCount, &chunkAddrs[0]);
-        }
-        else
-        {
-            pCmdBuffer->NotifyAllocFailure();
-            p2pBltInfoRequired = false;
+                                                     nullptr,
+                                                     nullptr);
         }
-    }
-
-    // Save current command buffer state and bind the pipeline.
-    pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
-    pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
-
-    // Now begin processing the list of copy regions.
-    for (uint32 idx = 0; idx < regionCount; ++idx)
-    {
-        ImageCopyRegion copyRegion = pRegions[idx];
 
-        // 3D images can't have slices and non-3D images shouldn't specify depth > 1 so we expect at least one
-        // of them to be set to 1.
-        PAL_ASSERT((copyRegion.numSlices == 1) || (copyRegion.extent.depth == 1));
+        AutoBuffer<ImageCopyRegion, 32, Platform> newRegions(newRegionCount, m_pDevice->GetPlatform());
+        AutoBuffer<gpusize, 32, Platform> chunkAddrs(newRegionCount, m_pDevice->GetPlatform());
 
         if (p2pBltInfoRequired)
         {
-            pCmdBuffer->P2pBltWaCopyNextRegion(chunkAddrs[idx]);
+            if ((newRegions.Capacity() >= newRegionCount) && (chunkAddrs.Capacity() >= newRegionCount))
+            {
+                m_pDevice->P2pBltWaModifyRegionListImage(srcImage,
+                                                         dstImage,
+                                                         regionCount,
+                                                         pRegions,
+                                                         &newRegionCount,
+                                                         &newRegions[0],
+                                                         &chunkAddrs[0]);
+
+                regionCount = newRegionCount;
+                pRegions    = &newRegions[0];
+
+                pCmdBuffer->P2pBltWaCopyBegin(dstImage.GetBoundGpuMemory().Memory(), regionCount, &chunkAddrs[0]);
+            }
+            else
+            {
+                pCmdBuffer->NotifyAllocFailure();
+                p2pBltInfoRequired = false;
+            }
         }
 
-        // Setup image formats per-region. This is different than the graphics path because the compute path must be
-        // able to copy depth-stencil images.
-        SwizzledFormat dstFormat  = {};
-        SwizzledFormat srcFormat  = {};
-        uint32         texelScale = 1;
-
-        GetCopyImageFormats(srcImage,
-                            srcImageLayout,
-                            dstImage,
-                            dstImageLayout,
-                            copyRegion,
-                            flags,
-                            &srcFormat,
-                            &dstFormat,
-                            &texelScale);
+        // Save current command buffer state and bind the pipeline.
+        pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
+        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
 
-        // The hardware can't handle UAV stores using SRGB num format.  The resolve shaders already contain a
-        // linear-to-gamma conversion, but in order for that to work the output UAV's num format must be patched to be
-        // simple unorm.
-        if (Formats::IsSrgb(dstFormat.format))
+        // Now begin processing the list of copy regions.
+        for (uint32 idx = 0; idx < regionCount; ++idx)
         {
-            dstFormat.format = Formats::ConvertToUnorm(dstFormat.format);
-            PAL_ASSERT(Formats::IsUndefined(dstFormat.format) == false);
-        }
+            ImageCopyRegion copyRegion = pRegions[idx];
 
-        // Multiply all x-dimension values in our region by the texel scale.
-        copyRegion.srcOffset.x  *= texelScale;
-        copyRegion.dstOffset.x  *= texelScale;
-        copyRegion.extent.width *= texelScale;
-
-        RpmUtil::CopyImageInfo copyImageInfo    = {};
-        copyImageInfo.srcOffset                 = copyRegion.srcOffset;
-        copyImageInfo.dstOffset                 = copyRegion.dstOffset;
-        copyImageInfo.numSamples                = dstCreateInfo.samples;
-        copyImageInfo.packedMipData.srcMipLevel = copyRegion.srcSubres.mipLevel;
-        copyImageInfo.packedMipData.dstMipLevel = copyRegion.dstSubres.mipLevel;
-        copyImageInfo.copyRegion.width          = copyRegion.extent.width;
-        copyImageInfo.copyRegion.height         = copyRegion.extent.height;
-
-        // Create an embedded user-data table and bind it to user data 0. We need image views for the src and dst
-        // subresources, as well as some inline constants for the copy offsets and extents.
-        const uint8 numSlots = isFmaskCopy ? 3 : 2;
-        uint32* pUserData = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
-                                                                   (SrdDwordAlignment() * numSlots +
-                                                                    RpmUtil::CopyImageInfoDwords),
-                                                                   SrdDwordAlignment(),
-                                                                   PipelineBindPoint::Compute,
-                                                                   0);
+            // 3D images can't have slices and non-3D images shouldn't specify depth > 1 so we expect at least one
+            // of them to be set to 1.
+            PAL_ASSERT((copyRegion.numSlices == 1) || (copyRegion.extent.depth == 1));
 
-        // When we treat 3D images as 2D arrays each z-slice must be treated as an array slice.
-        const uint32 numSlices = (imageType == ImageType::Tex3d) ? copyRegion.extent.depth : copyRegion.numSlices;
+            if (p2pBltInfoRequired)
+            {
+                pCmdBuffer->P2pBltWaCopyNextRegion(chunkAddrs[idx]);
+            }
 
-        ImageViewInfo imageView[2] = {};
-        SubresRange   viewRange    = { copyRegion.dstSubres, 1, numSlices };
+            // Setup image formats per-region. This is different than the graphics path because the compute path must be
+            // able to copy depth-stencil images.
+            SwizzledFormat dstFormat  = {};
+            SwizzledFormat srcFormat  = {};
+            uint32         texelScale = 1;
 
-        RpmUtil::BuildImageViewInfo(&imageView[0], dstImage, viewRange, dstFormat, true, device.TexOptLevel());
+            GetCopyImageFormats(srcImage,
+                                srcImageLayout,
+                                dstImage,
+                                dstImageLayout,
+                                copyRegion,
+                                flags,
+                                &srcFormat,
+                                &dstFormat,
+                                &texelScale);
 
-        viewRange.startSubres = copyRegion.srcSubres;
-        RpmUtil::BuildImageViewInfo(&imageView[1], srcImage, viewRange, srcFormat, false, device.TexOptLevel());
+            // The hardware can't handle UAV stores using SRGB num format.  The resolve shaders already contain a
+            // linear-to-gamma conversion, but in order for that to work the output UAV's num format must be patched to
+            // be simple unorm.
+            if (Formats::IsSrgb(dstFormat.format))
+            {
+                dstFormat.format = Formats::ConvertToUnorm(dstFormat.format);
+                PAL_ASSERT(Formats::IsUndefined(dstFormat.format) == false);
+            }
 
-        // The shader treats all images as 2D arrays which means we need to override the view type to 2D. We also used
-        // to do this for 3D images but that caused test failures when the images used mipmaps because the HW expected
-        // the "numSlices" to be constant for all mip levels (rather than halving at each mip as z-slices do).
-        //
-        // Is it legal for the shader to view 1D and 3D images as 2D?
-        if (imageType == ImageType::Tex1d)
-        {
-            imageView[0].viewType = ImageViewType::Tex2d;
-            imageView[1].viewType = ImageViewType::Tex2d;
-        }
+            // Multiply all x-dimension values in our region by the texel scale.
+            copyRegion.srcOffset.x  *= texelScale;
+            copyRegion.dstOffset.x  *= texelScale;
+            copyRegion.extent.width *= texelScale;
 
-        if (useMipInSrd == false)
-        {
-            // The miplevel as specified in the shader instruction is actually an offset from the mip-level
-            // as specified in the SRD.
-            imageView[0].subresRange.startSubres.mipLevel = 0;  // dst
-            imageView[1].subresRange.startSubres.mipLevel = 0;  // src
+            RpmUtil::CopyImageInfo copyImageInfo    = {};
+            copyImageInfo.srcOffset                 = copyRegion.srcOffset;
+            copyImageInfo.dstOffset                 = copyRegion.dstOffset;
+            copyImageInfo.numSamples                = dstCreateInfo.samples;
+            copyImageInfo.packedMipData.srcMipLevel = copyRegion.srcSubres.mipLevel;
+            copyImageInfo.packedMipData.dstMipLevel = copyRegion.dstSubres.mipLevel;
+            copyImageInfo.copyRegion.width          = copyRegion.extent.width;
+            copyImageInfo.copyRegion.height         = copyRegion.extent.height;
 
-            // The mip-level from the instruction is also clamped to the "last level" as specified in the SRD.
-            imageView[0].subresRange.numMips = copyRegion.dstSubres.mipLevel + viewRange.numMips;
-            imageView[1].subresRange.numMips = copyRegion.srcSubres.mipLevel + viewRange.numMips;
-        }
+            // Create an embedded user-data table and bind it to user data 0. We need image views for the src and dst
+            // subresources, as well as some inline constants for the copy offsets and extents.
+            const uint8 numSlots = isFmaskCopy ? 3 : 2;
+            uint32* pUserData = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
+                                                                       (SrdDwordAlignment() * numSlots +
+                                                                        RpmUtil::CopyImageInfoDwords),
+                                                                       SrdDwordAlignment(),
+                                                                       PipelineBindPoint::Compute,
+                                                                       0);
 
-        // Turn our image views into HW SRDs here
-        device.CreateImageViewSrds(2, &imageView[0], pUserData);
-        pUserData += SrdDwordAlignment() * 2;
+            // When we treat 3D images as 2D arrays each z-slice must be treated as an array slice.
+            const uint32 numSlices = (imageType == ImageType::Tex3d) ? copyRegion.extent.depth : copyRegion.numSlices;
 
-        if (isFmaskCopy)
-        {
-            // If this is an Fmask-accelerated Copy, create an image view of the source Image's Fmask surface.
-            FmaskViewInfo fmaskView = {};
-            fmaskView.pImage         = &srcImage;
-            fmaskView.baseArraySlice = copyRegion.srcSubres.arraySlice;
-            fmaskView.arraySize      = copyRegion.numSlices;
+            ImageViewInfo imageView[2] = {};
+            SubresRange   viewRange    = { copyRegion.dstSubres, 1, numSlices };
 
-            m_pDevice->Parent()->CreateFmaskViewSrds(1, &fmaskView, pUserData);
-            pUserData += SrdDwordAlignment();
-        }
+            RpmUtil::BuildImageViewInfo(&imageView[0], dstImage, viewRange, dstFormat, true, device.TexOptLevel());
 
-        // Copy the copy parameters into the embedded user-data space
-        memcpy(pUserData, &copyImageInfo, sizeof(copyImageInfo));
+            viewRange.startSubres = copyRegion.srcSubres;
+            RpmUtil::BuildImageViewInfo(&imageView[1], srcImage, viewRange, srcFormat, false, device.TexOptLevel());
+
+            // The shader treats all images as 2D arrays which means we need to override the view type to 2D. We also
+            // used to do this for 3D images but that caused test failures when the images used mipmaps because the HW
+            // expected the "numSlices" to be constant for all mip levels (rather than halving at each mip as z-slices
+            // do).
+            //
+            // Is it legal for the shader to view 1D and 3D images as 2D?
+            if (imageType == ImageType::Tex1d)
+            {
+                imageView[0].viewType = ImageViewType::Tex2d;
+                imageView[1].viewType = ImageViewType::Tex2d;
+            }
 
-        // Execute the dispatch, we need one thread per texel.
-        pCmdBuffer->CmdDispatch(RpmUtil::MinThreadGroups(copyRegion.extent.width,  threadsPerGroup[0]),
-                                RpmUtil::MinThreadGroups(copyRegion.extent.height, threadsPerGroup[1]),
-                                RpmUtil::MinThreadGroups(numSlices,                threadsPerGroup[2]));
-    }
+            if (useMipInSrd == false)
+            {
+                // The miplevel as specified in the shader instruction is actually an offset from the mip-level
+                // as specified in the SRD.
+                imageView[0].subresRange.startSubres.mipLevel = 0;  // dst
+                imageView[1].subresRange.startSubres.mipLevel = 0;  // src
+
+                // The mip-level from the instruction is also clamped to the "last level" as specified in the SRD.
+                imageView[0].subresRange.numMips = copyRegion.dstSubres.mipLevel + viewRange.numMips;
+                imageView[1].subresRange.numMips = copyRegion.srcSubres.mipLevel + viewRange.numMips;
+            }
 
-    if (p2pBltInfoRequired)
-    {
-        pCmdBuffer->P2pBltWaCopyEnd();
-    }
+            // Turn our image views into HW SRDs here
+            device.CreateImageViewSrds(2, &imageView[0], pUserData);
+            pUserData += SrdDwordAlignment() * 2;
 
-    pCmdBuffer->CmdRestoreComputeState(ComputeStatePipelineAndUserData);
+            if (isFmaskCopy)
+            {
+                // If this is an Fmask-accelerated Copy, create an image view of the source Image's Fmask surface.
+                FmaskViewInfo fmaskView = {};
+                fmaskView.pImage         = &srcImage;
+                fmaskView.baseArraySlice = copyRegion.srcSubres.arraySlice;
+                fmaskView.arraySize      = copyRegion.numSlices;
 
-    if (isFmaskCopyOptimized)
-    {
-        // If this is MSAA copy optimized we might have to update destination image meta data
-        HwlUpdateDstImageMetaData(pCmdBuffer, srcImage, dstImage, regionCount, pRegions, flags);
+                m_pDevice->Parent()->CreateFmaskViewSrds(1, &fmaskView, pUserData);
+                pUserData += SrdDwordAlignment();
+            }
+
+            // Copy the copy parameters into the embedded user-data space
+            memcpy(pUserData, &copyImageInfo, sizeof(copyImageInfo));
+
+            // Execute the dispatch, we need one thread per texel.
+            pCmdBuffer->CmdDispatch(RpmUtil::MinThreadGroups(copyRegion.extent.width,  threadsPerGroup[0]),
+                                    RpmUtil::MinThreadGroups(copyRegion.extent.height, threadsPerGroup[1]),
+                                    RpmUtil::MinThreadGroups(numSlices,                threadsPerGroup[2]));
+        }
+
+        if (p2pBltInfoRequired)
+        {
+            pCmdBuffer->P2pBltWaCopyEnd();
+        }
+
+        pCmdBuffer->CmdRestoreComputeState(ComputeStatePipelineAndUserData);
+
+        if (isFmaskCopyOptimized)
+        {
+            // If this is MSAA copy optimized we might have to update destination image meta data
+            HwlUpdateDstImageMetaData(pCmdBuffer, srcImage, dstImage, regionCount, pRegions, flags);
+        }
     }
 }
 
@@ -1404,44 +1607,47 @@ void RsrcProcMgr::CmdCopyMemoryToImage(
     switch (dstImage.GetGfxImage()->GetOverrideImageType())
     {
     case ImageType::Tex1d:
-        pPipeline = GetPipeline(RpmComputePipeline::CopyMemToImg1d);
+        pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::CopyMemToImg1d);
         break;
 
     case ImageType::Tex2d:
         switch (createInfo.fragments)
         {
         case 2:
-            pPipeline = GetPipeline(RpmComputePipeline::CopyMemToImg2dms2x);
+            pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::CopyMemToImg2dms2x);
             break;
 
         case 4:
-            pPipeline = GetPipeline(RpmComputePipeline::CopyMemToImg2dms4x);
+            pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::CopyMemToImg2dms4x);
             break;
 
         case 8:
-            pPipeline = GetPipeline(RpmComputePipeline::CopyMemToImg2dms8x);
+            pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::CopyMemToImg2dms8x);
             break;
 
         default:
-            pPipeline = GetPipeline(RpmComputePipeline::CopyMemToImg2d);
+            pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::CopyMemToImg2d);
             break;
         }
         break;
 
     default:
-        pPipeline = GetPipeline(RpmComputePipeline::CopyMemToImg3d);
+        pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::CopyMemToImg3d);
         break;
     }
 
-    CopyBetweenMemoryAndImage(pCmdBuffer,
-                              pPipeline,
-                              srcGpuMemory,
-                              dstImage,
-                              dstImageLayout,
-                              true,
-                              regionCount,
-                              pRegions,
-                              includePadding);
+    if (pPipeline != nullptr)
+    {
+        CopyBetweenMemoryAndImage(pCmdBuffer,
+                                  pPipeline,
+                                  srcGpuMemory,
+                                  dstImage,
+                                  dstImageLayout,
+                                  true,
+                                  regionCount,
+                                  pRegions,
+                                  includePadding);
+    }
 }
 
 // =====================================================================================================================
@@ -1463,44 +1669,47 @@ void RsrcProcMgr::CmdCopyImageToMemory(
     switch (srcImage.GetGfxImage()->GetOverrideImageType())
     {
     case ImageType::Tex1d:
-        pPipeline = GetPipeline(RpmComputePipeline::CopyImgToMem1d);
+        pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::CopyImgToMem1d);
         break;
 
     case ImageType::Tex2d:
         switch (createInfo.fragments)
         {
         case 2:
-            pPipeline = GetPipeline(RpmComputePipeline::CopyImgToMem2dms2x);
+            pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::CopyImgToMem2dms2x);
             break;
 
         case 4:
-            pPipeline = GetPipeline(RpmComputePipeline::CopyImgToMem2dms4x);
+            pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::CopyImgToMem2dms4x);
             break;
 
         case 8:
-            pPipeline = GetPipeline(RpmComputePipeline::CopyImgToMem2dms8x);
+            pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::CopyImgToMem2dms8x);
             break;
 
         default:
-            pPipeline = GetPipeline(RpmComputePipeline::CopyImgToMem2d);
+            pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::CopyImgToMem2d);
             break;
         }
         break;
 
     default:
-        pPipeline = GetPipeline(RpmComputePipeline::CopyImgToMem3d);
+        pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::CopyImgToMem3d);
         break;
     }
 
-    CopyBetweenMemoryAndImage(pCmdBuffer,
-                              pPipeline,
-                              dstGpuMemory,
-                              srcImage,
-                              srcImageLayout,
-                              false,
-                              regionCount,
-                              pRegions,
-                              includePadding);
+    if (pPipeline != nullptr)
+    {
+        CopyBetweenMemoryAndImage(pCmdBuffer,
+                                  pPipeline,
+                                  dstGpuMemory,
+                                  srcImage,
+                                  srcImageLayout,
+                                  false,
+                                  regionCount,
+                                  pRegions,
+                                  includePadding);
+    }
 }
 
 // =====================================================================================================================
@@ -1776,7 +1985,7 @@ void RsrcProcMgr::CmdCopyTypedBuffer(
 
         if (copyExtent.depth > 1)
         {
-            pPipeline   = GetPipeline(RpmComputePipeline::CopyTypedBuffer3d);
+            pPipeline   = GetPipeline(pCmdBuffer, RpmComputePipeline::CopyTypedBuffer3d);
             userData[0] = dstRowPitch;
             userData[1] = dstDepthPitch;
             userData[2] = srcRowPitch;
@@ -1788,7 +1997,7 @@ void RsrcProcMgr::CmdCopyTypedBuffer(
         }
         else if (copyExtent.height > 1)
         {
-            pPipeline   = GetPipeline(RpmComputePipeline::CopyTypedBuffer2d);
+            pPipeline   = GetPipeline(pCmdBuffer, RpmComputePipeline::CopyTypedBuffer2d);
             userData[0] = dstRowPitch;
             userData[1] = srcRowPitch;
             userData[2] = copyExtent.width;
@@ -1797,12 +2006,15 @@ void RsrcProcMgr::CmdCopyTypedBuffer(
         }
         else
         {
-            pPipeline   = GetPipeline(RpmComputePipeline::CopyTypedBuffer1d);
+            pPipeline   = GetPipeline(pCmdBuffer, RpmComputePipeline::CopyTypedBuffer1d);
             userData[0] = copyExtent.width;
             numUserData = 1;
         }
 
-        PAL_ASSERT(pPipeline != nullptr);
+        if (pPipeline == nullptr)
+        {
+            continue;
+        }
 
         // Change pipeline bindings if necessary.
         if (pPrevPipeline != pPipeline)
@@ -1869,7 +2081,7 @@ void RsrcProcMgr::CmdScaledCopyImage(
     const ComputePipeline* pPipeline = nullptr;
     if (is3d)
     {
-        pPipeline = GetPipeline(RpmComputePipeline::ScaledCopyImage3d);
+        pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::ScaledCopyImage3d);
     }
     else
     {
@@ -1879,281 +2091,288 @@ void RsrcProcMgr::CmdScaledCopyImage(
             // EQAA images or MSAA images with FMask disabled are unsupported for scaled copy. There is no use case for
             // EQAA and it would require several new shaders. It can be implemented if needed at a future point.
             PAL_ASSERT((srcInfo.samples == srcInfo.fragments) && (pSrcImage->IsMetadataDisabled() == false));
-            pPipeline = GetPipeline(RpmComputePipeline::MsaaFmaskScaledCopy);
+            pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaFmaskScaledCopy);
             isFmaskCopy = true;
         }
         else
         {
-            pPipeline = GetPipeline(RpmComputePipeline::ScaledCopyImage2d);
+            pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::ScaledCopyImage2d);
         }
     }
 
-    // Get number of threads per groups in each dimension, we will need this data later.
-    uint32 threadsPerGroup[3] = {0};
-    pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
+    if (pPipeline != nullptr)
+    {
+        // Get number of threads per groups in each dimension, we will need this data later.
+        uint32 threadsPerGroup[3] = {0};
+        pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
 
-    // Save current command buffer state and bind the pipeline.
-    pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
-    pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
+        // Save current command buffer state and bind the pipeline.
+        pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
+        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
 
-    uint32 colorKey[4]          = {0};
-    uint32 alphaDiffMul         = 0;
-    float  threshold            = 0.0f;
-    uint32 colorKeyEnableMask   = 0;
-    uint32 alphaBlendEnableMask = 0;
+        uint32 colorKey[4]          = {0};
+        uint32 alphaDiffMul         = 0;
+        float  threshold            = 0.0f;
+        uint32 colorKeyEnableMask   = 0;
+        uint32 alphaBlendEnableMask = 0;
 
-    if (copyInfo.flags.srcColorKey)
-    {
-        colorKeyEnableMask = 1;
-    }
-    else if (copyInfo.flags.dstColorKey)
-    {
-        colorKeyEnableMask = 2;
-    }
+        if (copyInfo.flags.srcColorKey)
+        {
+            colorKeyEnableMask = 1;
+        }
+        else if (copyInfo.flags.dstColorKey)
+        {
+            colorKeyEnableMask = 2;
+        }
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 349
-    else if (copyInfo.flags.srcAlpha)
-    {
-        alphaBlendEnableMask = 4;
-    }
+        else if (copyInfo.flags.srcAlpha)
+        {
+            alphaBlendEnableMask = 4;
+        }
 #endif
 
-    if (colorKeyEnableMask > 0)
-    {
-        const bool srcColorKey = (colorKeyEnableMask == 1);
-
-        PAL_ASSERT(copyInfo.pColorKey != nullptr);
-        PAL_ASSERT(srcInfo.imageType == ImageType::Tex2d);
-        PAL_ASSERT(dstInfo.imageType == ImageType::Tex2d);
-        PAL_ASSERT(srcInfo.samples <= 1);
-        PAL_ASSERT(dstInfo.samples <= 1);
-        PAL_ASSERT(pPipeline == GetPipeline(RpmComputePipeline::ScaledCopyImage2d));
-
-        memcpy(&colorKey[0], &copyInfo.pColorKey->u32Color[0], sizeof(colorKey));
+        if (colorKeyEnableMask > 0)
+        {
+            const bool srcColorKey = (colorKeyEnableMask == 1);
 
-        // Convert uint color key to float representation
-        SwizzledFormat format = srcColorKey ? srcInfo.swizzledFormat : dstInfo.swizzledFormat;
-        RpmUtil::ConvertClearColorToNativeFormat(format, format, colorKey);
+            PAL_ASSERT(copyInfo.pColorKey != nullptr);
+            PAL_ASSERT(srcInfo.imageType == ImageType::Tex2d);
+            PAL_ASSERT(dstInfo.imageType == ImageType::Tex2d);
+            PAL_ASSERT(srcInfo.samples <= 1);
+            PAL_ASSERT(dstInfo.samples <= 1);
+            PAL_ASSERT(pPipeline == GetPipeline(pCmdBuffer, RpmComputePipeline::ScaledCopyImage2d));
 
-        // Set constant to respect or ignore alpha channel color diff
-        constexpr uint32 FloatOne = 0x3f800000;
-        alphaDiffMul = Formats::HasUnusedAlpha(format) ? 0 : FloatOne;
+            memcpy(&colorKey[0], &copyInfo.pColorKey->u32Color[0], sizeof(colorKey));
 
-        // Compute the threshold for comparing 2 float value
-        const uint32 bitCount = Formats::MaxComponentBitCount(format.format);
-        threshold = static_cast<float>(pow(2, -2.0f * bitCount) - pow(2, -2.0f * bitCount - 24.0f));
-    }
+            // Convert uint color key to float representation
+            SwizzledFormat format = srcColorKey ? srcInfo.swizzledFormat : dstInfo.swizzledFormat;
+            RpmUtil::ConvertClearColorToNativeFormat(format, format, colorKey);
 
-    // Now begin processing the list of copy regions.
-    for (uint32 idx = 0; idx < copyInfo.regionCount; ++idx)
-    {
-        ImageScaledCopyRegion copyRegion = copyInfo.pRegions[idx];
+            // Set constant to respect or ignore alpha channel color diff
+            constexpr uint32 FloatOne = 0x3f800000;
+            alphaDiffMul = Formats::HasUnusedAlpha(format) ? 0 : FloatOne;
 
-        // Calculate the absolute value of dstExtent, which will get fed to the shader.
-        const uint32 dstExtentW = Math::Absu(copyRegion.dstExtent.width);
-        const uint32 dstExtentH = Math::Absu(copyRegion.dstExtent.height);
-        const uint32 dstExtentD = Math::Absu(copyRegion.dstExtent.depth);
+            // Compute the threshold for comparing 2 float value
+            const uint32 bitCount = Formats::MaxComponentBitCount(format.format);
+            threshold = static_cast<float>(pow(2, -2.0f * bitCount) - pow(2, -2.0f * bitCount - 24.0f));
+        }
 
-        if ((dstExtentW > 0) && (dstExtentH > 0) && (dstExtentD > 0))
+        // Now begin processing the list of copy regions.
+        for (uint32 idx = 0; idx < copyInfo.regionCount; ++idx)
         {
-            // A negative extent means that we should do a reverse the copy.
-            // We want to always use the absolute value of dstExtent.
-            // otherwise the compute shader can't handle it. If dstExtent is negative in one
-            // dimension, then we negate srcExtent in that dimension, and we adjust the offsets
-            // as well.
-            if (copyRegion.dstExtent.width < 0)
-            {
-                copyRegion.dstOffset.x = copyRegion.dstOffset.x + copyRegion.dstExtent.width;
-                copyRegion.srcOffset.x = copyRegion.srcOffset.x + copyRegion.srcExtent.width;
-                copyRegion.srcExtent.width = -copyRegion.srcExtent.width;
-            }
+            ImageScaledCopyRegion copyRegion = copyInfo.pRegions[idx];
 
-            if (copyRegion.dstExtent.height < 0)
-            {
-                copyRegion.dstOffset.y = copyRegion.dstOffset.y + copyRegion.dstExtent.height;
-                copyRegion.srcOffset.y = copyRegion.srcOffset.y + copyRegion.srcExtent.height;
-                copyRegion.srcExtent.height = -copyRegion.srcExtent.height;
-            }
+            // Calculate the absolute value of dstExtent, which will get fed to the shader.
+            const uint32 dstExtentW = Math::Absu(copyRegion.dstExtent.width);
+            const uint32 dstExtentH = Math::Absu(copyRegion.dstExtent.height);
+            const uint32 dstExtentD = Math::Absu(copyRegion.dstExtent.depth);
 
-            if (copyRegion.dstExtent.depth < 0)
+            if ((dstExtentW > 0) && (dstExtentH > 0) && (dstExtentD > 0))
             {
-                copyRegion.dstOffset.z = copyRegion.dstOffset.z + copyRegion.dstExtent.depth;
-                copyRegion.srcOffset.z = copyRegion.srcOffset.z + copyRegion.srcExtent.depth;
-                copyRegion.srcExtent.depth = -copyRegion.srcExtent.depth;
-            }
-
-            // The shader expects the region data to be arranged as follows for each dispatch:
-            // Src Normalized Left,  Src Normalized Top,   Src Normalized Start-Z (3D) or slice (1D/2D), extent width
-            // Dst Pixel X offset,   Dst Pixel Y offset,   Dst Z offset (3D) or slice (1D/2D),           extent height
-            // Src Normalized Right, SrcNormalized Bottom, Src Normalized End-Z   (3D),                  extent depth
-
-            // For 3D blts, the source Z-values are normalized as the X and Y values are for 1D, 2D, and 3D.
-
-            const Extent3d& srcExtent = pSrcImage->SubresourceInfo(copyRegion.srcSubres)->extentTexels;
-            const float srcLeft   = (1.f * copyRegion.srcOffset.x) / srcExtent.width;
-            const float srcTop    = (1.f * copyRegion.srcOffset.y) / srcExtent.height;
-            const float srcSlice  = (1.f * copyRegion.srcOffset.z) / srcExtent.depth;
-            const float srcRight  = (1.f * (copyRegion.srcOffset.x + copyRegion.srcExtent.width))  / srcExtent.width;
-            const float srcBottom = (1.f * (copyRegion.srcOffset.y + copyRegion.srcExtent.height)) / srcExtent.height;
-            const float srcDepth  = (1.f * (copyRegion.srcOffset.z + copyRegion.srcExtent.depth))  / srcExtent.depth;
-
-            PAL_ASSERT((srcLeft   >= 0.0f) && (srcLeft   <= 1.0f) &&
-                       (srcTop    >= 0.0f) && (srcTop    <= 1.0f) &&
-                       (srcSlice  >= 0.0f) && (srcSlice  <= 1.0f) &&
-                       (srcRight  >= 0.0f) && (srcRight  <= 1.0f) &&
-                       (srcBottom >= 0.0f) && (srcBottom <= 1.0f) &&
-                       (srcDepth  >= 0.0f) && (srcDepth  <= 1.0f));
-
-            SwizzledFormat dstFormat = pDstImage->SubresourceInfo(copyRegion.dstSubres)->format;
-            SwizzledFormat srcFormat = pSrcImage->SubresourceInfo(copyRegion.srcSubres)->format;
+                // A negative extent means that we should do a reverse the copy.
+                // We want to always use the absolute value of dstExtent.
+                // otherwise the compute shader can't handle it. If dstExtent is negative in one
+                // dimension, then we negate srcExtent in that dimension, and we adjust the offsets
+                // as well.
+                if (copyRegion.dstExtent.width < 0)
+                {
+                    copyRegion.dstOffset.x = copyRegion.dstOffset.x + copyRegion.dstExtent.width;
+                    copyRegion.srcOffset.x = copyRegion.srcOffset.x + copyRegion.srcExtent.width;
+                    copyRegion.srcExtent.width = -copyRegion.srcExtent.width;
+                }
 
-            const uint32 zfilter   = copyInfo.filter.zFilter;
-            const uint32 magfilter = copyInfo.filter.magnification;
-            const uint32 minfilter = copyInfo.filter.minification;
+                if (copyRegion.dstExtent.height < 0)
+                {
+                    copyRegion.dstOffset.y = copyRegion.dstOffset.y + copyRegion.dstExtent.height;
+                    copyRegion.srcOffset.y = copyRegion.srcOffset.y + copyRegion.srcExtent.height;
+                    copyRegion.srcExtent.height = -copyRegion.srcExtent.height;
+                }
 
-            float zOffset = 0.0f;
+                if (copyRegion.dstExtent.depth < 0)
+                {
+                    copyRegion.dstOffset.z = copyRegion.dstOffset.z + copyRegion.dstExtent.depth;
+                    copyRegion.srcOffset.z = copyRegion.srcOffset.z + copyRegion.srcExtent.depth;
+                    copyRegion.srcExtent.depth = -copyRegion.srcExtent.depth;
+                }
 
-            if (zfilter == ZFilterNone)
-            {
-                if ((magfilter != XyFilterPoint) || (minfilter != XyFilterPoint))
+                // The shader expects the region data to be arranged as follows for each dispatch:
+                // Src Norm. Left,     Src Norm. Top,      Src Norm. Start-Z (3D) or slice (1D/2D), extent width
+                // Dst Pixel X offset, Dst Pixel Y offset, Dst Z offset (3D) or slice (1D/2D),      extent height
+                // Src Norm. Right,    Src Norm. Bottom,   Src Norm. End-Z   (3D),                  extent depth
+
+                // For 3D blts, the source Z-values are normalized as the X and Y values are for 1D, 2D, and 3D.
+
+                const Extent3d& srcExtent = pSrcImage->SubresourceInfo(copyRegion.srcSubres)->extentTexels;
+                const float srcLeft   = (1.f * copyRegion.srcOffset.x) / srcExtent.width;
+                const float srcTop    = (1.f * copyRegion.srcOffset.y) / srcExtent.height;
+                const float srcSlice  = (1.f * copyRegion.srcOffset.z) / srcExtent.depth;
+                const float srcRight  =
+                    (1.f * (copyRegion.srcOffset.x + copyRegion.srcExtent.width))  / srcExtent.width;
+                const float srcBottom =
+                    (1.f * (copyRegion.srcOffset.y + copyRegion.srcExtent.height)) / srcExtent.height;
+                const float srcDepth  =
+                    (1.f * (copyRegion.srcOffset.z + copyRegion.srcExtent.depth))  / srcExtent.depth;
+
+                PAL_ASSERT((srcLeft   >= 0.0f) && (srcLeft   <= 1.0f) &&
+                           (srcTop    >= 0.0f) && (srcTop    <= 1.0f) &&
+                           (srcSlice  >= 0.0f) && (srcSlice  <= 1.0f) &&
+                           (srcRight  >= 0.0f) && (srcRight  <= 1.0f) &&
+                           (srcBottom >= 0.0f) && (srcBottom <= 1.0f) &&
+                           (srcDepth  >= 0.0f) && (srcDepth  <= 1.0f));
+
+                SwizzledFormat dstFormat = pDstImage->SubresourceInfo(copyRegion.dstSubres)->format;
+                SwizzledFormat srcFormat = pSrcImage->SubresourceInfo(copyRegion.srcSubres)->format;
+
+                const uint32 zfilter   = copyInfo.filter.zFilter;
+                const uint32 magfilter = copyInfo.filter.magnification;
+                const uint32 minfilter = copyInfo.filter.minification;
+
+                float zOffset = 0.0f;
+
+                if (zfilter == ZFilterNone)
+                {
+                    if ((magfilter != XyFilterPoint) || (minfilter != XyFilterPoint))
+                    {
+                        zOffset = 0.5f;
+                    }
+                }
+                else if (zfilter != ZFilterPoint)
                 {
                     zOffset = 0.5f;
                 }
-            }
-            else if (zfilter != ZFilterPoint)
-            {
-                zOffset = 0.5f;
-            }
-
-            // RotationParams contains the parameters to rotate 2d texture cooridnates.
-            // Given 2d texture coordinates (u, v), we use following equations to compute rotated coordinates (u', v'):
-            // u' = RotationParams[0] * u + RotationParams[1] * v + RotationParams[4]
-            // v' = RotationParams[2] * u + RotationParams[3] * v + RotationParams[5]
-            constexpr float RotationParams[static_cast<uint32>(ImageRotation::Count)][6] =
-            {
-                { 1.0f,  0.0f,  0.0f,  1.0f, 0.0f, 0.0f},
-                { 0.0f, -1.0f,  1.0f,  0.0f, 1.0f, 0.0f},
-                {-1.0f,  0.0f,  0.0f, -1.0f, 1.0f, 1.0f},
-                { 0.0f,  1.0f, -1.0f,  0.0f, 0.0f, 1.0f},
-            };
 
-            const uint32 rotationIndex = static_cast<const uint32>(copyInfo.rotation);
-
-            // Enable gamma conversion when dstFormat is Srgb, but only if srcFormat is not Srgb-as-Unorm.
-            // Because the Srgb-as-Unorm sample is still gamma compressed and therefore no additional
-            // conversion before shader export is needed.
-            const uint32_t enableGammaConversion =
-                (Formats::IsSrgb(dstFormat.format) && (flags.srcSrgbAsUnorm == 0)) ? 1 : 0;
+                // RotationParams contains the parameters to rotate 2d texture cooridnates.
+                // Given 2d texture coordinates (u, v), we use following equations to compute rotated coordinates
+                // (u', v'):
+                // u' = RotationParams[0] * u + RotationParams[1] * v + RotationParams[4]
+                // v' = RotationParams[2] * u + RotationParams[3] * v + RotationParams[5]
+                constexpr float RotationParams[static_cast<uint32>(ImageRotation::Count)][6] =
+                {
+                    { 1.0f,  0.0f,  0.0f,  1.0f, 0.0f, 0.0f},
+                    { 0.0f, -1.0f,  1.0f,  0.0f, 1.0f, 0.0f},
+                    {-1.0f,  0.0f,  0.0f, -1.0f, 1.0f, 1.0f},
+                    { 0.0f,  1.0f, -1.0f,  0.0f, 0.0f, 1.0f},
+                };
 
-            const uint32 copyData[] =
-            {
-                reinterpret_cast<const uint32&>(srcLeft),
-                reinterpret_cast<const uint32&>(srcTop),
-                static_cast<uint32>(copyRegion.srcOffset.z),
-                dstExtentW,
-                static_cast<uint32>(copyRegion.dstOffset.x),
-                static_cast<uint32>(copyRegion.dstOffset.y),
-                static_cast<uint32>(copyRegion.dstOffset.z),
-                dstExtentH,
-                reinterpret_cast<const uint32&>(srcRight),
-                reinterpret_cast<const uint32&>(srcBottom),
-                reinterpret_cast<const uint32&>(srcDepth),
-                dstExtentD,
-                enableGammaConversion,
-                reinterpret_cast<const uint32&>(zOffset),
-                srcInfo.samples,
-                (colorKeyEnableMask | alphaBlendEnableMask),
-                reinterpret_cast<const uint32&>(RotationParams[rotationIndex][0]),
-                reinterpret_cast<const uint32&>(RotationParams[rotationIndex][1]),
-                reinterpret_cast<const uint32&>(RotationParams[rotationIndex][2]),
-                reinterpret_cast<const uint32&>(RotationParams[rotationIndex][3]),
-                reinterpret_cast<const uint32&>(RotationParams[rotationIndex][4]),
-                reinterpret_cast<const uint32&>(RotationParams[rotationIndex][5]),
-                alphaDiffMul,
-                Util::Math::FloatToBits(threshold),
-                colorKey[0],
-                colorKey[1],
-                colorKey[2],
-                colorKey[3],
-            };
+                const uint32 rotationIndex = static_cast<const uint32>(copyInfo.rotation);
 
-            // Create an embedded user-data table and bind it to user data 0. We need image views for the src and dst
-            // subresources, a sampler for the src subresource, as well as some inline constants for the copy offsets
-            // and extents.
-            const uint32 DataDwords = NumBytesToNumDwords(sizeof(copyData));
-            const uint8 numSlots = isFmaskCopy ? 4 : 3;
-            uint32*      pUserData  = RpmUtil::CreateAndBindEmbeddedUserData(
-                                                    pCmdBuffer,
-                                                    SrdDwordAlignment() * numSlots + DataDwords,
-                                                    SrdDwordAlignment(),
-                                                    PipelineBindPoint::Compute,
-                                                    0);
+                // Enable gamma conversion when dstFormat is Srgb, but only if srcFormat is not Srgb-as-Unorm.
+                // Because the Srgb-as-Unorm sample is still gamma compressed and therefore no additional
+                // conversion before shader export is needed.
+                const uint32_t enableGammaConversion =
+                    (Formats::IsSrgb(dstFormat.format) && (flags.srcSrgbAsUnorm == 0)) ? 1 : 0;
 
-            // The hardware can't handle UAV stores using SRGB num format.  The resolve shaders already contain a
-            // linear-to-gamma conversion, but in order for that to work the output UAV's num format must be patched to
-            // be simple unorm.
-            if (Formats::IsSrgb(dstFormat.format))
-            {
-                dstFormat.format = Formats::ConvertToUnorm(dstFormat.format);
-                PAL_ASSERT(Formats::IsUndefined(dstFormat.format) == false);
-            }
+                const uint32 copyData[] =
+                {
+                    reinterpret_cast<const uint32&>(srcLeft),
+                    reinterpret_cast<const uint32&>(srcTop),
+                    static_cast<uint32>(copyRegion.srcOffset.z),
+                    dstExtentW,
+                    static_cast<uint32>(copyRegion.dstOffset.x),
+                    static_cast<uint32>(copyRegion.dstOffset.y),
+                    static_cast<uint32>(copyRegion.dstOffset.z),
+                    dstExtentH,
+                    reinterpret_cast<const uint32&>(srcRight),
+                    reinterpret_cast<const uint32&>(srcBottom),
+                    reinterpret_cast<const uint32&>(srcDepth),
+                    dstExtentD,
+                    enableGammaConversion,
+                    reinterpret_cast<const uint32&>(zOffset),
+                    srcInfo.samples,
+                    (colorKeyEnableMask | alphaBlendEnableMask),
+                    reinterpret_cast<const uint32&>(RotationParams[rotationIndex][0]),
+                    reinterpret_cast<const uint32&>(RotationParams[rotationIndex][1]),
+                    reinterpret_cast<const uint32&>(RotationParams[rotationIndex][2]),
+                    reinterpret_cast<const uint32&>(RotationParams[rotationIndex][3]),
+                    reinterpret_cast<const uint32&>(RotationParams[rotationIndex][4]),
+                    reinterpret_cast<const uint32&>(RotationParams[rotationIndex][5]),
+                    alphaDiffMul,
+                    Util::Math::FloatToBits(threshold),
+                    colorKey[0],
+                    colorKey[1],
+                    colorKey[2],
+                    colorKey[3],
+                };
+
+                // Create an embedded user-data table and bind it to user data 0. We need image views for the src and
+                // dst subresources, a sampler for the src subresource, as well as some inline constants for the copy
+                // offsets and extents.
+                const uint32 DataDwords = NumBytesToNumDwords(sizeof(copyData));
+                const uint8 numSlots = isFmaskCopy ? 4 : 3;
+                uint32*      pUserData  = RpmUtil::CreateAndBindEmbeddedUserData(
+                                                        pCmdBuffer,
+                                                        SrdDwordAlignment() * numSlots + DataDwords,
+                                                        SrdDwordAlignment(),
+                                                        PipelineBindPoint::Compute,
+                                                        0);
+
+                // The hardware can't handle UAV stores using SRGB num format.  The resolve shaders already contain a
+                // linear-to-gamma conversion, but in order for that to work the output UAV's num format must be patched
+                // to be simple unorm.
+                if (Formats::IsSrgb(dstFormat.format))
+                {
+                    dstFormat.format = Formats::ConvertToUnorm(dstFormat.format);
+                    PAL_ASSERT(Formats::IsUndefined(dstFormat.format) == false);
+                }
 
-            if (flags.srcSrgbAsUnorm)
-            {
-                srcFormat.format = Formats::ConvertToUnorm(srcFormat.format);
-            }
+                if (flags.srcSrgbAsUnorm)
+                {
+                    srcFormat.format = Formats::ConvertToUnorm(srcFormat.format);
+                }
 
-            ImageViewInfo imageView[2] = {};
-            SubresRange   viewRange    = { copyRegion.dstSubres, 1, copyRegion.numSlices };
+                ImageViewInfo imageView[2] = {};
+                SubresRange   viewRange    = { copyRegion.dstSubres, 1, copyRegion.numSlices };
 
-            RpmUtil::BuildImageViewInfo(
-                &imageView[0], *pDstImage, viewRange, dstFormat, true, device.TexOptLevel());
-            viewRange.startSubres = copyRegion.srcSubres;
-            RpmUtil::BuildImageViewInfo(
-                &imageView[1], *pSrcImage, viewRange, srcFormat, false, device.TexOptLevel());
+                RpmUtil::BuildImageViewInfo(
+                    &imageView[0], *pDstImage, viewRange, dstFormat, true, device.TexOptLevel());
+                viewRange.startSubres = copyRegion.srcSubres;
+                RpmUtil::BuildImageViewInfo(
+                    &imageView[1], *pSrcImage, viewRange, srcFormat, false, device.TexOptLevel());
 
-            if (is3d == false)
-            {
-                imageView[0].viewType = ImageViewType::Tex2d;
-                imageView[1].viewType = ImageViewType::Tex2d;
-            }
+                if (is3d == false)
+                {
+                    imageView[0].viewType = ImageViewType::Tex2d;
+                    imageView[1].viewType = ImageViewType::Tex2d;
+                }
 
-            device.CreateImageViewSrds(2, &imageView[0], pUserData);
-            pUserData += SrdDwordAlignment() * 2;
+                device.CreateImageViewSrds(2, &imageView[0], pUserData);
+                pUserData += SrdDwordAlignment() * 2;
 
-            if (isFmaskCopy)
-            {
-                // If this is an Fmask-accelerated Copy, create an image view of the source Image's Fmask surface.
-                FmaskViewInfo fmaskView = {};
-                fmaskView.pImage         = pSrcImage;
-                fmaskView.baseArraySlice = copyRegion.srcSubres.arraySlice;
-                fmaskView.arraySize      = copyRegion.numSlices;
+                if (isFmaskCopy)
+                {
+                    // If this is an Fmask-accelerated Copy, create an image view of the source Image's Fmask surface.
+                    FmaskViewInfo fmaskView = {};
+                    fmaskView.pImage         = pSrcImage;
+                    fmaskView.baseArraySlice = copyRegion.srcSubres.arraySlice;
+                    fmaskView.arraySize      = copyRegion.numSlices;
+
+                    m_pDevice->Parent()->CreateFmaskViewSrds(1, &fmaskView, pUserData);
+                    pUserData += SrdDwordAlignment();
+                }
 
-                m_pDevice->Parent()->CreateFmaskViewSrds(1, &fmaskView, pUserData);
+                SamplerInfo samplerInfo = {};
+                samplerInfo.filter      = copyInfo.filter;
+                samplerInfo.addressU    = TexAddressMode::Clamp;
+                samplerInfo.addressV    = TexAddressMode::Clamp;
+                samplerInfo.addressW    = TexAddressMode::Clamp;
+                samplerInfo.compareFunc = CompareFunc::Always;
+                device.CreateSamplerSrds(1, &samplerInfo, pUserData);
                 pUserData += SrdDwordAlignment();
-            }
 
-            SamplerInfo samplerInfo = {};
-            samplerInfo.filter      = copyInfo.filter;
-            samplerInfo.addressU    = TexAddressMode::Clamp;
-            samplerInfo.addressV    = TexAddressMode::Clamp;
-            samplerInfo.addressW    = TexAddressMode::Clamp;
-            samplerInfo.compareFunc = CompareFunc::Always;
-            device.CreateSamplerSrds(1, &samplerInfo, pUserData);
-            pUserData += SrdDwordAlignment();
-
-            // Copy the copy parameters into the embedded user-data space
-            memcpy(pUserData, &copyData[0], sizeof(copyData));
+                // Copy the copy parameters into the embedded user-data space
+                memcpy(pUserData, &copyData[0], sizeof(copyData));
 
-            const uint32 zGroups = is3d ? dstExtentD : copyRegion.numSlices;
+                const uint32 zGroups = is3d ? dstExtentD : copyRegion.numSlices;
 
-            // Execute the dispatch, we need one thread per texel.
-            pCmdBuffer->CmdDispatch(RpmUtil::MinThreadGroups(dstExtentW, threadsPerGroup[0]),
-                                    RpmUtil::MinThreadGroups(dstExtentH, threadsPerGroup[1]),
-                                    RpmUtil::MinThreadGroups(zGroups,    threadsPerGroup[2]));
+                // Execute the dispatch, we need one thread per texel.
+                pCmdBuffer->CmdDispatch(RpmUtil::MinThreadGroups(dstExtentW, threadsPerGroup[0]),
+                                        RpmUtil::MinThreadGroups(dstExtentH, threadsPerGroup[1]),
+                                        RpmUtil::MinThreadGroups(zGroups,    threadsPerGroup[2]));
+            }
         }
-    }
 
-    pCmdBuffer->CmdRestoreComputeState(ComputeStatePipelineAndUserData);
+        pCmdBuffer->CmdRestoreComputeState(ComputeStatePipelineAndUserData);
+    }
 }
 
 // =====================================================================================================================
@@ -2248,96 +2467,99 @@ void RsrcProcMgr::ConvertYuvToRgb(
         copyInfo.gammaCorrection = 1;
     }
 
-    const ComputePipeline*const pPipeline = GetPipeline(cscInfo.pipelineYuvToRgb);
+    const ComputePipeline*const pPipeline = GetPipeline(pCmdBuffer, cscInfo.pipelineYuvToRgb);
 
-    uint32 threadsPerGroup[3] = { };
-    pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
+    if (pPipeline != nullptr)
+    {
+        uint32 threadsPerGroup[3] = { };
+        pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
 
-    pCmdBuffer->CmdSaveComputeState(ComputeStateFlags::ComputeStatePipelineAndUserData);
-    pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
+        pCmdBuffer->CmdSaveComputeState(ComputeStateFlags::ComputeStatePipelineAndUserData);
+        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
 
-    for (uint32 idx = 0; idx < regionCount; ++idx)
-    {
-        ColorSpaceConversionRegion region = pRegions[idx];
-        if ((region.dstExtent.width == 0) || (region.dstExtent.height == 0))
+        for (uint32 idx = 0; idx < regionCount; ++idx)
         {
-            continue;   // Skip empty regions.
-        }
+            ColorSpaceConversionRegion region = pRegions[idx];
+            if ((region.dstExtent.width == 0) || (region.dstExtent.height == 0))
+            {
+                continue;   // Skip empty regions.
+            }
 
-        const SubresRange dstRange = { region.rgbSubres, 1, region.sliceCount };
-        RpmUtil::BuildImageViewInfo(&viewInfo[0], dstImage, dstRange, dstFormat, true, device.TexOptLevel());
+            const SubresRange dstRange = { region.rgbSubres, 1, region.sliceCount };
+            RpmUtil::BuildImageViewInfo(&viewInfo[0], dstImage, dstRange, dstFormat, true, device.TexOptLevel());
 
-        for (uint32 view = 1; view < viewCount; ++view)
-        {
-            const auto& cscViewInfo = cscInfo.viewInfoYuvToRgb[view - 1];
+            for (uint32 view = 1; view < viewCount; ++view)
+            {
+                const auto& cscViewInfo = cscInfo.viewInfoYuvToRgb[view - 1];
 
-            const SubresRange srcRange = { { cscViewInfo.aspect, 0, region.yuvStartSlice }, 1, region.sliceCount };
-            RpmUtil::BuildImageViewInfo(
-                &viewInfo[view], srcImage, srcRange, cscViewInfo.swizzledFormat, false, device.TexOptLevel());
-        }
+                const SubresRange srcRange = { { cscViewInfo.aspect, 0, region.yuvStartSlice }, 1, region.sliceCount };
+                RpmUtil::BuildImageViewInfo(
+                    &viewInfo[view], srcImage, srcRange, cscViewInfo.swizzledFormat, false, device.TexOptLevel());
+            }
 
-        // Calculate the absolute value of dstExtent, which will get fed to the shader.
-        copyInfo.dstExtent.width  = Math::Absu(region.dstExtent.width);
-        copyInfo.dstExtent.height = Math::Absu(region.dstExtent.height);
-        copyInfo.dstOffset.x      = region.dstOffset.x;
-        copyInfo.dstOffset.y      = region.dstOffset.y;
+            // Calculate the absolute value of dstExtent, which will get fed to the shader.
+            copyInfo.dstExtent.width  = Math::Absu(region.dstExtent.width);
+            copyInfo.dstExtent.height = Math::Absu(region.dstExtent.height);
+            copyInfo.dstOffset.x      = region.dstOffset.x;
+            copyInfo.dstOffset.y      = region.dstOffset.y;
 
-        // A negative extent means that we should reverse the copy direction. We want to always use the absolute
-        // value of dstExtent, otherwise the compute shader can't handle it. If dstExtent is negative in one
-        // dimension, then we negate srcExtent in that dimension, and we adjust the offsets as well.
-        if (region.dstExtent.width < 0)
-        {
-            copyInfo.dstOffset.x   = (region.dstOffset.x + region.dstExtent.width);
-            region.srcOffset.x     = (region.srcOffset.x + region.srcExtent.width);
-            region.srcExtent.width = -region.srcExtent.width;
-        }
+            // A negative extent means that we should reverse the copy direction. We want to always use the absolute
+            // value of dstExtent, otherwise the compute shader can't handle it. If dstExtent is negative in one
+            // dimension, then we negate srcExtent in that dimension, and we adjust the offsets as well.
+            if (region.dstExtent.width < 0)
+            {
+                copyInfo.dstOffset.x   = (region.dstOffset.x + region.dstExtent.width);
+                region.srcOffset.x     = (region.srcOffset.x + region.srcExtent.width);
+                region.srcExtent.width = -region.srcExtent.width;
+            }
 
-        if (region.dstExtent.height < 0)
-        {
-            copyInfo.dstOffset.y    = (region.dstOffset.y + region.dstExtent.height);
-            region.srcOffset.y      = (region.srcOffset.y + region.srcExtent.height);
-            region.srcExtent.height = -region.srcExtent.height;
-        }
+            if (region.dstExtent.height < 0)
+            {
+                copyInfo.dstOffset.y    = (region.dstOffset.y + region.dstExtent.height);
+                region.srcOffset.y      = (region.srcOffset.y + region.srcExtent.height);
+                region.srcExtent.height = -region.srcExtent.height;
+            }
 
-        // The shaders expect the source copy region to be specified in normalized texture coordinates.
-        const Extent3d& srcExtent = srcImage.SubresourceInfo(0)->extentTexels;
+            // The shaders expect the source copy region to be specified in normalized texture coordinates.
+            const Extent3d& srcExtent = srcImage.SubresourceInfo(0)->extentTexels;
 
-        copyInfo.srcLeft   = (static_cast<float>(region.srcOffset.x) / srcExtent.width);
-        copyInfo.srcTop    = (static_cast<float>(region.srcOffset.y) / srcExtent.height);
-        copyInfo.srcRight  = (static_cast<float>(region.srcOffset.x + region.srcExtent.width) / srcExtent.width);
-        copyInfo.srcBottom = (static_cast<float>(region.srcOffset.y + region.srcExtent.height) / srcExtent.height);
+            copyInfo.srcLeft   = (static_cast<float>(region.srcOffset.x) / srcExtent.width);
+            copyInfo.srcTop    = (static_cast<float>(region.srcOffset.y) / srcExtent.height);
+            copyInfo.srcRight  = (static_cast<float>(region.srcOffset.x + region.srcExtent.width) / srcExtent.width);
+            copyInfo.srcBottom = (static_cast<float>(region.srcOffset.y + region.srcExtent.height) / srcExtent.height);
 
-        PAL_ASSERT((copyInfo.srcLeft   >= 0.0f) && (copyInfo.srcLeft   <= 1.0f) &&
-                   (copyInfo.srcTop    >= 0.0f) && (copyInfo.srcTop    <= 1.0f) &&
-                   (copyInfo.srcRight  >= 0.0f) && (copyInfo.srcRight  <= 1.0f) &&
-                   (copyInfo.srcBottom >= 0.0f) && (copyInfo.srcBottom <= 1.0f));
+            PAL_ASSERT((copyInfo.srcLeft   >= 0.0f) && (copyInfo.srcLeft   <= 1.0f) &&
+                       (copyInfo.srcTop    >= 0.0f) && (copyInfo.srcTop    <= 1.0f) &&
+                       (copyInfo.srcRight  >= 0.0f) && (copyInfo.srcRight  <= 1.0f) &&
+                       (copyInfo.srcBottom >= 0.0f) && (copyInfo.srcBottom <= 1.0f));
 
-        // Each conversion shader requires:
-        //  o Four image SRD's: one for the RGB image, one each for the Y, U and V "planes" of the YUV image
-        //  o One sampler SRD
-        //  o Inline constant space for copyInfo
-        const uint32 sizeInDwords = (SrdDwordAlignment() * MaxTotalSrds) + RpmUtil::YuvRgbConversionInfoDwords;
-        uint32* pUserData = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
-                                                                   sizeInDwords,
-                                                                   SrdDwordAlignment(),
-                                                                   PipelineBindPoint::Compute,
-                                                                   0);
+            // Each conversion shader requires:
+            //  o Four image SRD's: one for the RGB image, one each for the Y, U and V "planes" of the YUV image
+            //  o One sampler SRD
+            //  o Inline constant space for copyInfo
+            const uint32 sizeInDwords = (SrdDwordAlignment() * MaxTotalSrds) + RpmUtil::YuvRgbConversionInfoDwords;
+            uint32* pUserData = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
+                                                                       sizeInDwords,
+                                                                       SrdDwordAlignment(),
+                                                                       PipelineBindPoint::Compute,
+                                                                       0);
 
-        device.CreateImageViewSrds(viewCount, &viewInfo[0], pUserData);
-        pUserData += (SrdDwordAlignment() * MaxImageSrds);
+            device.CreateImageViewSrds(viewCount, &viewInfo[0], pUserData);
+            pUserData += (SrdDwordAlignment() * MaxImageSrds);
 
-        device.CreateSamplerSrds(1, &sampler, pUserData);
-        pUserData += SrdDwordAlignment();
+            device.CreateSamplerSrds(1, &sampler, pUserData);
+            pUserData += SrdDwordAlignment();
 
-        memcpy(pUserData, &copyInfo, sizeof(copyInfo));
+            memcpy(pUserData, &copyInfo, sizeof(copyInfo));
 
-        // Finally, issue the dispatch. The shaders need one thread per texel.
-        pCmdBuffer->CmdDispatch(RpmUtil::MinThreadGroups(copyInfo.dstExtent.width,  threadsPerGroup[0]),
-                                RpmUtil::MinThreadGroups(copyInfo.dstExtent.height, threadsPerGroup[1]),
-                                RpmUtil::MinThreadGroups(region.sliceCount,         threadsPerGroup[2]));
-    } // End loop over regions
+            // Finally, issue the dispatch. The shaders need one thread per texel.
+            pCmdBuffer->CmdDispatch(RpmUtil::MinThreadGroups(copyInfo.dstExtent.width,  threadsPerGroup[0]),
+                                    RpmUtil::MinThreadGroups(copyInfo.dstExtent.height, threadsPerGroup[1]),
+                                    RpmUtil::MinThreadGroups(region.sliceCount,         threadsPerGroup[2]));
+        } // End loop over regions
 
-    pCmdBuffer->CmdRestoreComputeState(ComputeStateFlags::ComputeStatePipelineAndUserData);
+        pCmdBuffer->CmdRestoreComputeState(ComputeStateFlags::ComputeStatePipelineAndUserData);
+    }
 }
 
 // =====================================================================================================================
@@ -2371,135 +2593,139 @@ void RsrcProcMgr::ConvertRgbToYuv(
     // the planes can sample the source Image at different rates (because planes often have differing dimensions).
     const uint32 passCount = static_cast<uint32>(dstImage.GetImageInfo().numPlanes);
 
-    const ComputePipeline*const pPipeline = GetPipeline(cscInfo.pipelineRgbToYuv);
+    const ComputePipeline*const pPipeline = GetPipeline(pCmdBuffer, cscInfo.pipelineRgbToYuv);
 
-    uint32 threadsPerGroup[3] = { };
-    pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
+    if (pPipeline != nullptr)
+    {
+        uint32 threadsPerGroup[3] = { };
+        pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
 
-    pCmdBuffer->CmdSaveComputeState(ComputeStateFlags::ComputeStatePipelineAndUserData);
-    pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
+        pCmdBuffer->CmdSaveComputeState(ComputeStateFlags::ComputeStatePipelineAndUserData);
+        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
 
-    for (uint32 idx = 0; idx < regionCount; ++idx)
-    {
-        ColorSpaceConversionRegion region = pRegions[idx];
-        if ((region.dstExtent.width == 0) || (region.dstExtent.height == 0))
+        for (uint32 idx = 0; idx < regionCount; ++idx)
         {
-            continue;   // Skip empty regions.
-        }
+            ColorSpaceConversionRegion region = pRegions[idx];
+            if ((region.dstExtent.width == 0) || (region.dstExtent.height == 0))
+            {
+                continue;   // Skip empty regions.
+            }
 
-        constexpr uint32 MaxImageSrds = 2;
-        constexpr uint32 MaxTotalSrds = (MaxImageSrds + 1);
+            constexpr uint32 MaxImageSrds = 2;
+            constexpr uint32 MaxTotalSrds = (MaxImageSrds + 1);
 
-        ImageViewInfo viewInfo[MaxImageSrds] = { };
+            ImageViewInfo viewInfo[MaxImageSrds] = { };
 
-        const SubresRange srcRange = { region.rgbSubres, 1, region.sliceCount };
-        RpmUtil::BuildImageViewInfo(
-            &viewInfo[0], srcImage, srcRange, srcImageInfo.swizzledFormat, false, device.TexOptLevel());
+            const SubresRange srcRange = { region.rgbSubres, 1, region.sliceCount };
+            RpmUtil::BuildImageViewInfo(
+                &viewInfo[0], srcImage, srcRange, srcImageInfo.swizzledFormat, false, device.TexOptLevel());
 
-        RpmUtil::YuvRgbConversionInfo copyInfo = { };
+            RpmUtil::YuvRgbConversionInfo copyInfo = { };
 
-        // Calculate the absolute value of dstExtent, which will get fed to the shader.
-        const Extent2d dstExtent = { Math::Absu(region.dstExtent.width), Math::Absu(region.dstExtent.height) };
-        Offset2d dstOffset = region.dstOffset;
+            // Calculate the absolute value of dstExtent, which will get fed to the shader.
+            const Extent2d dstExtent = { Math::Absu(region.dstExtent.width), Math::Absu(region.dstExtent.height) };
+            Offset2d dstOffset = region.dstOffset;
 
-        // A negative extent means that we should reverse the copy direction. We want to always use the absolute
-        // value of dstExtent, otherwise the compute shader can't handle it. If dstExtent is negative in one
-        // dimension, then we negate srcExtent in that dimension, and we adjust the offsets as well.
-        if (region.dstExtent.width < 0)
-        {
-            dstOffset.x            = (region.dstOffset.x + region.dstExtent.width);
-            region.srcOffset.x     = (region.srcOffset.x + region.srcExtent.width);
-            region.srcExtent.width = -region.srcExtent.width;
-        }
+            // A negative extent means that we should reverse the copy direction. We want to always use the absolute
+            // value of dstExtent, otherwise the compute shader can't handle it. If dstExtent is negative in one
+            // dimension, then we negate srcExtent in that dimension, and we adjust the offsets as well.
+            if (region.dstExtent.width < 0)
+            {
+                dstOffset.x            = (region.dstOffset.x + region.dstExtent.width);
+                region.srcOffset.x     = (region.srcOffset.x + region.srcExtent.width);
+                region.srcExtent.width = -region.srcExtent.width;
+            }
 
-        if (region.dstExtent.height < 0)
-        {
-            dstOffset.y             = (region.dstOffset.y + region.dstExtent.height);
-            region.srcOffset.y      = (region.srcOffset.y + region.srcExtent.height);
-            region.srcExtent.height = -region.srcExtent.height;
-        }
+            if (region.dstExtent.height < 0)
+            {
+                dstOffset.y             = (region.dstOffset.y + region.dstExtent.height);
+                region.srcOffset.y      = (region.srcOffset.y + region.srcExtent.height);
+                region.srcExtent.height = -region.srcExtent.height;
+            }
 
-        // The shaders expect the source copy region to be specified in normalized texture coordinates.
-        const Extent3d& srcExtent = srcImage.SubresourceInfo(0)->extentTexels;
+            // The shaders expect the source copy region to be specified in normalized texture coordinates.
+            const Extent3d& srcExtent = srcImage.SubresourceInfo(0)->extentTexels;
 
-        copyInfo.srcLeft   = (static_cast<float>(region.srcOffset.x) / srcExtent.width);
-        copyInfo.srcTop    = (static_cast<float>(region.srcOffset.y) / srcExtent.height);
-        copyInfo.srcRight  = (static_cast<float>(region.srcOffset.x + region.srcExtent.width) / srcExtent.width);
-        copyInfo.srcBottom = (static_cast<float>(region.srcOffset.y + region.srcExtent.height) / srcExtent.height);
+            copyInfo.srcLeft   = (static_cast<float>(region.srcOffset.x) / srcExtent.width);
+            copyInfo.srcTop    = (static_cast<float>(region.srcOffset.y) / srcExtent.height);
+            copyInfo.srcRight  = (static_cast<float>(region.srcOffset.x + region.srcExtent.width) / srcExtent.width);
+            copyInfo.srcBottom = (static_cast<float>(region.srcOffset.y + region.srcExtent.height) / srcExtent.height);
 
-        // Writing to macro-pixel YUV destinations requires the distance between the two source pixels which form
-        // the destination macro-pixel (in normalized texture coordinates).
-        copyInfo.srcWidthEpsilon = (1.f / srcExtent.width);
+            // Writing to macro-pixel YUV destinations requires the distance between the two source pixels which form
+            // the destination macro-pixel (in normalized texture coordinates).
+            copyInfo.srcWidthEpsilon = (1.f / srcExtent.width);
 
-        PAL_ASSERT((copyInfo.srcLeft   >= 0.0f) && (copyInfo.srcLeft   <= 1.0f) &&
-                   (copyInfo.srcTop    >= 0.0f) && (copyInfo.srcTop    <= 1.0f) &&
-                   (copyInfo.srcRight  >= 0.0f) && (copyInfo.srcRight  <= 1.0f) &&
-                   (copyInfo.srcBottom >= 0.0f) && (copyInfo.srcBottom <= 1.0f));
+            PAL_ASSERT((copyInfo.srcLeft   >= 0.0f) && (copyInfo.srcLeft   <= 1.0f) &&
+                       (copyInfo.srcTop    >= 0.0f) && (copyInfo.srcTop    <= 1.0f) &&
+                       (copyInfo.srcRight  >= 0.0f) && (copyInfo.srcRight  <= 1.0f) &&
+                       (copyInfo.srcBottom >= 0.0f) && (copyInfo.srcBottom <= 1.0f));
 
-        if (cscInfo.pipelineRgbToYuv == RpmComputePipeline::RgbToYuvPacked)
-        {
-            // The YUY2 and YVY2 formats have the packing of components in a macro-pixel reversed compared to the
-            // UYVY and VYUY formats.
-            copyInfo.reversePacking = ((dstImageInfo.swizzledFormat.format == ChNumFormat::YUY2) ||
-                                       (dstImageInfo.swizzledFormat.format == ChNumFormat::YVY2));
-        }
-
-        // Perform one conversion pass per plane of the YUV destination.
-        for (uint32 pass = 0; pass < passCount; ++pass)
-        {
-            const auto& cscViewInfo = cscInfo.viewInfoRgbToYuv[pass];
-
-            const SubresRange dstRange = { { cscViewInfo.aspect, 0, region.yuvStartSlice }, 1, region.sliceCount };
-            RpmUtil::BuildImageViewInfo(
-                &viewInfo[1], dstImage, dstRange, cscViewInfo.swizzledFormat, true, device.TexOptLevel());
-
-            // Build RGB to YUV color-space-conversion table constant buffer.
-            RpmUtil::SetupRgbToYuvCscTable(dstImageInfo.swizzledFormat.format, pass, cscTable, &copyInfo);
-
-            // The destination offset and extent need to be adjusted to account for differences in the dimensions of
-            // the YUV image's planes.
-            Extent3d log2Ratio = Formats::Log2SubsamplingRatio(dstImageInfo.swizzledFormat.format, cscViewInfo.aspect);
             if (cscInfo.pipelineRgbToYuv == RpmComputePipeline::RgbToYuvPacked)
             {
-                // For YUV formats which are macro-pixel packed, we run a special shader which outputs two pixels
-                // (one macro-pxiel) per thread. Therefore, we must adjust the destination region accordingly, even
-                // though the planar subsampling ratio would normally be treated as 1:1.
-                log2Ratio.width  = 1;
-                log2Ratio.height = 0;
+                // The YUY2 and YVY2 formats have the packing of components in a macro-pixel reversed compared to the
+                // UYVY and VYUY formats.
+                copyInfo.reversePacking = ((dstImageInfo.swizzledFormat.format == ChNumFormat::YUY2) ||
+                                           (dstImageInfo.swizzledFormat.format == ChNumFormat::YVY2));
             }
 
-            copyInfo.dstOffset.x      = (dstOffset.x      >> log2Ratio.width);
-            copyInfo.dstOffset.y      = (dstOffset.y      >> log2Ratio.height);
-            copyInfo.dstExtent.width  = (dstExtent.width  >> log2Ratio.width);
-            copyInfo.dstExtent.height = (dstExtent.height >> log2Ratio.height);
+            // Perform one conversion pass per plane of the YUV destination.
+            for (uint32 pass = 0; pass < passCount; ++pass)
+            {
+                const auto& cscViewInfo = cscInfo.viewInfoRgbToYuv[pass];
 
-            // Each conversion shader requires:
-            //  o Two image SRD's: one for the RGB image, one for the YUV image
-            //  o One sampler SRD
-            //  o Inline constant space for copyInfo
-            const uint32 sizeInDwords = (SrdDwordAlignment() * MaxTotalSrds) + RpmUtil::YuvRgbConversionInfoDwords;
-            uint32* pUserData = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
-                                                                       sizeInDwords,
-                                                                       SrdDwordAlignment(),
-                                                                       PipelineBindPoint::Compute,
-                                                                       0);
+                const SubresRange dstRange = { { cscViewInfo.aspect, 0, region.yuvStartSlice }, 1, region.sliceCount };
+                RpmUtil::BuildImageViewInfo(
+                    &viewInfo[1], dstImage, dstRange, cscViewInfo.swizzledFormat, true, device.TexOptLevel());
 
-            device.CreateImageViewSrds(MaxImageSrds, &viewInfo[0], pUserData);
-            pUserData += (SrdDwordAlignment() * MaxImageSrds);
+                // Build RGB to YUV color-space-conversion table constant buffer.
+                RpmUtil::SetupRgbToYuvCscTable(dstImageInfo.swizzledFormat.format, pass, cscTable, &copyInfo);
 
-            device.CreateSamplerSrds(1, &sampler, pUserData);
-            pUserData += SrdDwordAlignment();
+                // The destination offset and extent need to be adjusted to account for differences in the dimensions of
+                // the YUV image's planes.
+                Extent3d log2Ratio =
+                    Formats::Log2SubsamplingRatio(dstImageInfo.swizzledFormat.format, cscViewInfo.aspect);
+                if (cscInfo.pipelineRgbToYuv == RpmComputePipeline::RgbToYuvPacked)
+                {
+                    // For YUV formats which are macro-pixel packed, we run a special shader which outputs two pixels
+                    // (one macro-pxiel) per thread. Therefore, we must adjust the destination region accordingly, even
+                    // though the planar subsampling ratio would normally be treated as 1:1.
+                    log2Ratio.width  = 1;
+                    log2Ratio.height = 0;
+                }
 
-            memcpy(pUserData, &copyInfo, sizeof(copyInfo));
+                copyInfo.dstOffset.x      = (dstOffset.x      >> log2Ratio.width);
+                copyInfo.dstOffset.y      = (dstOffset.y      >> log2Ratio.height);
+                copyInfo.dstExtent.width  = (dstExtent.width  >> log2Ratio.width);
+                copyInfo.dstExtent.height = (dstExtent.height >> log2Ratio.height);
+
+                // Each conversion shader requires:
+                //  o Two image SRD's: one for the RGB image, one for the YUV image
+                //  o One sampler SRD
+                //  o Inline constant space for copyInfo
+                const uint32 sizeInDwords = (SrdDwordAlignment() * MaxTotalSrds) + RpmUtil::YuvRgbConversionInfoDwords;
+                uint32* pUserData = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
+                                                                           sizeInDwords,
+                                                                           SrdDwordAlignment(),
+                                                                           PipelineBindPoint::Compute,
+                                                                           0);
 
-            // Finally, issue the dispatch. The shaders need one thread per texel.
-            pCmdBuffer->CmdDispatch(RpmUtil::MinThreadGroups(copyInfo.dstExtent.width,  threadsPerGroup[0]),
-                                    RpmUtil::MinThreadGroups(copyInfo.dstExtent.height, threadsPerGroup[1]),
-                                    RpmUtil::MinThreadGroups(region.sliceCount,         threadsPerGroup[2]));
-        } // End loop over per-plane passes
-    } // End loop over regions
+                device.CreateImageViewSrds(MaxImageSrds, &viewInfo[0], pUserData);
+                pUserData += (SrdDwordAlignment() * MaxImageSrds);
+
+                device.CreateSamplerSrds(1, &sampler, pUserData);
+                pUserData += SrdDwordAlignment();
+
+                memcpy(pUserData, &copyInfo, sizeof(copyInfo));
 
-    pCmdBuffer->CmdRestoreComputeState(ComputeStateFlags::ComputeStatePipelineAndUserData);
+                // Finally, issue the dispatch. The shaders need one thread per texel.
+                pCmdBuffer->CmdDispatch(RpmUtil::MinThreadGroups(copyInfo.dstExtent.width,  threadsPerGroup[0]),
+                                        RpmUtil::MinThreadGroups(copyInfo.dstExtent.height, threadsPerGroup[1]),
+                                        RpmUtil::MinThreadGroups(region.sliceCount,         threadsPerGroup[2]));
+            } // End loop over per-plane passes
+        } // End loop over regions
+
+        pCmdBuffer->CmdRestoreComputeState(ComputeStateFlags::ComputeStatePipelineAndUserData);
+    }
 }
 
 // =====================================================================================================================
@@ -2525,55 +2751,58 @@ void RsrcProcMgr::CmdFillMemory(
     if (is4xOptimized)
     {
         // This fill memory can be optimized to use the 4xDWORD pipeline.
-        pPipeline = GetPipeline(RpmComputePipeline::FillMem4xDword);
+        pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::FillMem4xDword);
     }
     else
     {
         // Use the fill memory DWORD pipeline since this call expects everything to be DWORD-aligned.
-        pPipeline = GetPipeline(RpmComputePipeline::FillMemDword);
+        pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::FillMemDword);
     }
 
-    // Save the command buffer's state and bind the pipeline.
-    if (saveRestoreComputeState)
+    if (pPipeline != nullptr)
     {
-        pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
-    }
+        // Save the command buffer's state and bind the pipeline.
+        if (saveRestoreComputeState)
+        {
+            pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
+        }
 
-    pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
+        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
 
-    uint32 srd[4] = { };
-    PAL_ASSERT(m_pDevice->Parent()->ChipProperties().srdSizes.bufferView == sizeof(srd));
+        uint32 srd[4] = { };
+        PAL_ASSERT(m_pDevice->Parent()->ChipProperties().srdSizes.bufferView == sizeof(srd));
 
-    BufferViewInfo dstBufferView = {};
-    dstBufferView.gpuAddr       = dstGpuMemory.Desc().gpuVirtAddr + dstOffset;
-    dstBufferView.range         = fillSize;
-    dstBufferView.stride        = (is4xOptimized) ? (sizeof(uint32) * 4) : sizeof(uint32);
-    if (is4xOptimized)
-    {
-        dstBufferView.swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
-        dstBufferView.swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-    }
-    else
-    {
-        dstBufferView.swizzledFormat.format  = ChNumFormat::X32_Uint;
-        dstBufferView.swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
-    }
-    m_pDevice->Parent()->CreateTypedBufferViewSrds(1, &dstBufferView, &srd[0]);
+        BufferViewInfo dstBufferView = {};
+        dstBufferView.gpuAddr       = dstGpuMemory.Desc().gpuVirtAddr + dstOffset;
+        dstBufferView.range         = fillSize;
+        dstBufferView.stride        = (is4xOptimized) ? (sizeof(uint32) * 4) : sizeof(uint32);
+        if (is4xOptimized)
+        {
+            dstBufferView.swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
+            dstBufferView.swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+        }
+        else
+        {
+            dstBufferView.swizzledFormat.format  = ChNumFormat::X32_Uint;
+            dstBufferView.swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
+        }
+        m_pDevice->Parent()->CreateTypedBufferViewSrds(1, &dstBufferView, &srd[0]);
 
-    pCmdBuffer->CmdSetUserData(PipelineBindPoint::Compute, 0, 4, &srd[0]);
-    pCmdBuffer->CmdSetUserData(PipelineBindPoint::Compute, 4, 1, &data);
+        pCmdBuffer->CmdSetUserData(PipelineBindPoint::Compute, 0, 4, &srd[0]);
+        pCmdBuffer->CmdSetUserData(PipelineBindPoint::Compute, 4, 1, &data);
 
-    // Issue a dispatch with one thread per DWORD.
-    const uint32 minThreads   = (is4xOptimized) ? (numDwords / 4) : numDwords;
-    const uint32 threadGroups = RpmUtil::MinThreadGroups(minThreads, pPipeline->ThreadsPerGroup());
-    pCmdBuffer->CmdDispatch(threadGroups, 1, 1);
+        // Issue a dispatch with one thread per DWORD.
+        const uint32 minThreads   = (is4xOptimized) ? (numDwords / 4) : numDwords;
+        const uint32 threadGroups = RpmUtil::MinThreadGroups(minThreads, pPipeline->ThreadsPerGroup());
+        pCmdBuffer->CmdDispatch(threadGroups, 1, 1);
 
-    if (saveRestoreComputeState)
-    {
-        // Restore the command buffer's state.
-        pCmdBuffer->CmdRestoreComputeState(ComputeStatePipelineAndUserData);
+        if (saveRestoreComputeState)
+        {
+            // Restore the command buffer's state.
+            pCmdBuffer->CmdRestoreComputeState(ComputeStatePipelineAndUserData);
+        }
     }
 }
 
@@ -2629,59 +2858,64 @@ void RsrcProcMgr::CmdClearBoundDepthStencilTargets(
     scissorInfo.scissors[0].offset.x = 0;
     scissorInfo.scissors[0].offset.y = 0;
 
-    // Save current command buffer state and bind graphics state which is common for all mipmap levels.
-    pCmdBuffer->PushGraphicsState();
+    const GraphicsPipeline*const pPipeline = GetGfxPipeline(pCmdBuffer, DepthSlowDraw);
 
-    pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Graphics, GetGfxPipeline(DepthSlowDraw), });
-    pCmdBuffer->CmdBindMsaaState(GetMsaaState(samples, fragments));
-    pCmdBuffer->CmdSetDepthBiasState(depthBias);
-    pCmdBuffer->CmdSetInputAssemblyState(inputAssemblyState);
-    pCmdBuffer->CmdSetPointLineRasterState(pointLineRasterState);
-    pCmdBuffer->CmdSetStencilRefMasks(stencilRefMasks);
-    pCmdBuffer->CmdSetTriangleRasterState(triangleRasterState);
-
-    if ((flag.depth != 0) && (flag.stencil != 0))
-    {
-        pCmdBuffer->CmdBindDepthStencilState(m_pDepthStencilClearState);
-    }
-    else if (flag.depth != 0)
-    {
-        pCmdBuffer->CmdBindDepthStencilState(m_pDepthClearState);
-    }
-    else if (flag.stencil != 0)
+    if (pPipeline != nullptr)
     {
-        pCmdBuffer->CmdBindDepthStencilState(m_pStencilClearState);
-    }
+        // Save current command buffer state and bind graphics state which is common for all mipmap levels.
+        pCmdBuffer->PushGraphicsState();
 
-    // All mip levels share the same depth export value, so only need to do it once.
-    RpmUtil::WriteVsZOut(pCmdBuffer, depth);
+        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Graphics, pPipeline, });
+        pCmdBuffer->CmdBindMsaaState(GetMsaaState(samples, fragments));
+        pCmdBuffer->CmdSetDepthBiasState(depthBias);
+        pCmdBuffer->CmdSetInputAssemblyState(inputAssemblyState);
+        pCmdBuffer->CmdSetPointLineRasterState(pointLineRasterState);
+        pCmdBuffer->CmdSetStencilRefMasks(stencilRefMasks);
+        pCmdBuffer->CmdSetTriangleRasterState(triangleRasterState);
 
-    for (uint32 scissorIndex = 0; scissorIndex < regionCount; ++scissorIndex)
-    {
-        // Note: we should clear the same range of slices for depth and/or stencil attachment. If this
-        // requirement needs to be relaxed, we need to separate the draws for depth clear and stencil clear.
-        RpmUtil::WriteVsFirstSliceOffet(pCmdBuffer, pClearRegions[scissorIndex].startSlice);
+        if ((flag.depth != 0) && (flag.stencil != 0))
+        {
+            pCmdBuffer->CmdBindDepthStencilState(m_pDepthStencilClearState);
+        }
+        else if (flag.depth != 0)
+        {
+            pCmdBuffer->CmdBindDepthStencilState(m_pDepthClearState);
+        }
+        else if (flag.stencil != 0)
+        {
+            pCmdBuffer->CmdBindDepthStencilState(m_pStencilClearState);
+        }
 
-        viewportInfo.viewports[0].originX = static_cast<float>(pClearRegions[scissorIndex].rect.offset.x);
-        viewportInfo.viewports[0].originY = static_cast<float>(pClearRegions[scissorIndex].rect.offset.y);
-        viewportInfo.viewports[0].width   = static_cast<float>(pClearRegions[scissorIndex].rect.extent.width);
-        viewportInfo.viewports[0].height  = static_cast<float>(pClearRegions[scissorIndex].rect.extent.height);
+        // All mip levels share the same depth export value, so only need to do it once.
+        RpmUtil::WriteVsZOut(pCmdBuffer, depth);
 
-        pCmdBuffer->CmdSetViewports(viewportInfo);
+        for (uint32 scissorIndex = 0; scissorIndex < regionCount; ++scissorIndex)
+        {
+            // Note: we should clear the same range of slices for depth and/or stencil attachment. If this
+            // requirement needs to be relaxed, we need to separate the draws for depth clear and stencil clear.
+            RpmUtil::WriteVsFirstSliceOffet(pCmdBuffer, pClearRegions[scissorIndex].startSlice);
 
-        scissorInfo.scissors[0].offset.x      = pClearRegions[scissorIndex].rect.offset.x;
-        scissorInfo.scissors[0].offset.y      = pClearRegions[scissorIndex].rect.offset.y;
-        scissorInfo.scissors[0].extent.width  = pClearRegions[scissorIndex].rect.extent.width;
-        scissorInfo.scissors[0].extent.height = pClearRegions[scissorIndex].rect.extent.height;
+            viewportInfo.viewports[0].originX = static_cast<float>(pClearRegions[scissorIndex].rect.offset.x);
+            viewportInfo.viewports[0].originY = static_cast<float>(pClearRegions[scissorIndex].rect.offset.y);
+            viewportInfo.viewports[0].width   = static_cast<float>(pClearRegions[scissorIndex].rect.extent.width);
+            viewportInfo.viewports[0].height  = static_cast<float>(pClearRegions[scissorIndex].rect.extent.height);
 
-        pCmdBuffer->CmdSetScissorRects(scissorInfo);
+            pCmdBuffer->CmdSetViewports(viewportInfo);
 
-        // Draw numSlices fullscreen instanced quads.
-        pCmdBuffer->CmdDraw(0, 3, 0, pClearRegions[scissorIndex].numSlices);
-    }
+            scissorInfo.scissors[0].offset.x      = pClearRegions[scissorIndex].rect.offset.x;
+            scissorInfo.scissors[0].offset.y      = pClearRegions[scissorIndex].rect.offset.y;
+            scissorInfo.scissors[0].extent.width  = pClearRegions[scissorIndex].rect.extent.width;
+            scissorInfo.scissors[0].extent.height = pClearRegions[scissorIndex].rect.extent.height;
 
-    // Restore original command buffer state and destroy the depth/stencil state.
-    pCmdBuffer->PopGraphicsState();
+            pCmdBuffer->CmdSetScissorRects(scissorInfo);
+
+            // Draw numSlices fullscreen instanced quads.
+            pCmdBuffer->CmdDraw(0, 3, 0, pClearRegions[scissorIndex].numSlices);
+        }
+
+        // Restore original command buffer state and destroy the depth/stencil state.
+        pCmdBuffer->PopGraphicsState();
+    }
 }
 
 // =====================================================================================================================
@@ -2838,6 +3072,17 @@ void RsrcProcMgr::CmdClearBoundColorTargets(
 
     for (uint32 colorIndex = 0; colorIndex < colorTargetCount; ++colorIndex)
     {
+        // Get the correct slow clear state based on the view format.
+        const GraphicsPipeline*const pPipeline =
+            GetGfxPipelineByTargetIndexAndFormat(pCmdBuffer,
+                                                 SlowColorClear0_32ABGR,
+                                                 pBoundColorTargets[colorIndex].targetIndex,
+                                                 pBoundColorTargets[colorIndex].swizzledFormat);
+        if (pPipeline == nullptr)
+        {
+            continue;
+        }
+
         uint32 convertedColor[4] = {0};
 
         if (pBoundColorTargets[colorIndex].clearValue.type == ClearColorType::Float)
@@ -2851,12 +3096,7 @@ void RsrcProcMgr::CmdClearBoundColorTargets(
             memcpy(&convertedColor[0], &pBoundColorTargets[colorIndex].clearValue.u32Color[0], sizeof(convertedColor));
         }
 
-        // Get the correct slow clear state based on the view format.
-        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Graphics,
-                                      GetGfxPipelineByTargetIndexAndFormat(
-                                          SlowColorClear0_32ABGR,
-                                          pBoundColorTargets[colorIndex].targetIndex,
-                                          pBoundColorTargets[colorIndex].swizzledFormat), });
+        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Graphics, pPipeline, });
         pCmdBuffer->CmdOverwriteRbPlusFormatForBlits(pBoundColorTargets[colorIndex].swizzledFormat,
                                                      pBoundColorTargets[colorIndex].targetIndex);
 #if (PAL_CLIENT_INTERFACE_MAJOR_VERSION < 354)
@@ -3107,81 +3347,86 @@ void RsrcProcMgr::SlowClearGraphics(
     bindTargetsInfo.colorTargets[0].imageLayout      = dstImageLayout;
     bindTargetsInfo.colorTargets[0].pColorTargetView = nullptr;
 
-    // Save current command buffer state and bind graphics state which is common for all mipmap levels.
-    pCmdBuffer->PushGraphicsState();
-    pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Graphics,
-                                  GetGfxPipelineByTargetIndexAndFormat(SlowColorClear0_32ABGR, 0, viewFormat), });
-    pCmdBuffer->CmdOverwriteRbPlusFormatForBlits(viewFormat, 0);
-    pCmdBuffer->CmdBindColorBlendState(m_pBlendDisableState);
-    pCmdBuffer->CmdBindDepthStencilState(m_pDepthDisableState);
-    pCmdBuffer->CmdBindMsaaState(GetMsaaState(createInfo.samples, createInfo.fragments));
-    pCmdBuffer->CmdSetDepthBiasState(depthBias);
-    pCmdBuffer->CmdSetInputAssemblyState(inputAssemblyState);
-    pCmdBuffer->CmdSetPointLineRasterState(pointLineRasterState);
-    pCmdBuffer->CmdSetTriangleRasterState(triangleRasterState);
+    const GraphicsPipeline*const pPipeline =
+        GetGfxPipelineByTargetIndexAndFormat(pCmdBuffer, SlowColorClear0_32ABGR, 0, viewFormat);
 
-    RpmUtil::WriteVsZOut(pCmdBuffer, 1.0f);
+    if (pPipeline != nullptr)
+    {
+        // Save current command buffer state and bind graphics state which is common for all mipmap levels.
+        pCmdBuffer->PushGraphicsState();
+        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Graphics, pPipeline, });
+        pCmdBuffer->CmdOverwriteRbPlusFormatForBlits(viewFormat, 0);
+        pCmdBuffer->CmdBindColorBlendState(m_pBlendDisableState);
+        pCmdBuffer->CmdBindDepthStencilState(m_pDepthDisableState);
+        pCmdBuffer->CmdBindMsaaState(GetMsaaState(createInfo.samples, createInfo.fragments));
+        pCmdBuffer->CmdSetDepthBiasState(depthBias);
+        pCmdBuffer->CmdSetInputAssemblyState(inputAssemblyState);
+        pCmdBuffer->CmdSetPointLineRasterState(pointLineRasterState);
+        pCmdBuffer->CmdSetTriangleRasterState(triangleRasterState);
 
-    uint32 convertedColor[4] = {0};
+        RpmUtil::WriteVsZOut(pCmdBuffer, 1.0f);
 
-    if (pColor->type == ClearColorType::Float)
-    {
-        Formats::ConvertColor(baseFormat, &pColor->f32Color[0], &convertedColor[0]);
-    }
-    else
-    {
-        memcpy(&convertedColor[0], &pColor->u32Color[0], sizeof(convertedColor));
-    }
+        uint32 convertedColor[4] = {0};
 
-    RpmUtil::ConvertClearColorToNativeFormat(baseFormat, viewFormat, &convertedColor[0]);
+        if (pColor->type == ClearColorType::Float)
+        {
+            Formats::ConvertColor(baseFormat, &pColor->f32Color[0], &convertedColor[0]);
+        }
+        else
+        {
+            memcpy(&convertedColor[0], &pColor->u32Color[0], sizeof(convertedColor));
+        }
 
-    uint32 packedColor[4] = {0};
+        RpmUtil::ConvertClearColorToNativeFormat(baseFormat, viewFormat, &convertedColor[0]);
 
-    // If we can clear with raw format replacement which is more efficient, swizzle it into the order
-    // required and then pack it.
-    if (rawFmtOk)
-    {
-        uint32 swizzledColor[4] = {0};
-        Formats::SwizzleColor(baseFormat, &convertedColor[0], &swizzledColor[0]);
-        Formats::PackRawClearColor(baseFormat, &swizzledColor[0], &packedColor[0]);
-    }
-    else
-    {
-        memcpy(&packedColor[0], &convertedColor[0], sizeof(packedColor));
-    }
+        uint32 packedColor[4] = {0};
 
-    pCmdBuffer->CmdSetUserData(PipelineBindPoint::Graphics, RpmPsClearFirstUserData, 4, &packedColor[0]);
+        // If we can clear with raw format replacement which is more efficient, swizzle it into the order
+        // required and then pack it.
+        if (rawFmtOk)
+        {
+            uint32 swizzledColor[4] = {0};
+            Formats::SwizzleColor(baseFormat, &convertedColor[0], &swizzledColor[0]);
+            Formats::PackRawClearColor(baseFormat, &swizzledColor[0], &packedColor[0]);
+        }
+        else
+        {
+            memcpy(&packedColor[0], &convertedColor[0], sizeof(packedColor));
+        }
 
-    // Each mipmap needs to be cleared individually.
-    const uint32 lastMip = (clearRange.startSubres.mipLevel + clearRange.numMips - 1);
+        pCmdBuffer->CmdSetUserData(PipelineBindPoint::Graphics, RpmPsClearFirstUserData, 4, &packedColor[0]);
 
-    // Boxes are only meaningful if we're clearing a single mip.
-    PAL_ASSERT((boxCount == 0) || ((pBoxes != nullptr) && (clearRange.numMips == 1)));
+        // Each mipmap needs to be cleared individually.
+        const uint32 lastMip = (clearRange.startSubres.mipLevel + clearRange.numMips - 1);
 
-    for (uint32 mip = clearRange.startSubres.mipLevel; mip <= lastMip; ++mip)
-    {
-        const SubresId mipSubres  = { clearRange.startSubres.aspect, mip, 0 };
-        const auto&    subResInfo = *dstImage.SubresourceInfo(mipSubres);
+        // Boxes are only meaningful if we're clearing a single mip.
+        PAL_ASSERT((boxCount == 0) || ((pBoxes != nullptr) && (clearRange.numMips == 1)));
 
-        // All slices of the same mipmap level can re-use the same viewport state.
-        viewportInfo.viewports[0].width  = static_cast<float>(subResInfo.extentTexels.width);
-        viewportInfo.viewports[0].height = static_cast<float>(subResInfo.extentTexels.height);
+        for (uint32 mip = clearRange.startSubres.mipLevel; mip <= lastMip; ++mip)
+        {
+            const SubresId mipSubres  = { clearRange.startSubres.aspect, mip, 0 };
+            const auto&    subResInfo = *dstImage.SubresourceInfo(mipSubres);
 
-        pCmdBuffer->CmdSetViewports(viewportInfo);
+            // All slices of the same mipmap level can re-use the same viewport state.
+            viewportInfo.viewports[0].width  = static_cast<float>(subResInfo.extentTexels.width);
+            viewportInfo.viewports[0].height = static_cast<float>(subResInfo.extentTexels.height);
 
-        colorViewInfo.imageInfo.baseSubRes.mipLevel = mip;
-        SlowClearGraphicsOneMip(pCmdBuffer,
-                                dstImage,
-                                clearRange,
-                                boxCount,
-                                pBoxes,
-                                mip,
-                                &colorViewInfo,
-                                &bindTargetsInfo);
-    }
+            pCmdBuffer->CmdSetViewports(viewportInfo);
 
-    // Restore original command buffer state.
-    pCmdBuffer->PopGraphicsState();
+            colorViewInfo.imageInfo.baseSubRes.mipLevel = mip;
+            SlowClearGraphicsOneMip(pCmdBuffer,
+                                    dstImage,
+                                    clearRange,
+                                    boxCount,
+                                    pBoxes,
+                                    mip,
+                                    &colorViewInfo,
+                                    &bindTargetsInfo);
+        }
+
+        // Restore original command buffer state.
+        pCmdBuffer->PopGraphicsState();
+    }
 }
 
 // =====================================================================================================================
@@ -3363,149 +3608,152 @@ void RsrcProcMgr::SlowClearCompute(
     switch (createInfo.imageType)
     {
     case ImageType::Tex1d:
-        pPipeline = GetPipeline(RpmComputePipeline::ClearImage1d);
+        pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::ClearImage1d);
         break;
 
     case ImageType::Tex2d:
-        pPipeline = GetPipeline(RpmComputePipeline::ClearImage2d);
+        pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::ClearImage2d);
         break;
 
     default:
-        pPipeline = GetPipeline(RpmComputePipeline::ClearImage3d);
+        pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::ClearImage3d);
         break;
     }
 
-    // Get number of threads per group in each dimension.
-    uint32 threadsPerGroup[3] = {0};
-    pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
-
-    // Save current command buffer state and bind the pipeline.
-    pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
-    pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
-
-    uint32 convertedColor[4] = {0};
-
-    if (pColor->type == ClearColorType::Float)
+    if (pPipeline != nullptr)
     {
-        Formats::ConvertColor(dstFormat, &pColor->f32Color[0], &convertedColor[0]);
-    }
-    else
-    {
-        memcpy(&convertedColor[0], &pColor->u32Color[0], sizeof(convertedColor));
-    }
+        // Get number of threads per group in each dimension.
+        uint32 threadsPerGroup[3] = {0};
+        pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
 
-    uint32 swizzledColor[4] = {0};
-    Formats::SwizzleColor(dstFormat, &convertedColor[0], &swizzledColor[0]);
+        // Save current command buffer state and bind the pipeline.
+        pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
+        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
 
-    // Pack the clear color into the raw format and write it to user data 2-5.
-    uint32 packedColor[4] = {0};
-    Formats::PackRawClearColor(dstFormat, &swizzledColor[0], &packedColor[0]);
+        uint32 convertedColor[4] = {0};
 
-    // Split the clear range into sections with constant mip levels and loop over them.
-    SubresRange  singleMipRange = { clearRange.startSubres, 1, clearRange.numSlices };
-    const uint32 lastMipLevel   = clearRange.startSubres.mipLevel + clearRange.numMips - 1;
+        if (pColor->type == ClearColorType::Float)
+        {
+            Formats::ConvertColor(dstFormat, &pColor->f32Color[0], &convertedColor[0]);
+        }
+        else
+        {
+            memcpy(&convertedColor[0], &pColor->u32Color[0], sizeof(convertedColor));
+        }
 
-    // We will do a dispatch for every box. If no boxes are specified then we will do a single full image dispatch.
-    const bool   hasBoxes      = (boxCount > 0);
-    const uint32 dispatchCount = hasBoxes ? boxCount : 1;
+        uint32 swizzledColor[4] = {0};
+        Formats::SwizzleColor(dstFormat, &convertedColor[0], &swizzledColor[0]);
 
-    // Boxes are only meaningful if we're clearing a single mip.
-    PAL_ASSERT((hasBoxes == false) || ((pBoxes != nullptr) && (clearRange.numMips == 1)));
+        // Pack the clear color into the raw format and write it to user data 2-5.
+        uint32 packedColor[4] = {0};
+        Formats::PackRawClearColor(dstFormat, &swizzledColor[0], &packedColor[0]);
 
-    // The user data will contain the 4 dwords of the clear color followed by up to 7 dwords of offset and extent
-    uint32 userData[11] =
-    {
-        packedColor[0],
-        packedColor[1],
-        packedColor[2],
-        packedColor[3],
-        0, 0, 0, 0, 0, 0, 0
-    };
+        // Split the clear range into sections with constant mip levels and loop over them.
+        SubresRange  singleMipRange = { clearRange.startSubres, 1, clearRange.numSlices };
+        const uint32 lastMipLevel   = clearRange.startSubres.mipLevel + clearRange.numMips - 1;
 
-    const auto& device = *m_pDevice->Parent();
+        // We will do a dispatch for every box. If no boxes are specified then we will do a single full image dispatch.
+        const bool   hasBoxes      = (boxCount > 0);
+        const uint32 dispatchCount = hasBoxes ? boxCount : 1;
 
-    for (; singleMipRange.startSubres.mipLevel <= lastMipLevel; ++singleMipRange.startSubres.mipLevel)
-    {
-        const auto& subResInfo = *dstImage.SubresourceInfo(singleMipRange.startSubres);
+        // Boxes are only meaningful if we're clearing a single mip.
+        PAL_ASSERT((hasBoxes == false) || ((pBoxes != nullptr) && (clearRange.numMips == 1)));
 
-        // Create an embedded SRD table and bind it to user data 0. We only need a single image view.
-        // Populate the table with an image view and the embedded user data. The view should cover this
-        // mip's clear range and use a raw format.
-        const uint32 DataDwords = NumBytesToNumDwords(sizeof(userData));
-        ImageViewInfo imageView = {};
-        RpmUtil::BuildImageViewInfo(&imageView, dstImage, singleMipRange, rawFormat, true, device.TexOptLevel());
+        // The user data will contain the 4 dwords of the clear color followed by up to 7 dwords of offset and extent
+        uint32 userData[11] =
+        {
+            packedColor[0],
+            packedColor[1],
+            packedColor[2],
+            packedColor[3],
+            0, 0, 0, 0, 0, 0, 0
+        };
 
-        // The default clear box is the entire subresource. This will be changed per-dispatch if boxes are enabled.
-        Extent3d clearExtent = subResInfo.extentTexels;
-        Offset3d clearOffset = {};
+        const auto& device = *m_pDevice->Parent();
 
-        for (uint32 i = 0; i < dispatchCount; i++)
+        for (; singleMipRange.startSubres.mipLevel <= lastMipLevel; ++singleMipRange.startSubres.mipLevel)
         {
-            uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(
-                pCmdBuffer,
-                SrdDwordAlignment() + DataDwords,
-                SrdDwordAlignment(),
-                PipelineBindPoint::Compute,
-                0);
+            const auto& subResInfo = *dstImage.SubresourceInfo(singleMipRange.startSubres);
 
-            device.CreateImageViewSrds(1, &imageView, pSrdTable);
-            pSrdTable += SrdDwordAlignment();
+            // Create an embedded SRD table and bind it to user data 0. We only need a single image view.
+            // Populate the table with an image view and the embedded user data. The view should cover this
+            // mip's clear range and use a raw format.
+            const uint32 DataDwords = NumBytesToNumDwords(sizeof(userData));
+            ImageViewInfo imageView = {};
+            RpmUtil::BuildImageViewInfo(&imageView, dstImage, singleMipRange, rawFormat, true, device.TexOptLevel());
 
-            if (hasBoxes)
-            {
-                clearExtent = pBoxes[i].extent;
-                clearOffset = pBoxes[i].offset;
-            }
+            // The default clear box is the entire subresource. This will be changed per-dispatch if boxes are enabled.
+            Extent3d clearExtent = subResInfo.extentTexels;
+            Offset3d clearOffset = {};
 
-            // Compute the minimum number of threads to dispatch. Note that only 2D images can have multiple samples and
-            // 3D images cannot have multiple slices.
-            uint32 minThreads[3] = { clearExtent.width, 1, 1, };
-            switch (createInfo.imageType)
+            for (uint32 i = 0; i < dispatchCount; i++)
             {
-            case ImageType::Tex1d:
-                // For 1d the shader expects the x offset, an unused dword, then the clear width.
-                // ClearImage1D:dcl_num_thread_per_group 64, 1, 1, Y and Z direction threads are 1
-                userData[4] = clearOffset.x;
-                userData[6] = clearExtent.width;
-                break;
+                uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(
+                    pCmdBuffer,
+                    SrdDwordAlignment() + DataDwords,
+                    SrdDwordAlignment(),
+                    PipelineBindPoint::Compute,
+                    0);
 
-            case ImageType::Tex2d:
-                minThreads[1] = clearExtent.height;
-                minThreads[2] = singleMipRange.numSlices * createInfo.samples;
-                // For 2d the shader expects x offset, y offset, clear width then clear height.
-                userData[4] = clearOffset.x;
-                userData[5] = clearOffset.y;
-                userData[6] = clearExtent.width;
-                userData[7] = clearExtent.height;
-                break;
+                device.CreateImageViewSrds(1, &imageView, pSrdTable);
+                pSrdTable += SrdDwordAlignment();
 
-            default:
-                // 3d image
-                minThreads[1] = clearExtent.height;
-                minThreads[2] = clearExtent.depth;
-                // For 3d the shader expects x, y z offsets, an unused dword then the width, height and depth.
-                userData[4]  = clearOffset.x;
-                userData[5]  = clearOffset.y;
-                userData[6]  = clearOffset.z;
-
-                userData[8]  = clearExtent.width;
-                userData[9]  = clearExtent.height;
-                userData[10] = clearExtent.depth;
-                break;
-            }
+                if (hasBoxes)
+                {
+                    clearExtent = pBoxes[i].extent;
+                    clearOffset = pBoxes[i].offset;
+                }
 
-            // Copy the user-data values into the descriptor table memory.
-            memcpy(pSrdTable, &userData[0], sizeof(userData));
+                // Compute the minimum number of threads to dispatch. Note that only 2D images can have multiple samples
+                // and 3D images cannot have multiple slices.
+                uint32 minThreads[3] = { clearExtent.width, 1, 1, };
+                switch (createInfo.imageType)
+                {
+                case ImageType::Tex1d:
+                    // For 1d the shader expects the x offset, an unused dword, then the clear width.
+                    // ClearImage1D:dcl_num_thread_per_group 64, 1, 1, Y and Z direction threads are 1
+                    userData[4] = clearOffset.x;
+                    userData[6] = clearExtent.width;
+                    break;
 
-            // Execute the dispatch.
-            pCmdBuffer->CmdDispatch(RpmUtil::MinThreadGroups(minThreads[0], threadsPerGroup[0]),
-                                    RpmUtil::MinThreadGroups(minThreads[1], threadsPerGroup[1]),
-                                    RpmUtil::MinThreadGroups(minThreads[2], threadsPerGroup[2]));
+                case ImageType::Tex2d:
+                    minThreads[1] = clearExtent.height;
+                    minThreads[2] = singleMipRange.numSlices * createInfo.samples;
+                    // For 2d the shader expects x offset, y offset, clear width then clear height.
+                    userData[4] = clearOffset.x;
+                    userData[5] = clearOffset.y;
+                    userData[6] = clearExtent.width;
+                    userData[7] = clearExtent.height;
+                    break;
+
+                default:
+                    // 3d image
+                    minThreads[1] = clearExtent.height;
+                    minThreads[2] = clearExtent.depth;
+                    // For 3d the shader expects x, y z offsets, an unused dword then the width, height and depth.
+                    userData[4]  = clearOffset.x;
+                    userData[5]  = clearOffset.y;
+                    userData[6]  = clearOffset.z;
+
+                    userData[8]  = clearExtent.width;
+                    userData[9]  = clearExtent.height;
+                    userData[10] = clearExtent.depth;
+                    break;
+                }
+
+                // Copy the user-data values into the descriptor table memory.
+                memcpy(pSrdTable, &userData[0], sizeof(userData));
+
+                // Execute the dispatch.
+                pCmdBuffer->CmdDispatch(RpmUtil::MinThreadGroups(minThreads[0], threadsPerGroup[0]),
+                                        RpmUtil::MinThreadGroups(minThreads[1], threadsPerGroup[1]),
+                                        RpmUtil::MinThreadGroups(minThreads[2], threadsPerGroup[2]));
+            }
         }
-    }
 
-    // Restore original command buffer state.
-    pCmdBuffer->CmdRestoreComputeState(ComputeStatePipelineAndUserData);
+        // Restore original command buffer state.
+        pCmdBuffer->CmdRestoreComputeState(ComputeStatePipelineAndUserData);
+    }
 }
 
 // =====================================================================================================================
@@ -3585,55 +3833,60 @@ void RsrcProcMgr::CmdClearColorBuffer(
     m_pDevice->Parent()->CreateTypedBufferViewSrds(1, &dstViewInfo, dstSrd);
 
     // Get the appropriate pipeline.
-    const auto*const pPipeline       = GetPipeline(RpmComputePipeline::ClearBuffer);
-    const uint32     threadsPerGroup = pPipeline->ThreadsPerGroup();
+    const auto*const pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::ClearBuffer);
 
-    // Save current command buffer state and bind the pipeline.
-    pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
-    pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
+    if (pPipeline != nullptr)
+    {
+        const uint32 threadsPerGroup = pPipeline->ThreadsPerGroup();
 
-    // We will do a dispatch for every range. If no ranges are specified then we will do a single full buffer dispatch.
-    const Range defaultRange = { 0, bufferExtent };
+        // Save current command buffer state and bind the pipeline.
+        pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
+        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
 
-    const bool   hasRanges       = (rangeCount > 0);
-    const uint32 dispatchCount   = hasRanges ? rangeCount : 1;
-    const Range* pDispatchRanges = hasRanges ? pRanges    : &defaultRange;
+        // We will do a dispatch for every range. If no ranges are specified then we will do a single full buffer
+        // dispatch.
+        const Range defaultRange = { 0, bufferExtent };
 
-    for (uint32 i = 0; i < dispatchCount; i++)
-    {
-        // Create an embedded SRD table and bind it to user data 0-1. We only need a single buffer view.
-        // Populate the table with a buffer view and the necessary embedded user data (clear color, offset, and extent).
-        constexpr uint32 DataDwords = PackedColorDwords + 2;
-        uint32*          pSrdTable  = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
-                                                                             SrdDwordAlignment() + DataDwords,
-                                                                             SrdDwordAlignment(),
-                                                                             PipelineBindPoint::Compute,
-                                                                             0);
-
-        // Copy in the raw buffer view.
-        memcpy(pSrdTable, dstSrd, sizeof(dstSrd));
-        pSrdTable += SrdDwordAlignment();
-
-        // Copy in the packed clear color.
-        memcpy(pSrdTable, packedColor, sizeof(packedColor));
-        pSrdTable += PackedColorDwords;
-
-        // The final two entries in the table are the range offset and range extent.
-        pSrdTable[0] = pDispatchRanges[i].offset;
-        pSrdTable[1] = pDispatchRanges[i].extent;
-
-        // Verify that the range is contained within the view.
-        PAL_ASSERT((pDispatchRanges[i].offset >= 0) &&
-                   (pDispatchRanges[i].offset + pDispatchRanges[i].extent <= bufferExtent));
-
-        // Execute the dispatch.
-        const uint32 numThreadGroups = RpmUtil::MinThreadGroups(pDispatchRanges[i].extent, threadsPerGroup);
-
-        pCmdBuffer->CmdDispatch(numThreadGroups, 1, 1);
-    }
+        const bool   hasRanges       = (rangeCount > 0);
+        const uint32 dispatchCount   = hasRanges ? rangeCount : 1;
+        const Range* pDispatchRanges = hasRanges ? pRanges    : &defaultRange;
 
-    // Restore original command buffer state.
-    pCmdBuffer->CmdRestoreComputeState(ComputeStatePipelineAndUserData);
+        for (uint32 i = 0; i < dispatchCount; i++)
+        {
+            // Create an embedded SRD table and bind it to user data 0-1. We only need a single buffer view. Populate
+            // the table with a buffer view and the necessary embedded user data (clear color, offset, and extent).
+            constexpr uint32 DataDwords = PackedColorDwords + 2;
+            uint32*          pSrdTable  = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
+                                                                                 SrdDwordAlignment() + DataDwords,
+                                                                                 SrdDwordAlignment(),
+                                                                                 PipelineBindPoint::Compute,
+                                                                                 0);
+
+            // Copy in the raw buffer view.
+            memcpy(pSrdTable, dstSrd, sizeof(dstSrd));
+            pSrdTable += SrdDwordAlignment();
+
+            // Copy in the packed clear color.
+            memcpy(pSrdTable, packedColor, sizeof(packedColor));
+            pSrdTable += PackedColorDwords;
+
+            // The final two entries in the table are the range offset and range extent.
+            pSrdTable[0] = pDispatchRanges[i].offset;
+            pSrdTable[1] = pDispatchRanges[i].extent;
+
+            // Verify that the range is contained within the view.
+            PAL_ASSERT((pDispatchRanges[i].offset >= 0) &&
+                       (pDispatchRanges[i].offset + pDispatchRanges[i].extent <= bufferExtent));
+
+            // Execute the dispatch.
+            const uint32 numThreadGroups = RpmUtil::MinThreadGroups(pDispatchRanges[i].extent, threadsPerGroup);
+
+            pCmdBuffer->CmdDispatch(numThreadGroups, 1, 1);
+        }
+
+        // Restore original command buffer state.
+        pCmdBuffer->CmdRestoreComputeState(ComputeStatePipelineAndUserData);
+    }
 }
 
 // =====================================================================================================================
@@ -3791,144 +4044,147 @@ void RsrcProcMgr::CmdGenerateIndirectCmds(
     uint32                      maximumCount
     ) const
 {
-    const ComputePipeline* pGenerationPipeline = GetCmdGenerationPipeline(generator, *pCmdBuffer);
-
-    uint32 threadsPerGroup[3] = { };
-    pGenerationPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
-
-    pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
-    pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pGenerationPipeline, });
-
-    // The command-generation pipelines expect the following descriptor-table layout for the resources which are the
-    // same for each command-stream chunk being generated:
-    //  + Raw-buffer SRD for the indirect argument data (4 DW)
-    //  + Structured-buffer SRD for the command parameter data (4 DW)
-    //  + Typed buffer SRD for the user-data entry mapping table for each shader stage (4 DW)
-    //  + Structured-buffer SRD for the pipeline signature (4 DW)
-    //  + Constant buffer SRD for the command-generator properties (4 DW)
-    //  + Constant buffer SRD for the properties of the ExecuteIndirect() invocation (4 DW)
-    //  + GPU address of the memory containing the count of commands to generate (2 DW)
-    //  + Issue THREAD_TRACE_MARKER after draw or dispatch (1 DW)
-
-    constexpr uint32 SrdDwords = 4;
-    PAL_ASSERT(m_pDevice->Parent()->ChipProperties().srdSizes.bufferView == (sizeof(uint32) * SrdDwords));
-
-    // The generation pipelines expect the descriptor table's GPU address to be written to user-data #0-1.
-    gpusize tableGpuAddr = 0uLL;
-    uint32* pTableMem = pCmdBuffer->CmdAllocateEmbeddedData(((6 * SrdDwords) + 3), 1, &tableGpuAddr);
-    PAL_ASSERT(pTableMem != nullptr);
-
-    pCmdBuffer->CmdSetUserData(PipelineBindPoint::Compute, 0, 2, reinterpret_cast<uint32*>(&tableGpuAddr));
-
-    // Raw-buffer SRD for the indirect-argument data:
-    BufferViewInfo viewInfo = { };
-    viewInfo.gpuAddr = argsGpuAddr;
-    viewInfo.swizzledFormat = UndefinedSwizzledFormat;
-    viewInfo.range          = (generator.Properties().argBufStride * maximumCount);
-    viewInfo.stride         = 1;
-    m_pDevice->Parent()->CreateUntypedBufferViewSrds(1, &viewInfo, pTableMem);
-    pTableMem += SrdDwords;
-
-    // Structured-buffer SRD for the command parameter data:
-    memcpy(pTableMem, generator.ParamBufferSrd(), (sizeof(uint32) * SrdDwords));
-    pTableMem += SrdDwords;
-
-    // Typed-buffer SRD for the user-data entry mappings:
-    generator.PopulateUserDataMappingBuffer(pCmdBuffer, pPipeline, pTableMem);
-    pTableMem += SrdDwords;
-
-    // Structured buffer SRD for the pipeline signature:
-    generator.PopulateSignatureBuffer(pCmdBuffer, pPipeline, pTableMem);
-    pTableMem += SrdDwords;
-
-    // Constant buffer SRD for the command-generator properties:
-    memcpy(pTableMem, generator.PropertiesSrd(), (sizeof(uint32) * SrdDwords));
-    pTableMem += SrdDwords;
-
-    // Constant buffer SRD for the properties of the ExecuteIndirect() invocation:
-    generator.PopulateInvocationBuffer(pCmdBuffer, pPipeline, argsGpuAddr, maximumCount, indexBufSize, pTableMem);
-    pTableMem += SrdDwords;
-
-    // GPU address of the memory containing the actual command count to generate:
-    memcpy(pTableMem, &countGpuAddr, sizeof(countGpuAddr));
-    pTableMem += 2;
-
-    const PalSettings& settings = m_pDevice->Parent()->Settings();
-
-    const bool issueSqttMarkerEvent = ((settings.gpuProfilerMode > GpuProfilerSqttOff) |
-                                        m_pDevice->Parent()->GetPlatform()->IsDevDriverProfilingEnabled());
+    const ComputePipeline* pGenerationPipeline = GetCmdGenerationPipeline(pCmdBuffer, generator);
 
-    // Flag to decide whether to issue THREAD_TRACE_MARKER following generated draw/dispatch commands.
-    pTableMem[0] = issueSqttMarkerEvent;
-
-    uint32 commandIdOffset = 0;
-    while (commandIdOffset < maximumCount)
+    if (pGenerationPipeline != nullptr)
     {
-        // Obtain a command-stream chunk for generating commands into. This also sets-up the padding requirements
-        // for the chunk and determines the number of commands which will safely fit. We'll need to build a raw-
-        // buffer SRD so the shader can access the command buffer as a UAV.
-        uint32  commandsInChunk  = 0;
-        uint32  embeddedDataSize = 0;
-        gpusize embeddedDataAddr = 0uLL;
-        CmdStreamChunk* pChunk = pCmdBuffer->GetChunkForCmdGeneration(generator,
-                                                                      *pPipeline,
-                                                                      (maximumCount - commandIdOffset),
-                                                                      &commandsInChunk,
-                                                                      &embeddedDataAddr,
-                                                                      &embeddedDataSize);
-
-        // The command generation pipeline also expects the following descriptor-table layout for the resources
-        // which change between each command-stream chunk being generated:
-        //  + Raw buffer UAV SRD for the command-stream chunk to generate (4 DW)
-        //  + Raw buffer UAV SRD for the embedded data segment to use for the spill table (4 DW)
-        //  + Command ID offset for the current command-stream-chunk (1 DW)
-        //  + Low half of the GPU virtual address of the spill table's embedded data segment (1 DW)
-
-        // The generation pipelines expect the descriptor table's GPU address to be written to user-data #2-3.
-        pTableMem = pCmdBuffer->CmdAllocateEmbeddedData(((2 * SrdDwords) + 2), 1, &tableGpuAddr);
+        uint32 threadsPerGroup[3] = { };
+        pGenerationPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
+
+        pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
+        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pGenerationPipeline, });
+
+        // The command-generation pipelines expect the following descriptor-table layout for the resources which are the
+        // same for each command-stream chunk being generated:
+        //  + Raw-buffer SRD for the indirect argument data (4 DW)
+        //  + Structured-buffer SRD for the command parameter data (4 DW)
+        //  + Typed buffer SRD for the user-data entry mapping table for each shader stage (4 DW)
+        //  + Structured-buffer SRD for the pipeline signature (4 DW)
+        //  + Constant buffer SRD for the command-generator properties (4 DW)
+        //  + Constant buffer SRD for the properties of the ExecuteIndirect() invocation (4 DW)
+        //  + GPU address of the memory containing the count of commands to generate (2 DW)
+        //  + Issue THREAD_TRACE_MARKER after draw or dispatch (1 DW)
+
+        constexpr uint32 SrdDwords = 4;
+        PAL_ASSERT(m_pDevice->Parent()->ChipProperties().srdSizes.bufferView == (sizeof(uint32) * SrdDwords));
+
+        // The generation pipelines expect the descriptor table's GPU address to be written to user-data #0-1.
+        gpusize tableGpuAddr = 0uLL;
+        uint32* pTableMem = pCmdBuffer->CmdAllocateEmbeddedData(((6 * SrdDwords) + 3), 1, &tableGpuAddr);
         PAL_ASSERT(pTableMem != nullptr);
 
-        pCmdBuffer->CmdSetUserData(PipelineBindPoint::Compute, 2, 2, reinterpret_cast<uint32*>(&tableGpuAddr));
+        pCmdBuffer->CmdSetUserData(PipelineBindPoint::Compute, 0, 2, reinterpret_cast<uint32*>(&tableGpuAddr));
 
-        // UAV buffer SRD for the command-stream-chunk to generate:
-        viewInfo.gpuAddr        = pChunk->GpuVirtAddr();
+        // Raw-buffer SRD for the indirect-argument data:
+        BufferViewInfo viewInfo = { };
+        viewInfo.gpuAddr = argsGpuAddr;
         viewInfo.swizzledFormat = UndefinedSwizzledFormat;
-        viewInfo.range          = (commandsInChunk * generator.Properties().cmdBufStride);
+        viewInfo.range          = (generator.Properties().argBufStride * maximumCount);
         viewInfo.stride         = 1;
         m_pDevice->Parent()->CreateUntypedBufferViewSrds(1, &viewInfo, pTableMem);
         pTableMem += SrdDwords;
 
-        // UAV buffer SRD for the embedded-data spill table:
-        if (embeddedDataSize != 0)
-        {
-            viewInfo.gpuAddr        = embeddedDataAddr;
+        // Structured-buffer SRD for the command parameter data:
+        memcpy(pTableMem, generator.ParamBufferSrd(), (sizeof(uint32) * SrdDwords));
+        pTableMem += SrdDwords;
+
+        // Typed-buffer SRD for the user-data entry mappings:
+        generator.PopulateUserDataMappingBuffer(pCmdBuffer, pPipeline, pTableMem);
+        pTableMem += SrdDwords;
+
+        // Structured buffer SRD for the pipeline signature:
+        generator.PopulateSignatureBuffer(pCmdBuffer, pPipeline, pTableMem);
+        pTableMem += SrdDwords;
+
+        // Constant buffer SRD for the command-generator properties:
+        memcpy(pTableMem, generator.PropertiesSrd(), (sizeof(uint32) * SrdDwords));
+        pTableMem += SrdDwords;
+
+        // Constant buffer SRD for the properties of the ExecuteIndirect() invocation:
+        generator.PopulateInvocationBuffer(pCmdBuffer, pPipeline, argsGpuAddr, maximumCount, indexBufSize, pTableMem);
+        pTableMem += SrdDwords;
+
+        // GPU address of the memory containing the actual command count to generate:
+        memcpy(pTableMem, &countGpuAddr, sizeof(countGpuAddr));
+        pTableMem += 2;
+
+        const PalSettings& settings = m_pDevice->Parent()->Settings();
+
+        const bool issueSqttMarkerEvent = ((settings.gpuProfilerMode > GpuProfilerSqttOff) |
+                                            m_pDevice->Parent()->GetPlatform()->IsDevDriverProfilingEnabled());
+
+        // Flag to decide whether to issue THREAD_TRACE_MARKER following generated draw/dispatch commands.
+        pTableMem[0] = issueSqttMarkerEvent;
+
+        uint32 commandIdOffset = 0;
+        while (commandIdOffset < maximumCount)
+        {
+            // Obtain a command-stream chunk for generating commands into. This also sets-up the padding requirements
+            // for the chunk and determines the number of commands which will safely fit. We'll need to build a raw-
+            // buffer SRD so the shader can access the command buffer as a UAV.
+            uint32  commandsInChunk  = 0;
+            uint32  embeddedDataSize = 0;
+            gpusize embeddedDataAddr = 0uLL;
+            CmdStreamChunk* pChunk = pCmdBuffer->GetChunkForCmdGeneration(generator,
+                                                                          *pPipeline,
+                                                                          (maximumCount - commandIdOffset),
+                                                                          &commandsInChunk,
+                                                                          &embeddedDataAddr,
+                                                                          &embeddedDataSize);
+
+            // The command generation pipeline also expects the following descriptor-table layout for the resources
+            // which change between each command-stream chunk being generated:
+            //  + Raw buffer UAV SRD for the command-stream chunk to generate (4 DW)
+            //  + Raw buffer UAV SRD for the embedded data segment to use for the spill table (4 DW)
+            //  + Command ID offset for the current command-stream-chunk (1 DW)
+            //  + Low half of the GPU virtual address of the spill table's embedded data segment (1 DW)
+
+            // The generation pipelines expect the descriptor table's GPU address to be written to user-data #2-3.
+            pTableMem = pCmdBuffer->CmdAllocateEmbeddedData(((2 * SrdDwords) + 2), 1, &tableGpuAddr);
+            PAL_ASSERT(pTableMem != nullptr);
+
+            pCmdBuffer->CmdSetUserData(PipelineBindPoint::Compute, 2, 2, reinterpret_cast<uint32*>(&tableGpuAddr));
+
+            // UAV buffer SRD for the command-stream-chunk to generate:
+            viewInfo.gpuAddr        = pChunk->GpuVirtAddr();
             viewInfo.swizzledFormat = UndefinedSwizzledFormat;
-            viewInfo.range          = (sizeof(uint32) * embeddedDataSize);
+            viewInfo.range          = (commandsInChunk * generator.Properties().cmdBufStride);
             viewInfo.stride         = 1;
             m_pDevice->Parent()->CreateUntypedBufferViewSrds(1, &viewInfo, pTableMem);
-        }
-        else
-        {
-            // If we're not using the embedded-data spill table, we still need to clear the srd to 0.
-            // This prevents hangs on older hardware caused by the shader attempting to read an invalid srd.
-            memset(pTableMem, 0, (sizeof(uint32) * SrdDwords));
-        }
+            pTableMem += SrdDwords;
 
-        pTableMem += SrdDwords;
+            // UAV buffer SRD for the embedded-data spill table:
+            if (embeddedDataSize != 0)
+            {
+                viewInfo.gpuAddr        = embeddedDataAddr;
+                viewInfo.swizzledFormat = UndefinedSwizzledFormat;
+                viewInfo.range          = (sizeof(uint32) * embeddedDataSize);
+                viewInfo.stride         = 1;
+                m_pDevice->Parent()->CreateUntypedBufferViewSrds(1, &viewInfo, pTableMem);
+            }
+            else
+            {
+                // If we're not using the embedded-data spill table, we still need to clear the srd to 0.
+                // This prevents hangs on older hardware caused by the shader attempting to read an invalid srd.
+                memset(pTableMem, 0, (sizeof(uint32) * SrdDwords));
+            }
 
-        // Command ID offset for the current command stream-chunk
-        pTableMem[0] = commandIdOffset;
-        // Low portion of the spill table's GPU virtual address
-        pTableMem[1] = LowPart(embeddedDataAddr);
+            pTableMem += SrdDwords;
 
-        pCmdBuffer->CmdDispatch(RpmUtil::MinThreadGroups(generator.ParameterCount(), threadsPerGroup[0]),
-                                RpmUtil::MinThreadGroups(commandsInChunk, threadsPerGroup[1]),
-                                1);
+            // Command ID offset for the current command stream-chunk
+            pTableMem[0] = commandIdOffset;
+            // Low portion of the spill table's GPU virtual address
+            pTableMem[1] = LowPart(embeddedDataAddr);
 
-        commandIdOffset += commandsInChunk;
-    }
+            pCmdBuffer->CmdDispatch(RpmUtil::MinThreadGroups(generator.ParameterCount(), threadsPerGroup[0]),
+                                    RpmUtil::MinThreadGroups(commandsInChunk, threadsPerGroup[1]),
+                                    1);
 
-    pCmdBuffer->CmdRestoreComputeState(ComputeStatePipelineAndUserData);
+            commandIdOffset += commandsInChunk;
+        }
+
+        pCmdBuffer->CmdRestoreComputeState(ComputeStatePipelineAndUserData);
+    }
 }
 
 // =====================================================================================================================
@@ -4008,6 +4264,12 @@ void RsrcProcMgr::ResolveImageGraphics(
                     (pRegions[idx].srcAspect == ImageAspect::Stencil)) &&
                     (pRegions[idx].srcAspect == pRegions[idx].dstAspect));
 
+        const GraphicsPipeline*const pPipeline = GetGfxPipeline(pCmdBuffer, isDepth ? ResolveDepth : ResolveStencil);
+        if (pPipeline == nullptr)
+        {
+            continue;
+        }
+
         // This path can't reinterpret the resolve format.
         const SubresId dstStartSubres =
         {
@@ -4035,7 +4297,7 @@ void RsrcProcMgr::ResolveImageGraphics(
 
             bindTargetsInfo.depthTarget.depthLayout = dstImageLayout;
 
-            pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Graphics, GetGfxPipeline(ResolveDepth), });
+            pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Graphics, pPipeline, });
             pCmdBuffer->CmdBindDepthStencilState(m_pDepthResolveState);
         }
         else
@@ -4043,7 +4305,7 @@ void RsrcProcMgr::ResolveImageGraphics(
             srcFormat.format                          = ChNumFormat::X8_Uint;
             bindTargetsInfo.depthTarget.stencilLayout = dstImageLayout;
 
-            pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Graphics, GetGfxPipeline(ResolveStencil), });
+            pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Graphics, pPipeline, });
             pCmdBuffer->CmdBindDepthStencilState(m_pStencilResolveState);
         }
 
@@ -4153,149 +4415,157 @@ void RsrcProcMgr::ResolveImageCompute(
     const auto& device = *m_pDevice->Parent();
 
     // Select a Resolve shader based on the source Image's sample-count and resolve method.
-    const ComputePipeline*const pPipeline = GetCsResolvePipeline(srcImage, resolveMode, method);
-    uint32 threadsPerGroup[3] = {};
-    pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
+    const ComputePipeline*const pPipeline = GetCsResolvePipeline(pCmdBuffer, srcImage, resolveMode, method);
+    if (pPipeline != nullptr)
+    {
+        uint32 threadsPerGroup[3] = {};
+        pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
 
-    // Save the command buffer's state and bind the pipeline.
-    pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
-    pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
+        // Save the command buffer's state and bind the pipeline.
+        pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
+        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
 
-    // Basic resolves need one slot per region per image, FMask resolves need a third slot for the source Image's FMask.
-    const bool   isCsFmask = (method.shaderCsFmask == 1);
-    const uint32 numSlots  = isCsFmask ? 3 : 2;
+        // Basic resolves need one slot per region per image, FMask resolves need a third slot for the source Image's
+        // FMask.
+        const bool   isCsFmask = (method.shaderCsFmask == 1);
+        const uint32 numSlots  = isCsFmask ? 3 : 2;
 
-    // Execute the Resolve for each region in the specified list.
-    for (uint32 idx = 0; idx < regionCount; ++idx)
-    {
-        // Set both subresources to the first slice of the required mip level
-        const SubresId srcSubres = { pRegions[idx].srcAspect, 0, pRegions[idx].srcSlice };
-        const SubresId dstSubres = { pRegions[idx].dstAspect, pRegions[idx].dstMipLevel, pRegions[idx].dstSlice };
+        // Execute the Resolve for each region in the specified list.
+        for (uint32 idx = 0; idx < regionCount; ++idx)
+        {
+            // Set both subresources to the first slice of the required mip level
+            const SubresId srcSubres = { pRegions[idx].srcAspect, 0, pRegions[idx].srcSlice };
+            const SubresId dstSubres = { pRegions[idx].dstAspect, pRegions[idx].dstMipLevel, pRegions[idx].dstSlice };
 
-        SwizzledFormat srcFormat = srcImage.SubresourceInfo(srcSubres)->format;
-        SwizzledFormat dstFormat = dstImage.SubresourceInfo(dstSubres)->format;
+            SwizzledFormat srcFormat = srcImage.SubresourceInfo(srcSubres)->format;
+            SwizzledFormat dstFormat = dstImage.SubresourceInfo(dstSubres)->format;
 
-        // Override the formats with the caller's "reinterpret" format.
-        if ((Formats::IsUndefined(pRegions[idx].swizzledFormat.format) == false) &&
-            (Formats::IsUndefined(pRegions[idx].swizzledFormat.format) == false))
-        {
-            // We require that the channel formats match.
-            PAL_ASSERT(Formats::ShareChFmt(srcFormat.format, pRegions[idx].swizzledFormat.format));
-            PAL_ASSERT(Formats::ShareChFmt(dstFormat.format, pRegions[idx].swizzledFormat.format));
+            // Override the formats with the caller's "reinterpret" format.
+            if ((Formats::IsUndefined(pRegions[idx].swizzledFormat.format) == false) &&
+                (Formats::IsUndefined(pRegions[idx].swizzledFormat.format) == false))
+            {
+                // We require that the channel formats match.
+                PAL_ASSERT(Formats::ShareChFmt(srcFormat.format, pRegions[idx].swizzledFormat.format));
+                PAL_ASSERT(Formats::ShareChFmt(dstFormat.format, pRegions[idx].swizzledFormat.format));
 
-            // If the specified format exactly matches the image formats the resolve will always work. Otherwise, the
-            // images must support format replacement.
-            PAL_ASSERT(Formats::HaveSameNumFmt(srcFormat.format, pRegions[idx].swizzledFormat.format) ||
-                       srcImage.GetGfxImage()->IsFormatReplaceable(srcSubres, srcImageLayout));
+                // If the specified format exactly matches the image formats the resolve will always work. Otherwise,
+                // the images must support format replacement.
+                PAL_ASSERT(Formats::HaveSameNumFmt(srcFormat.format, pRegions[idx].swizzledFormat.format) ||
+                           srcImage.GetGfxImage()->IsFormatReplaceable(srcSubres, srcImageLayout));
 
-            PAL_ASSERT(Formats::HaveSameNumFmt(dstFormat.format, pRegions[idx].swizzledFormat.format) ||
-                       dstImage.GetGfxImage()->IsFormatReplaceable(dstSubres, dstImageLayout));
+                PAL_ASSERT(Formats::HaveSameNumFmt(dstFormat.format, pRegions[idx].swizzledFormat.format) ||
+                           dstImage.GetGfxImage()->IsFormatReplaceable(dstSubres, dstImageLayout));
 
-            srcFormat.format = pRegions[idx].swizzledFormat.format;
-            dstFormat.format = pRegions[idx].swizzledFormat.format;
-        }
+                srcFormat.format = pRegions[idx].swizzledFormat.format;
+                dstFormat.format = pRegions[idx].swizzledFormat.format;
+            }
 
-        // Store the necessary region independent user data values in slots 1-3. Shader expects the following layout:
-        // 1 - Num Samples
-        // 2 - Gamma correction option (1 if the destination format is SRGB, 0 otherwise)
-        // 3 - Copy sample 0 (single sample) flag. (1 for integer formats, 0 otherwise). For DS images this flag
-        //     is forced to 1.
-        const uint32 imageData[3] =
-        {
-            srcImage.GetImageCreateInfo().samples,
-            Formats::IsSrgb(dstFormat.format),
-            ((pRegions[idx].srcAspect == ImageAspect::Stencil) ||
-             Formats::IsSint(srcFormat.format)                 ||
-             Formats::IsUint(srcFormat.format)),
-        };
+            // Store the necessary region independent user data values in slots 1-3. Shader expects the following
+            // layout:
+            // 1 - Num Samples
+            // 2 - Gamma correction option (1 if the destination format is SRGB, 0 otherwise)
+            // 3 - Copy sample 0 (single sample) flag. (1 for integer formats, 0 otherwise). For DS images this flag
+            //     is forced to 1.
+            const uint32 imageData[3] =
+            {
+                srcImage.GetImageCreateInfo().samples,
+                Formats::IsSrgb(dstFormat.format),
+                ((pRegions[idx].srcAspect == ImageAspect::Stencil) ||
+                 Formats::IsSint(srcFormat.format)                 ||
+                 Formats::IsUint(srcFormat.format)),
+            };
 
-        pCmdBuffer->CmdSetUserData(PipelineBindPoint::Compute, 1, 3, &imageData[0]);
+            pCmdBuffer->CmdSetUserData(PipelineBindPoint::Compute, 1, 3, &imageData[0]);
 
-        // The hardware can't handle UAV stores using SRGB num format.  The resolve shaders already contain a
-        // linear-to-gamma conversion, but in order for that to work the output UAV's num format must be patched to be
-        // simple unorm.
-        if (Formats::IsSrgb(dstFormat.format))
-        {
-            dstFormat.format = Formats::ConvertToUnorm(dstFormat.format);
-        }
+            // The hardware can't handle UAV stores using SRGB num format.  The resolve shaders already contain a
+            // linear-to-gamma conversion, but in order for that to work the output UAV's num format must be patched to
+            // be simple unorm.
+            if (Formats::IsSrgb(dstFormat.format))
+            {
+                dstFormat.format = Formats::ConvertToUnorm(dstFormat.format);
+            }
 
-        // The shader expects the following layout for the embedded user-data constants.
-        // Src Offset X, Src Y offset, Resolve width, Resolve height
-        // Dst Offset X, Dst Y offset
+            // The shader expects the following layout for the embedded user-data constants.
+            // Src Offset X, Src Y offset, Resolve width, Resolve height
+            // Dst Offset X, Dst Y offset
 
-        const uint32 regionData[6] =
-        {
-            static_cast<uint32>(pRegions[idx].srcOffset.x),
-            static_cast<uint32>(pRegions[idx].srcOffset.y),
-            pRegions[idx].extent.width,
-            pRegions[idx].extent.height,
-            static_cast<uint32>(pRegions[idx].dstOffset.x),
-            static_cast<uint32>(pRegions[idx].dstOffset.y)
-        };
+            const uint32 regionData[6] =
+            {
+                static_cast<uint32>(pRegions[idx].srcOffset.x),
+                static_cast<uint32>(pRegions[idx].srcOffset.y),
+                pRegions[idx].extent.width,
+                pRegions[idx].extent.height,
+                static_cast<uint32>(pRegions[idx].dstOffset.x),
+                static_cast<uint32>(pRegions[idx].dstOffset.y)
+            };
 
-        // Create an embedded user-data table and bind it to user data 0. We need image views for the src and dst
-        // subresources, as well as some inline constants for the resolve offsets and extents.
-        const uint32 DataDwords = NumBytesToNumDwords(sizeof(regionData));
-        uint32*      pUserData  = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
-                                                                         SrdDwordAlignment() * numSlots + DataDwords,
-                                                                         SrdDwordAlignment(),
-                                                                         PipelineBindPoint::Compute,
-                                                                         0);
+            // Create an embedded user-data table and bind it to user data 0. We need image views for the src and dst
+            // subresources, as well as some inline constants for the resolve offsets and extents.
+            const uint32 DataDwords = NumBytesToNumDwords(sizeof(regionData));
+            uint32*      pUserData  =
+                RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
+                                                       SrdDwordAlignment() * numSlots + DataDwords,
+                                                       SrdDwordAlignment(),
+                                                       PipelineBindPoint::Compute,
+                                                       0);
+
+            ImageViewInfo imageView = {};
+            SubresRange   viewRange = { dstSubres, 1, pRegions[idx].numSlices };
+
+            RpmUtil::BuildImageViewInfo(&imageView, dstImage, viewRange, dstFormat, true, device.TexOptLevel());
+            device.CreateImageViewSrds(1, &imageView, pUserData);
+            pUserData += SrdDwordAlignment();
 
-        ImageViewInfo imageView = {};
-        SubresRange   viewRange = { dstSubres, 1, pRegions[idx].numSlices };
+            viewRange.startSubres = srcSubres;
+            RpmUtil::BuildImageViewInfo(&imageView, srcImage, viewRange, srcFormat, false, device.TexOptLevel());
+            device.CreateImageViewSrds(1, &imageView, pUserData);
+            pUserData += SrdDwordAlignment();
 
-        RpmUtil::BuildImageViewInfo(&imageView, dstImage, viewRange, dstFormat, true, device.TexOptLevel());
-        device.CreateImageViewSrds(1, &imageView, pUserData);
-        pUserData += SrdDwordAlignment();
+            if (isCsFmask)
+            {
+                // If this is an Fmask-accelerated Resolve, create a third image view of the source Image's Fmask
+                // surface.
+                FmaskViewInfo fmaskView = {};
+                fmaskView.pImage         = &srcImage;
+                fmaskView.baseArraySlice = pRegions[idx].srcSlice;
+                fmaskView.arraySize      = pRegions[idx].numSlices;
 
-        viewRange.startSubres = srcSubres;
-        RpmUtil::BuildImageViewInfo(&imageView, srcImage, viewRange, srcFormat, false, device.TexOptLevel());
-        device.CreateImageViewSrds(1, &imageView, pUserData);
-        pUserData += SrdDwordAlignment();
+                m_pDevice->Parent()->CreateFmaskViewSrds(1, &fmaskView, pUserData);
+                pUserData += SrdDwordAlignment();
+            }
 
-        if (isCsFmask)
-        {
-            // If this is an Fmask-accelerated Resolve, create a third image view of the source Image's Fmask surface.
-            FmaskViewInfo fmaskView = {};
-            fmaskView.pImage         = &srcImage;
-            fmaskView.baseArraySlice = pRegions[idx].srcSlice;
-            fmaskView.arraySize      = pRegions[idx].numSlices;
+            // Copy the user-data values into the descriptor table memory
+            memcpy(pUserData, &regionData[0], sizeof(regionData));
 
-            m_pDevice->Parent()->CreateFmaskViewSrds(1, &fmaskView, pUserData);
-            pUserData += SrdDwordAlignment();
+            // Execute the dispatch. Resolves can only be done on 2D images so the Z dimension of the dispatch is always
+            // 1.
+            pCmdBuffer->CmdDispatch(RpmUtil::MinThreadGroups(pRegions[idx].extent.width,  threadsPerGroup[0]),
+                                    RpmUtil::MinThreadGroups(pRegions[idx].extent.height, threadsPerGroup[1]),
+                                    RpmUtil::MinThreadGroups(pRegions[idx].numSlices,  threadsPerGroup[2]));
         }
 
-        // Copy the user-data values into the descriptor table memory
-        memcpy(pUserData, &regionData[0], sizeof(regionData));
-
-        // Execute the dispatch. Resolves can only be done on 2D images so the Z dimension of the dispatch is always 1.
-        pCmdBuffer->CmdDispatch(RpmUtil::MinThreadGroups(pRegions[idx].extent.width,  threadsPerGroup[0]),
-                                RpmUtil::MinThreadGroups(pRegions[idx].extent.height, threadsPerGroup[1]),
-                                RpmUtil::MinThreadGroups(pRegions[idx].numSlices,  threadsPerGroup[2]));
-    }
+        // Restore the command buffer's state.
+        pCmdBuffer->CmdRestoreComputeState(ComputeStatePipelineAndUserData);
 
-    // Restore the command buffer's state.
-    pCmdBuffer->CmdRestoreComputeState(ComputeStatePipelineAndUserData);
+        if (dstImage.GetGfxImage()->HasHtileData())
+        {
+            // However, dest image might contain htile data when resolve is performed on compute queue.
+            // ResolveDst will be referred as decomprWithHiZ(HiZ valid), thus expand hiZ to 0-1.
+            // It is not recommended to be called here, since hiZ expanded to 0-1 is not friendly to db usage. Moreover,
+            // there's potential htile sync risk due to htile overlapped waw hazard here. So we put alert here.
+            PAL_ALERT_ALWAYS();
 
-    if (dstImage.GetGfxImage()->HasHtileData())
-    {
-        // However, dest image might contain htile data when resolve is performed on compute queue.
-        // ResolveDst will be referred as decomprWithHiZ(HiZ valid), thus expand hiZ to 0-1.
-        // It is not recommended to be called here, since hiZ expanded to 0-1 is not friendly to db usage. Moreover,
-        // there's potential htile sync risk due to htile overlapped waw hazard here. So we put alert here.
-        PAL_ALERT_ALWAYS();
-
-        for (uint32 i = 0; i < regionCount; ++i)
-        {
-            const ImageResolveRegion& curRegion = pRegions[i];
-            SubresRange subresRange = {};
-            subresRange.startSubres.aspect = curRegion.dstAspect;
-            subresRange.startSubres.mipLevel = curRegion.dstMipLevel;
-            subresRange.startSubres.arraySlice = curRegion.dstSlice;
-            subresRange.numMips = 1;
-            subresRange.numSlices = curRegion.numSlices;
-            HwlExpandHtileHiZRange(pCmdBuffer, *dstImage.GetGfxImage(), subresRange);
+            for (uint32 i = 0; i < regionCount; ++i)
+            {
+                const ImageResolveRegion& curRegion = pRegions[i];
+                SubresRange subresRange = {};
+                subresRange.startSubres.aspect = curRegion.dstAspect;
+                subresRange.startSubres.mipLevel = curRegion.dstMipLevel;
+                subresRange.startSubres.arraySlice = curRegion.dstSlice;
+                subresRange.numMips = 1;
+                subresRange.numSlices = curRegion.numSlices;
+                HwlExpandHtileHiZRange(pCmdBuffer, *dstImage.GetGfxImage(), subresRange);
+            }
         }
     }
 }
@@ -4303,6 +4573,7 @@ void RsrcProcMgr::ResolveImageCompute(
 // =====================================================================================================================
 // Selects a compute Resolve pipeline based on the properties of the given Image and resolve method.
 const ComputePipeline* RsrcProcMgr::GetCsResolvePipeline(
+    GfxCmdBuffer* pCmdBuffer,
     const Image&  srcImage,
     ResolveMode   mode,
     ResolveMethod method
@@ -4318,22 +4589,22 @@ const ComputePipeline* RsrcProcMgr::GetCsResolvePipeline(
         switch (createInfo.fragments)
         {
         case 1:
-            pPipeline = GetPipeline(RpmComputePipeline::MsaaFmaskResolve1xEqaa);
+            pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaFmaskResolve1xEqaa);
             break;
         case 2:
             switch (mode)
             {
             case ResolveMode::Average:
-                pPipeline = GetPipeline(RpmComputePipeline::MsaaFmaskResolve2xEqaa);
+                pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaFmaskResolve2xEqaa);
                 break;
             case ResolveMode::Minimum:
-                pPipeline = GetPipeline(RpmComputePipeline::MsaaFmaskResolve2xEqaaMin);
+                pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaFmaskResolve2xEqaaMin);
                 break;
             case ResolveMode::Maximum:
-                pPipeline = GetPipeline(RpmComputePipeline::MsaaFmaskResolve2xEqaaMax);
+                pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaFmaskResolve2xEqaaMax);
                 break;
             default:
-                pPipeline = GetPipeline(RpmComputePipeline::MsaaFmaskResolve2xEqaa);
+                pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaFmaskResolve2xEqaa);
                 PAL_NEVER_CALLED();
                 break;
             }
@@ -4342,16 +4613,16 @@ const ComputePipeline* RsrcProcMgr::GetCsResolvePipeline(
             switch (mode)
             {
             case ResolveMode::Average:
-                pPipeline = GetPipeline(RpmComputePipeline::MsaaFmaskResolve4xEqaa);
+                pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaFmaskResolve4xEqaa);
                 break;
             case ResolveMode::Minimum:
-                pPipeline = GetPipeline(RpmComputePipeline::MsaaFmaskResolve4xEqaaMin);
+                pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaFmaskResolve4xEqaaMin);
                 break;
             case ResolveMode::Maximum:
-                pPipeline = GetPipeline(RpmComputePipeline::MsaaFmaskResolve4xEqaaMax);
+                pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaFmaskResolve4xEqaaMax);
                 break;
             default:
-                pPipeline = GetPipeline(RpmComputePipeline::MsaaFmaskResolve4xEqaa);
+                pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaFmaskResolve4xEqaa);
                 PAL_NEVER_CALLED();
                 break;
             }
@@ -4360,16 +4631,16 @@ const ComputePipeline* RsrcProcMgr::GetCsResolvePipeline(
             switch (mode)
             {
             case ResolveMode::Average:
-                pPipeline = GetPipeline(RpmComputePipeline::MsaaFmaskResolve8xEqaa);
+                pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaFmaskResolve8xEqaa);
                 break;
             case ResolveMode::Minimum:
-                pPipeline = GetPipeline(RpmComputePipeline::MsaaFmaskResolve8xEqaaMin);
+                pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaFmaskResolve8xEqaaMin);
                 break;
             case ResolveMode::Maximum:
-                pPipeline = GetPipeline(RpmComputePipeline::MsaaFmaskResolve8xEqaaMax);
+                pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaFmaskResolve8xEqaaMax);
                 break;
             default:
-                pPipeline = GetPipeline(RpmComputePipeline::MsaaFmaskResolve8xEqaa);
+                pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaFmaskResolve8xEqaa);
                 PAL_NEVER_CALLED();
                 break;
             }
@@ -4389,16 +4660,16 @@ const ComputePipeline* RsrcProcMgr::GetCsResolvePipeline(
             switch (mode)
             {
             case ResolveMode::Average:
-                pPipeline = GetPipeline(RpmComputePipeline::MsaaResolve2x);
+                pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaResolve2x);
                 break;
             case ResolveMode::Minimum:
-                pPipeline = GetPipeline(RpmComputePipeline::MsaaResolve2xMin);
+                pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaResolve2xMin);
                 break;
             case ResolveMode::Maximum:
-                pPipeline = GetPipeline(RpmComputePipeline::MsaaResolve2xMax);
+                pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaResolve2xMax);
                 break;
             default:
-                pPipeline = GetPipeline(RpmComputePipeline::MsaaResolve2x);
+                pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaResolve2x);
                 PAL_NEVER_CALLED();
                 break;
             }
@@ -4407,16 +4678,16 @@ const ComputePipeline* RsrcProcMgr::GetCsResolvePipeline(
             switch (mode)
             {
             case ResolveMode::Average:
-                pPipeline = GetPipeline(RpmComputePipeline::MsaaResolve4x);
+                pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaResolve4x);
                 break;
             case ResolveMode::Minimum:
-                pPipeline = GetPipeline(RpmComputePipeline::MsaaResolve4xMin);
+                pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaResolve4xMin);
                 break;
             case ResolveMode::Maximum:
-                pPipeline = GetPipeline(RpmComputePipeline::MsaaResolve4xMax);
+                pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaResolve4xMax);
                 break;
             default:
-                pPipeline = GetPipeline(RpmComputePipeline::MsaaResolve4x);
+                pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaResolve4x);
                 PAL_NEVER_CALLED();
                 break;
             }
@@ -4425,16 +4696,16 @@ const ComputePipeline* RsrcProcMgr::GetCsResolvePipeline(
             switch (mode)
             {
             case ResolveMode::Average:
-                pPipeline = GetPipeline(RpmComputePipeline::MsaaResolve8x);
+                pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaResolve8x);
                 break;
             case ResolveMode::Minimum:
-                pPipeline = GetPipeline(RpmComputePipeline::MsaaResolve8xMin);
+                pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaResolve8xMin);
                 break;
             case ResolveMode::Maximum:
-                pPipeline = GetPipeline(RpmComputePipeline::MsaaResolve8xMax);
+                pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaResolve8xMax);
                 break;
             default:
-                pPipeline = GetPipeline(RpmComputePipeline::MsaaResolve8x);
+                pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaResolve8x);
                 PAL_NEVER_CALLED();
                 break;
             }
@@ -4452,16 +4723,16 @@ const ComputePipeline* RsrcProcMgr::GetCsResolvePipeline(
             switch (mode)
             {
             case ResolveMode::Average:
-                pPipeline = GetPipeline(RpmComputePipeline::MsaaFmaskResolve2x);
+                pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaFmaskResolve2x);
                 break;
             case ResolveMode::Minimum:
-                pPipeline = GetPipeline(RpmComputePipeline::MsaaFmaskResolve2xMin);
+                pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaFmaskResolve2xMin);
                 break;
             case ResolveMode::Maximum:
-                pPipeline = GetPipeline(RpmComputePipeline::MsaaFmaskResolve2xMax);
+                pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaFmaskResolve2xMax);
                 break;
             default:
-                pPipeline = GetPipeline(RpmComputePipeline::MsaaFmaskResolve2x);
+                pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaFmaskResolve2x);
                 PAL_NEVER_CALLED();
                 break;
             }
@@ -4470,16 +4741,16 @@ const ComputePipeline* RsrcProcMgr::GetCsResolvePipeline(
             switch (mode)
             {
             case ResolveMode::Average:
-                pPipeline = GetPipeline(RpmComputePipeline::MsaaFmaskResolve4x);
+                pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaFmaskResolve4x);
                 break;
             case ResolveMode::Minimum:
-                pPipeline = GetPipeline(RpmComputePipeline::MsaaFmaskResolve4xMin);
+                pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaFmaskResolve4xMin);
                 break;
             case ResolveMode::Maximum:
-                pPipeline = GetPipeline(RpmComputePipeline::MsaaFmaskResolve4xMax);
+                pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaFmaskResolve4xMax);
                 break;
             default:
-                pPipeline = GetPipeline(RpmComputePipeline::MsaaFmaskResolve4x);
+                pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaFmaskResolve4x);
                 PAL_NEVER_CALLED();
                 break;
             }
@@ -4488,16 +4759,16 @@ const ComputePipeline* RsrcProcMgr::GetCsResolvePipeline(
             switch (mode)
             {
             case ResolveMode::Average:
-                pPipeline = GetPipeline(RpmComputePipeline::MsaaFmaskResolve8x);
+                pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaFmaskResolve8x);
                 break;
             case ResolveMode::Minimum:
-                pPipeline = GetPipeline(RpmComputePipeline::MsaaFmaskResolve8xMin);
+                pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaFmaskResolve8xMin);
                 break;
             case ResolveMode::Maximum:
-                pPipeline = GetPipeline(RpmComputePipeline::MsaaFmaskResolve8xMax);
+                pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaFmaskResolve8xMax);
                 break;
             default:
-                pPipeline = GetPipeline(RpmComputePipeline::MsaaFmaskResolve8x);
+                pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::MsaaFmaskResolve8x);
                 PAL_NEVER_CALLED();
                 break;
             }
@@ -4581,128 +4852,134 @@ void RsrcProcMgr::ExpandDepthStencil(
     bindTargetsInfo.depthTarget.stencilLayout.usages  = LayoutDepthStencilTarget;
     bindTargetsInfo.depthTarget.stencilLayout.engines = LayoutUniversalEngine;
 
-    // Save current command buffer state and bind graphics state which is common for all subresources.
-    pCmdBuffer->PushGraphicsState();
-    pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Graphics, GetGfxPipeline(DepthExpand), });
-    pCmdBuffer->CmdBindDepthStencilState(m_pDepthExpandState);
-    pCmdBuffer->CmdBindMsaaState(pMsaaState);
+    const GraphicsPipeline*const pPipeline = GetGfxPipeline(pCmdBuffer, DepthExpand);
 
-#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 339
-    if (pQuadSamplePattern != nullptr)
+    if (pPipeline != nullptr)
     {
-        pCmdBuffer->CmdSetMsaaQuadSamplePattern(image.GetImageCreateInfo().samples, *pQuadSamplePattern);
-    }
+        // Save current command buffer state and bind graphics state which is common for all subresources.
+        pCmdBuffer->PushGraphicsState();
+        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Graphics, pPipeline, });
+        pCmdBuffer->CmdBindDepthStencilState(m_pDepthExpandState);
+        pCmdBuffer->CmdBindMsaaState(pMsaaState);
+
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 339
+        if (pQuadSamplePattern != nullptr)
+        {
+            pCmdBuffer->CmdSetMsaaQuadSamplePattern(image.GetImageCreateInfo().samples, *pQuadSamplePattern);
+        }
 #elif PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 282
-    if (pSamplePattern != nullptr)
-    {
-        if (pSamplePattern->flags.isLoad == 0)
+        if (pSamplePattern != nullptr)
         {
-            if (pSamplePattern->pImmediate != nullptr)
+            if (pSamplePattern->flags.isLoad == 0)
             {
-                pCmdBuffer->CmdSetMsaaQuadSamplePattern(
-                    image.GetImageCreateInfo().samples, *pSamplePattern->pImmediate);
+                if (pSamplePattern->pImmediate != nullptr)
+                {
+                    pCmdBuffer->CmdSetMsaaQuadSamplePattern(
+                        image.GetImageCreateInfo().samples, *pSamplePattern->pImmediate);
+                }
             }
-        }
-        else
-        {
-            PAL_ASSERT(pSamplePattern->pGpuMemory != nullptr);
+            else
+            {
+                PAL_ASSERT(pSamplePattern->pGpuMemory != nullptr);
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 283
-            pCmdBuffer->CmdLoadMsaaQuadSamplePattern(pSamplePattern->pGpuMemory, pSamplePattern->memOffset);
+                pCmdBuffer->CmdLoadMsaaQuadSamplePattern(pSamplePattern->pGpuMemory, pSamplePattern->memOffset);
 #else
-            pCmdBuffer->CmdLoadMsaaQuadSamplePattern(*pSamplePattern->pGpuMemory, pSamplePattern->memOffset);
+                pCmdBuffer->CmdLoadMsaaQuadSamplePattern(*pSamplePattern->pGpuMemory, pSamplePattern->memOffset);
 #endif
+            }
         }
-    }
 #elif PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 280
-    if (pSamplePattern != nullptr)
-    {
-        if (pSamplePattern->pImmediate != nullptr)
+        if (pSamplePattern != nullptr)
         {
-            PAL_ASSERT(pSamplePattern->pGpuMemory == nullptr);
-            pCmdBuffer->CmdSetMsaaQuadSamplePattern(image.GetImageCreateInfo().samples, *pSamplePattern->pImmediate);
+            if (pSamplePattern->pImmediate != nullptr)
+            {
+                PAL_ASSERT(pSamplePattern->pGpuMemory == nullptr);
+                pCmdBuffer->CmdSetMsaaQuadSamplePattern(image.GetImageCreateInfo().samples,
+                                                        *pSamplePattern->pImmediate);
+            }
+            else if (pSamplePattern->pGpuMemory != nullptr)
+            {
+                pCmdBuffer->CmdLoadMsaaQuadSamplePattern(*pSamplePattern->pGpuMemory, pSamplePattern->memOffset);
+            }
         }
-        else if (pSamplePattern->pGpuMemory != nullptr)
+#else
+        if (pQuadSamplePattern != nullptr)
         {
-            pCmdBuffer->CmdLoadMsaaQuadSamplePattern(*pSamplePattern->pGpuMemory, pSamplePattern->memOffset);
+            pCmdBuffer->CmdSetMsaaQuadSamplePattern(image.GetImageCreateInfo().samples, *pQuadSamplePattern);
         }
-    }
-#else
-    if (pQuadSamplePattern != nullptr)
-    {
-        pCmdBuffer->CmdSetMsaaQuadSamplePattern(image.GetImageCreateInfo().samples, *pQuadSamplePattern);
-    }
 #endif
 
-    pCmdBuffer->CmdSetDepthBiasState(depthBias);
-    pCmdBuffer->CmdSetInputAssemblyState(inputAssemblyState);
-    pCmdBuffer->CmdSetPointLineRasterState(pointLineRasterState);
-    pCmdBuffer->CmdSetStencilRefMasks(stencilRefMasks);
-    pCmdBuffer->CmdSetTriangleRasterState(triangleRasterState);
+        pCmdBuffer->CmdSetDepthBiasState(depthBias);
+        pCmdBuffer->CmdSetInputAssemblyState(inputAssemblyState);
+        pCmdBuffer->CmdSetPointLineRasterState(pointLineRasterState);
+        pCmdBuffer->CmdSetStencilRefMasks(stencilRefMasks);
+        pCmdBuffer->CmdSetTriangleRasterState(triangleRasterState);
 
-    RpmUtil::WriteVsZOut(pCmdBuffer, 1.0f);
+        RpmUtil::WriteVsZOut(pCmdBuffer, 1.0f);
 
-    const uint32 lastMip   = (range.startSubres.mipLevel   + range.numMips   - 1);
-    const uint32 lastSlice = (range.startSubres.arraySlice + range.numSlices - 1);
+        const uint32 lastMip   = (range.startSubres.mipLevel   + range.numMips   - 1);
+        const uint32 lastSlice = (range.startSubres.arraySlice + range.numSlices - 1);
 
-    for (depthViewInfo.mipLevel  = range.startSubres.mipLevel;
-         depthViewInfo.mipLevel <= lastMip;
-         ++depthViewInfo.mipLevel)
-    {
-        LinearAllocatorAuto<VirtualLinearAllocator> mipAlloc(pCmdBuffer->Allocator(), false);
+        for (depthViewInfo.mipLevel  = range.startSubres.mipLevel;
+             depthViewInfo.mipLevel <= lastMip;
+             ++depthViewInfo.mipLevel)
+        {
+            LinearAllocatorAuto<VirtualLinearAllocator> mipAlloc(pCmdBuffer->Allocator(), false);
 
-        const SubresId mipSubres  = { range.startSubres.aspect, depthViewInfo.mipLevel, 0 };
-        const auto&    subResInfo = *image.SubresourceInfo(mipSubres);
+            const SubresId mipSubres  = { range.startSubres.aspect, depthViewInfo.mipLevel, 0 };
+            const auto&    subResInfo = *image.SubresourceInfo(mipSubres);
 
-        // All slices of the same mipmap level can re-use the same viewport/scissor state.
-        viewportInfo.viewports[0].width  = static_cast<float>(subResInfo.extentTexels.width);
-        viewportInfo.viewports[0].height = static_cast<float>(subResInfo.extentTexels.height);
+            // All slices of the same mipmap level can re-use the same viewport/scissor state.
+            viewportInfo.viewports[0].width  = static_cast<float>(subResInfo.extentTexels.width);
+            viewportInfo.viewports[0].height = static_cast<float>(subResInfo.extentTexels.height);
 
-        scissorInfo.scissors[0].extent.width  = subResInfo.extentTexels.width;
-        scissorInfo.scissors[0].extent.height = subResInfo.extentTexels.height;
+            scissorInfo.scissors[0].extent.width  = subResInfo.extentTexels.width;
+            scissorInfo.scissors[0].extent.height = subResInfo.extentTexels.height;
 
-        pCmdBuffer->CmdSetViewports(viewportInfo);
-        pCmdBuffer->CmdSetScissorRects(scissorInfo);
+            pCmdBuffer->CmdSetViewports(viewportInfo);
+            pCmdBuffer->CmdSetScissorRects(scissorInfo);
 
-        for (depthViewInfo.baseArraySlice  = range.startSubres.arraySlice;
-             depthViewInfo.baseArraySlice <= lastSlice;
-             ++depthViewInfo.baseArraySlice)
-        {
-            LinearAllocatorAuto<VirtualLinearAllocator> sliceAlloc(pCmdBuffer->Allocator(), false);
+            for (depthViewInfo.baseArraySlice  = range.startSubres.arraySlice;
+                 depthViewInfo.baseArraySlice <= lastSlice;
+                 ++depthViewInfo.baseArraySlice)
+            {
+                LinearAllocatorAuto<VirtualLinearAllocator> sliceAlloc(pCmdBuffer->Allocator(), false);
 
-            // Create and bind a depth stencil view of the current subresource.
-            IDepthStencilView* pDepthView = nullptr;
-            void* pDepthViewMem =
-                PAL_MALLOC(m_pDevice->GetDepthStencilViewSize(nullptr), &sliceAlloc, AllocInternalTemp);
+                // Create and bind a depth stencil view of the current subresource.
+                IDepthStencilView* pDepthView = nullptr;
+                void* pDepthViewMem =
+                    PAL_MALLOC(m_pDevice->GetDepthStencilViewSize(nullptr), &sliceAlloc, AllocInternalTemp);
 
-            if (pDepthViewMem == nullptr)
-            {
-                pCmdBuffer->NotifyAllocFailure();
-            }
-            else
-            {
-                Result result = m_pDevice->CreateDepthStencilView(depthViewInfo,
-                                                                  depthViewInfoInternal,
-                                                                  pDepthViewMem,
-                                                                  &pDepthView);
-                PAL_ASSERT(result == Result::Success);
+                if (pDepthViewMem == nullptr)
+                {
+                    pCmdBuffer->NotifyAllocFailure();
+                }
+                else
+                {
+                    Result result = m_pDevice->CreateDepthStencilView(depthViewInfo,
+                                                                      depthViewInfoInternal,
+                                                                      pDepthViewMem,
+                                                                      &pDepthView);
+                    PAL_ASSERT(result == Result::Success);
 
-                bindTargetsInfo.depthTarget.pDepthStencilView = pDepthView;
-                pCmdBuffer->CmdBindTargets(bindTargetsInfo);
+                    bindTargetsInfo.depthTarget.pDepthStencilView = pDepthView;
+                    pCmdBuffer->CmdBindTargets(bindTargetsInfo);
 
-                // Draw a fullscreen quad.
-                pCmdBuffer->CmdDraw(0, 3, 0, 1);
+                    // Draw a fullscreen quad.
+                    pCmdBuffer->CmdDraw(0, 3, 0, 1);
 
-                PAL_SAFE_FREE(pDepthViewMem, &sliceAlloc);
+                    PAL_SAFE_FREE(pDepthViewMem, &sliceAlloc);
 
-                // Unbind the depth view and destroy it.
-                bindTargetsInfo.depthTarget.pDepthStencilView = nullptr;
-                pCmdBuffer->CmdBindTargets(bindTargetsInfo);
+                    // Unbind the depth view and destroy it.
+                    bindTargetsInfo.depthTarget.pDepthStencilView = nullptr;
+                    pCmdBuffer->CmdBindTargets(bindTargetsInfo);
+                }
             }
         }
-    }
 
-    // Restore command buffer state.
-    pCmdBuffer->PopGraphicsState();
+        // Restore command buffer state.
+        pCmdBuffer->PopGraphicsState();
+    }
 }
 
 // =====================================================================================================================
@@ -4774,117 +5051,124 @@ void RsrcProcMgr::ResummarizeDepthStencil(
     bindTargetsInfo.depthTarget.depthLayout       = imageLayout;
     bindTargetsInfo.depthTarget.stencilLayout     = imageLayout;
 
-    // Save current command buffer state and bind graphics state which is common for all subresources.
-    pCmdBuffer->PushGraphicsState();
-    pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Graphics, GetGfxPipeline(DepthResummarize), });
-    pCmdBuffer->CmdBindDepthStencilState(m_pDepthResummarizeState);
-    pCmdBuffer->CmdBindMsaaState(pMsaaState);
+    const GraphicsPipeline*const pPipeline = GetGfxPipeline(pCmdBuffer, DepthResummarize);
 
-#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 339
-    if (pQuadSamplePattern != nullptr)
+    if (pPipeline != nullptr)
     {
-        pCmdBuffer->CmdSetMsaaQuadSamplePattern(image.GetImageCreateInfo().samples, *pQuadSamplePattern);
-    }
+        // Save current command buffer state and bind graphics state which is common for all subresources.
+        pCmdBuffer->PushGraphicsState();
+        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Graphics, pPipeline, });
+        pCmdBuffer->CmdBindDepthStencilState(m_pDepthResummarizeState);
+        pCmdBuffer->CmdBindMsaaState(pMsaaState);
+
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 339
+        if (pQuadSamplePattern != nullptr)
+        {
+            pCmdBuffer->CmdSetMsaaQuadSamplePattern(image.GetImageCreateInfo().samples, *pQuadSamplePattern);
+        }
 #elif PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 282
-    if (pSamplePattern != nullptr)
-    {
-        // ResummarizeDepthStencil always needs to set the sample pattern in immediate mode. It does not need
-        // to know what the previous sample pattern was.
-        if (pSamplePattern->pImmediate != nullptr)
+        if (pSamplePattern != nullptr)
         {
-            pCmdBuffer->CmdSetMsaaQuadSamplePattern(image.GetImageCreateInfo().samples, *pSamplePattern->pImmediate);
+            // ResummarizeDepthStencil always needs to set the sample pattern in immediate mode. It does not need
+            // to know what the previous sample pattern was.
+            if (pSamplePattern->pImmediate != nullptr)
+            {
+                pCmdBuffer->CmdSetMsaaQuadSamplePattern(image.GetImageCreateInfo().samples,
+                                                        *pSamplePattern->pImmediate);
+            }
         }
-    }
 #elif PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 280
-    if (pSamplePattern != nullptr)
-    {
-        if (pSamplePattern->pImmediate != nullptr)
+        if (pSamplePattern != nullptr)
         {
-            PAL_ASSERT(pSamplePattern->pGpuMemory == nullptr);
-            pCmdBuffer->CmdSetMsaaQuadSamplePattern(image.GetImageCreateInfo().samples, *pSamplePattern->pImmediate);
+            if (pSamplePattern->pImmediate != nullptr)
+            {
+                PAL_ASSERT(pSamplePattern->pGpuMemory == nullptr);
+                pCmdBuffer->CmdSetMsaaQuadSamplePattern(image.GetImageCreateInfo().samples,
+                                                        *pSamplePattern->pImmediate);
+            }
+            else if (pSamplePattern->pGpuMemory != nullptr)
+            {
+                pCmdBuffer->CmdLoadMsaaQuadSamplePattern(*pSamplePattern->pGpuMemory, pSamplePattern->memOffset);
+            }
         }
-        else if (pSamplePattern->pGpuMemory != nullptr)
+#else
+        if (pQuadSamplePattern != nullptr)
         {
-            pCmdBuffer->CmdLoadMsaaQuadSamplePattern(*pSamplePattern->pGpuMemory, pSamplePattern->memOffset);
+            pCmdBuffer->CmdSetMsaaQuadSamplePattern(image.GetImageCreateInfo().samples, *pQuadSamplePattern);
         }
-    }
-#else
-    if (pQuadSamplePattern != nullptr)
-    {
-        pCmdBuffer->CmdSetMsaaQuadSamplePattern(image.GetImageCreateInfo().samples, *pQuadSamplePattern);
-    }
 #endif
 
-    pCmdBuffer->CmdSetDepthBiasState(depthBias);
-    pCmdBuffer->CmdSetInputAssemblyState(inputAssemblyState);
-    pCmdBuffer->CmdSetPointLineRasterState(pointLineRasterState);
-    pCmdBuffer->CmdSetStencilRefMasks(stencilRefMasks);
-    pCmdBuffer->CmdSetTriangleRasterState(triangleRasterState);
+        pCmdBuffer->CmdSetDepthBiasState(depthBias);
+        pCmdBuffer->CmdSetInputAssemblyState(inputAssemblyState);
+        pCmdBuffer->CmdSetPointLineRasterState(pointLineRasterState);
+        pCmdBuffer->CmdSetStencilRefMasks(stencilRefMasks);
+        pCmdBuffer->CmdSetTriangleRasterState(triangleRasterState);
 
-    RpmUtil::WriteVsZOut(pCmdBuffer, 1.0f);
+        RpmUtil::WriteVsZOut(pCmdBuffer, 1.0f);
 
-    const uint32 lastMip   = range.startSubres.mipLevel   + range.numMips   - 1;
-    const uint32 lastSlice = range.startSubres.arraySlice + range.numSlices - 1;
+        const uint32 lastMip   = range.startSubres.mipLevel   + range.numMips   - 1;
+        const uint32 lastSlice = range.startSubres.arraySlice + range.numSlices - 1;
 
-    for (depthViewInfo.mipLevel  = range.startSubres.mipLevel;
-         depthViewInfo.mipLevel <= lastMip;
-         ++depthViewInfo.mipLevel)
-    {
-        LinearAllocatorAuto<VirtualLinearAllocator> mipAlloc(pCmdBuffer->Allocator(), false);
+        for (depthViewInfo.mipLevel  = range.startSubres.mipLevel;
+             depthViewInfo.mipLevel <= lastMip;
+             ++depthViewInfo.mipLevel)
+        {
+            LinearAllocatorAuto<VirtualLinearAllocator> mipAlloc(pCmdBuffer->Allocator(), false);
 
-        const SubresId mipSubres  = { range.startSubres.aspect, depthViewInfo.mipLevel, 0 };
-        const auto&    subResInfo = *image.SubresourceInfo(mipSubres);
+            const SubresId mipSubres  = { range.startSubres.aspect, depthViewInfo.mipLevel, 0 };
+            const auto&    subResInfo = *image.SubresourceInfo(mipSubres);
 
-        // All slices of the same mipmap level can re-use the same viewport/scissor state.
-        viewportInfo.viewports[0].width  = static_cast<float>(subResInfo.extentTexels.width);
-        viewportInfo.viewports[0].height = static_cast<float>(subResInfo.extentTexels.height);
+            // All slices of the same mipmap level can re-use the same viewport/scissor state.
+            viewportInfo.viewports[0].width  = static_cast<float>(subResInfo.extentTexels.width);
+            viewportInfo.viewports[0].height = static_cast<float>(subResInfo.extentTexels.height);
 
-        scissorInfo.scissors[0].extent.width  = subResInfo.extentTexels.width;
-        scissorInfo.scissors[0].extent.height = subResInfo.extentTexels.height;
+            scissorInfo.scissors[0].extent.width  = subResInfo.extentTexels.width;
+            scissorInfo.scissors[0].extent.height = subResInfo.extentTexels.height;
 
-        pCmdBuffer->CmdSetViewports(viewportInfo);
-        pCmdBuffer->CmdSetScissorRects(scissorInfo);
+            pCmdBuffer->CmdSetViewports(viewportInfo);
+            pCmdBuffer->CmdSetScissorRects(scissorInfo);
 
-        for (depthViewInfo.baseArraySlice  = range.startSubres.arraySlice;
-             depthViewInfo.baseArraySlice <= lastSlice;
-             ++depthViewInfo.baseArraySlice)
-        {
-            LinearAllocatorAuto<VirtualLinearAllocator> sliceAlloc(pCmdBuffer->Allocator(), false);
+            for (depthViewInfo.baseArraySlice  = range.startSubres.arraySlice;
+                 depthViewInfo.baseArraySlice <= lastSlice;
+                 ++depthViewInfo.baseArraySlice)
+            {
+                LinearAllocatorAuto<VirtualLinearAllocator> sliceAlloc(pCmdBuffer->Allocator(), false);
 
-            // Create and bind a depth stencil view of the current subresource.
-            IDepthStencilView* pDepthView = nullptr;
-            void* pDepthViewMem =
-                PAL_MALLOC(m_pDevice->GetDepthStencilViewSize(nullptr), &sliceAlloc, AllocInternalTemp);
+                // Create and bind a depth stencil view of the current subresource.
+                IDepthStencilView* pDepthView = nullptr;
+                void* pDepthViewMem =
+                    PAL_MALLOC(m_pDevice->GetDepthStencilViewSize(nullptr), &sliceAlloc, AllocInternalTemp);
 
-            if (pDepthViewMem == nullptr)
-            {
-                pCmdBuffer->NotifyAllocFailure();
-            }
-            else
-            {
-                Result result = m_pDevice->CreateDepthStencilView(depthViewInfo,
-                                                                  depthViewInfoInternal,
-                                                                  pDepthViewMem,
-                                                                  &pDepthView);
-                PAL_ASSERT(result == Result::Success);
+                if (pDepthViewMem == nullptr)
+                {
+                    pCmdBuffer->NotifyAllocFailure();
+                }
+                else
+                {
+                    Result result = m_pDevice->CreateDepthStencilView(depthViewInfo,
+                                                                      depthViewInfoInternal,
+                                                                      pDepthViewMem,
+                                                                      &pDepthView);
+                    PAL_ASSERT(result == Result::Success);
 
-                bindTargetsInfo.depthTarget.pDepthStencilView = pDepthView;
-                pCmdBuffer->CmdBindTargets(bindTargetsInfo);
+                    bindTargetsInfo.depthTarget.pDepthStencilView = pDepthView;
+                    pCmdBuffer->CmdBindTargets(bindTargetsInfo);
 
-                // Draw a fullscreen quad.
-                pCmdBuffer->CmdDraw(0, 3, 0, 1);
+                    // Draw a fullscreen quad.
+                    pCmdBuffer->CmdDraw(0, 3, 0, 1);
 
-                PAL_SAFE_FREE(pDepthViewMem, &sliceAlloc);
+                    PAL_SAFE_FREE(pDepthViewMem, &sliceAlloc);
 
-                // Unbind the depth view and destroy it.
-                bindTargetsInfo.depthTarget.pDepthStencilView = nullptr;
-                pCmdBuffer->CmdBindTargets(bindTargetsInfo);
+                    // Unbind the depth view and destroy it.
+                    bindTargetsInfo.depthTarget.pDepthStencilView = nullptr;
+                    pCmdBuffer->CmdBindTargets(bindTargetsInfo);
+                }
             }
         }
-    }
 
-    // Restore command buffer state.
-    pCmdBuffer->PopGraphicsState();
+        // Restore command buffer state.
+        pCmdBuffer->PopGraphicsState();
+    }
 }
 
 // =====================================================================================================================
@@ -4965,181 +5249,188 @@ void RsrcProcMgr::GenericColorBlit(
         ProvokingVertex::First  // provokingVertex
     };
 
-    // Save current command buffer state and bind graphics state which is common for all mipmap levels.
-    pCmdBuffer->PushGraphicsState();
-    pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Graphics, GetGfxPipeline(pipeline), });
+    const GraphicsPipeline*const pPipeline = GetGfxPipeline(pCmdBuffer, pipeline);
 
-    SwizzledFormat swizzledFormat = {};
+    if (pPipeline != nullptr)
+    {
+        // Save current command buffer state and bind graphics state which is common for all mipmap levels.
+        pCmdBuffer->PushGraphicsState();
+        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Graphics, pPipeline, });
 
-    swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
-    swizzledFormat.swizzle = { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+        SwizzledFormat swizzledFormat = {};
 
-    pCmdBuffer->CmdOverwriteRbPlusFormatForBlits(swizzledFormat, 0);
+        swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
+        swizzledFormat.swizzle = { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-    pCmdBuffer->CmdBindColorBlendState(m_pBlendDisableState);
-    pCmdBuffer->CmdBindDepthStencilState(m_pDepthDisableState);
-    pCmdBuffer->CmdBindMsaaState(&msaaState);
+        pCmdBuffer->CmdOverwriteRbPlusFormatForBlits(swizzledFormat, 0);
+
+        pCmdBuffer->CmdBindColorBlendState(m_pBlendDisableState);
+        pCmdBuffer->CmdBindDepthStencilState(m_pDepthDisableState);
+        pCmdBuffer->CmdBindMsaaState(&msaaState);
 
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 339
-    if (pQuadSamplePattern != nullptr)
-    {
-        pCmdBuffer->CmdSetMsaaQuadSamplePattern(dstImage.GetImageCreateInfo().samples, *pQuadSamplePattern);
-    }
+        if (pQuadSamplePattern != nullptr)
+        {
+            pCmdBuffer->CmdSetMsaaQuadSamplePattern(dstImage.GetImageCreateInfo().samples, *pQuadSamplePattern);
+        }
 #elif PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 282
-    if (pSamplePattern != nullptr)
-    {
-        // GenericColorBlit always needs to set the sample pattern in immediate mode. It does not need
-        // to know what the previous sample pattern was. That's only needed if we are decompressing depth.
-        if (pSamplePattern->pImmediate != nullptr)
+        if (pSamplePattern != nullptr)
         {
-            pCmdBuffer->CmdSetMsaaQuadSamplePattern(dstImage.GetImageCreateInfo().samples, *pSamplePattern->pImmediate);
+            // GenericColorBlit always needs to set the sample pattern in immediate mode. It does not need
+            // to know what the previous sample pattern was. That's only needed if we are decompressing depth.
+            if (pSamplePattern->pImmediate != nullptr)
+            {
+                pCmdBuffer->CmdSetMsaaQuadSamplePattern(dstImage.GetImageCreateInfo().samples,
+                                                        *pSamplePattern->pImmediate);
+            }
         }
-    }
 #elif PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 280
-    if (pSamplePattern != nullptr)
-    {
-        if (pSamplePattern->pImmediate != nullptr)
+        if (pSamplePattern != nullptr)
         {
-            PAL_ASSERT(pSamplePattern->pGpuMemory == nullptr);
-            pCmdBuffer->CmdSetMsaaQuadSamplePattern(dstImage.GetImageCreateInfo().samples, *pSamplePattern->pImmediate);
+            if (pSamplePattern->pImmediate != nullptr)
+            {
+                PAL_ASSERT(pSamplePattern->pGpuMemory == nullptr);
+                pCmdBuffer->CmdSetMsaaQuadSamplePattern(dstImage.GetImageCreateInfo().samples,
+                                                        *pSamplePattern->pImmediate);
+            }
+            else if (pSamplePattern->pGpuMemory != nullptr)
+            {
+                pCmdBuffer->CmdLoadMsaaQuadSamplePattern(*pSamplePattern->pGpuMemory, pSamplePattern->memOffset);
+            }
         }
-        else if (pSamplePattern->pGpuMemory != nullptr)
+#else
+        if (pQuadSamplePattern != nullptr)
         {
-            pCmdBuffer->CmdLoadMsaaQuadSamplePattern(*pSamplePattern->pGpuMemory, pSamplePattern->memOffset);
+            pCmdBuffer->CmdSetMsaaQuadSamplePattern(dstImage.GetImageCreateInfo().samples, *pQuadSamplePattern);
         }
-    }
-#else
-    if (pQuadSamplePattern != nullptr)
-    {
-        pCmdBuffer->CmdSetMsaaQuadSamplePattern(dstImage.GetImageCreateInfo().samples, *pQuadSamplePattern);
-    }
 #endif
 
-    pCmdBuffer->CmdSetDepthBiasState(depthBias);
-    pCmdBuffer->CmdSetInputAssemblyState(inputAssemblyState);
-    pCmdBuffer->CmdSetPointLineRasterState(pointLineRasterState);
-    pCmdBuffer->CmdSetStencilRefMasks(stencilRefMasks);
-    pCmdBuffer->CmdSetTriangleRasterState(triangleRasterState);
+        pCmdBuffer->CmdSetDepthBiasState(depthBias);
+        pCmdBuffer->CmdSetInputAssemblyState(inputAssemblyState);
+        pCmdBuffer->CmdSetPointLineRasterState(pointLineRasterState);
+        pCmdBuffer->CmdSetStencilRefMasks(stencilRefMasks);
+        pCmdBuffer->CmdSetTriangleRasterState(triangleRasterState);
 
-    RpmUtil::WriteVsZOut(pCmdBuffer, 1.0f);
+        RpmUtil::WriteVsZOut(pCmdBuffer, 1.0f);
 
-    const uint32 lastMip = (range.startSubres.mipLevel + range.numMips - 1);
+        const uint32 lastMip = (range.startSubres.mipLevel + range.numMips - 1);
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 311
-    gpusize mipCondDwordsOffset = metaDataOffset;
+        gpusize mipCondDwordsOffset = metaDataOffset;
 #endif
-    for (uint32 mip = range.startSubres.mipLevel; mip <= lastMip; ++mip)
-    {
-        // Use predication to skip this operation based on the image's conditional dwords.
-        // We can only perform this optimization if the client is not currently using predication.
-        bool needDisablePredication = false;
+        for (uint32 mip = range.startSubres.mipLevel; mip <= lastMip; ++mip)
+        {
+            // Use predication to skip this operation based on the image's conditional dwords.
+            // We can only perform this optimization if the client is not currently using predication.
+            bool needDisablePredication = false;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 311
-        if ((pCmdBuffer->GetGfxCmdBufState().clientPredicate == 0) && (pGpuMemory != nullptr))
-        {
-            // Set/Enable predication
-            pCmdBuffer->CmdSetPredication(nullptr,
-                                          0,
-                                          pGpuMemory,
-                                          mipCondDwordsOffset,
-                                          PredicateType::Boolean,
-                                          true,
-                                          false,
-                                          false);
-            mipCondDwordsOffset += PredicationAlign; // Advance to the next mip's conditional meta-data.
-
-            needDisablePredication = true;
-        }
+            if ((pCmdBuffer->GetGfxCmdBufState().clientPredicate == 0) && (pGpuMemory != nullptr))
+            {
+                // Set/Enable predication
+                pCmdBuffer->CmdSetPredication(nullptr,
+                                              0,
+                                              pGpuMemory,
+                                              mipCondDwordsOffset,
+                                              PredicateType::Boolean,
+                                              true,
+                                              false,
+                                              false);
+                mipCondDwordsOffset += PredicationAlign; // Advance to the next mip's conditional meta-data.
+
+                needDisablePredication = true;
+            }
 #else
-        if ((pCmdBuffer->GetGfxCmdBufState().clientPredicate == 0) && (mipCondDwordsAddr != 0))
-        {
-            // Set/Enable predication
-            pCmdBuffer->CmdSetPredication(nullptr,
-                                          0,
-                                          mipCondDwordsAddr,
-                                          PredicateType::Boolean,
-                                          true,
-                                          false,
-                                          false);
-            mipCondDwordsAddr += PredicationAlign; // Advance to the next mip's conditional meta-data.
-
-            needDisablePredication = true;
-        }
+            if ((pCmdBuffer->GetGfxCmdBufState().clientPredicate == 0) && (mipCondDwordsAddr != 0))
+            {
+                // Set/Enable predication
+                pCmdBuffer->CmdSetPredication(nullptr,
+                                              0,
+                                              mipCondDwordsAddr,
+                                              PredicateType::Boolean,
+                                              true,
+                                              false,
+                                              false);
+                mipCondDwordsAddr += PredicationAlign; // Advance to the next mip's conditional meta-data.
+
+                needDisablePredication = true;
+            }
 #endif
 
-        const SubresId mipSubres  = { range.startSubres.aspect, mip, 0 };
-        const auto&    subResInfo = *dstImage.SubresourceInfo(mipSubres);
+            const SubresId mipSubres  = { range.startSubres.aspect, mip, 0 };
+            const auto&    subResInfo = *dstImage.SubresourceInfo(mipSubres);
 
-        // All slices of the same mipmap level can re-use the same viewport & scissor states.
-        viewportInfo.viewports[0].width       = static_cast<float>(subResInfo.extentTexels.width);
-        viewportInfo.viewports[0].height      = static_cast<float>(subResInfo.extentTexels.height);
-        scissorInfo.scissors[0].extent.width  = subResInfo.extentTexels.width;
-        scissorInfo.scissors[0].extent.height = subResInfo.extentTexels.height;
+            // All slices of the same mipmap level can re-use the same viewport & scissor states.
+            viewportInfo.viewports[0].width       = static_cast<float>(subResInfo.extentTexels.width);
+            viewportInfo.viewports[0].height      = static_cast<float>(subResInfo.extentTexels.height);
+            scissorInfo.scissors[0].extent.width  = subResInfo.extentTexels.width;
+            scissorInfo.scissors[0].extent.height = subResInfo.extentTexels.height;
 
-        pCmdBuffer->CmdSetViewports(viewportInfo);
-        pCmdBuffer->CmdSetScissorRects(scissorInfo);
+            pCmdBuffer->CmdSetViewports(viewportInfo);
+            pCmdBuffer->CmdSetScissorRects(scissorInfo);
 
-        // We need to draw each array slice individually because we cannot select which array slice to render to
-        // without a Geometry Shader. If this is a 3D Image, we need to include all slices for this mipmap level.
-        const uint32 baseSlice = (is3dImage ? 0                             : range.startSubres.arraySlice);
-        const uint32 numSlices = (is3dImage ? subResInfo.extentTexels.depth : range.numSlices);
-        const uint32 lastSlice = baseSlice + numSlices - 1;
+            // We need to draw each array slice individually because we cannot select which array slice to render to
+            // without a Geometry Shader. If this is a 3D Image, we need to include all slices for this mipmap level.
+            const uint32 baseSlice = (is3dImage ? 0                             : range.startSubres.arraySlice);
+            const uint32 numSlices = (is3dImage ? subResInfo.extentTexels.depth : range.numSlices);
+            const uint32 lastSlice = baseSlice + numSlices - 1;
 
-        for (uint32 arraySlice = baseSlice; arraySlice <= lastSlice; ++arraySlice)
-        {
-            LinearAllocatorAuto<VirtualLinearAllocator> sliceAlloc(pCmdBuffer->Allocator(), false);
+            for (uint32 arraySlice = baseSlice; arraySlice <= lastSlice; ++arraySlice)
+            {
+                LinearAllocatorAuto<VirtualLinearAllocator> sliceAlloc(pCmdBuffer->Allocator(), false);
 
-            // Create and bind a color-target view for this mipmap level and slice.
-            IColorTargetView* pColorView = nullptr;
-            void* pColorViewMem =
-                PAL_MALLOC(m_pDevice->GetColorTargetViewSize(nullptr), &sliceAlloc, AllocInternalTemp);
+                // Create and bind a color-target view for this mipmap level and slice.
+                IColorTargetView* pColorView = nullptr;
+                void* pColorViewMem =
+                    PAL_MALLOC(m_pDevice->GetColorTargetViewSize(nullptr), &sliceAlloc, AllocInternalTemp);
 
-            if (pColorViewMem == nullptr)
-            {
-                pCmdBuffer->NotifyAllocFailure();
-            }
-            else
-            {
-                colorViewInfo.imageInfo.baseSubRes.arraySlice = arraySlice;
-                colorViewInfo.imageInfo.baseSubRes.mipLevel   = mip;
+                if (pColorViewMem == nullptr)
+                {
+                    pCmdBuffer->NotifyAllocFailure();
+                }
+                else
+                {
+                    colorViewInfo.imageInfo.baseSubRes.arraySlice = arraySlice;
+                    colorViewInfo.imageInfo.baseSubRes.mipLevel   = mip;
 
-                Result result = m_pDevice->CreateColorTargetView(colorViewInfo,
-                                                                 colorViewInfoInternal,
-                                                                 pColorViewMem,
-                                                                 &pColorView);
-                PAL_ASSERT(result == Result::Success);
+                    Result result = m_pDevice->CreateColorTargetView(colorViewInfo,
+                                                                     colorViewInfoInternal,
+                                                                     pColorViewMem,
+                                                                     &pColorView);
+                    PAL_ASSERT(result == Result::Success);
 
-                bindTargetsInfo.colorTargets[0].pColorTargetView = pColorView;
-                bindTargetsInfo.colorTargetCount = 1;
-                pCmdBuffer->CmdBindTargets(bindTargetsInfo);
+                    bindTargetsInfo.colorTargets[0].pColorTargetView = pColorView;
+                    bindTargetsInfo.colorTargetCount = 1;
+                    pCmdBuffer->CmdBindTargets(bindTargetsInfo);
 
-                // Draw a fullscreen quad.
-                pCmdBuffer->CmdDraw(0, 3, 0, 1);
+                    // Draw a fullscreen quad.
+                    pCmdBuffer->CmdDraw(0, 3, 0, 1);
 
-                // Unbind the color-target view and destroy it.
-                bindTargetsInfo.colorTargetCount = 0;
-                pCmdBuffer->CmdBindTargets(bindTargetsInfo);
+                    // Unbind the color-target view and destroy it.
+                    bindTargetsInfo.colorTargetCount = 0;
+                    pCmdBuffer->CmdBindTargets(bindTargetsInfo);
 
-                PAL_SAFE_FREE(pColorViewMem, &sliceAlloc);
-            }
-        } // End for each array slice.
+                    PAL_SAFE_FREE(pColorViewMem, &sliceAlloc);
+                }
+            } // End for each array slice.
 
-        if (needDisablePredication)
-        {
-            // Disable predication
-            pCmdBuffer->CmdSetPredication(nullptr,
-                                            0,
+            if (needDisablePredication)
+            {
+                // Disable predication
+                pCmdBuffer->CmdSetPredication(nullptr,
+                                                0,
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 311
-                                            nullptr,
+                                                nullptr,
 #endif
-                                            0,
-                                            static_cast<PredicateType>(0),
-                                            false,
-                                            false,
-                                            false);
-        }
-    } // End for each mip level.
+                                                0,
+                                                static_cast<PredicateType>(0),
+                                                false,
+                                                false,
+                                                false);
+            }
+        } // End for each mip level.
 
-    // Restore original command buffer state.
-    pCmdBuffer->PopGraphicsState();
+        // Restore original command buffer state.
+        pCmdBuffer->PopGraphicsState();
+    }
 }
 
 // =====================================================================================================================
@@ -5205,134 +5496,140 @@ void RsrcProcMgr::ResolveImageFixedFunc(
     bindTargetsInfo.colorTargets[1].imageLayout.usages  = LayoutColorTarget;
     bindTargetsInfo.colorTargets[1].imageLayout.engines = LayoutUniversalEngine;
 
-    // Save current command buffer state and bind graphics state which is common for all regions.
-    pCmdBuffer->PushGraphicsState();
-    pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Graphics, GetGfxPipeline(ResolveFixedFunc), });
-    pCmdBuffer->CmdBindMsaaState(GetMsaaState(srcImage.GetImageCreateInfo().samples,
-                                              srcImage.GetImageCreateInfo().fragments));
-    pCmdBuffer->CmdBindColorBlendState(m_pBlendDisableState);
-    pCmdBuffer->CmdBindDepthStencilState(m_pDepthDisableState);
-    pCmdBuffer->CmdSetDepthBiasState(depthBias);
-    pCmdBuffer->CmdSetInputAssemblyState(inputAssemblyState);
-    pCmdBuffer->CmdSetPointLineRasterState(pointLineRasterState);
-    pCmdBuffer->CmdSetTriangleRasterState(triangleRasterState);
+    const GraphicsPipeline*const pPipeline = GetGfxPipeline(pCmdBuffer, ResolveFixedFunc);
 
-    // Each region needs to be resolved individually.
-    for (uint32 idx = 0; idx < regionCount; ++idx)
+    if (pPipeline != nullptr)
     {
-        LinearAllocatorAuto<VirtualLinearAllocator> regionAlloc(pCmdBuffer->Allocator(), false);
+        // Save current command buffer state and bind graphics state which is common for all regions.
+        pCmdBuffer->PushGraphicsState();
+        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Graphics, pPipeline, });
+        pCmdBuffer->CmdBindMsaaState(GetMsaaState(srcImage.GetImageCreateInfo().samples,
+                                                  srcImage.GetImageCreateInfo().fragments));
+        pCmdBuffer->CmdBindColorBlendState(m_pBlendDisableState);
+        pCmdBuffer->CmdBindDepthStencilState(m_pDepthDisableState);
+        pCmdBuffer->CmdSetDepthBiasState(depthBias);
+        pCmdBuffer->CmdSetInputAssemblyState(inputAssemblyState);
+        pCmdBuffer->CmdSetPointLineRasterState(pointLineRasterState);
+        pCmdBuffer->CmdSetTriangleRasterState(triangleRasterState);
 
-        srcColorViewInfo.swizzledFormat                = srcCreateInfo.swizzledFormat;
-        dstColorViewInfo.swizzledFormat                = dstCreateInfo.swizzledFormat;
-        dstColorViewInfo.imageInfo.baseSubRes.mipLevel = pRegions[idx].dstMipLevel;
-
-        // Override the formats with the caller's "reinterpret" format:
-        if (Formats::IsUndefined(pRegions[idx].swizzledFormat.format) == false)
+        // Each region needs to be resolved individually.
+        for (uint32 idx = 0; idx < regionCount; ++idx)
         {
-            // We require that the channel formats match.
-            PAL_ASSERT(Formats::ShareChFmt(srcColorViewInfo.swizzledFormat.format,
-                                           pRegions[idx].swizzledFormat.format));
-            PAL_ASSERT(Formats::ShareChFmt(dstColorViewInfo.swizzledFormat.format,
-                                           pRegions[idx].swizzledFormat.format));
-
-            const SubresId srcSubres = { pRegions[idx].srcAspect, 0, pRegions[idx].srcSlice };
-            const SubresId dstSubres = { pRegions[idx].dstAspect, pRegions[idx].dstMipLevel, pRegions[idx].dstSlice };
-
-            // If the specified format exactly matches the image formats the resolve will always work. Otherwise, the
-            // images must support format replacement.
-            PAL_ASSERT(Formats::HaveSameNumFmt(srcColorViewInfo.swizzledFormat.format,
-                                               pRegions[idx].swizzledFormat.format) ||
-                       srcImage.GetGfxImage()->IsFormatReplaceable(srcSubres, srcImageLayout));
+            LinearAllocatorAuto<VirtualLinearAllocator> regionAlloc(pCmdBuffer->Allocator(), false);
 
-            PAL_ASSERT(Formats::HaveSameNumFmt(dstColorViewInfo.swizzledFormat.format,
-                                               pRegions[idx].swizzledFormat.format) ||
-                       dstImage.GetGfxImage()->IsFormatReplaceable(dstSubres, dstImageLayout));
-
-            srcColorViewInfo.swizzledFormat.format = pRegions[idx].swizzledFormat.format;
-            dstColorViewInfo.swizzledFormat.format = pRegions[idx].swizzledFormat.format;
-        }
+            srcColorViewInfo.swizzledFormat                = srcCreateInfo.swizzledFormat;
+            dstColorViewInfo.swizzledFormat                = dstCreateInfo.swizzledFormat;
+            dstColorViewInfo.imageInfo.baseSubRes.mipLevel = pRegions[idx].dstMipLevel;
 
-        // Setup the viewport and scissor to restrict rendering to the destination region being copied.
-        viewportInfo.viewports[0].originX = static_cast<float>(pRegions[idx].srcOffset.x);
-        viewportInfo.viewports[0].originY = static_cast<float>(pRegions[idx].srcOffset.y);
-        viewportInfo.viewports[0].width   = static_cast<float>(pRegions[idx].extent.width);
-        viewportInfo.viewports[0].height  = static_cast<float>(pRegions[idx].extent.height);
-        viewportInfo.viewports[1].originX = static_cast<float>(pRegions[idx].dstOffset.x);
-        viewportInfo.viewports[1].originY = static_cast<float>(pRegions[idx].dstOffset.y);
-        viewportInfo.viewports[1].width   = static_cast<float>(pRegions[idx].extent.width);
-        viewportInfo.viewports[1].height  = static_cast<float>(pRegions[idx].extent.height);
+            // Override the formats with the caller's "reinterpret" format:
+            if (Formats::IsUndefined(pRegions[idx].swizzledFormat.format) == false)
+            {
+                // We require that the channel formats match.
+                PAL_ASSERT(Formats::ShareChFmt(srcColorViewInfo.swizzledFormat.format,
+                                               pRegions[idx].swizzledFormat.format));
+                PAL_ASSERT(Formats::ShareChFmt(dstColorViewInfo.swizzledFormat.format,
+                                               pRegions[idx].swizzledFormat.format));
+
+                const SubresId srcSubres = { pRegions[idx].srcAspect, 0, pRegions[idx].srcSlice };
+                const SubresId dstSubres =
+                    { pRegions[idx].dstAspect, pRegions[idx].dstMipLevel, pRegions[idx].dstSlice };
+
+                // If the specified format exactly matches the image formats the resolve will always work. Otherwise,
+                // the images must support format replacement.
+                PAL_ASSERT(Formats::HaveSameNumFmt(srcColorViewInfo.swizzledFormat.format,
+                                                   pRegions[idx].swizzledFormat.format) ||
+                           srcImage.GetGfxImage()->IsFormatReplaceable(srcSubres, srcImageLayout));
+
+                PAL_ASSERT(Formats::HaveSameNumFmt(dstColorViewInfo.swizzledFormat.format,
+                                                   pRegions[idx].swizzledFormat.format) ||
+                           dstImage.GetGfxImage()->IsFormatReplaceable(dstSubres, dstImageLayout));
+
+                srcColorViewInfo.swizzledFormat.format = pRegions[idx].swizzledFormat.format;
+                dstColorViewInfo.swizzledFormat.format = pRegions[idx].swizzledFormat.format;
+            }
 
-        scissorInfo.scissors[0].offset.x      = pRegions[idx].srcOffset.x;
-        scissorInfo.scissors[0].offset.y      = pRegions[idx].srcOffset.y;
-        scissorInfo.scissors[0].extent.width  = pRegions[idx].extent.width;
-        scissorInfo.scissors[0].extent.height = pRegions[idx].extent.height;
-        scissorInfo.scissors[1].offset.x      = pRegions[idx].dstOffset.x;
-        scissorInfo.scissors[1].offset.y      = pRegions[idx].dstOffset.y;
-        scissorInfo.scissors[1].extent.width  = pRegions[idx].extent.width;
-        scissorInfo.scissors[1].extent.height = pRegions[idx].extent.height;
+            // Setup the viewport and scissor to restrict rendering to the destination region being copied.
+            viewportInfo.viewports[0].originX = static_cast<float>(pRegions[idx].srcOffset.x);
+            viewportInfo.viewports[0].originY = static_cast<float>(pRegions[idx].srcOffset.y);
+            viewportInfo.viewports[0].width   = static_cast<float>(pRegions[idx].extent.width);
+            viewportInfo.viewports[0].height  = static_cast<float>(pRegions[idx].extent.height);
+            viewportInfo.viewports[1].originX = static_cast<float>(pRegions[idx].dstOffset.x);
+            viewportInfo.viewports[1].originY = static_cast<float>(pRegions[idx].dstOffset.y);
+            viewportInfo.viewports[1].width   = static_cast<float>(pRegions[idx].extent.width);
+            viewportInfo.viewports[1].height  = static_cast<float>(pRegions[idx].extent.height);
+
+            scissorInfo.scissors[0].offset.x      = pRegions[idx].srcOffset.x;
+            scissorInfo.scissors[0].offset.y      = pRegions[idx].srcOffset.y;
+            scissorInfo.scissors[0].extent.width  = pRegions[idx].extent.width;
+            scissorInfo.scissors[0].extent.height = pRegions[idx].extent.height;
+            scissorInfo.scissors[1].offset.x      = pRegions[idx].dstOffset.x;
+            scissorInfo.scissors[1].offset.y      = pRegions[idx].dstOffset.y;
+            scissorInfo.scissors[1].extent.width  = pRegions[idx].extent.width;
+            scissorInfo.scissors[1].extent.height = pRegions[idx].extent.height;
 
-        pCmdBuffer->CmdSetViewports(viewportInfo);
-        pCmdBuffer->CmdSetScissorRects(scissorInfo);
+            pCmdBuffer->CmdSetViewports(viewportInfo);
+            pCmdBuffer->CmdSetScissorRects(scissorInfo);
 
-        for (uint32 slice = 0; slice < pRegions[idx].numSlices; ++slice)
-        {
-            srcColorViewInfo.imageInfo.baseSubRes.arraySlice = (pRegions[idx].srcSlice + slice);
-            dstColorViewInfo.imageInfo.baseSubRes.arraySlice = (pRegions[idx].dstSlice + slice);
+            for (uint32 slice = 0; slice < pRegions[idx].numSlices; ++slice)
+            {
+                srcColorViewInfo.imageInfo.baseSubRes.arraySlice = (pRegions[idx].srcSlice + slice);
+                dstColorViewInfo.imageInfo.baseSubRes.arraySlice = (pRegions[idx].dstSlice + slice);
 
-            LinearAllocatorAuto<VirtualLinearAllocator> sliceAlloc(pCmdBuffer->Allocator(), false);
+                LinearAllocatorAuto<VirtualLinearAllocator> sliceAlloc(pCmdBuffer->Allocator(), false);
 
-            IColorTargetView* pSrcColorView = nullptr;
-            IColorTargetView* pDstColorView = nullptr;
+                IColorTargetView* pSrcColorView = nullptr;
+                IColorTargetView* pDstColorView = nullptr;
 
-            void* pSrcColorViewMem =
-                PAL_MALLOC(m_pDevice->GetColorTargetViewSize(nullptr), &sliceAlloc, AllocInternalTemp);
-            void* pDstColorViewMem =
-                PAL_MALLOC(m_pDevice->GetColorTargetViewSize(nullptr), &sliceAlloc, AllocInternalTemp);
+                void* pSrcColorViewMem =
+                    PAL_MALLOC(m_pDevice->GetColorTargetViewSize(nullptr), &sliceAlloc, AllocInternalTemp);
+                void* pDstColorViewMem =
+                    PAL_MALLOC(m_pDevice->GetColorTargetViewSize(nullptr), &sliceAlloc, AllocInternalTemp);
 
-            if ((pDstColorViewMem == nullptr) || (pSrcColorViewMem == nullptr))
-            {
-                pCmdBuffer->NotifyAllocFailure();
-            }
-            else
-            {
-                Result result = m_pDevice->CreateColorTargetView(srcColorViewInfo,
-                                                                 colorViewInfoInternal,
-                                                                 pSrcColorViewMem,
-                                                                 &pSrcColorView);
-                PAL_ASSERT(result == Result::Success);
-                if (result == Result::Success)
+                if ((pDstColorViewMem == nullptr) || (pSrcColorViewMem == nullptr))
                 {
-                    result = m_pDevice->CreateColorTargetView(dstColorViewInfo,
-                                                              colorViewInfoInternal,
-                                                              pDstColorViewMem,
-                                                              &pDstColorView);
-                    PAL_ASSERT(result == Result::Success);
+                    pCmdBuffer->NotifyAllocFailure();
                 }
-
-                if (result == Result::Success)
+                else
                 {
-                    bindTargetsInfo.colorTargets[0].pColorTargetView = pSrcColorView;
-                    bindTargetsInfo.colorTargets[1].pColorTargetView = pDstColorView;
-                    bindTargetsInfo.colorTargetCount = 2;
-                    pCmdBuffer->CmdBindTargets(bindTargetsInfo);
+                    Result result = m_pDevice->CreateColorTargetView(srcColorViewInfo,
+                                                                     colorViewInfoInternal,
+                                                                     pSrcColorViewMem,
+                                                                     &pSrcColorView);
+                    PAL_ASSERT(result == Result::Success);
+                    if (result == Result::Success)
+                    {
+                        result = m_pDevice->CreateColorTargetView(dstColorViewInfo,
+                                                                  colorViewInfoInternal,
+                                                                  pDstColorViewMem,
+                                                                  &pDstColorView);
+                        PAL_ASSERT(result == Result::Success);
+                    }
 
-                    // Draw a fullscreen quad.
-                    pCmdBuffer->CmdDraw(0, 3, 0, 1);
+                    if (result == Result::Success)
+                    {
+                        bindTargetsInfo.colorTargets[0].pColorTargetView = pSrcColorView;
+                        bindTargetsInfo.colorTargets[1].pColorTargetView = pDstColorView;
+                        bindTargetsInfo.colorTargetCount = 2;
+                        pCmdBuffer->CmdBindTargets(bindTargetsInfo);
 
-                    // Unbind the color-target view and destroy it.
-                    bindTargetsInfo.colorTargetCount = 0;
-                    pCmdBuffer->CmdBindTargets(bindTargetsInfo);
-                }
+                        // Draw a fullscreen quad.
+                        pCmdBuffer->CmdDraw(0, 3, 0, 1);
 
-            }
+                        // Unbind the color-target view and destroy it.
+                        bindTargetsInfo.colorTargetCount = 0;
+                        pCmdBuffer->CmdBindTargets(bindTargetsInfo);
+                    }
 
-            PAL_SAFE_FREE(pSrcColorViewMem, &sliceAlloc);
-            PAL_SAFE_FREE(pDstColorViewMem, &sliceAlloc);
-        } // End for each slice.
-    } // End for each region.
+                }
 
-    // Restore original command buffer state.
-    pCmdBuffer->PopGraphicsState();
+                PAL_SAFE_FREE(pSrcColorViewMem, &sliceAlloc);
+                PAL_SAFE_FREE(pDstColorViewMem, &sliceAlloc);
+            } // End for each slice.
+        } // End for each region.
+
+        // Restore original command buffer state.
+        pCmdBuffer->PopGraphicsState();
+    }
 }
 
 // =====================================================================================================================
@@ -5465,6 +5762,8 @@ void RsrcProcMgr::ResolveImageDepthStencilCopy(
 
                 dstColorViewInfo.swizzledFormat.format = dstImage.SubresourceInfo(dstSubresId)->format.format;
 
+                const GraphicsPipeline* pPipeline = nullptr;
+
                 if (pRegions[idx].dstAspect == ImageAspect::Depth)
                 {
                     depthViewInfoInternal.flags.isDepthCopy = 1;
@@ -5472,7 +5771,7 @@ void RsrcProcMgr::ResolveImageDepthStencilCopy(
                     dstColorViewInfo.swizzledFormat.swizzle =
                         {ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One};
 
-                    pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Graphics, GetGfxPipeline(ResolveDepthCopy), });
+                    pPipeline = GetGfxPipeline(pCmdBuffer, ResolveDepthCopy);
                 }
                 else if (pRegions[idx].dstAspect == ImageAspect::Stencil)
                 {
@@ -5483,18 +5782,25 @@ void RsrcProcMgr::ResolveImageDepthStencilCopy(
                     dstColorViewInfo.swizzledFormat.swizzle =
                         { ChannelSwizzle::Zero, ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::One };
 
-                    pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Graphics, GetGfxPipeline(ResolveStencilCopy), });
+                    pPipeline = GetGfxPipeline(pCmdBuffer, ResolveStencilCopy);
                 }
                 else
                 {
                     PAL_ASSERT_ALWAYS();
                 }
 
-                Result result = m_pDevice->CreateDepthStencilView(srcDepthViewInfo,
-                    depthViewInfoInternal,
-                    pSrcDepthViewMem,
-                    &pSrcDepthView);
-                PAL_ASSERT(result == Result::Success);
+                Result result = (pPipeline != nullptr) ? Result::Success : Result::ErrorUnavailable;
+
+                if (result == Result::Success)
+                {
+                    pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Graphics, pPipeline, });
+
+                    result = m_pDevice->CreateDepthStencilView(srcDepthViewInfo,
+                        depthViewInfoInternal,
+                        pSrcDepthViewMem,
+                        &pSrcDepthView);
+                    PAL_ASSERT(result == Result::Success);
+                }
 
                 if (result == Result::Success)
                 {
@@ -5534,9 +5840,10 @@ void RsrcProcMgr::ResolveImageDepthStencilCopy(
 // =====================================================================================================================
 // Selects the appropriate Depth Stencil copy pipeline based on usage and samples
 const GraphicsPipeline* RsrcProcMgr::GetCopyDepthStencilMsaaPipeline(
-    bool   isDepth,
-    bool   isDepthStencil,
-    uint32 numSamples
+    GfxCmdBuffer* pCmdBuffer,
+    bool          isDepth,
+    bool          isDepthStencil,
+    uint32        numSamples
     ) const
 {
     const GraphicsPipeline* pGraphicsPipeline = nullptr;
@@ -5545,13 +5852,13 @@ const GraphicsPipeline* RsrcProcMgr::GetCopyDepthStencilMsaaPipeline(
         switch (numSamples)
         {
         case 2:
-            pGraphicsPipeline = GetGfxPipeline(Copy2xMsaaDepthStencil);
+            pGraphicsPipeline = GetGfxPipeline(pCmdBuffer, Copy2xMsaaDepthStencil);
             break;
         case 4:
-            pGraphicsPipeline = GetGfxPipeline(Copy4xMsaaDepthStencil);
+            pGraphicsPipeline = GetGfxPipeline(pCmdBuffer, Copy4xMsaaDepthStencil);
             break;
         case 8:
-            pGraphicsPipeline = GetGfxPipeline(Copy8xMsaaDepthStencil);
+            pGraphicsPipeline = GetGfxPipeline(pCmdBuffer, Copy8xMsaaDepthStencil);
             break;
         default:
             // We only expect to hit this case for MSAA DS surfaces, as regular DS surfaces can be copied directly.
@@ -5567,13 +5874,13 @@ const GraphicsPipeline* RsrcProcMgr::GetCopyDepthStencilMsaaPipeline(
             switch (numSamples)
             {
             case 2:
-                pGraphicsPipeline = GetGfxPipeline(Copy2xMsaaDepth);
+                pGraphicsPipeline = GetGfxPipeline(pCmdBuffer, Copy2xMsaaDepth);
                 break;
             case 4:
-                pGraphicsPipeline = GetGfxPipeline(Copy4xMsaaDepth);
+                pGraphicsPipeline = GetGfxPipeline(pCmdBuffer, Copy4xMsaaDepth);
                 break;
             case 8:
-                pGraphicsPipeline = GetGfxPipeline(Copy8xMsaaDepth);
+                pGraphicsPipeline = GetGfxPipeline(pCmdBuffer, Copy8xMsaaDepth);
                 break;
             default:
                 // We only expect to hit this case for MSAA depth surfaces, as regular depth can be copied directly.
@@ -5586,13 +5893,13 @@ const GraphicsPipeline* RsrcProcMgr::GetCopyDepthStencilMsaaPipeline(
             switch (numSamples)
             {
             case 2:
-                pGraphicsPipeline = GetGfxPipeline(Copy2xMsaaStencil);
+                pGraphicsPipeline = GetGfxPipeline(pCmdBuffer, Copy2xMsaaStencil);
                 break;
             case 4:
-                pGraphicsPipeline = GetGfxPipeline(Copy4xMsaaStencil);
+                pGraphicsPipeline = GetGfxPipeline(pCmdBuffer, Copy4xMsaaStencil);
                 break;
             case 8:
-                pGraphicsPipeline = GetGfxPipeline(Copy8xMsaaStencil);
+                pGraphicsPipeline = GetGfxPipeline(pCmdBuffer, Copy8xMsaaStencil);
                 break;
             default:
                 // We only expect to hit this case for MSAA stencil surfaces, as regular stencil can be copied directly.
@@ -5943,7 +6250,8 @@ void PostComputeDepthStencilClearSync(
 // =====================================================================================================================
 // Returns a pointer to the compute pipeline used to decompress the supplied image.
 const ComputePipeline* RsrcProcMgr::GetComputeMaskRamExpandPipeline(
-    const Image& image
+    GfxCmdBuffer* pCmdBuffer,
+    const Image&  image
     ) const
 {
     const auto&  createInfo   = image.GetImageCreateInfo();
@@ -5954,15 +6262,16 @@ const ComputePipeline* RsrcProcMgr::GetComputeMaskRamExpandPipeline(
                                  (createInfo.samples == 8) ? RpmComputePipeline::ExpandMaskRamMs8x :
                                  RpmComputePipeline::ExpandMaskRam);
 
-    return GetPipeline(pipelineEnum);
+    return GetPipeline(pCmdBuffer, pipelineEnum);
 }
 
 // =====================================================================================================================
 // Returns a pointer to the compute pipeline used for fast-clearing hTile data that is laid out in a linear fashion.
 const ComputePipeline* RsrcProcMgr::GetLinearHtileClearPipeline(
-    bool    expClearEnable,
-    bool    tileStencilDisabled,
-    uint32  hTileMask
+    GfxCmdBuffer* pCmdBuffer,
+    bool          expClearEnable,
+    bool          tileStencilDisabled,
+    uint32        hTileMask
     ) const
 {
     // Determine which pipeline to use for this clear.
@@ -5973,11 +6282,11 @@ const ComputePipeline* RsrcProcMgr::GetLinearHtileClearPipeline(
         // depth/stencil Images and for depth-only Images.
         if (tileStencilDisabled == false)
         {
-            pPipeline = GetPipeline(RpmComputePipeline::FastDepthStExpClear);
+            pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::FastDepthStExpClear);
         }
         else
         {
-            pPipeline = GetPipeline(RpmComputePipeline::FastDepthExpClear);
+            pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::FastDepthExpClear);
         }
     }
     else if (hTileMask == UINT_MAX)
@@ -5989,7 +6298,7 @@ const ComputePipeline* RsrcProcMgr::GetLinearHtileClearPipeline(
     else
     {
         // Otherwise use the depth clear read-write shader.
-        pPipeline = GetPipeline(RpmComputePipeline::FastDepthClear);
+        pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::FastDepthClear);
     }
 
     return pPipeline;
@@ -6311,145 +6620,148 @@ void RsrcProcMgr::CopyImageToPackedPixelImage(
     const BltMonitorDesc* pMonDesc = GetMonitorDesc(packPixelType);
 
     // Get the appropriate pipeline object.
-    const ComputePipeline* pPipeline = GetPipeline(RpmComputePipeline::PackedPixelComposite);
+    const ComputePipeline* pPipeline = GetPipeline(pCmdBuffer, RpmComputePipeline::PackedPixelComposite);
 
-    // Get number of threads per groups in each dimension, we will need this data later.
-    uint32 threadsPerGroup[3] = {};
-    pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
+    if (pPipeline != nullptr)
+    {
+        // Get number of threads per groups in each dimension, we will need this data later.
+        uint32 threadsPerGroup[3] = {};
+        pPipeline->ThreadsPerGroupXyz(&threadsPerGroup[0], &threadsPerGroup[1], &threadsPerGroup[2]);
 
-    // Save current command buffer state and bind the pipeline.
-    pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
-    pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
+        // Save current command buffer state and bind the pipeline.
+        pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
+        pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
 
-    PAL_ASSERT((pRegions->numSlices == 1) || (pRegions->extent.depth == 1));
-
-    SwizzledFormat srcFormat = srcImage.SubresourceInfo(pRegions->srcSubres)->format;
-    SwizzledFormat dstFormat = dstImage.SubresourceInfo(pRegions->dstSubres)->format;
-
-    // ALU constants assignment
-    PackPixelConstant constantData    = {};
-    const uint32      aluConstantSize = sizeof(constantData.aluConstant0);
-
-    // set up c0/c1 sample scaling and offset
-    const BltMonitorDesc&  monDesc = *pMonDesc;
-    const ImageCopyRegion& regions = *pRegions;
-    ProcessPackPixelCopyConstants(monDesc, pMonDesc->numPixels,
-                                  regions,
-                                  reinterpret_cast<float*>(&constantData.aluConstant0[0]));
-    // c2 shader flow control
-    constantData.aluConstant2[0] = pMonDesc->isColorType;
-    constantData.aluConstant2[1] = ((pMonDesc->numPixels > 1) ? 1 : 0);
-    constantData.aluConstant2[2] = ((pMonDesc->numPixels != 2) ? 1 : 0);
-    constantData.aluConstant2[3] = pMonDesc->isSplitType;
-
-    // c3 - c5 color -> color gray matrix
-    memcpy(&constantData.aluConstant3[0], &pMonDesc->grayScalingMap[0], aluConstantSize);
-    memcpy(&constantData.aluConstant4[0], &pMonDesc->grayScalingMap[4], aluConstantSize);
-    memcpy(&constantData.aluConstant5[0], &pMonDesc->grayScalingMap[8], aluConstantSize);
-
-    if (pMonDesc->isColorType == 0)
-    {
-        // c6  - c7 left pixel pack parameters (rmask, gmask, bmask, shift)
-        // c8  - c9 mid pixel pack parameters
-        // c10 - c11 right pixel pack parameters
-        if (pMonDesc->numPixels == 1)
-        {
-            memcpy(&constantData.aluConstant8[0], &pMonDesc->packParams[0], aluConstantSize);
-            memcpy(&constantData.aluConstant9[0], &pMonDesc->packParams[4], aluConstantSize);
-        }
-        else if (pMonDesc->numPixels == 2)
-        {
-            memcpy(&constantData.aluConstant6[0], &pMonDesc->packParams[0], aluConstantSize);
-            memcpy(&constantData.aluConstant7[0], &pMonDesc->packParams[4], aluConstantSize);
+        PAL_ASSERT((pRegions->numSlices == 1) || (pRegions->extent.depth == 1));
+
+        SwizzledFormat srcFormat = srcImage.SubresourceInfo(pRegions->srcSubres)->format;
+        SwizzledFormat dstFormat = dstImage.SubresourceInfo(pRegions->dstSubres)->format;
+
+        // ALU constants assignment
+        PackPixelConstant constantData    = {};
+        const uint32      aluConstantSize = sizeof(constantData.aluConstant0);
+
+        // set up c0/c1 sample scaling and offset
+        const BltMonitorDesc&  monDesc = *pMonDesc;
+        const ImageCopyRegion& regions = *pRegions;
+        ProcessPackPixelCopyConstants(monDesc, pMonDesc->numPixels,
+                                      regions,
+                                      reinterpret_cast<float*>(&constantData.aluConstant0[0]));
+        // c2 shader flow control
+        constantData.aluConstant2[0] = pMonDesc->isColorType;
+        constantData.aluConstant2[1] = ((pMonDesc->numPixels > 1) ? 1 : 0);
+        constantData.aluConstant2[2] = ((pMonDesc->numPixels != 2) ? 1 : 0);
+        constantData.aluConstant2[3] = pMonDesc->isSplitType;
+
+        // c3 - c5 color -> color gray matrix
+        memcpy(&constantData.aluConstant3[0], &pMonDesc->grayScalingMap[0], aluConstantSize);
+        memcpy(&constantData.aluConstant4[0], &pMonDesc->grayScalingMap[4], aluConstantSize);
+        memcpy(&constantData.aluConstant5[0], &pMonDesc->grayScalingMap[8], aluConstantSize);
+
+        if (pMonDesc->isColorType == 0)
+        {
+            // c6  - c7 left pixel pack parameters (rmask, gmask, bmask, shift)
+            // c8  - c9 mid pixel pack parameters
+            // c10 - c11 right pixel pack parameters
+            if (pMonDesc->numPixels == 1)
+            {
+                memcpy(&constantData.aluConstant8[0], &pMonDesc->packParams[0], aluConstantSize);
+                memcpy(&constantData.aluConstant9[0], &pMonDesc->packParams[4], aluConstantSize);
+            }
+            else if (pMonDesc->numPixels == 2)
+            {
+                memcpy(&constantData.aluConstant6[0], &pMonDesc->packParams[0], aluConstantSize);
+                memcpy(&constantData.aluConstant7[0], &pMonDesc->packParams[4], aluConstantSize);
 
-            memcpy(&constantData.aluConstant10[0], &pMonDesc->packParams[8], aluConstantSize);
-            memcpy(&constantData.aluConstant11[0], &pMonDesc->packParams[12], aluConstantSize);
-        }
-        else if (pMonDesc->numPixels == 3)
-        {
-            memcpy(&constantData.aluConstant6[0], &pMonDesc->packParams[0], aluConstantSize);
-            memcpy(&constantData.aluConstant7[0], &pMonDesc->packParams[4], aluConstantSize);
+                memcpy(&constantData.aluConstant10[0], &pMonDesc->packParams[8], aluConstantSize);
+                memcpy(&constantData.aluConstant11[0], &pMonDesc->packParams[12], aluConstantSize);
+            }
+            else if (pMonDesc->numPixels == 3)
+            {
+                memcpy(&constantData.aluConstant6[0], &pMonDesc->packParams[0], aluConstantSize);
+                memcpy(&constantData.aluConstant7[0], &pMonDesc->packParams[4], aluConstantSize);
 
-            memcpy(&constantData.aluConstant8[0], &pMonDesc->packParams[8], aluConstantSize);
-            memcpy(&constantData.aluConstant9[0], &pMonDesc->packParams[12], aluConstantSize);
+                memcpy(&constantData.aluConstant8[0], &pMonDesc->packParams[8], aluConstantSize);
+                memcpy(&constantData.aluConstant9[0], &pMonDesc->packParams[12], aluConstantSize);
 
-            memcpy(&constantData.aluConstant10[0], &pMonDesc->packParams[16], aluConstantSize);
-            memcpy(&constantData.aluConstant11[0], &pMonDesc->packParams[20], aluConstantSize);
-        }
-        else
-        {
-            PAL_ASSERT_ALWAYS();
+                memcpy(&constantData.aluConstant10[0], &pMonDesc->packParams[16], aluConstantSize);
+                memcpy(&constantData.aluConstant11[0], &pMonDesc->packParams[20], aluConstantSize);
+            }
+            else
+            {
+                PAL_ASSERT_ALWAYS();
+            }
         }
-    }
 
-    // c12 pixel scaling (2^N-1, 1/(2^N-1), unused, unused)
-    memcpy(&constantData.aluConstant12[0], &pMonDesc->scalingParams[0], sizeof(pMonDesc->scalingParams[0]) * 4);
+        // c12 pixel scaling (2^N-1, 1/(2^N-1), unused, unused)
+        memcpy(&constantData.aluConstant12[0], &pMonDesc->scalingParams[0], sizeof(pMonDesc->scalingParams[0]) * 4);
 
-    // c13 -> region.width*1.0, region.height*1.0, region.width, region.height
-    constantData.aluConstant13[2] = pRegions->dstOffset.x + pRegions->extent.width;
-    constantData.aluConstant13[3] = pRegions->dstOffset.y + pRegions->extent.height;
+        // c13 -> region.width*1.0, region.height*1.0, region.width, region.height
+        constantData.aluConstant13[2] = pRegions->dstOffset.x + pRegions->extent.width;
+        constantData.aluConstant13[3] = pRegions->dstOffset.y + pRegions->extent.height;
 
-    constexpr uint32 DataDwords = (sizeof(constantData) / sizeof(uint32));
+        constexpr uint32 DataDwords = (sizeof(constantData) / sizeof(uint32));
 
-    // there are 2 resources and 1 sampler
-    const uint8 rsNum = 3;
-    uint32* pUserData = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
-                                                               SrdDwordAlignment() * rsNum + DataDwords,
-                                                               SrdDwordAlignment(),
-                                                               PipelineBindPoint::Compute,
-                                                               0);
-    ImageViewInfo imageView[2] = {};
-    SubresRange   viewRange    = { pRegions->dstSubres, 1, 1};
-    RpmUtil::BuildImageViewInfo(&imageView[0],
-                                dstImage,
-                                viewRange,
-                                dstFormat,
-                                true,
-                                Pal::ImageTexOptLevel::Default);
+        // there are 2 resources and 1 sampler
+        const uint8 rsNum = 3;
+        uint32* pUserData = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
+                                                                   SrdDwordAlignment() * rsNum + DataDwords,
+                                                                   SrdDwordAlignment(),
+                                                                   PipelineBindPoint::Compute,
+                                                                   0);
+        ImageViewInfo imageView[2] = {};
+        SubresRange   viewRange    = { pRegions->dstSubres, 1, 1};
+        RpmUtil::BuildImageViewInfo(&imageView[0],
+                                    dstImage,
+                                    viewRange,
+                                    dstFormat,
+                                    true,
+                                    Pal::ImageTexOptLevel::Default);
+
+        viewRange.startSubres = pRegions->srcSubres;
+        RpmUtil::BuildImageViewInfo(&imageView[1],
+                                    srcImage,
+                                    viewRange,
+                                    srcFormat,
+                                    false,
+                                    Pal::ImageTexOptLevel::Default);
 
-    viewRange.startSubres = pRegions->srcSubres;
-    RpmUtil::BuildImageViewInfo(&imageView[1],
-                                srcImage,
-                                viewRange,
-                                srcFormat,
-                                false,
-                                Pal::ImageTexOptLevel::Default);
+        if (useMipInSrd == false)
+        {
+            // The miplevel as specified in the shader instruction is actually an offset from the mip-level
+            // as specified in the SRD.
+            imageView[0].subresRange.startSubres.mipLevel = 0;  // dst
+            imageView[1].subresRange.startSubres.mipLevel = 0;  // src
 
-    if (useMipInSrd == false)
-    {
-        // The miplevel as specified in the shader instruction is actually an offset from the mip-level
-        // as specified in the SRD.
-        imageView[0].subresRange.startSubres.mipLevel = 0;  // dst
-        imageView[1].subresRange.startSubres.mipLevel = 0;  // src
-
-        // The mip-level from the instruction is also clamped to the "last level" as specified in the SRD.
-        imageView[0].subresRange.numMips = pRegions->dstSubres.mipLevel + viewRange.numMips;
-        imageView[1].subresRange.numMips = pRegions->srcSubres.mipLevel + viewRange.numMips;
-    }
+            // The mip-level from the instruction is also clamped to the "last level" as specified in the SRD.
+            imageView[0].subresRange.numMips = pRegions->dstSubres.mipLevel + viewRange.numMips;
+            imageView[1].subresRange.numMips = pRegions->srcSubres.mipLevel + viewRange.numMips;
+        }
 
-    // Turn our image views into HW SRDs here
-    device.CreateImageViewSrds(2, &imageView[0], pUserData);
-    pUserData += SrdDwordAlignment() * 2;
+        // Turn our image views into HW SRDs here
+        device.CreateImageViewSrds(2, &imageView[0], pUserData);
+        pUserData += SrdDwordAlignment() * 2;
 
-    Pal::SamplerInfo samplerInfo = {};
+        Pal::SamplerInfo samplerInfo = {};
 
-    samplerInfo.filter.magnification = Pal::XyFilterPoint;
-    samplerInfo.filter.minification  = Pal::XyFilterPoint;
-    samplerInfo.filter.mipFilter     = Pal::MipFilterNone;
-    samplerInfo.addressU             = Pal::TexAddressMode::Clamp;
-    samplerInfo.addressV             = Pal::TexAddressMode::Clamp;
-    samplerInfo.addressW             = Pal::TexAddressMode::Clamp;
+        samplerInfo.filter.magnification = Pal::XyFilterPoint;
+        samplerInfo.filter.minification  = Pal::XyFilterPoint;
+        samplerInfo.filter.mipFilter     = Pal::MipFilterNone;
+        samplerInfo.addressU             = Pal::TexAddressMode::Clamp;
+        samplerInfo.addressV             = Pal::TexAddressMode::Clamp;
+        samplerInfo.addressW             = Pal::TexAddressMode::Clamp;
 
-    device.CreateSamplerSrds(1, &samplerInfo, pUserData);
-    pUserData += SrdDwordAlignment();
-    // Copy the copy parameters into the embedded user-data space
-    memcpy(pUserData, &constantData, sizeof(constantData));
+        device.CreateSamplerSrds(1, &samplerInfo, pUserData);
+        pUserData += SrdDwordAlignment();
+        // Copy the copy parameters into the embedded user-data space
+        memcpy(pUserData, &constantData, sizeof(constantData));
 
-    // Execute the dispatch, we need one thread per texel.
-    pCmdBuffer->CmdDispatch(RpmUtil::MinThreadGroups(pRegions->extent.width,  threadsPerGroup[0]),
-                            RpmUtil::MinThreadGroups(pRegions->extent.height, threadsPerGroup[1]),
-                            RpmUtil::MinThreadGroups(1,  threadsPerGroup[2]));
+        // Execute the dispatch, we need one thread per texel.
+        pCmdBuffer->CmdDispatch(RpmUtil::MinThreadGroups(pRegions->extent.width,  threadsPerGroup[0]),
+                                RpmUtil::MinThreadGroups(pRegions->extent.height, threadsPerGroup[1]),
+                                RpmUtil::MinThreadGroups(1,  threadsPerGroup[2]));
 
-    pCmdBuffer->CmdRestoreComputeState(ComputeStatePipelineAndUserData);
+        pCmdBuffer->CmdRestoreComputeState(ComputeStatePipelineAndUserData);
+    }
 }
 } // Pal
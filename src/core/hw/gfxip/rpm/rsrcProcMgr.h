@@ -27,6 +27,9 @@
 #include "core/hw/gfxip/rpm/g_rpmComputePipelineInit.h"
 #include "core/hw/gfxip/rpm/g_rpmGfxPipelineInit.h"
 #include "palCmdBuffer.h"
+#include "palConditionVariable.h"
+#include "palMutex.h"
+#include "palThread.h"
 
 namespace Pal
 {
@@ -51,6 +54,13 @@ union  ScaledCopyInternalFlags;
 static constexpr uint32 MaxLog2AaSamples   = 4; // Max AA sample rate is 16x.
 static constexpr uint32 MaxLog2AaFragments = 3; // Max fragments is 8.
 
+// Internal RPM pipelines are tracked in one index space: the compute pipelines come first, then the graphics pipelines.
+static constexpr uint32 RpmComputePipelineCount = static_cast<uint32>(RpmComputePipeline::Count);
+static constexpr uint32 RpmPipelineCount        = RpmComputePipelineCount + RpmGfxPipelineCount;
+
+// Maximum number of background threads which may pre-create RPM pipelines.
+static constexpr uint32 MaxRpmWarmUpThreads = 8;
+
 // =====================================================================================================================
 // Resource Processing Manager: Contains resource modification and preparation logic. RPM and its subclasses issue
 // draws, dispatches, and other operations to manipulate resource contents and hardware state.
@@ -259,33 +269,57 @@ protected:
     virtual bool CopyImageUseMipLevelInSrd(bool isCompressed) const { return UseMipLevelInSrd; }
 
     const ComputePipeline* GetLinearHtileClearPipeline(
-        bool    expClearEnable,
-        bool    tileStencilDisabled,
-        uint32  hTileMask) const;
+        GfxCmdBuffer* pCmdBuffer,
+        bool          expClearEnable,
+        bool          tileStencilDisabled,
+        uint32        hTileMask) const;
 
     // Some blts need to use GFXIP-specific algorithms to pick the proper state. The baseState is the first
     // graphics state in a series of states that vary only on target format and target index.
     virtual const GraphicsPipeline* GetGfxPipelineByTargetIndexAndFormat(
+        GfxCmdBuffer*  pCmdBuffer,
         RpmGfxPipeline basePipeline,
         uint32         targetIndex,
         SwizzledFormat format) const = 0;
 
     // Generating indirect commands needs to choose different shaders based on the GFXIP version.
     virtual const ComputePipeline* GetCmdGenerationPipeline(
-        const IndirectCmdGenerator& generator,
-        const CmdBuffer&            cmdBuffer) const = 0;
+        GfxCmdBuffer*               pCmdBuffer,
+        const IndirectCmdGenerator& generator) const = 0;
+
+    // Internal pipelines may be created on first use, so these may block while another thread creates the pipeline.
+    // If the pipeline can't be created, the failure is reported to pCmdBuffer (which makes its End() fail) and null is
+    // returned, in which case the caller must skip the operation.
+    const ComputePipeline* GetPipeline(GfxCmdBuffer* pCmdBuffer, RpmComputePipeline pipeline) const
+    {
+        const uint32 index = static_cast<uint32>(pipeline);
+
+        if (m_pipelineState[index] != PipelineReady)
+        {
+            InitPipeline(pCmdBuffer, index);
+        }
+
+        return (m_pipelineState[index] == PipelineReady) ? m_pComputePipelines[index] : nullptr;
+    }
 
-    const ComputePipeline* GetPipeline(RpmComputePipeline pipeline) const
-        { return m_pComputePipelines[static_cast<size_t>(pipeline)]; }
+    const GraphicsPipeline* GetGfxPipeline(GfxCmdBuffer* pCmdBuffer, RpmGfxPipeline pipeline) const
+    {
+        const uint32 index = RpmComputePipelineCount + pipeline;
 
-    const GraphicsPipeline* GetGfxPipeline(RpmGfxPipeline pipeline) const
-        { return m_pGraphicsPipelines[pipeline]; }
+        if (m_pipelineState[index] != PipelineReady)
+        {
+            InitPipeline(pCmdBuffer, index);
+        }
+
+        return (m_pipelineState[index] == PipelineReady) ? m_pGraphicsPipelines[pipeline] : nullptr;
+    }
 
     const MsaaState* GetMsaaState(uint32 samples, uint32 fragments) const;
 
-    const GraphicsPipeline* GetCopyDepthStencilMsaaPipeline(bool isDepth,
-                                                            bool isDepthStencil,
-                                                            uint32 numSamples) const;
+    const GraphicsPipeline* GetCopyDepthStencilMsaaPipeline(GfxCmdBuffer* pCmdBuffer,
+                                                            bool          isDepth,
+                                                            bool          isDepthStencil,
+                                                            uint32        numSamples) const;
 
     void GenericColorBlit(
         GfxCmdBuffer*        pCmdBuffer,
@@ -341,7 +375,8 @@ protected:
         const MemoryCopyRegion* pRegions) const;
 
     const ComputePipeline* GetComputeMaskRamExpandPipeline(
-        const Image& image) const;
+        GfxCmdBuffer* pCmdBuffer,
+        const Image&  image) const;
 
     ColorBlendState*    m_pBlendDisableState;               // Blend state object with all blending disabled.
     DepthStencilState*  m_pDepthDisableState;               // DS state object with all depth disabled.
@@ -552,16 +587,40 @@ private:
         const ColorSpaceConversionTable&  cscTable) const;
 
     const ComputePipeline* GetCsResolvePipeline(
+        GfxCmdBuffer* pCmdBuffer,
         const Image&  srcImage,
         ResolveMode   mode,
         ResolveMethod method) const;
 
+    // Creation states of the internal RPM pipelines.
+    enum PipelineState : uint32
+    {
+        PipelineNotCreated = 0, // Nobody has asked for the pipeline yet or the last attempt to create it failed.
+        PipelineCreating,       // One thread is creating the pipeline; others must wait for it.
+        PipelineReady,          // The pipeline pointer is final. It may be null if the pipeline isn't supported.
+    };
+
+    Result InitPipeline(uint32 index) const;
+    void   InitPipeline(GfxCmdBuffer* pCmdBuffer, uint32 index) const;
+    Result CreatePipeline(uint32 index) const;
+    void   StopWarmUpThreads();
+
+    static void WarmUpThreadCallback(void* pParam);
+
     GfxDevice*const  m_pDevice;
     uint32           m_srdAlignment; // All SRDs must be offset and size aligned to this many DWORDs.
 
-    // All internal RPM pipelines are stored here.
-    ComputePipeline*   m_pComputePipelines[static_cast<size_t>(RpmComputePipeline::Count)];
-    GraphicsPipeline*  m_pGraphicsPipelines[RpmGfxPipelineCount];
+    // All internal RPM pipelines are stored here. Unless RpmLazyPipelineCreation is disabled, each pipeline is created
+    // by the first thread to need it (or by a warm-up thread) so these are written from const methods.
+    mutable ComputePipeline*volatile  m_pComputePipelines[RpmComputePipelineCount];
+    mutable GraphicsPipeline*volatile m_pGraphicsPipelines[RpmGfxPipelineCount];
+    mutable volatile uint32           m_pipelineState[RpmPipelineCount];  // PipelineState of each pipeline.
+
+    mutable Util::Mutex             m_pipelineLock;     // Protects waiting on m_pipelineCreated.
+    mutable Util::ConditionVariable m_pipelineCreated;  // Signaled whenever any pipeline becomes ready.
+
+    Util::Thread     m_warmUpThreads[MaxRpmWarmUpThreads];
+    volatile uint32  m_warmUpNextIndex; // Next pipeline index a warm-up thread should create.
 
     PAL_DISALLOW_DEFAULT_CTOR(RsrcProcMgr);
     PAL_DISALLOW_COPY_AND_ASSIGN(RsrcProcMgr);
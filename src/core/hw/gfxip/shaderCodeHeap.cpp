@@ -0,0 +1,303 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+#include "core/device.h"
+#include "core/internalMemMgr.h"
+#include "core/platform.h"
+#include "core/hw/gfxip/gfxDevice.h"
+#include "core/hw/gfxip/pipelineUploadRing.h"
+#include "core/hw/gfxip/shaderCodeHeap.h"
+#include "palGrowableHashMapImpl.h"
+
+using namespace Util;
+
+namespace Pal
+{
+
+// Number of code blobs the heap can track before its hash map needs to grow for the first time.
+static constexpr uint32 InitialCodeMapCapacity = 256;
+
+// =====================================================================================================================
+ShaderCodeHeap::ShaderCodeHeap(
+    Device* pDevice)
+    :
+    m_pDevice(pDevice),
+    m_codeMap(InitialCodeMapCapacity, pDevice->GetPlatform())
+{
+    memset(&m_stats, 0, sizeof(m_stats));
+}
+
+// =====================================================================================================================
+ShaderCodeHeap::~ShaderCodeHeap()
+{
+    // Every pipeline should have released its code by the time the heap is destroyed.
+    PAL_ALERT(m_codeMap.GetNumEntries() != 0);
+
+#if PAL_ENABLE_PRINTS_ASSERTS
+    if ((m_stats.numUploads + m_stats.numUploadsAvoided) > 0)
+    {
+        PAL_DPINFO("Shader code heap: %llu uploads, %llu uploads avoided, %llu bytes saved",
+                   m_stats.numUploads,
+                   m_stats.numUploadsAvoided,
+                   m_stats.bytesSaved);
+    }
+#endif
+
+    for (auto iter = m_codeMap.Begin(); iter.Get() != nullptr; iter.Next())
+    {
+        FreeEntry(iter.Get()->value);
+    }
+}
+
+// =====================================================================================================================
+Result ShaderCodeHeap::Init()
+{
+    Result result = m_lock.Init();
+
+    if (result == Result::Success)
+    {
+        result = m_uploaded.Init();
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_codeMap.Init();
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Allocates GPU memory for a new code blob and copies the code into it.  If the device has a PipelineUploadRing, the
+// code is placed in invisible memory and copied by the DMA engine instead.
+Result ShaderCodeHeap::Upload(
+    const void* pCode,
+    size_t      codeSize,
+    CodeEntry*  pEntry)
+{
+    constexpr size_t GpuMemByteAlign = 256;
+
+    PipelineUploadRing*const pUploadRing = m_pDevice->GetGfxDevice()->GetPipelineUploadRing();
+
+    BoundGpuMemory gpuMem;
+    uint64         uploadToken = 0;
+    Result         result      = Result::Success;
+
+    if (pUploadRing != nullptr)
+    {
+        result = pUploadRing->AllocateAndUpload(pCode, codeSize, GpuMemByteAlign, &gpuMem, &uploadToken);
+    }
+    else
+    {
+        GpuMemoryCreateInfo createInfo = { };
+        createInfo.size      = codeSize;
+        createInfo.alignment = GpuMemByteAlign;
+        createInfo.vaRange   = VaRange::DescriptorTable;
+        createInfo.heaps[0]  = GpuHeapLocal;
+        createInfo.heaps[1]  = GpuHeapGartUswc;
+        createInfo.heapCount = 2;
+        createInfo.priority  = GpuMemPriority::High;
+
+        GpuMemoryInternalCreateInfo internalInfo = { };
+        internalInfo.flags.alwaysResident = 1;
+
+        GpuMemory* pGpuMemory = nullptr;
+        gpusize    offset     = 0;
+
+        result = m_pDevice->MemMgr()->AllocateGpuMem(createInfo, internalInfo, false, &pGpuMemory, &offset);
+
+        if (result == Result::Success)
+        {
+            gpuMem.Update(pGpuMemory, offset);
+
+            void* pMappedPtr = nullptr;
+            result = gpuMem.Map(&pMappedPtr);
+
+            if (result == Result::Success)
+            {
+                memcpy(pMappedPtr, pCode, codeSize);
+                result = gpuMem.Unmap();
+            }
+
+            if (result != Result::Success)
+            {
+                m_pDevice->MemMgr()->FreeGpuMem(pGpuMemory, offset);
+            }
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        pEntry->pGpuMemory  = gpuMem.Memory();
+        pEntry->offset      = gpuMem.Offset();
+        pEntry->uploadToken = uploadToken;
+        pEntry->refCount    = 0;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Frees the GPU memory holding a code blob.
+void ShaderCodeHeap::FreeEntry(
+    const CodeEntry& entry)
+{
+    if (entry.uploadToken != 0)
+    {
+        BoundGpuMemory gpuMem;
+        gpuMem.Update(entry.pGpuMemory, entry.offset);
+
+        m_pDevice->GetGfxDevice()->GetPipelineUploadRing()->Free(&gpuMem, entry.uploadToken);
+    }
+    else
+    {
+        m_pDevice->MemMgr()->FreeGpuMem(entry.pGpuMemory, entry.offset);
+    }
+}
+
+// =====================================================================================================================
+// Returns GPU memory holding a copy of the given shader code, uploading it only if no identical code is resident yet.
+// Every successful call must be balanced by a call to Release() with the returned key.
+//
+// The upload happens outside of the lock, so pipelines with different code don't wait for each other's uploads. While
+// a code blob is being uploaded its entry is a placeholder with no GPU memory, and any other thread which acquires the
+// same code waits for the upload to finish instead of uploading it again.
+Result ShaderCodeHeap::Acquire(
+    const void*     pCode,
+    size_t          codeSize,
+    ShaderCodeKey*  pKey,     // [out] Identifies the code blob for the matching call to Release().
+    BoundGpuMemory* pGpuMem)  // [out] Bound to the GPU memory holding the code.
+{
+    PAL_ASSERT((pCode != nullptr) && (pKey != nullptr) && (pGpuMem != nullptr));
+
+    // Hash outside of the lock: it's the only part of this function which scales with the size of the code.
+    memset(pKey, 0, sizeof(ShaderCodeKey));
+    MetroHash128::Hash(static_cast<const uint8*>(pCode), codeSize, pKey->hash.bytes);
+    pKey->codeSize = codeSize;
+
+    m_lock.Lock();
+
+    CodeEntry* pEntry   = nullptr;
+    bool       resident = false;
+    Result     result   = Result::Success;
+
+    while ((result == Result::Success) && (resident == false))
+    {
+        bool existed = false;
+        result = m_codeMap.FindAllocate(*pKey, &existed, &pEntry);
+
+        if (result == Result::Success)
+        {
+            if (existed == false)
+            {
+                // Publish a placeholder so that other threads acquiring the same code wait for this upload.
+                memset(pEntry, 0, sizeof(CodeEntry));
+
+                m_lock.Unlock();
+
+                CodeEntry newEntry = { };
+                result = Upload(pCode, codeSize, &newEntry);
+
+                m_lock.Lock();
+
+                // The map may have been resized while the lock was released, so look the placeholder up again.
+                pEntry = m_codeMap.FindKey(*pKey);
+                PAL_ASSERT((pEntry != nullptr) && (pEntry->pGpuMemory == nullptr));
+
+                if (result == Result::Success)
+                {
+                    *pEntry  = newEntry;
+                    resident = true;
+
+                    m_stats.numUniqueBlobs++;
+                    m_stats.residentBytes += codeSize;
+                    m_stats.numUploads++;
+                }
+                else
+                {
+                    m_codeMap.Erase(*pKey);
+                }
+
+                m_uploaded.WakeAll();
+            }
+            else if (pEntry->pGpuMemory == nullptr)
+            {
+                // Another thread is uploading the same code. If its upload fails the entry is erased, in which case
+                // the next iteration starts a new upload.
+                m_uploaded.Wait(&m_lock, UINT32_MAX);
+            }
+            else
+            {
+                resident = true;
+
+                m_stats.numUploadsAvoided++;
+                m_stats.bytesSaved += codeSize;
+            }
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        pEntry->refCount++;
+        pGpuMem->Update(pEntry->pGpuMemory, pEntry->offset);
+    }
+
+    m_lock.Unlock();
+
+    return result;
+}
+
+// =====================================================================================================================
+// Drops one reference to a code blob returned by Acquire().  The GPU memory is freed once the last reference is gone.
+void ShaderCodeHeap::Release(
+    const ShaderCodeKey& key)
+{
+    MutexAuto lock(&m_lock);
+
+    CodeEntry*const pEntry = m_codeMap.FindKey(key);
+    PAL_ASSERT((pEntry != nullptr) && (pEntry->refCount > 0));
+
+    if ((pEntry != nullptr) && (--pEntry->refCount == 0))
+    {
+        FreeEntry(*pEntry);
+
+        m_stats.numUniqueBlobs--;
+        m_stats.residentBytes -= key.codeSize;
+
+        m_codeMap.Erase(key);
+    }
+}
+
+// =====================================================================================================================
+void ShaderCodeHeap::GetStats(
+    ShaderCodeHeapStats* pStats
+    ) const
+{
+    PAL_ASSERT(pStats != nullptr);
+
+    MutexAuto lock(&m_lock);
+    (*pStats) = m_stats;
+}
+
+} // Pal
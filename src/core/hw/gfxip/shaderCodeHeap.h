@@ -0,0 +1,110 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include "core/gpuMemory.h"
+#include "palConditionVariable.h"
+#include "palGrowableHashMap.h"
+#include "palMetroHash.h"
+#include "palMutex.h"
+
+namespace Pal
+{
+
+class Device;
+class Platform;
+
+// Identifies a blob of shader code uploaded to a ShaderCodeHeap.
+struct ShaderCodeKey
+{
+    Util::MetroHash::Hash hash;      // MetroHash128 of the code.
+    gpusize               codeSize;  // Size of the code, in bytes.
+};
+
+// Reports how effective a ShaderCodeHeap is at deduplicating shader code.
+struct ShaderCodeHeapStats
+{
+    uint32  numUniqueBlobs;     // Number of distinct code blobs currently resident in GPU memory.
+    gpusize residentBytes;      // Total size of all resident code blobs, in bytes.
+    uint64  numUploads;         // Number of Acquire() calls which had to upload their code blob.
+    uint64  numUploadsAvoided;  // Number of Acquire() calls which reused an already resident code blob.
+    gpusize bytesSaved;         // Total size of the code which did not have to be uploaded again, in bytes.
+};
+
+// =====================================================================================================================
+// Device-wide, content-addressed heap of pipeline shader code.  Pipelines frequently share byte-identical code (e.g.
+// permutations which only differ in state that isn't compiled into the shaders), so instead of giving every pipeline a
+// private copy, each distinct code blob is uploaded once and reference counted.  Code blobs are identified by their
+// MetroHash128 and size.
+//
+// Only the code section is shared: the data section is relocated against its own GPU address and the performance data
+// buffers are written by the GPU, so both remain private to each pipeline.  Because the code addresses the data section
+// relative to its own address, only pipelines without a data section can use the heap.
+//
+// All methods are thread-safe.
+class ShaderCodeHeap
+{
+public:
+    explicit ShaderCodeHeap(Device* pDevice);
+    ~ShaderCodeHeap();
+
+    Result Init();
+
+    Result Acquire(
+        const void*     pCode,
+        size_t          codeSize,
+        ShaderCodeKey*  pKey,
+        BoundGpuMemory* pGpuMem);
+
+    void Release(const ShaderCodeKey& key);
+
+    void GetStats(ShaderCodeHeapStats* pStats) const;
+
+private:
+    // Tracks a resident code blob.
+    struct CodeEntry
+    {
+        GpuMemory* pGpuMemory;   // GPU memory allocation holding the code, or null while the code is being uploaded.
+        gpusize    offset;       // Offset of the code within pGpuMemory.
+        uint64     uploadToken;  // PipelineUploadRing batch which uploads the code, or zero if uploaded by the CPU.
+        uint32     refCount;     // Number of pipelines which currently reference the code.
+    };
+
+    typedef Util::GrowableHashMap<ShaderCodeKey, CodeEntry, Platform, Util::JenkinsHashFunc> CodeMap;
+
+    Result Upload(const void* pCode, size_t codeSize, CodeEntry* pEntry);
+    void FreeEntry(const CodeEntry& entry);
+
+    Device*const            m_pDevice;
+    mutable Util::Mutex     m_lock;        // Serializes access to m_codeMap and the statistics.
+    Util::ConditionVariable m_uploaded;    // Signaled whenever an upload started by Acquire() finishes or fails.
+    CodeMap                 m_codeMap;     // Maps code keys to their resident copy.
+    ShaderCodeHeapStats     m_stats;
+
+    PAL_DISALLOW_DEFAULT_CTOR(ShaderCodeHeap);
+    PAL_DISALLOW_COPY_AND_ASSIGN(ShaderCodeHeap);
+};
+
+} // Pal
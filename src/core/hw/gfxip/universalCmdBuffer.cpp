@@ -23,6 +23,7 @@
  ******************************************************************************/
 
 #include "core/cmdAllocator.h"
+#include "core/cmdBufDumpWriter.h"
 #include "core/device.h"
 #include "core/hw/gfxip/borderColorPalette.h"
 #include "core/hw/gfxip/gfxDevice.h"
@@ -181,7 +182,8 @@ Result UniversalCmdBuffer::End()
                 DumpFile()->Write(&listHeader, sizeof(listHeader));
             }
 
-            DumpCmdStreamsToFile(DumpFile(), m_device.Parent()->Settings().submitTimeCmdBufDumpMode);
+            CmdBufDumpStream dumpStream(DumpFile());
+            DumpCmdStreamsToFile(&dumpStream, m_device.Parent()->Settings().submitTimeCmdBufDumpMode);
             DumpFile()->Close();
         }
 #endif
@@ -441,12 +443,12 @@ void UniversalCmdBuffer::CmdSetViewInstanceMask(
 // =====================================================================================================================
 // Dumps this command buffer's DE and CE command streams to the given file with an appropriate header.
 void UniversalCmdBuffer::DumpCmdStreamsToFile(
-    File*          pFile,
-    CmdBufDumpMode mode
+    CmdBufDumpStream* pStream,
+    CmdBufDumpMode    mode
     ) const
 {
-    m_pDeCmdStream->DumpCommands(pFile, "# Universal Queue - DE Command length = ", mode);
-    m_pCeCmdStream->DumpCommands(pFile, "# Universal Queue - CE Command length = ", mode);
+    m_pDeCmdStream->DumpCommands(pStream, "# Universal Queue - DE Command length = ", mode);
+    m_pCeCmdStream->DumpCommands(pStream, "# Universal Queue - CE Command length = ", mode);
 }
 #endif
 
@@ -27,9 +27,11 @@
 #include "core/internalMemMgr.h"
 #include "core/platform.h"
 #include "palBuddyAllocatorImpl.h"
+#include "palGrowableHashMapImpl.h"
 #include "palGpuMemoryBindable.h"
 #include "palListImpl.h"
 #include "palSysMemory.h"
+#include "palSysUtil.h"
 #include <stdio.h>
 
 using namespace Util;
@@ -38,43 +40,15 @@ namespace Pal
 {
 
 static constexpr gpusize PoolAllocationSize       = 1ull << 18; // 256 kilobytes
-static constexpr gpusize PoolMinSuballocationSize = 1ull << 4;  // 16 bytes
 
-// =====================================================================================================================
-// Determines whether a base allocation matches the requested parameters
-static PAL_INLINE bool IsMatchingPool(
-    const GpuMemoryPool&    pool,
-    bool                    readOnly,
-    GpuMemoryFlags          memFlags,
-    size_t                  heapCount,
-    const GpuHeap           (&heaps)[GpuHeapCount],
-    VaRange                 vaRange,
-    MType                   mtype)
-{
-    bool matches = true;
+// Largest request and smallest block size of each PoolSizeClass.
+static constexpr gpusize PoolSizeClassMaxSize[PoolSizeClassCount]      =
+    { 1ull << 10, 1ull << 14, PoolAllocationSize / 2 };
+static constexpr gpusize PoolSizeClassMinBlockSize[PoolSizeClassCount] =
+    { 1ull << 4,  1ull << 10, 1ull << 14 };
 
-    if ((pool.memFlags.u32All == memFlags.u32All) &&
-        (pool.heapCount       == heapCount)       &&
-        (pool.readOnly        == readOnly)        &&
-        (pool.vaRange         == vaRange)         &&
-        (pool.mtype           == mtype))
-    {
-        for (uint32 h = 0; h < heapCount; ++h)
-        {
-            if (pool.heaps[h] != heaps[h])
-            {
-                matches = false;
-                break;
-            }
-        }
-    }
-    else
-    {
-        matches = false;
-    }
-
-    return matches;
-}
+static constexpr uint32 InitialBucketMapCapacity = 16;
+static constexpr uint32 InitialPoolMapCapacity   = 64;
 
 // =====================================================================================================================
 // Initializes a set of GPU memory flags based on the values contained in the GPU memory create info and internal
@@ -121,15 +95,49 @@ static PAL_INLINE void FilterInvisibleHeap(
     }
 }
 
+// =====================================================================================================================
+// Picks the size class which serves a suballocation of the given size and alignment.
+static PAL_INLINE PoolSizeClass GetPoolSizeClass(
+    gpusize size,
+    gpusize alignment)
+{
+    const gpusize blockSize = Max(size, alignment);
+
+    uint32 sizeClass = 0;
+    while ((sizeClass < (PoolSizeClassCount - 1)) && (blockSize > PoolSizeClassMaxSize[sizeClass]))
+    {
+        sizeClass++;
+    }
+
+    return static_cast<PoolSizeClass>(sizeClass);
+}
+
 // =====================================================================================================================
 InternalMemMgr::InternalMemMgr(
     Device* pDevice)
     :
     m_pDevice(pDevice),
-    m_poolList(pDevice->GetPlatform()),
+    m_buckets(InitialBucketMapCapacity, pDevice->GetPlatform()),
+    m_pools(InitialPoolMapCapacity, pDevice->GetPlatform()),
+    m_shardKeyValid(false),
+    m_nextShard(0),
     m_references(pDevice->GetPlatform()),
-    m_referenceWatermark(0)
+    m_referenceWatermark(0),
+    m_profileLocks(false),
+    m_allocatorLockContentions(0),
+    m_allocatorLockWaitTime(0)
+{
+}
+
+// =====================================================================================================================
+InternalMemMgr::~InternalMemMgr()
 {
+    FreeAllocations();
+
+    if (m_shardKeyValid)
+    {
+        DeleteThreadLocalKey(m_shardKey);
+    }
 }
 
 // =====================================================================================================================
@@ -144,6 +152,32 @@ Result InternalMemMgr::Init()
         result = m_referenceLock.Init();
     }
 
+    if (result == Result::Success)
+    {
+        result = m_bucketLock.Init();
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_poolMapLock.Init();
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_buckets.Init();
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_pools.Init();
+    }
+
+    if (result == Result::Success)
+    {
+        result = CreateThreadLocalKey(&m_shardKey);
+        m_shardKeyValid = (result == Result::Success);
+    }
+
     return result;
 }
 
@@ -166,22 +200,41 @@ void InternalMemMgr::FreeAllocations()
         m_references.Erase(&it);
     }
 
-    while (m_poolList.NumElements() != 0)
+    // The pools' base allocations were in the references list, so only the pool bookkeeping is left to destroy.
+    for (auto it = m_buckets.Begin(); it.Get() != nullptr; it.Next())
     {
-        auto it = m_poolList.Begin();
+        GpuMemoryPoolBucket*const pBucket = it.Get()->value;
 
-        PAL_ASSERT((it.Get() != nullptr) && (it.Get()->pBuddyAllocator != nullptr));
+        for (uint32 shard = 0; shard < NumPoolShards; ++shard)
+        {
+            for (uint32 sizeClass = 0; sizeClass < PoolSizeClassCount; ++sizeClass)
+            {
+                GpuMemoryPool* pPool = pBucket->pPools[shard][sizeClass];
 
-        // Destroy the sub-allocator
-        PAL_DELETE(it.Get()->pBuddyAllocator, m_pDevice->GetPlatform());
+                while (pPool != nullptr)
+                {
+                    GpuMemoryPool*const pNext = pPool->pNext;
 
-        // Remove the list entry
-        m_poolList.Erase(&it);
+                    PAL_ASSERT(pPool->pBuddyAllocator != nullptr);
+
+                    // Destroy the sub-allocator
+                    PAL_DELETE(pPool->pBuddyAllocator, m_pDevice->GetPlatform());
+                    PAL_DELETE(pPool, m_pDevice->GetPlatform());
+
+                    pPool = pNext;
+                }
+            }
+        }
+
+        PAL_DELETE(pBucket, m_pDevice->GetPlatform());
     }
+
+    m_buckets.Reset();
+    m_pools.Reset();
 }
 
 // =====================================================================================================================
-// Allocates GPU memory for internal use, ensures thread safety by acquiring the allocator lock.
+// Allocates GPU memory for internal use, ensures thread safety by acquiring the allocator lock for base allocations.
 Result InternalMemMgr::AllocateGpuMem(
     const GpuMemoryCreateInfo&          createInfo,
     const GpuMemoryInternalCreateInfo&  internalInfo,
@@ -189,13 +242,50 @@ Result InternalMemMgr::AllocateGpuMem(
     GpuMemory**                         ppGpuMemory,
     gpusize*                            pOffset)
 {
-    Util::MutexAuto allocatorLock(&m_allocatorLock); // Ensure thread-safety using the lock
+    Result result = Result::Success;
+
+    if ((pOffset != nullptr) && (createInfo.size <= PoolAllocationSize / 2))
+    {
+        // Suballocations are protected by the pool shard locks instead of the allocator lock.
+        result = AllocateGpuMemNoAllocLock(createInfo, internalInfo, readOnly, ppGpuMemory, pOffset);
+    }
+    else
+    {
+        AcquireLock(&m_allocatorLock); // Ensure thread-safety using the lock
+
+        result = AllocateGpuMemNoAllocLock(createInfo, internalInfo, readOnly, ppGpuMemory, pOffset);
+
+        m_allocatorLock.Unlock();
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Acquires the allocator lock or a pool shard lock.  When lock profiling is enabled, contended acquisitions are counted
+// and timed so that lock wait time can be reported when profiling pipeline creation and other paths which allocate
+// internal memory from many threads.
+void InternalMemMgr::AcquireLock(
+    Util::Mutex* pLock)
+{
+    if (m_profileLocks == false)
+    {
+        pLock->Lock();
+    }
+    else if (pLock->TryLock() == false)
+    {
+        const int64 startTime = Util::GetPerfCpuTime();
 
-    return AllocateGpuMemNoAllocLock(createInfo, internalInfo, readOnly, ppGpuMemory, pOffset);
+        pLock->Lock();
+
+        Util::AtomicAdd64(&m_allocatorLockWaitTime, static_cast<uint64>(Util::GetPerfCpuTime() - startTime));
+        Util::AtomicAdd64(&m_allocatorLockContentions, 1);
+    }
 }
 
 // =====================================================================================================================
-// Assuming the caller is already holding the allocator lock, this function will not use the lock.
+// Assuming the caller is already holding the allocator lock, this function will not use the lock. Suballocations only
+// take the lock of the pool shard they allocate from.
 //
 // Allocates GPU memory for internal use. Depending on the type of memory object requested, the memory may be
 // sub-allocated from an existing allocation, or it might not.
@@ -226,100 +316,99 @@ Result InternalMemMgr::AllocateGpuMemNoAllocLock(
     // If the requested allocation is small enough, try to find an appropriate pool and sub-allocate from it.
     if ((pOffset != nullptr) && (createInfo.size <= PoolAllocationSize / 2))
     {
-        // Calculate GPU memory flags based on the creation information
-        const GpuMemoryFlags requestedMemFlags = ConvertGpuMemoryFlags(createInfo, internalInfo);
-
-        // Try to find a base allocation of the appropriate type that has sufficient enough space
-        for (auto it = m_poolList.Begin(); it.Get() != nullptr; it.Next())
+        result = Suballocate(createInfo, internalInfo, readOnly, ppGpuMemory, pOffset);
+    }
+    else
+    {
+        if (pOffset != nullptr)
         {
-            GpuMemoryPool* pPool = it.Get();
-
-            if (IsMatchingPool(*pPool,
-                               readOnly,
-                               requestedMemFlags,
-                               createInfo.heapCount,
-                               createInfo.heaps,
-                               createInfo.vaRange,
-                               internalInfo.mtype))
-            {
-                // If the base allocation matches the search criteria then try to allocate from it
-                result = pPool->pBuddyAllocator->Allocate(createInfo.size, createInfo.alignment, pOffset);
+            // Since we're not sub-allocating, the new memory object will always have a zero offset.
+            *pOffset = 0;
 
-                if (result == Result::Success)
-                {
-                    // If we found a free block, fill in the memory object pointer from the base allocation and
-                    // stop searching
-                    *ppGpuMemory = pPool->pGpuMemory;
-                    break;
-                }
-            }
+            // General-purpose calls to AllocateGpuMem shouldn't trigger a base mem allocation. If this alert tiggers
+            // it's a sign that we might need to tune our buddy allocator.
+            PAL_ALERT_ALWAYS();
         }
 
-        if (result != Result::Success)
-        {
-            // None of the existing base allocations had a free block large enough for us so we need to create
-            // a new base allocation
+        // Issue the base memory allocation.
+        result = AllocateBaseGpuMem(createInfo, internalInfo, readOnly, ppGpuMemory);
+    }
 
-            // Fix-up the GPU memory create info structures to suit the base allocation's needs
-            GpuMemoryCreateInfo         localCreateInfo   = createInfo;
-            GpuMemoryInternalCreateInfo localInternalInfo = internalInfo;
+    return result;
+}
 
-            localCreateInfo.size = PoolAllocationSize;
-            localInternalInfo.flags.buddyAllocated = 1;
+// =====================================================================================================================
+// Returns the pool shard which the calling thread has been assigned to, assigning one if this is the thread's first
+// suballocation.
+uint32 InternalMemMgr::GetThreadShard()
+{
+    uint32 shard = 0;
 
-            GpuMemory*  pGpuMemory = nullptr;
+    if (m_shardKeyValid)
+    {
+        const uintptr_t value = reinterpret_cast<uintptr_t>(GetThreadLocalValue(m_shardKey));
 
-            // Issue the base memory allocation
-            result = AllocateBaseGpuMem(localCreateInfo, localInternalInfo, readOnly, &pGpuMemory);
+        if (value != 0)
+        {
+            shard = static_cast<uint32>(value - 1);
+        }
+        else
+        {
+            shard = (AtomicIncrement(&m_nextShard) % NumPoolShards);
 
-            if (result == Result::Success)
-            {
-                // We need to add the newly allocated base allocation to the list
-                GpuMemoryPool newPool = {};
+            // If this fails the thread just gets assigned again next time, which is harmless.
+            SetThreadLocalValue(m_shardKey, reinterpret_cast<void*>(static_cast<uintptr_t>(shard + 1)));
+        }
+    }
 
-                newPool.pGpuMemory = pGpuMemory;
-                newPool.readOnly   = readOnly;
-                newPool.memFlags   = requestedMemFlags;
-                newPool.heapCount  = createInfo.heapCount;
-                newPool.vaRange    = createInfo.vaRange;
-                newPool.mtype      = internalInfo.mtype;
+    return shard;
+}
 
-                for (uint32 h = 0; h < createInfo.heapCount; ++h)
-                {
-                    newPool.heaps[h] = createInfo.heaps[h];
-                }
+// =====================================================================================================================
+// Finds the bucket of pools which match the given key, creating it if this is the first request for such memory.
+Result InternalMemMgr::FindOrCreateBucket(
+    const GpuMemoryPoolKey& key,
+    GpuMemoryPoolBucket**   ppBucket)
+{
+    Result result = Result::Success;
 
-                // Create and initialize the buddy allocator
-                newPool.pBuddyAllocator = PAL_NEW(BuddyAllocator<Platform>, m_pDevice->GetPlatform(), AllocInternal)
-                                          (m_pDevice->GetPlatform(), PoolAllocationSize, PoolMinSuballocationSize);
+    m_bucketLock.LockForRead();
+    GpuMemoryPoolBucket**const ppExisting = m_buckets.FindKey(key);
+    GpuMemoryPoolBucket*       pBucket    = (ppExisting != nullptr) ? *ppExisting : nullptr;
+    m_bucketLock.UnlockForRead();
 
-                if (newPool.pBuddyAllocator != nullptr)
-                {
-                    // Try to initialize the buddy allocator
-                    result = newPool.pBuddyAllocator->Init();
+    if (pBucket == nullptr)
+    {
+        Util::RWLockAuto<RWLock::ReadWrite> bucketLock(&m_bucketLock);
 
-                    gpusize localOffset = 0;
+        // Another thread may have created the bucket while we didn't hold the lock.
+        bool                  existed = false;
+        GpuMemoryPoolBucket** ppValue = nullptr;
 
-                    if (result == Result::Success)
-                    {
-                        // ... and then sub-allocate from it
-                        // NOTE: The sub-allocation should never fail here since we just optained a fresh base
-                        // allocation, the only possible case for failure is a low system memory situation
-                        result = newPool.pBuddyAllocator->Allocate(createInfo.size, createInfo.alignment, &localOffset);
-                    }
+        result = m_buckets.FindAllocate(key, &existed, &ppValue);
 
-                    // If we successfully sub-allocated from the new buddy allocator, then attempt to add the new pool
-                    // to the list
-                    if (result == Result::Success)
+        if (result == Result::Success)
+        {
+            if (existed)
+            {
+                pBucket = *ppValue;
+            }
+            else
+            {
+                pBucket = PAL_NEW(GpuMemoryPoolBucket, m_pDevice->GetPlatform(), AllocInternal);
+
+                if (pBucket != nullptr)
+                {
+                    memset(pBucket->pPools, 0, sizeof(pBucket->pPools));
+
+                    for (uint32 shard = 0; (shard < NumPoolShards) && (result == Result::Success); ++shard)
                     {
-                        result = m_poolList.PushFront(newPool);
+                        result = pBucket->shardLock[shard].Init();
                     }
 
-                    // Finally, if absolutely everything succeeded, return values to caller
-                    if (result == Result::Success)
+                    if (result != Result::Success)
                     {
-                        *ppGpuMemory = pGpuMemory;
-                        *pOffset     = localOffset;
+                        PAL_SAFE_DELETE(pBucket, m_pDevice->GetPlatform());
                     }
                 }
                 else
@@ -327,32 +416,197 @@ Result InternalMemMgr::AllocateGpuMemNoAllocLock(
                     result = Result::ErrorOutOfMemory;
                 }
 
-                // Undo any allocations if something went wrong
-                if (result != Result::Success)
+                if (result == Result::Success)
+                {
+                    *ppValue = pBucket;
+                }
+                else
+                {
+                    m_buckets.Erase(key);
+                }
+            }
+        }
+    }
+
+    *ppBucket = pBucket;
+
+    return result;
+}
+
+// =====================================================================================================================
+// Suballocates GPU memory from a pool matching the request, creating a new pool if every matching pool is full.
+//
+// The calling thread's own shard of the bucket is searched first. The other shards are only searched if their locks
+// can be taken without waiting, so that a new pool is only created when no uncontended pool has room.
+Result InternalMemMgr::Suballocate(
+    const GpuMemoryCreateInfo&          createInfo,
+    const GpuMemoryInternalCreateInfo&  internalInfo,
+    bool                                readOnly,
+    GpuMemory**                         ppGpuMemory,
+    gpusize*                            pOffset)
+{
+    GpuMemoryPoolKey key = {};
+
+    key.memFlags  = ConvertGpuMemoryFlags(createInfo, internalInfo);
+    key.readOnly  = readOnly;
+    key.heapCount = static_cast<uint32>(createInfo.heapCount);
+    key.vaRange   = createInfo.vaRange;
+    key.mtype     = internalInfo.mtype;
+
+    for (uint32 h = 0; h < createInfo.heapCount; ++h)
+    {
+        key.heaps[h] = createInfo.heaps[h];
+    }
+
+    const PoolSizeClass sizeClass    = GetPoolSizeClass(createInfo.size, createInfo.alignment);
+    const uint32        sizeClassIdx = static_cast<uint32>(sizeClass);
+
+    GpuMemoryPoolBucket* pBucket = nullptr;
+    Result               result  = FindOrCreateBucket(key, &pBucket);
+
+    if (result == Result::Success)
+    {
+        const uint32 homeShard = GetThreadShard();
+
+        AcquireLock(&pBucket->shardLock[homeShard]);
+
+        result = Result::ErrorOutOfGpuMemory;
+
+        for (uint32 i = 0; (i < NumPoolShards) && (result != Result::Success); ++i)
+        {
+            const uint32 shard = (homeShard + i) % NumPoolShards;
+
+            if ((i == 0) || pBucket->shardLock[shard].TryLock())
+            {
+                for (GpuMemoryPool* pPool = pBucket->pPools[shard][sizeClassIdx];
+                     pPool != nullptr;
+                     pPool = pPool->pNext)
                 {
-                    // Delete the buddy allocator if it exists.
-                    PAL_DELETE(newPool.pBuddyAllocator, m_pDevice->GetPlatform());
+                    result = pPool->pBuddyAllocator->Allocate(createInfo.size, createInfo.alignment, pOffset);
 
-                    // If there was a failure then release the base allocation
-                    FreeBaseGpuMem(pGpuMemory);
+                    if (result == Result::Success)
+                    {
+                        // If we found a free block, fill in the memory object pointer from the base allocation and
+                        // stop searching
+                        *ppGpuMemory = pPool->pGpuMemory;
+                        break;
+                    }
+                }
+
+                if (i != 0)
+                {
+                    pBucket->shardLock[shard].Unlock();
                 }
             }
         }
+
+        if (result != Result::Success)
+        {
+            // None of the existing base allocations had a free block large enough for us so we need to create
+            // a new base allocation in our own shard.
+            GpuMemoryPool* pPool = nullptr;
+
+            result = CreatePool(createInfo, internalInfo, readOnly, pBucket, homeShard, sizeClass, &pPool);
+
+            if (result == Result::Success)
+            {
+                // NOTE: The sub-allocation should never fail here since we just optained a fresh base allocation.
+                result = pPool->pBuddyAllocator->Allocate(createInfo.size, createInfo.alignment, pOffset);
+                PAL_ASSERT(result == Result::Success);
+
+                *ppGpuMemory = pPool->pGpuMemory;
+            }
+        }
+
+        pBucket->shardLock[homeShard].Unlock();
     }
-    else
+
+    return result;
+}
+
+// =====================================================================================================================
+// Creates a new pool and adds it to the given shard of a bucket. The caller must hold that shard's lock.
+Result InternalMemMgr::CreatePool(
+    const GpuMemoryCreateInfo&          createInfo,
+    const GpuMemoryInternalCreateInfo&  internalInfo,
+    bool                                readOnly,
+    GpuMemoryPoolBucket*                pBucket,
+    uint32                              shard,
+    PoolSizeClass                       sizeClass,
+    GpuMemoryPool**                     ppPool)
+{
+    Platform*const pPlatform = m_pDevice->GetPlatform();
+
+    // Fix-up the GPU memory create info structures to suit the base allocation's needs
+    GpuMemoryCreateInfo         localCreateInfo   = createInfo;
+    GpuMemoryInternalCreateInfo localInternalInfo = internalInfo;
+
+    localCreateInfo.size = PoolAllocationSize;
+    localInternalInfo.flags.buddyAllocated = 1;
+
+    GpuMemory* pGpuMemory = nullptr;
+
+    // Issue the base memory allocation
+    Result result = AllocateBaseGpuMem(localCreateInfo, localInternalInfo, readOnly, &pGpuMemory);
+
+    if (result == Result::Success)
     {
-        if (pOffset != nullptr)
+        GpuMemoryPool*const pPool = PAL_NEW(GpuMemoryPool, pPlatform, AllocInternal);
+
+        if (pPool != nullptr)
         {
-            // Since we're not sub-allocating, the new memory object will always have a zero offset.
-            *pOffset = 0;
+            pPool->pGpuMemory = pGpuMemory;
+            pPool->pBucket    = pBucket;
+            pPool->shard      = shard;
+            pPool->sizeClass  = sizeClass;
 
-            // General-purpose calls to AllocateGpuMem shouldn't trigger a base mem allocation. If this alert tiggers
-            // it's a sign that we might need to tune our buddy allocator.
-            PAL_ALERT_ALWAYS();
+            // Create and initialize the buddy allocator
+            pPool->pBuddyAllocator =
+                PAL_NEW(BuddyAllocator<Platform>, pPlatform, AllocInternal)
+                    (pPlatform, PoolAllocationSize, PoolSizeClassMinBlockSize[static_cast<uint32>(sizeClass)]);
+
+            if (pPool->pBuddyAllocator != nullptr)
+            {
+                result = pPool->pBuddyAllocator->Init();
+            }
+            else
+            {
+                result = Result::ErrorOutOfMemory;
+            }
+
+            // Make the pool findable by FreeGpuMem() before anything can be suballocated from it
+            if (result == Result::Success)
+            {
+                Util::RWLockAuto<RWLock::ReadWrite> poolMapLock(&m_poolMapLock);
+
+                result = m_pools.Insert(pGpuMemory, pPool);
+            }
+
+            if (result == Result::Success)
+            {
+                const uint32 sizeClassIdx = static_cast<uint32>(sizeClass);
+
+                pPool->pNext                         = pBucket->pPools[shard][sizeClassIdx];
+                pBucket->pPools[shard][sizeClassIdx] = pPool;
+
+                *ppPool = pPool;
+            }
+            else
+            {
+                PAL_DELETE(pPool->pBuddyAllocator, pPlatform);
+                PAL_DELETE(pPool, pPlatform);
+            }
+        }
+        else
+        {
+            result = Result::ErrorOutOfMemory;
         }
 
-        // Issue the base memory allocation.
-        result = AllocateBaseGpuMem(createInfo, internalInfo, readOnly, ppGpuMemory);
+        // If there was a failure then release the base allocation
+        if (result != Result::Success)
+        {
+            FreeBaseGpuMem(pGpuMemory);
+        }
     }
 
     return result;
@@ -459,40 +713,45 @@ Result InternalMemMgr::FreeGpuMem(
     GpuMemory*  pGpuMemory,
     gpusize     offset)
 {
-    Util::MutexAuto allocatorLock(&m_allocatorLock); // Ensure thread-safety using the lock
-
     PAL_ASSERT(pGpuMemory != nullptr);
 
     Result result = Result::ErrorInvalidValue;
 
     if (pGpuMemory->WasBuddyAllocated())
     {
-        // Try to find the allocation in the pool list
-        for (auto it = m_poolList.Begin(); it.Get() != nullptr; it.Next())
+        // Pools are never destroyed before FreeAllocations(), so the pool stays valid after dropping the map lock.
+        m_poolMapLock.LockForRead();
+        GpuMemoryPool**const ppPool = m_pools.FindKey(pGpuMemory);
+        GpuMemoryPool*const  pPool  = (ppPool != nullptr) ? *ppPool : nullptr;
+        m_poolMapLock.UnlockForRead();
+
+        if (pPool != nullptr)
         {
-            GpuMemoryPool* pPool = it.Get();
+            Util::Mutex*const pShardLock = &pPool->pBucket->shardLock[pPool->shard];
 
-            PAL_ASSERT((pPool->pGpuMemory != nullptr) && (pPool->pBuddyAllocator != nullptr));
+            AcquireLock(pShardLock);
 
-            if (pPool->pGpuMemory == pGpuMemory)
-            {
-                // If found then use the buddy allocator to release the block
-                pPool->pBuddyAllocator->Free(offset);
+            // Use the buddy allocator to release the block
+            pPool->pBuddyAllocator->Free(offset);
 
-                result = Result::Success;
-                break;
-            }
+            pShardLock->Unlock();
+
+            result = Result::Success;
         }
 
-        // If we didn't find the allocation in the pool list then something went wrong with the allocation scheme
+        // If we didn't find the allocation in the pool map then something went wrong with the allocation scheme
         PAL_ASSERT(result == Result::Success);
     }
     else
     {
         PAL_ASSERT(offset == 0); // We don't expect allocation offsets for anything which wasn't buddy allocated
 
+        AcquireLock(&m_allocatorLock); // Ensure thread-safety using the lock
+
         // Free a base allocation
         result = FreeBaseGpuMem(pGpuMemory);
+
+        m_allocatorLock.Unlock();
     }
 
     return result;
@@ -543,4 +802,43 @@ uint32 InternalMemMgr::GetReferencesCount()
     return static_cast<uint32>(m_references.NumElements());
 }
 
+// =====================================================================================================================
+// Gathers the utilization and fragmentation statistics of the suballocation pools.
+void InternalMemMgr::GetPoolStats(
+    InternalMemPoolStats (&stats)[PoolSizeClassCount])
+{
+    memset(&stats[0], 0, sizeof(stats));
+
+    Util::RWLockAuto<RWLock::ReadOnly> bucketLock(&m_bucketLock);
+
+    for (auto it = m_buckets.Begin(); it.Get() != nullptr; it.Next())
+    {
+        GpuMemoryPoolBucket*const pBucket = it.Get()->value;
+
+        for (uint32 shard = 0; shard < NumPoolShards; ++shard)
+        {
+            Util::MutexAuto shardLock(&pBucket->shardLock[shard]);
+
+            for (uint32 sizeClass = 0; sizeClass < PoolSizeClassCount; ++sizeClass)
+            {
+                InternalMemPoolStats*const pStats = &stats[sizeClass];
+
+                for (const GpuMemoryPool* pPool = pBucket->pPools[shard][sizeClass];
+                     pPool != nullptr;
+                     pPool = pPool->pNext)
+                {
+                    const BuddyAllocator<Platform>& allocator = *pPool->pBuddyAllocator;
+
+                    pStats->numPools++;
+                    pStats->numEmptyPools         += allocator.IsEmpty() ? 1 : 0;
+                    pStats->numSuballocations     += allocator.NumSuballocations();
+                    pStats->poolBytes             += PoolAllocationSize;
+                    pStats->allocatedBytes        += allocator.AllocatedSize();
+                    pStats->largestFreeBlockBytes += allocator.LargestFreeBlockSize();
+                }
+            }
+        }
+    }
+}
+
 } // Pal
@@ -26,7 +26,10 @@
 
 #include "core/gpuMemory.h"
 #include "palBuddyAllocator.h"
+#include "palGrowableHashMap.h"
+#include "palList.h"
 #include "palMutex.h"
+#include "palThread.h"
 
 namespace Pal
 {
@@ -41,19 +44,65 @@ struct GpuMemoryInfo
     bool            readOnly;
 };
 
-// Contains the information describing a GPU memory chunk pool
-struct GpuMemoryPool
+// Identifies the kind of base allocation a GPU memory pool suballocates from. Pools with equal keys are
+// interchangeable. Every member is 32 bits wide so that keys can be hashed and compared bytewise.
+struct GpuMemoryPoolKey
 {
-    GpuMemory*                      pGpuMemory;             // GPU memory object that the allocator suballocates from
-
-    bool                            readOnly;               // Tells whether the allocation is read-only
     GpuMemoryFlags                  memFlags;               // Properties of the GPU memory object
-    size_t                          heapCount;              // Number of heaps in the heap preference array
+    uint32                          readOnly;               // Tells whether the allocation is read-only
+    uint32                          heapCount;              // Number of heaps in the heap preference array
     GpuHeap                         heaps[GpuHeapCount];    // Heap preference array
     VaRange                         vaRange;                // Virtual address range
     MType                           mtype;                  // The mtype of the GPU memory object.
+};
+
+// Suballocations are segregated by size so that long-lived tiny allocations don't pin pools which large requests
+// could otherwise reuse, and so that each pool's buddy allocator only tracks the block sizes it will actually hand out.
+enum class PoolSizeClass : uint32
+{
+    Small = 0,  // Requests of up to 1 KB, in blocks of at least 16 bytes.
+    Medium,     // Requests of up to 16 KB, in blocks of at least 1 KB.
+    Large,      // Requests of up to 128 KB, in blocks of at least 16 KB.
+    Count
+};
+
+constexpr uint32 PoolSizeClassCount = static_cast<uint32>(PoolSizeClass::Count);
+
+// Number of independently locked sets of pools kept for each pool key. Each thread is assigned to one shard.
+constexpr uint32 NumPoolShards = 4;
+
+struct GpuMemoryPoolBucket;
 
+// Contains the information describing a GPU memory chunk pool
+struct GpuMemoryPool
+{
+    GpuMemory*                      pGpuMemory;             // GPU memory object that the allocator suballocates from
     Util::BuddyAllocator<Platform>* pBuddyAllocator;        // Buddy allocator used for the suballocation
+
+    GpuMemoryPoolBucket*            pBucket;                // Bucket which owns this pool
+    uint32                          shard;                  // Shard of the bucket which owns this pool
+    PoolSizeClass                   sizeClass;              // Size class this pool serves
+    GpuMemoryPool*                  pNext;                  // Next pool of the same shard and size class
+};
+
+// Contains all of the pools which share a pool key. Each shard has its own lock so threads which are assigned to
+// different shards never wait on each other unless their own shard is out of space.
+struct GpuMemoryPoolBucket
+{
+    Util::Mutex                     shardLock[NumPoolShards];
+    GpuMemoryPool*                  pPools[NumPoolShards][PoolSizeClassCount];
+};
+
+// Reports how well the suballocation pools of one size class are used.
+struct InternalMemPoolStats
+{
+    uint32  numPools;               // Number of pools (base allocations).
+    uint32  numEmptyPools;          // Number of pools without any suballocations.
+    uint32  numSuballocations;      // Number of live suballocations.
+    gpusize poolBytes;              // Total size of all pools, in bytes.
+    gpusize allocatedBytes;         // Total size of all suballocated blocks, including power-of-two padding.
+    gpusize largestFreeBlockBytes;  // Sum of each pool's largest free block. Fragmentation is one minus the ratio of
+                                    // this to the free size (poolBytes - allocatedBytes).
 };
 
 // =====================================================================================================================
@@ -62,6 +111,11 @@ struct GpuMemoryPool
 // submitted. Additionally, it also handles sub-allocating from large allocations to provide tiny allocations when
 // possible.
 //
+// Suballocations are served from pools (256 KB base allocations), which are grouped into buckets by their pool key and
+// further split by size class. Buckets are found with a hash lookup, and each bucket is divided into shards which are
+// locked independently; a thread allocates from the shard it has been assigned to and only tries other shards (without
+// blocking) before creating a new pool. Only base allocations are serialized by the allocator lock.
+//
 // The AllocateGpuMem function skips the suballocation scheme if the caller passes a null pOffset.  It is expected that
 // this behavior will only be used in special circumstances (e.g., UDMA buffers); generic GPU memory allocations should
 // provide a non-null pOffset to leverage the suballocation scheme.
@@ -74,10 +128,8 @@ public:
     typedef Util::List<GpuMemoryInfo, Platform>         GpuMemoryList;
     typedef Util::ListIterator<GpuMemoryInfo, Platform> GpuMemoryListIterator;
 
-    typedef Util::List<GpuMemoryPool, Platform>         GpuMemoryPoolList;
-
     explicit InternalMemMgr(Device* pDevice);
-    ~InternalMemMgr() { FreeAllocations(); }
+    ~InternalMemMgr();
 
     Result Init();
     void FreeAllocations();
@@ -114,13 +166,49 @@ public:
     // Number of all allocations in the reference list. Note that this function takes the reference list lock.
     uint32 GetReferencesCount();
 
+    // Reports how often AllocateGpuMem() and FreeGpuMem() had to wait for the allocator lock or a pool shard lock and
+    // for how long, in GetPerfCpuTime() ticks.  Nothing is counted until EnableLockProfiling() has been called.
+    void EnableLockProfiling() { m_profileLocks = true; }
+    uint64 GetAllocatorLockContentions() const { return m_allocatorLockContentions; }
+    uint64 GetAllocatorLockWaitTime() const { return m_allocatorLockWaitTime; }
+
+    // Reports the utilization and fragmentation of the suballocation pools, indexed by PoolSizeClass.
+    void GetPoolStats(InternalMemPoolStats (&stats)[PoolSizeClassCount]);
+
 private:
+    typedef Util::GrowableHashMap<GpuMemoryPoolKey, GpuMemoryPoolBucket*, Platform, Util::JenkinsHashFunc> BucketMap;
+    typedef Util::GrowableHashMap<GpuMemory*, GpuMemoryPool*, Platform>                                    PoolMap;
+
+    Result Suballocate(
+        const GpuMemoryCreateInfo&          createInfo,
+        const GpuMemoryInternalCreateInfo&  internalInfo,
+        bool                                readOnly,
+        GpuMemory**                         ppGpuMemory,
+        gpusize*                            pOffset);
+
+    Result FindOrCreateBucket(
+        const GpuMemoryPoolKey& key,
+        GpuMemoryPoolBucket**   ppBucket);
+
+    Result CreatePool(
+        const GpuMemoryCreateInfo&          createInfo,
+        const GpuMemoryInternalCreateInfo&  internalInfo,
+        bool                                readOnly,
+        GpuMemoryPoolBucket*                pBucket,
+        uint32                              shard,
+        PoolSizeClass                       sizeClass,
+        GpuMemoryPool**                     ppPool);
+
+    uint32 GetThreadShard();
+
     Result AllocateBaseGpuMem(
         const GpuMemoryCreateInfo&          createInfo,
         const GpuMemoryInternalCreateInfo&  internalInfo,
         bool                                readOnly,
         GpuMemory**                         ppGpuMemory);
 
+    void AcquireLock(Util::Mutex* pLock);
+
     Result FreeBaseGpuMem(
         GpuMemory*  pGpuMemory);
 
@@ -129,8 +217,20 @@ private:
     // Serialize access to the memory manager to ensure thread-safety
     Util::Mutex         m_allocatorLock;
 
-    // Maintain a list of GPU memory objects that are sub-allocated
-    GpuMemoryPoolList   m_poolList;
+    // Maps pool keys to the buckets of pools which suballocate from matching base allocations
+    BucketMap           m_buckets;
+    Util::RWLock        m_bucketLock;
+
+    // Maps base allocations to the pool which suballocates from them. This has its own lock because new pools are
+    // added to it while holding a shard lock, whereas GetPoolStats() takes shard locks while holding m_bucketLock.
+    PoolMap             m_pools;
+    Util::RWLock        m_poolMapLock;
+
+    // Each thread which suballocates is assigned to a pool shard in round-robin order; the thread-local value is the
+    // shard index plus one so that unassigned threads read back null.
+    Util::ThreadLocalKey m_shardKey;
+    bool                m_shardKeyValid;
+    volatile uint32     m_nextShard;
 
     // Maintain a list of internal GPU memory references
     GpuMemoryList       m_references;
@@ -141,6 +241,10 @@ private:
     // Ever-incrementing watermark to signal changes to the internal memory reference list
     uint32              m_referenceWatermark;
 
+    bool                m_profileLocks;
+    volatile uint64     m_allocatorLockContentions;
+    volatile uint64     m_allocatorLockWaitTime;
+
     PAL_DISALLOW_COPY_AND_ASSIGN(InternalMemMgr);
     PAL_DISALLOW_DEFAULT_CTOR(InternalMemMgr);
 };
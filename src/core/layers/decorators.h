@@ -2760,6 +2760,19 @@ public:
 
     virtual Result Merge(uint32 numSrcCaches, const IShaderCache** ppSrcCaches) override;
 
+    virtual Result FindPipelineBinary(
+        uint64       compilerHash,
+        const void** ppPipelineBinary,
+        size_t*      pPipelineBinarySize) override
+    {
+        return m_pNextLayer->FindPipelineBinary(compilerHash, ppPipelineBinary, pPipelineBinarySize);
+    }
+
+    virtual void GetStats(ShaderCacheStats* pStats) const override
+    {
+        m_pNextLayer->GetStats(pStats);
+    }
+
     IShaderCache* GetNextLayer() const { return m_pNextLayer; }
 
 protected:
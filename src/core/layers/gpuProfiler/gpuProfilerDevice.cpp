@@ -51,6 +51,7 @@ Device::Device(
     m_imageSrdDwords(0),
     m_timestampFreq(0),
     m_logPipeStats(false),
+    m_binaryOutput(false),
     m_sqttFilteringEnabled(false),
     m_sqttCompilerHash(0),
     m_maxDrawsForThreadTrace(0),
@@ -161,6 +162,13 @@ Result Device::CommitSettingsAndInit()
 
         m_profilerGranularity = settings.gpuProfilerGranularity;
 
+        // The log format can be selected with the GpuProfilerOutputFormat driver setting; without it the logs are
+        // written as CSV.
+        uint32 outputFormat = settings.gpuProfilerOutputFormat;
+        m_pNextLayer->ReadSetting("GpuProfilerOutputFormat", SettingScope::Driver, ValueType::Uint, &outputFormat);
+
+        m_binaryOutput = (outputFormat == GpuProfilerOutputFormatBinary);
+
         m_maxDrawsForThreadTrace = settings.gpuProfilerSqttMaxDraws;
         m_curDrawsForThreadTrace = 0;
 
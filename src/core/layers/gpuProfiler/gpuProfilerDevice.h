@@ -69,6 +69,8 @@ public:
     uint32 NumGlobalPerfCounters() const { return m_numGlobalPerfCounters; }
     const GlobalPerfCounter* GlobalPerfCounters() const { return m_pGlobalPerfCounters; }
 
+    bool BinaryOutput() const { return m_binaryOutput; }
+
     uint32 GetSqttMaxDraws() const { return m_maxDrawsForThreadTrace; }
     uint32 GetSqttCurDraws() const { return m_curDrawsForThreadTrace; }
     void AddSqttCurDraws() { Util::AtomicIncrement(&m_curDrawsForThreadTrace); }
@@ -142,6 +144,7 @@ private:
     uint32                 m_imageSrdDwords;
     uint64                 m_timestampFreq;
     bool                   m_logPipeStats;
+    bool                   m_binaryOutput;  // Write the logs in the binary columnar format instead of as CSV.
 
     bool                   m_sqttFilteringEnabled;
     uint64                 m_sqttCompilerHash;
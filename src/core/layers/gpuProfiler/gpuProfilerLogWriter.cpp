@@ -0,0 +1,362 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+#include "core/layers/gpuProfiler/gpuProfilerLogWriter.h"
+#include "core/layers/gpuProfiler/gpuProfilerPlatform.h"
+#include "palVectorImpl.h"
+
+using namespace Util;
+
+namespace Pal
+{
+namespace GpuProfiler
+{
+
+// =====================================================================================================================
+LogWriter::LogWriter(
+    Platform* pPlatform)
+    :
+    m_pPlatform(pPlatform),
+    m_numCounters(0),
+    m_rows(pPlatform),
+    m_numPipelineRows(0),
+    m_numPipelineStatsRows(0),
+    m_numCounterRows(0),
+    m_pCounterValues(nullptr),
+    m_counterCapacity(0),
+    m_pStringHeap(nullptr),
+    m_stringHeapSize(0),
+    m_stringHeapCapacity(0),
+    m_pScratch(nullptr),
+    m_scratchCapacity(0)
+{
+}
+
+// =====================================================================================================================
+LogWriter::~LogWriter()
+{
+    Close();
+
+    PAL_SAFE_FREE(m_pCounterValues, m_pPlatform);
+    PAL_SAFE_FREE(m_pStringHeap, m_pPlatform);
+    PAL_SAFE_FREE(m_pScratch, m_pPlatform);
+}
+
+// =====================================================================================================================
+// Creates a new binary log and writes its header and string table.  Any log which is already open is closed first.
+Result LogWriter::Open(
+    const char*          pFilename,
+    const LogFileHeader& header,
+    const char*          pStringTable)
+{
+    Close();
+
+    Result result = m_file.Open(pFilename, FileAccessWrite | FileAccessBinary);
+
+    if (result == Result::Success)
+    {
+        result = m_file.Write(&header, sizeof(header));
+    }
+
+    if ((result == Result::Success) && (header.stringTableSize > 0))
+    {
+        result = m_file.Write(pStringTable, header.stringTableSize);
+    }
+
+    m_numCounters = header.numCounters;
+
+    return result;
+}
+
+// =====================================================================================================================
+// Writes out any buffered rows and closes the log.
+void LogWriter::Close()
+{
+    if (m_file.IsOpen())
+    {
+        WriteBlock();
+        m_file.Close();
+    }
+}
+
+// =====================================================================================================================
+// Grows a system memory buffer to hold at least requiredSize bytes, preserving its contents.
+Result LogWriter::Reserve(
+    void**  ppBuffer,
+    size_t* pCapacity,
+    size_t  requiredSize)
+{
+    Result result = Result::Success;
+
+    if (requiredSize > *pCapacity)
+    {
+        const size_t newCapacity = Max(requiredSize, *pCapacity * 2);
+        void*const   pNewBuffer  = PAL_MALLOC(newCapacity, m_pPlatform, AllocInternal);
+
+        if (pNewBuffer == nullptr)
+        {
+            result = Result::ErrorOutOfMemory;
+        }
+        else
+        {
+            if (*ppBuffer != nullptr)
+            {
+                memcpy(pNewBuffer, *ppBuffer, *pCapacity);
+                PAL_FREE(*ppBuffer, m_pPlatform);
+            }
+
+            *ppBuffer  = pNewBuffer;
+            *pCapacity = newCapacity;
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Buffers one row for the next block.  The row's counter values and comment are copied, so the caller may reuse them.
+Result LogWriter::AppendRow(
+    const LogRow& row)
+{
+    PAL_ASSERT(m_file.IsOpen());
+
+    Result result = Result::Success;
+
+    if (TestAnyFlagSet(row.flags, LogRowCounters))
+    {
+        const size_t rowSize = sizeof(uint64) * m_numCounters;
+
+        result = Reserve(reinterpret_cast<void**>(&m_pCounterValues),
+                         &m_counterCapacity,
+                         rowSize * (m_numCounterRows + 1));
+
+        if (result == Result::Success)
+        {
+            memcpy(VoidPtrInc(m_pCounterValues, rowSize * m_numCounterRows), row.pCounters, rowSize);
+            m_numCounterRows++;
+        }
+    }
+
+    if ((result == Result::Success) && TestAnyFlagSet(row.flags, LogRowComment))
+    {
+        const size_t commentSize = strlen(row.pComment) + 1;
+
+        result = Reserve(reinterpret_cast<void**>(&m_pStringHeap),
+                         &m_stringHeapCapacity,
+                         m_stringHeapSize + commentSize);
+
+        if (result == Result::Success)
+        {
+            memcpy(m_pStringHeap + m_stringHeapSize, row.pComment, commentSize);
+            m_stringHeapSize += commentSize;
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_rows.PushBack(row);
+    }
+
+    if (result == Result::Success)
+    {
+        m_numPipelineRows      += TestAnyFlagSet(row.flags, LogRowDraw | LogRowDispatch) ? 1 : 0;
+        m_numPipelineStatsRows += TestAnyFlagSet(row.flags, LogRowPipelineStats) ? 1 : 0;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Gathers one field of every row whose flags intersect rowMask (or of every row if rowMask is zero) into a packed array
+// and writes it to the log.
+Result LogWriter::WriteRowColumn(
+    size_t fieldOffset,
+    size_t fieldSize,
+    uint32 rowMask)
+{
+    uint32 numValues = 0;
+    Result result    = Reserve(&m_pScratch, &m_scratchCapacity, fieldSize * m_rows.NumElements());
+
+    for (uint32 i = 0; (result == Result::Success) && (i < m_rows.NumElements()); i++)
+    {
+        const LogRow& row = m_rows.At(i);
+
+        if ((rowMask == 0) || TestAnyFlagSet(row.flags, rowMask))
+        {
+            memcpy(VoidPtrInc(m_pScratch, fieldSize * numValues), VoidPtrInc(&row, fieldOffset), fieldSize);
+            numValues++;
+        }
+    }
+
+    if ((result == Result::Success) && (numValues > 0))
+    {
+        result = m_file.Write(m_pScratch, fieldSize * numValues);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Transposes every buffered row into columns and appends them to the log as one block.
+Result LogWriter::WriteBlock()
+{
+    Result result = Result::Success;
+
+    if (m_file.IsOpen() && (m_rows.IsEmpty() == false))
+    {
+        LogBlockHeader header = {};
+        header.magic                = LogBlockMagic;
+        header.numRows              = m_rows.NumElements();
+        header.numPipelineRows      = m_numPipelineRows;
+        header.numPipelineStatsRows = m_numPipelineStatsRows;
+        header.numCounterRows       = m_numCounterRows;
+        header.stringHeapSize       = static_cast<uint32>(m_stringHeapSize);
+
+        result = m_file.Write(&header, sizeof(header));
+
+        if (result == Result::Success)
+        {
+            result = WriteRowColumn(offsetof(LogRow, flags), sizeof(uint32), 0);
+        }
+
+        if (result == Result::Success)
+        {
+            result = WriteRowColumn(offsetof(LogRow, callId), sizeof(uint32), 0);
+        }
+
+        if (result == Result::Success)
+        {
+            result = WriteRowColumn(offsetof(LogRow, cmdBufIdx), sizeof(uint32), 0);
+        }
+
+        for (uint32 i = 0; (result == Result::Success) && (i < 2); i++)
+        {
+            result = WriteRowColumn(offsetof(LogRow, clocks) + (sizeof(uint64) * i), sizeof(uint64), 0);
+        }
+
+        for (uint32 i = 0; (result == Result::Success) && (i < 2); i++)
+        {
+            result = WriteRowColumn(offsetof(LogRow, counts) + (sizeof(uint32) * i), sizeof(uint32), 0);
+        }
+
+        // Comments were appended to the string heap in row order, so their offsets can be recovered by walking it.
+        if (result == Result::Success)
+        {
+            result = Reserve(&m_pScratch, &m_scratchCapacity, sizeof(uint32) * m_rows.NumElements());
+        }
+
+        if (result == Result::Success)
+        {
+            uint32*const pOffsets     = static_cast<uint32*>(m_pScratch);
+            size_t       commentOffset = 0;
+
+            for (uint32 i = 0; i < m_rows.NumElements(); i++)
+            {
+                if (TestAnyFlagSet(m_rows.At(i).flags, LogRowComment))
+                {
+                    pOffsets[i]    = static_cast<uint32>(commentOffset);
+                    commentOffset += strlen(m_pStringHeap + commentOffset) + 1;
+                }
+                else
+                {
+                    pOffsets[i] = UINT32_MAX;
+                }
+            }
+
+            result = m_file.Write(pOffsets, sizeof(uint32) * m_rows.NumElements());
+        }
+
+        if (result == Result::Success)
+        {
+            result = WriteRowColumn(offsetof(LogRow, traceId), sizeof(uint32), 0);
+        }
+
+        constexpr uint32 PipelineRowMask = LogRowDraw | LogRowDispatch;
+
+        if (result == Result::Success)
+        {
+            result = WriteRowColumn(offsetof(LogRow, pipelineHash), sizeof(uint64), PipelineRowMask);
+        }
+
+        if (result == Result::Success)
+        {
+            result = WriteRowColumn(offsetof(LogRow, compilerHash), sizeof(uint64), PipelineRowMask);
+        }
+
+        for (uint32 i = 0; (result == Result::Success) && (i < LogShaderSlotCount); i++)
+        {
+            const size_t hashOffset = offsetof(LogRow, shaderHashes) + (sizeof(ShaderHash) * i);
+
+            result = WriteRowColumn(hashOffset + offsetof(ShaderHash, upper), sizeof(uint64), PipelineRowMask);
+
+            if (result == Result::Success)
+            {
+                result = WriteRowColumn(hashOffset + offsetof(ShaderHash, lower), sizeof(uint64), PipelineRowMask);
+            }
+        }
+
+        for (uint32 i = 0; (result == Result::Success) && (i < NumPipelineStats); i++)
+        {
+            result = WriteRowColumn(offsetof(LogRow, pipelineStats) + (sizeof(uint64) * i),
+                                    sizeof(uint64),
+                                    LogRowPipelineStats);
+        }
+
+        // The counters were buffered row-major, so they must be transposed here.
+        if ((result == Result::Success) && (m_numCounterRows > 0))
+        {
+            result = Reserve(&m_pScratch, &m_scratchCapacity, sizeof(uint64) * m_numCounterRows);
+        }
+
+        for (uint32 i = 0; (result == Result::Success) && (m_numCounterRows > 0) && (i < m_numCounters); i++)
+        {
+            uint64*const pColumn = static_cast<uint64*>(m_pScratch);
+
+            for (uint32 j = 0; j < m_numCounterRows; j++)
+            {
+                pColumn[j] = m_pCounterValues[(j * m_numCounters) + i];
+            }
+
+            result = m_file.Write(pColumn, sizeof(uint64) * m_numCounterRows);
+        }
+
+        if ((result == Result::Success) && (m_stringHeapSize > 0))
+        {
+            result = m_file.Write(m_pStringHeap, m_stringHeapSize);
+        }
+
+        PAL_ASSERT(result == Result::Success);
+    }
+
+    m_rows.Clear();
+    m_numPipelineRows      = 0;
+    m_numPipelineStatsRows = 0;
+    m_numCounterRows       = 0;
+    m_stringHeapSize       = 0;
+
+    return result;
+}
+
+} // GpuProfiler
+} // Pal
@@ -0,0 +1,195 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include "pal.h"
+#include "palFile.h"
+#include "palShader.h"
+#include "palVector.h"
+
+namespace Pal
+{
+namespace GpuProfiler
+{
+
+class Platform;
+
+// The following structures describe the binary log format written by LogWriter.  A binary log holds exactly the same
+// information as the .csv log the GPU profiler would otherwise write; tools/gpuProfiler/gpuProfilerLogToCsv.py turns
+// one back into the other.
+//
+//    * First comes a LogFileHeader followed by "stringTableSize" bytes of null-terminated strings: "numCounterNames"
+//      perf counter column names, then "numCmdBufCalls" CmdBufCallId names and finally "numQueueCalls" QueueCallId
+//      names.
+//    * Next comes any number of blocks, each holding the rows logged for one retired submission.  A block starts with
+//      a LogBlockHeader and is followed by its columns, each of which is a tightly packed array:
+//          - numRows entries of each of: uint32 flags, uint32 callId, uint32 cmdBufIdx, uint64 beginClock,
+//            uint64 endClock, uint32 counts[0], uint32 counts[1], uint32 commentOffset and uint32 traceId.
+//          - numPipelineRows entries of each of: uint64 pipelineHash, uint64 compilerHash, then the upper and lower
+//            halves of each of the LogShaderSlotCount shader hashes.
+//          - numPipelineStatsRows entries of each of the NumPipelineStats pipeline statistics.
+//          - numCounterRows entries of each of the "numCounters" perf counters.
+//          - stringHeapSize bytes of null-terminated comment strings, indexed by commentOffset.
+//      Rows use up entries of the sparse pipeline, pipeline stats and counter columns in order, according to their
+//      LogRowDraw/LogRowDispatch, LogRowPipelineStats and LogRowCounters flags respectively.
+//
+// Blocks are only ever appended, so a log which was cut short by a crash is readable up to its last complete block.
+
+constexpr uint32 LogFileMagic       = 0x474C5047; // 'GPLG'
+constexpr uint32 LogBlockMagic      = 0x424C5047; // 'GPLB'
+constexpr uint32 LogFileVersion     = 1;
+constexpr uint32 NumPipelineStats   = 11;
+constexpr uint32 LogShaderSlotCount = 5;          // VS or CS, HS, DS, GS and PS.
+
+// Identifies which kind of .csv file a binary log corresponds to.
+enum LogFileType : uint32
+{
+    LogFileCalls  = 0, // Per-frame log of queue and command buffer calls (draw and command buffer granularities).
+    LogFileFrames = 1, // Log of whole frames (frame granularity).
+};
+
+// Flags describing which optional columns are present in every row of a binary log.
+enum LogFileFlags : uint32
+{
+    LogFilePipelineStats = 0x1, // Pipeline stats columns are present.
+    LogFileThreadTrace   = 0x2, // A thread trace ID column is present.
+};
+
+// Flags describing the contents of a single log row.
+enum LogRowFlags : uint32
+{
+    LogRowTypeMask       = 0x00000003, // LogItemType of the row.
+    LogRowNested         = 0x00000004, // Command buffer call made from a nested command buffer.
+    LogRowTimestamps     = 0x00000008, // beginClock and endClock are valid.
+    LogRowHideElapsed    = 0x00000010, // The elapsed time shouldn't be reported even though the clocks are valid.
+    LogRowDraw           = 0x00000020, // Draw call: pipeline hashes and vertex/instance counts are valid.
+    LogRowDispatch       = 0x00000040, // Dispatch call: pipeline hashes and the thread group count are valid.
+    LogRowComment        = 0x00000080, // commentOffset is valid.
+    LogRowPipelineStats  = 0x00000100, // Pipeline stats are valid.
+    LogRowCounters       = 0x00000200, // Perf counter values are valid.
+    LogRowCountersFailed = 0x00000400, // Perf counter values couldn't be read; the columns should be left out.
+    LogRowSqttShift      = 12,         // The row's LogSqttState is stored in these bits.
+    LogRowSqttMask       = 0x0000F000,
+};
+
+// Describes what should be reported in the thread trace column of a row.
+enum LogSqttState : uint32
+{
+    LogSqttNone        = 0, // Nothing at all, not even an empty column.
+    LogSqttBlank       = 1, // An empty column.
+    LogSqttTraceId     = 2, // The traceId.
+    LogSqttNeedsFrame  = 3, // RGP traces require frame granularity.
+    LogSqttOutOfMemory = 4, // The perf experiment ran out of memory.
+    LogSqttUnsupported = 5, // Thread traces aren't supported by the command buffer.
+};
+
+// Structure defining the top of a binary log.
+struct LogFileHeader
+{
+    uint32 magic;           // Must be LogFileMagic.
+    uint32 version;         // Must be LogFileVersion.
+    uint32 size;            // Size of this structure in bytes.
+    uint32 fileType;        // LogFileType of this log.
+    uint64 timestampFreq;   // Frequency of the clock values, in ticks per second.
+    uint32 flags;           // Mask of LogFileFlags.
+    uint32 numCounters;     // Number of perf counter columns.
+    uint32 numCmdBufCalls;  // Number of CmdBufCallId names in the string table.
+    uint32 numQueueCalls;   // Number of QueueCallId names in the string table.
+    uint32 stringTableSize; // Size of the string table which follows this header in bytes.
+    uint32 numCounterNames; // Number of perf counter names in the string table.  Normally equal to numCounters.
+};
+
+// Structure defining the header of each block of rows.
+struct LogBlockHeader
+{
+    uint32 magic;                // Must be LogBlockMagic.
+    uint32 numRows;              // Number of rows in this block.
+    uint32 numPipelineRows;      // Number of rows with LogRowDraw or LogRowDispatch set.
+    uint32 numPipelineStatsRows; // Number of rows with LogRowPipelineStats set.
+    uint32 numCounterRows;       // Number of rows with LogRowCounters set.
+    uint32 stringHeapSize;       // Size of the comment strings at the end of this block in bytes.
+};
+
+// Everything reported about a single log item, resolved from its GPA session and independent of the output format.
+struct LogRow
+{
+    uint32        flags;                               // Mask of LogRowFlags.
+    uint32        callId;                              // QueueCallId, CmdBufCallId or frame number, by row type.
+    uint32        cmdBufIdx;                           // Index of the root command buffer within the frame.
+    uint64        clocks[2];                           // Begin and end clock values.
+    uint32        counts[2];                           // Vertex and instance counts or the thread group count.
+    uint64        pipelineHash;
+    uint64        compilerHash;
+    ShaderHash    shaderHashes[LogShaderSlotCount];
+    uint64        pipelineStats[NumPipelineStats];
+    const uint64* pCounters;                           // Perf counter values, if LogRowCounters is set.
+    const char*   pComment;                            // Comment string, if LogRowComment is set.
+    uint32        traceId;                             // Thread trace ID or frame number of the RGP trace.
+};
+
+// =====================================================================================================================
+// Writes a binary GPU profiler log.  Rows are buffered in memory until WriteBlock() transposes them into columns and
+// appends them to the file as a single block.  Not thread-safe: each log is written by one Queue's output thread.
+class LogWriter
+{
+public:
+    explicit LogWriter(Platform* pPlatform);
+    ~LogWriter();
+
+    Result Open(const char* pFilename, const LogFileHeader& header, const char* pStringTable);
+    void Close();
+    bool IsOpen() const { return m_file.IsOpen(); }
+
+    Result AppendRow(const LogRow& row);
+    Result WriteBlock();
+    Result Flush() const { return m_file.Flush(); }
+
+private:
+    Result Reserve(void** ppBuffer, size_t* pCapacity, size_t requiredSize);
+    Result WriteRowColumn(size_t fieldOffset, size_t fieldSize, uint32 rowMask);
+
+    Platform*const m_pPlatform;
+    Util::File     m_file;
+    uint32         m_numCounters;
+
+    Util::Vector<LogRow, 64, Platform> m_rows;           // Rows of the current block.  Pointers aren't used.
+    uint32                             m_numPipelineRows;
+    uint32                             m_numPipelineStatsRows;
+    uint32                             m_numCounterRows;
+
+    uint64*        m_pCounterValues;   // Row-major perf counter values of the current block.
+    size_t         m_counterCapacity;  // Size of m_pCounterValues in bytes.
+    char*          m_pStringHeap;      // Comment strings of the current block.
+    size_t         m_stringHeapSize;
+    size_t         m_stringHeapCapacity;
+    void*          m_pScratch;         // Staging buffer used to build one column at a time.
+    size_t         m_scratchCapacity;
+
+    PAL_DISALLOW_DEFAULT_CTOR(LogWriter);
+    PAL_DISALLOW_COPY_AND_ASSIGN(LogWriter);
+};
+
+} // GpuProfiler
+} // Pal
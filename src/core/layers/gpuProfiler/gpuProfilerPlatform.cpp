@@ -130,6 +130,7 @@ Result Platform::UpdateSettings()
     m_profilerSettings.gpuProfilerBreakSubmitBatches = false;
     m_profilerSettings.gpuProfilerCacheFlushOnCounterCollection = false;
     m_profilerSettings.gpuProfilerGranularity = GpuProfilerGranularityDraw;
+    m_profilerSettings.gpuProfilerOutputFormat = GpuProfilerOutputFormatCsv;
     m_profilerSettings.gpuProfilerSqThreadTraceTokenMask = 0xFFFF;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION <= 297
     m_profilerSettings.gpuProfilerSqttPipelineHashHi = 0;
@@ -41,6 +41,13 @@ enum GpuProfilerGranularity : uint32
 
 };
 
+enum GpuProfilerOutputFormat : uint32
+{
+    GpuProfilerOutputFormatCsv = 0,
+    GpuProfilerOutputFormatBinary = 1,
+
+};
+
 enum CmdAllocResidencyFlags : uint32
 {
     CmdAllocResWaitOnSubmitCommandData = 0x00000001,
@@ -60,6 +67,7 @@ struct GpuProfilerSettings
     bool                      gpuProfilerBreakSubmitBatches;
     bool                      gpuProfilerCacheFlushOnCounterCollection;
     GpuProfilerGranularity    gpuProfilerGranularity;
+    GpuProfilerOutputFormat   gpuProfilerOutputFormat;
     uint32                    gpuProfilerSqThreadTraceTokenMask;
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION <= 297
     uint32                    gpuProfilerSqttPipelineHashHi;
@@ -71,11 +71,19 @@ Queue::Queue(
     m_numReportedPerfCounters(0),
     m_availableFences(static_cast<Platform*>(pDevice->GetPlatform())),
     m_pendingSubmits(static_cast<Platform*>(pDevice->GetPlatform())),
+    m_outputRing(MaxLogBatchesInFlight, sizeof(LogBatch*), static_cast<Platform*>(pDevice->GetPlatform())),
+    m_retireRing(MaxLogBatchesInFlight, sizeof(LogBatch*), static_cast<Platform*>(pDevice->GetPlatform())),
+    m_ringsValid(false),
+    m_logBatchesInFlight(0),
+    m_availableLogBatches(static_cast<Platform*>(pDevice->GetPlatform())),
+    m_outputThreadActive(false),
     m_profilingModeEnabled(false),
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION < 355
     m_curGartGpuMemOffset(0),
 #endif
     m_logItems(static_cast<Platform*>(pDevice->GetPlatform())),
+    m_binaryOutput(pDevice->BinaryOutput()),
+    m_binaryLog(static_cast<Platform*>(pDevice->GetPlatform())),
     m_curLogFrame(0),
     m_curLogCmdBufIdx(0),
     m_curLogSqttIdx(0)
@@ -104,8 +112,42 @@ Queue::~Queue()
 {
     // Ensure all log items are flushed out before we shut down.
     WaitIdle();
-    ProcessIdleSubmits();
+    FlushLogItems();
+
+    if (m_outputThreadActive)
+    {
+        PAL_ASSERT(m_outputThread.IsNotCurrentThread());
+
+        // Waiting on the ring's semaphore can be interrupted by a signal, so keep trying until the terminate request
+        // is queued.
+        void* pSlot = nullptr;
+        while (m_outputRing.GetBufferForWriting(UINT32_MAX, &pSlot) != Result::Success)
+        {
+        }
+
+        *static_cast<LogBatch**>(pSlot) = nullptr;
+        m_outputRing.ReleaseWriteBuffer();
+
+        m_outputThread.Join();
+    }
+
     m_logFile.Close();
+    m_binaryLog.Close();
+
+    if (m_ringsValid)
+    {
+        m_outputRing.Destroy(nullptr, nullptr);
+        m_retireRing.Destroy(nullptr, nullptr);
+    }
+
+    while (m_availableLogBatches.NumElements() > 0)
+    {
+        LogBatch* pBatch = nullptr;
+        m_availableLogBatches.PopFront(&pBatch);
+
+        PAL_SAFE_FREE(pBatch->pLogItems, m_pDevice->GetPlatform());
+        PAL_SAFE_FREE(pBatch, m_pDevice->GetPlatform());
+    }
 
     PAL_ASSERT(m_busyCmdBufs.NumElements() == 0);
     PAL_ASSERT(m_busyNestedCmdBufs.NumElements() == 0);
@@ -262,6 +304,25 @@ Result Queue::Init()
         }
     }
 
+    if (result == Result::Success)
+    {
+        result = m_outputRing.Init(nullptr, nullptr);
+
+        if (result == Result::Success)
+        {
+            result = m_retireRing.Init(nullptr, nullptr);
+        }
+
+        // Destroying an uninitialized ring only frees its storage, so this is safe even if the first Init() failed.
+        m_ringsValid = true;
+    }
+
+    if (result == Result::Success)
+    {
+        result               = m_outputThread.Begin(&OutputThreadCallback, this);
+        m_outputThreadActive = m_outputThread.IsCreated();
+    }
+
     return result;
 }
 
@@ -1033,17 +1094,97 @@ IFence* Queue::AcquireFence()
 }
 
 // =====================================================================================================================
-// Determine if any pending submits have completed, and perform accounting on busy/idle command buffers and fences.
+// Determine if any pending submits have completed and hand their log items off to the output thread, then perform
+// accounting on busy/idle command buffers and fences for any submits the output thread is done with.  Never blocks.
 void Queue::ProcessIdleSubmits()
 {
-    while ((m_pendingSubmits.NumElements() > 0) &&
+    RetireLogBatches(false);
+
+    while (m_outputThreadActive &&
+           (m_pendingSubmits.NumElements() > 0) &&
+           (m_logBatchesInFlight < MaxLogBatchesInFlight) &&
            (m_pendingSubmits.Front().pFence->GetStatus() == Result::Success))
     {
-        PendingSubmitInfo submitInfo = { };
-        m_pendingSubmits.PopFront(&submitInfo);
+        LogBatch* pBatch = nullptr;
+
+        if (m_availableLogBatches.NumElements() > 0)
+        {
+            m_availableLogBatches.PopFront(&pBatch);
+        }
+        else
+        {
+            pBatch = static_cast<LogBatch*>(PAL_CALLOC(sizeof(LogBatch), m_pDevice->GetPlatform(), AllocInternal));
+        }
+
+        const uint32 logItemCount = m_pendingSubmits.Front().logItemCount;
+
+        if ((pBatch != nullptr) && (pBatch->capacity < logItemCount))
+        {
+            PAL_SAFE_FREE(pBatch->pLogItems, m_pDevice->GetPlatform());
+
+            // Round up to keep a slowly growing workload from reallocating on every submit.
+            const uint32 capacity = Util::Pow2Pad(logItemCount);
+
+            pBatch->pLogItems = static_cast<LogItem*>(PAL_MALLOC(sizeof(LogItem) * capacity,
+                                                                 m_pDevice->GetPlatform(),
+                                                                 AllocInternal));
+            pBatch->capacity  = (pBatch->pLogItems != nullptr) ? capacity : 0;
+        }
+
+        if ((pBatch == nullptr) || (pBatch->capacity < logItemCount))
+        {
+            // Leave the submit pending; we'll try again next time.
+            if (pBatch != nullptr)
+            {
+                m_availableLogBatches.PushBack(pBatch);
+            }
+
+            PAL_ALERT_ALWAYS();
+            break;
+        }
+
+        m_pendingSubmits.PopFront(&pBatch->submitInfo);
 
         // Output items from the log item queue that are now known to be idle.
-        OutputLogItemsToFile(submitInfo.logItemCount);
+        for (uint32 i = 0; i < logItemCount; i++)
+        {
+            m_logItems.PopFront(&pBatch->pLogItems[i]);
+        }
+
+        // The output thread doesn't need the fence so it can be reused right away.
+        m_availableFences.PushBack(pBatch->submitInfo.pFence);
+        pBatch->submitInfo.pFence = nullptr;
+
+        // The number of batches in flight never exceeds the size of either ring, so there is always a free slot and
+        // this doesn't block.  The wait can still fail if it is interrupted by a signal, in which case we try again.
+        void* pSlot = nullptr;
+        while (m_outputRing.GetBufferForWriting(UINT32_MAX, &pSlot) != Result::Success)
+        {
+        }
+
+        *static_cast<LogBatch**>(pSlot) = pBatch;
+        m_outputRing.ReleaseWriteBuffer();
+        m_logBatchesInFlight++;
+    }
+}
+
+// =====================================================================================================================
+// Recycles the resources of every submit whose log items have been written out by the output thread.  If wait is set,
+// this waits for at least one batch to be retired first.
+void Queue::RetireLogBatches(
+    bool wait)
+{
+    const void* pSlot    = nullptr;
+    uint32      waitTime = wait ? UINT32_MAX : 0;
+
+    while ((m_logBatchesInFlight > 0) && (m_retireRing.GetBufferForReading(waitTime, &pSlot) == Result::Success))
+    {
+        LogBatch*const pBatch = *static_cast<LogBatch*const*>(pSlot);
+        m_retireRing.ReleaseReadBuffer();
+        m_logBatchesInFlight--;
+        waitTime = 0;
+
+        const PendingSubmitInfo& submitInfo = pBatch->submitInfo;
 
         for (uint32 i = 0; i < submitInfo.cmdBufCount; i++)
         {
@@ -1100,7 +1241,75 @@ void Queue::ProcessIdleSubmits()
             m_availableGpaSessions.PushBack(pGpaSession);
         }
 
-        m_availableFences.PushBack(submitInfo.pFence);
+        m_availableLogBatches.PushBack(pBatch);
+    }
+}
+
+// =====================================================================================================================
+// Waits until every idle submit's log items have been written out and its resources recycled.  Submits which are still
+// busy on the GPU are left pending.
+void Queue::FlushLogItems()
+{
+    ProcessIdleSubmits();
+
+    while (m_logBatchesInFlight > 0)
+    {
+        RetireLogBatches(true);
+        ProcessIdleSubmits();
+    }
+}
+
+// =====================================================================================================================
+void Queue::OutputThreadCallback(
+    void* pParam)
+{
+    static_cast<Queue*>(pParam)->RunOutputThread();
+}
+
+// =====================================================================================================================
+// The output thread's main loop: writes out batches of log items in submission order until asked to terminate.
+void Queue::RunOutputThread()
+{
+    bool terminate = false;
+
+    while (terminate == false)
+    {
+        const void* pSlot = nullptr;
+
+        if (m_outputRing.GetBufferForReading(0, &pSlot) != Result::Success)
+        {
+            // We've caught up with the application.  Flush any buffered log writes to disk while we wait; this is
+            // helpful for examining log files while an app is running or dealing with app/driver crashes after the
+            // captured frame.
+            m_logFile.Flush();
+            m_binaryLog.Flush();
+
+            // The wait returns early if it is interrupted by a signal, so keep waiting until a batch arrives.
+            while (m_outputRing.GetBufferForReading(UINT32_MAX, &pSlot) != Result::Success)
+            {
+            }
+        }
+
+        LogBatch*const pBatch = *static_cast<LogBatch*const*>(pSlot);
+        m_outputRing.ReleaseReadBuffer();
+
+        if (pBatch == nullptr)
+        {
+            terminate = true;
+        }
+        else
+        {
+            OutputLogItemsToFile(pBatch->pLogItems, pBatch->submitInfo.logItemCount);
+
+            // As in ProcessIdleSubmits(), a slot is always free; only an interrupted wait can fail.
+            void* pRetireSlot = nullptr;
+            while (m_retireRing.GetBufferForWriting(UINT32_MAX, &pRetireSlot) != Result::Success)
+            {
+            }
+
+            *static_cast<LogBatch**>(pRetireSlot) = pBatch;
+            m_retireRing.ReleaseWriteBuffer();
+        }
     }
 }
 
@@ -25,10 +25,13 @@
 #pragma once
 
 #include "core/layers/decorators.h"
+#include "core/layers/gpuProfiler/gpuProfilerLogWriter.h"
 #include "palDeque.h"
 #include "palFile.h"
 #include "palGpaSession.h"
 #include "palLinearAllocator.h"
+#include "palRingBuffer.h"
+#include "palThread.h"
 
 namespace Pal
 {
@@ -240,6 +243,8 @@ private:
 
     IFence* AcquireFence();
     void ProcessIdleSubmits();
+    void RetireLogBatches(bool wait);
+    void FlushLogItems();
 
     Result InternalSubmit(
         const SubmitInfo& submitInfo,
@@ -249,8 +254,14 @@ private:
 
     void LogQueueCall(QueueCallId callId);
 
-    void OutputLogItemsToFile(size_t count);
+    static void OutputThreadCallback(void* pParam);
+    void RunOutputThread();
+
+    void OutputLogItemsToFile(const LogItem* pLogItems, uint32 count);
+    bool LogFileIsOpen() const;
     void OpenLogFile(uint32 frameId);
+    void OpenFrameLogFile();
+    void OpenBinaryLogFile(const char* pFilename, LogFileType fileType);
     void OpenSqttFile(
         uint32 shaderEngineId,
         uint32 computeUnitId,
@@ -258,14 +269,23 @@ private:
         Util::File* pFile,
         const LogItem& logItem);
     void OutputRgpFile(const GpuUtil::GpaSession& gpaSession, uint32 gpaSampleId);
-    void OutputQueueCallToFile(const LogItem& logItem);
-    void OutputCmdBufCallToFile(const LogItem& logItem, const char* pNestedCmdBufPrefix);
-    void OutputFrameToFile(const LogItem& logItem);
 
-    void OutputTimestampsToFile(const LogItem& logItem);
-    void OutputPipelineStatsToFile(const LogItem& logItem);
-    void OutputGlobalPerfCountersToFile(const LogItem& logItem);
-    void OutputSqThreadTraceToFile(const LogItem& logItem);
+    // These read a log item's results into a LogRow.  Any thread trace files are written out along the way.
+    void ReadTimestamps(const LogItem& logItem, LogRow* pRow);
+    void ReadCmdBufCallInfo(const LogItem& logItem, LogRow* pRow);
+    void ReadPipelineStats(const LogItem& logItem, LogRow* pRow);
+    void ReadGlobalPerfCounters(const LogItem& logItem, LogRow* pRow);
+    void ReadSqThreadTrace(const LogItem& logItem, LogRow* pRow);
+
+    void OutputRow(const LogRow& row);
+    void OutputQueueCallToFile(const LogRow& row);
+    void OutputCmdBufCallToFile(const LogRow& row);
+    void OutputFrameToFile(const LogRow& row);
+
+    void OutputTimestampsToFile(const LogRow& row);
+    void OutputPipelineStatsToFile(const LogRow& row);
+    void OutputGlobalPerfCountersToFile(const LogRow& row);
+    void OutputSqThreadTraceToFile(const LogRow& row);
 
     void ProfilingClockMode(bool enable);
 
@@ -339,6 +359,29 @@ private:
     };
     Util::Deque<PendingSubmitInfo, Platform> m_pendingSubmits;
 
+    // Log items are written out by a dedicated output thread so that formatting and file I/O stay off of the
+    // application's submission path.  Once a pending submit is idle, its log items are copied into a LogBatch and
+    // handed to the output thread through m_outputRing.  Written batches come back through m_retireRing, and only then
+    // are the submit's resources recycled: barrier comments and GPA session results must outlive the output.  Both
+    // rings hold LogBatch pointers and only ever have one producer and one consumer; a null batch tells the output
+    // thread to exit.
+    struct LogBatch
+    {
+        PendingSubmitInfo submitInfo;
+        LogItem*          pLogItems;
+        uint32            capacity;   // Number of LogItems pLogItems can hold.
+    };
+
+    static constexpr uint32 MaxLogBatchesInFlight = 64;
+
+    Util::RingBuffer<Platform>         m_outputRing;
+    Util::RingBuffer<Platform>         m_retireRing;
+    bool                               m_ringsValid;
+    uint32                             m_logBatchesInFlight; // Batches handed to the output thread and not retired.
+    Util::Deque<LogBatch*, Platform>   m_availableLogBatches;
+    Util::Thread                       m_outputThread;
+    bool                               m_outputThreadActive;
+
     // Tracks resources that have been acquired and log items that have been added since the last tracked submit.  This
     // structure will be pushed onto the back of m_pendingSubmits on the next tracked submit.
     PendingSubmitInfo                 m_nextSubmitInfo;
@@ -353,7 +396,11 @@ private:
 #endif
 
     Util::Deque<LogItem, Platform>    m_logItems;         // List of outstanding calls waiting to be logged.
+
+    // The following are only touched by the output thread until it has been joined.
+    const bool                        m_binaryOutput;     // Write binary logs rather than .csv files.
     Util::File                        m_logFile;          // File logging is currently outputted to (changes per frame).
+    LogWriter                         m_binaryLog;        // Binary equivalent of m_logFile.
     uint32                            m_curLogFrame;      // Used to determine when a new frame is started and a new log
                                                           // file should be opened.
     uint32                            m_curLogCmdBufIdx;  // Current command buffer index for the frame being logged.
@@ -176,13 +176,37 @@ static_assert((sizeof(QueueCallIdStrings)/sizeof(QueueCallIdStrings[0])) == stat
               "Missing entry in QueueCallIdStrings.");
 
 // =====================================================================================================================
-// Writes .csv entries to file corresponding to the first count items in the m_logItems deque.  The caller guarantees
-// that all of these calls are idle.
-void Queue::OutputLogItemsToFile(
-    size_t count)
+// An RgpStream implementation that writes RGP data directly to a file.
+class FileRgpStream : public GpuUtil::RgpStream
 {
-    PAL_ASSERT(count <= m_logItems.NumElements());
+public:
+    explicit FileRgpStream(
+        File* pFile)
+        :
+        m_pFile(pFile) {}
+    virtual ~FileRgpStream() {}
+
+    virtual Result Write(
+        const void* pData,
+        size_t      sizeInBytes) override
+    {
+        return m_pFile->Write(pData, sizeInBytes);
+    }
+
+private:
+    File*const m_pFile;
 
+    PAL_DISALLOW_COPY_AND_ASSIGN(FileRgpStream);
+    PAL_DISALLOW_DEFAULT_CTOR(FileRgpStream);
+};
+
+// =====================================================================================================================
+// Writes log entries to file corresponding to the specified log items.  The caller guarantees that all of these calls
+// are idle.  This is only called by the output thread.
+void Queue::OutputLogItemsToFile(
+    const LogItem* pLogItems,
+    uint32         count)
+{
     // Log items from a nested command buffer are flattened so that they appear the same as regular command buffer
     // calls.  activeCmdBufs tracks how many "open" command buffers there are - 0 during queue calls, 1 inside a submit,
     // and 2 inside a nested command buffer.  m_curLogCmdBufIdx is used to log which command buffer we are logging out
@@ -192,12 +216,14 @@ void Queue::OutputLogItemsToFile(
 
     for (uint32 i = 0; i < count; i++)
     {
-        LogItem logItem = { };
-        m_logItems.PopFront(&logItem);
+        const LogItem& logItem = pLogItems[i];
 
         // The fence bundled to this submit wave should promise GpaSession ready.
         PAL_ASSERT((logItem.pGpaSession == nullptr) || logItem.pGpaSession->IsReady());
 
+        LogRow row = { };
+        row.flags = logItem.type;
+
         if (logItem.type == CmdBufferCall)
         {
             if (logItem.cmdBufCall.callId == CmdBufCallId::Begin)
@@ -208,20 +234,32 @@ void Queue::OutputLogItemsToFile(
                 m_curLogSqttIdx = 0;
             }
 
-            // Add a "- " before command buffer calls made in a nested command buffer to differentiate them from calls
-            // made in the root command buffer.
-            const char* pNestedCmdBufPrefix = (activeCmdBufs == 2) ? "- " : "";
+            // Command buffer calls made in a nested command buffer are marked to differentiate them from calls made in
+            // the root command buffer.
+            if (activeCmdBufs == 2)
+            {
+                row.flags |= LogRowNested;
+            }
 
             // If we have received a command buffer call without having received a queue call for this frame,
             // we are using the dynamic start/stop of GPU profiling.  Open a new log file in this case.
-            if ((m_logFile.IsOpen() == false) || (m_curLogFrame != logItem.frameId))
+            if ((LogFileIsOpen() == false) || (m_curLogFrame != logItem.frameId))
             {
                 OpenLogFile(logItem.frameId);
                 m_curLogFrame = logItem.frameId;
                 m_curLogCmdBufIdx = 0;
             }
 
-            OutputCmdBufCallToFile(logItem, pNestedCmdBufPrefix);
+            row.callId    = static_cast<uint32>(logItem.cmdBufCall.callId);
+            row.cmdBufIdx = m_curLogCmdBufIdx;
+
+            ReadTimestamps(logItem, &row);
+            ReadCmdBufCallInfo(logItem, &row);
+            ReadPipelineStats(logItem, &row);
+            ReadGlobalPerfCounters(logItem, &row);
+            ReadSqThreadTrace(logItem, &row);
+
+            OutputRow(row);
 
             if (logItem.cmdBufCall.callId == CmdBufCallId::End)
             {
@@ -232,25 +270,48 @@ void Queue::OutputLogItemsToFile(
         else if (logItem.type == QueueCall)
         {
             // If this is the first queue call for a new frame, open a new log file.
-            if ((m_logFile.IsOpen() == false) || (m_curLogFrame != logItem.frameId))
+            if ((LogFileIsOpen() == false) || (m_curLogFrame != logItem.frameId))
             {
                 OpenLogFile(logItem.frameId);
                 m_curLogFrame = logItem.frameId;
                 m_curLogCmdBufIdx = 0;
             }
 
-            OutputQueueCallToFile(logItem);
+            row.callId = static_cast<uint32>(logItem.queueCall.callId);
+
+            OutputRow(row);
         }
         else if (logItem.type == Frame)
         {
             m_curLogFrame = logItem.frameId;
-            OutputFrameToFile(logItem);
+
+            if (LogFileIsOpen() == false)
+            {
+                OpenFrameLogFile();
+            }
+
+            row.callId = logItem.frameId;
+
+            ReadTimestamps(logItem, &row);
+            ReadGlobalPerfCounters(logItem, &row);
+            ReadSqThreadTrace(logItem, &row);
+
+            OutputRow(row);
         }
     }
 
-    // Flush any buffered log writes to disk.  This is helpful for examining log files while an app is running or
-    // dealing with app/driver crashes after the captured frame.
-    m_logFile.Flush();
+    // Each submit's rows make up one block of a binary log.  Flushing to disk is left to the output thread, which does
+    // so whenever it runs out of work.
+    if (m_binaryOutput)
+    {
+        m_binaryLog.WriteBlock();
+    }
+}
+
+// =====================================================================================================================
+bool Queue::LogFileIsOpen() const
+{
+    return m_binaryOutput ? m_binaryLog.IsOpen() : m_logFile.IsOpen();
 }
 
 // =====================================================================================================================
@@ -261,6 +322,7 @@ void Queue::OpenLogFile(
     const auto& settings = m_pDevice->ProfilerSettings();
 
     m_logFile.Close();
+    m_binaryLog.Close();
 
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 303
     const char* pEngineTypeStrings[] =
@@ -281,7 +343,8 @@ void Queue::OpenLogFile(
     static_assert((sizeof(pEngineTypeStrings) / sizeof(pEngineTypeStrings[0])) == EngineTypeCount,
                  "Missing entry in pEngineTypeStrings.");
 
-    // Build a file name for this frame's log file.  It will have the pattern frameAAAAAADevBEngCD-EE.csv, where:
+    // Build a file name for this frame's log file.  It will have the pattern frameAAAAAADevBEngCD-EE.csv (or .gplog for
+    // binary logs), where:
     //     - AAAAAA: Frame number.
     //     - B:      Device index (mostly relevant when profiling MGPU systems).
     //     - C:      Engine type (U = universal, C = compute, D = DMA, and T = timer).
@@ -290,60 +353,230 @@ void Queue::OpenLogFile(
     char tempString[512];
     Snprintf(&tempString[0],
              sizeof(tempString),
-             "%s/%s/frame%06uDev%uEng%s%u-%02u.csv",
+             "%s/%s/frame%06uDev%uEng%s%u-%02u.%s",
              settings.gpuProfilerLogDirectory,
              static_cast<const Platform*>(m_pDevice->GetPlatform())->LogDirName(),
              frameId,
              m_pDevice->Id(),
              pEngineTypeStrings[static_cast<uint32>(m_engineType)],
              m_engineIndex,
-             m_queueId);
+             m_queueId,
+             m_binaryOutput ? "gplog" : "csv");
 
-    Result result = m_logFile.Open(&tempString[0], FileAccessWrite);
-    PAL_ASSERT(result == Result::Success);
+    if (m_binaryOutput)
+    {
+        OpenBinaryLogFile(&tempString[0], LogFileCalls);
+    }
+    else
+    {
+        Result result = m_logFile.Open(&tempString[0], FileAccessWrite);
+        PAL_ASSERT(result == Result::Success);
+
+        // Write the CSV column headers to the newly opened file.
+        const char* pCsvHeader = "Queue Call, CmdBuffer Index, CmdBuffer Call, Start Clock, End Clock, Time (us) "
+                                 "[Frequency: %llu], PipelineHash, CompilerHash, VS/CS, HS, DS, GS, PS, "
+                                 "Verts/ThreadGroups, Instances, Comments, ";
+        Snprintf(&tempString[0], sizeof(tempString), pCsvHeader, m_pDevice->TimestampFreq());
+        m_logFile.Write(&tempString[0], strlen(&tempString[0]));
+
+        // Add some additional column headers based on enabled profiling features.
+        if (settings.gpuProfilerRecordPipelineStats)
+        {
+            const char* pCsvPipelineStatsHeader = "IaVertices, IaPrimitives, VsInvocations, GsInvocations, "
+                                                  "GsPrimitives, CInvocations, CPrimitives, PsInvocations, "
+                                                  "HsInvocations, DsInvocations, CsInvocations, ";
+            m_logFile.Write(pCsvPipelineStatsHeader, strlen(pCsvPipelineStatsHeader));
+        }
+
+        const uint32 numGlobalPerfCounters = m_pDevice->NumGlobalPerfCounters();
+        if (numGlobalPerfCounters > 0)
+        {
+            for (uint32 i = 0; i < numGlobalPerfCounters; i++)
+            {
+                const auto& counter = m_pDevice->GlobalPerfCounters()[i];
+                if (settings.gpuProfilerGlobalPerfCounterPerInstance)
+                {
+                    for (uint32 j = 0; j < counter.instanceCount; j++)
+                    {
+                        m_logFile.Printf("%s_INSTANCE%d, ", &counter.name[0], j);
+                    }
+                }
+                else
+                {
+                    m_logFile.Printf("%s, ", &counter.name[0]);
+                }
+            }
+        }
 
-    // Write the CSV column headers to the newly opened file.
-    const char* pCsvHeader = "Queue Call, CmdBuffer Index, CmdBuffer Call, Start Clock, End Clock, Time (us) "
-                             "[Frequency: %llu], PipelineHash, CompilerHash, VS/CS, HS, DS, GS, PS, "
-                             "Verts/ThreadGroups, Instances, Comments, ";
-    Snprintf(&tempString[0], sizeof(tempString), pCsvHeader, m_pDevice->TimestampFreq());
-    m_logFile.Write(&tempString[0], strlen(&tempString[0]));
+        if (m_pDevice->GetProfilerMode() > GpuProfilerSqttOff)
+        {
+            m_logFile.Printf("ThreadTraceId, ");
+        }
 
-    // Add some additional column headers based on enabled profiling features.
-    if (settings.gpuProfilerRecordPipelineStats)
+        m_logFile.Printf("\n");
+    }
+}
+
+// =====================================================================================================================
+// Opens and initializes the log file used for frame-granularity profiling.
+void Queue::OpenFrameLogFile()
+{
+    const auto& settings = m_pDevice->ProfilerSettings();
+
+    // Build a file name for this frame's log file.
+    char tempString[512];
+    Snprintf(&tempString[0],
+             sizeof(tempString),
+             "%s/%s/frameLog.%s",
+             settings.gpuProfilerLogDirectory,
+             static_cast<const Platform*>(m_pDevice->GetPlatform())->LogDirName(),
+             m_binaryOutput ? "gplog" : "csv");
+
+    if (m_binaryOutput)
     {
-        const char* pCsvPipelineStatsHeader = "IaVertices, IaPrimitives, VsInvocations, GsInvocations, "
-                                              "GsPrimitives, CInvocations, CPrimitives, PsInvocations, "
-                                              "HsInvocations, DsInvocations, CsInvocations, ";
-        m_logFile.Write(pCsvPipelineStatsHeader, strlen(pCsvPipelineStatsHeader));
+        OpenBinaryLogFile(&tempString[0], LogFileFrames);
     }
+    else
+    {
+        Result result = m_logFile.Open(&tempString[0], FileAccessWrite);
+        PAL_ASSERT(result == Result::Success);
 
-    const uint32 numGlobalPerfCounters = m_pDevice->NumGlobalPerfCounters();
-    if (numGlobalPerfCounters > 0)
+        // Write the CSV column headers to the newly opened file.
+        const char* pCsvHeader = "Frame #, Start Clock, End Clock, Time (us) [Frequency: %llu], ";
+        Snprintf(&tempString[0], sizeof(tempString), pCsvHeader, m_pDevice->TimestampFreq());
+        m_logFile.Write(&tempString[0], strlen(&tempString[0]));
+        const uint32 numGlobalPerfCounters = m_pDevice->NumGlobalPerfCounters();
+        if (numGlobalPerfCounters > 0)
+        {
+            for (uint32 i = 0; i < numGlobalPerfCounters; i++)
+            {
+                const auto& counter = m_pDevice->GlobalPerfCounters()[i];
+                if (settings.gpuProfilerGlobalPerfCounterPerInstance)
+                {
+                    for (uint32 j = 0; j < counter.instanceCount; j++)
+                    {
+                        m_logFile.Printf("%s_INSTANCE%d, ", &counter.name[0], j);
+                    }
+                }
+                else
+                {
+                    m_logFile.Printf("%s, ", &counter.name[0]);
+                }
+            }
+        }
+
+        if (m_pDevice->GetProfilerMode() > GpuProfilerSqttOff)
+        {
+            m_logFile.Printf("ThreadTraceId, ");
+        }
+
+        m_logFile.Printf("\n");
+    }
+}
+
+// =====================================================================================================================
+// Opens a binary log.  Its header records everything needed to reproduce the .csv column headers and call names.
+void Queue::OpenBinaryLogFile(
+    const char* pFilename,
+    LogFileType fileType)
+{
+    const auto&              settings              = m_pDevice->ProfilerSettings();
+    const GlobalPerfCounter* pGlobalPerfCounters   = m_pDevice->GlobalPerfCounters();
+    const uint32             numGlobalPerfCounters = m_pDevice->NumGlobalPerfCounters();
+    constexpr uint32         NumCmdBufCalls        = static_cast<uint32>(CmdBufCallId::Count);
+    constexpr uint32         NumQueueCalls         = static_cast<uint32>(QueueCallId::Count);
+
+    // Counter names grow by at most "_INSTANCE" and a number, so this is enough room for the string table.
+    constexpr size_t MaxCounterNameSize = MaxNameLength + 20;
+
+    size_t maxStringTableSize = 0;
+    for (uint32 i = 0; i < numGlobalPerfCounters; i++)
     {
+        const uint32 numColumns = settings.gpuProfilerGlobalPerfCounterPerInstance ?
+                                  pGlobalPerfCounters[i].instanceCount : 1;
+        maxStringTableSize += MaxCounterNameSize * numColumns;
+    }
+
+    for (uint32 i = 0; i < NumCmdBufCalls; i++)
+    {
+        maxStringTableSize += strlen(CmdBufCallIdStrings[i]) + 1;
+    }
+
+    for (uint32 i = 0; i < NumQueueCalls; i++)
+    {
+        maxStringTableSize += strlen(QueueCallIdStrings[i]) + 1;
+    }
+
+    char* pStringTable = static_cast<char*>(PAL_MALLOC(maxStringTableSize, m_pDevice->GetPlatform(), AllocInternal));
+
+    if (pStringTable != nullptr)
+    {
+        LogFileHeader header = { };
+        header.magic          = LogFileMagic;
+        header.version        = LogFileVersion;
+        header.size           = sizeof(LogFileHeader);
+        header.fileType       = fileType;
+        header.timestampFreq  = m_pDevice->TimestampFreq();
+        header.numCounters    = m_numReportedPerfCounters;
+        header.numCmdBufCalls = NumCmdBufCalls;
+        header.numQueueCalls  = NumQueueCalls;
+
+        if (settings.gpuProfilerRecordPipelineStats)
+        {
+            header.flags |= LogFilePipelineStats;
+        }
+
+        if (m_pDevice->GetProfilerMode() > GpuProfilerSqttOff)
+        {
+            header.flags |= LogFileThreadTrace;
+        }
+
+        size_t stringTableSize = 0;
         for (uint32 i = 0; i < numGlobalPerfCounters; i++)
         {
-            const auto& counter = m_pDevice->GlobalPerfCounters()[i];
+            const auto& counter = pGlobalPerfCounters[i];
             if (settings.gpuProfilerGlobalPerfCounterPerInstance)
             {
                 for (uint32 j = 0; j < counter.instanceCount; j++)
                 {
-                    m_logFile.Printf("%s_INSTANCE%d, ", &counter.name[0], j);
+                    Snprintf(pStringTable + stringTableSize,
+                             MaxCounterNameSize,
+                             "%s_INSTANCE%d",
+                             &counter.name[0],
+                             j);
+                    stringTableSize += strlen(pStringTable + stringTableSize) + 1;
+                    header.numCounterNames++;
                 }
             }
             else
             {
-                m_logFile.Printf("%s, ", &counter.name[0]);
+                Snprintf(pStringTable + stringTableSize, MaxCounterNameSize, "%s", &counter.name[0]);
+                stringTableSize += strlen(pStringTable + stringTableSize) + 1;
+                header.numCounterNames++;
             }
         }
-    }
 
-    if (m_pDevice->GetProfilerMode() > GpuProfilerSqttOff)
-    {
-        m_logFile.Printf("ThreadTraceId, ");
-    }
+        for (uint32 i = 0; i < NumCmdBufCalls; i++)
+        {
+            const size_t size = strlen(CmdBufCallIdStrings[i]) + 1;
+            memcpy(pStringTable + stringTableSize, CmdBufCallIdStrings[i], size);
+            stringTableSize += size;
+        }
 
-    m_logFile.Printf("\n");
+        for (uint32 i = 0; i < NumQueueCalls; i++)
+        {
+            const size_t size = strlen(QueueCallIdStrings[i]) + 1;
+            memcpy(pStringTable + stringTableSize, QueueCallIdStrings[i], size);
+            stringTableSize += size;
+        }
+
+        header.stringTableSize = static_cast<uint32>(stringTableSize);
+
+        const Result result = m_binaryLog.Open(pFilename, header, pStringTable);
+        PAL_ASSERT(result == Result::Success);
+
+        PAL_SAFE_FREE(pStringTable, m_pDevice->GetPlatform());
+    }
 }
 
 // =====================================================================================================================
@@ -442,69 +675,55 @@ void Queue::OutputRgpFile(
     File file;
     Result result = file.Open(&logFilePath[0], FileAccessBinary | FileAccessWrite);
 
-    void*  pResult  = nullptr;
-    size_t dataSize = 0;
-    if (result == Result::Success)
-    {
-        result = gpaSession.GetResults(sampleId, &dataSize, pResult);
-        PAL_ASSERT(dataSize != 0);
-    }
-
-    if (result == Result::Success)
-    {
-        pResult = static_cast<void*>(PAL_MALLOC(dataSize, m_pDevice->GetPlatform(), AllocInternal));
-        if (pResult == nullptr)
-        {
-            result = Result::ErrorOutOfMemory;
-        }
-    }
-
+    // Stream the trace straight into the file so the whole RGP file never has to be held in memory.
     if (result == Result::Success)
     {
-        result = gpaSession.GetResults(sampleId, &dataSize, pResult);
-    }
-
-    if (result == Result::Success)
-    {
-        file.Write(pResult, dataSize);
+        FileRgpStream stream(&file);
+        result = gpaSession.WriteRgpResults(sampleId, &stream);
+        PAL_ASSERT(result == Result::Success);
     }
 
-    PAL_SAFE_FREE(pResult, m_pDevice->GetPlatform());
-
     file.Close();
 }
 
 // =====================================================================================================================
-// Outputs details of a single queue call to the log file.
-void Queue::OutputQueueCallToFile(
-    const LogItem& logItem)
+// Reads the start/end clock values of a log item.  Shared code by all profile granularities.
+void Queue::ReadTimestamps(
+    const LogItem& logItem,
+    LogRow*        pRow)
 {
-    PAL_ASSERT(logItem.type == QueueCall);
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION < 355
+    if (HasValidGpaSample(&logItem, true))
+#else
+    if (HasValidGpaSample(&logItem, GpuUtil::GpaSampleType::Timing))
+#endif
+    {
+        Result result = logItem.pGpaSession->GetResults(logItem.gpaSampleIdTs,
+                                                        nullptr,
+                                                        &pRow->clocks[0]);
 
-    m_logFile.Printf("%s, , , , , , , , , , , , , , , , ",
-                     QueueCallIdStrings[static_cast<uint32>(logItem.queueCall.callId)]);
+        pRow->flags |= LogRowTimestamps;
 
-    if (m_pDevice->ProfilerSettings().gpuProfilerRecordPipelineStats)
-    {
-        m_logFile.Printf(", , , , , , , , , , , ");
-    }
+        // The elapsed time is only meaningful if pre-call/post-call timestamps were inserted.
+        const auto& settings        = m_pDevice->ProfilerSettings();
+        const bool  hideElapsedTime = (settings.gpuProfilerGranularity == GpuProfilerGranularityDraw) &&
+                                      (logItem.type == LogItemType::CmdBufferCall) &&
+                                      (logItem.cmdBufCall.callId == CmdBufCallId::Begin);
 
-    for (uint32 i = 0; i < m_numReportedPerfCounters; i++)
-    {
-        m_logFile.Printf(", ");
+        if (hideElapsedTime)
+        {
+            pRow->flags |= LogRowHideElapsed;
+        }
     }
-
-    m_logFile.Printf("\n");
 }
 
-//======================================================================================================================
-// Outputs details of a single command buffer call to the log file.
-void Queue::OutputCmdBufCallToFile(
+// =====================================================================================================================
+// Reads any draw/dispatch specific info (shader hashes, etc.) or comment of a command buffer call.
+void Queue::ReadCmdBufCallInfo(
     const LogItem& logItem,
-    const char*    pNestedCmdBufPrefix)
+    LogRow*        pRow)
 {
     PAL_ASSERT(logItem.type == CmdBufferCall);
-    PAL_ASSERT(m_logFile.IsOpen());
 
     constexpr uint32 CsIdx = static_cast<uint32>(ShaderType::Compute);
     constexpr uint32 VsIdx = static_cast<uint32>(ShaderType::Vertex);
@@ -515,171 +734,44 @@ void Queue::OutputCmdBufCallToFile(
 
     const auto& cmdBufItem = logItem.cmdBufCall;
 
-    m_logFile.Printf(", %d, %s%s, ",
-                     m_curLogCmdBufIdx,
-                     pNestedCmdBufPrefix,
-                     CmdBufCallIdStrings[static_cast<uint32>(cmdBufItem.callId)]);
-
-    OutputTimestampsToFile(logItem);
-
-    // Print any draw/dispatch specific info (shader hashes, etc.).
     if (cmdBufItem.flags.draw)
     {
-        m_logFile.Printf("0x%016llx, 0x%016llx, 0x%016llx%016llx, 0x%016llx%016llx, 0x%016llx%016llx,"
-                         " 0x%016llx%016llx, 0x%016llx%016llx, %u, %u, , ",
-                         cmdBufItem.draw.pipelineInfo.pipelineHash,
-                         cmdBufItem.draw.pipelineInfo.compilerHash,
-                         cmdBufItem.draw.pipelineInfo.shader[VsIdx].hash.upper,
-                         cmdBufItem.draw.pipelineInfo.shader[VsIdx].hash.lower,
-                         cmdBufItem.draw.pipelineInfo.shader[HsIdx].hash.upper,
-                         cmdBufItem.draw.pipelineInfo.shader[HsIdx].hash.lower,
-                         cmdBufItem.draw.pipelineInfo.shader[DsIdx].hash.upper,
-                         cmdBufItem.draw.pipelineInfo.shader[DsIdx].hash.lower,
-                         cmdBufItem.draw.pipelineInfo.shader[GsIdx].hash.upper,
-                         cmdBufItem.draw.pipelineInfo.shader[GsIdx].hash.lower,
-                         cmdBufItem.draw.pipelineInfo.shader[PsIdx].hash.upper,
-                         cmdBufItem.draw.pipelineInfo.shader[PsIdx].hash.lower,
-                         cmdBufItem.draw.vertexCount,
-                         cmdBufItem.draw.instanceCount);
+        pRow->flags          |= LogRowDraw;
+        pRow->pipelineHash    = cmdBufItem.draw.pipelineInfo.pipelineHash;
+        pRow->compilerHash    = cmdBufItem.draw.pipelineInfo.compilerHash;
+        pRow->shaderHashes[0] = cmdBufItem.draw.pipelineInfo.shader[VsIdx].hash;
+        pRow->shaderHashes[1] = cmdBufItem.draw.pipelineInfo.shader[HsIdx].hash;
+        pRow->shaderHashes[2] = cmdBufItem.draw.pipelineInfo.shader[DsIdx].hash;
+        pRow->shaderHashes[3] = cmdBufItem.draw.pipelineInfo.shader[GsIdx].hash;
+        pRow->shaderHashes[4] = cmdBufItem.draw.pipelineInfo.shader[PsIdx].hash;
+        pRow->counts[0]       = cmdBufItem.draw.vertexCount;
+        pRow->counts[1]       = cmdBufItem.draw.instanceCount;
     }
     else if (cmdBufItem.flags.dispatch)
     {
-        m_logFile.Printf("0x%016llx, 0x%016llx, 0x%016llx%016llx, , , , , %u, , , ",
-                         cmdBufItem.dispatch.pipelineInfo.pipelineHash,
-                         cmdBufItem.dispatch.pipelineInfo.compilerHash,
-                         cmdBufItem.draw.pipelineInfo.shader[CsIdx].hash.upper,
-                         cmdBufItem.draw.pipelineInfo.shader[CsIdx].hash.lower,
-                         cmdBufItem.dispatch.threadGroupCount);
+        pRow->flags          |= LogRowDispatch;
+        pRow->pipelineHash    = cmdBufItem.dispatch.pipelineInfo.pipelineHash;
+        pRow->compilerHash    = cmdBufItem.dispatch.pipelineInfo.compilerHash;
+        pRow->shaderHashes[0] = cmdBufItem.dispatch.pipelineInfo.shader[CsIdx].hash;
+        pRow->counts[0]       = cmdBufItem.dispatch.threadGroupCount;
     }
     else if (cmdBufItem.flags.barrier)
     {
-        m_logFile.Printf(", , , , , , , , ,\"%s\", ",
-                         (cmdBufItem.barrier.pComment != nullptr) ? cmdBufItem.barrier.pComment : "");
+        pRow->flags   |= LogRowComment;
+        pRow->pComment = (cmdBufItem.barrier.pComment != nullptr) ? cmdBufItem.barrier.pComment : "";
     }
     else if (cmdBufItem.flags.comment)
     {
-        m_logFile.Printf(", , , , , , , , ,\"%s\", ", cmdBufItem.comment.string);
-    }
-    else
-    {
-        m_logFile.Printf(", , , , , , , , , , ");
-    }
-
-    OutputPipelineStatsToFile(logItem);
-    OutputGlobalPerfCountersToFile(logItem);
-    OutputSqThreadTraceToFile(logItem);
-
-    m_logFile.Printf("\n");
-}
-
-//======================================================================================================================
-// Outputs details of a frame to the log file (used only for frame-granularity profiling).
-void Queue::OutputFrameToFile(
-    const LogItem& logItem)
-{
-    const auto& settings = m_pDevice->ProfilerSettings();
-
-    if (m_logFile.IsOpen() == false)
-    {
-        // Build a file name for this frame's log file.
-        char tempString[512];
-        Snprintf(&tempString[0],
-                 sizeof(tempString),
-                 "%s/%s/frameLog.csv",
-                 settings.gpuProfilerLogDirectory,
-                 static_cast<const Platform*>(m_pDevice->GetPlatform())->LogDirName());
-
-        Result result = m_logFile.Open(&tempString[0], FileAccessWrite);
-        PAL_ASSERT(result == Result::Success);
-
-        // Write the CSV column headers to the newly opened file.
-        const char* pCsvHeader = "Frame #, Start Clock, End Clock, Time (us) [Frequency: %llu], ";
-        Snprintf(&tempString[0], sizeof(tempString), pCsvHeader, m_pDevice->TimestampFreq());
-        m_logFile.Write(&tempString[0], strlen(&tempString[0]));
-        const uint32 numGlobalPerfCounters = m_pDevice->NumGlobalPerfCounters();
-        if (numGlobalPerfCounters > 0)
-        {
-            for (uint32 i = 0; i < numGlobalPerfCounters; i++)
-            {
-                const auto& counter = m_pDevice->GlobalPerfCounters()[i];
-                if (settings.gpuProfilerGlobalPerfCounterPerInstance)
-                {
-                    for (uint32 j = 0; j < counter.instanceCount; j++)
-                    {
-                        m_logFile.Printf("%s_INSTANCE%d, ", &counter.name[0], j);
-                    }
-                }
-                else
-                {
-                    m_logFile.Printf("%s, ", &counter.name[0]);
-                }
-            }
-        }
-
-        if (m_pDevice->GetProfilerMode() > GpuProfilerSqttOff)
-        {
-            m_logFile.Printf("ThreadTraceId, ");
-        }
-
-        m_logFile.Printf("\n");
-    }
-
-    m_logFile.Printf("%u, ", logItem.frameId);
-
-    OutputTimestampsToFile(logItem);
-    OutputGlobalPerfCountersToFile(logItem);
-    OutputSqThreadTraceToFile(logItem);
-
-    m_logFile.Printf("\n");
-    m_logFile.Flush();
-}
-
-// =====================================================================================================================
-// Output the portion of a .csv with the start/end clock values and time elapsed.  Shared code by all profile
-// granularities.
-void Queue::OutputTimestampsToFile(
-    const LogItem& logItem)
-{
-#if PAL_CLIENT_INTERFACE_MAJOR_VERSION < 355
-    if (HasValidGpaSample(&logItem, true))
-#else
-    if (HasValidGpaSample(&logItem, GpuUtil::GpaSampleType::Timing))
-#endif
-    {
-        uint64 pResult[2] = {};
-        Result result     = logItem.pGpaSession->GetResults(logItem.gpaSampleIdTs,
-                                                            nullptr,
-                                                            pResult);
-
-        m_logFile.Printf("%llu, %llu, ", pResult[0], pResult[1]);
-
-        bool hideElapsedTime = (m_pDevice->ProfilerSettings().gpuProfilerGranularity == GpuProfilerGranularityDraw) &&
-                               (logItem.type == LogItemType::CmdBufferCall) &&
-                               (logItem.cmdBufCall.callId == CmdBufCallId::Begin);
-
-        // Print the elapsed time for this call if pre-call/post-call timestamps were inserted.
-        if (!hideElapsedTime)
-        {
-            const double tsDiff   = static_cast<double>(pResult[1] - pResult[0]);
-            const double timeInUs = 1000000 * tsDiff / m_pDevice->TimestampFreq();
-
-            m_logFile.Printf("%.2lf, ", timeInUs);
-        }
-        else
-        {
-            m_logFile.Printf(", ");
-        }
-    }
-    else
-    {
-        m_logFile.Printf(", , , ");
+        pRow->flags   |= LogRowComment;
+        pRow->pComment = cmdBufItem.comment.string;
     }
 }
 
 // =====================================================================================================================
-// Output pipeline stats to file.  Only supported by draw/cmdbuf granularities.
-void Queue::OutputPipelineStatsToFile(
-    const LogItem& logItem)
+// Reads the pipeline stats of a log item.  Only supported by draw/cmdbuf granularities.
+void Queue::ReadPipelineStats(
+    const LogItem& logItem,
+    LogRow*        pRow)
 {
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION < 355
     if (logItem.pPipeStatsQuery != nullptr)
@@ -687,8 +779,9 @@ void Queue::OutputPipelineStatsToFile(
     if (HasValidGpaSample(&logItem, GpuUtil::GpaSampleType::Query))
 #endif
     {
-        uint64 pipelineStats[11] = {};
-        size_t pipelineStatsSize = sizeof(pipelineStats);
+        // PAL hardcodes the layout of the return pipeline stats values based on the client, leading to different
+        // versions of this code to a uniform log layout.
+        size_t pipelineStatsSize = sizeof(pRow->pipelineStats);
 
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION < 355
         QueryResultFlags flags = static_cast<QueryResultFlags>(QueryResult64Bit | QueryResultWait);
@@ -697,32 +790,26 @@ void Queue::OutputPipelineStatsToFile(
                                                                   0,
                                                                   1,
                                                                   &pipelineStatsSize,
-                                                                  &pipelineStats[0],
+                                                                  &pRow->pipelineStats[0],
                                                                   0);
 #else
         const Result result = logItem.pGpaSession->GetResults(logItem.gpaSampleIdQuery,
                                                               &pipelineStatsSize,
-                                                              pipelineStats);
+                                                              &pRow->pipelineStats[0]);
 #endif
         PAL_ASSERT(result == Result::Success);
-        PAL_ASSERT(pipelineStatsSize == sizeof(pipelineStats));
+        PAL_ASSERT(pipelineStatsSize == sizeof(pRow->pipelineStats));
 
-        // PAL hardcodes the layout of the return pipeline stats values based on the client, leading to different
-        // versions of this code to a uniform log layout.
-        m_logFile.Printf("%llu, %llu, %llu, %llu, %llu, %llu, %llu, %llu, %llu, %llu, %llu, ", pipelineStats[0],
-                         pipelineStats[1], pipelineStats[2], pipelineStats[3], pipelineStats[4], pipelineStats[5],
-                         pipelineStats[6], pipelineStats[7], pipelineStats[8], pipelineStats[9], pipelineStats[10]);
-    }
-    else if (m_pDevice->ProfilerSettings().gpuProfilerRecordPipelineStats)
-    {
-        m_logFile.Printf(", , , , , , , , , , , ");
+        pRow->flags |= LogRowPipelineStats;
     }
 }
 
 // =====================================================================================================================
-// Dump the enabled global perf counters to file.  Shared code between draw/cmdbuf and per-frame profile granularities.
-void Queue::OutputGlobalPerfCountersToFile(
-    const LogItem& logItem)
+// Reads the enabled global perf counters of a log item.  Shared code between draw/cmdbuf and per-frame profile
+// granularities.
+void Queue::ReadGlobalPerfCounters(
+    const LogItem& logItem,
+    LogRow*        pRow)
 {
     const auto&              settings              = m_pDevice->ProfilerSettings();
     const GlobalPerfCounter* pGlobalPerfCounters   = m_pDevice->GlobalPerfCounters();
@@ -791,31 +878,28 @@ void Queue::OutputGlobalPerfCountersToFile(
                }
             }
 
-            PAL_SAFE_FREE(pResult, m_pDevice->GetPlatform());
-
-            // Output into .csv file.
-            for (uint32 i = 0; i < m_numReportedPerfCounters; i++)
-            {
-                m_logFile.Printf("%llu, ", m_pGlobalPerfCounterValues[i]);
-            }
+            pRow->flags    |= LogRowCounters;
+            pRow->pCounters = m_pGlobalPerfCounterValues;
         }
-    }
-    else
-    {
-        for (uint32 i = 0; i < m_numReportedPerfCounters; i++)
+        else
         {
-            m_logFile.Printf(", ");
+            pRow->flags |= LogRowCountersFailed;
         }
+
+        PAL_SAFE_FREE(pResult, m_pDevice->GetPlatform());
     }
 }
 
 // =====================================================================================================================
-// Dumps the SQ thread trace data from this experiment out to file.
-void Queue::OutputSqThreadTraceToFile(
-    const LogItem& logItem)
+// Dumps the SQ thread trace data from this experiment out to file and records what should be reported for it.
+void Queue::ReadSqThreadTrace(
+    const LogItem& logItem,
+    LogRow*        pRow)
 {
     const auto& settings = m_pDevice->ProfilerSettings();
 
+    LogSqttState state = LogSqttNone;
+
     if (m_pDevice->GetProfilerMode() > GpuProfilerSqttOff)
     {
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION < 355
@@ -829,11 +913,12 @@ void Queue::OutputSqThreadTraceToFile(
                 if (settings.gpuProfilerGranularity == GpuProfilerGranularityFrame)
                 {
                     OutputRgpFile(*logItem.pGpaSession, logItem.gpaSampleId);
-                    m_logFile.Printf("%u, ", m_curLogFrame);
+                    state         = LogSqttTraceId;
+                    pRow->traceId = m_curLogFrame;
                 }
                 else
                 {
-                    m_logFile.Printf("USE FRAME-GRANULARITY FOR RGP, ");
+                    state = LogSqttNeedsFrame;
                 }
             }
             else
@@ -908,7 +993,8 @@ void Queue::OutputSqThreadTraceToFile(
                         pResult = Util::VoidPtrInc(pResult, pData->size);
                     }
 
-                    m_logFile.Printf("%u, ", m_curLogSqttIdx++);
+                    state         = LogSqttTraceId;
+                    pRow->traceId = m_curLogSqttIdx++;
                 }
 
                 PAL_SAFE_FREE(pResultBase, m_pDevice->GetPlatform());
@@ -918,18 +1004,244 @@ void Queue::OutputSqThreadTraceToFile(
         {
             // TODO: this error is set under none case yet.
             // GpaSession::BeginSample hits an ASSERT if this error happens.
-            m_logFile.Printf("ERROR: OUT OF MEMORY, ");
+            state = LogSqttOutOfMemory;
         }
         else if (logItem.errors.perfExpUnsupported != 0)
         {
-            m_logFile.Printf("ERROR: THREAD TRACE UNSUPPORTED, ");
+            state = LogSqttUnsupported;
         }
         else
+        {
+            state = LogSqttBlank;
+        }
+    }
+
+    pRow->flags |= (state << LogRowSqttShift);
+}
+
+// =====================================================================================================================
+// Outputs a single row to the current log file in whichever format was requested.
+void Queue::OutputRow(
+    const LogRow& row)
+{
+    if (m_binaryOutput)
+    {
+        if (m_binaryLog.IsOpen())
+        {
+            const Result result = m_binaryLog.AppendRow(row);
+            PAL_ASSERT(result == Result::Success);
+        }
+    }
+    else
+    {
+        switch (row.flags & LogRowTypeMask)
+        {
+        case QueueCall:
+            OutputQueueCallToFile(row);
+            break;
+        case CmdBufferCall:
+            OutputCmdBufCallToFile(row);
+            break;
+        case Frame:
+            OutputFrameToFile(row);
+            break;
+        default:
+            PAL_ASSERT_ALWAYS();
+            break;
+        }
+    }
+}
+
+// =====================================================================================================================
+// Outputs details of a single queue call to the log file.
+void Queue::OutputQueueCallToFile(
+    const LogRow& row)
+{
+    m_logFile.Printf("%s, , , , , , , , , , , , , , , , ", QueueCallIdStrings[row.callId]);
+
+    if (m_pDevice->ProfilerSettings().gpuProfilerRecordPipelineStats)
+    {
+        m_logFile.Printf(", , , , , , , , , , , ");
+    }
+
+    for (uint32 i = 0; i < m_numReportedPerfCounters; i++)
+    {
+        m_logFile.Printf(", ");
+    }
+
+    m_logFile.Printf("\n");
+}
+
+//======================================================================================================================
+// Outputs details of a single command buffer call to the log file.
+void Queue::OutputCmdBufCallToFile(
+    const LogRow& row)
+{
+    PAL_ASSERT(m_logFile.IsOpen());
+
+    // Add a "- " before command buffer calls made in a nested command buffer to differentiate them from calls made in
+    // the root command buffer.
+    m_logFile.Printf(", %d, %s%s, ",
+                     row.cmdBufIdx,
+                     TestAnyFlagSet(row.flags, LogRowNested) ? "- " : "",
+                     CmdBufCallIdStrings[row.callId]);
+
+    OutputTimestampsToFile(row);
+
+    // Print any draw/dispatch specific info (shader hashes, etc.).
+    if (TestAnyFlagSet(row.flags, LogRowDraw))
+    {
+        m_logFile.Printf("0x%016llx, 0x%016llx, 0x%016llx%016llx, 0x%016llx%016llx, 0x%016llx%016llx,"
+                         " 0x%016llx%016llx, 0x%016llx%016llx, %u, %u, , ",
+                         row.pipelineHash,
+                         row.compilerHash,
+                         row.shaderHashes[0].upper,
+                         row.shaderHashes[0].lower,
+                         row.shaderHashes[1].upper,
+                         row.shaderHashes[1].lower,
+                         row.shaderHashes[2].upper,
+                         row.shaderHashes[2].lower,
+                         row.shaderHashes[3].upper,
+                         row.shaderHashes[3].lower,
+                         row.shaderHashes[4].upper,
+                         row.shaderHashes[4].lower,
+                         row.counts[0],
+                         row.counts[1]);
+    }
+    else if (TestAnyFlagSet(row.flags, LogRowDispatch))
+    {
+        m_logFile.Printf("0x%016llx, 0x%016llx, 0x%016llx%016llx, , , , , %u, , , ",
+                         row.pipelineHash,
+                         row.compilerHash,
+                         row.shaderHashes[0].upper,
+                         row.shaderHashes[0].lower,
+                         row.counts[0]);
+    }
+    else if (TestAnyFlagSet(row.flags, LogRowComment))
+    {
+        m_logFile.Printf(", , , , , , , , ,\"%s\", ", row.pComment);
+    }
+    else
+    {
+        m_logFile.Printf(", , , , , , , , , , ");
+    }
+
+    OutputPipelineStatsToFile(row);
+    OutputGlobalPerfCountersToFile(row);
+    OutputSqThreadTraceToFile(row);
+
+    m_logFile.Printf("\n");
+}
+
+//======================================================================================================================
+// Outputs details of a frame to the log file (used only for frame-granularity profiling).
+void Queue::OutputFrameToFile(
+    const LogRow& row)
+{
+    m_logFile.Printf("%u, ", row.callId);
+
+    OutputTimestampsToFile(row);
+    OutputGlobalPerfCountersToFile(row);
+    OutputSqThreadTraceToFile(row);
+
+    m_logFile.Printf("\n");
+}
+
+// =====================================================================================================================
+// Output the portion of a .csv with the start/end clock values and time elapsed.  Shared code by all profile
+// granularities.
+void Queue::OutputTimestampsToFile(
+    const LogRow& row)
+{
+    if (TestAnyFlagSet(row.flags, LogRowTimestamps))
+    {
+        m_logFile.Printf("%llu, %llu, ", row.clocks[0], row.clocks[1]);
+
+        // Print the elapsed time for this call if pre-call/post-call timestamps were inserted.
+        if (TestAnyFlagSet(row.flags, LogRowHideElapsed) == false)
+        {
+            const double tsDiff   = static_cast<double>(row.clocks[1] - row.clocks[0]);
+            const double timeInUs = 1000000 * tsDiff / m_pDevice->TimestampFreq();
+
+            m_logFile.Printf("%.2lf, ", timeInUs);
+        }
+        else
+        {
+            m_logFile.Printf(", ");
+        }
+    }
+    else
+    {
+        m_logFile.Printf(", , , ");
+    }
+}
+
+// =====================================================================================================================
+// Output pipeline stats to file.  Only supported by draw/cmdbuf granularities.
+void Queue::OutputPipelineStatsToFile(
+    const LogRow& row)
+{
+    if (TestAnyFlagSet(row.flags, LogRowPipelineStats))
+    {
+        const uint64* pStats = &row.pipelineStats[0];
+
+        m_logFile.Printf("%llu, %llu, %llu, %llu, %llu, %llu, %llu, %llu, %llu, %llu, %llu, ", pStats[0], pStats[1],
+                         pStats[2], pStats[3], pStats[4], pStats[5], pStats[6], pStats[7], pStats[8], pStats[9],
+                         pStats[10]);
+    }
+    else if (m_pDevice->ProfilerSettings().gpuProfilerRecordPipelineStats)
+    {
+        m_logFile.Printf(", , , , , , , , , , , ");
+    }
+}
+
+// =====================================================================================================================
+// Dump the enabled global perf counters to file.  Shared code between draw/cmdbuf and per-frame profile granularities.
+void Queue::OutputGlobalPerfCountersToFile(
+    const LogRow& row)
+{
+    if (TestAnyFlagSet(row.flags, LogRowCounters))
+    {
+        for (uint32 i = 0; i < m_numReportedPerfCounters; i++)
+        {
+            m_logFile.Printf("%llu, ", row.pCounters[i]);
+        }
+    }
+    else if (TestAnyFlagSet(row.flags, LogRowCountersFailed) == false)
+    {
+        for (uint32 i = 0; i < m_numReportedPerfCounters; i++)
         {
             m_logFile.Printf(", ");
         }
     }
 }
 
+// =====================================================================================================================
+// Outputs the thread trace column of a row.
+void Queue::OutputSqThreadTraceToFile(
+    const LogRow& row)
+{
+    switch ((row.flags & LogRowSqttMask) >> LogRowSqttShift)
+    {
+    case LogSqttBlank:
+        m_logFile.Printf(", ");
+        break;
+    case LogSqttTraceId:
+        m_logFile.Printf("%u, ", row.traceId);
+        break;
+    case LogSqttNeedsFrame:
+        m_logFile.Printf("USE FRAME-GRANULARITY FOR RGP, ");
+        break;
+    case LogSqttOutOfMemory:
+        m_logFile.Printf("ERROR: OUT OF MEMORY, ");
+        break;
+    case LogSqttUnsupported:
+        m_logFile.Printf("ERROR: THREAD TRACE UNSUPPORTED, ");
+        break;
+    default:
+        break;
+    }
+}
+
 } // GpuProfiler
 } // Pal
@@ -0,0 +1,99 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include "pal.h"
+
+namespace Pal
+{
+namespace InterfaceLogger
+{
+
+// The following definitions describe the binary capture format the LogContext writes in place of JSON text when the
+// interfaceLoggerBinaryCapture setting is enabled. A binary capture carries exactly the same information as a JSON log
+// but skips all text formatting, and each thread writes its own capture file so that no locks are taken while logging.
+// The per-thread files are merged offline by tools/interfaceLogger/mergeCapture.py, which can also convert them to the
+// usual JSON log; tools/interfaceLogger/palReplay.cpp replays a merged capture against a null device.
+//
+// A capture file starts with a CaptureFileHeader, followed by "nameTableSize" bytes holding "numObjectNames"
+// null-terminated interface class names (indexed by InterfaceObject), then "numFuncNames" null-terminated function
+// names (indexed by InterfaceFunc) and finally a uint32 array giving the InterfaceObject of each function. Embedding
+// the names keeps captures readable even if the InterfaceFunc enum is changed later.
+//
+// The rest of the file is a sequence of CaptureToken bytes, each followed by its payload. The tokens map one-to-one
+// onto the JsonWriter calls a JSON log would have made, except that:
+//  - Every logged function is wrapped in BeginFunc and EndFunc tokens rather than in a map with "_type", "this",
+//    "name", "thread", "preCallTime" and "postCallTime" keys.
+//  - Keys are written as IDs. The first use of each key is a DefineKey token which also gives the key's text. A key
+//    may be defined more than once if the writer ran out of memory; the latest definition of an ID always applies.
+//  - Interface objects are written as single Object tokens rather than as maps with "class" and "id" keys.
+//
+// All values are little-endian and are not aligned in any way. A capture which was cut short by a crash can be read up
+// to its last EndFunc token.
+
+constexpr uint32 CaptureFileMagic   = 0x42434C50; // 'PLCB'
+constexpr uint32 CaptureFileVersion = 1;
+
+// Structure defining the top of each binary capture file.
+struct CaptureFileHeader
+{
+    uint32 magic;          // Must be CaptureFileMagic.
+    uint32 version;        // Must be CaptureFileVersion.
+    uint32 size;           // Size of this structure in bytes.
+    uint32 numObjectNames; // Number of interface class names in the name table.
+    uint32 numFuncNames;   // Number of interface function names in the name table.
+    uint32 nameTableSize;  // Size of the name table which follows this header in bytes.
+};
+
+// Each token in a binary capture begins with one of these values. The payload which follows each token is noted below.
+enum class CaptureToken : uint8
+{
+    BeginList = 0, // No payload.
+    EndList,       // No payload.
+    BeginMap,      // No payload.
+    EndMap,        // No payload.
+    Key,           // uint32 key ID.
+    DefineKey,     // uint32 key ID, uint32 length and "length" characters. Also acts as a Key token.
+    String,        // uint32 length and "length" characters.
+    Null,          // No payload.
+    False,         // No payload.
+    True,          // No payload.
+    Uint8,         // uint8 value.
+    Uint16,        // uint16 value.
+    Uint32,        // uint32 value.
+    Uint64,        // uint64 value.
+    Int8,          // int8 value.
+    Int16,         // int16 value.
+    Int32,         // int32 value.
+    Int64,         // int64 value.
+    Float,         // float value.
+    Object,        // uint32 InterfaceObject and uint32 object ID.
+    BeginFunc,     // uint32 InterfaceFunc, uint32 object ID, uint32 thread ID, uint64 preCallTime, uint64 postCallTime.
+    EndFunc,       // No payload.
+    Count
+};
+
+} // InterfaceLogger
+} // Pal
@@ -2844,6 +2844,7 @@ void PAL_STDCALL CmdBuffer::CmdSetUserDataCs(
     if (pThis->m_pPlatform->LogBeginFunc(funcInfo, &pLogContext))
     {
         pLogContext->BeginInput();
+        pLogContext->KeyAndEnum("bindPoint", PipelineBindPoint::Compute);
         pLogContext->KeyAndValue("firstEntry", firstEntry);
         pLogContext->KeyAndBeginList("values", false);
 
@@ -2879,6 +2880,7 @@ void PAL_STDCALL CmdBuffer::CmdSetUserDataGfx(
     if (pThis->m_pPlatform->LogBeginFunc(funcInfo, &pLogContext))
     {
         pLogContext->BeginInput();
+        pLogContext->KeyAndEnum("bindPoint", PipelineBindPoint::Graphics);
         pLogContext->KeyAndValue("firstEntry", firstEntry);
         pLogContext->KeyAndBeginList("values", false);
 
@@ -47,6 +47,7 @@
 #include "core/layers/interfaceLogger/interfaceLoggerShader.h"
 #include "core/layers/interfaceLogger/interfaceLoggerShaderCache.h"
 #include "core/layers/interfaceLogger/interfaceLoggerSwapChain.h"
+#include "palHashMapImpl.h"
 
 using namespace Util;
 
@@ -338,6 +339,8 @@ static constexpr FuncFormattingEntry FuncFormattingTable[] =
     { InterfaceFunc::ShaderCacheSerialize,                                      InterfaceObject::ShaderCache,          "Serialize"                               },
     { InterfaceFunc::ShaderCacheReset,                                          InterfaceObject::ShaderCache,          "Reset"                                   },
     { InterfaceFunc::ShaderCacheMerge,                                          InterfaceObject::ShaderCache,          "Merge"                                   },
+    { InterfaceFunc::ShaderCacheFindPipelineBinary,                             InterfaceObject::ShaderCache,          "FindPipelineBinary"                      },
+    { InterfaceFunc::ShaderCacheGetStats,                                       InterfaceObject::ShaderCache,          "GetStats"                                },
     { InterfaceFunc::SwapChainAcquireNextImage,                                 InterfaceObject::SwapChain,            "AcquireNextImage"                        },
     { InterfaceFunc::SwapChainWaitIdle,                                         InterfaceObject::SwapChain,            "WaitIdle"                                },
     { InterfaceFunc::SwapChainDestroy,                                          InterfaceObject::SwapChain,            "Destroy"                                 },
@@ -449,10 +452,13 @@ void LogStream::VerifyUnusedSpace(
 
 // =====================================================================================================================
 LogContext::LogContext(
-    Platform* pPlatform)
+    Platform* pPlatform,
+    bool      binaryCapture)
     :
     JsonWriter(&m_stream),
-    m_stream(pPlatform)
+    m_binaryCapture(binaryCapture),
+    m_stream(pPlatform),
+    m_keyIds(256, pPlatform)
 {
 #if PAL_ENABLE_PRINTS_ASSERTS
     for (uint32 idx = 0; idx < static_cast<uint32>(InterfaceFunc::Count); ++idx)
@@ -461,15 +467,94 @@ LogContext::LogContext(
     }
 #endif
 
-    // All top-level entries in the log will be contained in a list. If we don't do this, we can only write one entry!
-    BeginList(false);
+    if (m_binaryCapture == false)
+    {
+        // All top-level entries in the log will be contained in a list. If we don't do this, we can only write one
+        // entry!
+        BeginList(false);
+    }
 }
 
 // =====================================================================================================================
 LogContext::~LogContext()
 {
-    // End the list we started in the constructor.
-    EndList();
+    if (m_binaryCapture == false)
+    {
+        // End the list we started in the constructor.
+        EndList();
+    }
+}
+
+// =====================================================================================================================
+Result LogContext::OpenFile(
+    const char* pFilePath)
+{
+    Result result = Result::Success;
+
+    if (m_binaryCapture)
+    {
+        // Binary captures can't buffer anything before this point because they must start with their header.
+        PAL_ASSERT(m_stream.BufferedSize() == 0);
+
+        result = m_keyIds.Init();
+
+        if (result == Result::Success)
+        {
+            WriteCaptureHeader();
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_stream.OpenFile(pFilePath);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Writes the CaptureFileHeader and the name table which must begin every binary capture.
+void LogContext::WriteCaptureHeader()
+{
+    constexpr uint32 NumObjects = static_cast<uint32>(InterfaceObject::Count);
+    constexpr uint32 NumFuncs   = static_cast<uint32>(InterfaceFunc::Count);
+
+    CaptureFileHeader header = {};
+    header.magic          = CaptureFileMagic;
+    header.version        = CaptureFileVersion;
+    header.size           = sizeof(header);
+    header.numObjectNames = NumObjects;
+    header.numFuncNames   = NumFuncs;
+    header.nameTableSize  = sizeof(uint32) * NumFuncs;
+
+    for (uint32 idx = 0; idx < NumObjects; ++idx)
+    {
+        header.nameTableSize += static_cast<uint32>(strlen(ObjectNames[idx]) + 1);
+    }
+
+    for (uint32 idx = 0; idx < NumFuncs; ++idx)
+    {
+        header.nameTableSize += static_cast<uint32>(strlen(FuncFormattingTable[idx].pFuncName) + 1);
+    }
+
+    m_stream.WriteData(&header, sizeof(header));
+
+    for (uint32 idx = 0; idx < NumObjects; ++idx)
+    {
+        m_stream.WriteData(ObjectNames[idx], static_cast<uint32>(strlen(ObjectNames[idx]) + 1));
+    }
+
+    for (uint32 idx = 0; idx < NumFuncs; ++idx)
+    {
+        const char*const pName = FuncFormattingTable[idx].pFuncName;
+        m_stream.WriteData(pName, static_cast<uint32>(strlen(pName) + 1));
+    }
+
+    for (uint32 idx = 0; idx < NumFuncs; ++idx)
+    {
+        const uint32 objectType = static_cast<uint32>(FuncFormattingTable[idx].objectType);
+        m_stream.WriteData(&objectType, sizeof(objectType));
+    }
 }
 
 // =====================================================================================================================
@@ -477,31 +562,206 @@ void LogContext::BeginFunc(
     const BeginFuncInfo& info,
     uint32               threadId)
 {
-    auto const& funcData = FuncFormattingTable[static_cast<uint32>(info.funcId)];
-
-    BeginMap(false);
-    KeyAndValue("_type", "InterfaceFunc");
-    Key("this");
-    Object(funcData.objectType, info.objectId);
-    KeyAndValue("name", funcData.pFuncName);
-    KeyAndValue("thread", threadId);
-    KeyAndValue("preCallTime", info.preCallTime);
-    KeyAndValue("postCallTime", info.postCallTime);
+    if (m_binaryCapture)
+    {
+        const uint32 ids[3] = { static_cast<uint32>(info.funcId), info.objectId, threadId };
+
+        uint8 data[1 + sizeof(ids) + (sizeof(uint64) * 2)];
+        data[0] = static_cast<uint8>(CaptureToken::BeginFunc);
+        memcpy(&data[1],                                ids,                sizeof(ids));
+        memcpy(&data[1 + sizeof(ids)],                  &info.preCallTime,  sizeof(uint64));
+        memcpy(&data[1 + sizeof(ids) + sizeof(uint64)], &info.postCallTime, sizeof(uint64));
+        m_stream.WriteData(data, sizeof(data));
+    }
+    else
+    {
+        auto const& funcData = FuncFormattingTable[static_cast<uint32>(info.funcId)];
+
+        BeginMap(false);
+        KeyAndValue("_type", "InterfaceFunc");
+        Key("this");
+        Object(funcData.objectType, info.objectId);
+        KeyAndValue("name", funcData.pFuncName);
+        KeyAndValue("thread", threadId);
+        KeyAndValue("preCallTime", info.preCallTime);
+        KeyAndValue("postCallTime", info.postCallTime);
+    }
 }
 
 // =====================================================================================================================
 void LogContext::EndFunc()
 {
-    EndMap();
+    // Binary captures are only written out in large chunks; losing the last few calls in a crash is the price of not
+    // hitting the file system on every call.
+    constexpr uint32 CaptureFlushThreshold = 256 * 1024;
+
+    bool flush = false;
+
+    if (m_binaryCapture)
+    {
+        WriteToken(CaptureToken::EndFunc);
+        flush = (m_stream.BufferedSize() >= CaptureFlushThreshold);
+    }
+    else
+    {
+        EndMap();
+        flush = true;
+    }
 
     // Flush our buffered JSON text to our log file if it's already been opened.
-    if (m_stream.IsFileOpen())
+    if (flush && m_stream.IsFileOpen())
     {
         const Result result = m_stream.WriteFile();
         PAL_ASSERT(result == Result::Success);
     }
 }
 
+// =====================================================================================================================
+void LogContext::BeginList(
+    bool isInline)
+{
+    if (m_binaryCapture)
+    {
+        WriteToken(CaptureToken::BeginList);
+    }
+    else
+    {
+        JsonWriter::BeginList(isInline);
+    }
+}
+
+// =====================================================================================================================
+void LogContext::EndList()
+{
+    if (m_binaryCapture)
+    {
+        WriteToken(CaptureToken::EndList);
+    }
+    else
+    {
+        JsonWriter::EndList();
+    }
+}
+
+// =====================================================================================================================
+void LogContext::BeginMap(
+    bool isInline)
+{
+    if (m_binaryCapture)
+    {
+        WriteToken(CaptureToken::BeginMap);
+    }
+    else
+    {
+        JsonWriter::BeginMap(isInline);
+    }
+}
+
+// =====================================================================================================================
+void LogContext::EndMap()
+{
+    if (m_binaryCapture)
+    {
+        WriteToken(CaptureToken::EndMap);
+    }
+    else
+    {
+        JsonWriter::EndMap();
+    }
+}
+
+// =====================================================================================================================
+// When capturing, each key is written out in full the first time it's seen and by its ID after that.
+void LogContext::Key(
+    const char* pKey)
+{
+    if (m_binaryCapture)
+    {
+        bool    existed = false;
+        uint32* pKeyId  = nullptr;
+        uint32  keyId   = UINT32_MAX;
+
+        if (m_keyIds.FindAllocate(pKey, &existed, &pKeyId) == Result::Success)
+        {
+            if (existed == false)
+            {
+                *pKeyId = m_keyIds.GetNumEntries() - 1;
+            }
+
+            keyId = *pKeyId;
+        }
+        else
+        {
+            // If we can't remember this key we must define it every time it's used. Readers must accept redefinitions
+            // of this ID anyway.
+            existed = false;
+        }
+
+        uint8 data[1 + sizeof(uint32)];
+        data[0] = static_cast<uint8>(existed ? CaptureToken::Key : CaptureToken::DefineKey);
+        memcpy(&data[1], &keyId, sizeof(uint32));
+        m_stream.WriteData(data, sizeof(data));
+
+        if (existed == false)
+        {
+            const uint32 length = static_cast<uint32>(strlen(pKey));
+            m_stream.WriteData(&length, sizeof(length));
+            m_stream.WriteData(pKey, length);
+        }
+    }
+    else
+    {
+        JsonWriter::Key(pKey);
+    }
+}
+
+// =====================================================================================================================
+void LogContext::Value(
+    const char* pValue)
+{
+    if (m_binaryCapture)
+    {
+        const uint32 length = static_cast<uint32>(strlen(pValue));
+
+        uint8 data[1 + sizeof(uint32)];
+        data[0] = static_cast<uint8>(CaptureToken::String);
+        memcpy(&data[1], &length, sizeof(uint32));
+        m_stream.WriteData(data, sizeof(data));
+        m_stream.WriteData(pValue, length);
+    }
+    else
+    {
+        JsonWriter::Value(pValue);
+    }
+}
+
+// =====================================================================================================================
+void LogContext::Value(
+    bool value)
+{
+    if (m_binaryCapture)
+    {
+        WriteToken(value ? CaptureToken::True : CaptureToken::False);
+    }
+    else
+    {
+        JsonWriter::Value(value);
+    }
+}
+
+// =====================================================================================================================
+void LogContext::NullValue()
+{
+    if (m_binaryCapture)
+    {
+        WriteToken(CaptureToken::Null);
+    }
+    else
+    {
+        JsonWriter::NullValue();
+    }
+}
+
 // =====================================================================================================================
 void LogContext::Object(
     const IBorderColorPalette* pDecorator)
@@ -829,10 +1089,22 @@ void LogContext::Object(
     InterfaceObject objectType,
     uint32          objectId)
 {
-    BeginMap(true);
-    KeyAndValue("class", ObjectNames[static_cast<uint32>(objectType)]);
-    KeyAndValue("id", objectId);
-    EndMap();
+    if (m_binaryCapture)
+    {
+        const uint32 payload[2] = { static_cast<uint32>(objectType), objectId };
+
+        uint8 data[1 + sizeof(payload)];
+        data[0] = static_cast<uint8>(CaptureToken::Object);
+        memcpy(&data[1], payload, sizeof(payload));
+        m_stream.WriteData(data, sizeof(data));
+    }
+    else
+    {
+        BeginMap(true);
+        KeyAndValue("class", ObjectNames[static_cast<uint32>(objectType)]);
+        KeyAndValue("id", objectId);
+        EndMap();
+    }
 }
 
 // =====================================================================================================================
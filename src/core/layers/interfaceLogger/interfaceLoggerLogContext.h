@@ -25,7 +25,9 @@
 #pragma once
 
 #include "core/layers/decorators.h"
+#include "core/layers/interfaceLogger/interfaceLoggerCapture.h"
 #include "palFile.h"
+#include "palHashMap.h"
 #include "palJsonWriter.h"
 
 namespace Pal
@@ -311,6 +313,8 @@ enum class InterfaceFunc : uint32
     ShaderCacheSerialize,
     ShaderCacheReset,
     ShaderCacheMerge,
+    ShaderCacheFindPipelineBinary,
+    ShaderCacheGetStats,
     SwapChainAcquireNextImage,
     SwapChainWaitIdle,
     SwapChainDestroy,
@@ -341,9 +345,15 @@ public:
     // Returns true if the log file has already been opened.
     bool IsFileOpen() const { return m_file.IsOpen(); }
 
+    // Returns the number of bytes waiting to be written by WriteFile.
+    uint32 BufferedSize() const { return m_bufferUsed; }
+
     virtual void WriteString(const char* pString, uint32 length) override;
     virtual void WriteCharacter(char character) override;
 
+    // Appends raw bytes to the stream, used when writing a binary capture rather than JSON text.
+    void WriteData(const void* pData, uint32 size) { WriteString(static_cast<const char*>(pData), size); }
+
 private:
     void VerifyUnusedSpace(uint32 size);
 
@@ -396,14 +406,18 @@ private:
 // Note that the LogContext also defines a common format for logging instances of PAL interface objects. Each object is
 // represented by a map containing a "class" key identifying the PAL interface class (e.g., IDevice) and an "id" key
 // identifying the particular instance of the class. All IDs are unique and zero-based.
+//
+// A context can also write a binary capture (see interfaceLoggerCapture.h) instead of JSON text. Binary contexts hide
+// the JsonWriter functions below so that each call is encoded as a capture token; the rest of the layer can't tell the
+// difference. Binary contexts only ever log interface functions and can't be written to before OpenFile is called.
 class LogContext : public Util::JsonWriter
 {
 public:
-    explicit LogContext(Platform* pPlatform);
+    LogContext(Platform* pPlatform, bool binaryCapture);
     virtual ~LogContext();
 
     // Must be called once to associate a context with a log file. Logging can occur before the log is opened.
-    Result OpenFile(const char* pFilePath) { return m_stream.OpenFile(pFilePath); }
+    Result OpenFile(const char* pFilePath);
 
     // These functions begin and end a specially formatted map which represents a PAL interface function.
     void BeginFunc(const BeginFuncInfo& info, uint32 threadId);
@@ -416,6 +430,42 @@ public:
     void BeginOutput() { KeyAndBeginMap("output", false); }
     void EndOutput()   { EndMap(); }
 
+    // These hide the JsonWriter functions of the same names so that binary captures can encode each call as a token.
+    void BeginList(bool isInline);
+    void EndList();
+    void BeginMap(bool isInline);
+    void EndMap();
+    void Key(const char* pKey);
+    void Value(const char* pValue);
+    void Value(uint64 value) { ScalarValue(CaptureToken::Uint64, value); }
+    void Value(uint32 value) { ScalarValue(CaptureToken::Uint32, value); }
+    void Value(uint16 value) { ScalarValue(CaptureToken::Uint16, value); }
+    void Value(uint8 value)  { ScalarValue(CaptureToken::Uint8,  value); }
+    void Value(int64 value)  { ScalarValue(CaptureToken::Int64,  value); }
+    void Value(int32 value)  { ScalarValue(CaptureToken::Int32,  value); }
+    void Value(int16 value)  { ScalarValue(CaptureToken::Int16,  value); }
+    void Value(int8 value)   { ScalarValue(CaptureToken::Int8,   value); }
+    void Value(float value)  { ScalarValue(CaptureToken::Float,  value); }
+    void Value(bool value);
+    void NullValue();
+
+    void KeyAndBeginList(const char* pKey, bool isInline) { Key(pKey); BeginList(isInline); }
+    void KeyAndBeginMap(const char* pKey, bool isInline)  { Key(pKey); BeginMap(isInline); }
+
+    void KeyAndValue(const char* pKey, const char* pValue) { Key(pKey); Value(pValue); }
+    void KeyAndValue(const char* pKey, uint64 value)       { Key(pKey); Value(value); }
+    void KeyAndValue(const char* pKey, uint32 value)       { Key(pKey); Value(value); }
+    void KeyAndValue(const char* pKey, uint16 value)       { Key(pKey); Value(value); }
+    void KeyAndValue(const char* pKey, uint8 value)        { Key(pKey); Value(value); }
+    void KeyAndValue(const char* pKey, int64 value)        { Key(pKey); Value(value); }
+    void KeyAndValue(const char* pKey, int32 value)        { Key(pKey); Value(value); }
+    void KeyAndValue(const char* pKey, int16 value)        { Key(pKey); Value(value); }
+    void KeyAndValue(const char* pKey, int8 value)         { Key(pKey); Value(value); }
+    void KeyAndValue(const char* pKey, float value)        { Key(pKey); Value(value); }
+    void KeyAndValue(const char* pKey, bool value)         { Key(pKey); Value(value); }
+
+    void KeyAndNullValue(const char* pKey) { Key(pKey); NullValue(); }
+
     // These functions create a map that represents a particular InterfaceLogger decorated PAL object.
     void Object(const IBorderColorPalette* pDecorator);
     void Object(const ICmdAllocator* pDecorator);
@@ -911,7 +961,32 @@ public:
 private:
     void Object(InterfaceObject objectType, uint32 objectId);
 
-    LogStream m_stream;
+    void WriteToken(CaptureToken token) { m_stream.WriteCharacter(static_cast<char>(token)); }
+    void WriteCaptureHeader();
+
+    // Writes a scalar JSON value, or a token holding the value itself when capturing.
+    template <typename T>
+    void ScalarValue(CaptureToken token, T value)
+    {
+        if (m_binaryCapture)
+        {
+            uint8 data[1 + sizeof(T)];
+            data[0] = static_cast<uint8>(token);
+            memcpy(&data[1], &value, sizeof(T));
+            m_stream.WriteData(data, sizeof(data));
+        }
+        else
+        {
+            JsonWriter::Value(value);
+        }
+    }
+
+    // Maps key strings to capture key IDs. Keys are always string literals so their addresses identify them uniquely.
+    typedef Util::HashMap<const char*, uint32, Platform> KeyIdMap;
+
+    const bool m_binaryCapture;
+    LogStream  m_stream;
+    KeyIdMap   m_keyIds;
 
     PAL_DISALLOW_DEFAULT_CTOR(LogContext);
     PAL_DISALLOW_COPY_AND_ASSIGN(LogContext);
@@ -294,6 +294,8 @@ static constexpr FuncLoggingTableEntry FuncLoggingTable[] =
     { InterfaceFunc::ShaderCacheSerialize,                          (GenCalls)            },
     { InterfaceFunc::ShaderCacheReset,                              (GenCalls)            },
     { InterfaceFunc::ShaderCacheMerge,                              (GenCalls)            },
+    { InterfaceFunc::ShaderCacheFindPipelineBinary,                 (GenCalls)            },
+    { InterfaceFunc::ShaderCacheGetStats,                           (GenCalls)            },
     { InterfaceFunc::SwapChainAcquireNextImage,                     (GenCalls | QueueOps) },
     { InterfaceFunc::SwapChainWaitIdle,                             (GenCalls)            },
     { InterfaceFunc::SwapChainDestroy,                              (CrtDstry)            },
@@ -371,6 +373,7 @@ Platform::~Platform()
     m_flags.threadKeyCreated  = 0;
     m_flags.multithreaded     = 0;
     m_flags.settingsCommitted = 0;
+    m_flags.binaryCapture     = 0;
 }
 
 // =====================================================================================================================
@@ -440,7 +443,7 @@ Result Platform::Init()
             // Note that we dynamically allocate the main log context because its constructor and destructor write
             // JSON which can trigger a dynamic memory allocation. If this layer isn't enabled, we shouldn't allocate
             // any memory aside from what we require to decorate the platform.
-            m_pMainLog = PAL_NEW(LogContext, this, AllocInternal) (this);
+            m_pMainLog = PAL_NEW(LogContext, this, AllocInternal) (this, false);
 
             if (m_pMainLog == nullptr)
             {
@@ -473,6 +476,7 @@ Result Platform::UpdateSettings()
     memset(m_interfaceLoggerSettings.interfaceLoggerDirectory, 0, 512);
     strncpy(m_interfaceLoggerSettings.interfaceLoggerDirectory, "~/.amdpal/", 512);
     m_interfaceLoggerSettings.interfaceLoggerMultithreaded = false;
+    m_interfaceLoggerSettings.interfaceLoggerBinaryCapture = false;
     m_interfaceLoggerSettings.interfaceLoggerBasePreset = 0x7;
     m_interfaceLoggerSettings.interfaceLoggerElevatedPreset = 0x1F;
 
@@ -532,10 +536,13 @@ Result Platform::CommitLoggingSettings()
         }
 
         // If multithreaded logging is enabled, we need to go back over our previously allocated ThreadData and give
-        // them a context.
-        if ((result == Result::Success) && m_interfaceLoggerSettings.interfaceLoggerMultithreaded)
+        // them a context. Binary captures are always written per thread so that no locks are taken while logging.
+        if ((result == Result::Success) &&
+            (m_interfaceLoggerSettings.interfaceLoggerMultithreaded ||
+             m_interfaceLoggerSettings.interfaceLoggerBinaryCapture))
         {
             m_flags.multithreaded = 1;
+            m_flags.binaryCapture = m_interfaceLoggerSettings.interfaceLoggerBinaryCapture;
 
             for (uint32 idx = 0; idx < m_threadDataVec.NumElements(); ++idx)
             {
@@ -950,13 +957,14 @@ Platform::ThreadData* Platform::CreateThreadData()
 LogContext* Platform::CreateThreadLogContext(
     uint32 threadId)
 {
-    LogContext* pContext = PAL_NEW(LogContext, this, AllocInternal)(this);
+    LogContext* pContext = PAL_NEW(LogContext, this, AllocInternal)(this, (m_flags.binaryCapture == 1));
 
     if (pContext != nullptr)
     {
         // Create a file name and path for this log.
         char logFileName[64];
-        Snprintf(logFileName, sizeof(logFileName), "pal_calls_thread_%u.json", threadId);
+        Snprintf(logFileName, sizeof(logFileName), "pal_calls_thread_%u.%s",
+                 threadId, (m_flags.binaryCapture == 1) ? "bin" : "json");
 
         char logFilePath[512];
         Snprintf(logFilePath, sizeof(logFilePath), "%s/%s", m_logDirPath, logFileName);
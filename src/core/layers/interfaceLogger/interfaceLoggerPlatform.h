@@ -44,6 +44,7 @@ struct InterfaceLoggerSettings
 {
     char    interfaceLoggerDirectory[512];
     bool    interfaceLoggerMultithreaded;
+    bool    interfaceLoggerBinaryCapture;
     uint32  interfaceLoggerBasePreset;
     uint32  interfaceLoggerElevatedPreset;
 };
@@ -151,7 +152,8 @@ private:
             uint32 threadKeyCreated  :  1; // If m_threadKey was successfully created.
             uint32 multithreaded     :  1; // If multithreaded logging is enabled.
             uint32 settingsCommitted :  1; // If the platform has all of the settings needed to log to a file.
-            uint32 reserved          : 29;
+            uint32 binaryCapture     :  1; // If thread logs are binary captures rather than JSON text.
+            uint32 reserved          : 28;
         };
         uint32     u32All;
     } m_flags;
@@ -146,5 +146,72 @@ Result ShaderCache::Merge(
     return result;
 }
 
+// =====================================================================================================================
+Result ShaderCache::FindPipelineBinary(
+    uint64       compilerHash,
+    const void** ppPipelineBinary,
+    size_t*      pPipelineBinarySize)
+{
+    BeginFuncInfo funcInfo;
+    funcInfo.funcId       = InterfaceFunc::ShaderCacheFindPipelineBinary;
+    funcInfo.objectId     = m_objectId;
+    funcInfo.preCallTime  = m_pPlatform->GetTime();
+    const Result result   = ShaderCacheDecorator::FindPipelineBinary(compilerHash,
+                                                                     ppPipelineBinary,
+                                                                     pPipelineBinarySize);
+    funcInfo.postCallTime = m_pPlatform->GetTime();
+
+    LogContext* pLogContext = nullptr;
+    if (m_pPlatform->LogBeginFunc(funcInfo, &pLogContext))
+    {
+        pLogContext->BeginInput();
+        pLogContext->KeyAndValue("compilerHash", compilerHash);
+        pLogContext->EndInput();
+
+        pLogContext->BeginOutput();
+        pLogContext->KeyAndEnum("result", result);
+
+        if ((result == Result::Success) && (pPipelineBinarySize != nullptr))
+        {
+            pLogContext->KeyAndValue("pipelineBinarySize", *pPipelineBinarySize);
+        }
+        else
+        {
+            pLogContext->KeyAndNullValue("pipelineBinarySize");
+        }
+        pLogContext->EndOutput();
+
+        m_pPlatform->LogEndFunc(pLogContext);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+void ShaderCache::GetStats(
+    ShaderCacheStats* pStats
+    ) const
+{
+    BeginFuncInfo funcInfo;
+    funcInfo.funcId       = InterfaceFunc::ShaderCacheGetStats;
+    funcInfo.objectId     = m_objectId;
+    funcInfo.preCallTime  = m_pPlatform->GetTime();
+    ShaderCacheDecorator::GetStats(pStats);
+    funcInfo.postCallTime = m_pPlatform->GetTime();
+
+    LogContext* pLogContext = nullptr;
+    if (m_pPlatform->LogBeginFunc(funcInfo, &pLogContext))
+    {
+        pLogContext->BeginOutput();
+        pLogContext->KeyAndValue("numEntries",    pStats->numEntries);
+        pLogContext->KeyAndValue("totalDataSize", pStats->totalDataSize);
+        pLogContext->KeyAndValue("numHits",       pStats->numHits);
+        pLogContext->KeyAndValue("numMisses",     pStats->numMisses);
+        pLogContext->EndOutput();
+
+        m_pPlatform->LogEndFunc(pLogContext);
+    }
+}
+
 } // InterfaceLogger
 } // Pal
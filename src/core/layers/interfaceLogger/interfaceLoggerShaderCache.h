@@ -52,6 +52,13 @@ public:
 
     virtual Result Merge(uint32 numSrcCaches, const IShaderCache** ppSrcCaches) override;
 
+    virtual Result FindPipelineBinary(
+        uint64       compilerHash,
+        const void** ppPipelineBinary,
+        size_t*      pPipelineBinarySize) override;
+
+    virtual void GetStats(ShaderCacheStats* pStats) const override;
+
 private:
     virtual ~ShaderCache() { }
 
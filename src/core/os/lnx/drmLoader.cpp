@@ -41,6 +41,10 @@
 #include "palAssert.h"
 #include "palSysUtil.h"
 
+#if PAL_BUILD_DRM_MOCK
+#include "core/os/lnx/drmMock.h"
+#endif // PAL_BUILD_DRM_MOCK
+
 using namespace Util;
 namespace Pal
 {
@@ -1866,6 +1870,18 @@ Result DrmLoader::Init(
         "libdrm.so.2"
     };
 
+#if PAL_BUILD_DRM_MOCK
+    // The mock build never loads the real libraries; every entry point is served by the in-process fake amdgpu.
+    if (m_initialized == false)
+    {
+        DrmMock::InitProcsTable(&m_funcs);
+        m_initialized = true;
+#if defined(PAL_DEBUG_PRINTS)
+        m_proxy.SetFuncCalls(&m_funcs);
+#endif
+    }
+#endif // PAL_BUILD_DRM_MOCK
+
     if (m_initialized == false)
     {
         // resolve symbols from libdrm_amdgpu.so.1
@@ -0,0 +1,1602 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+#include "core/os/lnx/drmMock.h"
+#include "palHashMapImpl.h"
+#include "palInlineFuncs.h"
+#include "palMutex.h"
+#include "palSysMemory.h"
+#include "palSysUtil.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+using namespace Util;
+
+// Upper bound on the ring index of any HW IP the mock tracks a timeline for.
+constexpr uint32 MaxRingsPerIp = 8;
+
+// amdgpu.h only forward declares the libdrm_amdgpu handle types, so the mock is free to give them its own layouts.
+struct amdgpu_device
+{
+    int    fd;
+    uint64 lastCompletionNs;  // Simulated completion time of the latest submission on any of this device's rings.
+};
+
+struct amdgpu_bo
+{
+    amdgpu_device_handle      hDevice;
+    uint64                    size;
+    uint64                    alignment;
+    uint32                    preferredHeap;
+    uint64                    flags;
+    void*                     pCpuAddr;   // Host backing store, allocated on first CPU map unless this is user memory.
+    bool                      isUserMem;
+    uint32                    mapCount;
+    uint64                    gpuVa;
+    uint32                    kmsHandle;
+    struct amdgpu_bo_metadata metadata;
+};
+
+struct amdgpu_bo_list
+{
+    uint32 numEntries;
+};
+
+struct amdgpu_va
+{
+    uint64 base;
+    uint64 size;
+};
+
+// Simulated timeline of one hardware ring as seen from a single context.
+struct MockRing
+{
+    uint64 lastSeqNo;
+    uint64 lastCompletionNs;
+    uint64 pendingWaitNs;     // Latest semaphore the next submission on this ring must wait for.
+};
+
+struct amdgpu_context
+{
+    amdgpu_device_handle hDevice;
+    MockRing             rings[AMDGPU_HW_IP_NUM][MaxRingsPerIp];
+};
+
+struct amdgpu_semaphore
+{
+    uint64 signalNs;
+};
+
+namespace Pal
+{
+namespace Linux
+{
+
+// Every syncobj and exported sync file is represented by the simulated completion time of the fence it holds.
+typedef HashMap<uint32, uint64, GenericAllocator> SyncobjMap;
+typedef HashMap<int32,  uint64, GenericAllocator> SyncFileMap;
+
+constexpr uint32 SyncobjMapBuckets  = 256;
+constexpr uint32 SyncFileMapBuckets = 64;
+
+// The mock pretends to be a 4 SE, 64 CU Vega10 with 8GB of HBM.
+constexpr uint32 MockFamilyId        = 141;      // FAMILY_AI
+constexpr uint32 MockDeviceId        = 0x687F;
+constexpr uint32 MockExternalRev     = 0x01;
+constexpr uint32 MockPciRevId        = 0xC1;
+constexpr uint32 MockGbAddrConfig    = 0x2A114042;
+constexpr uint32 MockNumSe           = 4;
+constexpr uint32 MockNumShPerSe      = 1;
+constexpr uint32 MockNumCuPerSh      = 16;
+constexpr uint32 MockNumRbs          = 16;
+constexpr uint32 MockCounterFreqKhz  = 27000;
+constexpr uint32 MockFragmentSize    = 0x200000;
+constexpr uint64 MockVramSize        = 8ull * 1024 * 1024 * 1024;
+constexpr uint64 MockVisibleVramSize = 256ull * 1024 * 1024;
+constexpr uint64 MockGttSize         = 16ull * 1024 * 1024 * 1024;
+constexpr uint64 MockVaStart         = 0x800000;
+constexpr uint64 MockVaEnd           = 0x800000000000;
+constexpr uint32 MockDrmMajorVersion = 3;
+constexpr uint32 MockDrmMinorVersion = 23;
+
+static char s_mockNodeName[]  = "/dev/null";
+static const char MockBusId[] = "pci:0000:03:00.0";
+
+// All of the mock's global state.  Handles hand out raw pointers, so everything else is protected by one mutex.
+struct DrmMockState
+{
+    DrmMockState()
+        :
+        latencyNs(0),
+        nextVa(MockVaStart),
+        nextKmsHandle(1),
+        nextSyncobj(1),
+        syncobjs(SyncobjMapBuckets, &allocator),
+        syncFiles(SyncFileMapBuckets, &allocator)
+    {
+        memset(&stats, 0, sizeof(stats));
+    }
+
+    GenericAllocator allocator;
+    Mutex            lock;
+    uint64           latencyNs;
+    uint64           nextVa;
+    uint32           nextKmsHandle;
+    uint32           nextSyncobj;
+    SyncobjMap       syncobjs;
+    SyncFileMap      syncFiles;
+    DrmMockStats     stats;
+};
+
+static DrmMockState s_state;
+
+// =====================================================================================================================
+// Returns the current CPU time in nanoseconds; the simulated GPU timeline is expressed in the same units.
+static uint64 NowNs()
+{
+    const uint64 ticks     = static_cast<uint64>(GetPerfCpuTime());
+    const uint64 frequency = static_cast<uint64>(GetPerfFrequency());
+
+    return ((ticks / frequency) * 1000000000ull) + (((ticks % frequency) * 1000000000ull) / frequency);
+}
+
+// =====================================================================================================================
+// Blocks until the simulated timeline reaches completionNs or the timeout expires.  Returns true if the work is done.
+static bool WaitForCompletion(
+    uint64 completionNs,
+    uint64 timeoutNs,
+    bool   isAbsolute)
+{
+    uint64 nowNs = NowNs();
+
+    if ((completionNs > nowNs) && (timeoutNs > 0))
+    {
+        uint64 deadlineNs = timeoutNs;
+        if (isAbsolute == false)
+        {
+            deadlineNs = (timeoutNs > (UINT64_MAX - nowNs)) ? UINT64_MAX : (nowNs + timeoutNs);
+        }
+
+        const uint64 wakeNs = Min(completionNs, deadlineNs);
+        while (nowNs < wakeNs)
+        {
+            struct timespec sleepTime = {};
+            sleepTime.tv_sec  = (wakeNs - nowNs) / 1000000000ull;
+            sleepTime.tv_nsec = (wakeNs - nowNs) % 1000000000ull;
+            nanosleep(&sleepTime, nullptr);
+
+            nowNs = NowNs();
+        }
+    }
+
+    return (completionNs <= nowNs);
+}
+
+// =====================================================================================================================
+// Returns the simulated completion time of a libdrm_amdgpu fence.  Only the latest completion time of each ring is
+// tracked, so older sequence numbers are assumed to have run back-to-back ahead of it.  Idle gaps on the ring make
+// that estimate later than the real completion time, never earlier.  Must be called with the state lock held.
+static uint64 FenceCompletionNs(
+    const struct amdgpu_cs_fence& fence)
+{
+    uint64 completionNs = 0;
+
+    if ((fence.context != nullptr) && (fence.ip_type < AMDGPU_HW_IP_NUM) && (fence.ring < MaxRingsPerIp))
+    {
+        const MockRing& ring = fence.context->rings[fence.ip_type][fence.ring];
+
+        if (fence.fence >= ring.lastSeqNo)
+        {
+            completionNs = ring.lastCompletionNs;
+        }
+        else
+        {
+            const uint64 laterWorkNs = (ring.lastSeqNo - fence.fence) * s_state.latencyNs;
+            completionNs = (ring.lastCompletionNs > laterWorkNs) ? (ring.lastCompletionNs - laterWorkNs) : 0;
+        }
+    }
+
+    return completionNs;
+}
+
+// =====================================================================================================================
+// Places one submission on the simulated timeline of the given ring and returns its sequence number.  The submission
+// starts once the ring is idle and all of its dependencies have completed.  Must be called with the state lock held.
+static uint64 RetireSubmission(
+    amdgpu_context_handle hContext,
+    uint32                ipType,
+    uint32                ring,
+    uint64                dependencyNs,
+    uint32                ibCount,
+    uint64*               pCompletionNs)
+{
+    MockRing*const pRing   = &hContext->rings[ipType][ring];
+    const uint64   startNs = Max(Max(NowNs(), pRing->lastCompletionNs), Max(dependencyNs, pRing->pendingWaitNs));
+
+    pRing->pendingWaitNs    = 0;
+    pRing->lastCompletionNs = startNs + s_state.latencyNs;
+    pRing->lastSeqNo++;
+
+    hContext->hDevice->lastCompletionNs = Max(hContext->hDevice->lastCompletionNs, pRing->lastCompletionNs);
+
+    s_state.stats.submitCount++;
+    s_state.stats.ibCount += ibCount;
+
+    if (pCompletionNs != nullptr)
+    {
+        *pCompletionNs = pRing->lastCompletionNs;
+    }
+
+    return pRing->lastSeqNo;
+}
+
+// =====================================================================================================================
+// Records the fence held by an exported sync file or syncobj fd.  Must be called with the state lock held.
+static int ExportToFd(
+    uint64 completionNs,
+    int*   pFd)
+{
+    int ret = 0;
+    const int fd = open(s_mockNodeName, O_RDONLY | O_CLOEXEC);
+
+    if (fd < 0)
+    {
+        ret = -errno;
+    }
+    else
+    {
+        bool    existed = false;
+        uint64* pValue  = nullptr;
+
+        // The fd number is reused once the client closes it, so overwrite whatever an earlier export left behind.
+        if (s_state.syncFiles.FindAllocate(fd, &existed, &pValue) == Result::Success)
+        {
+            *pValue = completionNs;
+            *pFd    = fd;
+        }
+        else
+        {
+            close(fd);
+            ret = -ENOMEM;
+        }
+    }
+
+    return ret;
+}
+
+// =====================================================================================================================
+// Creates a syncobj holding the given fence.  Must be called with the state lock held.
+static int CreateSyncobj(
+    uint64    completionNs,
+    uint32_t* pSyncObj)
+{
+    int          ret    = -ENOMEM;
+    const uint32 handle = s_state.nextSyncobj++;
+
+    if (s_state.syncobjs.Insert(handle, completionNs) == Result::Success)
+    {
+        *pSyncObj = handle;
+        ret       = 0;
+    }
+
+    return ret;
+}
+
+// =====================================================================================================================
+static int MockDeviceInitialize(
+    int                   fd,
+    uint32_t*             pMajorVersion,
+    uint32_t*             pMinorVersion,
+    amdgpu_device_handle* pDeviceHandle)
+{
+    int ret = -ENOMEM;
+    amdgpu_device_handle hDevice = PAL_NEW(amdgpu_device, &s_state.allocator, AllocInternal);
+
+    if (hDevice != nullptr)
+    {
+        hDevice->fd               = fd;
+        hDevice->lastCompletionNs = 0;
+
+        *pMajorVersion = MockDrmMajorVersion;
+        *pMinorVersion = MockDrmMinorVersion;
+        *pDeviceHandle = hDevice;
+        ret            = 0;
+    }
+
+    return ret;
+}
+
+// =====================================================================================================================
+static int MockDeviceDeinitialize(
+    amdgpu_device_handle hDevice)
+{
+    PAL_DELETE(hDevice, &s_state.allocator);
+    return 0;
+}
+
+// =====================================================================================================================
+static int MockQueryGpuInfo(
+    amdgpu_device_handle    hDevice,
+    struct amdgpu_gpu_info* pInfo)
+{
+    memset(pInfo, 0, sizeof(*pInfo));
+
+    pInfo->asic_id                      = MockDeviceId;
+    pInfo->chip_rev                     = 0;
+    pInfo->chip_external_rev            = MockExternalRev;
+    pInfo->family_id                    = MockFamilyId;
+    pInfo->max_engine_clk               = 1630000;
+    pInfo->max_memory_clk               = 945000;
+    pInfo->num_shader_engines           = MockNumSe;
+    pInfo->num_shader_arrays_per_engine = MockNumShPerSe;
+    pInfo->rb_pipes                     = MockNumRbs;
+    pInfo->enabled_rb_pipes_mask        = (1u << MockNumRbs) - 1;
+    pInfo->gpu_counter_freq             = MockCounterFreqKhz;
+    pInfo->gb_addr_cfg                  = MockGbAddrConfig;
+    pInfo->cu_active_number             = MockNumSe * MockNumShPerSe * MockNumCuPerSh;
+    pInfo->cu_ao_mask                   = 0xFFFFFFFF;
+    pInfo->vram_type                    = AMDGPU_VRAM_TYPE_HBM;
+    pInfo->vram_bit_width               = 2048;
+    pInfo->ce_ram_size                  = 0x8000;
+    pInfo->pci_rev_id                   = MockPciRevId;
+
+    for (uint32 se = 0; se < MockNumSe; ++se)
+    {
+        for (uint32 sh = 0; sh < MockNumShPerSe; ++sh)
+        {
+            pInfo->cu_bitmap[se][sh] = (1u << MockNumCuPerSh) - 1;
+        }
+    }
+
+    return 0;
+}
+
+// =====================================================================================================================
+static int MockQueryInfo(
+    amdgpu_device_handle hDevice,
+    unsigned             infoId,
+    unsigned             size,
+    void*                pValue)
+{
+    int ret = 0;
+
+    switch (infoId)
+    {
+    case AMDGPU_INFO_DEV_INFO:
+    {
+        struct drm_amdgpu_info_device info = {};
+        struct amdgpu_gpu_info        gpuInfo;
+        MockQueryGpuInfo(hDevice, &gpuInfo);
+
+        info.device_id                    = gpuInfo.asic_id;
+        info.chip_rev                     = gpuInfo.chip_rev;
+        info.external_rev                 = gpuInfo.chip_external_rev;
+        info.pci_rev                      = gpuInfo.pci_rev_id;
+        info.family                       = gpuInfo.family_id;
+        info.num_shader_engines           = gpuInfo.num_shader_engines;
+        info.num_shader_arrays_per_engine = gpuInfo.num_shader_arrays_per_engine;
+        info.gpu_counter_freq             = gpuInfo.gpu_counter_freq;
+        info.max_engine_clock             = gpuInfo.max_engine_clk;
+        info.max_memory_clock             = gpuInfo.max_memory_clk;
+        info.cu_active_number             = gpuInfo.cu_active_number;
+        info.enabled_rb_pipes_mask        = gpuInfo.enabled_rb_pipes_mask;
+        info.num_rb_pipes                 = gpuInfo.rb_pipes;
+        info.num_hw_gfx_contexts          = 8;
+        info.virtual_address_offset       = MockVaStart;
+        info.virtual_address_max          = MockVaEnd;
+        info.virtual_address_alignment    = 4096;
+        info.pte_fragment_size            = MockFragmentSize;
+        info.gart_page_size               = 4096;
+        info.ce_ram_size                  = gpuInfo.ce_ram_size;
+        info.vram_type                    = gpuInfo.vram_type;
+        info.vram_bit_width               = gpuInfo.vram_bit_width;
+        info.gc_double_offchip_lds_buf    = 1;
+        info.wave_front_size              = 64;
+        info.num_shader_visible_vgprs     = 256;
+        info.num_cu_per_sh                = MockNumCuPerSh;
+        info.num_tcc_blocks               = 16;
+        info.gs_vgt_table_depth           = 32;
+        info.gs_prim_buffer_depth         = 1792;
+        info.max_gs_waves_per_vgt         = 32;
+        memcpy(&info.cu_bitmap[0][0], &gpuInfo.cu_bitmap[0][0], sizeof(info.cu_bitmap));
+
+        memcpy(pValue, &info, Min<size_t>(size, sizeof(info)));
+        break;
+    }
+    case AMDGPU_INFO_MEMORY:
+    {
+        struct drm_amdgpu_memory_info info = {};
+
+        info.vram.total_heap_size                = MockVramSize;
+        info.vram.usable_heap_size               = MockVramSize;
+        info.vram.max_allocation                 = MockVramSize;
+        info.cpu_accessible_vram.total_heap_size = MockVisibleVramSize;
+        info.cpu_accessible_vram.usable_heap_size = MockVisibleVramSize;
+        info.cpu_accessible_vram.max_allocation  = MockVisibleVramSize;
+        info.gtt.total_heap_size                 = MockGttSize;
+        info.gtt.usable_heap_size                = MockGttSize;
+        info.gtt.max_allocation                  = MockGttSize;
+
+        memcpy(pValue, &info, Min<size_t>(size, sizeof(info)));
+        break;
+    }
+    case AMDGPU_INFO_CAPABILITY:
+        memset(pValue, 0, size);
+        break;
+    case AMDGPU_INFO_TIMESTAMP:
+    {
+        // gpu_counter_freq is reported in KHz.
+        const uint64 timestamp = (NowNs() / 1000000ull) * MockCounterFreqKhz;
+        memcpy(pValue, &timestamp, Min<size_t>(size, sizeof(timestamp)));
+        break;
+    }
+    default:
+        ret = -EINVAL;
+        break;
+    }
+
+    return ret;
+}
+
+// =====================================================================================================================
+static int MockQueryHwIpInfo(
+    amdgpu_device_handle          hDevice,
+    unsigned                      type,
+    unsigned                      ipInstance,
+    struct drm_amdgpu_info_hw_ip* pInfo)
+{
+    int ret = 0;
+
+    memset(pInfo, 0, sizeof(*pInfo));
+    pInfo->ib_start_alignment = 32;
+    pInfo->ib_size_alignment  = 32;
+
+    switch (type)
+    {
+    case AMDGPU_HW_IP_GFX:
+        pInfo->hw_ip_version_major = 9;
+        pInfo->available_rings     = 0x1;
+        break;
+    case AMDGPU_HW_IP_COMPUTE:
+        pInfo->hw_ip_version_major = 9;
+        pInfo->available_rings     = 0xFF;
+        break;
+    case AMDGPU_HW_IP_DMA:
+        pInfo->hw_ip_version_major = 4;
+        pInfo->available_rings     = 0x3;
+        pInfo->ib_size_alignment   = 4;
+        break;
+    default:
+        // Multimedia engines are not simulated.
+        break;
+    }
+
+    return ret;
+}
+
+// =====================================================================================================================
+static int MockQueryHwIpCount(
+    amdgpu_device_handle hDevice,
+    unsigned             type,
+    uint32_t*            pCount)
+{
+    *pCount = ((type == AMDGPU_HW_IP_GFX) || (type == AMDGPU_HW_IP_COMPUTE) || (type == AMDGPU_HW_IP_DMA)) ? 1 : 0;
+    return 0;
+}
+
+// =====================================================================================================================
+static int MockQueryHeapInfo(
+    amdgpu_device_handle     hDevice,
+    uint32_t                 heap,
+    uint32_t                 flags,
+    struct amdgpu_heap_info* pInfo)
+{
+    int ret = 0;
+
+    memset(pInfo, 0, sizeof(*pInfo));
+
+    if (heap == AMDGPU_GEM_DOMAIN_VRAM)
+    {
+        pInfo->heap_size = (flags & AMDGPU_GEM_CREATE_CPU_ACCESS_REQUIRED) ? MockVisibleVramSize : MockVramSize;
+    }
+    else if (heap == AMDGPU_GEM_DOMAIN_GTT)
+    {
+        pInfo->heap_size = MockGttSize;
+    }
+    else
+    {
+        ret = -EINVAL;
+    }
+
+    pInfo->max_allocation = pInfo->heap_size;
+
+    return ret;
+}
+
+// =====================================================================================================================
+static int MockQueryBufferSizeAlignment(
+    amdgpu_device_handle                  hDevice,
+    struct amdgpu_buffer_size_alignments* pInfo)
+{
+    pInfo->size_local  = MockFragmentSize;
+    pInfo->size_remote = 4096;
+    return 0;
+}
+
+// =====================================================================================================================
+static int MockQueryFirmwareVersion(
+    amdgpu_device_handle hDevice,
+    unsigned             fwType,
+    unsigned             ipInstance,
+    unsigned             index,
+    uint32_t*            pVersion,
+    uint32_t*            pFeature)
+{
+    *pVersion = 0x9E;
+    *pFeature = 42;
+    return 0;
+}
+
+// =====================================================================================================================
+static int MockQueryPrivateAperture(
+    amdgpu_device_handle hDevice,
+    uint64_t*            pStartVa,
+    uint64_t*            pEndVa)
+{
+    *pStartVa = 0x1000000000000000ull;
+    *pEndVa   = *pStartVa + 0xFFFFFFFFull;
+    return 0;
+}
+
+// =====================================================================================================================
+static int MockQuerySharedAperture(
+    amdgpu_device_handle hDevice,
+    uint64_t*            pStartVa,
+    uint64_t*            pEndVa)
+{
+    *pStartVa = 0x2000000000000000ull;
+    *pEndVa   = *pStartVa + 0xFFFFFFFFull;
+    return 0;
+}
+
+// =====================================================================================================================
+// There are no registers behind the mock; every read returns zero.
+static int MockReadMmRegisters(
+    amdgpu_device_handle hDevice,
+    unsigned             dwordOffset,
+    unsigned             count,
+    uint32_t             instance,
+    uint32_t             flags,
+    uint32_t*            pValues)
+{
+    memset(pValues, 0, count * sizeof(uint32_t));
+    return 0;
+}
+
+// =====================================================================================================================
+static const char* MockGetMarketingName(
+    amdgpu_device_handle hDevice)
+{
+    return "Radeon RX Vega (DRM mock)";
+}
+
+// =====================================================================================================================
+static int MockVaRangeQuery(
+    amdgpu_device_handle     hDevice,
+    enum amdgpu_gpu_va_range type,
+    uint64_t*                pStart,
+    uint64_t*                pEnd)
+{
+    *pStart = MockVaStart;
+    *pEnd   = MockVaEnd;
+    return 0;
+}
+
+// =====================================================================================================================
+// VA ranges come from a bump allocator which never reuses freed space; the simulated address space is far larger than
+// anything a benchmark run can consume.  Requests for a specific base address are always granted.
+static int MockVaRangeAlloc(
+    amdgpu_device_handle     hDevice,
+    enum amdgpu_gpu_va_range vaRangeType,
+    uint64_t                 size,
+    uint64_t                 vaBaseAlignment,
+    uint64_t                 vaBaseRequired,
+    uint64_t*                pVaAllocated,
+    amdgpu_va_handle*        pVaRange,
+    uint64_t                 flags)
+{
+    int ret = -ENOMEM;
+    amdgpu_va_handle hVaRange = PAL_NEW(amdgpu_va, &s_state.allocator, AllocInternal);
+
+    if (hVaRange != nullptr)
+    {
+        MutexAuto lock(&s_state.lock);
+
+        if (vaBaseRequired != 0)
+        {
+            hVaRange->base = vaBaseRequired;
+        }
+        else
+        {
+            const uint64 alignment = Max<uint64>(vaBaseAlignment, 4096);
+            hVaRange->base = Pow2Align(s_state.nextVa, alignment);
+            s_state.nextVa = hVaRange->base + size;
+        }
+
+        if ((hVaRange->base + size) > MockVaEnd)
+        {
+            PAL_DELETE(hVaRange, &s_state.allocator);
+        }
+        else
+        {
+            hVaRange->size = size;
+            *pVaAllocated  = hVaRange->base;
+            *pVaRange      = hVaRange;
+            ret            = 0;
+        }
+    }
+
+    return ret;
+}
+
+// =====================================================================================================================
+static int MockVaRangeFree(
+    amdgpu_va_handle hVaRange)
+{
+    PAL_DELETE(hVaRange, &s_state.allocator);
+    return 0;
+}
+
+// =====================================================================================================================
+static int MockBoAlloc(
+    amdgpu_device_handle            hDevice,
+    struct amdgpu_bo_alloc_request* pAllocBuffer,
+    amdgpu_bo_handle*               pBufferHandle)
+{
+    int ret = -ENOMEM;
+    amdgpu_bo_handle hBuffer = PAL_NEW(amdgpu_bo, &s_state.allocator, AllocInternal);
+
+    if (hBuffer != nullptr)
+    {
+        memset(hBuffer, 0, sizeof(*hBuffer));
+        hBuffer->hDevice       = hDevice;
+        hBuffer->size          = pAllocBuffer->alloc_size;
+        hBuffer->alignment     = pAllocBuffer->phys_alignment;
+        hBuffer->preferredHeap = pAllocBuffer->preferred_heap;
+        hBuffer->flags         = pAllocBuffer->flags;
+
+        MutexAuto lock(&s_state.lock);
+        hBuffer->kmsHandle = s_state.nextKmsHandle++;
+        s_state.stats.boAllocCount++;
+
+        *pBufferHandle = hBuffer;
+        ret            = 0;
+    }
+
+    return ret;
+}
+
+// =====================================================================================================================
+static int MockCreateBoFromUserMem(
+    amdgpu_device_handle hDevice,
+    void*                pCpuAddress,
+    uint64_t             size,
+    amdgpu_bo_handle*    pBufferHandle)
+{
+    struct amdgpu_bo_alloc_request request = {};
+    request.alloc_size     = size;
+    request.preferred_heap = AMDGPU_GEM_DOMAIN_GTT;
+
+    const int ret = MockBoAlloc(hDevice, &request, pBufferHandle);
+    if (ret == 0)
+    {
+        (*pBufferHandle)->pCpuAddr  = pCpuAddress;
+        (*pBufferHandle)->isUserMem = true;
+    }
+
+    return ret;
+}
+
+// =====================================================================================================================
+static int MockBoFree(
+    amdgpu_bo_handle hBuffer)
+{
+    if ((hBuffer->isUserMem == false) && (hBuffer->pCpuAddr != nullptr))
+    {
+        PAL_FREE(hBuffer->pCpuAddr, &s_state.allocator);
+    }
+
+    PAL_DELETE(hBuffer, &s_state.allocator);
+
+    MutexAuto lock(&s_state.lock);
+    s_state.stats.boFreeCount++;
+
+    return 0;
+}
+
+// =====================================================================================================================
+static int MockBoSetMetadata(
+    amdgpu_bo_handle           hBuffer,
+    struct amdgpu_bo_metadata* pInfo)
+{
+    hBuffer->metadata = *pInfo;
+    return 0;
+}
+
+// =====================================================================================================================
+static int MockBoQueryInfo(
+    amdgpu_bo_handle       hBuffer,
+    struct amdgpu_bo_info* pInfo)
+{
+    pInfo->alloc_size     = hBuffer->size;
+    pInfo->phys_alignment = hBuffer->alignment;
+    pInfo->preferred_heap = hBuffer->preferredHeap;
+    pInfo->alloc_flags    = hBuffer->flags;
+    pInfo->metadata       = hBuffer->metadata;
+    return 0;
+}
+
+// =====================================================================================================================
+// Only KMS handles can be exported; there is no other process or display server to share buffers with.
+static int MockBoExport(
+    amdgpu_bo_handle           hBuffer,
+    enum amdgpu_bo_handle_type type,
+    uint32_t*                  pFd)
+{
+    int ret = -ENOSYS;
+
+    if (type == amdgpu_bo_handle_type_kms)
+    {
+        *pFd = hBuffer->kmsHandle;
+        ret  = 0;
+    }
+
+    return ret;
+}
+
+// =====================================================================================================================
+static int MockBoImport(
+    amdgpu_device_handle            hDevice,
+    enum amdgpu_bo_handle_type      type,
+    uint32_t                        fd,
+    struct amdgpu_bo_import_result* pOutput)
+{
+    return -ENOSYS;
+}
+
+// =====================================================================================================================
+// Host backing store is only allocated on first map so that benchmarks can create large VRAM-only allocations cheaply.
+static int MockBoCpuMap(
+    amdgpu_bo_handle hBuffer,
+    void**           ppCpuAddress)
+{
+    int ret = 0;
+
+    MutexAuto lock(&s_state.lock);
+
+    if (hBuffer->pCpuAddr == nullptr)
+    {
+        hBuffer->pCpuAddr = PAL_CALLOC_ALIGNED(static_cast<size_t>(hBuffer->size),
+                                               4096,
+                                               &s_state.allocator,
+                                               AllocInternal);
+    }
+
+    if (hBuffer->pCpuAddr != nullptr)
+    {
+        hBuffer->mapCount++;
+        s_state.stats.boCpuMapCount++;
+        *ppCpuAddress = hBuffer->pCpuAddr;
+    }
+    else
+    {
+        ret = -ENOMEM;
+    }
+
+    return ret;
+}
+
+// =====================================================================================================================
+// The backing store stays allocated after the last unmap so that its contents survive a remap, just like real memory.
+static int MockBoCpuUnmap(
+    amdgpu_bo_handle hBuffer)
+{
+    int ret = -EINVAL;
+
+    MutexAuto lock(&s_state.lock);
+
+    if (hBuffer->mapCount > 0)
+    {
+        hBuffer->mapCount--;
+        ret = 0;
+    }
+
+    return ret;
+}
+
+// =====================================================================================================================
+// BO lists don't keep their BOs, so a BO counts as busy until everything submitted on its device so far has retired.
+static int MockBoWaitForIdle(
+    amdgpu_bo_handle hBuffer,
+    uint64_t         timeoutInNs,
+    bool*            pBufferBusy)
+{
+    uint64 completionNs = 0;
+    {
+        MutexAuto lock(&s_state.lock);
+        completionNs = hBuffer->hDevice->lastCompletionNs;
+        s_state.stats.fenceQueryCount++;
+    }
+
+    *pBufferBusy = (WaitForCompletion(completionNs, timeoutInNs, false) == false);
+
+    return 0;
+}
+
+// =====================================================================================================================
+static int MockBoVaOp(
+    amdgpu_bo_handle hBuffer,
+    uint64_t         offset,
+    uint64_t         size,
+    uint64_t         address,
+    uint64_t         flags,
+    uint32_t         ops)
+{
+    int ret = 0;
+
+    if (ops == AMDGPU_VA_OP_MAP)
+    {
+        hBuffer->gpuVa = address - offset;
+    }
+    else if (ops == AMDGPU_VA_OP_UNMAP)
+    {
+        hBuffer->gpuVa = 0;
+    }
+    else
+    {
+        ret = -EINVAL;
+    }
+
+    MutexAuto lock(&s_state.lock);
+    s_state.stats.vaOpCount++;
+
+    return ret;
+}
+
+// =====================================================================================================================
+// Unlike amdgpu_bo_va_op(), the raw variant may clear or replace PRT mappings which have no BO.
+static int MockBoVaOpRaw(
+    amdgpu_device_handle hDevice,
+    amdgpu_bo_handle     hBuffer,
+    uint64_t             offset,
+    uint64_t             size,
+    uint64_t             address,
+    uint64_t             flags,
+    uint32_t             ops)
+{
+    int ret = 0;
+
+    if (hBuffer != nullptr)
+    {
+        if ((ops == AMDGPU_VA_OP_MAP) || (ops == AMDGPU_VA_OP_REPLACE))
+        {
+            hBuffer->gpuVa = address - offset;
+        }
+        else if (ops == AMDGPU_VA_OP_UNMAP)
+        {
+            hBuffer->gpuVa = 0;
+        }
+    }
+    else if ((ops != AMDGPU_VA_OP_CLEAR) && (ops != AMDGPU_VA_OP_REPLACE))
+    {
+        ret = -EINVAL;
+    }
+
+    MutexAuto lock(&s_state.lock);
+    s_state.stats.vaOpCount++;
+
+    return ret;
+}
+
+// =====================================================================================================================
+static int MockBoListCreate(
+    amdgpu_device_handle   hDevice,
+    uint32_t               numberOfResources,
+    amdgpu_bo_handle*      pResources,
+    uint8_t*               pResourcePriorities,
+    amdgpu_bo_list_handle* pBoListHandle)
+{
+    int ret = -ENOMEM;
+    amdgpu_bo_list_handle hBoList = PAL_NEW(amdgpu_bo_list, &s_state.allocator, AllocInternal);
+
+    if (hBoList != nullptr)
+    {
+        hBoList->numEntries = numberOfResources;
+
+        MutexAuto lock(&s_state.lock);
+        s_state.stats.boListCreateCount++;
+        s_state.stats.boListEntryCount += numberOfResources;
+
+        *pBoListHandle = hBoList;
+        ret            = 0;
+    }
+
+    return ret;
+}
+
+// =====================================================================================================================
+static int MockBoListDestroy(
+    amdgpu_bo_list_handle hBoList)
+{
+    PAL_DELETE(hBoList, &s_state.allocator);
+    return 0;
+}
+
+// =====================================================================================================================
+static int MockCsCtxCreate(
+    amdgpu_device_handle   hDevice,
+    amdgpu_context_handle* pContextHandle)
+{
+    int ret = -ENOMEM;
+    amdgpu_context_handle hContext = PAL_NEW(amdgpu_context, &s_state.allocator, AllocInternal);
+
+    if (hContext != nullptr)
+    {
+        memset(hContext, 0, sizeof(*hContext));
+        hContext->hDevice = hDevice;
+
+        *pContextHandle = hContext;
+        ret             = 0;
+    }
+
+    return ret;
+}
+
+// =====================================================================================================================
+static int MockCsCtxFree(
+    amdgpu_context_handle hContext)
+{
+    PAL_DELETE(hContext, &s_state.allocator);
+    return 0;
+}
+
+// =====================================================================================================================
+static int MockCsSubmit(
+    amdgpu_context_handle     hContext,
+    uint64_t                  flags,
+    struct amdgpu_cs_request* pIbsRequest,
+    uint32_t                  numberOfRequests)
+{
+    int ret = 0;
+
+    MutexAuto lock(&s_state.lock);
+
+    for (uint32 i = 0; (i < numberOfRequests) && (ret == 0); ++i)
+    {
+        struct amdgpu_cs_request*const pRequest = &pIbsRequest[i];
+
+        if ((pRequest->ip_type >= AMDGPU_HW_IP_NUM) || (pRequest->ring >= MaxRingsPerIp))
+        {
+            ret = -EINVAL;
+        }
+        else
+        {
+            uint64 dependencyNs = 0;
+            for (uint32 dep = 0; dep < pRequest->number_of_dependencies; ++dep)
+            {
+                dependencyNs = Max(dependencyNs, FenceCompletionNs(pRequest->dependencies[dep]));
+            }
+
+            pRequest->seq_no = RetireSubmission(hContext,
+                                                pRequest->ip_type,
+                                                pRequest->ring,
+                                                dependencyNs,
+                                                pRequest->number_of_ibs,
+                                                nullptr);
+        }
+    }
+
+    return ret;
+}
+
+// =====================================================================================================================
+// Walks the chunk list the same way the kernel does: the IB chunks pick the ring, SYNCOBJ_IN chunks delay the start of
+// the submission and SYNCOBJ_OUT chunks receive its fence.
+static int MockCsSubmitRaw(
+    amdgpu_device_handle        hDevice,
+    amdgpu_context_handle       hContext,
+    amdgpu_bo_list_handle       hBuffer,
+    int                         numChunks,
+    struct drm_amdgpu_cs_chunk* pChunks,
+    uint64_t*                   pSeqNo)
+{
+    int    ret          = 0;
+    uint32 ibCount      = 0;
+    uint32 ipType       = AMDGPU_HW_IP_NUM;
+    uint32 ring         = 0;
+    uint64 dependencyNs = 0;
+
+    MutexAuto lock(&s_state.lock);
+
+    for (int32 i = 0; (i < numChunks) && (ret == 0); ++i)
+    {
+        void*const pData = reinterpret_cast<void*>(static_cast<uintptr_t>(pChunks[i].chunk_data));
+
+        if (pChunks[i].chunk_id == AMDGPU_CHUNK_ID_IB)
+        {
+            const auto*const pIb = static_cast<const struct drm_amdgpu_cs_chunk_ib*>(pData);
+            ipType = pIb->ip_type;
+            ring   = pIb->ring;
+            ibCount++;
+        }
+        else if (pChunks[i].chunk_id == AMDGPU_CHUNK_ID_SYNCOBJ_IN)
+        {
+            const auto*const pSems  = static_cast<const struct drm_amdgpu_cs_chunk_sem*>(pData);
+            const uint32     count  = (pChunks[i].length_dw * 4) / sizeof(struct drm_amdgpu_cs_chunk_sem);
+
+            for (uint32 sem = 0; (sem < count) && (ret == 0); ++sem)
+            {
+                const uint64*const pCompletionNs = s_state.syncobjs.FindKey(pSems[sem].handle);
+                if (pCompletionNs != nullptr)
+                {
+                    dependencyNs = Max(dependencyNs, *pCompletionNs);
+                }
+                else
+                {
+                    ret = -ENOENT;
+                }
+            }
+
+            s_state.stats.syncobjWaitCount += count;
+        }
+    }
+
+    if ((ret == 0) && ((ipType >= AMDGPU_HW_IP_NUM) || (ring >= MaxRingsPerIp)))
+    {
+        ret = -EINVAL;
+    }
+
+    if (ret == 0)
+    {
+        uint64 completionNs = 0;
+        *pSeqNo = RetireSubmission(hContext, ipType, ring, dependencyNs, ibCount, &completionNs);
+
+        for (int32 i = 0; i < numChunks; ++i)
+        {
+            if (pChunks[i].chunk_id == AMDGPU_CHUNK_ID_SYNCOBJ_OUT)
+            {
+                const auto*const pSems = reinterpret_cast<const struct drm_amdgpu_cs_chunk_sem*>(
+                                             static_cast<uintptr_t>(pChunks[i].chunk_data));
+                const uint32     count = (pChunks[i].length_dw * 4) / sizeof(struct drm_amdgpu_cs_chunk_sem);
+
+                for (uint32 sem = 0; sem < count; ++sem)
+                {
+                    uint64*const pCompletionNs = s_state.syncobjs.FindKey(pSems[sem].handle);
+                    if (pCompletionNs != nullptr)
+                    {
+                        *pCompletionNs = completionNs;
+                    }
+                }
+
+                s_state.stats.syncobjSignalCount += count;
+            }
+        }
+    }
+
+    return ret;
+}
+
+// =====================================================================================================================
+static int MockCsQueryFenceStatus(
+    struct amdgpu_cs_fence* pFence,
+    uint64_t                timeoutInNs,
+    uint64_t                flags,
+    uint32_t*               pExpired)
+{
+    uint64 completionNs = 0;
+    {
+        MutexAuto lock(&s_state.lock);
+        completionNs = FenceCompletionNs(*pFence);
+        s_state.stats.fenceQueryCount++;
+    }
+
+    const bool isAbsolute = TestAnyFlagSet(flags, AMDGPU_QUERY_FENCE_TIMEOUT_IS_ABSOLUTE);
+    *pExpired = WaitForCompletion(completionNs, timeoutInNs, isAbsolute) ? 1 : 0;
+
+    return 0;
+}
+
+// =====================================================================================================================
+static int MockCsWaitFences(
+    struct amdgpu_cs_fence* pFences,
+    uint32_t                fenceCount,
+    bool                    waitAll,
+    uint64_t                timeoutInNs,
+    uint32_t*               pStatus,
+    uint32_t*               pFirst)
+{
+    uint64 completionNs = waitAll ? 0 : UINT64_MAX;
+    uint32 first        = 0;
+    {
+        MutexAuto lock(&s_state.lock);
+
+        for (uint32 i = 0; i < fenceCount; ++i)
+        {
+            const uint64 fenceCompletionNs = FenceCompletionNs(pFences[i]);
+
+            if (waitAll)
+            {
+                completionNs = Max(completionNs, fenceCompletionNs);
+            }
+            else if (fenceCompletionNs < completionNs)
+            {
+                completionNs = fenceCompletionNs;
+                first        = i;
+            }
+        }
+
+        s_state.stats.fenceQueryCount++;
+    }
+
+    *pStatus = WaitForCompletion(completionNs, timeoutInNs, false) ? 1 : 0;
+
+    if (pFirst != nullptr)
+    {
+        *pFirst = first;
+    }
+
+    return 0;
+}
+
+// =====================================================================================================================
+static int MockCsCreateSemaphore(
+    amdgpu_semaphore_handle* pSemaphore)
+{
+    int ret = -ENOMEM;
+    amdgpu_semaphore_handle hSemaphore = PAL_NEW(amdgpu_semaphore, &s_state.allocator, AllocInternal);
+
+    if (hSemaphore != nullptr)
+    {
+        hSemaphore->signalNs = 0;
+
+        *pSemaphore = hSemaphore;
+        ret         = 0;
+    }
+
+    return ret;
+}
+
+// =====================================================================================================================
+// A signal captures the completion time of the latest submission on the ring.
+static int MockCsSignalSemaphore(
+    amdgpu_context_handle   hContext,
+    uint32_t                ipType,
+    uint32_t                ipInstance,
+    uint32_t                ring,
+    amdgpu_semaphore_handle hSemaphore)
+{
+    int ret = -EINVAL;
+
+    if ((ipType < AMDGPU_HW_IP_NUM) && (ring < MaxRingsPerIp))
+    {
+        MutexAuto lock(&s_state.lock);
+        hSemaphore->signalNs = hContext->rings[ipType][ring].lastCompletionNs;
+        ret = 0;
+    }
+
+    return ret;
+}
+
+// =====================================================================================================================
+// A wait delays the next submission on the ring until the semaphore's fence has completed.
+static int MockCsWaitSemaphore(
+    amdgpu_context_handle   hContext,
+    uint32_t                ipType,
+    uint32_t                ipInstance,
+    uint32_t                ring,
+    amdgpu_semaphore_handle hSemaphore)
+{
+    int ret = -EINVAL;
+
+    if ((ipType < AMDGPU_HW_IP_NUM) && (ring < MaxRingsPerIp))
+    {
+        MutexAuto lock(&s_state.lock);
+        MockRing*const pRing = &hContext->rings[ipType][ring];
+        pRing->pendingWaitNs = Max(pRing->pendingWaitNs, hSemaphore->signalNs);
+        ret = 0;
+    }
+
+    return ret;
+}
+
+// =====================================================================================================================
+static int MockCsDestroySemaphore(
+    amdgpu_semaphore_handle hSemaphore)
+{
+    PAL_DELETE(hSemaphore, &s_state.allocator);
+    return 0;
+}
+
+// =====================================================================================================================
+static int MockCsCreateSyncobj(
+    amdgpu_device_handle hDevice,
+    uint32_t*            pSyncObj)
+{
+    MutexAuto lock(&s_state.lock);
+    return CreateSyncobj(0, pSyncObj);
+}
+
+// =====================================================================================================================
+static int MockCsDestroySyncobj(
+    amdgpu_device_handle hDevice,
+    uint32_t             syncObj)
+{
+    MutexAuto lock(&s_state.lock);
+    return s_state.syncobjs.Erase(syncObj) ? 0 : -ENOENT;
+}
+
+// =====================================================================================================================
+static int MockCsExportSyncobj(
+    amdgpu_device_handle hDevice,
+    uint32_t             syncObj,
+    int*                 pSharedFd)
+{
+    int ret = -ENOENT;
+
+    MutexAuto lock(&s_state.lock);
+
+    const uint64*const pCompletionNs = s_state.syncobjs.FindKey(syncObj);
+    if (pCompletionNs != nullptr)
+    {
+        ret = ExportToFd(*pCompletionNs, pSharedFd);
+    }
+
+    return ret;
+}
+
+// =====================================================================================================================
+// An imported syncobj starts out with the fence the exported one held at export time; later signals of either syncobj
+// are not seen by the other.
+static int MockCsImportSyncobj(
+    amdgpu_device_handle hDevice,
+    int                  sharedFd,
+    uint32_t*            pSyncObj)
+{
+    int ret = -EINVAL;
+
+    MutexAuto lock(&s_state.lock);
+
+    const uint64*const pCompletionNs = s_state.syncFiles.FindKey(sharedFd);
+    if (pCompletionNs != nullptr)
+    {
+        ret = CreateSyncobj(*pCompletionNs, pSyncObj);
+    }
+
+    return ret;
+}
+
+// =====================================================================================================================
+static int MockCsSyncobjExportSyncFile(
+    amdgpu_device_handle hDevice,
+    uint32_t             syncObj,
+    int*                 pSyncFileFd)
+{
+    return MockCsExportSyncobj(hDevice, syncObj, pSyncFileFd);
+}
+
+// =====================================================================================================================
+static int MockCsSyncobjImportSyncFile(
+    amdgpu_device_handle hDevice,
+    uint32_t             syncObj,
+    int                  syncFileFd)
+{
+    int ret = -EINVAL;
+
+    MutexAuto lock(&s_state.lock);
+
+    const uint64*const pFileCompletionNs = s_state.syncFiles.FindKey(syncFileFd);
+    uint64*const       pCompletionNs     = s_state.syncobjs.FindKey(syncObj);
+
+    if ((pFileCompletionNs != nullptr) && (pCompletionNs != nullptr))
+    {
+        *pCompletionNs = *pFileCompletionNs;
+        ret            = 0;
+    }
+
+    return ret;
+}
+
+// =====================================================================================================================
+static int MockDrmSyncobjCreate(
+    int       fd,
+    uint32_t  flags,
+    uint32_t* pHandle)
+{
+    MutexAuto lock(&s_state.lock);
+    return CreateSyncobj(0, pHandle);
+}
+
+// =====================================================================================================================
+// Everything the mock hands to PAL as a DRM device lives in one allocation.
+struct MockDrmDevice
+{
+    drmDevice        device;
+    char*            pNodes[DRM_NODE_MAX];
+    drmPciBusInfo    busInfo;
+    drmPciDeviceInfo deviceInfo;
+};
+
+// =====================================================================================================================
+// Reports a single AMD PCI device whose primary and render nodes both point at /dev/null.
+static int MockDrmGetDevices(
+    drmDevicePtr* pDevices,
+    int           maxDevices)
+{
+    int count = 1;
+
+    if (pDevices != nullptr)
+    {
+        count = 0;
+
+        if (maxDevices > 0)
+        {
+            MockDrmDevice*const pDevice = PAL_NEW(MockDrmDevice, &s_state.allocator, AllocInternal);
+
+            if (pDevice != nullptr)
+            {
+                memset(pDevice, 0, sizeof(*pDevice));
+
+                for (uint32 node = 0; node < DRM_NODE_MAX; ++node)
+                {
+                    pDevice->pNodes[node] = &s_mockNodeName[0];
+                }
+
+                pDevice->busInfo.bus               = 3;
+                pDevice->deviceInfo.vendor_id      = 0x1002;
+                pDevice->deviceInfo.device_id      = MockDeviceId;
+                pDevice->deviceInfo.revision_id    = MockPciRevId;
+                pDevice->device.nodes              = &pDevice->pNodes[0];
+                pDevice->device.available_nodes    = (1 << DRM_NODE_PRIMARY) | (1 << DRM_NODE_RENDER);
+                pDevice->device.bustype            = DRM_BUS_PCI;
+                pDevice->device.businfo.pci        = &pDevice->busInfo;
+                pDevice->device.deviceinfo.pci     = &pDevice->deviceInfo;
+
+                pDevices[0] = &pDevice->device;
+                count       = 1;
+            }
+        }
+    }
+
+    return count;
+}
+
+// =====================================================================================================================
+static void MockDrmFreeDevices(
+    drmDevicePtr* pDevices,
+    int           count)
+{
+    for (int32 i = 0; i < count; ++i)
+    {
+        // The drmDevice is the first member of its MockDrmDevice.
+        MockDrmDevice* pDevice = reinterpret_cast<MockDrmDevice*>(pDevices[i]);
+        PAL_SAFE_DELETE(pDevice, &s_state.allocator);
+        pDevices[i] = nullptr;
+    }
+}
+
+// =====================================================================================================================
+static int MockDrmGetNodeTypeFromFd(
+    int fd)
+{
+    return DRM_NODE_RENDER;
+}
+
+// =====================================================================================================================
+static char* MockDrmGetRenderDeviceNameFromFd(
+    int fd)
+{
+    return &s_mockNodeName[0];
+}
+
+// =====================================================================================================================
+static char* MockDrmGetBusid(
+    int fd)
+{
+    char* pBusId = static_cast<char*>(PAL_MALLOC(sizeof(MockBusId), &s_state.allocator, AllocInternal));
+
+    if (pBusId != nullptr)
+    {
+        memcpy(pBusId, MockBusId, sizeof(MockBusId));
+    }
+
+    return pBusId;
+}
+
+// =====================================================================================================================
+static void MockDrmFreeBusid(
+    const char* pBusId)
+{
+    PAL_FREE(const_cast<char*>(pBusId), &s_state.allocator);
+}
+
+// =====================================================================================================================
+// The mock has no display hardware.
+static drmModeResPtr MockDrmModeGetResources(
+    int fd)
+{
+    return nullptr;
+}
+
+// =====================================================================================================================
+static void MockDrmModeFreeResources(
+    drmModeResPtr ptr)
+{
+}
+
+// =====================================================================================================================
+static drmModeConnectorPtr MockDrmModeGetConnector(
+    int      fd,
+    uint32_t connectorId)
+{
+    return nullptr;
+}
+
+// =====================================================================================================================
+static void MockDrmModeFreeConnector(
+    drmModeConnectorPtr ptr)
+{
+}
+
+// =====================================================================================================================
+static int MockDrmGetCap(
+    int       fd,
+    uint64_t  capability,
+    uint64_t* pValue)
+{
+    *pValue = (capability == DRM_CAP_SYNCOBJ) ? 1 : 0;
+    return 0;
+}
+
+// =====================================================================================================================
+void DrmMock::InitProcsTable(
+    DrmLoaderFuncs* pFuncs)
+{
+    // One time initialization of the global state, shared by every platform in the process.
+    static uint32 s_initialized = 0;
+    if (AtomicCompareAndSwap(&s_initialized, 0, 1) == 0)
+    {
+        Result result = s_state.lock.Init();
+
+        if (result == Result::Success)
+        {
+            result = s_state.syncobjs.Init();
+        }
+
+        if (result == Result::Success)
+        {
+            result = s_state.syncFiles.Init();
+        }
+
+        PAL_ASSERT(result == Result::Success);
+        MemoryBarrier();
+        s_initialized++;
+    }
+    // s_initialized is 2 indicates the one time initialization is finished.
+    while (s_initialized != 2)
+    {
+        YieldThread();
+    }
+
+    // The PAL-specific "sem" and VMID reservation interfaces are left null so their features are reported as missing.
+    memset(pFuncs, 0, sizeof(*pFuncs));
+
+    pFuncs->pfnAmdgpuQueryHwIpInfo            = MockQueryHwIpInfo;
+    pFuncs->pfnAmdgpuBoVaOp                   = MockBoVaOp;
+    pFuncs->pfnAmdgpuBoVaOpRaw                = MockBoVaOpRaw;
+    pFuncs->pfnAmdgpuCsCreateSemaphore        = MockCsCreateSemaphore;
+    pFuncs->pfnAmdgpuCsSignalSemaphore        = MockCsSignalSemaphore;
+    pFuncs->pfnAmdgpuCsWaitSemaphore          = MockCsWaitSemaphore;
+    pFuncs->pfnAmdgpuCsDestroySemaphore       = MockCsDestroySemaphore;
+    pFuncs->pfnAmdgpuGetMarketingName         = MockGetMarketingName;
+    pFuncs->pfnAmdgpuVaRangeFree              = MockVaRangeFree;
+    pFuncs->pfnAmdgpuVaRangeQuery             = MockVaRangeQuery;
+    pFuncs->pfnAmdgpuVaRangeAlloc             = MockVaRangeAlloc;
+    pFuncs->pfnAmdgpuReadMmRegisters          = MockReadMmRegisters;
+    pFuncs->pfnAmdgpuDeviceInitialize         = MockDeviceInitialize;
+    pFuncs->pfnAmdgpuDeviceDeinitialize       = MockDeviceDeinitialize;
+    pFuncs->pfnAmdgpuBoAlloc                  = MockBoAlloc;
+    pFuncs->pfnAmdgpuBoSetMetadata            = MockBoSetMetadata;
+    pFuncs->pfnAmdgpuBoQueryInfo              = MockBoQueryInfo;
+    pFuncs->pfnAmdgpuBoExport                 = MockBoExport;
+    pFuncs->pfnAmdgpuBoImport                 = MockBoImport;
+    pFuncs->pfnAmdgpuCreateBoFromUserMem      = MockCreateBoFromUserMem;
+    pFuncs->pfnAmdgpuBoFree                   = MockBoFree;
+    pFuncs->pfnAmdgpuBoCpuMap                 = MockBoCpuMap;
+    pFuncs->pfnAmdgpuBoCpuUnmap               = MockBoCpuUnmap;
+    pFuncs->pfnAmdgpuBoWaitForIdle            = MockBoWaitForIdle;
+    pFuncs->pfnAmdgpuBoListCreate             = MockBoListCreate;
+    pFuncs->pfnAmdgpuBoListDestroy            = MockBoListDestroy;
+    pFuncs->pfnAmdgpuCsCtxCreate              = MockCsCtxCreate;
+    pFuncs->pfnAmdgpuCsCtxFree                = MockCsCtxFree;
+    pFuncs->pfnAmdgpuCsSubmit                 = MockCsSubmit;
+    pFuncs->pfnAmdgpuCsQueryFenceStatus       = MockCsQueryFenceStatus;
+    pFuncs->pfnAmdgpuCsWaitFences             = MockCsWaitFences;
+    pFuncs->pfnAmdgpuQueryBufferSizeAlignment = MockQueryBufferSizeAlignment;
+    pFuncs->pfnAmdgpuQueryFirmwareVersion     = MockQueryFirmwareVersion;
+    pFuncs->pfnAmdgpuQueryHwIpCount           = MockQueryHwIpCount;
+    pFuncs->pfnAmdgpuQueryHeapInfo            = MockQueryHeapInfo;
+    pFuncs->pfnAmdgpuQueryGpuInfo             = MockQueryGpuInfo;
+    pFuncs->pfnAmdgpuQueryInfo                = MockQueryInfo;
+    pFuncs->pfnAmdgpuQueryPrivateAperture     = MockQueryPrivateAperture;
+    pFuncs->pfnAmdgpuQuerySharedAperture      = MockQuerySharedAperture;
+    pFuncs->pfnAmdgpuCsCreateSyncobj          = MockCsCreateSyncobj;
+    pFuncs->pfnAmdgpuCsDestroySyncobj         = MockCsDestroySyncobj;
+    pFuncs->pfnAmdgpuCsExportSyncobj          = MockCsExportSyncobj;
+    pFuncs->pfnAmdgpuCsImportSyncobj          = MockCsImportSyncobj;
+    pFuncs->pfnAmdgpuCsSubmitRaw              = MockCsSubmitRaw;
+    pFuncs->pfnAmdgpuCsSyncobjImportSyncFile  = MockCsSyncobjImportSyncFile;
+    pFuncs->pfnAmdgpuCsSyncobjExportSyncFile  = MockCsSyncobjExportSyncFile;
+    pFuncs->pfnDrmGetNodeTypeFromFd           = MockDrmGetNodeTypeFromFd;
+    pFuncs->pfnDrmGetRenderDeviceNameFromFd   = MockDrmGetRenderDeviceNameFromFd;
+    pFuncs->pfnDrmGetDevices                  = MockDrmGetDevices;
+    pFuncs->pfnDrmFreeDevices                 = MockDrmFreeDevices;
+    pFuncs->pfnDrmGetBusid                    = MockDrmGetBusid;
+    pFuncs->pfnDrmFreeBusid                   = MockDrmFreeBusid;
+    pFuncs->pfnDrmModeGetResources            = MockDrmModeGetResources;
+    pFuncs->pfnDrmModeFreeResources           = MockDrmModeFreeResources;
+    pFuncs->pfnDrmModeGetConnector            = MockDrmModeGetConnector;
+    pFuncs->pfnDrmModeFreeConnector           = MockDrmModeFreeConnector;
+    pFuncs->pfnDrmGetCap                      = MockDrmGetCap;
+    pFuncs->pfnDrmSyncobjCreate               = MockDrmSyncobjCreate;
+}
+
+// =====================================================================================================================
+void DrmMock::SetSubmitLatency(
+    uint64 latencyInNs)
+{
+    MutexAuto lock(&s_state.lock);
+    s_state.latencyNs = latencyInNs;
+}
+
+// =====================================================================================================================
+void DrmMock::GetStats(
+    DrmMockStats* pStats)
+{
+    MutexAuto lock(&s_state.lock);
+    *pStats = s_state.stats;
+}
+
+// =====================================================================================================================
+void DrmMock::ResetStats()
+{
+    MutexAuto lock(&s_state.lock);
+    memset(&s_state.stats, 0, sizeof(s_state.stats));
+}
+
+} // Linux
+} // Pal
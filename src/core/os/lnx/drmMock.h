@@ -0,0 +1,78 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include "core/os/lnx/drmLoader.h"
+
+namespace Pal
+{
+
+namespace Linux
+{
+
+// Counters accumulated by the mock libdrm_amdgpu backend.  They let a driver-overhead benchmark check how much work
+// each PAL call really pushed down to the kernel interface (e.g. how many BO lists were rebuilt per submit).
+struct DrmMockStats
+{
+    uint64 boAllocCount;          // Number of amdgpu_bo_alloc() and amdgpu_create_bo_from_user_mem() calls.
+    uint64 boFreeCount;           // Number of amdgpu_bo_free() calls.
+    uint64 boCpuMapCount;         // Number of amdgpu_bo_cpu_map() calls.
+    uint64 vaOpCount;             // Number of amdgpu_bo_va_op[_raw]() calls.
+    uint64 boListCreateCount;     // Number of amdgpu_bo_list_create() calls.
+    uint64 boListEntryCount;      // Total number of BOs passed to amdgpu_bo_list_create().
+    uint64 submitCount;           // Number of command submissions, legacy and raw.
+    uint64 ibCount;               // Total number of IBs across all submissions.
+    uint64 syncobjWaitCount;      // Total number of syncobjs waited on by raw submissions.
+    uint64 syncobjSignalCount;    // Total number of syncobjs signaled by raw submissions.
+    uint64 fenceQueryCount;       // Number of fence status queries and waits.
+};
+
+// =====================================================================================================================
+// DrmMock is an in-process stand-in for libdrm_amdgpu and libdrm.  When PAL is built with PAL_BUILD_DRM_MOCK the
+// DrmLoader fills its function table from here instead of dlopen()'ing the real libraries, which lets Linux::Device
+// and Linux::Queue run end-to-end on machines without AMD hardware.
+//
+// The mock reports a single Vega10 GPU whose render node is /dev/null.  Buffer objects are backed by host memory which
+// is only allocated on first CPU map, VA ranges come from a bump allocator and no command buffer is ever executed.
+// Instead, every submission is retired on a simulated per-ring timeline: it completes a fixed latency after the later
+// of its submit time, the completion of the previous submission on that ring and the completion of every syncobj it
+// waits on.  Fences and syncobjs report their status against that timeline.
+class DrmMock
+{
+public:
+    // Fills every entry point the mock implements and leaves the remainder null so that the usual isValid() checks
+    // disable the corresponding features.
+    static void InitProcsTable(DrmLoaderFuncs* pFuncs);
+
+    // Sets the simulated GPU execution time of each submission.  Zero (the default) retires work at submit time.
+    static void SetSubmitLatency(uint64 latencyInNs);
+
+    static void GetStats(DrmMockStats* pStats);
+    static void ResetStats();
+};
+
+} // Linux
+
+} // Pal
@@ -33,7 +33,7 @@
 #include "core/os/lnx/lnxWindowSystem.h"
 #include "core/os/lnx/lnxVamMgr.h"
 #include "palAutoBuffer.h"
-#include "palHashMapImpl.h"
+#include "palConcurrentHashMapImpl.h"
 #include "palInlineFuncs.h"
 #include "palSettingsFileMgrImpl.h"
 #include "palSysMemory.h"
@@ -416,11 +416,6 @@ Result Device::OsEarlyInit()
 {
     Result result = m_globalRefMap.Init();
 
-    if (result == Result::Success)
-    {
-        result = m_globalRefLock.Init();
-    }
-
     if (result == Result::Success)
     {
         result = InitClkInfo();
@@ -2869,23 +2864,12 @@ Result Device::AddGpuMemoryReferences(
 
     if (pQueue == nullptr)
     {
-        {
-            // Queue-list operations need to be protected.
-            MutexAuto lock(&m_queueLock);
-
-            for (auto iter = m_queues.Begin(); iter.IsValid(); iter.Next())
-            {
-                Queue*const pLinuxQueue = static_cast<Queue*>(iter.Get());
-                result = pLinuxQueue->AddGpuMemoryReferences(gpuMemRefCount, pGpuMemoryRefs);
-            }
-        }
-
-        AddToGlobalList(gpuMemRefCount, pGpuMemoryRefs);
+        result = AddToGlobalList(gpuMemRefCount, pGpuMemoryRefs);
     }
     else
     {
         Queue* pLinuxQueue = static_cast<Queue*>(pQueue);
-        result = pLinuxQueue->AddGpuMemoryReferences(gpuMemRefCount, pGpuMemoryRefs);
+        result = pLinuxQueue->AddGpuMemoryReferences(gpuMemRefCount, pGpuMemoryRefs, false);
     }
 
     return result;
@@ -2900,50 +2884,37 @@ Result Device::RemoveGpuMemoryReferences(
 {
     if (pQueue == nullptr)
     {
-        {
-            // Queue-list operations need to be protected.
-            MutexAuto lock(&m_queueLock);
-
-            for (auto iter = m_queues.Begin(); iter.IsValid(); iter.Next())
-            {
-                Queue*const pLinuxQueue = static_cast<Queue*>(iter.Get());
-                pLinuxQueue->RemoveGpuMemoryReferences(gpuMemoryCount, ppGpuMemory);
-            }
-        }
-
         RemoveFromGlobalList(gpuMemoryCount, ppGpuMemory);
     }
     else
     {
         Queue* pLinuxQueue = static_cast<Queue*>(pQueue);
-        pLinuxQueue->RemoveGpuMemoryReferences(gpuMemoryCount, ppGpuMemory);
+        pLinuxQueue->RemoveGpuMemoryReferences(gpuMemoryCount, ppGpuMemory, false);
     }
 
     return Result::Success;
 }
 
 // =====================================================================================================================
-// Adds GPU memory objects to this device's global memory list
-void Device::AddToGlobalList(
+// Adds GPU memory objects to this device's global memory list. Memory which wasn't globally referenced yet is also
+// added to every queue. That is done while holding the memory's shard lock, which orders it against removing the same
+// memory and against AddQueue() copying the shard into a new queue.
+Result Device::AddToGlobalList(
     uint32              gpuMemRefCount,
     const GpuMemoryRef* pGpuMemoryRefs)
 {
-    MutexAuto lock(&m_globalRefLock);
-    Result ret = Result::Success;
-    for (uint32 i = 0; i < gpuMemRefCount; i++)
+    Result result = Result::Success;
+
+    for (uint32 i = 0; (i < gpuMemRefCount) && (result == Result::Success); i++)
     {
         IGpuMemory* pGpuMemory = pGpuMemoryRefs[i].pGpuMemory;
         bool alreadyExists = false;
         uint32* pRefCount = nullptr;
 
-        ret = m_globalRefMap.FindAllocate(pGpuMemory, &alreadyExists, &pRefCount);
-        if (ret != Result::Success)
-        {
-            // Not enough room or some other error, so just abort
-            PAL_ASSERT_ALWAYS();
-            break;
-        }
-        else
+        MemoryRefShardAuto shard(&m_globalRefMap, pGpuMemory);
+        result = shard.GetMap()->FindAllocate(pGpuMemory, &alreadyExists, &pRefCount);
+
+        if (result == Result::Success)
         {
             PAL_ASSERT(pRefCount != nullptr);
             if (alreadyExists)
@@ -2953,28 +2924,62 @@ void Device::AddToGlobalList(
             else
             {
                 (*pRefCount) = 1;
+
+                // Queue-list operations need to be protected.
+                MutexAuto lock(&m_queueLock);
+
+                for (auto iter = m_queues.Begin(); iter.IsValid() && (result == Result::Success); iter.Next())
+                {
+                    Queue*const pLinuxQueue = static_cast<Queue*>(iter.Get());
+                    result = pLinuxQueue->AddGpuMemoryReferences(1, &pGpuMemoryRefs[i], true);
+                }
+
+                if (result != Result::Success)
+                {
+                    // Undo the partial update so that the memory is either referenced by every queue or by none.
+                    for (auto iter = m_queues.Begin(); iter.IsValid(); iter.Next())
+                    {
+                        Queue*const pLinuxQueue = static_cast<Queue*>(iter.Get());
+                        pLinuxQueue->RemoveGpuMemoryReferences(1, &pGpuMemory, true);
+                    }
+
+                    shard.GetMap()->Erase(pGpuMemory);
+                }
             }
         }
     }
+
+    return result;
 }
 
 // =====================================================================================================================
-// Removes GPU memory objects from this device's global memory list
+// Removes GPU memory objects from this device's global memory list. Memory which is no longer globally referenced is
+// also removed from every queue, while holding the memory's shard lock.
 void Device::RemoveFromGlobalList(
     uint32            gpuMemoryCount,
     IGpuMemory*const* ppGpuMemory)
 {
-    MutexAuto lock(&m_globalRefLock);
     for (uint32 i = 0; i < gpuMemoryCount; i++)
     {
         IGpuMemory* pGpuMemory = ppGpuMemory[i];
-        uint32* pRefCount = m_globalRefMap.FindKey(pGpuMemory);
+
+        MemoryRefShardAuto shard(&m_globalRefMap, pGpuMemory);
+        uint32* pRefCount = shard.GetMap()->FindKey(pGpuMemory);
         if (pRefCount != nullptr)
         {
             PAL_ALERT(*pRefCount <= 0);
             if (--(*pRefCount) == 0)
             {
-                m_globalRefMap.Erase(pGpuMemory);
+                shard.GetMap()->Erase(pGpuMemory);
+
+                // Queue-list operations need to be protected.
+                MutexAuto lock(&m_queueLock);
+
+                for (auto iter = m_queues.Begin(); iter.IsValid(); iter.Next())
+                {
+                    Queue*const pLinuxQueue = static_cast<Queue*>(iter.Get());
+                    pLinuxQueue->RemoveGpuMemoryReferences(1, &pGpuMemory, true);
+                }
             }
         }
     }
@@ -2991,19 +2996,21 @@ Result Device::AddQueue(
     // Call the parent function first.
     Result result = Pal::Device::AddQueue(pQueue);
 
-    uint32        numEntries  = 0;
-    GpuMemoryRef* pMemRefList = nullptr;
-
-    if (result == Result::Success)
+    // Then update the new queue with the list of memory already added to this device, one shard at a time. The shard
+    // lock is held until the queue is updated: memory added to or removed from the shard concurrently is also applied
+    // to this queue, and adding globally referenced memory to a queue twice has no effect.
+    for (uint32 shardIdx = 0; (result == Result::Success) && (shardIdx < MemoryRefMap::ShardCount); ++shardIdx)
     {
-        MutexAuto lock(&m_globalRefLock);
+        ConcurrentHashMapShardAuto<MemoryRefMap, RWLock::ReadOnly> shard(&m_globalRefMap, ShardIndexTag(), shardIdx);
 
-        // Then update the new queue with the list of memory already added to this device.
-        numEntries = m_globalRefMap.GetNumEntries();
+        const uint32 numEntries = shard.GetMap()->GetNumEntries();
 
         if (numEntries > 0)
         {
-            pMemRefList = PAL_NEW_ARRAY(GpuMemoryRef, numEntries, m_pPlatform, SystemAllocType::AllocInternalTemp);
+            GpuMemoryRef* pMemRefList = PAL_NEW_ARRAY(GpuMemoryRef,
+                                                      numEntries,
+                                                      m_pPlatform,
+                                                      SystemAllocType::AllocInternalTemp);
 
             if (pMemRefList == nullptr)
             {
@@ -3011,23 +3018,20 @@ Result Device::AddQueue(
             }
             else
             {
-                auto iter = m_globalRefMap.Begin();
+                auto iter = shard.GetMap()->Begin();
                 for (uint32 i = 0; i < numEntries; i++, iter.Next())
                 {
                     pMemRefList[i].flags.u32All = 0;
                     pMemRefList[i].pGpuMemory   = iter.Get()->key;
                 }
+
+                result = static_cast<Queue*>(pQueue)->AddGpuMemoryReferences(numEntries, pMemRefList, true);
             }
-        }
-    }
 
-    if (result == Result::Success)
-    {
-        result = static_cast<Queue*>(pQueue)->AddGpuMemoryReferences(numEntries, pMemRefList);
+            PAL_SAFE_DELETE_ARRAY(pMemRefList, m_pPlatform);
+        }
     }
 
-    PAL_SAFE_DELETE_ARRAY(pMemRefList, m_pPlatform);
-
     return result;
 }
 
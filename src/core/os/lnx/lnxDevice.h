@@ -26,8 +26,8 @@
 
 #include "core/device.h"
 #include "core/os/lnx/lnxHeaders.h"
+#include "palConcurrentHashMap.h"
 #include "palSettingsFileMgr.h"
-#include "palHashMap.h"
 #include "core/os/lnx/drmLoader.h"
 #include "core/os/lnx/lnxPlatform.h"
 namespace Pal
@@ -664,12 +664,15 @@ private:
     // NOTE: There are no API level residency functions on the queue and so references are added/removed by the device.
     //       Only submit-level residency model is supported so we need to populate the device global list to the queue.
     //       Then, at submit time the queue will submit it's own allocation list
-    void RemoveFromGlobalList(uint32 gpuMemoryCount, IGpuMemory*const* ppGpuMemory);
-    void AddToGlobalList(uint32 gpuMemRefCount, const GpuMemoryRef* pGpuMemoryRefs);
-
-    typedef Util::HashMap<IGpuMemory*, uint32, Pal::Platform> MemoryRefMap;
+    void   RemoveFromGlobalList(uint32 gpuMemoryCount, IGpuMemory*const* ppGpuMemory);
+    Result AddToGlobalList(uint32 gpuMemRefCount, const GpuMemoryRef* pGpuMemoryRefs);
+
+    // Memory references are added and removed from many threads at once, so the map is sharded rather than guarded by
+    // a single device-wide lock.  The queues only track whether memory is globally referenced, so they are updated
+    // when an allocation's global reference count goes from zero to one or back, while holding its shard lock.
+    typedef Util::ConcurrentHashMap<IGpuMemory*, uint32, Pal::Platform> MemoryRefMap;
+    typedef Util::ConcurrentHashMapShardAuto<MemoryRefMap, Util::RWLock::ReadWrite> MemoryRefShardAuto;
     MemoryRefMap m_globalRefMap;
-    Util::Mutex  m_globalRefLock;
     static constexpr uint32 MemoryRefMapElements = 2048;
 
     // we have three type of semaphore to support in order to be able to:
@@ -40,6 +40,7 @@
 #include "palAutoBuffer.h"
 #include "palDequeImpl.h"
 #include "palListImpl.h"
+#include "palGrowableHashMapImpl.h"
 #include "palHashMapImpl.h"
 #include "palVectorImpl.h"
 
@@ -50,6 +51,9 @@ namespace Pal
 namespace Linux
 {
 
+// Initial capacity of the per-queue global memory reference set; it grows as needed.
+static constexpr uint32 InitialMemRefMapCapacity = 256;
+
 // =====================================================================================================================
 // Helper function to get the IP type from engine type
 static uint32 GetIpType(
@@ -175,7 +179,9 @@ Queue::Queue(
     m_appMemRefCount(0),
     m_pendingWait(false),
     m_pCmdUploadRing(nullptr),
-    m_memList(pDevice->GetPlatform()),
+    m_memRefMap(InitialMemRefMapCapacity, pDevice->GetPlatform()),
+    m_globalBoList(pDevice->GetPlatform()),
+    m_globalBoOwners(pDevice->GetPlatform()),
     m_numIbs(0),
     m_lastSignaledSyncObject(nullptr),
     m_waitSemList(pDevice->GetPlatform())
@@ -211,13 +217,6 @@ Queue::~Queue()
     {
         static_cast<Device*>(m_pDevice)->DestroySemaphore(m_lastSignaledSyncObject);
     }
-
-    auto memListIterator = m_memList.Begin();
-
-    while ((memListIterator.Get() != nullptr))
-    {
-        m_memList.Erase(&memListIterator);
-    }
 }
 
 // =====================================================================================================================
@@ -240,6 +239,11 @@ Result Queue::Init(
         result = m_memListLock.Init();
     }
 
+    if (result == Result::Success)
+    {
+        result = m_memRefMap.Init();
+    }
+
     // Note that the presence of the command upload ring will be used later to determine if these conditions are true.
     if ((result == Result::Success)                               &&
         (m_device.ChipProperties().ossLevel != OssIpLevel::_None) &&
@@ -320,36 +324,71 @@ Result Queue::Init(
 }
 
 // =====================================================================================================================
-// Adds GPU memory references to the per-queue global list which gets added to the patch/alloc list at submit time.
+// Adds GPU memory references to the per-queue global set which gets added to the patch/alloc list at submit time.
+// References made to this queue alone are counted. References from the device's global list are not: the device only
+// adds memory to its queues when it becomes globally referenced, so adding it again has no effect.
 Result Queue::AddGpuMemoryReferences(
     uint32              gpuMemRefCount,
-    const GpuMemoryRef* pGpuMemoryRefs)
+    const GpuMemoryRef* pGpuMemoryRefs,
+    bool                deviceGlobal)
 {
     Result result = Result::Success;
     RWLockAuto<RWLock::ReadWrite> lock(&m_memListLock);
 
-    for (uint32 idx = 0; idx < gpuMemRefCount; ++idx)
+    for (uint32 idx = 0; (idx < gpuMemRefCount) && (result == Result::Success); ++idx)
     {
-        bool found = false;
-        auto listIterator = m_memList.Begin();
+        IGpuMemory*const pGpuMemory = pGpuMemoryRefs[idx].pGpuMemory;
+        bool             existed    = false;
+        MemRefEntry*     pEntry     = nullptr;
+
+        result = m_memRefMap.FindAllocate(pGpuMemory, &existed, &pEntry);
 
-        while (listIterator.Get() != nullptr)
+        if ((result == Result::Success) && (existed == false))
         {
-            IGpuMemory* pMem = (*listIterator.Get());
+            pEntry->refCount     = 0;
+            pEntry->boIndex      = InvalidBoIndex;
+            pEntry->deviceGlobal = false;
 
-            if (pGpuMemoryRefs[idx].pGpuMemory == pMem)
+            // If VM is always valid, the memory doesn't need to be in the resource list.
+            const GpuMemory*const pLnxGpuMemory = static_cast<GpuMemory*>(pGpuMemory);
+
+            if (pLnxGpuMemory->IsVmAlwaysValid() == false)
             {
-                found = true;
-                break;
-            }
+                result = m_globalBoList.PushBack(pLnxGpuMemory->SurfaceHandle());
+
+                if (result == Result::Success)
+                {
+                    result = m_globalBoOwners.PushBack(pGpuMemory);
 
-            listIterator.Next();
+                    if (result == Result::Success)
+                    {
+                        pEntry->boIndex = m_globalBoOwners.NumElements() - 1;
+                        m_memListDirty  = true;
+                    }
+                    else
+                    {
+                        amdgpu_bo_handle hUnused = nullptr;
+                        m_globalBoList.PopBack(&hUnused);
+                    }
+                }
+
+                if (result != Result::Success)
+                {
+                    m_memRefMap.Erase(pGpuMemory);
+                }
+            }
         }
 
-        if (found == false)
+        if (result == Result::Success)
         {
-            m_memList.PushFront(pGpuMemoryRefs[idx].pGpuMemory);
-            m_memListDirty = true;
+            if (deviceGlobal)
+            {
+                pEntry->deviceGlobal = true;
+            }
+            else
+            {
+                pEntry->refCount++;
+            }
         }
     }
 
@@ -357,33 +396,63 @@ Result Queue::AddGpuMemoryReferences(
 }
 
 // =====================================================================================================================
-// Decrements the GPU memory reference count and if necessary removes it from the per-queue global list.
+// Drops a reference to GPU memory and, once it is neither referenced by this queue nor globally referenced, removes it
+// from the per-queue global set. The last BO handle is moved into the removed one's slot so that m_globalBoList stays
+// dense.
 Result Queue::RemoveGpuMemoryReferences(
     uint32            gpuMemoryCount,
-    IGpuMemory*const* ppGpuMemory)
+    IGpuMemory*const* ppGpuMemory,
+    bool              deviceGlobal)
 {
     Result result = Result::Success;
     RWLockAuto<RWLock::ReadWrite> lock(&m_memListLock);
 
     for (uint32 idx = 0; idx < gpuMemoryCount; ++idx)
     {
-        auto listIterator = m_memList.Begin();
+        MemRefEntry*const pEntry = m_memRefMap.FindKey(ppGpuMemory[idx]);
 
-        while (listIterator.Get() != nullptr)
+        if (pEntry != nullptr)
         {
-            IGpuMemory* pMem = (*listIterator.Get());
-
-            if (ppGpuMemory[idx] == pMem)
+            if (deviceGlobal)
             {
-                // Erase will advance the iterator.
-                m_memList.Erase(&listIterator);
-                m_memListDirty = true;
+                pEntry->deviceGlobal = false;
+            }
+            else if (pEntry->refCount > 0)
+            {
+                pEntry->refCount--;
             }
             else
             {
-                listIterator.Next();
+                // The client removed a queue-specific reference which it never added.
+                PAL_ALERT_ALWAYS();
             }
         }
+
+        if ((pEntry != nullptr) && (pEntry->refCount == 0) && (pEntry->deviceGlobal == false))
+        {
+            const uint32 boIndex = pEntry->boIndex;
+
+            if (boIndex != InvalidBoIndex)
+            {
+                amdgpu_bo_handle hLastBo     = nullptr;
+                IGpuMemory*      pLastMemory = nullptr;
+
+                m_globalBoList.PopBack(&hLastBo);
+                m_globalBoOwners.PopBack(&pLastMemory);
+
+                if (pLastMemory != ppGpuMemory[idx])
+                {
+                    m_globalBoList.At(boIndex)   = hLastBo;
+                    m_globalBoOwners.At(boIndex) = pLastMemory;
+
+                    m_memRefMap.FindKey(pLastMemory)->boIndex = boIndex;
+                }
+
+                m_memListDirty = true;
+            }
+
+            m_memRefMap.Erase(ppGpuMemory[idx]);
+        }
     }
 
     return result;
@@ -1067,39 +1136,43 @@ Result Queue::UpdateResourceList(
                 m_hResourceList = nullptr;
             }
 
-            bool memListDirty = m_memListDirty;
+            // The global memory references are kept in a dense array of BO handles which is updated by
+            // AddGpuMemoryReferences() and RemoveGpuMemoryReferences(), so the resource list is laid out as the
+            // global references, then the internal memory manager's references and then the submission's references.
+            const size_t numGlobalBos    = m_globalBoList.NumElements();
+            bool         memMgrListValid = (pMemMgr->ReferenceWatermark() == m_internalMgrTimestamp);
 
-            // First add all of the global memory references.
+            // First add all of the global memory references. If they haven't been modified since the last submit,
+            // the resources in our UMD-side list (m_pResourceList) are still up to date.
             if (result == Result::Success)
             {
-                // If the global memory references haven't been modified since the last submit,
-                // the resources in our UMD-side list (m_pResourceList) should be up to date.
-                // So, there is no need to re-walk through m_memList.
                 if (m_memListDirty == false)
                 {
                     m_numResourcesInList += m_memListResourcesInList;
                 }
+                else if ((numGlobalBos + (memMgrListValid ? m_memMgrResourcesInList : 0)) > m_resourceListSize)
+                {
+                    result = Result::ErrorTooManyMemoryReferences;
+                }
                 else
                 {
-                    m_memListDirty = false;
-
-                    auto listIterator = m_memList.Begin();
-
-                    while (listIterator.Get() != nullptr)
+                    // If the internal memory manager's references haven't changed they only need to be moved to
+                    // follow the new set of global references instead of being gathered again.
+                    if (memMgrListValid && (numGlobalBos != m_memListResourcesInList))
                     {
-                        const GpuMemory* pGpuMemory = static_cast<GpuMemory*>(*listIterator.Get());
-
-                        result = AppendResourceToList(pGpuMemory);
-                        if (result != Result::_Success)
-                        {
-                            m_memListDirty = true;
-                            break;
-                        }
+                        memmove(&m_pResourceList[numGlobalBos],
+                                &m_pResourceList[m_memListResourcesInList],
+                                sizeof(amdgpu_bo_handle) * m_memMgrResourcesInList);
+                    }
 
-                        listIterator.Next();
+                    if (numGlobalBos > 0)
+                    {
+                        memcpy(m_pResourceList, &m_globalBoList.Front(), sizeof(amdgpu_bo_handle) * numGlobalBos);
                     }
 
-                    m_memListResourcesInList = m_numResourcesInList;
+                    m_numResourcesInList     = numGlobalBos;
+                    m_memListResourcesInList = numGlobalBos;
+                    m_memListDirty           = false;
                 }
             }
 
@@ -1107,16 +1180,12 @@ Result Queue::UpdateResourceList(
             // include things like shader rings as well as UDMA buffer chunks.
             if (result == Result::Success)
             {
-                // If both the references of global memory and internal memory manager's memory haven't been modified
-                // since the last submit, the resources in our UMD-side list (m_pResourceList) should be up to date.
-                // So, there is no need to re-walk through pMemMgr.
-                if ((memListDirty == false) && (pMemMgr->ReferenceWatermark() == m_internalMgrTimestamp))
+                if (memMgrListValid)
                 {
                     m_numResourcesInList += m_memMgrResourcesInList;
                 }
                 else
                 {
-                    m_internalMgrTimestamp = pMemMgr->ReferenceWatermark();
                     auto iter = pMemMgr->GetRefListIter();
                     while ((iter.Get() != nullptr) && (result == Result::_Success))
                     {
@@ -1125,6 +1194,13 @@ Result Queue::UpdateResourceList(
                     }
 
                     m_memMgrResourcesInList = m_numResourcesInList - m_memListResourcesInList;
+
+                    // Only record the watermark once the whole list was gathered, so that a partial list is never
+                    // considered valid by a later submit. The ref list lock keeps the watermark stable meanwhile.
+                    if (result == Result::Success)
+                    {
+                        m_internalMgrTimestamp = pMemMgr->ReferenceWatermark();
+                    }
                 }
             }
 
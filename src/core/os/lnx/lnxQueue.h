@@ -25,7 +25,7 @@
 #pragma once
 #include "core/queue.h"
 #include "core/os/lnx/lnxHeaders.h"
-#include "palList.h"
+#include "palGrowableHashMap.h"
 #include "palVector.h"
 
 // It is a temporary solution while we are waiting for open source promotion.
@@ -107,11 +107,13 @@ public:
     // NOTE: Part of the public IQueue interface.
     Result AddGpuMemoryReferences(
         uint32              gpuMemRefCount,
-        const GpuMemoryRef* pGpuMemoryRefs);
+        const GpuMemoryRef* pGpuMemoryRefs,
+        bool                deviceGlobal);
 
     Result RemoveGpuMemoryReferences(
         uint32            gpuMemoryCount,
-        IGpuMemory*const* ppGpuMemory);
+        IGpuMemory*const* ppGpuMemory,
+        bool              deviceGlobal);
 
     virtual Result RemapVirtualMemoryPages(
         uint32                         rangeCount,
@@ -201,14 +203,28 @@ private:
     amdgpu_bo_list_handle m_hResourceList;
     amdgpu_bo_list_handle m_hDummyResourceList;   // The dummy resource list used by dummy submission.
     Pal::GpuMemory*       m_pDummyGpuMemory;      // The dummy gpu memory used by dummy resource list.
-    bool                  m_memListDirty;         // Indicates m_memList has changed since the last submit.
+    bool                  m_memListDirty;         // Indicates m_globalBoList changed since the last submit.
     Util::RWLock          m_memListLock;          // Protect m_memListLock from muli-thread access.
     uint32                m_internalMgrTimestamp; // Store timestamp of internal memory mgr.
     uint32                m_appMemRefCount;       // Store count of application's submission memory references.
     bool                  m_pendingWait;          // Queue needs a dummy submission between wait and signal.
     CmdUploadRing*        m_pCmdUploadRing;       // Uploads gfxip command streams to a large local memory buffer.
 
-    Util::List<IGpuMemory*, Platform> m_memList;  // List of memory which is referenced by Queue.
+    // Tracks one GPU memory object in the per-queue global memory reference set.
+    struct MemRefEntry
+    {
+        uint32 refCount;      // Number of queue-specific references not yet matched by a removal.
+        uint32 boIndex;       // Index of this memory's BO handle in m_globalBoList, or InvalidBoIndex if it needs none.
+        bool   deviceGlobal;  // The memory is in the device's global reference list.
+    };
+
+    static constexpr uint32 InvalidBoIndex = UINT32_MAX;
+
+    typedef Util::GrowableHashMap<IGpuMemory*, MemRefEntry, Platform> MemRefMap;
+
+    MemRefMap                                    m_memRefMap;      // Set of memory which is referenced by Queue.
+    Util::Vector<amdgpu_bo_handle, 16, Platform> m_globalBoList;   // Dense BO handles of the memory in m_memRefMap.
+    Util::Vector<IGpuMemory*, 16, Platform>      m_globalBoOwners; // Memory which owns each m_globalBoList entry.
 
     // These IBs will be sent to the kernel when SubmitIbs is called.
     uint32                m_numIbs;
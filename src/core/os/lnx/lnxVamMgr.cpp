@@ -24,6 +24,7 @@
 
 #include "core/os/lnx/lnxVamMgr.h"
 #include "core/os/lnx/lnxDevice.h"
+#include "palInlineFuncs.h"
 #include "palSysUtil.h"
 
 using namespace Util;
@@ -221,6 +222,17 @@ Result VamMgr::AssignVirtualAddress(
     Pal::Device*const         pDevice,
     const VirtAddrAssignInfo& vaInfo,
     gpusize*                  pGpuVirtAddr)  // [in/out] In: Zero, or the desired VA. Out: The assigned VA.
+{
+    return AllocVaRange(pDevice->ChooseVaPartition(vaInfo.range), vaInfo.size, vaInfo.alignment, pGpuVirtAddr);
+}
+
+// =====================================================================================================================
+// Reserves a range of GPU virtual address space from the VAM section backing the given partition.
+Result VamMgr::AllocVaRange(
+    VaPartition partition,
+    gpusize     size,
+    gpusize     alignment,
+    gpusize*    pGpuVirtAddr)  // [in/out] In: Zero, or the desired VA. Out: The assigned VA.
 {
     Result result = Result::ErrorInvalidFlags;
 
@@ -228,13 +240,12 @@ Result VamMgr::AssignVirtualAddress(
     VAM_ALLOC_OUTPUT vamAllocOut = { };
 
     vamAllocIn.virtualAddress = *pGpuVirtAddr;
-    vamAllocIn.sizeInBytes    = vaInfo.size;
-    vamAllocIn.alignment      = Max(LowPart(vaInfo.alignment), MinVamAllocAlignment);
+    vamAllocIn.sizeInBytes    = size;
+    vamAllocIn.alignment      = Max(LowPart(alignment), MinVamAllocAlignment);
 
     // VAM takes a 32-bit alignment so the high part needs to be zero.
-    PAL_ASSERT(HighPart(vaInfo.alignment) == 0);
+    PAL_ASSERT(HighPart(alignment) == 0);
 
-    const VaPartition partition = pDevice->ChooseVaPartition(vaInfo.range);
     vamAllocIn.hSection = m_hSection[static_cast<uint32>(partition)];
     PAL_ASSERT(vamAllocIn.hSection != nullptr);
 
@@ -271,23 +282,42 @@ void VamMgr::FreeVirtualAddress(
     Pal::Device*const     pDevice,
     const Pal::GpuMemory& gpuMemory)
 {
-    VAM_FREE_INPUT vamFreeIn = { };
-
-    vamFreeIn.virtualAddress = gpuMemory.Desc().gpuVirtAddr;
-    vamFreeIn.actualSize     = gpuMemory.Desc().size;
+    const gpusize gpuVirtAddr = gpuMemory.Desc().gpuVirtAddr;
+    const gpusize size        = gpuMemory.Desc().size;
+    VaPartition   partition   = VaPartition::Count;
 
     for (uint32 i = 0; i < static_cast<uint32>(VaPartition::Count); ++i)
     {
         const auto& vaRange = pDevice->MemoryProperties().vaRange[i];
 
-        if ((vaRange.baseVirtAddr <= vamFreeIn.virtualAddress) &&
-            ((vaRange.baseVirtAddr + vaRange.size) >= (vamFreeIn.virtualAddress + vamFreeIn.actualSize)))
+        if ((vaRange.baseVirtAddr <= gpuVirtAddr) &&
+            ((vaRange.baseVirtAddr + vaRange.size) >= (gpuVirtAddr + size)))
         {
-            vamFreeIn.hSection = m_hSection[i];
+            partition = static_cast<VaPartition>(i);
             break;
         }
     }
 
+    FreeVaRange(partition, gpuVirtAddr, size);
+}
+
+// =====================================================================================================================
+// Returns a range of GPU virtual address space to the VAM section backing the given partition.
+void VamMgr::FreeVaRange(
+    VaPartition partition,
+    gpusize     gpuVirtAddr,
+    gpusize     size)
+{
+    VAM_FREE_INPUT vamFreeIn = { };
+
+    vamFreeIn.virtualAddress = gpuVirtAddr;
+    vamFreeIn.actualSize     = size;
+
+    if (partition < VaPartition::Count)
+    {
+        vamFreeIn.hSection = m_hSection[static_cast<uint32>(partition)];
+    }
+
     if (VAMFree(m_hVamInstance, &vamFreeIn) != VAM_OK)
     {
         PAL_ASSERT_ALWAYS();
@@ -436,21 +466,54 @@ VAM_RETURNCODE VAM_STDCALL VamMgr::NeedPtbCb()
     return VAM_OK;
 }
 
-Util::Mutex          VamMgrSingleton::s_mutex;
-volatile uint32      VamMgrSingleton::s_refCount    = 0;
-VamMgr               VamMgrSingleton::s_vammgr;
+Util::Mutex                     VamMgrSingleton::s_mutex;
+volatile uint32                 VamMgrSingleton::s_refCount      = 0;
+VamMgr                          VamMgrSingleton::s_vammgr;
+Util::Mutex                     VamMgrSingleton::s_cacheListMutex;
+Util::GenericAllocator          VamMgrSingleton::s_cacheAllocator;
+Util::ThreadLocalKey            VamMgrSingleton::s_cacheKey;
+bool                            VamMgrSingleton::s_cacheKeyValid = false;
+VamMgrSingleton::VaThreadCache* VamMgrSingleton::s_pCacheList    = nullptr;
+VamMgrSingleton::VaDepot        VamMgrSingleton::s_depot[VaCacheSizeClassCount] = { };
+
+// =====================================================================================================================
+// Returns the VA cache size class serving ranges of the given size in the given partition, or VaCacheSizeClassCount if
+// such ranges bypass the per-thread caches.
+static uint32 GetVaCacheSizeClass(
+    VaPartition partition,
+    gpusize     size)
+{
+    uint32 sizeClass = VaCacheSizeClassCount;
+
+    if ((partition == VaPartition::DescriptorTable) &&
+        (size >= VaCacheMinSize)                    &&
+        IsPowerOfTwo(size)                          &&
+        ((size / VaCacheMinSize) < (1ull << VaCacheSizeClassCount)))
+    {
+        sizeClass = Log2(size / VaCacheMinSize);
+    }
+
+    return sizeClass;
+}
 
 // =====================================================================================================================
 // Cleanup global VAM manager when one device is destroyed.
 void VamMgrSingleton::Cleanup()
 {
+    s_cacheListMutex.Lock();
     s_mutex.Lock();
     s_refCount--;
     if (s_refCount == 0)
     {
+        // Every cached range dies with the VAM instance, so the thread caches go with it. Deleting the key also makes
+        // sure no thread-exit destructor can call into PAL once the last device is gone and the library is unloaded.
+        memset(&s_depot[0], 0, sizeof(s_depot));
         s_vammgr.Cleanup(nullptr);
+
+        DestroyAllThreadCaches();
     }
     s_mutex.Unlock();
+    s_cacheListMutex.Unlock();
 }
 
 // =====================================================================================================================
@@ -493,6 +556,7 @@ void VamMgrSingleton::Init(
     if (AtomicCompareAndSwap(&s_initialized, 0, 1) == 0)
     {
         s_mutex.Init();
+        s_cacheListMutex.Init();
         MemoryBarrier();
         s_initialized ++;
     }
@@ -501,6 +565,7 @@ void VamMgrSingleton::Init(
     {
         YieldThread();
     }
+    s_cacheListMutex.Lock();
     s_mutex.Lock();
     s_refCount++;
     if (s_refCount == 1)
@@ -508,20 +573,67 @@ void VamMgrSingleton::Init(
         AmdgpuVaRangeAlloc pfnAlloc = drmFuncs.pfnAmdgpuVaRangeAlloc;
         AmdgpuVaRangeFree  pfnFree  = drmFuncs.pfnAmdgpuVaRangeFree;
         s_vammgr.EarlyInit(pfnAlloc, pfnFree);
+
+        // A freshly created key holds null in every thread, so caches left over from an earlier VAM instance can't be
+        // seen. The thread caches are simply bypassed if the key can't be created.
+        s_cacheKeyValid = (CreateThreadLocalKey(&s_cacheKey, &DestroyThreadCache) == Result::Success);
     }
     s_mutex.Unlock();
+    s_cacheListMutex.Unlock();
 }
 
 // =====================================================================================================================
-// Thread safe VA allocate function.
+// Thread safe VA allocate function. Small power-of-two descriptor table ranges are served from the calling thread's
+// magazines; everything else goes straight to the VAM under s_mutex.
 Result VamMgrSingleton::AssignVirtualAddress(
     Pal::Device*const              pDevice,
     const Pal::VirtAddrAssignInfo& vaInfo,
     gpusize*                       pGpuVirtAddr)
 {
-    s_mutex.Lock();
-    Result result = s_vammgr.AssignVirtualAddress(pDevice, vaInfo, pGpuVirtAddr);
-    s_mutex.Unlock();
+    Result         result    = Result::ErrorOutOfGpuMemory;
+    const uint32   sizeClass = GetVaCacheSizeClass(pDevice->ChooseVaPartition(vaInfo.range), vaInfo.size);
+    VaThreadCache* pCache    = nullptr;
+
+    if ((*pGpuVirtAddr == 0) && (sizeClass < VaCacheSizeClassCount) && (vaInfo.alignment <= vaInfo.size))
+    {
+        pCache = GetThreadCache();
+    }
+
+    if (pCache != nullptr)
+    {
+        MutexAuto        cacheLock(&pCache->lock);
+        VaMagazine*const pMagazine = &pCache->magazines[sizeClass];
+
+        if (pMagazine->count == 0)
+        {
+            RefillMagazine(sizeClass, pMagazine);
+        }
+
+        if (pMagazine->count > 0)
+        {
+            pMagazine->count--;
+            (*pGpuVirtAddr) = pMagazine->gpuVirtAddr[pMagazine->count];
+            result          = Result::Success;
+        }
+    }
+    else
+    {
+        s_mutex.Lock();
+        result = s_vammgr.AssignVirtualAddress(pDevice, vaInfo, pGpuVirtAddr);
+        s_mutex.Unlock();
+
+        if ((result != Result::Success) && (*pGpuVirtAddr != 0))
+        {
+            // The requested address may be sitting in the depot or in any thread's magazines. Hand all of them back
+            // to the VAM and try again. s_mutex has to be dropped first to respect the lock order.
+            ReturnCachedRangesToVam();
+
+            s_mutex.Lock();
+            result = s_vammgr.AssignVirtualAddress(pDevice, vaInfo, pGpuVirtAddr);
+            s_mutex.Unlock();
+        }
+    }
+
     return result;
 }
 
@@ -531,9 +643,278 @@ void VamMgrSingleton::FreeVirtualAddress(
     Pal::Device*const     pDevice,
     const Pal::GpuMemory& gpuMemory)
 {
-    s_mutex.Lock();
-    s_vammgr.FreeVirtualAddress(pDevice, gpuMemory);
-    s_mutex.Unlock();
+    const GpuMemoryDesc& desc      = gpuMemory.Desc();
+    const uint32         sizeClass = GetVaCacheSizeClass(pDevice->ChooseVaPartition(gpuMemory.VirtAddrRange()),
+                                                         desc.size);
+    VaThreadCache*       pCache    = nullptr;
+
+    // Only size-aligned ranges can be recycled, since a cached range may be handed out for any alignment up to its
+    // size.
+    if ((sizeClass < VaCacheSizeClassCount) && IsPow2Aligned(desc.gpuVirtAddr, desc.size))
+    {
+        pCache = GetThreadCache();
+    }
+
+    if (pCache != nullptr)
+    {
+        MutexAuto        cacheLock(&pCache->lock);
+        VaMagazine*const pMagazine = &pCache->magazines[sizeClass];
+
+        if (pMagazine->count == VaMagazineSize)
+        {
+            FlushMagazine(sizeClass, pMagazine, VaMagazineBatch);
+        }
+
+        pMagazine->gpuVirtAddr[pMagazine->count] = desc.gpuVirtAddr;
+        pMagazine->count++;
+    }
+    else
+    {
+        s_mutex.Lock();
+        s_vammgr.FreeVirtualAddress(pDevice, gpuMemory);
+        s_mutex.Unlock();
+    }
+}
+
+// =====================================================================================================================
+// Returns the calling thread's VA cache, creating it on first use. Returns null if the cache can't be used, in which
+// case the caller must fall back to the locked VAM path.
+//
+// VAs are only assigned and freed on behalf of a live device, which holds a reference on the singleton, so the key
+// can't be created or deleted underneath this function.
+VamMgrSingleton::VaThreadCache* VamMgrSingleton::GetThreadCache()
+{
+    VaThreadCache* pCache = nullptr;
+
+    if (s_cacheKeyValid)
+    {
+        pCache = static_cast<VaThreadCache*>(GetThreadLocalValue(s_cacheKey));
+
+        if (pCache == nullptr)
+        {
+            pCache = PAL_NEW(VaThreadCache, &s_cacheAllocator, AllocInternal);
+
+            if ((pCache != nullptr) && (pCache->lock.Init() != Result::Success))
+            {
+                PAL_SAFE_DELETE(pCache, &s_cacheAllocator);
+            }
+
+            if (pCache != nullptr)
+            {
+                memset(&pCache->magazines[0], 0, sizeof(pCache->magazines));
+
+                MutexAuto listLock(&s_cacheListMutex);
+
+                pCache->pPrev = nullptr;
+                pCache->pNext = s_pCacheList;
+                if (s_pCacheList != nullptr)
+                {
+                    s_pCacheList->pPrev = pCache;
+                }
+                s_pCacheList = pCache;
+
+                if (SetThreadLocalValue(s_cacheKey, pCache) != Result::Success)
+                {
+                    UnlinkThreadCache(pCache);
+                    PAL_SAFE_DELETE(pCache, &s_cacheAllocator);
+                }
+            }
+        }
+    }
+
+    return pCache;
+}
+
+// =====================================================================================================================
+// Removes a thread cache from s_pCacheList. s_cacheListMutex must be held.
+void VamMgrSingleton::UnlinkThreadCache(
+    VaThreadCache* pCache)
+{
+    if (pCache->pPrev != nullptr)
+    {
+        pCache->pPrev->pNext = pCache->pNext;
+    }
+    else
+    {
+        s_pCacheList = pCache->pNext;
+    }
+
+    if (pCache->pNext != nullptr)
+    {
+        pCache->pNext->pPrev = pCache->pPrev;
+    }
+
+    pCache->pPrev = nullptr;
+    pCache->pNext = nullptr;
+}
+
+// =====================================================================================================================
+// Fills up to half of an empty magazine, first from the depot and then from the VAM.
+void VamMgrSingleton::RefillMagazine(
+    uint32      sizeClass,
+    VaMagazine* pMagazine)
+{
+    const gpusize size   = VaCacheMinSize << sizeClass;
+    VaDepot*const pDepot = &s_depot[sizeClass];
+
+    MutexAuto lock(&s_mutex);
+
+    while ((pMagazine->count < VaMagazineBatch) && (pDepot->count > 0))
+    {
+        pDepot->count--;
+        pMagazine->gpuVirtAddr[pMagazine->count] = pDepot->gpuVirtAddr[pDepot->count];
+        pMagazine->count++;
+    }
+
+    while (pMagazine->count < VaMagazineBatch)
+    {
+        gpusize gpuVirtAddr = 0;
+
+        if (s_vammgr.AllocVaRange(VaPartition::DescriptorTable, size, size, &gpuVirtAddr) != Result::Success)
+        {
+            break;
+        }
+
+        pMagazine->gpuVirtAddr[pMagazine->count] = gpuVirtAddr;
+        pMagazine->count++;
+    }
+}
+
+// =====================================================================================================================
+// Moves the top count ranges of a magazine to the depot.
+void VamMgrSingleton::FlushMagazine(
+    uint32      sizeClass,
+    VaMagazine* pMagazine,
+    uint32      count)
+{
+    PAL_ASSERT(count <= pMagazine->count);
+
+    MutexAuto lock(&s_mutex);
+
+    pMagazine->count -= count;
+    ReleaseRanges(sizeClass, &pMagazine->gpuVirtAddr[pMagazine->count], count);
+}
+
+// =====================================================================================================================
+// Pushes cached ranges onto the depot, returning whatever doesn't fit to the VAM. s_mutex must be held.
+void VamMgrSingleton::ReleaseRanges(
+    uint32         sizeClass,
+    const gpusize* pGpuVirtAddr,
+    uint32         count)
+{
+    const gpusize size   = VaCacheMinSize << sizeClass;
+    VaDepot*const pDepot = &s_depot[sizeClass];
+
+    for (uint32 i = 0; i < count; ++i)
+    {
+        if (pDepot->count < VaDepotSize)
+        {
+            pDepot->gpuVirtAddr[pDepot->count] = pGpuVirtAddr[i];
+            pDepot->count++;
+        }
+        else
+        {
+            s_vammgr.FreeVaRange(VaPartition::DescriptorTable, pGpuVirtAddr[i], size);
+        }
+    }
+}
+
+// =====================================================================================================================
+// Frees every range held by the depot and by every thread's magazines back to the VAM. Must be called without
+// s_mutex or any thread cache lock held.
+void VamMgrSingleton::ReturnCachedRangesToVam()
+{
+    MutexAuto listLock(&s_cacheListMutex);
+
+    for (VaThreadCache* pCache = s_pCacheList; pCache != nullptr; pCache = pCache->pNext)
+    {
+        MutexAuto cacheLock(&pCache->lock);
+        MutexAuto lock(&s_mutex);
+
+        for (uint32 sizeClass = 0; sizeClass < VaCacheSizeClassCount; ++sizeClass)
+        {
+            const gpusize    size      = VaCacheMinSize << sizeClass;
+            VaMagazine*const pMagazine = &pCache->magazines[sizeClass];
+
+            for (uint32 i = 0; i < pMagazine->count; ++i)
+            {
+                s_vammgr.FreeVaRange(VaPartition::DescriptorTable, pMagazine->gpuVirtAddr[i], size);
+            }
+            pMagazine->count = 0;
+        }
+    }
+
+    MutexAuto lock(&s_mutex);
+
+    for (uint32 sizeClass = 0; sizeClass < VaCacheSizeClassCount; ++sizeClass)
+    {
+        const gpusize size   = VaCacheMinSize << sizeClass;
+        VaDepot*const pDepot = &s_depot[sizeClass];
+
+        for (uint32 i = 0; i < pDepot->count; ++i)
+        {
+            s_vammgr.FreeVaRange(VaPartition::DescriptorTable, pDepot->gpuVirtAddr[i], size);
+        }
+        pDepot->count = 0;
+    }
+}
+
+// =====================================================================================================================
+// Thread-local destructor for VA caches: runs when a thread exits and hands its ranges back to the depot.
+void VamMgrSingleton::DestroyThreadCache(
+    void* pCache)
+{
+    VaThreadCache*const pThreadCache = static_cast<VaThreadCache*>(pCache);
+    bool                isListed     = false;
+
+    s_cacheListMutex.Lock();
+
+    // The thread may be exiting while the last device is destroyed, in which case Cleanup() has already freed the
+    // cache along with everything else.
+    for (const VaThreadCache* pIter = s_pCacheList; pIter != nullptr; pIter = pIter->pNext)
+    {
+        if (pIter == pThreadCache)
+        {
+            isListed = true;
+            break;
+        }
+    }
+
+    if (isListed)
+    {
+        UnlinkThreadCache(pThreadCache);
+
+        s_mutex.Lock();
+        for (uint32 sizeClass = 0; sizeClass < VaCacheSizeClassCount; ++sizeClass)
+        {
+            const VaMagazine& magazine = pThreadCache->magazines[sizeClass];
+            ReleaseRanges(sizeClass, &magazine.gpuVirtAddr[0], magazine.count);
+        }
+        s_mutex.Unlock();
+
+        PAL_DELETE(pThreadCache, &s_cacheAllocator);
+    }
+
+    s_cacheListMutex.Unlock();
+}
+
+// =====================================================================================================================
+// Frees every thread cache without returning its ranges and deletes the thread-local key. Called when the VAM is torn
+// down; s_cacheListMutex and s_mutex must be held.
+void VamMgrSingleton::DestroyAllThreadCaches()
+{
+    while (s_pCacheList != nullptr)
+    {
+        VaThreadCache* pCache = s_pCacheList;
+        UnlinkThreadCache(pCache);
+        PAL_DELETE(pCache, &s_cacheAllocator);
+    }
+
+    if (s_cacheKeyValid)
+    {
+        DeleteThreadLocalKey(s_cacheKey);
+        s_cacheKeyValid = false;
+    }
 }
 
 } // Linux
@@ -27,6 +27,8 @@
 #include "core/vamMgr.h"
 #include "core/os/lnx/lnxPlatform.h"
 #include "palMutex.h"
+#include "palSysMemory.h"
+#include "palThread.h"
 
 namespace Pal
 {
@@ -77,6 +79,18 @@ public:
         uint32       partIndex,
         VaRangeInfo* pVaRange);
     virtual bool IsAllocated() { return m_allocated; }
+
+    Result AllocVaRange(
+        VaPartition partition,
+        gpusize     size,
+        gpusize     alignment,
+        gpusize*    pGpuVirtAddr);
+
+    void FreeVaRange(
+        VaPartition partition,
+        gpusize     gpuVirtAddr,
+        gpusize     size);
+
 protected:
     void*  AllocPageTableBlock(VAM_VIRTUAL_ADDRESS ptbBaseVirtAddr);
     void   FreePageTableBlock(VAM_PTB_HANDLE hPtbAlloc);
@@ -111,11 +125,26 @@ protected:
     PAL_DISALLOW_COPY_AND_ASSIGN(VamMgr);
 };
 
+// Descriptor table VA ranges with one of these power-of-two sizes are recycled through per-thread caches.
+constexpr gpusize VaCacheMinSize        = 4 * 1024;
+constexpr uint32  VaCacheSizeClassCount = 5;          // 4KB, 8KB, 16KB, 32KB and 64KB.
+constexpr uint32  VaMagazineSize        = 32;         // Ranges held by one thread for one size class.
+constexpr uint32  VaMagazineBatch       = VaMagazineSize / 2;
+constexpr uint32  VaDepotSize           = 8 * VaMagazineSize;
+
 // =====================================================================================================================
 // VamMgrSingleton is a global container of VamMgr.
 // All Pal devices must share VAs, otherwise the VAs will be used up in the beginning
 // since each device will allocate two dedicated VAs for descriptor and shadow descriptor.
 // VamMgrSingleton keeps one global VamMgr instance, manage its life cycle and provide thread-safe access.
+//
+// Small descriptor table allocations are served from per-thread magazines of pre-reserved VA ranges, one per size
+// class.  Each thread's magazines are guarded by their own lock, which is only contended when a fixed-VA allocation
+// reclaims cached ranges.  Empty magazines are refilled in batches from a global depot (or VAM when the depot runs dry)
+// and full ones spill half their ranges back, so s_mutex is taken once per VaMagazineBatch allocations or frees
+// instead of once per call.  A thread's magazines go back to the depot when it exits.  When the last device goes away,
+// every thread cache is freed along with the VAM and the thread-local key is deleted, so no thread-exit destructor
+// can run after PAL is unloaded.
 class VamMgrSingleton
 {
 public:
@@ -135,9 +164,46 @@ public:
         const Pal::GpuMemory& gpuMemory);
 
 private:
-    static Util::Mutex        s_mutex;
-    static volatile uint32    s_refCount;
-    static VamMgr             s_vammgr;
+    struct VaMagazine
+    {
+        uint32  count;
+        gpusize gpuVirtAddr[VaMagazineSize];
+    };
+
+    struct VaThreadCache
+    {
+        Util::Mutex    lock;     // Serializes the owning thread with reclaims by other threads.
+        VaThreadCache* pPrev;    // Links all thread caches together in s_pCacheList.
+        VaThreadCache* pNext;
+        VaMagazine     magazines[VaCacheSizeClassCount];
+    };
+
+    struct VaDepot
+    {
+        uint32  count;
+        gpusize gpuVirtAddr[VaDepotSize];
+    };
+
+    static VaThreadCache* GetThreadCache();
+    static void RefillMagazine(uint32 sizeClass, VaMagazine* pMagazine);
+    static void FlushMagazine(uint32 sizeClass, VaMagazine* pMagazine, uint32 count);
+    static void ReleaseRanges(uint32 sizeClass, const gpusize* pGpuVirtAddr, uint32 count);
+    static void ReturnCachedRangesToVam();
+    static void UnlinkThreadCache(VaThreadCache* pCache);
+    static void DestroyThreadCache(void* pCache);
+    static void DestroyAllThreadCaches();
+
+    // Locks are always taken in this order: s_cacheListMutex, then a VaThreadCache's lock, then s_mutex.
+    static Util::Mutex            s_mutex;          // Protects s_vammgr, s_refCount and s_depot.
+    static volatile uint32        s_refCount;
+    static VamMgr                 s_vammgr;
+
+    static Util::Mutex            s_cacheListMutex; // Protects s_pCacheList, s_cacheKey and s_cacheKeyValid.
+    static Util::GenericAllocator s_cacheAllocator;
+    static Util::ThreadLocalKey   s_cacheKey;       // Only exists while at least one device does.
+    static bool                   s_cacheKeyValid;
+    static VaThreadCache*         s_pCacheList;
+    static VaDepot                s_depot[VaCacheSizeClassCount];
 };
 
 } // Linux
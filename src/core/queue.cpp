@@ -23,6 +23,7 @@
  ******************************************************************************/
 
 #include "core/cmdBuffer.h"
+#include "core/cmdBufDumpWriter.h"
 #include "core/fence.h"
 #include "core/cmdStream.h"
 #include "core/device.h"
@@ -34,6 +35,8 @@
 #include "core/queueContext.h"
 #include "core/queueSemaphore.h"
 #include "core/swapChain.h"
+#include "core/hw/gfxip/gfxDevice.h"
+#include "core/hw/gfxip/pipelineUploadRing.h"
 #include "core/hw/ossip/ossDevice.h"
 #include "palDequeImpl.h"
 
@@ -94,7 +97,11 @@ Queue::Queue(
     m_queuePriority(QueuePriority::Low),
     m_persistentCeRamOffset(0),
     m_persistentCeRamSize(0),
-    m_pDevOverlayCmdBufferDeque(nullptr)
+    m_pDevOverlayCmdBufferDeque(nullptr),
+    m_pipelineUploadToken(0)
+#if PAL_ENABLE_PRINTS_ASSERTS
+    , m_pCmdBufDumpWriter(nullptr)
+#endif
 {
     if (m_pDevice->Settings().ifhGpuMask & (0x1 << m_pDevice->ChipProperties().gpuIndex))
     {
@@ -167,6 +174,11 @@ void Queue::Destroy()
     // NOTE: If there are still outstanding batched commands for this Queue, something has gone very wrong!
     PAL_ASSERT(m_batchedCmds.NumElements() == 0);
 
+#if PAL_ENABLE_PRINTS_ASSERTS
+    // Destroying the writer flushes any dumps which are still in flight.
+    PAL_SAFE_DELETE(m_pCmdBufDumpWriter, m_pDevice->GetPlatform());
+#endif
+
     if (m_pDevOverlayCmdBufferDeque != nullptr)
     {
         while (m_pDevOverlayCmdBufferDeque->NumElements() > 0)
@@ -296,6 +308,18 @@ Result Queue::Init(
         result = (m_pDevOverlayCmdBufferDeque != nullptr) ? Result::Success : Result::ErrorOutOfMemory;
     }
 
+#if PAL_ENABLE_PRINTS_ASSERTS
+    const auto& settings = m_pDevice->Settings();
+
+    if ((result == Result::Success)                                                    &&
+        (settings.submitTimeCmdBufDumpMode != CmdBufDumpMode::CmdBufDumpModeDisabled) &&
+        (settings.recordTimeCmdBufDumpMode == false)                                   &&
+        settings.submitTimeCmdBufDumpAsync)
+    {
+        CreateCmdBufDumpWriter();
+    }
+#endif
+
     return result;
 }
 
@@ -309,6 +333,24 @@ Result Queue::SubmitInternal(
 
     InternalSubmitInfo internalSubmitInfo = {};
 
+#if PAL_BUILD_GFX
+    GfxDevice*const pGfxDevice = m_pDevice->GetGfxDevice();
+
+    if ((postBatching == false)  &&
+        (pGfxDevice != nullptr)  &&
+        ((m_type == QueueTypeUniversal) || (m_type == QueueTypeCompute)))
+    {
+        // Any pipeline bound by these command buffers was created before this submit, so waiting for all pipeline
+        // uploads issued so far is sufficient.  Batched submits have already done this when they were enqueued.
+        PipelineUploadRing*const pUploadRing = pGfxDevice->GetPipelineUploadRing();
+
+        if (pUploadRing != nullptr)
+        {
+            result = pUploadRing->SyncQueue(this, &m_pipelineUploadToken);
+        }
+    }
+#endif
+
     for (uint32 idx = 0; (idx < submitInfo.cmdBufferCount) && (result == Result::Success); ++idx)
     {
         // Pre-process the command buffers before submission.
@@ -378,6 +420,45 @@ Result Queue::SubmitInternal(
 }
 
 #if PAL_ENABLE_PRINTS_ASSERTS
+// =====================================================================================================================
+// Creates the background writer which streams this Queue's submit-time command buffer dumps into a single container
+// file. On failure we simply fall back to writing one file per submission.
+void Queue::CreateCmdBufDumpWriter()
+{
+    const auto& settings  = m_pDevice->Settings();
+    Platform*   pPlatform = m_pDevice->GetPlatform();
+
+    constexpr uint32 MaxFilenameLength = 512;
+    char filename[MaxFilenameLength] = {};
+
+    // Add queue type and this pointer to file name to make name unique since there could be multiple queues/engines.
+    Snprintf(filename, MaxFilenameLength, "%s/CmdBufDump_%u_%p.pcbd", &settings.cmdBufDumpDirectory[0], m_type, this);
+
+    CmdBufDumpContainerHeader header = {};
+    header.asicFamily  = m_pDevice->ChipProperties().familyId;
+    header.deviceId    = m_pDevice->ChipProperties().deviceId;
+    header.queueType   = m_type;
+    header.engineType  = m_engineType;
+    header.engineIndex = m_engineId;
+    header.dumpMode    = static_cast<uint32>(settings.submitTimeCmdBufDumpMode);
+
+    m_pCmdBufDumpWriter = PAL_NEW(CmdBufDumpWriter, pPlatform, AllocInternal)(pPlatform);
+
+    Result result = (m_pCmdBufDumpWriter != nullptr) ? Result::Success : Result::ErrorOutOfMemory;
+
+    if (result == Result::Success)
+    {
+        result = m_pCmdBufDumpWriter->Init(filename, header);
+    }
+
+    if (result != Result::Success)
+    {
+        PAL_SAFE_DELETE(m_pCmdBufDumpWriter, pPlatform);
+    }
+
+    PAL_ALERT(result != Result::Success);
+}
+
 // =====================================================================================================================
 // Dumps a set of command buffers submitted on this Queue.
 void Queue::DumpCmdToFile(
@@ -405,14 +486,6 @@ void Queue::DumpCmdToFile(
         (settings.recordTimeCmdBufDumpMode == false)         &&
         (cmdBufDumpEnabled))
     {
-        const char* pLogDir = &settings.cmdBufDumpDirectory[0];
-
-        // Maximum length of a filename allowed for command buffer dumps, seems more reasonable than 32
-        constexpr uint32 MaxFilenameLength = 512;
-
-        char filename[MaxFilenameLength] = {};
-        File logFile;
-
         // Multiple submissions of one frame
         if (m_lastFrameCnt == frameCnt)
         {
@@ -424,116 +497,161 @@ void Queue::DumpCmdToFile(
             m_submitIdPerFrame = 0;
         }
 
-        // Add queue type and this pointer to file name to make name unique since there could be multiple queues/engines
-        // and/or multiple vitual queues (on the same engine on) which command buffers are submitted
-        Snprintf(filename, MaxFilenameLength, "%s/Frame_%u_%p_%u_%04u%s",
-                 pLogDir,
-                 m_type,
-                 this,
-                 frameCnt,
-                 m_submitIdPerFrame,
-                 pSuffix[settings.submitTimeCmdBufDumpMode]);
-
         m_lastFrameCnt = frameCnt;
 
-        if (dumpMode == CmdBufDumpMode::CmdBufDumpModeText)
+        CmdBufDumpBuffer* pDumpBuffer = nullptr;
+
+        if (m_pCmdBufDumpWriter != nullptr)
         {
-            logFile.Open(&filename[0], FileAccessMode::FileAccessWrite);
+            pDumpBuffer = m_pCmdBufDumpWriter->BeginRecord(frameCnt, m_submitIdPerFrame);
         }
-        else if ((dumpMode == CmdBufDumpMode::CmdBufDumpModeBinary) ||
-                 (dumpMode == CmdBufDumpMode::CmdBufDumpModeBinaryHeaders))
+
+        if (pDumpBuffer != nullptr)
         {
-            logFile.Open(&filename[0], FileAccessMode::FileAccessWrite | FileAccessMode::FileAccessBinary);
+            // Only copy the commands into memory here; compression and file I/O happen on the writer's thread.
+            CmdBufDumpStream dumpStream(m_pDevice->GetPlatform(), pDumpBuffer);
+            DumpCmdToStream(&dumpStream, submitInfo, internalSubmitInfo);
 
-            if (dumpMode == CmdBufDumpMode::CmdBufDumpModeBinaryHeaders)
-            {
-                const CmdBufferDumpFileHeader fileHeader =
-                {
-                    static_cast<uint32>(sizeof(CmdBufferDumpFileHeader)), // Structure size
-                    1,                                                    // Header version
-                    m_pDevice->ChipProperties().familyId,                 // ASIC family
-                    m_pDevice->ChipProperties().deviceId,                 // Reserved, but use for PCI device ID
-                    0                                                     // Reserved
-                };
-                logFile.Write(&fileHeader, sizeof(fileHeader));
-            }
+            m_pCmdBufDumpWriter->EndRecord();
+        }
+        else
+        {
+            const char* pLogDir = &settings.cmdBufDumpDirectory[0];
 
-            CmdBufferListHeader listHeader =
-            {
-                static_cast<uint32>(sizeof(CmdBufferListHeader)),   // Structure size
-                EngineId(),                                         // Engine index
-                0                                                   // Number of command buffer chunks
-            };
+            // Maximum length of a filename allowed for command buffer dumps, seems more reasonable than 32
+            constexpr uint32 MaxFilenameLength = 512;
 
-            for (uint32 idxCmdBuf = 0; idxCmdBuf < submitInfo.cmdBufferCount; ++idxCmdBuf)
-            {
-                const auto*const pCmdBuffer = static_cast<CmdBuffer*>(submitInfo.ppCmdBuffers[idxCmdBuf]);
+            char filename[MaxFilenameLength] = {};
+            File logFile;
 
-                for (uint32 idxStream = 0; idxStream < pCmdBuffer->NumCmdStreams(); ++idxStream)
-                {
-                    listHeader.count += pCmdBuffer->GetCmdStream(idxStream)->GetNumChunks();
-                }
-            }
+            // Add queue type and this pointer to file name to make name unique since there could be multiple
+            // queues/engines and/or multiple vitual queues (on the same engine on) which command buffers are submitted
+            Snprintf(filename, MaxFilenameLength, "%s/Frame_%u_%p_%u_%04u%s",
+                     pLogDir,
+                     m_type,
+                     this,
+                     frameCnt,
+                     m_submitIdPerFrame,
+                     pSuffix[settings.submitTimeCmdBufDumpMode]);
 
-            for (uint32 idx = 0; idx < internalSubmitInfo.numPreambleCmdStreams; ++idx)
+            if (dumpMode == CmdBufDumpMode::CmdBufDumpModeText)
             {
-                PAL_ASSERT(internalSubmitInfo.pPreambleCmdStream[idx] != nullptr);
-                listHeader.count += internalSubmitInfo.pPreambleCmdStream[idx]->GetNumChunks();
+                logFile.Open(&filename[0], FileAccessMode::FileAccessWrite);
             }
-
-            for (uint32 idx = 0; idx < internalSubmitInfo.numPostambleCmdStreams; ++idx)
+            else
             {
-                PAL_ASSERT(internalSubmitInfo.pPostambleCmdStream[idx] != nullptr);
-                listHeader.count += internalSubmitInfo.pPostambleCmdStream[idx]->GetNumChunks();
+                logFile.Open(&filename[0], FileAccessMode::FileAccessWrite | FileAccessMode::FileAccessBinary);
             }
 
-            logFile.Write(&listHeader, sizeof(listHeader));
+            CmdBufDumpStream dumpStream(&logFile);
+            DumpCmdToStream(&dumpStream, submitInfo, internalSubmitInfo);
         }
-        else
+    }
+}
+
+// =====================================================================================================================
+// Writes the dump of a set of command buffers submitted on this Queue to the given stream, in the format selected by
+// the submitTimeCmdBufDumpMode setting.
+void Queue::DumpCmdToStream(
+    CmdBufDumpStream*         pStream,
+    const SubmitInfo&         submitInfo,
+    const InternalSubmitInfo& internalSubmitInfo
+    ) const
+{
+    const auto&          settings = m_pDevice->Settings();
+    const CmdBufDumpMode dumpMode = settings.submitTimeCmdBufDumpMode;
+
+    if ((dumpMode == CmdBufDumpMode::CmdBufDumpModeBinary) ||
+        (dumpMode == CmdBufDumpMode::CmdBufDumpModeBinaryHeaders))
+    {
+        if (dumpMode == CmdBufDumpMode::CmdBufDumpModeBinaryHeaders)
         {
-            // If we get here, dumping is enabled, but it's not one of the modes listed above.
-            // Perhaps someone added a new mode?
-            PAL_ASSERT_ALWAYS();
+            const CmdBufferDumpFileHeader fileHeader =
+            {
+                static_cast<uint32>(sizeof(CmdBufferDumpFileHeader)), // Structure size
+                1,                                                    // Header version
+                m_pDevice->ChipProperties().familyId,                 // ASIC family
+                m_pDevice->ChipProperties().deviceId,                 // Reserved, but use for PCI device ID
+                0                                                     // Reserved
+            };
+            pStream->Write(&fileHeader, sizeof(fileHeader));
         }
 
-        const char* QueueTypeStrings[] =
+        CmdBufferListHeader listHeader =
         {
-            "# Universal Queue - QueueContext Command length = ",
-            "# Compute Queue - QueueContext Command length = ",
-            "# DMA Queue - QueueContext Command length = ",
-            "",
-#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 303
-#else
-            "# Encode Queue - QueueContext Command length = ",
-            "# Decode Queue - QueueContext Command length = ",
-#endif
+            static_cast<uint32>(sizeof(CmdBufferListHeader)),   // Structure size
+            EngineId(),                                         // Engine index
+            0                                                   // Number of command buffer chunks
         };
 
-        static_assert(
-            (sizeof(QueueTypeStrings) / sizeof(QueueTypeStrings[0])) == static_cast<size_t>(QueueTypeCount),
-            "Mismatch between QueueTypeStrings array size and QueueTypeCount");
-
-        for (uint32 idx = 0; idx < internalSubmitInfo.numPreambleCmdStreams; ++idx)
+        for (uint32 idxCmdBuf = 0; idxCmdBuf < submitInfo.cmdBufferCount; ++idxCmdBuf)
         {
-            PAL_ASSERT(internalSubmitInfo.pPreambleCmdStream[idx] != nullptr);
-            internalSubmitInfo.pPreambleCmdStream[idx]->DumpCommands(&logFile,
-                                                                     QueueTypeStrings[m_type],
-                                                                     dumpMode);
+            const auto*const pCmdBuffer = static_cast<CmdBuffer*>(submitInfo.ppCmdBuffers[idxCmdBuf]);
+
+            for (uint32 idxStream = 0; idxStream < pCmdBuffer->NumCmdStreams(); ++idxStream)
+            {
+                listHeader.count += pCmdBuffer->GetCmdStream(idxStream)->GetNumChunks();
+            }
         }
 
-        for (uint32 idxCmdBuf = 0; idxCmdBuf < submitInfo.cmdBufferCount; ++idxCmdBuf)
+        for (uint32 idx = 0; idx < internalSubmitInfo.numPreambleCmdStreams; ++idx)
         {
-            const auto*const pCmdBuffer = static_cast<CmdBuffer*>(submitInfo.ppCmdBuffers[idxCmdBuf]);
-            pCmdBuffer->DumpCmdStreamsToFile(&logFile, settings.submitTimeCmdBufDumpMode);
+            PAL_ASSERT(internalSubmitInfo.pPreambleCmdStream[idx] != nullptr);
+            listHeader.count += internalSubmitInfo.pPreambleCmdStream[idx]->GetNumChunks();
         }
 
         for (uint32 idx = 0; idx < internalSubmitInfo.numPostambleCmdStreams; ++idx)
         {
             PAL_ASSERT(internalSubmitInfo.pPostambleCmdStream[idx] != nullptr);
-            internalSubmitInfo.pPostambleCmdStream[idx]->DumpCommands(&logFile,
-                                                                      QueueTypeStrings[m_type],
-                                                                      dumpMode);
+            listHeader.count += internalSubmitInfo.pPostambleCmdStream[idx]->GetNumChunks();
         }
+
+        pStream->Write(&listHeader, sizeof(listHeader));
+    }
+    else if (dumpMode != CmdBufDumpMode::CmdBufDumpModeText)
+    {
+        // If we get here, dumping is enabled, but it's not one of the modes listed above.
+        // Perhaps someone added a new mode?
+        PAL_ASSERT_ALWAYS();
+    }
+
+    const char* QueueTypeStrings[] =
+    {
+        "# Universal Queue - QueueContext Command length = ",
+        "# Compute Queue - QueueContext Command length = ",
+        "# DMA Queue - QueueContext Command length = ",
+        "",
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 303
+#else
+        "# Encode Queue - QueueContext Command length = ",
+        "# Decode Queue - QueueContext Command length = ",
+#endif
+    };
+
+    static_assert(
+        (sizeof(QueueTypeStrings) / sizeof(QueueTypeStrings[0])) == static_cast<size_t>(QueueTypeCount),
+        "Mismatch between QueueTypeStrings array size and QueueTypeCount");
+
+    for (uint32 idx = 0; idx < internalSubmitInfo.numPreambleCmdStreams; ++idx)
+    {
+        PAL_ASSERT(internalSubmitInfo.pPreambleCmdStream[idx] != nullptr);
+        internalSubmitInfo.pPreambleCmdStream[idx]->DumpCommands(pStream,
+                                                                 QueueTypeStrings[m_type],
+                                                                 dumpMode);
+    }
+
+    for (uint32 idxCmdBuf = 0; idxCmdBuf < submitInfo.cmdBufferCount; ++idxCmdBuf)
+    {
+        const auto*const pCmdBuffer = static_cast<CmdBuffer*>(submitInfo.ppCmdBuffers[idxCmdBuf]);
+        pCmdBuffer->DumpCmdStreamsToFile(pStream, dumpMode);
+    }
+
+    for (uint32 idx = 0; idx < internalSubmitInfo.numPostambleCmdStreams; ++idx)
+    {
+        PAL_ASSERT(internalSubmitInfo.pPostambleCmdStream[idx] != nullptr);
+        internalSubmitInfo.pPostambleCmdStream[idx]->DumpCommands(pStream,
+                                                                  QueueTypeStrings[m_type],
+                                                                  dumpMode);
     }
 }
 #endif
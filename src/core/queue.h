@@ -33,6 +33,8 @@
 namespace Pal
 {
 
+class CmdBufDumpStream;
+class CmdBufDumpWriter;
 class CmdBuffer;
 class CmdStream;
 class Device;
@@ -352,6 +354,11 @@ private:
     void DumpCmdToFile(
         const SubmitInfo&         submitInfo,
         const InternalSubmitInfo& internalSubmitInfo);
+    void DumpCmdToStream(
+        CmdBufDumpStream*         pStream,
+        const SubmitInfo&         submitInfo,
+        const InternalSubmitInfo& internalSubmitInfo) const;
+    void CreateCmdBufDumpWriter();
 #endif
 
     Result CreateTrackedCmdBuffer(TrackedCmdBuffer** ppTrackedCmdBuffer);
@@ -387,6 +394,14 @@ private:
     typedef Util::Deque<TrackedCmdBuffer*, Platform> TrackedCmdBufferDeque;
     TrackedCmdBufferDeque* m_pDevOverlayCmdBufferDeque;
 
+    uint64  m_pipelineUploadToken;         // Most recent pipeline upload batch this Queue has waited for.
+
+#if PAL_ENABLE_PRINTS_ASSERTS
+    // Writes this Queue's submit-time command buffer dumps on a background thread. Only created if asynchronous
+    // submit-time dumping is enabled.
+    CmdBufDumpWriter*  m_pCmdBufDumpWriter;
+#endif
+
     PAL_DISALLOW_DEFAULT_CTOR(Queue);
     PAL_DISALLOW_COPY_AND_ASSIGN(Queue);
 };
@@ -100,6 +100,58 @@ static const uint32 SqttTokenMaskAll     = 0xFFFF; // Collect all tokens
 static const uint32 SqttTokenMaskNoInst  = 0xC3FF; // Collect all tokens except for instruction related tokens
 static const uint32 SqttTokenMaskMinimal = 0x81A7; // Collect a minimal set of tokens (timestamps + events)
 
+// =====================================================================================================================
+// An RgpStream implementation that gathers the RGP file into a single client-provided buffer, as expected by
+// GetResults().  When no buffer is provided it only measures the file.
+class BufferRgpStream : public RgpStream
+{
+public:
+    BufferRgpStream(
+        void*  pBuffer,
+        size_t bufferSize)
+        :
+        m_pBuffer(pBuffer),
+        m_bufferSize(bufferSize),
+        m_sizeInBytes(0),
+        m_result(Result::Success)
+    {}
+    virtual ~BufferRgpStream() {}
+
+    virtual Result Write(
+        const void* pData,
+        size_t      sizeInBytes) override
+    {
+        if ((m_pBuffer != nullptr) && (m_result == Result::Success))
+        {
+            if ((m_sizeInBytes + sizeInBytes) > m_bufferSize)
+            {
+                m_result = Result::ErrorInvalidMemorySize;
+            }
+            else
+            {
+                memcpy(Util::VoidPtrInc(m_pBuffer, m_sizeInBytes), pData, sizeInBytes);
+            }
+        }
+
+        // Running out of space isn't reported to the writer so that it keeps measuring the rest of the file.
+        m_sizeInBytes += sizeInBytes;
+
+        return Result::Success;
+    }
+
+    size_t GetSize() const { return m_sizeInBytes; }
+    Result GetResult() const { return m_result; }
+
+private:
+    void*const   m_pBuffer;
+    const size_t m_bufferSize;
+    size_t       m_sizeInBytes;
+    Result       m_result;
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(BufferRgpStream);
+    PAL_DISALLOW_DEFAULT_CTOR(BufferRgpStream);
+};
+
 // =====================================================================================================================
 // Helper function to fill in the SqttFileChunkCpuInfo struct based on the hardware in the current system.
 // Required for writing RGP files.
@@ -1547,6 +1599,45 @@ Result GpaSession::GetResults(
     return result;
 }
 
+// =====================================================================================================================
+// Streams the results of a trace sample to pStream in the RGP file format.  Only valid for sessions in the _ready_
+// state.
+Result GpaSession::WriteRgpResults(
+    uint32     sampleId,
+    RgpStream* pStream
+    ) const
+{
+    PAL_ASSERT(m_sessionState == GpaSessionState::Complete);
+
+    Result result = Result::Success;
+
+    const SampleItem* pSampleItem = m_sampleItemArray.At(sampleId);
+
+    if (pStream == nullptr)
+    {
+        result = Result::ErrorInvalidPointer;
+    }
+    else if (pSampleItem->sampleConfig.type != GpaSampleType::Trace)
+    {
+        result = Result::Unsupported;
+    }
+    else
+    {
+        TraceSample* pTraceSample = static_cast<TraceSample*>(pSampleItem->pPerfSample);
+
+        if (pTraceSample->GetThreadTraceBufferSize() > 0)
+        {
+            result = WriteRgpData(pTraceSample->GetThreadTraceLayout(), pTraceSample->GetPerfExpResults(), pStream);
+        }
+        else
+        {
+            result = Result::Unsupported;
+        }
+    }
+
+    return result;
+}
+
 // =====================================================================================================================
 // Moves the session to the _reset_ state, marking all sessions resources as unused and available for reuse when
 // the session is re-built.
@@ -2754,18 +2845,41 @@ Result GpaSession::DumpRgpData(
     void*               pRgpOutput,
     size_t*             pTraceSize
     ) const
+{
+    // If pRgpOutput is null this only measures the file. Otherwise, it keeps measuring after running out of space so
+    // the caller still learns the required size.
+    BufferRgpStream stream(pRgpOutput, *pTraceSize);
+
+    Result result = WriteRgpData(pThreadTraceLayout, pResults, &stream);
+
+    if (result == Result::Success)
+    {
+        result = stream.GetResult();
+    }
+
+    *pTraceSize = stream.GetSize();
+
+    return result;
+}
+
+// =====================================================================================================================
+// Writes SQ thread trace data in rgp format to pStream, one chunk at a time in file order.
+Result GpaSession::WriteRgpData(
+    const ThreadTraceLayout* pThreadTraceLayout,
+    const void*              pResults,
+    RgpStream*               pStream
+    ) const
 {
     // Some of the calculations performed below depend on the assumed position of some fields in the chunk headers
     // defined in sqtt_file_format.h. TODO: Remove after some form of versioning is in place.
     static_assert((sizeof(SqttFileChunkHeader) == 16U) && (sizeof(SqttFileChunkIsaDatabase) == 28U),
-        "The sizes of the chunk parameters in sqtt_file_format has been changed. Update GpaSession::DumRgpData.");
+        "The sizes of the chunk parameters in sqtt_file_format has been changed. Update GpaSession::WriteRgpData.");
 
     Result result = Result::Success;
 
     uint32 curFileOffset = 0;
 
     SqttFileHeader fileHeader   = {};
-    SqttFileHeader* pFileHeader = &fileHeader;
     fileHeader.magicNumber      = SQTT_FILE_MAGIC_NUMBER;
     fileHeader.versionMajor     = 1;
     fileHeader.versionMinor     = 0;
@@ -2788,79 +2902,48 @@ Result GpaSession::DumpRgpData(
     fileHeader.dayInYear         = time.tm_yday;
     fileHeader.isDaylightSavings = time.tm_isdst;
 
-    if (pRgpOutput != nullptr)
-    {
-        if (static_cast<size_t>(curFileOffset + sizeof(fileHeader)) > *pTraceSize)
-        {
-            result = Result::ErrorInvalidMemorySize;
-        }
-        else
-        {
-            memcpy(pRgpOutput, pFileHeader, sizeof(fileHeader));
-        }
-    }
+    result = pStream->Write(&fileHeader, sizeof(fileHeader));
     curFileOffset += sizeof(fileHeader);
 
     // Get cpu info for rgp dump
-    SqttFileChunkCpuInfo cpuInfo = {};
-    FillSqttCpuInfo(&cpuInfo);
-
-    if ((result == Result::Success) && (pRgpOutput != nullptr))
+    if (result == Result::Success)
     {
-        if (static_cast<size_t>(curFileOffset + sizeof(cpuInfo)) > *pTraceSize)
-        {
-            result = Result::ErrorInvalidMemorySize;
-        }
-        else
-        {
-            memcpy(Util::VoidPtrInc(pRgpOutput, static_cast<size_t>(curFileOffset)), &cpuInfo, sizeof(cpuInfo));
-        }
+        SqttFileChunkCpuInfo cpuInfo = {};
+        FillSqttCpuInfo(&cpuInfo);
+
+        result = pStream->Write(&cpuInfo, sizeof(cpuInfo));
+        curFileOffset += sizeof(cpuInfo);
     }
-    curFileOffset += sizeof(cpuInfo);
 
     // Get gpu info for rgp dump
-    SqttFileChunkAsicInfo gpuInfo = {};
-    FillSqttAsicInfo(m_deviceProps, m_perfExperimentProps, m_lastGpuClocksSample, &gpuInfo);
-
-    if ((result == Result::Success) && (pRgpOutput != nullptr))
+    if (result == Result::Success)
     {
-        if (static_cast<size_t>(curFileOffset + sizeof(gpuInfo)) > *pTraceSize)
-        {
-            result = Result::ErrorInvalidMemorySize;
-        }
-        else
-        {
-            memcpy(Util::VoidPtrInc(pRgpOutput, static_cast<size_t>(curFileOffset)), &gpuInfo, sizeof(gpuInfo));
-        }
+        SqttFileChunkAsicInfo gpuInfo = {};
+        FillSqttAsicInfo(m_deviceProps, m_perfExperimentProps, m_lastGpuClocksSample, &gpuInfo);
+
+        result = pStream->Write(&gpuInfo, sizeof(gpuInfo));
+        curFileOffset += sizeof(gpuInfo);
     }
-    curFileOffset += sizeof(gpuInfo);
 
     // Get api info for rgp dump
-    SqttFileChunkApiInfo apiInfo = {};
-    apiInfo.header.chunkIdentifier.chunkType  = SQTT_FILE_CHUNK_TYPE_API_INFO;
-    apiInfo.header.chunkIdentifier.chunkIndex = 0;
-    apiInfo.header.version = 0;
-    apiInfo.header.sizeInBytes = sizeof(apiInfo);
-    apiInfo.apiType = SQTT_API_TYPE_VULKAN;
-    apiInfo.versionMajor = m_apiMajorVer;
-    apiInfo.versionMinor = m_apiMinorVer;
-
-    if ((result == Result::Success) && (pRgpOutput != nullptr))
+    if (result == Result::Success)
     {
-        if (static_cast<size_t>(curFileOffset + sizeof(apiInfo)) > *pTraceSize)
-        {
-            result = Result::ErrorInvalidMemorySize;
-        }
-        else
-        {
-            memcpy(Util::VoidPtrInc(pRgpOutput, static_cast<size_t>(curFileOffset)), &apiInfo, sizeof(apiInfo));
-        }
+        SqttFileChunkApiInfo apiInfo = {};
+        apiInfo.header.chunkIdentifier.chunkType  = SQTT_FILE_CHUNK_TYPE_API_INFO;
+        apiInfo.header.chunkIdentifier.chunkIndex = 0;
+        apiInfo.header.version = 0;
+        apiInfo.header.sizeInBytes = sizeof(apiInfo);
+        apiInfo.apiType = SQTT_API_TYPE_VULKAN;
+        apiInfo.versionMajor = m_apiMajorVer;
+        apiInfo.versionMinor = m_apiMinorVer;
+
+        result = pStream->Write(&apiInfo, sizeof(apiInfo));
+        curFileOffset += sizeof(apiInfo);
     }
-    curFileOffset += sizeof(apiInfo);
 
     // Get each shader engine's data for rgp dump
-    uint32 shaderEngineCount = m_deviceProps.gfxipProperties.shaderCore.numShaderEngines;
-    for (uint32 i = 0; i < shaderEngineCount; i++)
+    const uint32 shaderEngineCount = m_deviceProps.gfxipProperties.shaderCore.numShaderEngines;
+    for (uint32 i = 0; (i < shaderEngineCount) && (result == Result::Success); i++)
     {
         const ThreadTraceSeLayout& seLayout     = pThreadTraceLayout->traces[i];
 
@@ -2877,17 +2960,7 @@ Result GpaSession::DumpRgpData(
 
         desc.sqttVersion = GfxipToSqttVersionTranslation[static_cast<uint32>(m_deviceProps.gfxLevel)];
 
-        if ((result == Result::Success) && (pRgpOutput != nullptr))
-        {
-            if (static_cast<size_t>(curFileOffset + sizeof(desc)) > *pTraceSize)
-            {
-                result = Result::ErrorInvalidMemorySize;
-            }
-            else
-            {
-                memcpy(Util::VoidPtrInc(pRgpOutput, static_cast<size_t>(curFileOffset)), &desc, sizeof(desc));
-            }
-        }
+        result = pStream->Write(&desc, sizeof(desc));
         curFileOffset += sizeof(desc);
 
         // Get data info and data for rgp dump
@@ -2907,105 +2980,65 @@ Result GpaSession::DumpRgpData(
         data.offset                            = curFileOffset + sizeof(data);
         data.size                              = sqttBytesWritten;
 
-        if ((result == Result::Success) && (pRgpOutput != nullptr))
+        if (result == Result::Success)
         {
-            if (static_cast<size_t>(curFileOffset + sizeof(data)) > *pTraceSize)
-            {
-                result = Result::ErrorInvalidMemorySize;
-            }
-            else
-            {
-                memcpy(Util::VoidPtrInc(pRgpOutput, static_cast<size_t>(curFileOffset)), &data, sizeof(data));
-            }
+            result = pStream->Write(&data, sizeof(data));
+            curFileOffset += sizeof(data);
         }
-        curFileOffset += sizeof(data);
 
-        if ((result == Result::Success) && (pRgpOutput != nullptr))
+        // The SQTT data is handed to the stream straight from the mapped sample memory.
+        if (result == Result::Success)
         {
-            if (static_cast<size_t>(curFileOffset + sqttBytesWritten) > *pTraceSize)
-            {
-                result = Result::ErrorInvalidMemorySize;
-            }
-            else
-            {
-                memcpy(Util::VoidPtrInc(pRgpOutput, static_cast<size_t>(curFileOffset)),
-                       pData,
-                       sqttBytesWritten);
-            }
+            result = pStream->Write(pData, sqttBytesWritten);
+            curFileOffset += sqttBytesWritten;
         }
-        curFileOffset += sqttBytesWritten;
     }
 
     // Write Shader ISA Database to the RGP file.
     if (result == Result::Success)
     {
         // Shader ISA database header.
-        if (pRgpOutput != nullptr)
-        {
-            if (static_cast<size_t>(curFileOffset + sizeof(SqttFileChunkIsaDatabase)) > *pTraceSize)
-            {
-                result = Result::ErrorInvalidMemorySize;
-            }
-            else
-            {
-                SqttFileChunkIsaDatabase shaderIsaDb          = {};
-                shaderIsaDb.header.chunkIdentifier.chunkType  = SQTT_FILE_CHUNK_TYPE_ISA_DATABASE;
-                shaderIsaDb.header.chunkIdentifier.chunkIndex = 0;
-                shaderIsaDb.header.version                    = 0;
-                shaderIsaDb.recordCount                       = static_cast<uint32>(m_curShaderRecords.NumElements());
-
-                int32 shaderDatabaseSize = sizeof(SqttFileChunkIsaDatabase);
-                auto iter = m_curShaderRecords.Begin();
-                while (iter.Get())
-                {
-                    shaderDatabaseSize += (*iter.Get()).recordSize;
-                    iter.Next();
-                }
+        SqttFileChunkIsaDatabase shaderIsaDb          = {};
+        shaderIsaDb.header.chunkIdentifier.chunkType  = SQTT_FILE_CHUNK_TYPE_ISA_DATABASE;
+        shaderIsaDb.header.chunkIdentifier.chunkIndex = 0;
+        shaderIsaDb.header.version                    = 0;
+        shaderIsaDb.recordCount                       = static_cast<uint32>(m_curShaderRecords.NumElements());
 
-                // The sizes must be updated by adding the size of the rest of the chunk later.
-                shaderIsaDb.header.sizeInBytes                = shaderDatabaseSize;
-                // TODO: Duplicate - will have to remove later once RGP spec is updated.
-                shaderIsaDb.size                              = shaderDatabaseSize;
+        int32 shaderDatabaseSize = sizeof(SqttFileChunkIsaDatabase);
+        auto iter = m_curShaderRecords.Begin();
+        while (iter.Get())
+        {
+            shaderDatabaseSize += (*iter.Get()).recordSize;
+            iter.Next();
+        }
 
-                // The ISA database starts from the beginning of the chunk.
-                shaderIsaDb.offset                            = curFileOffset;
+        // The sizes must be updated by adding the size of the rest of the chunk later.
+        shaderIsaDb.header.sizeInBytes                = shaderDatabaseSize;
+        // TODO: Duplicate - will have to remove later once RGP spec is updated.
+        shaderIsaDb.size                              = shaderDatabaseSize;
 
-                memcpy(Util::VoidPtrInc(pRgpOutput, static_cast<size_t>(curFileOffset)),
-                       &shaderIsaDb,
-                       sizeof(SqttFileChunkIsaDatabase));
-            }
-        }
+        // The ISA database starts from the beginning of the chunk.
+        shaderIsaDb.offset                            = curFileOffset;
 
+        result = pStream->Write(&shaderIsaDb, sizeof(SqttFileChunkIsaDatabase));
         curFileOffset += sizeof(SqttFileChunkIsaDatabase);
 
-        auto iter = m_curShaderRecords.Begin();
+        auto recordIter = m_curShaderRecords.Begin();
 
-        while (iter.Get())
+        while ((result == Result::Success) && recordIter.Get())
         {
-            ShaderRecord* pShaderRecord = iter.Get();
-
-            if (pRgpOutput != nullptr)
-            {
-                if (static_cast<size_t>(curFileOffset + pShaderRecord->recordSize) > *pTraceSize)
-                {
-                    result = Result::ErrorInvalidMemorySize;
-                }
-                else
-                {
-                    // Copy one record to the buffer provided.
-                    memcpy(Util::VoidPtrInc(pRgpOutput, static_cast<size_t>(curFileOffset)),
-                           pShaderRecord->pRecord,
-                           pShaderRecord->recordSize);
-                }
-            }
+            const ShaderRecord* pShaderRecord = recordIter.Get();
 
+            // Write one record to the stream.
+            result = pStream->Write(pShaderRecord->pRecord, pShaderRecord->recordSize);
             curFileOffset += pShaderRecord->recordSize;
-            iter.Next();
+
+            recordIter.Next();
         }
     }
 
     // Only write queue timing and calibration chunks if queue timing was enabled during the session.
-    if (m_flags.enableQueueTiming)
+    if ((result == Result::Success) && m_flags.enableQueueTiming)
     {
         // SqttQueueEventTimings chunk
         SqttFileChunkQueueEventTimings eventTimings = {};
@@ -3027,162 +3060,141 @@ Result GpaSession::DumpRgpData(
         eventTimings.queueEventTableRecordCount = numQueueEventRecords;
         eventTimings.queueEventTableSize = queueEventTableSize;
 
-        // Write the chunk header into the buffer
-        if ((result == Result::Success) && (pRgpOutput != nullptr))
-        {
-            if (static_cast<size_t>(curFileOffset + sizeof(eventTimings)) > *pTraceSize)
-            {
-                result = Result::ErrorInvalidMemorySize;
-            }
-            else
-            {
-                memcpy(Util::VoidPtrInc(pRgpOutput, static_cast<size_t>(curFileOffset)),
-                    &eventTimings,
-                    sizeof(eventTimings));
-            }
-        }
+        // Write the chunk header into the stream
+        result = pStream->Write(&eventTimings, sizeof(eventTimings));
         curFileOffset += sizeof(eventTimings);
 
-        // Write the queue info table
-        if ((result == Result::Success) && (pRgpOutput != nullptr))
-        {
-            if (static_cast<size_t>(curFileOffset + queueInfoTableSize) > *pTraceSize)
-            {
-                result = Result::ErrorInvalidMemorySize;
-            }
-            else
-            {
-                void* pQueueInfoTableFileOffset = Util::VoidPtrInc(pRgpOutput, static_cast<size_t>(curFileOffset));
+        // Records are gathered into small batches on the stack so the stream isn't called once per record.
+        constexpr uint32 RecordBatchSize = 64;
 
-                for (uint32 queueIndex = 0; queueIndex < numQueueInfoRecords; ++queueIndex)
-                {
-                    TimedQueueState* pQueueState = m_timedQueuesArray.At(queueIndex);
+        // Write the queue info table
+        SqttQueueInfoRecord queueInfoRecords[RecordBatchSize];
+        uint32              numBatchedRecords = 0;
 
-                    SqttQueueInfoRecord queueInfoRecord     = {};
-                    queueInfoRecord.queueID                 = pQueueState->queueId;
-                    queueInfoRecord.queueContext            = pQueueState->queueContext;
-                    queueInfoRecord.hardwareInfo.queueType  = PalQueueTypeToSqttQueueType[pQueueState->queueType];
-                    queueInfoRecord.hardwareInfo.engineType = PalEngineTypeToSqttEngineType[pQueueState->engineType];
+        for (uint32 queueIndex = 0; (queueIndex < numQueueInfoRecords) && (result == Result::Success); ++queueIndex)
+        {
+            TimedQueueState* pQueueState = m_timedQueuesArray.At(queueIndex);
 
-                    memcpy(pQueueInfoTableFileOffset, &queueInfoRecord, sizeof(queueInfoRecord));
+            SqttQueueInfoRecord& queueInfoRecord    = queueInfoRecords[numBatchedRecords++];
+            queueInfoRecord                         = {};
+            queueInfoRecord.queueID                 = pQueueState->queueId;
+            queueInfoRecord.queueContext            = pQueueState->queueContext;
+            queueInfoRecord.hardwareInfo.queueType  = PalQueueTypeToSqttQueueType[pQueueState->queueType];
+            queueInfoRecord.hardwareInfo.engineType = PalEngineTypeToSqttEngineType[pQueueState->engineType];
 
-                    pQueueInfoTableFileOffset = Util::VoidPtrInc(pQueueInfoTableFileOffset, sizeof(queueInfoRecord));
-                }
+            if ((numBatchedRecords == RecordBatchSize) || ((queueIndex + 1) == numQueueInfoRecords))
+            {
+                result = pStream->Write(&queueInfoRecords[0], numBatchedRecords * sizeof(SqttQueueInfoRecord));
+                numBatchedRecords = 0;
             }
         }
         curFileOffset += queueInfoTableSize;
 
         // Write the queue event table
-        if ((result == Result::Success) && (pRgpOutput != nullptr))
+        SqttQueueEventRecord queueEventRecords[RecordBatchSize];
+        numBatchedRecords = 0;
+
+        for (uint32 eventIndex = 0; (eventIndex < numQueueEventRecords) && (result == Result::Success); ++eventIndex)
         {
-            if (static_cast<size_t>(curFileOffset + queueEventTableSize) > *pTraceSize)
+            const TimedQueueEventItem* pQueueEvent = &m_queueEvents.At(eventIndex);
+
+            SqttQueueEventRecord& queueEventRecord = queueEventRecords[numBatchedRecords++];
+            queueEventRecord                       = {};
+            queueEventRecord.frameIndex            = pQueueEvent->frameIndex;
+            queueEventRecord.queueInfoIndex        = pQueueEvent->queueIndex;
+            queueEventRecord.cpuTimestamp          = pQueueEvent->cpuTimestamp;
+
+            switch (pQueueEvent->eventType)
             {
-                result = Result::ErrorInvalidMemorySize;
-            }
-            else
+            case TimedQueueEventType::Submit:
             {
-                void* pQueueEventTableFileOffset = Util::VoidPtrInc(pRgpOutput, static_cast<size_t>(curFileOffset));
+                const uint64* pPreTimestamp = reinterpret_cast<const uint64*>(Util::VoidPtrInc(
+                    pQueueEvent->gpuTimestamps.memInfo[0].pCpuAddr,
+                    static_cast<size_t>(pQueueEvent->gpuTimestamps.offsets[0])));
 
-                for (uint32 eventIndex = 0; eventIndex < numQueueEventRecords; ++eventIndex)
-                {
-                    const TimedQueueEventItem* pQueueEvent = &m_queueEvents.At(eventIndex);
+                const uint64* pPostTimestamp = reinterpret_cast<const uint64*>(Util::VoidPtrInc(
+                    pQueueEvent->gpuTimestamps.memInfo[1].pCpuAddr,
+                    static_cast<size_t>(pQueueEvent->gpuTimestamps.offsets[1])));
 
-                    SqttQueueEventRecord queueEventRecord = {};
-                    queueEventRecord.frameIndex           = pQueueEvent->frameIndex;
-                    queueEventRecord.queueInfoIndex       = pQueueEvent->queueIndex;
-                    queueEventRecord.cpuTimestamp         = pQueueEvent->cpuTimestamp;
+                queueEventRecord.eventType        = SQTT_QUEUE_TIMING_EVENT_CMDBUF_SUBMIT;
+                queueEventRecord.gpuTimestamps[0] = *pPreTimestamp;
+                queueEventRecord.gpuTimestamps[1] = *pPostTimestamp;
+                queueEventRecord.apiId            = pQueueEvent->apiId;
+                queueEventRecord.sqttCbId         = pQueueEvent->sqttCmdBufId;
+                queueEventRecord.submitSubIndex   = pQueueEvent->submitSubIndex;
 
-                    switch (pQueueEvent->eventType)
-                    {
-                    case TimedQueueEventType::Submit:
-                    {
-                        const uint64* pPreTimestamp = reinterpret_cast<const uint64*>(Util::VoidPtrInc(
-                            pQueueEvent->gpuTimestamps.memInfo[0].pCpuAddr,
-                            static_cast<size_t>(pQueueEvent->gpuTimestamps.offsets[0])));
-
-                        const uint64* pPostTimestamp = reinterpret_cast<const uint64*>(Util::VoidPtrInc(
-                            pQueueEvent->gpuTimestamps.memInfo[1].pCpuAddr,
-                            static_cast<size_t>(pQueueEvent->gpuTimestamps.offsets[1])));
-
-                        queueEventRecord.eventType        = SQTT_QUEUE_TIMING_EVENT_CMDBUF_SUBMIT;
-                        queueEventRecord.gpuTimestamps[0] = *pPreTimestamp;
-                        queueEventRecord.gpuTimestamps[1] = *pPostTimestamp;
-                        queueEventRecord.apiId            = pQueueEvent->apiId;
-                        queueEventRecord.sqttCbId         = pQueueEvent->sqttCmdBufId;
-                        queueEventRecord.submitSubIndex   = pQueueEvent->submitSubIndex;
-
-                        break;
-                    }
-
-                    case TimedQueueEventType::Signal:
-                    {
-                        const uint64* pTimestamp = reinterpret_cast<const uint64*>(Util::VoidPtrInc(
-                            pQueueEvent->gpuTimestamps.memInfo[0].pCpuAddr,
-                            static_cast<size_t>(pQueueEvent->gpuTimestamps.offsets[0])));
+                break;
+            }
 
-                        queueEventRecord.eventType        = SQTT_QUEUE_TIMING_EVENT_SIGNAL_SEMAPHORE;
-                        queueEventRecord.gpuTimestamps[0] = *pTimestamp;
-                        queueEventRecord.apiId            = pQueueEvent->apiId;
+            case TimedQueueEventType::Signal:
+            {
+                const uint64* pTimestamp = reinterpret_cast<const uint64*>(Util::VoidPtrInc(
+                    pQueueEvent->gpuTimestamps.memInfo[0].pCpuAddr,
+                    static_cast<size_t>(pQueueEvent->gpuTimestamps.offsets[0])));
 
-                        break;
-                    }
+                queueEventRecord.eventType        = SQTT_QUEUE_TIMING_EVENT_SIGNAL_SEMAPHORE;
+                queueEventRecord.gpuTimestamps[0] = *pTimestamp;
+                queueEventRecord.apiId            = pQueueEvent->apiId;
 
-                    case TimedQueueEventType::Wait:
-                    {
-                        const uint64* pTimestamp = reinterpret_cast<const uint64*>(Util::VoidPtrInc(
-                            pQueueEvent->gpuTimestamps.memInfo[0].pCpuAddr,
-                            static_cast<size_t>(pQueueEvent->gpuTimestamps.offsets[0])));
+                break;
+            }
 
-                        queueEventRecord.eventType        = SQTT_QUEUE_TIMING_EVENT_WAIT_SEMAPHORE;
-                        queueEventRecord.gpuTimestamps[0] = *pTimestamp;
-                        queueEventRecord.apiId            = pQueueEvent->apiId;
+            case TimedQueueEventType::Wait:
+            {
+                const uint64* pTimestamp = reinterpret_cast<const uint64*>(Util::VoidPtrInc(
+                    pQueueEvent->gpuTimestamps.memInfo[0].pCpuAddr,
+                    static_cast<size_t>(pQueueEvent->gpuTimestamps.offsets[0])));
 
-                        break;
-                    }
+                queueEventRecord.eventType        = SQTT_QUEUE_TIMING_EVENT_WAIT_SEMAPHORE;
+                queueEventRecord.gpuTimestamps[0] = *pTimestamp;
+                queueEventRecord.apiId            = pQueueEvent->apiId;
 
-                    case TimedQueueEventType::Present:
-                    {
-                        const uint64* pTimestamp = reinterpret_cast<const uint64*>(Util::VoidPtrInc(
-                            pQueueEvent->gpuTimestamps.memInfo[0].pCpuAddr,
-                            static_cast<size_t>(pQueueEvent->gpuTimestamps.offsets[0])));
+                break;
+            }
 
-                        queueEventRecord.eventType        = SQTT_QUEUE_TIMING_EVENT_PRESENT;
-                        queueEventRecord.gpuTimestamps[0] = *pTimestamp;
-                        queueEventRecord.apiId            = pQueueEvent->apiId;
+            case TimedQueueEventType::Present:
+            {
+                const uint64* pTimestamp = reinterpret_cast<const uint64*>(Util::VoidPtrInc(
+                    pQueueEvent->gpuTimestamps.memInfo[0].pCpuAddr,
+                    static_cast<size_t>(pQueueEvent->gpuTimestamps.offsets[0])));
 
-                        break;
-                    }
+                queueEventRecord.eventType        = SQTT_QUEUE_TIMING_EVENT_PRESENT;
+                queueEventRecord.gpuTimestamps[0] = *pTimestamp;
+                queueEventRecord.apiId            = pQueueEvent->apiId;
 
-                    case TimedQueueEventType::ExternalSignal:
-                    {
-                        queueEventRecord.eventType        = SQTT_QUEUE_TIMING_EVENT_SIGNAL_SEMAPHORE;
-                        queueEventRecord.gpuTimestamps[0] = ExtractGpuTimestampFromQueueEvent(*pQueueEvent);
-                        queueEventRecord.apiId            = pQueueEvent->apiId;
+                break;
+            }
 
-                        break;
-                    }
+            case TimedQueueEventType::ExternalSignal:
+            {
+                queueEventRecord.eventType        = SQTT_QUEUE_TIMING_EVENT_SIGNAL_SEMAPHORE;
+                queueEventRecord.gpuTimestamps[0] = ExtractGpuTimestampFromQueueEvent(*pQueueEvent);
+                queueEventRecord.apiId            = pQueueEvent->apiId;
 
-                    case TimedQueueEventType::ExternalWait:
-                    {
-                        queueEventRecord.eventType        = SQTT_QUEUE_TIMING_EVENT_WAIT_SEMAPHORE;
-                        queueEventRecord.gpuTimestamps[0] = ExtractGpuTimestampFromQueueEvent(*pQueueEvent);
-                        queueEventRecord.apiId            = pQueueEvent->apiId;
+                break;
+            }
 
-                        break;
-                    }
+            case TimedQueueEventType::ExternalWait:
+            {
+                queueEventRecord.eventType        = SQTT_QUEUE_TIMING_EVENT_WAIT_SEMAPHORE;
+                queueEventRecord.gpuTimestamps[0] = ExtractGpuTimestampFromQueueEvent(*pQueueEvent);
+                queueEventRecord.apiId            = pQueueEvent->apiId;
 
-                    default:
-                    {
-                        // Invalid event type
-                        PAL_ASSERT_ALWAYS();
-                        break;
-                    }
-                    }
+                break;
+            }
 
-                    memcpy(pQueueEventTableFileOffset, &queueEventRecord, sizeof(queueEventRecord));
+            default:
+            {
+                // Invalid event type
+                PAL_ASSERT_ALWAYS();
+                break;
+            }
+            }
 
-                    pQueueEventTableFileOffset = Util::VoidPtrInc(pQueueEventTableFileOffset, sizeof(queueEventRecord));
-                }
+            if ((numBatchedRecords == RecordBatchSize) || ((eventIndex + 1) == numQueueEventRecords))
+            {
+                result = pStream->Write(&queueEventRecords[0], numBatchedRecords * sizeof(SqttQueueEventRecord));
+                numBatchedRecords = 0;
             }
         }
         curFileOffset += queueEventTableSize;
@@ -3195,7 +3207,9 @@ Result GpaSession::DumpRgpData(
 
         const uint32 numClockCalibrationSamples = m_timestampCalibrations.NumElements();
 
-        for (uint32 sampleIndex = 0; sampleIndex < numClockCalibrationSamples; ++sampleIndex)
+        for (uint32 sampleIndex = 0;
+             (sampleIndex < numClockCalibrationSamples) && (result == Result::Success);
+             ++sampleIndex)
         {
             const Pal::GpuTimestampCalibration& timestampCalibration = m_timestampCalibrations.At(sampleIndex);
 
@@ -3203,26 +3217,12 @@ Result GpaSession::DumpRgpData(
             clockCalibration.cpuTimestamp = timestampCalibration.cpuWinPerfCounter;
             clockCalibration.gpuTimestamp = timestampCalibration.gpuTimestamp;
 
-            // Write the chunk header into the buffer
-            if ((result == Result::Success) && (pRgpOutput != nullptr))
-            {
-                if (static_cast<size_t>(curFileOffset + sizeof(clockCalibration)) > *pTraceSize)
-                {
-                    result = Result::ErrorInvalidMemorySize;
-                }
-                else
-                {
-                    memcpy(Util::VoidPtrInc(pRgpOutput, static_cast<size_t>(curFileOffset)),
-                        &clockCalibration,
-                        sizeof(clockCalibration));
-                }
-            }
+            // Write the chunk header into the stream
+            result = pStream->Write(&clockCalibration, sizeof(clockCalibration));
             curFileOffset += sizeof(clockCalibration);
         }
     }
 
-    *pTraceSize = curFileOffset;
-
     return result;
 }
 
@@ -28,6 +28,7 @@
 #include "core/os/lnx/lnxHeaders.h"
 #include <cstdio>
 #include <unistd.h>
+#include <sys/file.h>
 #include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
@@ -86,19 +87,28 @@ Result FileMapping::Create(
 }
 
 // =====================================================================================================================
-// Nothing needs to be done for Linux
+// Grows the file to at least the requested size. Views are created on demand on Linux, so nothing else needs to be
+// done. The size check and the resize happen under an exclusive file lock, so that a process which computed a smaller
+// size can't truncate data another process has already grown the file for.
 Result FileMapping::ReloadMap(
-    size_t newSize)  // new size that the mapping should be reopened with.
+    size_t newSize)  // minimum size that the mapping should be reopened with.
 {
-    int res = ftruncate(m_fileHandle, newSize);
-    if (res == 0)
-    {
-        return Result::Success;
-    }
-    else
+    Result result = Result::ErrorUnknown;
+
+    if (flock(m_fileHandle, LOCK_EX) == 0)
     {
-        return Result::ErrorUnknown;
+        struct stat fileStat = { };
+
+        if ((fstat(m_fileHandle, &fileStat) == 0) &&
+            ((static_cast<size_t>(fileStat.st_size) >= newSize) || (ftruncate(m_fileHandle, newSize) == 0)))
+        {
+            result = Result::Success;
+        }
+
+        flock(m_fileHandle, LOCK_UN);
     }
+
+    return result;
 }
 
 // =====================================================================================================================
@@ -142,7 +152,7 @@ void* FileView::Map(
     // offset should be aligned to page
     const int pageSize = sysconf(_SC_PAGE_SIZE);
     m_offestIntoView = offset - offset / pageSize * pageSize;
-    m_requestedSize = (size + m_offestIntoView - 1);
+    m_requestedSize = (size + m_offestIntoView);
 
     m_pMappedMem = mmap(nullptr, m_requestedSize, PROT_READ|PROT_WRITE, MAP_SHARED,
                         mappedFile.GetHandle(), offset / pageSize * pageSize );
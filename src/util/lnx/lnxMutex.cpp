@@ -198,6 +198,19 @@ uint32 AtomicCompareAndSwap(
     return __sync_val_compare_and_swap(pTarget, oldValue, newValue);
 }
 
+// =====================================================================================================================
+// Thread-safe method to compare and swap two 64-bit values.
+// Returns the value at (*pTarget) before this method was called.
+uint64 AtomicCompareAndSwap64(
+    volatile uint64* pTarget,
+    uint64           oldValue,
+    uint64           newValue)
+{
+    PAL_ASSERT(IsPow2Aligned(reinterpret_cast<size_t>(pTarget), sizeof(uint64)));
+
+    return __sync_val_compare_and_swap(pTarget, oldValue, newValue);
+}
+
 // =====================================================================================================================
 // Thread-safe method to exchange a 32-bit integer.  Returns the value at (*pTarget) before this method was called.
 uint32 AtomicExchange(
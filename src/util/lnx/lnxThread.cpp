@@ -173,7 +173,8 @@ void* Thread::StartThread(
 // =====================================================================================================================
 // Creates a new key for this process to store and retrieve thread-local data.
 Result CreateThreadLocalKey(
-    ThreadLocalKey* pKey)
+    ThreadLocalKey*       pKey,
+    ThreadLocalDestructor pfnDestructor)
 {
     Result result = Result::Success;
 
@@ -181,7 +182,7 @@ Result CreateThreadLocalKey(
     {
         result = Result::ErrorInvalidPointer;
     }
-    else if (pthread_key_create(pKey, nullptr) != 0)
+    else if (pthread_key_create(pKey, pfnDestructor) != 0)
     {
         result = Result::ErrorUnavailable;
     }
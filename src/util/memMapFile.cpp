@@ -25,6 +25,7 @@
 #include "palMemMapFile.h"
 #include "palFile.h"
 #include "palFileMap.h"
+#include "palMutex.h"
 
 namespace Util
 {
@@ -53,9 +54,10 @@ Result MemMapFile::OpenStorageFile(
 
     m_accessFlags = accessFlags;
     const bool alreadyExisted = File::Exists(pFileName);
+    const bool discard        = TestAnyFlagSet(accessFlags, StorageAccessModeFlags::DiscardContents);
 
-    // Write access is required to create a new file.
-    PAL_ASSERT(alreadyExisted || IsWriteable());
+    // Write access is required to create a new file or to discard the contents of an existing one.
+    PAL_ASSERT((alreadyExisted && (discard == false)) || IsWriteable());
     // A valid size must be provided for a new file.
     PAL_ASSERT(alreadyExisted || mappingSize > 0);
 
@@ -66,10 +68,11 @@ Result MemMapFile::OpenStorageFile(
     }
 
     // Try to open a memory mapping for the file.
-    result = OpenMemoryMapping(pFileName, mappingSize, alreadyExisted, pSystemName);
-    if ((result == Result::Success) && (alreadyExisted == false))
+    const bool keepContents = (alreadyExisted && (discard == false));
+    result = OpenMemoryMapping(pFileName, mappingSize, keepContents, pSystemName);
+    if ((result == Result::Success) && (keepContents == false))
     {
-        // If the file did not already exist then we need to intialize the header
+        // If the file did not already exist (or its contents are being discarded) then we need to intialize the header
         InitializeHeader(m_pActiveContainerHeader, m_mappingSize);
     }
 
@@ -139,7 +142,8 @@ void MemMapFile::CloseMemoryMapping()
 
 // =====================================================================================================================
 // Get read-write storage space for new data. Returns the offset to the current end of used storage. See documentation
-// on FileView for accessing data held by FileView
+// on FileView for accessing data held by FileView. Advancing the storage end goes through ReserveStorageSpace(), so
+// appends from several processes never overlap.
 Result MemMapFile::GetNewStorageSpace(
     size_t    dataSize,       // size required
     bool      advanceStorage, // Indicates whether the used storage offset should be advanced.
@@ -149,39 +153,85 @@ Result MemMapFile::GetNewStorageSpace(
 
     Result result = Result::ErrorUnknown;
 
-    size_t currentEnd  = GetStorageEnd();
-    size_t capacity    = GetStorageCapacity();
-    size_t spaceNeeded = currentEnd + dataSize;
-
-    if (spaceNeeded > capacity)
+    if (advanceStorage)
+    {
+        size_t offset = 0;
+        result = ReserveStorageSpace(dataSize, &offset, pOutView);
+    }
+    else
     {
-        if (AllowGrowth())
+        size_t currentEnd  = GetStorageEnd();
+        size_t capacity    = GetStorageCapacity();
+        size_t spaceNeeded = currentEnd + dataSize;
+
+        if (spaceNeeded > capacity)
         {
-            if (ExpandStorage(spaceNeeded) == Result::Success)
+            if (AllowGrowth())
             {
-                capacity = GetStorageCapacity();
+                if (ExpandStorage(spaceNeeded) == Result::Success)
+                {
+                    capacity = GetStorageCapacity();
+                }
+                else
+                {
+                    capacity = 0;
+                    CloseStorageFile();
+                }
             }
-            else
+        }
+
+        if (capacity >= spaceNeeded)
+        {
+            // We successfully got new space, so mark this as a success and map the provided file view.
+            result = Result::Success;
+            if (pOutView != nullptr)
             {
-                capacity = 0;
-                CloseStorageFile();
+                pOutView->Map(m_memoryMapping, IsWriteable(), currentEnd, dataSize);
             }
         }
     }
 
-    if (capacity >= spaceNeeded)
+    return result;
+}
+
+// =====================================================================================================================
+// Atomically reserves storage space for new data, so that concurrent writers in this and other processes never receive
+// overlapping ranges. See documentation on FileView for accessing data held by FileView.
+Result MemMapFile::ReserveStorageSpace(
+    size_t    dataSize, // size required
+    size_t*   pOffset,  // [Out] External offset of the reserved range.
+    FileView* pOutView) // [In/Out] Optional. File View that will be mapped onto the reserved range.
+{
+    PAL_ASSERT(IsWriteable() && (pOffset != nullptr));
+
+    Result result  = Result::ErrorUnknown;
+    uint64 nextEnd = 0;
+
+    TRY_ACCESS_FILE_VIEW(m_pActiveContainerHeader != nullptr)
     {
-        // We successfully got new space, so mark this as a success and map the provided file view and/or advance
-        // the storage end position.
-        result = Result::Success;
-        if (pOutView != nullptr)
-        {
-            pOutView->Map(m_memoryMapping, IsWriteable(), currentEnd, dataSize);
-        }
+        nextEnd = AtomicAdd64(&m_pActiveContainerHeader->storageEnd, dataSize);
+        result  = Result::Success;
+    }
+    CATCH_ACCESS_FILE_VIEW
+    {
+        PAL_ASSERT_ALWAYS();
+    }
 
-        if (advanceStorage)
+    if ((result == Result::Success) && (nextEnd > GetStorageCapacity()))
+    {
+        // The range has been claimed either way; if the storage can't be grown to cover it, it simply stays unused.
+        result = AllowGrowth() ? ExpandStorage(static_cast<size_t>(nextEnd)) : Result::ErrorUnknown;
+    }
+
+    if (result == Result::Success)
+    {
+        const size_t localOffset = static_cast<size_t>(nextEnd) - dataSize;
+
+        (*pOffset) = LocalToExternalOffset(localOffset);
+
+        if ((pOutView != nullptr) && (pOutView->Map(m_memoryMapping, IsWriteable(), localOffset, dataSize) == nullptr))
         {
-            ManualStorageAdvance(dataSize);
+            result = Result::ErrorUnknown;
         }
     }
 
@@ -243,7 +293,11 @@ Result MemMapFile::ReloadIfNeeded(
     {
         result = m_memoryMapping.ReloadMap(curFileSize);
 
-        if (result != Result::Success)
+        if (result == Result::Success)
+        {
+            m_mappingSize = curFileSize;
+        }
+        else
         {
             CloseStorageFile();
             PAL_ASSERT_ALWAYS();
@@ -260,13 +314,13 @@ Result MemMapFile::ReloadIfNeeded(
 
 // =====================================================================================================================
 // Expand the storage container. Returns success if the container was successfully expanded, and error code otherwise.
-// On failure, the storage conatiner will no longer be valid.
+// Other instances sharing the file may expand it at the same time, so the file is grown before the new capacity is
+// published, and the published capacity only ever increases.
 Result MemMapFile::ExpandStorage(
     size_t minimumNewSize)  // minimum size requested for expanded storage
 {
-    Result result = Result::ErrorUnknown;
-    const size_t curCapacity = GetStorageCapacity();
-    size_t nextCapacity = curCapacity;
+    Result result = Result::Success;
+    size_t curCapacity = GetStorageCapacity();
 
     if (minimumNewSize == 0)
     {
@@ -276,22 +330,42 @@ Result MemMapFile::ExpandStorage(
     constexpr size_t DoubleThreshold   = 64 * (1024 * 1024);
     constexpr size_t BlockIncreaseSize = 32 * (1024 * 1024);
 
-    while(nextCapacity < minimumNewSize)
+    while ((result == Result::Success) && (curCapacity < minimumNewSize))
     {
-        if (nextCapacity < DoubleThreshold)
+        size_t nextCapacity = curCapacity;
+
+        while(nextCapacity < minimumNewSize)
         {
-            nextCapacity = nextCapacity * 2;
+            if (nextCapacity < DoubleThreshold)
+            {
+                nextCapacity = nextCapacity * 2;
+            }
+            else
+            {
+                nextCapacity = nextCapacity + BlockIncreaseSize;
+            }
         }
-        else
+
+        result = m_memoryMapping.ReloadMap(nextCapacity);
+
+        if (result == Result::Success)
         {
-            nextCapacity = nextCapacity + BlockIncreaseSize;
-        }
-    }
+            result = Result::ErrorUnknown;
 
-    result = m_memoryMapping.ReloadMap(nextCapacity);
-    if (result == Result::Success)
-    {
-        SetStorageCapacity(nextCapacity);
+            TRY_ACCESS_FILE_VIEW(m_pActiveContainerHeader != nullptr)
+            {
+                // If another instance published a different capacity in the meantime, start over from that one.
+                const uint64 prevCapacity = AtomicCompareAndSwap64(&m_pActiveContainerHeader->storageCapacity,
+                                                                   curCapacity,
+                                                                   nextCapacity);
+                curCapacity = (prevCapacity == curCapacity) ? nextCapacity : static_cast<size_t>(prevCapacity);
+                result      = Result::Success;
+            }
+            CATCH_ACCESS_FILE_VIEW
+            {
+                PAL_ASSERT_ALWAYS();
+            }
+        }
     }
 
     return result;
@@ -306,7 +380,7 @@ size_t MemMapFile::GetStorageCapacity() const
 
     TRY_ACCESS_FILE_VIEW(m_pActiveContainerHeader != nullptr)
     {
-        storageCapacity = m_pActiveContainerHeader->storageCapacity;
+        storageCapacity = static_cast<size_t>(m_pActiveContainerHeader->storageCapacity);
     }
     CATCH_ACCESS_FILE_VIEW
     {
@@ -325,7 +399,7 @@ size_t MemMapFile::GetStorageEnd() const
 
     TRY_ACCESS_FILE_VIEW(m_pActiveContainerHeader != nullptr)
     {
-        storageEnd = m_pActiveContainerHeader->storageEnd;
+        storageEnd = static_cast<size_t>(m_pActiveContainerHeader->storageEnd);
     }
     CATCH_ACCESS_FILE_VIEW
     {
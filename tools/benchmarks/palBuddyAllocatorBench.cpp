@@ -0,0 +1,373 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+// palBuddyAllocatorBench drives Util::BuddyAllocator with randomized alloc/free traces.  Each trace uses the geometry
+// of one of InternalMemMgr's pool size classes: a 256 KiB base allocation and that class's smallest block and largest
+// request size.  Request sizes are log-uniform, alignments are random powers of two, and the trace keeps the pool
+// hovering around a target occupancy so that both splitting and coalescing stay busy.
+//
+// The trace is generated and checked against a shadow map of the pool in a first pass: every block must be aligned to
+// its padded size, must not overlap a live block, and the pool must be empty and fully coalesced once everything is
+// freed.  The recorded trace is then replayed loops times without any checking to measure the cost of Allocate() and
+// Free() alone.
+//
+// Usage: palBuddyAllocatorBench [--ops <count>] [--loops <count>] [--seed <value>]
+
+#include "palBuddyAllocatorImpl.h"
+#include "palSysMemory.h"
+#include "palSysUtil.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace Util;
+
+typedef BuddyAllocator<GenericAllocator> Allocator;
+
+// Matches InternalMemMgr's PoolAllocationSize.
+constexpr Pal::gpusize BaseAllocSize = 1ull << 18;
+
+// One operation of a trace.  Allocations store their offset in slot and frees release that slot's block.
+struct TraceOp
+{
+    bool         isAlloc;
+    uint32       slot;
+    Pal::gpusize size;
+    Pal::gpusize alignment;
+};
+
+// Geometry and occupancy target of one trace.
+struct TraceConfig
+{
+    const char*  pName;
+    Pal::gpusize minBlockSize;
+    Pal::gpusize maxRequestSize;
+    uint32       targetOccupancy; // Percent of the pool the trace tries to keep allocated.
+};
+
+// Minimal xorshift generator so that traces are reproducible across platforms.
+struct Random
+{
+    uint64 state;
+
+    uint32 Next()
+    {
+        state ^= (state << 13);
+        state ^= (state >> 7);
+        state ^= (state << 17);
+        return static_cast<uint32>(state >> 32);
+    }
+
+    // Returns a value in [0, range).
+    uint32 Below(uint32 range) { return static_cast<uint32>((static_cast<uint64>(Next()) * range) >> 32); }
+};
+
+// =====================================================================================================================
+// Generates a trace of numOps operations and verifies the allocator's behavior while doing so.
+static Result GenerateTrace(
+    const TraceConfig&    config,
+    uint32                numOps,
+    Random*               pRandom,
+    std::vector<TraceOp>* pTrace,
+    uint32*               pNumSlots,
+    uint32*               pNumOutOfMemory)
+{
+    GenericAllocator sysAllocator;
+    Allocator        allocator(&sysAllocator, BaseAllocSize, config.minBlockSize);
+
+    Result result = allocator.Init();
+
+    const uint32 minKval      = Log2(config.minBlockSize);
+    const uint32 maxKval      = Log2(config.maxRequestSize);
+    const uint32 numMinBlocks = static_cast<uint32>(BaseAllocSize / config.minBlockSize);
+
+    // Owner slot of each minimum-size block, or UINT32_MAX if it's free.
+    std::vector<uint32>       shadow(numMinBlocks, UINT32_MAX);
+    std::vector<uint32>       liveSlots;
+    std::vector<uint32>       freeSlots;
+    std::vector<Pal::gpusize> offsets;
+    std::vector<Pal::gpusize> paddedSizes;
+
+    *pNumOutOfMemory = 0;
+
+    for (uint32 idx = 0; (result == Result::Success) && (idx < numOps); ++idx)
+    {
+        const uint32 occupancy = static_cast<uint32>((allocator.AllocatedSize() * 100) / BaseAllocSize);
+
+        // Allocate three times out of four below the target occupancy and one time out of four above it.
+        const bool   allocate  = liveSlots.empty() ||
+                                 (pRandom->Below(4) < ((occupancy < config.targetOccupancy) ? 3u : 1u));
+
+        TraceOp op = {};
+        op.isAlloc = allocate;
+
+        if (allocate)
+        {
+            const Pal::gpusize maxSize = 1ull << (minKval + pRandom->Below(maxKval - minKval + 1));
+
+            op.size      = 1 + pRandom->Below(static_cast<uint32>(maxSize));
+            op.alignment = 1ull << pRandom->Below(Log2(maxSize) + 1);
+
+            if (freeSlots.empty())
+            {
+                op.slot = static_cast<uint32>(offsets.size());
+                offsets.push_back(0);
+                paddedSizes.push_back(0);
+            }
+            else
+            {
+                op.slot = freeSlots.back();
+                freeSlots.pop_back();
+            }
+
+            Pal::gpusize offset = 0;
+
+            const Result allocResult = allocator.Allocate(op.size, op.alignment, &offset);
+
+            if (allocResult == Result::ErrorOutOfGpuMemory)
+            {
+                // Out of memory is only legal if no free block is large enough.
+                const Pal::gpusize padded = Max(Pow2Pad(Max(op.size, op.alignment)), config.minBlockSize);
+
+                if (allocator.LargestFreeBlockSize() >= padded)
+                {
+                    fprintf(stderr, "Allocation of %llu bytes failed with a large enough block free.\n",
+                            static_cast<unsigned long long>(op.size));
+                    result = Result::ErrorUnknown;
+                }
+
+                freeSlots.push_back(op.slot);
+                ++(*pNumOutOfMemory);
+            }
+            else if (allocResult != Result::Success)
+            {
+                result = allocResult;
+            }
+            else
+            {
+                const Pal::gpusize padded = Max(Pow2Pad(Max(op.size, op.alignment)), config.minBlockSize);
+                const uint32       first  = static_cast<uint32>(offset / config.minBlockSize);
+                const uint32       count  = static_cast<uint32>(padded / config.minBlockSize);
+
+                if (((offset % padded) != 0) || ((offset + padded) > BaseAllocSize))
+                {
+                    fprintf(stderr, "Block at offset %llu is misplaced.\n", static_cast<unsigned long long>(offset));
+                    result = Result::ErrorUnknown;
+                }
+
+                for (uint32 block = first; (result == Result::Success) && (block < first + count); ++block)
+                {
+                    if (shadow[block] != UINT32_MAX)
+                    {
+                        fprintf(stderr, "Block at offset %llu overlaps a live block.\n",
+                                static_cast<unsigned long long>(offset));
+                        result = Result::ErrorUnknown;
+                    }
+
+                    shadow[block] = op.slot;
+                }
+
+                offsets[op.slot]     = offset;
+                paddedSizes[op.slot] = padded;
+                liveSlots.push_back(op.slot);
+            }
+        }
+        else
+        {
+            const uint32 liveIdx = pRandom->Below(static_cast<uint32>(liveSlots.size()));
+
+            op.slot = liveSlots[liveIdx];
+
+            liveSlots[liveIdx] = liveSlots.back();
+            liveSlots.pop_back();
+            freeSlots.push_back(op.slot);
+
+            const uint32 first = static_cast<uint32>(offsets[op.slot] / config.minBlockSize);
+            const uint32 count = static_cast<uint32>(paddedSizes[op.slot] / config.minBlockSize);
+
+            for (uint32 block = first; block < first + count; ++block)
+            {
+                shadow[block] = UINT32_MAX;
+            }
+
+            allocator.Free(offsets[op.slot]);
+        }
+
+        pTrace->push_back(op);
+    }
+
+    // Release everything that is still live so that each replay starts and ends with an empty pool.
+    while ((result == Result::Success) && (liveSlots.empty() == false))
+    {
+        TraceOp op = {};
+        op.slot = liveSlots.back();
+        liveSlots.pop_back();
+
+        allocator.Free(offsets[op.slot]);
+        pTrace->push_back(op);
+    }
+
+    if ((result == Result::Success) &&
+        ((allocator.IsEmpty() == false) || (allocator.LargestFreeBlockSize() != allocator.MaximumAllocationSize())))
+    {
+        fprintf(stderr, "The pool didn't coalesce back to its initial state.\n");
+        result = Result::ErrorUnknown;
+    }
+
+    *pNumSlots = static_cast<uint32>(offsets.size());
+
+    return result;
+}
+
+// =====================================================================================================================
+// Replays a recorded trace loops times and returns the elapsed time in GetPerfCpuTime() ticks.
+static Result ReplayTrace(
+    const TraceConfig&          config,
+    const std::vector<TraceOp>& trace,
+    uint32                      numSlots,
+    uint32                      loops,
+    uint64*                     pTicks)
+{
+    GenericAllocator sysAllocator;
+    Allocator        allocator(&sysAllocator, BaseAllocSize, config.minBlockSize);
+
+    Result result = allocator.Init();
+
+    std::vector<Pal::gpusize> offsets(numSlots);
+
+    const int64 startTime = GetPerfCpuTime();
+
+    for (uint32 loop = 0; (result == Result::Success) && (loop < loops); ++loop)
+    {
+        for (const TraceOp& op : trace)
+        {
+            if (op.isAlloc)
+            {
+                // Allocations which ran out of memory while recording fail the same way here; their slot is never
+                // freed, so the result can be ignored.
+                allocator.Allocate(op.size, op.alignment, &offsets[op.slot]);
+            }
+            else
+            {
+                allocator.Free(offsets[op.slot]);
+            }
+        }
+    }
+
+    *pTicks = static_cast<uint64>(GetPerfCpuTime() - startTime);
+
+    if ((result == Result::Success) && (allocator.IsEmpty() == false))
+    {
+        result = Result::ErrorUnknown;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+int main(
+    int   argc,
+    char* argv[])
+{
+    uint32 numOps    = 1 << 20;
+    uint32 loops     = 4;
+    uint64 seed      = 0x9E3779B97F4A7C15ull;
+    bool   validArgs = true;
+
+    for (int idx = 1; validArgs && (idx < argc); ++idx)
+    {
+        if ((strcmp(argv[idx], "--ops") == 0) && (idx + 1 < argc))
+        {
+            numOps = static_cast<uint32>(strtoul(argv[++idx], nullptr, 0));
+        }
+        else if ((strcmp(argv[idx], "--loops") == 0) && (idx + 1 < argc))
+        {
+            loops = static_cast<uint32>(strtoul(argv[++idx], nullptr, 0));
+        }
+        else if ((strcmp(argv[idx], "--seed") == 0) && (idx + 1 < argc))
+        {
+            seed = strtoull(argv[++idx], nullptr, 0);
+        }
+        else
+        {
+            validArgs = false;
+        }
+    }
+
+    if ((validArgs == false) || (numOps == 0) || (loops == 0) || (seed == 0))
+    {
+        fprintf(stderr, "Usage: %s [--ops <count>] [--loops <count>] [--seed <nonzero value>]\n", argv[0]);
+        return 1;
+    }
+
+    // These mirror InternalMemMgr's pool size classes.
+    static const TraceConfig Configs[] =
+    {
+        { "Small",  1ull << 4,  1ull << 10,        75 },
+        { "Medium", 1ull << 10, 1ull << 14,        75 },
+        { "Large",  1ull << 14, BaseAllocSize / 2, 50 },
+    };
+
+    printf("%-8s %10s %10s %12s %10s\n", "Class", "Ops", "OOM", "ns/op", "Mops/s");
+
+    Result result = Result::Success;
+    Random random = { seed };
+
+    for (uint32 idx = 0; (result == Result::Success) && (idx < (sizeof(Configs) / sizeof(Configs[0]))); ++idx)
+    {
+        std::vector<TraceOp> trace;
+        uint32               numSlots       = 0;
+        uint32               numOutOfMemory = 0;
+        uint64               ticks          = 0;
+
+        result = GenerateTrace(Configs[idx], numOps, &random, &trace, &numSlots, &numOutOfMemory);
+
+        if (result == Result::Success)
+        {
+            result = ReplayTrace(Configs[idx], trace, numSlots, loops, &ticks);
+        }
+
+        if (result == Result::Success)
+        {
+            const double totalOps = static_cast<double>(trace.size()) * loops;
+            const double ns       = (ticks * 1000000000.0) / GetPerfFrequency();
+
+            printf("%-8s %10llu %10u %12.1f %10.2f\n",
+                   Configs[idx].pName,
+                   static_cast<unsigned long long>(trace.size()),
+                   numOutOfMemory,
+                   ns / totalOps,
+                   (ns > 0.0) ? ((totalOps * 1000.0) / ns) : 0.0);
+        }
+    }
+
+    if (result != Result::Success)
+    {
+        fprintf(stderr, "Benchmark failed with result %d.\n", static_cast<int>(result));
+    }
+
+    return (result == Result::Success) ? 0 : 1;
+}
@@ -0,0 +1,211 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+// palHashMapBench compares Util::GrowableHashMap against Util::HashMap.  Both maps are created with the same initial
+// bucket count, which is derived from the number of entries and a target load factor, and then filled with unique keys.
+// For each load factor the benchmark reports insert and lookup throughput plus the median and 99th percentile latency
+// of a single insert.  At high load factors HashMap degrades into long bucket group chains while GrowableHashMap grows
+// incrementally, so the tail latency shows whether any one insert ended up paying for a full rehash.
+//
+// Usage: palHashMapBench [--entries <count>] [--loops <count>]
+
+#include "palGrowableHashMapImpl.h"
+#include "palHashMapImpl.h"
+#include "palSysMemory.h"
+#include "palSysUtil.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace Util;
+
+typedef HashMap<uint32, uint32, GenericAllocator>         BaselineMap;
+typedef GrowableHashMap<uint32, uint32, GenericAllocator> GrowableMap;
+
+// Timing results for one map at one load factor.  All times are in GetPerfCpuTime() ticks.
+struct MapResults
+{
+    uint64              insertTicks;
+    uint64              lookupTicks;
+    std::vector<uint64> insertLatencies;
+};
+
+// =====================================================================================================================
+// Fills a map with every key, timing each insert individually, and then looks every key up again loops times.
+template <typename MapType>
+static Result MeasureMap(
+    uint32                     numBuckets,
+    const std::vector<uint32>& keys,
+    uint32                     loops,
+    MapResults*                pResults)
+{
+    GenericAllocator allocator;
+    MapType          map(numBuckets, &allocator);
+
+    Result result = map.Init();
+
+    pResults->insertTicks = 0;
+    pResults->lookupTicks = 0;
+    pResults->insertLatencies.resize(keys.size());
+
+    for (uint32 idx = 0; (result == Result::Success) && (idx < keys.size()); ++idx)
+    {
+        const int64 start = GetPerfCpuTime();
+
+        result = map.Insert(keys[idx], idx);
+
+        const uint64 ticks = static_cast<uint64>(GetPerfCpuTime() - start);
+
+        pResults->insertLatencies[idx] = ticks;
+        pResults->insertTicks         += ticks;
+    }
+
+    // Accumulating the found values keeps the lookups from being optimized away.
+    uint64 checksum = 0;
+
+    const int64 lookupStart = GetPerfCpuTime();
+
+    for (uint32 loop = 0; (result == Result::Success) && (loop < loops); ++loop)
+    {
+        for (uint32 idx = 0; idx < keys.size(); ++idx)
+        {
+            const uint32*const pValue = map.FindKey(keys[idx]);
+            checksum += (pValue != nullptr) ? *pValue : UINT32_MAX;
+        }
+    }
+
+    pResults->lookupTicks = static_cast<uint64>(GetPerfCpuTime() - lookupStart);
+
+    const uint64 expected = static_cast<uint64>(loops) * ((static_cast<uint64>(keys.size()) * (keys.size() - 1)) / 2);
+
+    if ((result == Result::Success) && (checksum != expected))
+    {
+        fprintf(stderr, "Lookups returned the wrong values.\n");
+        result = Result::ErrorUnknown;
+    }
+
+    std::sort(pResults->insertLatencies.begin(), pResults->insertLatencies.end());
+
+    return result;
+}
+
+// =====================================================================================================================
+// Prints one row of the results table.
+static void Report(
+    const char*       pName,
+    double            loadFactor,
+    uint32            numEntries,
+    uint32            loops,
+    const MapResults& results)
+{
+    const double ticksPerUs = static_cast<double>(GetPerfFrequency()) / 1000000.0;
+    const size_t p50Index   = (results.insertLatencies.size() * 50) / 100;
+    const size_t p99Index   = (results.insertLatencies.size() * 99) / 100;
+
+    printf("%-16s %6.2f %14.2f %14.2f %10.3f %10.3f\n",
+           pName,
+           loadFactor,
+           (numEntries * ticksPerUs) / results.insertTicks,
+           (static_cast<double>(numEntries) * loops * ticksPerUs) / results.lookupTicks,
+           results.insertLatencies[p50Index] / ticksPerUs,
+           results.insertLatencies[p99Index] / ticksPerUs);
+}
+
+// =====================================================================================================================
+int main(
+    int   argc,
+    char* argv[])
+{
+    uint32 numEntries = 1 << 18;
+    uint32 loops      = 8;
+    bool   validArgs  = true;
+
+    for (int idx = 1; validArgs && (idx < argc); ++idx)
+    {
+        if ((strcmp(argv[idx], "--entries") == 0) && (idx + 1 < argc))
+        {
+            numEntries = static_cast<uint32>(strtoul(argv[++idx], nullptr, 0));
+        }
+        else if ((strcmp(argv[idx], "--loops") == 0) && (idx + 1 < argc))
+        {
+            loops = static_cast<uint32>(strtoul(argv[++idx], nullptr, 0));
+        }
+        else
+        {
+            validArgs = false;
+        }
+    }
+
+    if ((validArgs == false) || (numEntries == 0) || (loops == 0))
+    {
+        fprintf(stderr, "Usage: %s [--entries <count>] [--loops <count>]\n", argv[0]);
+        return 1;
+    }
+
+    // Multiplying by an odd constant is a bijection on 32-bit integers, so these keys are unique but scattered.
+    std::vector<uint32> keys(numEntries);
+
+    for (uint32 idx = 0; idx < numEntries; ++idx)
+    {
+        keys[idx] = (idx + 1) * 2654435761u;
+    }
+
+    // Load factor is the number of entries per initial bucket.
+    static const double LoadFactors[] = { 0.5, 1.0, 4.0, 16.0, 64.0 };
+
+    printf("%-16s %6s %14s %14s %10s %10s\n", "Map", "Load", "Inserts/us", "Lookups/us", "p50 us", "p99 us");
+
+    Result result = Result::Success;
+
+    for (uint32 idx = 0; (result == Result::Success) && (idx < (sizeof(LoadFactors) / sizeof(LoadFactors[0]))); ++idx)
+    {
+        const uint32 numBuckets = Max(static_cast<uint32>(numEntries / LoadFactors[idx]), 1u);
+
+        MapResults results = {};
+
+        result = MeasureMap<BaselineMap>(numBuckets, keys, loops, &results);
+
+        if (result == Result::Success)
+        {
+            Report("HashMap", LoadFactors[idx], numEntries, loops, results);
+
+            result = MeasureMap<GrowableMap>(numBuckets, keys, loops, &results);
+        }
+
+        if (result == Result::Success)
+        {
+            Report("GrowableHashMap", LoadFactors[idx], numEntries, loops, results);
+        }
+    }
+
+    if (result != Result::Success)
+    {
+        fprintf(stderr, "Benchmark failed with result %d.\n", static_cast<int>(result));
+    }
+
+    return (result == Result::Success) ? 0 : 1;
+}
@@ -0,0 +1,599 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+// palPipelineBench measures how pipeline creation scales across threads on a PAL null device.  Every thread creates
+// the same set of pipelines from pipeline ELF binaries over and over, first through CreateGraphicsPipeline() and
+// CreateComputePipeline(), and then through LoadPipeline() from data stored by IPipeline::Store().  Each phase reports
+// its throughput, a per-call latency histogram and the time spent waiting for the internal memory manager's locks.
+// Because the null device never touches hardware this isolates the CPU cost of pipeline creation, which makes it
+// useful for catching scaling regressions in the ELF processing and internal memory allocation paths.
+//
+// Usage: palPipelineBench [--gpu <null device name>] [--threads <count>] [--loops <count>]
+//                         [--compute <pipeline ELF>]... [--graphics <pipeline ELF>]...
+//
+// Graphics pipelines are created for triangle lists rendering to a single RGBA8 target; the ELFs must be compatible
+// with that state.  The statistics come from the device's PipelineCreateProfiler, so the device must not be wrapped
+// by any layers.
+
+#include "pal.h"
+#include "palDevice.h"
+#include "palFile.h"
+#include "palLib.h"
+#include "palPipeline.h"
+#include "palPlatform.h"
+#include "palSysUtil.h"
+
+#include "core/device.h"
+#include "core/hw/gfxip/gfxDevice.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace Pal;
+using namespace Util;
+
+// A pipeline ELF loaded from disk along with the pipeline data stored from it.
+struct PipelineSource
+{
+    bool               isGraphics;
+    std::vector<uint8> elf;
+    std::vector<uint8> stored;
+};
+
+// =====================================================================================================================
+class PipelineBench
+{
+public:
+    PipelineBench();
+    ~PipelineBench();
+
+    Result Init(const char* pGpuName);
+    Result AddPipeline(const char* pFilename, bool isGraphics);
+    Result Run(uint32 numThreads, uint32 loops);
+
+private:
+    Result CreatePipeline(const PipelineSource& source, bool load, void* pMemory, IPipeline** ppPipeline) const;
+    size_t GetPipelineSize(const PipelineSource& source, bool load) const;
+    Result StorePipelines();
+    Result RunPhase(const char* pName, bool load, uint32 numThreads, uint32 loops);
+    void   ThreadFunc(bool load, uint32 loops, Result* pResult) const;
+
+    IPlatform*                  m_pPlatform;
+    void*                       m_pPlatformMemory;
+    IDevice*                    m_pDevice;
+    std::vector<PipelineSource> m_sources;
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(PipelineBench);
+};
+
+// =====================================================================================================================
+PipelineBench::PipelineBench()
+    :
+    m_pPlatform(nullptr),
+    m_pPlatformMemory(nullptr),
+    m_pDevice(nullptr)
+{
+}
+
+// =====================================================================================================================
+PipelineBench::~PipelineBench()
+{
+    if (m_pDevice != nullptr)
+    {
+        m_pDevice->Cleanup();
+    }
+
+    if (m_pPlatform != nullptr)
+    {
+        m_pPlatform->Destroy();
+    }
+
+    free(m_pPlatformMemory);
+}
+
+// =====================================================================================================================
+// Creates a platform for the requested null device, initializes its one device and enables pipeline creation
+// profiling on it.
+Result PipelineBench::Init(
+    const char* pGpuName)
+{
+    NullGpuInfo nullGpus[static_cast<uint32>(NullGpuId::Max)] = {};
+    uint32      nullGpuCount = static_cast<uint32>(NullGpuId::Max);
+
+    Result result = EnumerateNullDevices(&nullGpuCount, nullGpus);
+
+    PlatformCreateInfo createInfo = {};
+    createInfo.pSettingsPath          = "palPipelineBench";
+    createInfo.flags.createNullDevice = 1;
+    createInfo.nullGpuId              = NullGpuId::Max;
+
+    for (uint32 idx = 0; (result == Result::Success) && (idx < nullGpuCount); ++idx)
+    {
+        if ((pGpuName == nullptr) || (strcmp(pGpuName, nullGpus[idx].pGpuName) == 0))
+        {
+            createInfo.nullGpuId = nullGpus[idx].nullGpuId;
+            printf("Creating pipelines on the %s null device.\n", nullGpus[idx].pGpuName);
+            break;
+        }
+    }
+
+    if ((result == Result::Success) && (createInfo.nullGpuId == NullGpuId::Max))
+    {
+        fprintf(stderr, "Unknown null device \"%s\".  Supported devices are:\n", pGpuName);
+        for (uint32 idx = 0; idx < nullGpuCount; ++idx)
+        {
+            fprintf(stderr, "    %s\n", nullGpus[idx].pGpuName);
+        }
+        result = Result::ErrorInvalidValue;
+    }
+
+    if (result == Result::Success)
+    {
+        m_pPlatformMemory = malloc(GetPlatformSize());
+        result = (m_pPlatformMemory != nullptr) ? CreatePlatform(createInfo, m_pPlatformMemory, &m_pPlatform)
+                                                : Result::ErrorOutOfMemory;
+    }
+
+    if (result == Result::Success)
+    {
+        IDevice* pDevices[MaxDevices] = {};
+        uint32   deviceCount          = 0;
+
+        result = m_pPlatform->EnumerateDevices(&deviceCount, pDevices);
+
+        if ((result == Result::Success) && (deviceCount == 0))
+        {
+            result = Result::ErrorUnavailable;
+        }
+
+        m_pDevice = pDevices[0];
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_pDevice->CommitSettingsAndInit();
+    }
+
+    if (result == Result::Success)
+    {
+        DeviceFinalizeInfo finalizeInfo = {};
+        finalizeInfo.requestedEngineCounts[EngineTypeUniversal].engines = 1;
+
+        result = m_pDevice->Finalize(finalizeInfo);
+    }
+
+    if (result == Result::Success)
+    {
+        Device*const pCoreDevice = static_cast<Device*>(m_pDevice);
+
+        if (pCoreDevice->GetGfxDevice() == nullptr)
+        {
+            result = Result::ErrorUnavailable;
+        }
+        else
+        {
+            pCoreDevice->GetGfxDevice()->GetPipelineCreateProfiler()->Enable(pCoreDevice->MemMgr());
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Loads a pipeline ELF which every thread will create pipelines from.
+Result PipelineBench::AddPipeline(
+    const char* pFilename,
+    bool        isGraphics)
+{
+    Result         result = Result::ErrorInvalidValue;
+    File           file;
+    PipelineSource source = {};
+
+    const size_t fileSize = File::GetFileSize(pFilename);
+
+    source.isGraphics = isGraphics;
+
+    if ((fileSize > 0) && (file.Open(pFilename, FileAccessRead | FileAccessBinary) == Result::Success))
+    {
+        size_t bytesRead = 0;
+        source.elf.resize(fileSize);
+        result = file.Read(source.elf.data(), fileSize, &bytesRead);
+
+        if ((result == Result::Success) && (bytesRead != fileSize))
+        {
+            result = Result::ErrorUnknown;
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        m_sources.push_back(source);
+    }
+    else
+    {
+        fprintf(stderr, "Failed to load the pipeline ELF \"%s\".\n", pFilename);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+static void InitGraphicsCreateInfo(
+    const PipelineSource&       source,
+    GraphicsPipelineCreateInfo* pCreateInfo)
+{
+    memset(pCreateInfo, 0, sizeof(*pCreateInfo));
+
+    pCreateInfo->pPipelineBinary                       = source.elf.data();
+    pCreateInfo->pipelineBinarySize                    = source.elf.size();
+    pCreateInfo->iaState.topologyInfo.primitiveType    = PrimitiveType::Triangle;
+    pCreateInfo->vpState.depthClipEnable               = true;
+    pCreateInfo->vpState.depthRange                    = DepthRange::ZeroToOne;
+    pCreateInfo->cbState.logicOp                       = LogicOp::Copy;
+    pCreateInfo->cbState.target[0].swizzledFormat      =
+        { ChNumFormat::X8Y8Z8W8_Unorm, { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W } };
+    pCreateInfo->cbState.target[0].channelWriteMask    = 0xF;
+}
+
+// =====================================================================================================================
+static void InitComputeCreateInfo(
+    const PipelineSource&      source,
+    ComputePipelineCreateInfo* pCreateInfo)
+{
+    memset(pCreateInfo, 0, sizeof(*pCreateInfo));
+
+    pCreateInfo->pPipelineBinary    = source.elf.data();
+    pCreateInfo->pipelineBinarySize = source.elf.size();
+}
+
+// =====================================================================================================================
+// Returns the placement size of a pipeline created from source, or zero on failure.
+size_t PipelineBench::GetPipelineSize(
+    const PipelineSource& source,
+    bool                  load
+    ) const
+{
+    Result result = Result::Success;
+    size_t size   = 0;
+
+    if (load)
+    {
+        size = m_pDevice->GetLoadedPipelineSize(source.stored.data(), source.stored.size(), &result);
+    }
+    else if (source.isGraphics)
+    {
+        GraphicsPipelineCreateInfo createInfo;
+        InitGraphicsCreateInfo(source, &createInfo);
+
+        size = m_pDevice->GetGraphicsPipelineSize(createInfo, &result);
+    }
+    else
+    {
+        ComputePipelineCreateInfo createInfo;
+        InitComputeCreateInfo(source, &createInfo);
+
+        size = m_pDevice->GetComputePipelineSize(createInfo, &result);
+    }
+
+    return (result == Result::Success) ? size : 0;
+}
+
+// =====================================================================================================================
+// Creates a pipeline from source, either from its ELF or from its stored data.
+Result PipelineBench::CreatePipeline(
+    const PipelineSource& source,
+    bool                  load,
+    void*                 pMemory,
+    IPipeline**           ppPipeline
+    ) const
+{
+    Result result = Result::Success;
+
+    if (load)
+    {
+        result = m_pDevice->LoadPipeline(source.stored.data(), source.stored.size(), pMemory, ppPipeline);
+    }
+    else if (source.isGraphics)
+    {
+        GraphicsPipelineCreateInfo createInfo;
+        InitGraphicsCreateInfo(source, &createInfo);
+
+        result = m_pDevice->CreateGraphicsPipeline(createInfo, pMemory, ppPipeline);
+    }
+    else
+    {
+        ComputePipelineCreateInfo createInfo;
+        InitComputeCreateInfo(source, &createInfo);
+
+        result = m_pDevice->CreateComputePipeline(createInfo, pMemory, ppPipeline);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Creates one pipeline from each ELF and stores it so that the load phase has something to load.
+Result PipelineBench::StorePipelines()
+{
+    Result result = Result::Success;
+
+    for (uint32 idx = 0; (result == Result::Success) && (idx < m_sources.size()); ++idx)
+    {
+        PipelineSource& source = m_sources[idx];
+        IPipeline*      pPipeline = nullptr;
+
+        std::vector<uint8> memory(GetPipelineSize(source, false));
+
+        result = memory.empty() ? Result::ErrorInvalidValue : CreatePipeline(source, false, memory.data(), &pPipeline);
+
+        size_t dataSize = 0;
+
+        if (result == Result::Success)
+        {
+            result = pPipeline->Store(&dataSize, nullptr);
+        }
+
+        if (result == Result::Success)
+        {
+            source.stored.resize(dataSize);
+            result = pPipeline->Store(&dataSize, source.stored.data());
+        }
+
+        if (pPipeline != nullptr)
+        {
+            pPipeline->Destroy();
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Body of each benchmark thread: creates a pipeline from every source loops times.
+void PipelineBench::ThreadFunc(
+    bool    load,
+    uint32  loops,
+    Result* pResult
+    ) const
+{
+    Result result = Result::Success;
+
+    std::vector<std::vector<uint8>> memory(m_sources.size());
+
+    for (uint32 idx = 0; (result == Result::Success) && (idx < m_sources.size()); ++idx)
+    {
+        memory[idx].resize(GetPipelineSize(m_sources[idx], load));
+
+        if (memory[idx].empty())
+        {
+            result = Result::ErrorInvalidValue;
+        }
+    }
+
+    for (uint32 loop = 0; (result == Result::Success) && (loop < loops); ++loop)
+    {
+        for (uint32 idx = 0; (result == Result::Success) && (idx < m_sources.size()); ++idx)
+        {
+            IPipeline* pPipeline = nullptr;
+
+            result = CreatePipeline(m_sources[idx], load, memory[idx].data(), &pPipeline);
+
+            if (result == Result::Success)
+            {
+                pPipeline->Destroy();
+            }
+        }
+    }
+
+    *pResult = result;
+}
+
+// =====================================================================================================================
+// Runs one benchmark phase on numThreads threads and reports the statistics the profiler collected for it.
+Result PipelineBench::RunPhase(
+    const char* pName,
+    bool        load,
+    uint32      numThreads,
+    uint32      loops)
+{
+    Device*const                 pCoreDevice = static_cast<Device*>(m_pDevice);
+    const PipelineCreateProfiler& profiler   = *pCoreDevice->GetGfxDevice()->GetPipelineCreateProfiler();
+
+    PipelineCreateStats before = {};
+    PipelineCreateStats after  = {};
+
+    profiler.GetStats(*pCoreDevice->MemMgr(), &before);
+
+    std::vector<std::thread> threads;
+    std::vector<Result>      results(numThreads, Result::Success);
+
+    const int64 startTime = GetPerfCpuTime();
+
+    for (uint32 idx = 0; idx < numThreads; ++idx)
+    {
+        threads.emplace_back(&PipelineBench::ThreadFunc, this, load, loops, &results[idx]);
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    const int64 endTime = GetPerfCpuTime();
+
+    profiler.GetStats(*pCoreDevice->MemMgr(), &after);
+
+    Result result = Result::Success;
+
+    for (uint32 idx = 0; (result == Result::Success) && (idx < numThreads); ++idx)
+    {
+        result = results[idx];
+    }
+
+    if (result == Result::Success)
+    {
+        const double ticksPerMs = static_cast<double>(GetPerfFrequency()) / 1000.0;
+        const double wallMs     = (endTime - startTime) / ticksPerMs;
+
+        uint64 numPipelines = 0;
+
+        for (uint32 idx = 0; idx < static_cast<uint32>(PipelineCreateType::Count); ++idx)
+        {
+            numPipelines += after.numPipelines[idx] - before.numPipelines[idx];
+        }
+
+        printf("\n%s: %llu pipelines on %u thread(s) in %.3f ms (%.1f pipelines/s)\n",
+               pName,
+               static_cast<unsigned long long>(numPipelines),
+               numThreads,
+               wallMs,
+               (wallMs > 0.0) ? ((numPipelines * 1000.0) / wallMs) : 0.0);
+        printf("    Average latency %.3f ms\n",
+               (numPipelines > 0) ? (((after.totalTime - before.totalTime) / ticksPerMs) / numPipelines) : 0.0);
+        printf("    Internal memory manager locks: %llu contended acquisitions, %.3f ms waiting\n",
+               static_cast<unsigned long long>(after.memMgrLockContentions - before.memMgrLockContentions),
+               (after.memMgrLockWaitTime - before.memMgrLockWaitTime) / ticksPerMs);
+
+        for (uint32 idx = 0; idx < PipelineCreateLatencyBuckets; ++idx)
+        {
+            const uint64 count = after.latencyHistogram[idx] - before.latencyHistogram[idx];
+
+            if (count > 0)
+            {
+                printf("    %8llu us - %8llu us: %llu\n",
+                       (idx == 0) ? 0ull : (1ull << idx),
+                       (1ull << (idx + 1)),
+                       static_cast<unsigned long long>(count));
+            }
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+Result PipelineBench::Run(
+    uint32 numThreads,
+    uint32 loops)
+{
+    Result result = StorePipelines();
+
+    if (result == Result::Success)
+    {
+        result = RunPhase("Create", false, numThreads, loops);
+    }
+
+    if (result == Result::Success)
+    {
+        result = RunPhase("Load", true, numThreads, loops);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+int main(
+    int   argc,
+    char* argv[])
+{
+    const char* pGpuName   = nullptr;
+    uint32      numThreads = 1;
+    uint32      loops      = 100;
+    bool        validArgs  = true;
+
+    std::vector<const char*> computeElfs;
+    std::vector<const char*> graphicsElfs;
+
+    for (int idx = 1; validArgs && (idx < argc); ++idx)
+    {
+        if ((strcmp(argv[idx], "--gpu") == 0) && (idx + 1 < argc))
+        {
+            pGpuName = argv[++idx];
+        }
+        else if ((strcmp(argv[idx], "--threads") == 0) && (idx + 1 < argc))
+        {
+            numThreads = static_cast<uint32>(strtoul(argv[++idx], nullptr, 0));
+        }
+        else if ((strcmp(argv[idx], "--loops") == 0) && (idx + 1 < argc))
+        {
+            loops = static_cast<uint32>(strtoul(argv[++idx], nullptr, 0));
+        }
+        else if ((strcmp(argv[idx], "--compute") == 0) && (idx + 1 < argc))
+        {
+            computeElfs.push_back(argv[++idx]);
+        }
+        else if ((strcmp(argv[idx], "--graphics") == 0) && (idx + 1 < argc))
+        {
+            graphicsElfs.push_back(argv[++idx]);
+        }
+        else
+        {
+            validArgs = false;
+        }
+    }
+
+    if ((validArgs == false) || (numThreads == 0) || (loops == 0) || (computeElfs.empty() && graphicsElfs.empty()))
+    {
+        fprintf(stderr,
+                "Usage: %s [--gpu <null device name>] [--threads <count>] [--loops <count>]\n"
+                "       [--compute <pipeline ELF>]... [--graphics <pipeline ELF>]...\n",
+                argv[0]);
+        return 1;
+    }
+
+    PipelineBench bench;
+
+    Result result = bench.Init(pGpuName);
+
+    for (const char* pFilename : computeElfs)
+    {
+        if (result == Result::Success)
+        {
+            result = bench.AddPipeline(pFilename, false);
+        }
+    }
+
+    for (const char* pFilename : graphicsElfs)
+    {
+        if (result == Result::Success)
+        {
+            result = bench.AddPipeline(pFilename, true);
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        result = bench.Run(numThreads, loops);
+    }
+
+    if (result != Result::Success)
+    {
+        fprintf(stderr, "Benchmark failed with result %d.\n", static_cast<int>(result));
+    }
+
+    return (result == Result::Success) ? 0 : 1;
+}
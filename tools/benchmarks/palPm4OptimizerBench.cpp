@@ -0,0 +1,605 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+// palPm4OptimizerBench replays captured PM4 command streams through the GFX9 Pm4Optimizer and reports how fast the
+// optimizer chews through them and how much of each stream it filters out.  The input files are submit-time command
+// buffer dumps captured with submitTimeCmdBufDumpMode set to CmdBufDumpModeBinaryHeaders, either as per-submission
+// .pm4 files or as the streaming container written by CmdBufDumpWriter.  Only the DE chunks are replayed; the
+// optimizer is reset at the start of each dumped submission, which approximates the per-command buffer reset the
+// driver does.  The optimizer lives on a PAL null device, so no GPU is required.
+//
+// Usage: palPm4OptimizerBench [--gpu <null device name>] [--loops <count>] <dump file>...
+
+#include "pal.h"
+#include "palDevice.h"
+#include "palFile.h"
+#include "palLib.h"
+#include "palPlatform.h"
+#include "palSysUtil.h"
+
+#include "core/cmdBufDumpWriter.h"
+#include "core/cmdBuffer.h"
+#include "core/device.h"
+#include "core/hw/gfxip/gfx9/gfx9Device.h"
+#include "core/hw/gfxip/gfx9/gfx9Pm4Optimizer.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace Pal;
+using namespace Util;
+
+// The DE chunks of one dumped submission.  Each chunk is a sequence of whole PM4 packets.
+struct Submission
+{
+    std::vector<std::vector<uint32>> chunks;
+};
+
+// =====================================================================================================================
+// Decodes one LZ4 block as written by CmdBufDumpWriter.  Returns false if the block is malformed or doesn't decode to
+// exactly dstSize bytes.
+static bool Lz4DecompressBlock(
+    const uint8* pSrc,
+    size_t       srcSize,
+    uint8*       pDst,
+    size_t       dstSize)
+{
+    const uint8*const pSrcEnd = pSrc + srcSize;
+    uint8*            pOut    = pDst;
+    bool              valid   = true;
+
+    while (valid && (pSrc < pSrcEnd))
+    {
+        const uint32 token = *pSrc++;
+        size_t       count = (token >> 4);
+
+        if (count == 15)
+        {
+            uint32 extra = 255;
+            while ((extra == 255) && (pSrc < pSrcEnd))
+            {
+                extra  = *pSrc++;
+                count += extra;
+            }
+        }
+
+        valid = (count <= static_cast<size_t>(pSrcEnd - pSrc)) && (count <= (dstSize - (pOut - pDst)));
+
+        if (valid)
+        {
+            memcpy(pOut, pSrc, count);
+            pOut += count;
+            pSrc += count;
+        }
+
+        // The last sequence of a block has no match.
+        if (valid && (pSrc < pSrcEnd))
+        {
+            valid = ((pSrcEnd - pSrc) >= 2);
+
+            const size_t offset = valid ? (pSrc[0] | (pSrc[1] << 8)) : 0;
+            pSrc += 2;
+
+            count = (token & 0xF);
+
+            if (count == 15)
+            {
+                uint32 extra = 255;
+                while ((extra == 255) && (pSrc < pSrcEnd))
+                {
+                    extra  = *pSrc++;
+                    count += extra;
+                }
+            }
+
+            count += 4;
+
+            valid = valid                                        &&
+                    (offset != 0)                                &&
+                    (offset <= static_cast<size_t>(pOut - pDst)) &&
+                    (count <= (dstSize - (pOut - pDst)));
+
+            // Matches may overlap their own output, so this has to be a forward byte copy.
+            for (size_t idx = 0; valid && (idx < count); ++idx)
+            {
+                *pOut = *(pOut - offset);
+                ++pOut;
+            }
+        }
+    }
+
+    return valid && (static_cast<size_t>(pOut - pDst) == dstSize);
+}
+
+// =====================================================================================================================
+// Returns true if pData holds nothing but whole type-3 packets.  The optimizer asserts on anything else.
+static bool IsValidPm4Stream(
+    const uint32* pData,
+    size_t        sizeInDwords)
+{
+    size_t offset = 0;
+
+    while ((offset < sizeInDwords) && ((pData[offset] >> 30) == 3))
+    {
+        offset += ((pData[offset] >> 16) & 0x3FFF) + 2;
+    }
+
+    return (offset == sizeInDwords);
+}
+
+// =====================================================================================================================
+// Parses one submission dumped in CmdBufDumpModeBinaryHeaders mode: a CmdBufferDumpFileHeader, a CmdBufferListHeader
+// and then one CmdBufferDumpHeader plus data per chunk.  Chunks which aren't DE chunks or don't hold whole type-3
+// packets are counted in pSkippedChunks instead of being replayed.
+static Result ParseSubmission(
+    const uint8*             pData,
+    size_t                   size,
+    std::vector<Submission>* pSubmissions,
+    uint32*                  pSkippedChunks)
+{
+    Result     result = Result::ErrorInvalidFormat;
+    Submission submission;
+
+    CmdBufferDumpFileHeader fileHeader = {};
+    CmdBufferListHeader     listHeader = {};
+
+    if (size >= sizeof(fileHeader))
+    {
+        memcpy(&fileHeader, pData, sizeof(fileHeader));
+
+        if ((fileHeader.size >= sizeof(fileHeader)) &&
+            (fileHeader.size <= size)                &&
+            ((size - fileHeader.size) >= sizeof(listHeader)))
+        {
+            memcpy(&listHeader, pData + fileHeader.size, sizeof(listHeader));
+
+            if ((listHeader.size >= sizeof(listHeader)) && ((size - fileHeader.size) >= listHeader.size))
+            {
+                result = Result::Success;
+            }
+        }
+    }
+
+    size_t offset = fileHeader.size + listHeader.size;
+
+    for (uint32 idx = 0; (result == Result::Success) && (idx < listHeader.count); ++idx)
+    {
+        CmdBufferDumpHeader chunkHeader = {};
+
+        if ((size - offset) >= sizeof(chunkHeader))
+        {
+            memcpy(&chunkHeader, pData + offset, sizeof(chunkHeader));
+        }
+
+        if ((chunkHeader.size < sizeof(chunkHeader))                   ||
+            ((size - offset) < chunkHeader.size)                       ||
+            ((size - offset - chunkHeader.size) < chunkHeader.cmdBufferSize))
+        {
+            result = Result::ErrorInvalidFormat;
+        }
+        else
+        {
+            const uint8*const pChunkData   = pData + offset + chunkHeader.size;
+            const size_t      sizeInDwords = chunkHeader.cmdBufferSize / sizeof(uint32);
+
+            std::vector<uint32> chunk(sizeInDwords);
+            memcpy(chunk.data(), pChunkData, sizeInDwords * sizeof(uint32));
+
+            if ((chunkHeader.subEngineId == 0) && IsValidPm4Stream(chunk.data(), chunk.size()))
+            {
+                submission.chunks.push_back(chunk);
+            }
+            else
+            {
+                ++(*pSkippedChunks);
+            }
+
+            offset += chunkHeader.size + chunkHeader.cmdBufferSize;
+        }
+    }
+
+    if ((result == Result::Success) && (submission.chunks.empty() == false))
+    {
+        pSubmissions->push_back(submission);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Parses a CmdBufDumpWriter container by walking its records, which also works for containers without an index.
+static Result ParseContainer(
+    const std::vector<uint8>& file,
+    std::vector<Submission>*  pSubmissions,
+    uint32*                   pSkippedChunks)
+{
+    Result result = Result::Success;
+
+    CmdBufDumpContainerHeader header = {};
+    memcpy(&header, file.data(), sizeof(header));
+
+    if ((header.size < sizeof(header))                 ||
+        (header.size > file.size())                    ||
+        (header.version != CmdBufDumpContainerVersion) ||
+        (header.dumpMode != static_cast<uint32>(CmdBufDumpMode::CmdBufDumpModeBinaryHeaders)))
+    {
+        fprintf(stderr, "Only version %u containers dumped with binary headers are supported.\n",
+                CmdBufDumpContainerVersion);
+        result = Result::ErrorInvalidFormat;
+    }
+
+    std::vector<uint8> record;
+    size_t             offset = header.size;
+
+    while ((result == Result::Success) && ((file.size() - offset) >= sizeof(CmdBufDumpRecordHeader)))
+    {
+        CmdBufDumpRecordHeader recordHeader = {};
+        memcpy(&recordHeader, file.data() + offset, sizeof(recordHeader));
+
+        // The index follows the last record.
+        if (recordHeader.magic != CmdBufDumpRecordMagic)
+        {
+            break;
+        }
+
+        offset += sizeof(recordHeader);
+
+        if ((file.size() - offset) < recordHeader.storedSize)
+        {
+            result = Result::ErrorInvalidFormat;
+        }
+        else
+        {
+            record.resize(static_cast<size_t>(recordHeader.rawSize));
+        }
+
+        size_t recordOffset = 0;
+
+        for (uint32 idx = 0; (result == Result::Success) && (idx < recordHeader.numChunks); ++idx)
+        {
+            CmdBufDumpChunkHeader chunkHeader = {};
+
+            if ((file.size() - offset) >= sizeof(chunkHeader))
+            {
+                memcpy(&chunkHeader, file.data() + offset, sizeof(chunkHeader));
+                offset += sizeof(chunkHeader);
+            }
+
+            // A chunk header which runs past the end of the file is left zeroed, which fails the rawSize check below.
+            if ((chunkHeader.rawSize == 0)                        ||
+                ((file.size() - offset) < chunkHeader.storedSize) ||
+                ((record.size() - recordOffset) < chunkHeader.rawSize))
+            {
+                result = Result::ErrorInvalidFormat;
+            }
+            else if (chunkHeader.storedSize < chunkHeader.rawSize)
+            {
+                if (Lz4DecompressBlock(file.data() + offset,
+                                       chunkHeader.storedSize,
+                                       record.data() + recordOffset,
+                                       chunkHeader.rawSize) == false)
+                {
+                    result = Result::ErrorInvalidFormat;
+                }
+            }
+            else
+            {
+                memcpy(record.data() + recordOffset, file.data() + offset, chunkHeader.rawSize);
+            }
+
+            offset       += chunkHeader.storedSize;
+            recordOffset += chunkHeader.rawSize;
+        }
+
+        if (result == Result::Success)
+        {
+            result = ParseSubmission(record.data(), recordOffset, pSubmissions, pSkippedChunks);
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Loads every submission from a dump file, which may either be a container or a single per-submission dump.
+static Result LoadDumpFile(
+    const char*              pFilename,
+    std::vector<Submission>* pSubmissions)
+{
+    Result result   = Result::ErrorInvalidValue;
+    File   file;
+    uint32 skipped  = 0;
+
+    const size_t fileSize = File::GetFileSize(pFilename);
+
+    std::vector<uint8> data(fileSize);
+
+    if ((fileSize >= sizeof(CmdBufDumpContainerHeader)) &&
+        (file.Open(pFilename, FileAccessRead | FileAccessBinary) == Result::Success))
+    {
+        size_t bytesRead = 0;
+        result = file.Read(data.data(), fileSize, &bytesRead);
+
+        if ((result == Result::Success) && (bytesRead != fileSize))
+        {
+            result = Result::ErrorUnknown;
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        uint32 magic = 0;
+        memcpy(&magic, data.data(), sizeof(magic));
+
+        if (magic == CmdBufDumpContainerMagic)
+        {
+            result = ParseContainer(data, pSubmissions, &skipped);
+        }
+        else
+        {
+            result = ParseSubmission(data.data(), data.size(), pSubmissions, &skipped);
+        }
+    }
+
+    if (result != Result::Success)
+    {
+        fprintf(stderr, "Failed to load the command buffer dump \"%s\".\n", pFilename);
+    }
+    else if (skipped > 0)
+    {
+        printf("Skipped %u CE or unparsable chunk(s) in \"%s\".\n", skipped, pFilename);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Creates a platform for the requested null device and initializes its one device, which must be a GFX9 device.
+static Result InitDevice(
+    const char* pGpuName,
+    void*       pPlatformMemory,
+    IPlatform** ppPlatform,
+    IDevice**   ppDevice)
+{
+    NullGpuInfo nullGpus[static_cast<uint32>(NullGpuId::Max)] = {};
+    uint32      nullGpuCount = static_cast<uint32>(NullGpuId::Max);
+
+    Result result = EnumerateNullDevices(&nullGpuCount, nullGpus);
+
+    PlatformCreateInfo createInfo = {};
+    createInfo.pSettingsPath          = "palPm4OptimizerBench";
+    createInfo.flags.createNullDevice = 1;
+    createInfo.nullGpuId              = NullGpuId::Max;
+
+    for (uint32 idx = 0; (result == Result::Success) && (idx < nullGpuCount); ++idx)
+    {
+        if (strcmp(pGpuName, nullGpus[idx].pGpuName) == 0)
+        {
+            createInfo.nullGpuId = nullGpus[idx].nullGpuId;
+            break;
+        }
+    }
+
+    if ((result == Result::Success) && (createInfo.nullGpuId == NullGpuId::Max))
+    {
+        fprintf(stderr, "Unknown null device \"%s\".\n", pGpuName);
+        result = Result::ErrorInvalidValue;
+    }
+
+    if (result == Result::Success)
+    {
+        result = CreatePlatform(createInfo, pPlatformMemory, ppPlatform);
+    }
+
+    if (result == Result::Success)
+    {
+        IDevice* pDevices[MaxDevices] = {};
+        uint32   deviceCount          = 0;
+
+        result = (*ppPlatform)->EnumerateDevices(&deviceCount, pDevices);
+
+        if ((result == Result::Success) && (deviceCount == 0))
+        {
+            result = Result::ErrorUnavailable;
+        }
+
+        *ppDevice = pDevices[0];
+    }
+
+    if (result == Result::Success)
+    {
+        result = (*ppDevice)->CommitSettingsAndInit();
+    }
+
+    if (result == Result::Success)
+    {
+        const Device*const pCoreDevice = static_cast<Device*>(*ppDevice);
+
+        if ((pCoreDevice->GetGfxDevice() == nullptr) || (pCoreDevice->ChipProperties().gfxLevel != GfxIpLevel::GfxIp9))
+        {
+            fprintf(stderr, "The %s null device is not a GFX9 device.\n", pGpuName);
+            result = Result::ErrorUnavailable;
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Replays every submission through the optimizer loops times and prints the throughput and filtering ratio.
+static void RunBenchmark(
+    const Gfx9::Device&            device,
+    const std::vector<Submission>& submissions,
+    uint32                         loops)
+{
+    Gfx9::Pm4Optimizer optimizer(device);
+
+    size_t maxChunkSize = 0;
+    uint64 dwordsIn     = 0;
+    uint64 dwordsOut    = 0;
+
+    for (const Submission& submission : submissions)
+    {
+        for (const std::vector<uint32>& chunk : submission.chunks)
+        {
+            maxChunkSize = Max(maxChunkSize, chunk.size());
+        }
+    }
+
+    // Optimizing out of place keeps the captured streams intact for the next loop.
+    std::vector<uint32> output(maxChunkSize);
+
+    const int64 startTime = GetPerfCpuTime();
+
+    for (uint32 loop = 0; loop < loops; ++loop)
+    {
+        for (const Submission& submission : submissions)
+        {
+            optimizer.Reset();
+
+            for (const std::vector<uint32>& chunk : submission.chunks)
+            {
+                uint32 cmdSize = static_cast<uint32>(chunk.size());
+
+                optimizer.OptimizePm4Commands(chunk.data(), output.data(), &cmdSize);
+
+                dwordsIn  += chunk.size();
+                dwordsOut += cmdSize;
+            }
+        }
+    }
+
+    const int64  endTime = GetPerfCpuTime();
+    const double seconds = static_cast<double>(endTime - startTime) / GetPerfFrequency();
+
+    printf("Replayed %llu DWORDs from %u submission(s) %u time(s) in %.3f ms.\n",
+           static_cast<unsigned long long>(dwordsIn),
+           static_cast<uint32>(submissions.size()),
+           loops,
+           seconds * 1000.0);
+    printf("    Throughput: %.1f MB/s (%.1f MDWORDs/s)\n",
+           (seconds > 0.0) ? ((dwordsIn * sizeof(uint32)) / (seconds * 1000000.0)) : 0.0,
+           (seconds > 0.0) ? (dwordsIn / (seconds * 1000000.0)) : 0.0);
+    printf("    Output: %llu DWORDs (%.1f%% of the input)\n",
+           static_cast<unsigned long long>(dwordsOut),
+           (dwordsIn > 0) ? ((dwordsOut * 100.0) / dwordsIn) : 0.0);
+}
+
+// =====================================================================================================================
+int main(
+    int   argc,
+    char* argv[])
+{
+    const char* pGpuName  = "Vega10";
+    uint32      loops     = 100;
+    bool        validArgs = true;
+
+    std::vector<const char*> dumpFiles;
+
+    for (int idx = 1; validArgs && (idx < argc); ++idx)
+    {
+        if ((strcmp(argv[idx], "--gpu") == 0) && (idx + 1 < argc))
+        {
+            pGpuName = argv[++idx];
+        }
+        else if ((strcmp(argv[idx], "--loops") == 0) && (idx + 1 < argc))
+        {
+            loops = static_cast<uint32>(strtoul(argv[++idx], nullptr, 0));
+        }
+        else if (argv[idx][0] != '-')
+        {
+            dumpFiles.push_back(argv[idx]);
+        }
+        else
+        {
+            validArgs = false;
+        }
+    }
+
+    if ((validArgs == false) || (loops == 0) || dumpFiles.empty())
+    {
+        fprintf(stderr, "Usage: %s [--gpu <null device name>] [--loops <count>] <dump file>...\n", argv[0]);
+        return 1;
+    }
+
+    std::vector<Submission> submissions;
+
+    Result result = Result::Success;
+
+    for (const char* pFilename : dumpFiles)
+    {
+        if (result == Result::Success)
+        {
+            result = LoadDumpFile(pFilename, &submissions);
+        }
+    }
+
+    if ((result == Result::Success) && submissions.empty())
+    {
+        fprintf(stderr, "The dump files don't contain any DE command streams.\n");
+        result = Result::ErrorInvalidValue;
+    }
+
+    void*      pPlatformMemory = malloc(GetPlatformSize());
+    IPlatform* pPlatform       = nullptr;
+    IDevice*   pDevice         = nullptr;
+
+    if ((result == Result::Success) && (pPlatformMemory == nullptr))
+    {
+        result = Result::ErrorOutOfMemory;
+    }
+
+    if (result == Result::Success)
+    {
+        result = InitDevice(pGpuName, pPlatformMemory, &pPlatform, &pDevice);
+    }
+
+    if (result == Result::Success)
+    {
+        const auto*const pGfxDevice = static_cast<Device*>(pDevice)->GetGfxDevice();
+
+        RunBenchmark(*static_cast<const Gfx9::Device*>(pGfxDevice), submissions, loops);
+    }
+
+    if (pDevice != nullptr)
+    {
+        pDevice->Cleanup();
+    }
+
+    if (pPlatform != nullptr)
+    {
+        pPlatform->Destroy();
+    }
+
+    free(pPlatformMemory);
+
+    if (result != Result::Success)
+    {
+        fprintf(stderr, "Benchmark failed with result %d.\n", static_cast<int>(result));
+    }
+
+    return (result == Result::Success) ? 0 : 1;
+}
@@ -0,0 +1,544 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+// palSubmitBench measures the CPU cost of the Linux submission path.  PAL must be built with PAL_BUILD_DRM_MOCK so that
+// the device, queue and every kernel call are backed by the in-process libdrm_amdgpu mock; no GPU is needed.  The
+// benchmark records a set of universal command buffers once and then submits them over and over along with a set of
+// per-submit GPU memory references, waiting on a fence every few submits like a throttled client would.  It reports
+// submit throughput plus the mock's counters per submit, which shows how often SubmitIbs() and UpdateResourceList()
+// had to rebuild BO lists.
+//
+// Usage: palSubmitBench [--submits <count>] [--cmdbufs <count>] [--refs <count>] [--churn]
+//                       [--fence-interval <count>] [--latency <ns>]
+//
+// With --churn every submit references a different window of memory objects, which defeats any resource list caching
+// and exposes the cost of rebuilding the list from scratch.
+
+#include "pal.h"
+#include "palCmdAllocator.h"
+#include "palCmdBuffer.h"
+#include "palDevice.h"
+#include "palFence.h"
+#include "palGpuMemory.h"
+#include "palLib.h"
+#include "palPlatform.h"
+#include "palQueue.h"
+#include "palSysUtil.h"
+
+#include "core/os/lnx/drmMock.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace Pal;
+using namespace Util;
+
+// Benchmark parameters.
+struct SubmitBenchConfig
+{
+    uint32 numSubmits;     // Number of timed submits.
+    uint32 numCmdBuffers;  // Number of command buffers per submit.
+    uint32 numRefs;        // Number of GPU memory references per submit.
+    bool   churn;          // If set, each submit references a different window of memory objects.
+    uint32 fenceInterval;  // A fence is attached to, and waited on, every fenceInterval submits.
+    uint64 latencyNs;      // Simulated GPU execution time of each submit.
+};
+
+// =====================================================================================================================
+class SubmitBench
+{
+public:
+    SubmitBench();
+    ~SubmitBench();
+
+    Result Init(const SubmitBenchConfig& config);
+    Result Run();
+
+private:
+    Result CreateCmdBuffers();
+    Result CreateGpuMemory();
+    Result Submit(uint32 submitIdx, bool* pFenceSubmitted);
+
+    SubmitBenchConfig          m_config;
+    void*                      m_pPlatformMemory;
+    IPlatform*                 m_pPlatform;
+    IDevice*                   m_pDevice;
+    IQueue*                    m_pQueue;
+    ICmdAllocator*             m_pCmdAllocator;
+    IFence*                    m_pFence;
+    std::vector<ICmdBuffer*>   m_cmdBuffers;
+    std::vector<IGpuMemory*>   m_gpuMemory;
+    std::vector<GpuMemoryRef>  m_memRefs;
+
+    // Placement memory for every object above; it's only freed once all of the objects have been destroyed.
+    std::vector<void*>         m_objectMemory;
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(SubmitBench);
+};
+
+// =====================================================================================================================
+SubmitBench::SubmitBench()
+    :
+    m_config(),
+    m_pPlatformMemory(nullptr),
+    m_pPlatform(nullptr),
+    m_pDevice(nullptr),
+    m_pQueue(nullptr),
+    m_pCmdAllocator(nullptr),
+    m_pFence(nullptr)
+{
+}
+
+// =====================================================================================================================
+SubmitBench::~SubmitBench()
+{
+    if (m_pQueue != nullptr)
+    {
+        m_pQueue->WaitIdle();
+    }
+
+    for (IGpuMemory* pGpuMemory : m_gpuMemory)
+    {
+        pGpuMemory->Destroy();
+    }
+
+    for (ICmdBuffer* pCmdBuffer : m_cmdBuffers)
+    {
+        pCmdBuffer->Destroy();
+    }
+
+    if (m_pFence != nullptr)
+    {
+        m_pFence->Destroy();
+    }
+
+    if (m_pCmdAllocator != nullptr)
+    {
+        m_pCmdAllocator->Destroy();
+    }
+
+    if (m_pQueue != nullptr)
+    {
+        m_pQueue->Destroy();
+    }
+
+    for (void* pMemory : m_objectMemory)
+    {
+        free(pMemory);
+    }
+
+    if (m_pDevice != nullptr)
+    {
+        m_pDevice->Cleanup();
+    }
+
+    if (m_pPlatform != nullptr)
+    {
+        m_pPlatform->Destroy();
+    }
+
+    free(m_pPlatformMemory);
+}
+
+// =====================================================================================================================
+// Allocates placement memory for one object. The memory is tracked so that the destructor can free it.
+static void* AllocObjectMemory(
+    size_t              size,
+    std::vector<void*>* pObjectMemory)
+{
+    void* pMemory = (size > 0) ? malloc(size) : nullptr;
+
+    if (pMemory != nullptr)
+    {
+        pObjectMemory->push_back(pMemory);
+    }
+
+    return pMemory;
+}
+
+// =====================================================================================================================
+// Creates the platform, the mock device and everything each submit needs.
+Result SubmitBench::Init(
+    const SubmitBenchConfig& config)
+{
+    m_config = config;
+
+    PlatformCreateInfo createInfo = {};
+    createInfo.pSettingsPath = "palSubmitBench";
+
+    m_pPlatformMemory = malloc(GetPlatformSize());
+
+    Result result = (m_pPlatformMemory != nullptr) ? CreatePlatform(createInfo, m_pPlatformMemory, &m_pPlatform)
+                                                   : Result::ErrorOutOfMemory;
+
+    if (result == Result::Success)
+    {
+        IDevice* pDevices[MaxDevices] = {};
+        uint32   deviceCount          = 0;
+
+        result = m_pPlatform->EnumerateDevices(&deviceCount, pDevices);
+
+        if ((result == Result::Success) && (deviceCount == 0))
+        {
+            result = Result::ErrorUnavailable;
+        }
+
+        m_pDevice = pDevices[0];
+    }
+
+    if (result == Result::Success)
+    {
+        // The mock's global state is set up once the platform has loaded its DRM function table to enumerate devices.
+        Linux::DrmMock::SetSubmitLatency(config.latencyNs);
+
+        result = m_pDevice->CommitSettingsAndInit();
+    }
+
+    if (result == Result::Success)
+    {
+        DeviceFinalizeInfo finalizeInfo = {};
+        finalizeInfo.requestedEngineCounts[EngineTypeUniversal].engines = 1;
+
+        result = m_pDevice->Finalize(finalizeInfo);
+    }
+
+    if (result == Result::Success)
+    {
+        QueueCreateInfo queueInfo = {};
+        queueInfo.queueType  = QueueTypeUniversal;
+        queueInfo.engineType = EngineTypeUniversal;
+
+        void*const pMemory = AllocObjectMemory(m_pDevice->GetQueueSize(queueInfo, &result), &m_objectMemory);
+
+        if (result == Result::Success)
+        {
+            result = (pMemory != nullptr) ? m_pDevice->CreateQueue(queueInfo, pMemory, &m_pQueue)
+                                          : Result::ErrorOutOfMemory;
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        const FenceCreateInfo fenceInfo = {};
+
+        void*const pMemory = AllocObjectMemory(m_pDevice->GetFenceSize(&result), &m_objectMemory);
+
+        if (result == Result::Success)
+        {
+            result = (pMemory != nullptr) ? m_pDevice->CreateFence(fenceInfo, pMemory, &m_pFence)
+                                          : Result::ErrorOutOfMemory;
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        result = CreateCmdBuffers();
+    }
+
+    if (result == Result::Success)
+    {
+        result = CreateGpuMemory();
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Creates and records the command buffers. They're recorded once and resubmitted, so only the submit path is timed.
+Result SubmitBench::CreateCmdBuffers()
+{
+    CmdAllocatorCreateInfo allocatorInfo = {};
+
+    for (uint32 idx = 0; idx < CmdAllocatorTypeCount; ++idx)
+    {
+        allocatorInfo.allocInfo[idx].allocHeap    = GpuHeapGartUswc;
+        allocatorInfo.allocInfo[idx].allocSize    = 2 * 1024 * 1024;
+        allocatorInfo.allocInfo[idx].suballocSize = 64 * 1024;
+    }
+
+    Result     result  = Result::Success;
+    void*const pMemory = AllocObjectMemory(m_pDevice->GetCmdAllocatorSize(allocatorInfo, &result), &m_objectMemory);
+
+    if (result == Result::Success)
+    {
+        result = (pMemory != nullptr) ? m_pDevice->CreateCmdAllocator(allocatorInfo, pMemory, &m_pCmdAllocator)
+                                      : Result::ErrorOutOfMemory;
+    }
+
+    CmdBufferCreateInfo cmdBufferInfo = {};
+    cmdBufferInfo.pCmdAllocator = m_pCmdAllocator;
+    cmdBufferInfo.queueType     = QueueTypeUniversal;
+    cmdBufferInfo.engineType    = EngineTypeUniversal;
+
+    for (uint32 idx = 0; (result == Result::Success) && (idx < m_config.numCmdBuffers); ++idx)
+    {
+        void*const pCmdBufferMemory =
+            AllocObjectMemory(m_pDevice->GetCmdBufferSize(cmdBufferInfo, &result), &m_objectMemory);
+
+        ICmdBuffer* pCmdBuffer = nullptr;
+
+        if (result == Result::Success)
+        {
+            result = (pCmdBufferMemory != nullptr)
+                         ? m_pDevice->CreateCmdBuffer(cmdBufferInfo, pCmdBufferMemory, &pCmdBuffer)
+                         : Result::ErrorOutOfMemory;
+        }
+
+        if (result == Result::Success)
+        {
+            m_cmdBuffers.push_back(pCmdBuffer);
+
+            const CmdBufferBuildInfo buildInfo = {};
+
+            result = pCmdBuffer->Begin(buildInfo);
+        }
+
+        if (result == Result::Success)
+        {
+            result = pCmdBuffer->End();
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Creates the GPU memory objects which the submits reference. Churning needs twice as many so that every submit can
+// use a different window.
+Result SubmitBench::CreateGpuMemory()
+{
+    GpuMemoryCreateInfo createInfo = {};
+    createInfo.size      = 64 * 1024;
+    createInfo.vaRange   = VaRange::Default;
+    createInfo.priority  = GpuMemPriority::Normal;
+    createInfo.heapCount = 1;
+    createInfo.heaps[0]  = GpuHeapGartUswc;
+
+    const uint32 numObjects = m_config.churn ? (m_config.numRefs * 2) : m_config.numRefs;
+
+    Result result = Result::Success;
+
+    for (uint32 idx = 0; (result == Result::Success) && (idx < numObjects); ++idx)
+    {
+        void*const pMemory = AllocObjectMemory(m_pDevice->GetGpuMemorySize(createInfo, &result), &m_objectMemory);
+
+        IGpuMemory* pGpuMemory = nullptr;
+
+        if (result == Result::Success)
+        {
+            result = (pMemory != nullptr) ? m_pDevice->CreateGpuMemory(createInfo, pMemory, &pGpuMemory)
+                                          : Result::ErrorOutOfMemory;
+        }
+
+        if (result == Result::Success)
+        {
+            m_gpuMemory.push_back(pGpuMemory);
+        }
+    }
+
+    m_memRefs.resize(m_config.numRefs);
+
+    return result;
+}
+
+// =====================================================================================================================
+// Performs one submit. Every fenceInterval submits the fence from the previous interval is waited on and reused, which
+// keeps the simulated GPU from falling arbitrarily far behind.
+Result SubmitBench::Submit(
+    uint32 submitIdx,
+    bool*  pFenceSubmitted)
+{
+    Result result = Result::Success;
+
+    const uint32 window = m_config.churn ? (submitIdx % (m_config.numRefs + 1)) : 0;
+
+    for (uint32 idx = 0; idx < m_config.numRefs; ++idx)
+    {
+        m_memRefs[idx].flags.u32All = 0;
+        m_memRefs[idx].pGpuMemory   = m_gpuMemory[window + idx];
+    }
+
+    SubmitInfo submitInfo = {};
+    submitInfo.cmdBufferCount = static_cast<uint32>(m_cmdBuffers.size());
+    submitInfo.ppCmdBuffers   = m_cmdBuffers.data();
+    submitInfo.gpuMemRefCount = m_config.numRefs;
+    submitInfo.pGpuMemoryRefs = m_memRefs.data();
+
+    if ((submitIdx % m_config.fenceInterval) == (m_config.fenceInterval - 1))
+    {
+        if (*pFenceSubmitted)
+        {
+            const IFence*const pFence = m_pFence;
+
+            result = m_pDevice->WaitForFences(1, &pFence, true, UINT64_MAX);
+
+            if (result == Result::Success)
+            {
+                result = m_pDevice->ResetFences(1, &m_pFence);
+            }
+        }
+
+        submitInfo.pFence = m_pFence;
+        *pFenceSubmitted  = true;
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_pQueue->Submit(submitInfo);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Runs the timed submit loop and reports the results.
+Result SubmitBench::Run()
+{
+    bool fenceSubmitted = false;
+
+    // One untimed submit makes sure every first-use allocation along the submit path is out of the way.
+    Result result = Submit(0, &fenceSubmitted);
+
+    if (result == Result::Success)
+    {
+        result = m_pQueue->WaitIdle();
+    }
+
+    Linux::DrmMock::ResetStats();
+
+    const int64 startTime = GetPerfCpuTime();
+
+    for (uint32 idx = 0; (result == Result::Success) && (idx < m_config.numSubmits); ++idx)
+    {
+        result = Submit(idx, &fenceSubmitted);
+    }
+
+    const int64 endTime = GetPerfCpuTime();
+
+    Linux::DrmMockStats stats = {};
+    Linux::DrmMock::GetStats(&stats);
+
+    if (result == Result::Success)
+    {
+        const double seconds = static_cast<double>(endTime - startTime) / GetPerfFrequency();
+        const double submits = m_config.numSubmits;
+
+        printf("%u submits of %u command buffer(s) and %u memory reference(s)%s in %.3f ms\n",
+               m_config.numSubmits,
+               m_config.numCmdBuffers,
+               m_config.numRefs,
+               m_config.churn ? " with churn" : "",
+               seconds * 1000.0);
+        printf("    Throughput: %.0f submits/s (%.2f us/submit)\n",
+               (seconds > 0.0) ? (submits / seconds) : 0.0,
+               (seconds * 1000000.0) / submits);
+        printf("    Per submit: %.2f kernel submits, %.2f IBs, %.2f BO list creates, %.2f BO list entries\n",
+               stats.submitCount / submits,
+               stats.ibCount / submits,
+               stats.boListCreateCount / submits,
+               stats.boListEntryCount / submits);
+        printf("    Per submit: %.2f syncobj waits, %.2f syncobj signals, %.2f fence queries\n",
+               stats.syncobjWaitCount / submits,
+               stats.syncobjSignalCount / submits,
+               stats.fenceQueryCount / submits);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+int main(
+    int   argc,
+    char* argv[])
+{
+    SubmitBenchConfig config = {};
+    config.numSubmits    = 100000;
+    config.numCmdBuffers = 1;
+    config.numRefs       = 64;
+    config.churn         = false;
+    config.fenceInterval = 64;
+    config.latencyNs     = 0;
+
+    bool validArgs = true;
+
+    for (int idx = 1; validArgs && (idx < argc); ++idx)
+    {
+        if ((strcmp(argv[idx], "--submits") == 0) && (idx + 1 < argc))
+        {
+            config.numSubmits = static_cast<uint32>(strtoul(argv[++idx], nullptr, 0));
+        }
+        else if ((strcmp(argv[idx], "--cmdbufs") == 0) && (idx + 1 < argc))
+        {
+            config.numCmdBuffers = static_cast<uint32>(strtoul(argv[++idx], nullptr, 0));
+        }
+        else if ((strcmp(argv[idx], "--refs") == 0) && (idx + 1 < argc))
+        {
+            config.numRefs = static_cast<uint32>(strtoul(argv[++idx], nullptr, 0));
+        }
+        else if (strcmp(argv[idx], "--churn") == 0)
+        {
+            config.churn = true;
+        }
+        else if ((strcmp(argv[idx], "--fence-interval") == 0) && (idx + 1 < argc))
+        {
+            config.fenceInterval = static_cast<uint32>(strtoul(argv[++idx], nullptr, 0));
+        }
+        else if ((strcmp(argv[idx], "--latency") == 0) && (idx + 1 < argc))
+        {
+            config.latencyNs = strtoull(argv[++idx], nullptr, 0);
+        }
+        else
+        {
+            validArgs = false;
+        }
+    }
+
+    if ((validArgs == false) || (config.numSubmits == 0) || (config.numCmdBuffers == 0) ||
+        (config.fenceInterval == 0))
+    {
+        fprintf(stderr,
+                "Usage: %s [--submits <count>] [--cmdbufs <count>] [--refs <count>] [--churn]\n"
+                "       [--fence-interval <count>] [--latency <ns>]\n",
+                argv[0]);
+        return 1;
+    }
+
+    SubmitBench bench;
+
+    Result result = bench.Init(config);
+
+    if (result == Result::Success)
+    {
+        result = bench.Run();
+    }
+
+    if (result != Result::Success)
+    {
+        fprintf(stderr, "Benchmark failed with result %d.\n", static_cast<int>(result));
+    }
+
+    return (result == Result::Success) ? 0 : 1;
+}
@@ -0,0 +1,453 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+// palTransferBench measures the throughput of the GPUOpen transfer protocol by moving blocks between two message
+// channels in the same process.  The channels talk over an in-process loopback transport instead of the message bus so
+// the numbers only include the cost of the transfer protocol, the session layer and the message channels themselves.
+//
+// Usage: palTransferBench [--loops <count>] [--size <block size in bytes>]
+//
+// Without --size, blocks sized like a crash dump (4 MiB) and like an RGP trace (256 MiB) are measured.  Every loop opens
+// the remote block from scratch, so the reported times include establishing the transfer session just like a tool's
+// download would.
+
+#include "messageChannel.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+using namespace DevDriver;
+using namespace DevDriver::TransferProtocol;
+
+// =====================================================================================================================
+// Routes messages between every transport connected to it.  Each connected client gets its own receive queue; messages
+// addressed to the broadcast client ID are delivered to every client except the sender.
+class LoopbackBus
+{
+public:
+    LoopbackBus() : m_nextClientId(1) { }
+
+    ClientId Connect();
+    void Disconnect(ClientId clientId);
+
+    Result Write(const MessageBuffer& messageBuffer);
+    Result Read(ClientId clientId, MessageBuffer* pMessageBuffer, uint32 timeoutInMs);
+
+private:
+    struct Client
+    {
+        ClientId                  clientId;
+        std::deque<MessageBuffer> queue;
+    };
+
+    Client* FindClient(ClientId clientId);
+
+    std::mutex              m_mutex;
+    std::condition_variable m_messageAvailable;
+    std::deque<Client>      m_clients;
+    ClientId                m_nextClientId;
+};
+
+// =====================================================================================================================
+ClientId LoopbackBus::Connect()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    Client client = {};
+    client.clientId = m_nextClientId++;
+    m_clients.push_back(client);
+
+    return client.clientId;
+}
+
+// =====================================================================================================================
+void LoopbackBus::Disconnect(
+    ClientId clientId)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (auto it = m_clients.begin(); it != m_clients.end(); ++it)
+    {
+        if (it->clientId == clientId)
+        {
+            m_clients.erase(it);
+            break;
+        }
+    }
+}
+
+// =====================================================================================================================
+LoopbackBus::Client* LoopbackBus::FindClient(
+    ClientId clientId)
+{
+    Client* pClient = nullptr;
+
+    for (Client& client : m_clients)
+    {
+        if (client.clientId == clientId)
+        {
+            pClient = &client;
+            break;
+        }
+    }
+
+    return pClient;
+}
+
+// =====================================================================================================================
+Result LoopbackBus::Write(
+    const MessageBuffer& messageBuffer)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (messageBuffer.header.dstClientId == kBroadcastClientId)
+        {
+            for (Client& client : m_clients)
+            {
+                if (client.clientId != messageBuffer.header.srcClientId)
+                {
+                    client.queue.push_back(messageBuffer);
+                }
+            }
+        }
+        else
+        {
+            Client* pClient = FindClient(messageBuffer.header.dstClientId);
+
+            // Messages for clients which have gone away are dropped, just like on the real message bus.
+            if (pClient != nullptr)
+            {
+                pClient->queue.push_back(messageBuffer);
+            }
+        }
+    }
+
+    m_messageAvailable.notify_all();
+
+    return Result::Success;
+}
+
+// =====================================================================================================================
+Result LoopbackBus::Read(
+    ClientId       clientId,
+    MessageBuffer* pMessageBuffer,
+    uint32         timeoutInMs)
+{
+    Result result = Result::NotReady;
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutInMs);
+
+    Client* pClient = FindClient(clientId);
+
+    while ((pClient != nullptr) && pClient->queue.empty())
+    {
+        if (m_messageAvailable.wait_until(lock, deadline) == std::cv_status::timeout)
+        {
+            break;
+        }
+
+        pClient = FindClient(clientId);
+    }
+
+    if (pClient == nullptr)
+    {
+        result = Result::Error;
+    }
+    else if (pClient->queue.empty() == false)
+    {
+        *pMessageBuffer = pClient->queue.front();
+        pClient->queue.pop_front();
+        result = Result::Success;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Message transport which connects a message channel to a LoopbackBus.  Client IDs are handed out by Connect, so the
+// message channel doesn't have to register with a client management server.
+class LoopbackMsgTransport : public IMsgTransport
+{
+public:
+    LoopbackMsgTransport(const TransportCreateInfo& createInfo, LoopbackBus* pBus)
+        :
+        m_pBus(pBus),
+        m_clientId(kBroadcastClientId)
+    {
+    }
+
+    ~LoopbackMsgTransport() { Disconnect(); }
+
+    Result Connect(ClientId* pClientId, uint32 timeoutInMs) override
+    {
+        m_clientId = m_pBus->Connect();
+        *pClientId = m_clientId;
+
+        return Result::Success;
+    }
+
+    Result Disconnect() override
+    {
+        if (m_clientId != kBroadcastClientId)
+        {
+            m_pBus->Disconnect(m_clientId);
+            m_clientId = kBroadcastClientId;
+        }
+
+        return Result::Success;
+    }
+
+    Result WriteMessage(const MessageBuffer& messageBuffer) override
+        { return m_pBus->Write(messageBuffer); }
+
+    Result ReadMessage(MessageBuffer& messageBuffer, uint32 timeoutInMs) override
+        { return m_pBus->Read(m_clientId, &messageBuffer, timeoutInMs); }
+
+#if !DD_VERSION_SUPPORTS(GPUOPEN_DISTRIBUTED_STATUS_FLAGS_VERSION)
+    Result UpdateClientStatus(ClientId clientId, StatusFlags flags) override
+        { return Result::Success; }
+#endif
+
+private:
+    LoopbackBus* m_pBus;
+    ClientId     m_clientId;
+};
+
+typedef MessageChannel<LoopbackMsgTransport> LoopbackMsgChannel;
+
+// =====================================================================================================================
+static void* BenchAlloc(
+    void*  pUserdata,
+    size_t size,
+    size_t alignment,
+    bool   zero)
+{
+    void* pMemory = nullptr;
+
+    if (posix_memalign(&pMemory, alignment, size) != 0)
+    {
+        pMemory = nullptr;
+    }
+    else if (zero)
+    {
+        memset(pMemory, 0, size);
+    }
+
+    return pMemory;
+}
+
+// =====================================================================================================================
+static void BenchFree(
+    void* pUserdata,
+    void* pMemory)
+{
+    free(pMemory);
+}
+
+// =====================================================================================================================
+// Downloads a single block of the given size from the server channel to the client channel loops times and prints the
+// average throughput.
+static Result MeasureTransfer(
+    LoopbackMsgChannel* pServerChannel,
+    LoopbackMsgChannel* pClientChannel,
+    size_t              blockSize,
+    uint32              loops)
+{
+    Result result = Result::Success;
+
+    std::vector<uint8> srcData(blockSize);
+    std::vector<uint8> dstData(blockSize);
+
+    for (size_t idx = 0; idx < blockSize; ++idx)
+    {
+        srcData[idx] = static_cast<uint8>(idx * 131);
+    }
+
+    SharedPointer<LocalBlock> pLocalBlock = pServerChannel->GetTransferManager().AcquireLocalBlock();
+
+    if (pLocalBlock.IsNull())
+    {
+        result = Result::Error;
+    }
+    else
+    {
+        pLocalBlock->Write(srcData.data(), blockSize);
+        pLocalBlock->Close();
+    }
+
+    double totalSeconds = 0.0;
+
+    for (uint32 loop = 0; (result == Result::Success) && (loop < loops); ++loop)
+    {
+        const auto start = std::chrono::steady_clock::now();
+
+        RemoteBlock* pRemoteBlock =
+            pClientChannel->GetTransferManager().OpenRemoteBlock(pServerChannel->GetClientId(),
+                                                                 pLocalBlock->GetBlockId());
+        size_t totalRead = 0;
+
+        if (pRemoteBlock == nullptr)
+        {
+            result = Result::Error;
+        }
+
+        while ((result == Result::Success) && (totalRead < blockSize))
+        {
+            size_t bytesRead = 0;
+            result = pRemoteBlock->Read(dstData.data() + totalRead, (blockSize - totalRead), &bytesRead);
+            totalRead += bytesRead;
+        }
+
+        if (result == Result::EndOfStream)
+        {
+            result = (totalRead == blockSize) ? Result::Success : Result::Error;
+        }
+
+        if (pRemoteBlock != nullptr)
+        {
+            pClientChannel->GetTransferManager().CloseRemoteBlock(&pRemoteBlock);
+        }
+
+        totalSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        if ((result == Result::Success) && (memcmp(srcData.data(), dstData.data(), blockSize) != 0))
+        {
+            fprintf(stderr, "Received data doesn't match the block contents.\n");
+            result = Result::Error;
+        }
+    }
+
+    if (pLocalBlock.IsNull() == false)
+    {
+        pServerChannel->GetTransferManager().ReleaseLocalBlock(pLocalBlock);
+    }
+
+    if (result == Result::Success)
+    {
+        const double megabytes = (static_cast<double>(blockSize) * loops) / (1024.0 * 1024.0);
+
+        printf("%14zu %8u %12.3f %12.1f\n",
+               blockSize,
+               loops,
+               (totalSeconds * 1000.0) / loops,
+               megabytes / totalSeconds);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+int main(
+    int   argc,
+    char* argv[])
+{
+    uint32 loops     = 8;
+    size_t blockSize = 0;
+    bool   validArgs = true;
+
+    for (int idx = 1; validArgs && (idx < argc); ++idx)
+    {
+        if ((strcmp(argv[idx], "--loops") == 0) && (idx + 1 < argc))
+        {
+            loops = static_cast<uint32>(strtoul(argv[++idx], nullptr, 0));
+        }
+        else if ((strcmp(argv[idx], "--size") == 0) && (idx + 1 < argc))
+        {
+            blockSize = static_cast<size_t>(strtoull(argv[++idx], nullptr, 0));
+        }
+        else
+        {
+            validArgs = false;
+        }
+    }
+
+    if ((validArgs == false) || (loops == 0))
+    {
+        fprintf(stderr, "Usage: %s [--loops <count>] [--size <block size in bytes>]\n", argv[0]);
+        return 1;
+    }
+
+    LoopbackBus bus;
+
+    TransportCreateInfo createInfo = {};
+    createInfo.type               = TransportType::Local;
+    createInfo.createUpdateThread = true;
+    createInfo.componentType      = Component::Server;
+    createInfo.allocCb.pfnAlloc   = &BenchAlloc;
+    createInfo.allocCb.pfnFree    = &BenchFree;
+    strncpy(createInfo.clientDescription, "palTransferBench", sizeof(createInfo.clientDescription) - 1);
+
+    LoopbackMsgChannel serverChannel(createInfo, &bus);
+
+    createInfo.componentType = Component::Tool;
+    LoopbackMsgChannel clientChannel(createInfo, &bus);
+
+    Result result = serverChannel.Register();
+
+    if (result == Result::Success)
+    {
+        result = clientChannel.Register();
+    }
+
+    if (result == Result::Success)
+    {
+        printf("%14s %8s %12s %12s\n", "Block Bytes", "Loops", "Avg ms", "MB/s");
+
+        if (blockSize != 0)
+        {
+            result = MeasureTransfer(&serverChannel, &clientChannel, blockSize, loops);
+        }
+        else
+        {
+            // Crash dump and RGP trace sized blocks.
+            static const size_t DefaultSizes[] = { (4 * 1024 * 1024), (256 * 1024 * 1024) };
+
+            const uint32 numSizes = static_cast<uint32>(sizeof(DefaultSizes) / sizeof(DefaultSizes[0]));
+
+            for (uint32 idx = 0; (result == Result::Success) && (idx < numSizes); ++idx)
+            {
+                result = MeasureTransfer(&serverChannel, &clientChannel, DefaultSizes[idx], loops);
+            }
+        }
+    }
+
+    if (result != Result::Success)
+    {
+        fprintf(stderr, "Benchmark failed with result %u.\n", static_cast<uint32>(result));
+    }
+
+    clientChannel.Unregister();
+    serverChannel.Unregister();
+
+    return (result == Result::Success) ? 0 : 1;
+}
@@ -68,6 +68,9 @@ if __name__ == '__main__':
     fp.write("#if PAL_BUILD_DTIF\n")
     fp.write("#include \"../tools/dtif/src/dtifPlatform.h\"\n")
     fp.write("#endif // PAL_BUILD_DTIF\n\n")
+    fp.write("#if PAL_BUILD_DRM_MOCK\n")
+    fp.write("#include \"core/os/lnx/drmMock.h\"\n")
+    fp.write("#endif // PAL_BUILD_DRM_MOCK\n\n")
     fp.write("using namespace Util;\n")
     fp.write("namespace Pal\n")
     fp.write("{\n")
@@ -410,6 +410,17 @@ class ProcMgr:
         fp.write("        }\n")
         fp.write("    }\n")
         fp.write("#endif // PAL_BUILD_DTIF\n\n")
+        fp.write("#if PAL_BUILD_DRM_MOCK\n")
+        fp.write("    // The mock build never loads the real libraries; every entry point is served by the in-process fake amdgpu.\n")
+        fp.write("    if (m_initialized == false)\n")
+        fp.write("    {\n")
+        fp.write("        DrmMock::InitProcsTable(&m_funcs);\n")
+        fp.write("        m_initialized = true;\n")
+        fp.write("#if defined(PAL_DEBUG_PRINTS)\n")
+        fp.write("        m_proxy.SetFuncCalls(&m_funcs);\n")
+        fp.write("#endif\n")
+        fp.write("    }\n")
+        fp.write("#endif // PAL_BUILD_DRM_MOCK\n\n")
         # load function point from libraries.
         fp.write("    if (m_initialized == false)\n")
         fp.write("    {\n")
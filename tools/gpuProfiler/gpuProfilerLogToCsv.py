@@ -0,0 +1,290 @@
+##
+ ###############################################################################
+ #
+ # Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+ #
+ # Permission is hereby granted, free of charge, to any person obtaining a copy
+ # of this software and associated documentation files (the "Software"), to deal
+ # in the Software without restriction, including without limitation the rights
+ # to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ # copies of the Software, and to permit persons to whom the Software is
+ # furnished to do so, subject to the following conditions:
+ #
+ # The above copyright notice and this permission notice shall be included in
+ # all copies or substantial portions of the Software.
+ #
+ # THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ # IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ # FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ # AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ # LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ # OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ # THE SOFTWARE.
+ ##############################################################################/
+
+# Converts binary GPU profiler logs (.gplog) into the .csv files the GPU profiler writes when its output format is
+# GpuProfilerOutputFormatCsv.  The binary format is described in src/core/layers/gpuProfiler/gpuProfilerLogWriter.h.
+#
+# Usage: gpuProfilerLogToCsv.py <.gplog file or directory>...
+#
+# Each foo.gplog is converted to foo.csv next to it.  Directories are searched for .gplog files non-recursively.
+
+import os
+import struct
+import sys
+
+LogFileMagic   = 0x474C5047
+LogBlockMagic  = 0x424C5047
+LogFileVersion = 1
+
+LogFileCalls  = 0
+LogFileFrames = 1
+
+LogFilePipelineStats = 0x1
+LogFileThreadTrace   = 0x2
+
+LogRowTypeMask       = 0x00000003
+LogRowNested         = 0x00000004
+LogRowTimestamps     = 0x00000008
+LogRowHideElapsed    = 0x00000010
+LogRowDraw           = 0x00000020
+LogRowDispatch       = 0x00000040
+LogRowComment        = 0x00000080
+LogRowPipelineStats  = 0x00000100
+LogRowCounters       = 0x00000200
+LogRowCountersFailed = 0x00000400
+LogRowSqttShift      = 12
+LogRowSqttMask       = 0x0000F000
+
+LogSqttNone        = 0
+LogSqttBlank       = 1
+LogSqttTraceId     = 2
+LogSqttNeedsFrame  = 3
+LogSqttOutOfMemory = 4
+LogSqttUnsupported = 5
+
+# LogItemType values.
+QueueCall     = 0
+CmdBufferCall = 1
+Frame         = 2
+
+NumPipelineStats   = 11
+LogShaderSlotCount = 5
+
+FileHeaderFormat  = "<IIIIQIIIIII"
+BlockHeaderFormat = "<IIIIII"
+
+SqttStrings = {
+    LogSqttBlank:       ", ",
+    LogSqttNeedsFrame:  "USE FRAME-GRANULARITY FOR RGP, ",
+    LogSqttOutOfMemory: "ERROR: OUT OF MEMORY, ",
+    LogSqttUnsupported: "ERROR: THREAD TRACE UNSUPPORTED, ",
+}
+
+class LogReader:
+    def __init__(self, data):
+        self.data   = data
+        self.offset = 0
+
+    def Remaining(self):
+        return len(self.data) - self.offset
+
+    def Unpack(self, fmt):
+        values = struct.unpack_from(fmt, self.data, self.offset)
+        self.offset += struct.calcsize(fmt)
+        return values
+
+    def Column(self, code, count):
+        if count == 0:
+            return []
+        return list(self.Unpack("<%d%s" % (count, code)))
+
+    def Bytes(self, size):
+        value = self.data[self.offset:self.offset + size]
+        self.offset += size
+        return value
+
+def CString(heap, offset):
+    end = heap.index(b"\0", offset)
+    return heap[offset:end].decode("utf-8", "replace")
+
+def WriteHeader(out, header, counterNames):
+    if header["fileType"] == LogFileFrames:
+        out.append("Frame #, Start Clock, End Clock, Time (us) [Frequency: %d], " % header["timestampFreq"])
+    else:
+        out.append("Queue Call, CmdBuffer Index, CmdBuffer Call, Start Clock, End Clock, Time (us) "
+                   "[Frequency: %d], PipelineHash, CompilerHash, VS/CS, HS, DS, GS, PS, "
+                   "Verts/ThreadGroups, Instances, Comments, " % header["timestampFreq"])
+        if header["flags"] & LogFilePipelineStats:
+            out.append("IaVertices, IaPrimitives, VsInvocations, GsInvocations, "
+                       "GsPrimitives, CInvocations, CPrimitives, PsInvocations, "
+                       "HsInvocations, DsInvocations, CsInvocations, ")
+
+    for name in counterNames:
+        out.append("%s, " % name)
+
+    if header["flags"] & LogFileThreadTrace:
+        out.append("ThreadTraceId, ")
+
+    out.append("\n")
+
+def WriteTimestamps(out, header, flags, beginClock, endClock):
+    if flags & LogRowTimestamps:
+        out.append("%d, %d, " % (beginClock, endClock))
+        if (flags & LogRowHideElapsed) == 0:
+            tsDiff = float((endClock - beginClock) & 0xFFFFFFFFFFFFFFFF)
+            out.append("%.2f, " % (1000000 * tsDiff / float(header["timestampFreq"])))
+        else:
+            out.append(", ")
+    else:
+        out.append(", , , ")
+
+def ConvertBlock(reader, header, cmdBufCalls, queueCalls, out):
+    (magic, numRows, numPipelineRows, numPipelineStatsRows, numCounterRows, stringHeapSize) = \
+        reader.Unpack(BlockHeaderFormat)
+    if magic != LogBlockMagic:
+        raise ValueError("bad block magic 0x%08x" % magic)
+
+    flags          = reader.Column("I", numRows)
+    callIds        = reader.Column("I", numRows)
+    cmdBufIdxs     = reader.Column("I", numRows)
+    beginClocks    = reader.Column("Q", numRows)
+    endClocks      = reader.Column("Q", numRows)
+    counts0        = reader.Column("I", numRows)
+    counts1        = reader.Column("I", numRows)
+    commentOffsets = reader.Column("I", numRows)
+    traceIds       = reader.Column("I", numRows)
+
+    pipelineHashes = reader.Column("Q", numPipelineRows)
+    compilerHashes = reader.Column("Q", numPipelineRows)
+    shaderHashes   = []
+    for slot in range(LogShaderSlotCount):
+        upper = reader.Column("Q", numPipelineRows)
+        lower = reader.Column("Q", numPipelineRows)
+        shaderHashes.append((upper, lower))
+
+    pipelineStats = [reader.Column("Q", numPipelineStatsRows) for i in range(NumPipelineStats)]
+    counters      = [reader.Column("Q", numCounterRows) for i in range(header["numCounters"])]
+    stringHeap    = reader.Bytes(stringHeapSize)
+
+    pipelineRow = 0
+    statsRow    = 0
+    counterRow  = 0
+
+    for row in range(numRows):
+        rowFlags = flags[row]
+        rowType  = rowFlags & LogRowTypeMask
+
+        if rowType == QueueCall:
+            out.append("%s, , , , , , , , , , , , , , , , " % queueCalls[callIds[row]])
+            if header["flags"] & LogFilePipelineStats:
+                out.append(", , , , , , , , , , , ")
+            out.append(", " * header["numCounters"])
+            out.append("\n")
+            continue
+
+        if rowType == CmdBufferCall:
+            out.append(", %d, %s%s, " % (cmdBufIdxs[row],
+                                          "- " if (rowFlags & LogRowNested) else "",
+                                          cmdBufCalls[callIds[row]]))
+        else:
+            out.append("%d, " % callIds[row])
+
+        WriteTimestamps(out, header, rowFlags, beginClocks[row], endClocks[row])
+
+        if rowType == CmdBufferCall:
+            if rowFlags & (LogRowDraw | LogRowDispatch):
+                hashes = "0x%016x, 0x%016x, " % (pipelineHashes[pipelineRow], compilerHashes[pipelineRow])
+                slots  = ["0x%016x%016x" % (shaderHashes[slot][0][pipelineRow], shaderHashes[slot][1][pipelineRow])
+                          for slot in range(LogShaderSlotCount)]
+                pipelineRow += 1
+
+                if rowFlags & LogRowDraw:
+                    out.append(hashes + "%s, %s, %s, %s, %s, %d, %d, , " % (slots[0], slots[1], slots[2],
+                                                                          slots[3], slots[4],
+                                                                          counts0[row], counts1[row]))
+                else:
+                    out.append(hashes + "%s, , , , , %d, , , " % (slots[0], counts0[row]))
+            elif rowFlags & LogRowComment:
+                out.append(", , , , , , , , ,\"%s\", " % CString(stringHeap, commentOffsets[row]))
+            else:
+                out.append(", , , , , , , , , , ")
+
+            if rowFlags & LogRowPipelineStats:
+                out.append("".join("%d, " % pipelineStats[i][statsRow] for i in range(NumPipelineStats)))
+                statsRow += 1
+            elif header["flags"] & LogFilePipelineStats:
+                out.append(", , , , , , , , , , , ")
+
+        if rowFlags & LogRowCounters:
+            out.append("".join("%d, " % counters[i][counterRow] for i in range(header["numCounters"])))
+            counterRow += 1
+        elif (rowFlags & LogRowCountersFailed) == 0:
+            out.append(", " * header["numCounters"])
+
+        sqttState = (rowFlags & LogRowSqttMask) >> LogRowSqttShift
+        if sqttState == LogSqttTraceId:
+            out.append("%d, " % traceIds[row])
+        elif sqttState in SqttStrings:
+            out.append(SqttStrings[sqttState])
+
+        out.append("\n")
+
+def ConvertFile(inputPath, outputPath):
+    with open(inputPath, "rb") as inputFile:
+        reader = LogReader(inputFile.read())
+
+    fields = reader.Unpack(FileHeaderFormat)
+    header = dict(zip(["magic", "version", "size", "fileType", "timestampFreq", "flags", "numCounters",
+                       "numCmdBufCalls", "numQueueCalls", "stringTableSize", "numCounterNames"], fields))
+
+    if (header["magic"] != LogFileMagic) or (header["version"] != LogFileVersion):
+        raise ValueError("%s is not a version %d GPU profiler log" % (inputPath, LogFileVersion))
+
+    reader.offset = header["size"]
+    strings       = reader.Bytes(header["stringTableSize"]).split(b"\0")
+    strings       = [s.decode("utf-8", "replace") for s in strings]
+
+    numCounterNames = header["numCounterNames"]
+    counterNames    = strings[:numCounterNames]
+    cmdBufCalls     = strings[numCounterNames:numCounterNames + header["numCmdBufCalls"]]
+    queueCalls      = strings[numCounterNames + header["numCmdBufCalls"]:
+                              numCounterNames + header["numCmdBufCalls"] + header["numQueueCalls"]]
+
+    out = []
+    WriteHeader(out, header, counterNames)
+
+    # A log cut short by a crash ends with a partial block, which is dropped.
+    while reader.Remaining() >= struct.calcsize(BlockHeaderFormat):
+        blockOut = []
+        try:
+            ConvertBlock(reader, header, cmdBufCalls, queueCalls, blockOut)
+        except (struct.error, ValueError, IndexError) as e:
+            sys.stderr.write("%s: ignoring truncated or corrupt data at the end of the log (%s)\n" % (inputPath, e))
+            break
+        out.extend(blockOut)
+
+    with open(outputPath, "w") as outputFile:
+        outputFile.write("".join(out))
+
+def main():
+    if len(sys.argv) < 2:
+        sys.stderr.write("Usage: %s <.gplog file or directory>...\n" % sys.argv[0])
+        return 1
+
+    inputPaths = []
+    for path in sys.argv[1:]:
+        if os.path.isdir(path):
+            inputPaths += sorted(os.path.join(path, f) for f in os.listdir(path) if f.endswith(".gplog"))
+        else:
+            inputPaths.append(path)
+
+    for inputPath in inputPaths:
+        outputPath = os.path.splitext(inputPath)[0] + ".csv"
+        ConvertFile(inputPath, outputPath)
+        print("%s -> %s" % (inputPath, outputPath))
+
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main())
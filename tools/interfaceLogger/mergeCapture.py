@@ -0,0 +1,355 @@
+##
+ ###############################################################################
+ #
+ # Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+ #
+ # Permission is hereby granted, free of charge, to any person obtaining a copy
+ # of this software and associated documentation files (the "Software"), to deal
+ # in the Software without restriction, including without limitation the rights
+ # to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ # copies of the Software, and to permit persons to whom the Software is
+ # furnished to do so, subject to the following conditions:
+ #
+ # The above copyright notice and this permission notice shall be included in
+ # all copies or substantial portions of the Software.
+ #
+ # THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ # IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ # FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ # AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ # LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ # OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ # THE SOFTWARE.
+ ##############################################################################/
+
+# Merges the per-thread binary captures written by the interface logger (pal_calls_thread_*.bin) into a single capture
+# whose calls are sorted by their preCallTime.  The merged capture can be replayed by palReplay or converted into the
+# interface logger's usual JSON log.  The binary format is described in
+# src/core/layers/interfaceLogger/interfaceLoggerCapture.h.
+#
+# Usage: mergeCapture.py [--json] [-o <output file>] <log directory or .bin file>...
+#
+# By default the merged capture is written to pal_calls_merged.bin next to the first input.  With --json it is written
+# as pal_calls_merged.json instead.
+
+import os
+import struct
+import sys
+
+CaptureFileMagic   = 0x42434C50
+CaptureFileVersion = 1
+
+HeaderFormat = "<IIIIII"
+
+# CaptureToken values.
+(BeginList, EndList, BeginMap, EndMap, Key, DefineKey, String, Null, False_, True_,
+ Uint8, Uint16, Uint32, Uint64, Int8, Int16, Int32, Int64, Float, Object, BeginFunc, EndFunc) = range(22)
+
+ScalarFormats = {
+    Uint8:  "<B",
+    Uint16: "<H",
+    Uint32: "<I",
+    Uint64: "<Q",
+    Int8:   "<b",
+    Int16:  "<h",
+    Int32:  "<i",
+    Int64:  "<q",
+    Float:  "<f",
+}
+
+# Each call is decoded into a Record.  Values within a record are kept as (token, payload) pairs so that they can be
+# written back out with the same token types; lists hold a Python list of values and maps hold a list of (key, value)
+# pairs because the interface logger sometimes repeats keys within a map.
+class Record:
+    def __init__(self, funcId, objectId, threadId, preCallTime, postCallTime, items):
+        self.funcId       = funcId
+        self.objectId     = objectId
+        self.threadId     = threadId
+        self.preCallTime  = preCallTime
+        self.postCallTime = postCallTime
+        self.items        = items
+
+class CaptureReader:
+    def __init__(self, data):
+        self.data   = data
+        self.offset = 0
+        self.keys   = {}
+
+    def Unpack(self, fmt):
+        values = struct.unpack_from(fmt, self.data, self.offset)
+        self.offset += struct.calcsize(fmt)
+        return values
+
+    def Token(self):
+        if self.offset >= len(self.data):
+            raise IndexError("unexpected end of capture")
+        token = self.data[self.offset]
+        self.offset += 1
+        return token
+
+    def Text(self):
+        (length,) = self.Unpack("<I")
+        if self.offset + length > len(self.data):
+            raise IndexError("unexpected end of capture")
+        text = self.data[self.offset:self.offset + length].decode("utf-8", "replace")
+        self.offset += length
+        return text
+
+    def KeyFromToken(self, token):
+        (keyId,) = self.Unpack("<I")
+        if token == DefineKey:
+            self.keys[keyId] = self.Text()
+        elif token != Key:
+            raise ValueError("expected a key but found token %d" % token)
+        return self.keys[keyId]
+
+    # Reads the value which starts with the given token.
+    def Value(self, token):
+        if token == BeginList:
+            values = []
+            token  = self.Token()
+            while token != EndList:
+                values.append(self.Value(token))
+                token = self.Token()
+            return (BeginList, values)
+        elif token == BeginMap:
+            return (BeginMap, self.MapItems(EndMap))
+        elif token == String:
+            return (String, self.Text())
+        elif token in (Null, False_, True_):
+            return (token, None)
+        elif token in ScalarFormats:
+            return (token, self.Unpack(ScalarFormats[token])[0])
+        elif token == Object:
+            return (Object, self.Unpack("<II"))
+        raise ValueError("unexpected token %d" % token)
+
+    # Reads key/value pairs up to and including the given terminating token.
+    def MapItems(self, endToken):
+        items = []
+        token = self.Token()
+        while token != endToken:
+            key = self.KeyFromToken(token)
+            items.append((key, self.Value(self.Token())))
+            token = self.Token()
+        return items
+
+    def Record(self):
+        token = self.Token()
+        if token != BeginFunc:
+            raise ValueError("expected a function but found token %d" % token)
+        (funcId, objectId, threadId, preCallTime, postCallTime) = self.Unpack("<IIIQQ")
+        return Record(funcId, objectId, threadId, preCallTime, postCallTime, self.MapItems(EndFunc))
+
+def ReadCapture(path):
+    with open(path, "rb") as inputFile:
+        data = inputFile.read()
+
+    reader = CaptureReader(bytearray(data))
+    header = dict(zip(["magic", "version", "size", "numObjectNames", "numFuncNames", "nameTableSize"],
+                      reader.Unpack(HeaderFormat)))
+
+    if (header["magic"] != CaptureFileMagic) or (header["version"] != CaptureFileVersion):
+        raise ValueError("%s is not a version %d interface logger capture" % (path, CaptureFileVersion))
+
+    reader.offset = header["size"]
+    nameTable     = bytes(data[reader.offset:reader.offset + header["nameTableSize"]])
+    reader.offset += header["nameTableSize"]
+
+    records = []
+
+    # A capture cut short by a crash ends with a partial call, which is dropped.
+    while reader.offset < len(data):
+        start = reader.offset
+        try:
+            records.append(reader.Record())
+        except (struct.error, ValueError, IndexError, KeyError) as e:
+            sys.stderr.write("%s: ignoring truncated or corrupt data at offset %d (%s)\n" % (path, start, e))
+            break
+
+    return (header, nameTable, records)
+
+def ParseNameTable(header, nameTable):
+    numNames    = header["numObjectNames"] + header["numFuncNames"]
+    names       = [n.decode("utf-8", "replace") for n in nameTable.split(b"\0", numNames)[:numNames]]
+    objectNames = names[:header["numObjectNames"]]
+    funcNames   = names[header["numObjectNames"]:]
+    funcObjects = list(struct.unpack_from("<%dI" % header["numFuncNames"], nameTable,
+                                          len(nameTable) - 4 * header["numFuncNames"]))
+    return (objectNames, funcNames, funcObjects)
+
+class CaptureWriter:
+    def __init__(self):
+        self.out  = []
+        self.keys = {}
+
+    def Key(self, key):
+        if key in self.keys:
+            self.out.append(struct.pack("<BI", Key, self.keys[key]))
+        else:
+            self.keys[key] = len(self.keys)
+            encoded        = key.encode("utf-8")
+            self.out.append(struct.pack("<BII", DefineKey, self.keys[key], len(encoded)) + encoded)
+
+    def Value(self, value):
+        (token, payload) = value
+        if token == BeginList:
+            self.out.append(struct.pack("<B", BeginList))
+            for item in payload:
+                self.Value(item)
+            self.out.append(struct.pack("<B", EndList))
+        elif token == BeginMap:
+            self.out.append(struct.pack("<B", BeginMap))
+            self.MapItems(payload)
+            self.out.append(struct.pack("<B", EndMap))
+        elif token == String:
+            encoded = payload.encode("utf-8")
+            self.out.append(struct.pack("<BI", String, len(encoded)) + encoded)
+        elif token in ScalarFormats:
+            self.out.append(struct.pack("<B", token) + struct.pack(ScalarFormats[token], payload))
+        elif token == Object:
+            self.out.append(struct.pack("<BII", Object, payload[0], payload[1]))
+        else:
+            self.out.append(struct.pack("<B", token))
+
+    def MapItems(self, items):
+        for (key, value) in items:
+            self.Key(key)
+            self.Value(value)
+
+    def Record(self, record):
+        self.out.append(struct.pack("<BIIIQQ", BeginFunc, record.funcId, record.objectId, record.threadId,
+                                    record.preCallTime, record.postCallTime))
+        self.MapItems(record.items)
+        self.out.append(struct.pack("<B", EndFunc))
+
+def JsonString(text):
+    escaped = text.replace("\\", "\\\\").replace("\"", "\\\"").replace("\n", "\\n").replace("\t", "\\t")
+    return "\"%s\"" % escaped
+
+# Writes a value in the same form the interface logger's text mode would have.  Python's json module can't be used
+# because it can't represent maps with repeated keys.
+def JsonValue(out, value, objectNames, indent):
+    (token, payload) = value
+    if token == BeginList:
+        if len(payload) == 0:
+            out.append("[]")
+        else:
+            out.append("[\n")
+            for idx, item in enumerate(payload):
+                out.append(indent + "    ")
+                JsonValue(out, item, objectNames, indent + "    ")
+                out.append(",\n" if idx + 1 < len(payload) else "\n")
+            out.append(indent + "]")
+    elif token == BeginMap:
+        JsonMap(out, payload, objectNames, indent)
+    elif token == String:
+        out.append(JsonString(payload))
+    elif token == Null:
+        out.append("null")
+    elif token == False_:
+        out.append("false")
+    elif token == True_:
+        out.append("true")
+    elif token == Float:
+        out.append("%.9g" % payload)
+    elif token in ScalarFormats:
+        out.append("%d" % payload)
+    elif token == Object:
+        out.append("{ \"class\": %s, \"id\": %d }" % (JsonString(objectNames[payload[0]]), payload[1]))
+
+def JsonMap(out, items, objectNames, indent):
+    if len(items) == 0:
+        out.append("{}")
+        return
+    out.append("{\n")
+    for idx, (key, value) in enumerate(items):
+        out.append("%s    %s: " % (indent, JsonString(key)))
+        JsonValue(out, value, objectNames, indent + "    ")
+        out.append(",\n" if idx + 1 < len(items) else "\n")
+    out.append(indent + "}")
+
+def WriteJson(outputPath, header, nameTable, records):
+    (objectNames, funcNames, funcObjects) = ParseNameTable(header, nameTable)
+
+    out = ["[\n"]
+    for idx, record in enumerate(records):
+        items = [("_type",        (String, "InterfaceFunc")),
+                 ("this",         (Object, (funcObjects[record.funcId], record.objectId))),
+                 ("name",         (String, funcNames[record.funcId])),
+                 ("thread",       (Uint32, record.threadId)),
+                 ("preCallTime",  (Uint64, record.preCallTime)),
+                 ("postCallTime", (Uint64, record.postCallTime))] + record.items
+        out.append("    ")
+        JsonMap(out, items, objectNames, "    ")
+        out.append(",\n" if idx + 1 < len(records) else "\n")
+    out.append("]\n")
+
+    with open(outputPath, "w") as outputFile:
+        outputFile.write("".join(out))
+
+def WriteCapture(outputPath, header, nameTable, records):
+    writer = CaptureWriter()
+    for record in records:
+        writer.Record(record)
+
+    with open(outputPath, "wb") as outputFile:
+        outputFile.write(struct.pack(HeaderFormat, CaptureFileMagic, CaptureFileVersion, struct.calcsize(HeaderFormat),
+                                     header["numObjectNames"], header["numFuncNames"], len(nameTable)))
+        outputFile.write(nameTable)
+        outputFile.write(b"".join(writer.out))
+
+def main():
+    args       = sys.argv[1:]
+    writeJson  = False
+    outputPath = None
+    inputPaths = []
+
+    while len(args) > 0:
+        arg = args.pop(0)
+        if arg == "--json":
+            writeJson = True
+        elif (arg == "-o") and (len(args) > 0):
+            outputPath = args.pop(0)
+        elif os.path.isdir(arg):
+            inputPaths += sorted(os.path.join(arg, f) for f in os.listdir(arg)
+                                 if f.startswith("pal_calls_thread_") and f.endswith(".bin"))
+        else:
+            inputPaths.append(arg)
+
+    if len(inputPaths) == 0:
+        sys.stderr.write("Usage: %s [--json] [-o <output file>] <log directory or .bin file>...\n" % sys.argv[0])
+        return 1
+
+    header    = None
+    nameTable = None
+    records   = []
+
+    for inputIdx, inputPath in enumerate(inputPaths):
+        (fileHeader, fileNameTable, fileRecords) = ReadCapture(inputPath)
+
+        if nameTable is None:
+            (header, nameTable) = (fileHeader, fileNameTable)
+        elif fileNameTable != nameTable:
+            raise ValueError("%s was captured by a different build of PAL than %s" % (inputPath, inputPaths[0]))
+
+        # Calls which began at the same time are kept in thread and then capture order.
+        records += [((r.preCallTime, r.threadId, inputIdx, idx), r) for idx, r in enumerate(fileRecords)]
+
+    records.sort(key=lambda entry: entry[0])
+    records = [entry[1] for entry in records]
+
+    if outputPath is None:
+        outputPath = os.path.join(os.path.dirname(inputPaths[0]),
+                                  "pal_calls_merged.json" if writeJson else "pal_calls_merged.bin")
+
+    if writeJson:
+        WriteJson(outputPath, header, nameTable, records)
+    else:
+        WriteCapture(outputPath, header, nameTable, records)
+
+    print("%d calls from %d captures -> %s" % (len(records), len(inputPaths), outputPath))
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,2057 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+// palReplay re-issues a binary interface logger capture against a PAL null device and reports how long PAL took to
+// execute each kind of call, side by side with the time the same calls took when they were captured.  Because the
+// null device never touches hardware this isolates the CPU cost of the driver, which makes it useful for benchmarking
+// and bisecting CPU-side regressions on captured workloads.
+//
+// Usage: palReplay [--gpu <null device name>] [--loops <count>] <merged capture>
+//
+// Captures must first be merged with tools/interfaceLogger/mergeCapture.py.  Only the subset of the interface needed
+// to build and submit command buffers is replayed; see Replayer::Prepare for the list of supported calls.  All other
+// calls (most notably pipeline creation, draws and dispatches, whose shaders aren't part of a capture) are skipped and
+// reported at the end.
+
+#include "pal.h"
+#include "palCmdAllocator.h"
+#include "palCmdBuffer.h"
+#include "palDevice.h"
+#include "palFence.h"
+#include "palFile.h"
+#include "palGpuEvent.h"
+#include "palGpuMemory.h"
+#include "palLib.h"
+#include "palPlatform.h"
+#include "palQueue.h"
+#include "palSysUtil.h"
+
+#include "core/layers/interfaceLogger/interfaceLoggerCapture.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace Pal;
+using namespace Pal::InterfaceLogger;
+using namespace Util;
+
+namespace
+{
+
+// The interface logger's timer always counts nanoseconds on the platforms it supports.
+constexpr uint64 CaptureTimerFreq = 1000 * 1000 * 1000;
+
+// =====================================================================================================================
+// Captured values
+// =====================================================================================================================
+
+// A single value from a capture.  Maps keep their keys in order and may repeat a key.
+struct Value
+{
+    CaptureToken                               token;
+    union
+    {
+        uint64                                 u;
+        int64                                  i;
+        float                                  f;
+        struct
+        {
+            uint32                             objectClass;
+            uint32                             objectId;
+        };
+    };
+    std::string                                text;
+    std::vector<Value>                         elements;
+    std::vector<std::pair<uint32, Value>>      members;  // Key IDs are indices into CaptureFile::m_keys.
+};
+
+// One captured interface function call.
+struct Record
+{
+    uint32 funcId;
+    uint32 objectId;
+    uint32 threadId;
+    uint64 preCallTime;
+    uint64 postCallTime;
+    Value  items;         // Map holding the call's "input" and "output" maps.
+};
+
+// =====================================================================================================================
+// Reads a merged binary capture into memory.
+class CaptureFile
+{
+public:
+    CaptureFile() : m_pData(nullptr), m_size(0), m_offset(0) { }
+
+    Result Load(const char* pFilename);
+
+    const std::vector<Record>& Records() const { return m_records; }
+
+    const char* ObjectName(uint32 objectClass) const
+        { return (objectClass < m_objectNames.size()) ? m_objectNames[objectClass].c_str() : ""; }
+    const char* FuncName(uint32 funcId) const
+        { return (funcId < m_funcNames.size()) ? m_funcNames[funcId].c_str() : ""; }
+    const char* FuncObjectName(uint32 funcId) const
+        { return (funcId < m_funcObjects.size()) ? ObjectName(m_funcObjects[funcId]) : ""; }
+    uint32 NumFuncs() const { return static_cast<uint32>(m_funcNames.size()); }
+
+    // Returns the first value of the given map with the given key, or null if there isn't one.
+    const Value* Find(const Value& map, const char* pKey) const;
+
+private:
+    bool Read(void* pDst, size_t size);
+    template <typename T> bool Read(T* pValue) { return Read(pValue, sizeof(T)); }
+    bool ReadText(std::string* pText);
+    bool ReadKey(CaptureToken token, uint32* pKeyId);
+    bool ReadValue(CaptureToken token, Value* pValue);
+    bool ReadMapItems(CaptureToken endToken, Value* pMap);
+
+    std::vector<uint8>       m_file;
+    const uint8*             m_pData;
+    size_t                   m_size;
+    size_t                   m_offset;
+
+    std::vector<std::string> m_objectNames;
+    std::vector<std::string> m_funcNames;
+    std::vector<uint32>      m_funcObjects;
+    std::vector<std::string> m_keys;
+    std::vector<uint32>      m_keyRemap;     // Maps the capture's key IDs onto indices into m_keys.
+    std::vector<Record>      m_records;
+};
+
+// =====================================================================================================================
+Result CaptureFile::Load(
+    const char* pFilename)
+{
+    Result result = Result::ErrorInvalidValue;
+    File   file;
+
+    const size_t fileSize = File::GetFileSize(pFilename);
+
+    if ((fileSize >= sizeof(CaptureFileHeader)) &&
+        (file.Open(pFilename, FileAccessRead | FileAccessBinary) == Result::Success))
+    {
+        size_t bytesRead = 0;
+        m_file.resize(fileSize);
+        result = file.Read(m_file.data(), fileSize, &bytesRead);
+
+        if ((result == Result::Success) && (bytesRead != fileSize))
+        {
+            result = Result::ErrorUnknown;
+        }
+    }
+
+    CaptureFileHeader header = {};
+
+    if (result == Result::Success)
+    {
+        m_pData = m_file.data();
+        m_size  = m_file.size();
+
+        memcpy(&header, m_pData, sizeof(header));
+
+        if ((header.magic != CaptureFileMagic)        ||
+            (header.version != CaptureFileVersion)    ||
+            (header.size < sizeof(header))            ||
+            (header.size + header.nameTableSize > m_size))
+        {
+            result = Result::ErrorInvalidValue;
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        const char*const pNames   = reinterpret_cast<const char*>(m_pData + header.size);
+        const size_t     namesEnd = header.nameTableSize - (sizeof(uint32) * header.numFuncNames);
+        size_t           offset   = 0;
+
+        for (uint32 idx = 0; (idx < header.numObjectNames + header.numFuncNames) && (offset < namesEnd); ++idx)
+        {
+            const std::string name(pNames + offset, strnlen(pNames + offset, namesEnd - offset));
+            offset += name.size() + 1;
+
+            if (idx < header.numObjectNames)
+            {
+                m_objectNames.push_back(name);
+            }
+            else
+            {
+                m_funcNames.push_back(name);
+            }
+        }
+
+        m_funcObjects.resize(header.numFuncNames);
+        memcpy(m_funcObjects.data(), pNames + namesEnd, sizeof(uint32) * header.numFuncNames);
+
+        m_offset = header.size + header.nameTableSize;
+    }
+
+    // A capture which was cut short ends with a partial call, which is dropped.
+    while ((result == Result::Success) && (m_offset < m_size))
+    {
+        const size_t start = m_offset;
+        Record       record = {};
+        CaptureToken token  = CaptureToken::Count;
+
+        bool valid = Read(&token) && (token == CaptureToken::BeginFunc) &&
+                     Read(&record.funcId) && Read(&record.objectId) && Read(&record.threadId) &&
+                     Read(&record.preCallTime) && Read(&record.postCallTime);
+
+        record.items.token = CaptureToken::BeginMap;
+        valid = valid && ReadMapItems(CaptureToken::EndFunc, &record.items);
+
+        if (valid)
+        {
+            m_records.push_back(std::move(record));
+        }
+        else
+        {
+            fprintf(stderr, "%s: ignoring truncated or corrupt data at offset %zu\n", pFilename, start);
+            break;
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+bool CaptureFile::Read(
+    void*  pDst,
+    size_t size)
+{
+    const bool valid = (m_offset + size <= m_size);
+
+    if (valid)
+    {
+        memcpy(pDst, m_pData + m_offset, size);
+        m_offset += size;
+    }
+
+    return valid;
+}
+
+// =====================================================================================================================
+bool CaptureFile::ReadText(
+    std::string* pText)
+{
+    uint32 length = 0;
+    bool   valid  = Read(&length) && (m_offset + length <= m_size);
+
+    if (valid)
+    {
+        pText->assign(reinterpret_cast<const char*>(m_pData + m_offset), length);
+        m_offset += length;
+    }
+
+    return valid;
+}
+
+// =====================================================================================================================
+// Reads the key which starts with the given token and returns its index into m_keys.
+bool CaptureFile::ReadKey(
+    CaptureToken token,
+    uint32*      pKeyId)
+{
+    uint32 captureId = 0;
+    bool   valid     = Read(&captureId);
+
+    if (valid && (token == CaptureToken::DefineKey))
+    {
+        std::string key;
+        valid = ReadText(&key);
+
+        if (valid)
+        {
+            // Keys are defined once per capture in practice, so identical texts are shared by looking them up once.
+            uint32 keyId = 0;
+            while ((keyId < m_keys.size()) && (m_keys[keyId] != key))
+            {
+                ++keyId;
+            }
+
+            if (keyId == m_keys.size())
+            {
+                m_keys.push_back(key);
+            }
+
+            if (captureId == UINT32_MAX)
+            {
+                *pKeyId = keyId;
+                return true;
+            }
+
+            if (captureId >= m_keyRemap.size())
+            {
+                m_keyRemap.resize(captureId + 1, UINT32_MAX);
+            }
+
+            m_keyRemap[captureId] = keyId;
+        }
+    }
+    else if (token != CaptureToken::Key)
+    {
+        valid = false;
+    }
+
+    valid = valid && (captureId < m_keyRemap.size()) && (m_keyRemap[captureId] != UINT32_MAX);
+
+    if (valid)
+    {
+        *pKeyId = m_keyRemap[captureId];
+    }
+
+    return valid;
+}
+
+// =====================================================================================================================
+// Reads the value which starts with the given token.
+bool CaptureFile::ReadValue(
+    CaptureToken token,
+    Value*       pValue)
+{
+    bool valid = true;
+
+    pValue->token = token;
+    pValue->u     = 0;
+
+    switch (token)
+    {
+    case CaptureToken::BeginList:
+        while (valid && Read(&token) && (token != CaptureToken::EndList))
+        {
+            pValue->elements.emplace_back();
+            valid = ReadValue(token, &pValue->elements.back());
+        }
+        valid = valid && (token == CaptureToken::EndList);
+        break;
+    case CaptureToken::BeginMap:
+        valid = ReadMapItems(CaptureToken::EndMap, pValue);
+        break;
+    case CaptureToken::String:
+        valid = ReadText(&pValue->text);
+        break;
+    case CaptureToken::Null:
+    case CaptureToken::False:
+        break;
+    case CaptureToken::True:
+        pValue->u = 1;
+        break;
+    case CaptureToken::Uint8:  { uint8  v; valid = Read(&v); pValue->u = v; break; }
+    case CaptureToken::Uint16: { uint16 v; valid = Read(&v); pValue->u = v; break; }
+    case CaptureToken::Uint32: { uint32 v; valid = Read(&v); pValue->u = v; break; }
+    case CaptureToken::Uint64: { uint64 v; valid = Read(&v); pValue->u = v; break; }
+    case CaptureToken::Int8:   { int8   v; valid = Read(&v); pValue->i = v; break; }
+    case CaptureToken::Int16:  { int16  v; valid = Read(&v); pValue->i = v; break; }
+    case CaptureToken::Int32:  { int32  v; valid = Read(&v); pValue->i = v; break; }
+    case CaptureToken::Int64:  { int64  v; valid = Read(&v); pValue->i = v; break; }
+    case CaptureToken::Float:
+        valid = Read(&pValue->f);
+        break;
+    case CaptureToken::Object:
+        valid = Read(&pValue->objectClass) && Read(&pValue->objectId);
+        break;
+    default:
+        valid = false;
+        break;
+    }
+
+    return valid;
+}
+
+// =====================================================================================================================
+// Reads key/value pairs up to and including the given terminating token.
+bool CaptureFile::ReadMapItems(
+    CaptureToken endToken,
+    Value*       pMap)
+{
+    CaptureToken token = CaptureToken::Count;
+    bool         valid = true;
+
+    while (valid && Read(&token) && (token != endToken))
+    {
+        uint32 keyId = 0;
+        valid = ReadKey(token, &keyId) && Read(&token);
+
+        if (valid)
+        {
+            pMap->members.emplace_back(keyId, Value());
+            valid = ReadValue(token, &pMap->members.back().second);
+        }
+    }
+
+    return valid && (token == endToken);
+}
+
+// =====================================================================================================================
+const Value* CaptureFile::Find(
+    const Value& map,
+    const char*  pKey
+    ) const
+{
+    const Value* pValue = nullptr;
+
+    for (const auto& member : map.members)
+    {
+        if (m_keys[member.first] == pKey)
+        {
+            pValue = &member.second;
+            break;
+        }
+    }
+
+    return pValue;
+}
+
+// =====================================================================================================================
+// Replay
+// =====================================================================================================================
+
+// The calls which can be replayed.
+enum class ReplayFunc : uint32
+{
+    DeviceCreateCmdAllocator,
+    DeviceCreateCmdBuffer,
+    DeviceCreateQueue,
+    DeviceCreateFence,
+    DeviceCreateGpuMemory,
+    DeviceCreateGpuEvent,
+    DeviceResetFences,
+    DeviceWaitForFences,
+    CmdAllocatorReset,
+    CmdBufferBegin,
+    CmdBufferEnd,
+    CmdBufferReset,
+    CmdBufferCmdSetUserData,
+    CmdBufferCmdSetViewports,
+    CmdBufferCmdSetScissorRects,
+    CmdBufferCmdSetGlobalScissor,
+    CmdBufferCmdSetBlendConst,
+    CmdBufferCmdSetStencilRefMasks,
+    CmdBufferCmdSetDepthBounds,
+    CmdBufferCmdSetDepthBiasState,
+    CmdBufferCmdSetInputAssemblyState,
+    CmdBufferCmdSetTriangleRasterState,
+    CmdBufferCmdSetPointLineRasterState,
+    CmdBufferCmdSetEvent,
+    CmdBufferCmdResetEvent,
+    CmdBufferCmdFillMemory,
+    CmdBufferCmdCopyMemory,
+    QueueSubmit,
+    QueueWaitIdle,
+    Destroy,
+};
+
+// The interface classes the replayer knows how to create.
+enum class ObjectKind : uint32
+{
+    Unknown,
+    Device,
+    CmdAllocator,
+    CmdBuffer,
+    Queue,
+    Fence,
+    GpuMemory,
+    GpuEvent,
+};
+
+constexpr uint32 InvalidSlot = UINT32_MAX;
+
+// A captured call, decoded into the PAL structures it will be replayed with.  Object arguments are kept as slots into
+// Replayer::m_objects and are patched into the structures just before each call is made.
+struct ReplayCall
+{
+    ReplayFunc            func;
+    uint32                funcId;        // Index of the captured function, for reporting.
+    uint64                capturedTime;  // Captured duration of the call in timer ticks.
+    uint32                thisSlot;
+    uint32                createdSlot;
+    uint32                argSlots[2];   // Single object arguments, in the order the call takes them.
+    bool                  flag;          // CmdBufferReset's returnGpuMemory or WaitForFences' waitAll.
+    uint64                timeout;
+
+    std::vector<uint32>           slots;         // Object list arguments: fences or submitted command buffers.
+    std::vector<uint32>           values;        // User data entries.
+    std::vector<MemoryCopyRegion> regions;
+    std::vector<CmdBufInfo>       cmdBufInfos;   // Parallel to "slots" for QueueSubmit, or empty.
+    std::vector<GpuMemoryRef>     memRefs;
+    std::vector<uint32>           memRefSlots;   // Parallel to "memRefs".
+
+    union
+    {
+        CmdAllocatorCreateInfo     cmdAllocator;
+        CmdBufferCreateInfo        cmdBuffer;
+        QueueCreateInfo            queue;
+        FenceCreateInfo            fence;
+        GpuMemoryCreateInfo        gpuMemory;
+        GpuEventCreateInfo         gpuEvent;
+        CmdBufferBuildFlags        buildFlags;
+        ViewportParams             viewports;
+        ScissorRectParams          scissorRects;
+        GlobalScissorParams        globalScissor;
+        BlendConstParams           blendConst;
+        StencilRefMaskParams       stencilRefMasks;
+        DepthBoundsParams          depthBounds;
+        DepthBiasParams            depthBias;
+        InputAssemblyStateParams   inputAssembly;
+        TriangleRasterStateParams  triangleRaster;
+        PointLineRasterStateParams pointLineRaster;
+        PipelineBindPoint          bindPoint;
+        HwPipePoint                pipePoint;
+        struct
+        {
+            gpusize                offset;
+            gpusize                size;
+            uint32                 data;
+        } fill;
+    } args;
+};
+
+// A live object created by the replay.
+struct ReplayObject
+{
+    ObjectKind kind;
+    void*      pObject;  // The PAL interface pointer, cast to void.
+    void*      pMemory;  // System memory the object was placed in.
+};
+
+// Per-function replay statistics.
+struct FuncStats
+{
+    uint64 calls;
+    uint64 failures;
+    uint64 skipped;
+    uint64 capturedTicks;
+    int64  replayTicks;
+};
+
+// =====================================================================================================================
+// Replays a capture against a null device.
+class Replayer
+{
+public:
+    explicit Replayer(const CaptureFile& capture);
+    ~Replayer();
+
+    Result Init(const char* pGpuName);
+    Result Prepare();
+    Result Run(uint32 loops);
+    void   Report(uint32 loops) const;
+
+private:
+    ObjectKind KindOf(uint32 objectClass) const;
+    uint32     SlotOf(const Value* pObject);
+    uint32     SlotOf(ObjectKind kind, uint32 objectId);
+
+    bool PrepareCall(const Record& record, ReplayCall* pCall);
+    bool PrepareDeviceCall(const char* pFunc, const Value& input, const Value* pOutput, ReplayCall* pCall);
+    bool PrepareCmdBufferCall(const char* pFunc, const Value& input, ReplayCall* pCall);
+    bool PrepareFinalizeInfo(const Value& input);
+
+    Result Execute(const ReplayCall& call);
+    Result Create(const ReplayCall& call, ObjectKind kind);
+    void   DestroyObject(uint32 slot);
+    void   DestroyAll();
+
+    template <typename T> T* Get(uint32 slot) const
+        { return (slot < m_objects.size()) ? static_cast<T*>(m_objects[slot].pObject) : nullptr; }
+
+    // Helpers for decoding captured values.
+    uint64 Uint(const Value* pValue) const;
+    float  Float(const Value* pValue) const;
+    bool   IsTrue(const Value* pValue) const { return (pValue != nullptr) && (pValue->token == CaptureToken::True); }
+    bool   HasFlag(const Value* pList, const char* pFlag) const;
+    template <typename T> bool Enum(const Value* pValue, const char*const* ppNames, uint32 count, T* pOut) const;
+    void   ParseRect(const Value* pValue, Rect* pRect) const;
+
+    const CaptureFile&                   m_capture;
+    IPlatform*                           m_pPlatform;
+    void*                                m_pPlatformMemory;
+    IDevice*                             m_pDevice;
+    DeviceFinalizeInfo                   m_finalizeInfo;
+    bool                                 m_capturedFinalize;
+
+    std::vector<ObjectKind>              m_objectKinds;  // ObjectKind of each capture object class.
+    std::unordered_map<uint64, uint32>   m_slotMap;      // Maps (ObjectKind << 32 | object ID) onto object slots.
+    std::vector<ReplayObject>            m_objects;
+    std::vector<uint32>                  m_creationOrder;
+    std::vector<ReplayCall>              m_calls;
+    std::vector<FuncStats>               m_stats;
+    std::vector<const IFence*>           m_fenceScratch;
+    std::vector<ICmdBuffer*>             m_cmdBufScratch;
+};
+
+// The values of the interface logger's enum strings, in enum order.
+const char*const QueueTypeNames[] =
+{
+    "QueueTypeUniversal",
+    "QueueTypeCompute",
+    "QueueTypeDma",
+    "QueueTypeTimer",
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION < 303
+    "QueueTypeVideoEncode",
+    "QueueTypeVideoDecode",
+#endif
+};
+
+const char*const EngineTypeNames[] =
+{
+    "EngineTypeUniversal",
+    "EngineTypeCompute",
+    "EngineTypeExclusiveCompute",
+    "EngineTypeDma",
+    "EngineTypeTimer",
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 303
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 315
+    "EngineTypeHpUniversal",
+    "EngineTypeHpGfxOnly",
+#endif
+#else
+    "EngineTypeVce",
+    "EngineTypeUvd",
+#endif
+};
+
+// The engine names DeviceFinalizeInfo uses as map keys, in EngineType order.
+const char*const EngineNames[] =
+{
+    "Universal",
+    "Compute",
+    "ExclusiveCompute",
+    "Dma",
+    "Timer",
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 303
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 315
+    "HpUniversal",
+    "HpGfxOnly",
+#endif
+#else
+    "Vce",
+    "Uvd",
+#endif
+};
+
+static_assert((sizeof(QueueTypeNames) / sizeof(QueueTypeNames[0])) == QueueTypeCount,
+              "The QueueType names need to be updated.");
+static_assert((sizeof(EngineTypeNames) / sizeof(EngineTypeNames[0])) == EngineTypeCount,
+              "The EngineType names need to be updated.");
+static_assert((sizeof(EngineNames) / sizeof(EngineNames[0])) == EngineTypeCount,
+              "The engine names need to be updated.");
+
+const char*const SubmitOptModeNames[]    = { "Default", "Disabled", "MinKernelSubmits", "MinGpuCmdOverhead" };
+const char*const GpuHeapNames[]          = { "GpuHeapLocal", "GpuHeapInvisible", "GpuHeapGartUswc",
+                                             "GpuHeapGartCacheable" };
+const char*const VaRangeNames[]          = { "Default", "DescriptorTable", "ShadowDescriptorTable", "Svm" };
+const char*const GpuMemPriorityNames[]   = { "Unused", "VeryLow", "Low", "Normal", "High", "VeryHigh" };
+const char*const PriorityOffsetNames[]   = { "Offset0", "Offset1", "Offset2", "Offset3",
+                                             "Offset4", "Offset5", "Offset6", "Offset7" };
+const char*const HwPipePointNames[]      = { "HwPipeTop", "HwPipePostIndexFetch", "", "HwPipePreRasterization",
+                                             "HwPipePostPs", "HwPipePostCs", "HwPipePostBlt", "HwPipeBottom" };
+const char*const BindPointNames[]        = { "Compute", "Graphics" };
+const char*const PointOriginNames[]      = { "UpperLeft", "LowerLeft" };
+const char*const FillModeNames[]         = { "Points", "Wireframe", "Solid" };
+const char*const CullModeNames[]         = { "None", "Front", "Back", "FrontAndBack" };
+const char*const FaceOrientationNames[]  = { "Ccw", "Cw" };
+const char*const ProvokingVertexNames[]  = { "First", "Last" };
+const char*const TopologyNames[]         = { "PointList", "LineList", "LineStrip", "TriangleList", "TriangleStrip",
+                                             "RectList", "QuadList", "QuadStrip", "LineListAdj", "LineStripAdj",
+                                             "TriangleListAdj", "TriangleStripAdj", "Patch", "TriangleFan" };
+
+#define ENUM_ARGS(names) names, static_cast<uint32>(sizeof(names) / sizeof(names[0]))
+
+// =====================================================================================================================
+Replayer::Replayer(
+    const CaptureFile& capture)
+    :
+    m_capture(capture),
+    m_pPlatform(nullptr),
+    m_pPlatformMemory(nullptr),
+    m_pDevice(nullptr),
+    m_finalizeInfo(),
+    m_capturedFinalize(false),
+    m_stats(capture.NumFuncs(), FuncStats())
+{
+}
+
+// =====================================================================================================================
+Replayer::~Replayer()
+{
+    DestroyAll();
+
+    if (m_pDevice != nullptr)
+    {
+        m_pDevice->Cleanup();
+    }
+
+    if (m_pPlatform != nullptr)
+    {
+        m_pPlatform->Destroy();
+    }
+
+    free(m_pPlatformMemory);
+}
+
+// =====================================================================================================================
+// Creates a platform for the requested null device and initializes its one device.
+Result Replayer::Init(
+    const char* pGpuName)
+{
+    NullGpuInfo nullGpus[static_cast<uint32>(NullGpuId::Max)] = {};
+    uint32      nullGpuCount = static_cast<uint32>(NullGpuId::Max);
+
+    Result result = EnumerateNullDevices(&nullGpuCount, nullGpus);
+
+    PlatformCreateInfo createInfo = {};
+    createInfo.pSettingsPath          = "palReplay";
+    createInfo.flags.createNullDevice = 1;
+    createInfo.nullGpuId              = NullGpuId::Max;
+
+    for (uint32 idx = 0; (result == Result::Success) && (idx < nullGpuCount); ++idx)
+    {
+        if ((pGpuName == nullptr) || (strcmp(pGpuName, nullGpus[idx].pGpuName) == 0))
+        {
+            createInfo.nullGpuId = nullGpus[idx].nullGpuId;
+            printf("Replaying against the %s null device.\n", nullGpus[idx].pGpuName);
+            break;
+        }
+    }
+
+    if ((result == Result::Success) && (createInfo.nullGpuId == NullGpuId::Max))
+    {
+        fprintf(stderr, "Unknown null device \"%s\".  Supported devices are:\n", pGpuName);
+        for (uint32 idx = 0; idx < nullGpuCount; ++idx)
+        {
+            fprintf(stderr, "    %s\n", nullGpus[idx].pGpuName);
+        }
+        result = Result::ErrorInvalidValue;
+    }
+
+    if (result == Result::Success)
+    {
+        m_pPlatformMemory = malloc(GetPlatformSize());
+        result = (m_pPlatformMemory != nullptr) ? CreatePlatform(createInfo, m_pPlatformMemory, &m_pPlatform)
+                                                : Result::ErrorOutOfMemory;
+    }
+
+    if (result == Result::Success)
+    {
+        IDevice* pDevices[MaxDevices] = {};
+        uint32   deviceCount          = 0;
+
+        result = m_pPlatform->EnumerateDevices(&deviceCount, pDevices);
+
+        if ((result == Result::Success) && (deviceCount == 0))
+        {
+            result = Result::ErrorUnavailable;
+        }
+
+        m_pDevice = pDevices[0];
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_pDevice->CommitSettingsAndInit();
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Decodes every supported call in the capture and finalizes the device the way the application did.
+Result Replayer::Prepare()
+{
+    static const struct
+    {
+        const char* pName;
+        ObjectKind  kind;
+    } ObjectClasses[] =
+    {
+        { "IDevice",       ObjectKind::Device       },
+        { "ICmdAllocator", ObjectKind::CmdAllocator },
+        { "ICmdBuffer",    ObjectKind::CmdBuffer    },
+        { "IQueue",        ObjectKind::Queue        },
+        { "IFence",        ObjectKind::Fence        },
+        { "IGpuMemory",    ObjectKind::GpuMemory    },
+        { "IGpuEvent",     ObjectKind::GpuEvent     },
+    };
+
+    for (uint32 objectClass = 0; m_capture.ObjectName(objectClass)[0] != '\0'; ++objectClass)
+    {
+        ObjectKind kind = ObjectKind::Unknown;
+
+        for (const auto& entry : ObjectClasses)
+        {
+            if (strcmp(entry.pName, m_capture.ObjectName(objectClass)) == 0)
+            {
+                kind = entry.kind;
+            }
+        }
+
+        m_objectKinds.push_back(kind);
+    }
+
+    // Every device in the capture is replayed on our one device; slot zero always holds it.
+    m_objects.push_back({ ObjectKind::Device, m_pDevice, nullptr });
+
+    for (const Record& record : m_capture.Records())
+    {
+        ReplayCall call = {};
+        call.funcId       = record.funcId;
+        call.capturedTime = record.postCallTime - record.preCallTime;
+        call.thisSlot     = InvalidSlot;
+        call.createdSlot  = InvalidSlot;
+        call.argSlots[0]  = InvalidSlot;
+        call.argSlots[1]  = InvalidSlot;
+
+        if (PrepareCall(record, &call))
+        {
+            m_calls.push_back(std::move(call));
+        }
+        else if (record.funcId < m_stats.size())
+        {
+            m_stats[record.funcId].skipped++;
+        }
+    }
+
+    // Without a captured DeviceFinalizeInfo the best we can do is enable every engine the captured queues used.
+    if (m_capturedFinalize == false)
+    {
+        for (const ReplayCall& call : m_calls)
+        {
+            if (call.func == ReplayFunc::DeviceCreateQueue)
+            {
+                m_finalizeInfo.requestedEngineCounts[call.args.queue.engineType].engines |=
+                    (1u << call.args.queue.engineIndex);
+            }
+        }
+    }
+
+    m_objects.resize(m_slotMap.size() + 1, ReplayObject{ ObjectKind::Unknown, nullptr, nullptr });
+
+    return m_pDevice->Finalize(m_finalizeInfo);
+}
+
+// =====================================================================================================================
+ObjectKind Replayer::KindOf(
+    uint32 objectClass
+    ) const
+{
+    return (objectClass < m_objectKinds.size()) ? m_objectKinds[objectClass] : ObjectKind::Unknown;
+}
+
+// =====================================================================================================================
+// Returns the slot for a captured object value, or InvalidSlot if it's null or of a class we don't replay.
+uint32 Replayer::SlotOf(
+    const Value* pObject)
+{
+    uint32 slot = InvalidSlot;
+
+    if ((pObject != nullptr) && (pObject->token == CaptureToken::Object))
+    {
+        slot = SlotOf(KindOf(pObject->objectClass), pObject->objectId);
+    }
+
+    return slot;
+}
+
+// =====================================================================================================================
+uint32 Replayer::SlotOf(
+    ObjectKind kind,
+    uint32     objectId)
+{
+    uint32 slot = InvalidSlot;
+
+    if (kind == ObjectKind::Device)
+    {
+        slot = 0;
+    }
+    else if (kind != ObjectKind::Unknown)
+    {
+        const uint64 key = (static_cast<uint64>(kind) << 32) | objectId;
+        auto         it  = m_slotMap.find(key);
+
+        if (it == m_slotMap.end())
+        {
+            it = m_slotMap.emplace(key, static_cast<uint32>(m_slotMap.size() + 1)).first;
+        }
+
+        slot = it->second;
+    }
+
+    return slot;
+}
+
+// =====================================================================================================================
+// Decodes a captured call.  Returns false if it can't be replayed.
+bool Replayer::PrepareCall(
+    const Record& record,
+    ReplayCall*   pCall)
+{
+    const char*const  pObject = m_capture.FuncObjectName(record.funcId);
+    const char*const  pFunc   = m_capture.FuncName(record.funcId);
+    const Value*const pInput  = m_capture.Find(record.items, "input");
+    const Value*const pOutput = m_capture.Find(record.items, "output");
+    const Value       empty   = {};
+    const Value&      input   = (pInput != nullptr) ? *pInput : empty;
+
+    bool supported = false;
+
+    if (strcmp(pObject, "IDevice") == 0)
+    {
+        supported = PrepareDeviceCall(pFunc, input, pOutput, pCall);
+    }
+    else if (strcmp(pObject, "ICmdBuffer") == 0)
+    {
+        pCall->thisSlot = SlotOf(ObjectKind::CmdBuffer, record.objectId);
+        supported       = PrepareCmdBufferCall(pFunc, input, pCall);
+    }
+    else if (strcmp(pObject, "ICmdAllocator") == 0)
+    {
+        pCall->thisSlot = SlotOf(ObjectKind::CmdAllocator, record.objectId);
+
+        if (strcmp(pFunc, "Reset") == 0)
+        {
+            pCall->func = ReplayFunc::CmdAllocatorReset;
+            supported   = true;
+        }
+    }
+    else if (strcmp(pObject, "IQueue") == 0)
+    {
+        pCall->thisSlot = SlotOf(ObjectKind::Queue, record.objectId);
+
+        if (strcmp(pFunc, "Submit") == 0)
+        {
+            const Value*const pSubmitInfo = m_capture.Find(input, "submitInfo");
+            const Value*const pCmdBuffers = (pSubmitInfo != nullptr) ? m_capture.Find(*pSubmitInfo, "cmdBuffers")
+                                                                     : nullptr;
+            const Value*const pMemRefs    = (pSubmitInfo != nullptr) ? m_capture.Find(*pSubmitInfo, "gpuMemoryRefs")
+                                                                     : nullptr;
+            bool              hasInfo     = false;
+
+            pCall->func = ReplayFunc::QueueSubmit;
+            supported   = (pCmdBuffers != nullptr);
+
+            // The command buffer map repeats an "object" key and an "info" key for each command buffer.
+            for (uint32 idx = 0; supported && (idx < pCmdBuffers->members.size()); ++idx)
+            {
+                const Value& member = pCmdBuffers->members[idx].second;
+
+                if (member.token == CaptureToken::Object)
+                {
+                    pCall->slots.push_back(SlotOf(&member));
+                    pCall->cmdBufInfos.push_back(CmdBufInfo());
+                    pCall->memRefSlots.push_back(InvalidSlot);
+                }
+                else if ((member.token == CaptureToken::BeginMap) && (pCall->cmdBufInfos.empty() == false))
+                {
+                    const Value*const pFlags = m_capture.Find(member, "flags");
+                    CmdBufInfo*const  pInfo  = &pCall->cmdBufInfos.back();
+
+                    pInfo->isValid    = HasFlag(pFlags, "isValid");
+                    pInfo->frameBegin = HasFlag(pFlags, "frameBegin");
+                    pInfo->frameEnd   = HasFlag(pFlags, "frameEnd");
+                    pInfo->p2pCmd     = HasFlag(pFlags, "p2pCmd");
+
+                    pCall->memRefSlots.back() = SlotOf(m_capture.Find(member, "primaryMemory"));
+                    hasInfo = true;
+                }
+            }
+
+            if (hasInfo == false)
+            {
+                pCall->cmdBufInfos.clear();
+            }
+
+            // memRefSlots holds the primary memory of each CmdBufInfo followed by the slot of each memory reference.
+            pCall->memRefSlots.resize(pCall->cmdBufInfos.size());
+
+            for (uint32 idx = 0; supported && (pMemRefs != nullptr) && (idx < pMemRefs->elements.size()); ++idx)
+            {
+                const Value& memRef = pMemRefs->elements[idx];
+                GpuMemoryRef ref    = {};
+
+                ref.flags.readOnly = HasFlag(m_capture.Find(memRef, "flags"), "readOnly");
+                pCall->memRefs.push_back(ref);
+                pCall->memRefSlots.push_back(SlotOf(m_capture.Find(memRef, "gpuMemory")));
+            }
+
+            if (pSubmitInfo != nullptr)
+            {
+                pCall->argSlots[0] = SlotOf(m_capture.Find(*pSubmitInfo, "fence"));
+            }
+        }
+        else if (strcmp(pFunc, "WaitIdle") == 0)
+        {
+            pCall->func = ReplayFunc::QueueWaitIdle;
+            supported   = true;
+        }
+    }
+    else if ((strcmp(pObject, "IFence") == 0) || (strcmp(pObject, "IGpuMemory") == 0) ||
+             (strcmp(pObject, "IGpuEvent") == 0))
+    {
+        const ObjectKind kind = (pObject[1] == 'F') ? ObjectKind::Fence :
+                                (pObject[4] == 'M') ? ObjectKind::GpuMemory : ObjectKind::GpuEvent;
+        pCall->thisSlot = SlotOf(kind, record.objectId);
+    }
+
+    // Every class we create can be destroyed.
+    if ((supported == false) && (pCall->thisSlot != InvalidSlot) && (strcmp(pFunc, "Destroy") == 0))
+    {
+        pCall->func = ReplayFunc::Destroy;
+        supported   = true;
+    }
+
+    return supported;
+}
+
+// =====================================================================================================================
+bool Replayer::PrepareDeviceCall(
+    const char*  pFunc,
+    const Value& input,
+    const Value* pOutput,
+    ReplayCall*  pCall)
+{
+    const Value*const pCreateInfo = m_capture.Find(input, "createInfo");
+    const Value*const pCreatedObj = (pOutput != nullptr) ? m_capture.Find(*pOutput, "createdObj") : nullptr;
+
+    bool supported = false;
+
+    if ((pCreateInfo != nullptr) && (pCreatedObj != nullptr) && (pCreatedObj->token == CaptureToken::Object))
+    {
+        const Value& info  = *pCreateInfo;
+        const Value* pFlags = m_capture.Find(info, "flags");
+
+        pCall->createdSlot = SlotOf(pCreatedObj);
+        supported          = true;
+
+        if (strcmp(pFunc, "CreateCmdAllocator") == 0)
+        {
+            CmdAllocatorCreateInfo*const pInfo = &pCall->args.cmdAllocator;
+            const Value*const            pAlloc = m_capture.Find(info, "allocInfo");
+            const char*const             AllocNames[CmdAllocatorTypeCount] = { "CommandData", "EmbeddedData" };
+
+            pCall->func                     = ReplayFunc::DeviceCreateCmdAllocator;
+            pInfo->flags.threadSafe               = HasFlag(pFlags, "threadSafe");
+            pInfo->flags.autoMemoryReuse          = HasFlag(pFlags, "autoMemoryReuse");
+            pInfo->flags.disableBusyChunkTracking = HasFlag(pFlags, "disableBusyChunkTracking");
+
+            for (uint32 idx = 0; supported && (idx < CmdAllocatorTypeCount); ++idx)
+            {
+                const Value*const pType = (pAlloc != nullptr) ? m_capture.Find(*pAlloc, AllocNames[idx]) : nullptr;
+
+                supported = (pType != nullptr) &&
+                            Enum(m_capture.Find(*pType, "allocHeap"), ENUM_ARGS(GpuHeapNames),
+                                 &pInfo->allocInfo[idx].allocHeap);
+
+                if (supported)
+                {
+                    pInfo->allocInfo[idx].allocSize    = Uint(m_capture.Find(*pType, "allocSize"));
+                    pInfo->allocInfo[idx].suballocSize = Uint(m_capture.Find(*pType, "suballocSize"));
+                }
+            }
+        }
+        else if (strcmp(pFunc, "CreateCmdBuffer") == 0)
+        {
+            CmdBufferCreateInfo*const pInfo = &pCall->args.cmdBuffer;
+
+            pCall->func                       = ReplayFunc::DeviceCreateCmdBuffer;
+            pCall->argSlots[0]                = SlotOf(m_capture.Find(info, "cmdAllocator"));
+            pInfo->flags.nested               = HasFlag(pFlags, "nested");
+            pInfo->flags.realtimeComputeUnits = HasFlag(pFlags, "realtimeComputeUnits");
+
+            supported = Enum(m_capture.Find(info, "queueType"), ENUM_ARGS(QueueTypeNames), &pInfo->queueType) &&
+                        Enum(m_capture.Find(info, "engineType"), ENUM_ARGS(EngineTypeNames), &pInfo->engineType);
+        }
+        else if (strcmp(pFunc, "CreateQueue") == 0)
+        {
+            QueueCreateInfo*const pInfo = &pCall->args.queue;
+
+            pCall->func                  = ReplayFunc::DeviceCreateQueue;
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 288
+            pInfo->windowedPriorBlit     = HasFlag(pFlags, "windowedPriorBlit");
+#endif
+            pInfo->engineIndex           = static_cast<uint32>(Uint(m_capture.Find(info, "engineIndex")));
+            pInfo->numReservedCu         = static_cast<uint32>(Uint(m_capture.Find(info, "numReservedCu")));
+            pInfo->persistentCeRamOffset = static_cast<uint32>(Uint(m_capture.Find(info, "persistentCeRamOffset")));
+            pInfo->persistentCeRamSize   = static_cast<uint32>(Uint(m_capture.Find(info, "persistentCeRamSize")));
+
+            supported = Enum(m_capture.Find(info, "queueType"), ENUM_ARGS(QueueTypeNames), &pInfo->queueType) &&
+                        Enum(m_capture.Find(info, "engineType"), ENUM_ARGS(EngineTypeNames), &pInfo->engineType) &&
+                        (pInfo->engineIndex < 32);
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 327
+            supported = supported &&
+                        Enum(m_capture.Find(info, "submitOptMode"), ENUM_ARGS(SubmitOptModeNames),
+                             &pInfo->submitOptMode);
+#endif
+        }
+        else if (strcmp(pFunc, "CreateFence") == 0)
+        {
+            pCall->func                                  = ReplayFunc::DeviceCreateFence;
+            pCall->args.fence.flags.signaled             = HasFlag(pFlags, "signaled");
+            pCall->args.fence.flags.eventCanBeInherited  = HasFlag(pFlags, "eventCanBeInherited");
+        }
+        else if (strcmp(pFunc, "CreateGpuEvent") == 0)
+        {
+            pCall->func                              = ReplayFunc::DeviceCreateGpuEvent;
+            pCall->args.gpuEvent.flags.gpuAccessOnly = HasFlag(pFlags, "gpuAccessOnly");
+        }
+        else if (strcmp(pFunc, "CreateGpuMemory") == 0)
+        {
+            GpuMemoryCreateInfo*const pInfo  = &pCall->args.gpuMemory;
+            const Value*const         pHeaps = m_capture.Find(info, "heaps");
+            const Value*const         pImage = m_capture.Find(info, "image");
+
+            pCall->func                   = ReplayFunc::DeviceCreateGpuMemory;
+            pInfo->flags.virtualAlloc     = HasFlag(pFlags, "virtualAlloc");
+            pInfo->flags.shareable        = HasFlag(pFlags, "shareable");
+            pInfo->flags.interprocess     = HasFlag(pFlags, "interprocess");
+            pInfo->flags.flippable        = HasFlag(pFlags, "flippable");
+            pInfo->flags.stereo           = HasFlag(pFlags, "stereo");
+            pInfo->flags.globallyCoherent = HasFlag(pFlags, "globallyCoherent");
+            pInfo->flags.xdmaBuffer       = HasFlag(pFlags, "xdmaBuffer");
+            pInfo->flags.turboSyncSurface = HasFlag(pFlags, "turboSyncSurface");
+            pInfo->flags.globalGpuVa      = HasFlag(pFlags, "globalGpuVa");
+            pInfo->flags.autoPriority     = HasFlag(pFlags, "autoPriority");
+            pInfo->size                   = Uint(m_capture.Find(info, "size"));
+            pInfo->alignment              = Uint(m_capture.Find(info, "alignment"));
+            pInfo->descrVirtAddr          = Uint(m_capture.Find(info, "descrVirtAddr"));
+
+            // Memory bound to images, typed buffers, reserved VA ranges and bus addressable memory all depend on
+            // objects or addresses which can't be recreated.
+            supported = (HasFlag(pFlags, "typedBuffer")      == false) &&
+                        (HasFlag(pFlags, "useReservedGpuVa") == false) &&
+                        (HasFlag(pFlags, "busAddressable")   == false) &&
+                        ((pImage == nullptr) || (pImage->token == CaptureToken::Null)) &&
+                        Enum(m_capture.Find(info, "vaRange"), ENUM_ARGS(VaRangeNames), &pInfo->vaRange) &&
+                        Enum(m_capture.Find(info, "priority"), ENUM_ARGS(GpuMemPriorityNames), &pInfo->priority) &&
+                        Enum(m_capture.Find(info, "priorityOffset"), ENUM_ARGS(PriorityOffsetNames),
+                             &pInfo->priorityOffset);
+
+            for (uint32 idx = 0; supported && (pHeaps != nullptr) && (idx < pHeaps->elements.size()); ++idx)
+            {
+                supported = (idx < GpuHeapCount) &&
+                            Enum(&pHeaps->elements[idx], ENUM_ARGS(GpuHeapNames), &pInfo->heaps[idx]);
+                pInfo->heapCount = idx + 1;
+            }
+        }
+        else
+        {
+            supported = false;
+        }
+    }
+    else if (strcmp(pFunc, "ResetFences") == 0)
+    {
+        pCall->func = ReplayFunc::DeviceResetFences;
+        supported   = true;
+    }
+    else if (strcmp(pFunc, "WaitForFences") == 0)
+    {
+        pCall->func    = ReplayFunc::DeviceWaitForFences;
+        pCall->flag    = IsTrue(m_capture.Find(input, "waitAll"));
+        pCall->timeout = Uint(m_capture.Find(input, "timeout"));
+        supported      = true;
+    }
+    else if (strcmp(pFunc, "Finalize") == 0)
+    {
+        // Finalization happens once, before the capture is replayed, so it's never added to the call list.
+        const Value*const pFinalizeInfo = m_capture.Find(input, "finalizeInfo");
+
+        if ((pFinalizeInfo != nullptr) && (m_capturedFinalize == false))
+        {
+            m_capturedFinalize = PrepareFinalizeInfo(*pFinalizeInfo);
+        }
+    }
+
+    if ((pCall->func == ReplayFunc::DeviceResetFences) || (pCall->func == ReplayFunc::DeviceWaitForFences))
+    {
+        const Value*const pFences = m_capture.Find(input, "fences");
+
+        for (uint32 idx = 0; (pFences != nullptr) && (idx < pFences->elements.size()); ++idx)
+        {
+            pCall->slots.push_back(SlotOf(&pFences->elements[idx]));
+        }
+    }
+
+    return supported;
+}
+
+// =====================================================================================================================
+bool Replayer::PrepareFinalizeInfo(
+    const Value& info)
+{
+    const Value*const pFlags        = m_capture.Find(info, "flags");
+    const Value*const pEngineCounts = m_capture.Find(info, "requestedEngineCounts");
+    const Value*const pCeRamSizes   = m_capture.Find(info, "ceRamSizeUsed");
+    const Value*const pTables       = m_capture.Find(info, "indirectUserDataTables");
+
+    m_finalizeInfo.flags.supportPrivateScreens      = HasFlag(pFlags, "supportPrivateScreens");
+    m_finalizeInfo.flags.requireFlipStatus          = HasFlag(pFlags, "requireFlipStatus");
+    m_finalizeInfo.flags.requireFrameMetadata       = HasFlag(pFlags, "requireFrameMetadata");
+    m_finalizeInfo.flags.internalGpuMemAutoPriority = HasFlag(pFlags, "internalGpuMemAutoPriority");
+
+    for (uint32 idx = 0; idx < EngineTypeCount; ++idx)
+    {
+        if (pEngineCounts != nullptr)
+        {
+            m_finalizeInfo.requestedEngineCounts[idx].engines =
+                static_cast<uint32>(Uint(m_capture.Find(*pEngineCounts, EngineNames[idx])));
+        }
+
+        if (pCeRamSizes != nullptr)
+        {
+            m_finalizeInfo.ceRamSizeUsed[idx] = static_cast<size_t>(Uint(m_capture.Find(*pCeRamSizes,
+                                                                                        EngineNames[idx])));
+        }
+    }
+
+    for (uint32 idx = 0; (pTables != nullptr) && (idx < pTables->elements.size()); ++idx)
+    {
+        if (idx < MaxIndirectUserDataTables)
+        {
+            const Value& table = pTables->elements[idx];
+
+            m_finalizeInfo.indirectUserDataTable[idx].sizeInDwords   =
+                static_cast<uint32>(Uint(m_capture.Find(table, "sizeInDwords")));
+            m_finalizeInfo.indirectUserDataTable[idx].offsetInDwords =
+                static_cast<uint32>(Uint(m_capture.Find(table, "offsetInDwords")));
+            m_finalizeInfo.indirectUserDataTable[idx].ringSize       =
+                static_cast<uint32>(Uint(m_capture.Find(table, "ringSize")));
+        }
+    }
+
+    return (pEngineCounts != nullptr);
+}
+
+// =====================================================================================================================
+bool Replayer::PrepareCmdBufferCall(
+    const char*  pFunc,
+    const Value& input,
+    ReplayCall*  pCall)
+{
+    const Value*const pParams = m_capture.Find(input, "params");
+    const Value       empty   = {};
+    const Value&      params  = (pParams != nullptr) ? *pParams : empty;
+
+    bool supported = true;
+
+    if (strcmp(pFunc, "Begin") == 0)
+    {
+        const Value*const pInfo  = m_capture.Find(input, "info");
+        const Value*const pFlags = (pInfo != nullptr) ? m_capture.Find(*pInfo, "flags") : nullptr;
+        const Value*const pState = (pInfo != nullptr) ? m_capture.Find(*pInfo, "inheritedState") : nullptr;
+
+        CmdBufferBuildFlags*const pBuildFlags = &pCall->args.buildFlags;
+
+        pCall->func                               = ReplayFunc::CmdBufferBegin;
+        pBuildFlags->optimizeGpuSmallBatch        = HasFlag(pFlags, "optimizeGpuSmallBatch");
+        pBuildFlags->optimizeExclusiveSubmit      = HasFlag(pFlags, "optimizeExclusiveSubmit");
+        pBuildFlags->optimizeOneTimeSubmit        = HasFlag(pFlags, "optimizeOneTimeSubmit");
+        pBuildFlags->prefetchShaders              = HasFlag(pFlags, "prefetchShaders");
+        pBuildFlags->prefetchCommands             = HasFlag(pFlags, "prefetchCommands");
+        pBuildFlags->usesCeRamCmds                = HasFlag(pFlags, "usesCeRamCmds");
+        pBuildFlags->useEmbeddedDataForCeRamDumps = HasFlag(pFlags, "useEmbeddedDataForCeRamDumps");
+        pBuildFlags->disallowNestedLaunchViaIb2   = HasFlag(pFlags, "disallowNestedLaunchViaIb2");
+
+        // Nested command buffers inherit their targets from image views we don't recreate.
+        supported = (pInfo != nullptr) && ((pState == nullptr) || (pState->token == CaptureToken::Null));
+    }
+    else if (strcmp(pFunc, "End") == 0)
+    {
+        pCall->func = ReplayFunc::CmdBufferEnd;
+    }
+    else if (strcmp(pFunc, "Reset") == 0)
+    {
+        pCall->func        = ReplayFunc::CmdBufferReset;
+        pCall->argSlots[0] = SlotOf(m_capture.Find(input, "pCmdAllocator"));
+        pCall->flag        = IsTrue(m_capture.Find(input, "returnGpuMemory"));
+    }
+    else if (strcmp(pFunc, "CmdSetUserData") == 0)
+    {
+        const Value*const pValues = m_capture.Find(input, "values");
+
+        pCall->func = ReplayFunc::CmdBufferCmdSetUserData;
+        supported   =(pValues != nullptr) &&
+                      Enum(m_capture.Find(input, "bindPoint"), ENUM_ARGS(BindPointNames), &pCall->args.bindPoint);
+
+        // The first user data entry is stored in the timeout field, which SetUserData doesn't otherwise need.
+        pCall->timeout = Uint(m_capture.Find(input, "firstEntry"));
+
+        for (uint32 idx = 0; supported && (idx < pValues->elements.size()); ++idx)
+        {
+            pCall->values.push_back(static_cast<uint32>(Uint(&pValues->elements[idx])));
+        }
+    }
+    else if (strcmp(pFunc, "CmdSetViewports") == 0)
+    {
+        ViewportParams*const pViewports = &pCall->args.viewports;
+        const Value*const    pList      = m_capture.Find(params, "viewports");
+
+        pCall->func                  = ReplayFunc::CmdBufferCmdSetViewports;
+        pViewports->horzDiscardRatio = Float(m_capture.Find(params, "horzDiscardRatio"));
+        pViewports->vertDiscardRatio = Float(m_capture.Find(params, "vertDiscardRatio"));
+        pViewports->horzClipRatio    = Float(m_capture.Find(params, "horzClipRatio"));
+        pViewports->vertClipRatio    = Float(m_capture.Find(params, "vertClipRatio"));
+
+        supported = (pList != nullptr) && (pList->elements.size() <= MaxViewports);
+
+        for (uint32 idx = 0; supported && (idx < pList->elements.size()); ++idx)
+        {
+            const Value& viewport = pList->elements[idx];
+
+            pViewports->viewports[idx].originX  = Float(m_capture.Find(viewport, "originX"));
+            pViewports->viewports[idx].originY  = Float(m_capture.Find(viewport, "originY"));
+            pViewports->viewports[idx].width    = Float(m_capture.Find(viewport, "width"));
+            pViewports->viewports[idx].height   = Float(m_capture.Find(viewport, "height"));
+            pViewports->viewports[idx].minDepth = Float(m_capture.Find(viewport, "minDepth"));
+            pViewports->viewports[idx].maxDepth = Float(m_capture.Find(viewport, "maxDepth"));
+
+            supported = Enum(m_capture.Find(viewport, "origin"), ENUM_ARGS(PointOriginNames),
+                             &pViewports->viewports[idx].origin);
+            pViewports->count = idx + 1;
+        }
+    }
+    else if (strcmp(pFunc, "CmdSetScissorRects") == 0)
+    {
+        const Value*const pList = m_capture.Find(params, "scissors");
+
+        pCall->func = ReplayFunc::CmdBufferCmdSetScissorRects;
+        supported   = (pList != nullptr) && (pList->elements.size() <= MaxViewports);
+
+        for (uint32 idx = 0; supported && (idx < pList->elements.size()); ++idx)
+        {
+            ParseRect(&pList->elements[idx], &pCall->args.scissorRects.scissors[idx]);
+            pCall->args.scissorRects.count = idx + 1;
+        }
+    }
+    else if (strcmp(pFunc, "CmdSetGlobalScissor") == 0)
+    {
+        pCall->func = ReplayFunc::CmdBufferCmdSetGlobalScissor;
+        ParseRect(m_capture.Find(params, "scissorRegion"), &pCall->args.globalScissor.scissorRegion);
+    }
+    else if (strcmp(pFunc, "CmdSetBlendConst") == 0)
+    {
+        const Value*const pList = m_capture.Find(params, "blendConst");
+
+        pCall->func = ReplayFunc::CmdBufferCmdSetBlendConst;
+        supported   = (pList != nullptr) && (pList->elements.size() == 4);
+
+        for (uint32 idx = 0; supported && (idx < 4); ++idx)
+        {
+            pCall->args.blendConst.blendConst[idx] = Float(&pList->elements[idx]);
+        }
+    }
+    else if (strcmp(pFunc, "CmdSetStencilRefMasks") == 0)
+    {
+        StencilRefMaskParams*const pMasks = &pCall->args.stencilRefMasks;
+        const Value*const          pFlags = m_capture.Find(params, "flags");
+
+        pCall->func                       = ReplayFunc::CmdBufferCmdSetStencilRefMasks;
+        pMasks->frontRef                  = static_cast<uint8>(Uint(m_capture.Find(params, "frontRef")));
+        pMasks->frontReadMask             = static_cast<uint8>(Uint(m_capture.Find(params, "frontReadMask")));
+        pMasks->frontWriteMask            = static_cast<uint8>(Uint(m_capture.Find(params, "frontWriteMask")));
+        pMasks->frontOpValue              = static_cast<uint8>(Uint(m_capture.Find(params, "frontOpValue")));
+        pMasks->backRef                   = static_cast<uint8>(Uint(m_capture.Find(params, "backRef")));
+        pMasks->backReadMask              = static_cast<uint8>(Uint(m_capture.Find(params, "backReadMask")));
+        pMasks->backWriteMask             = static_cast<uint8>(Uint(m_capture.Find(params, "backWriteMask")));
+        pMasks->backOpValue               = static_cast<uint8>(Uint(m_capture.Find(params, "backOpValue")));
+        pMasks->flags.updateFrontRef       = HasFlag(pFlags, "updateFrontRef");
+        pMasks->flags.updateFrontReadMask  = HasFlag(pFlags, "updateFrontReadMask");
+        pMasks->flags.updateFrontWriteMask = HasFlag(pFlags, "updateFrontWriteMask");
+        pMasks->flags.updateFrontOpValue   = HasFlag(pFlags, "updateFrontOpValue");
+        pMasks->flags.updateBackRef        = HasFlag(pFlags, "updateBackRef");
+        pMasks->flags.updateBackReadMask   = HasFlag(pFlags, "updateBackReadMask");
+        pMasks->flags.updateBackWriteMask  = HasFlag(pFlags, "updateBackWriteMask");
+        pMasks->flags.updateBackOpValue    = HasFlag(pFlags, "updateBackOpValue");
+    }
+    else if (strcmp(pFunc, "CmdSetDepthBounds") == 0)
+    {
+        pCall->func                 = ReplayFunc::CmdBufferCmdSetDepthBounds;
+        pCall->args.depthBounds.min = Float(m_capture.Find(params, "min"));
+        pCall->args.depthBounds.max = Float(m_capture.Find(params, "max"));
+    }
+    else if (strcmp(pFunc, "CmdSetDepthBiasState") == 0)
+    {
+        pCall->func                                = ReplayFunc::CmdBufferCmdSetDepthBiasState;
+        pCall->args.depthBias.depthBias            = Float(m_capture.Find(params, "depthBias"));
+        pCall->args.depthBias.depthBiasClamp       = Float(m_capture.Find(params, "depthBiasClamp"));
+        pCall->args.depthBias.slopeScaledDepthBias = Float(m_capture.Find(params, "slopeScaledDepthBias"));
+    }
+    else if (strcmp(pFunc, "CmdSetInputAssemblyState") == 0)
+    {
+        InputAssemblyStateParams*const pState = &pCall->args.inputAssembly;
+
+        pCall->func                   = ReplayFunc::CmdBufferCmdSetInputAssemblyState;
+        pState->primitiveRestartIndex = static_cast<uint32>(Uint(m_capture.Find(params, "primitiveRestartIndex")));
+        pState->primitiveRestartEnable = IsTrue(m_capture.Find(params, "primitiveRestartEnable"));
+
+        supported = Enum(m_capture.Find(params, "topology"), ENUM_ARGS(TopologyNames), &pState->topology);
+    }
+    else if (strcmp(pFunc, "CmdSetTriangleRasterState") == 0)
+    {
+        TriangleRasterStateParams*const pState = &pCall->args.triangleRaster;
+
+        pCall->func                   = ReplayFunc::CmdBufferCmdSetTriangleRasterState;
+        pState->flags.depthBiasEnable = HasFlag(m_capture.Find(params, "flags"), "depthBiasEnable");
+
+        supported = Enum(m_capture.Find(params, "fillMode"), ENUM_ARGS(FillModeNames), &pState->fillMode)           &&
+                    Enum(m_capture.Find(params, "cullMode"), ENUM_ARGS(CullModeNames), &pState->cullMode)           &&
+                    Enum(m_capture.Find(params, "frontFace"), ENUM_ARGS(FaceOrientationNames), &pState->frontFace) &&
+                    Enum(m_capture.Find(params, "provokingVertex"), ENUM_ARGS(ProvokingVertexNames),
+                         &pState->provokingVertex);
+    }
+    else if (strcmp(pFunc, "CmdSetPointLineRasterState") == 0)
+    {
+        pCall->func                              = ReplayFunc::CmdBufferCmdSetPointLineRasterState;
+        pCall->args.pointLineRaster.pointSize    = Float(m_capture.Find(params, "pointSize"));
+        pCall->args.pointLineRaster.lineWidth    = Float(m_capture.Find(params, "lineWidth"));
+        pCall->args.pointLineRaster.pointSizeMin = Float(m_capture.Find(params, "pointSizeMin"));
+        pCall->args.pointLineRaster.pointSizeMax = Float(m_capture.Find(params, "pointSizeMax"));
+    }
+    else if ((strcmp(pFunc, "CmdSetEvent") == 0) || (strcmp(pFunc, "CmdResetEvent") == 0))
+    {
+        const bool set = (pFunc[3] == 'S');
+
+        pCall->func        = set ? ReplayFunc::CmdBufferCmdSetEvent : ReplayFunc::CmdBufferCmdResetEvent;
+        pCall->argSlots[0] = SlotOf(m_capture.Find(input, "gpuEvent"));
+        supported          = Enum(m_capture.Find(input, set ? "setPoint" : "resetPoint"), ENUM_ARGS(HwPipePointNames),
+                                  &pCall->args.pipePoint);
+    }
+    else if (strcmp(pFunc, "CmdFillMemory") == 0)
+    {
+        pCall->func             = ReplayFunc::CmdBufferCmdFillMemory;
+        pCall->argSlots[0]      = SlotOf(m_capture.Find(input, "dstGpuMemory"));
+        pCall->args.fill.offset = Uint(m_capture.Find(input, "dstOffset"));
+        pCall->args.fill.size   = Uint(m_capture.Find(input, "fillSize"));
+        pCall->args.fill.data   = static_cast<uint32>(Uint(m_capture.Find(input, "data")));
+    }
+    else if (strcmp(pFunc, "CmdCopyMemory") == 0)
+    {
+        const Value*const pRegions = m_capture.Find(input, "regions");
+
+        pCall->func        = ReplayFunc::CmdBufferCmdCopyMemory;
+        pCall->argSlots[0] = SlotOf(m_capture.Find(input, "srcGpuMemory"));
+        pCall->argSlots[1] = SlotOf(m_capture.Find(input, "dstGpuMemory"));
+        supported          = (pRegions != nullptr);
+
+        for (uint32 idx = 0; supported && (idx < pRegions->elements.size()); ++idx)
+        {
+            const Value&     region = pRegions->elements[idx];
+            MemoryCopyRegion copy   = {};
+
+            copy.srcOffset = Uint(m_capture.Find(region, "srcOffset"));
+            copy.dstOffset = Uint(m_capture.Find(region, "dstOffset"));
+            copy.copySize  = Uint(m_capture.Find(region, "copySize"));
+            pCall->regions.push_back(copy);
+        }
+    }
+    else
+    {
+        supported = false;
+    }
+
+    return supported;
+}
+
+// =====================================================================================================================
+uint64 Replayer::Uint(
+    const Value* pValue
+    ) const
+{
+    return ((pValue != nullptr) && (pValue->token != CaptureToken::Float)) ? pValue->u : 0;
+}
+
+// =====================================================================================================================
+float Replayer::Float(
+    const Value* pValue
+    ) const
+{
+    return ((pValue != nullptr) && (pValue->token == CaptureToken::Float)) ? pValue->f : 0.0f;
+}
+
+// =====================================================================================================================
+// Returns true if the given list of flag names contains the given flag.
+bool Replayer::HasFlag(
+    const Value* pList,
+    const char*  pFlag
+    ) const
+{
+    bool found = false;
+
+    for (uint32 idx = 0; (pList != nullptr) && (idx < pList->elements.size()) && (found == false); ++idx)
+    {
+        found = (pList->elements[idx].token == CaptureToken::String) && (pList->elements[idx].text == pFlag);
+    }
+
+    return found;
+}
+
+// =====================================================================================================================
+// Converts an enum string back into its value, which is its index in the given list of names.
+template <typename T>
+bool Replayer::Enum(
+    const Value*      pValue,
+    const char*const* ppNames,
+    uint32            count,
+    T*                pOut
+    ) const
+{
+    bool found = false;
+
+    for (uint32 idx = 0; (pValue != nullptr) && (pValue->token == CaptureToken::String) && (idx < count); ++idx)
+    {
+        if ((ppNames[idx][0] != '\0') && (pValue->text == ppNames[idx]))
+        {
+            *pOut = static_cast<T>(idx);
+            found = true;
+            break;
+        }
+    }
+
+    return found;
+}
+
+// =====================================================================================================================
+void Replayer::ParseRect(
+    const Value* pValue,
+    Rect*        pRect
+    ) const
+{
+    const Value*const pOffset = (pValue != nullptr) ? m_capture.Find(*pValue, "offset") : nullptr;
+    const Value*const pExtent = (pValue != nullptr) ? m_capture.Find(*pValue, "extent") : nullptr;
+
+    if (pOffset != nullptr)
+    {
+        pRect->offset.x = static_cast<int32>(Uint(m_capture.Find(*pOffset, "x")));
+        pRect->offset.y = static_cast<int32>(Uint(m_capture.Find(*pOffset, "y")));
+    }
+
+    if (pExtent != nullptr)
+    {
+        pRect->extent.width  = static_cast<uint32>(Uint(m_capture.Find(*pExtent, "width")));
+        pRect->extent.height = static_cast<uint32>(Uint(m_capture.Find(*pExtent, "height")));
+    }
+}
+
+// =====================================================================================================================
+// Replays the prepared calls the given number of times.  Objects which the capture never destroyed are destroyed at the
+// end of each loop so that every loop starts from the same state.
+Result Replayer::Run(
+    uint32 loops)
+{
+    Result result = Result::Success;
+
+    for (uint32 loop = 0; (result == Result::Success) && (loop < loops); ++loop)
+    {
+        for (const ReplayCall& call : m_calls)
+        {
+            FuncStats*const pStats = &m_stats[call.funcId];
+
+            const int64  start     = GetPerfCpuTime();
+            const Result callResult = Execute(call);
+            const int64  end       = GetPerfCpuTime();
+
+            pStats->calls++;
+            pStats->capturedTicks += call.capturedTime;
+            pStats->replayTicks   += end - start;
+
+            if ((callResult != Result::Success) && (callResult != Result::NotReady) && (callResult != Result::Timeout))
+            {
+                pStats->failures++;
+            }
+        }
+
+        DestroyAll();
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+Result Replayer::Execute(
+    const ReplayCall& call)
+{
+    Result result = Result::Success;
+
+    ICmdBuffer*const pCmdBuffer = (call.func >= ReplayFunc::CmdBufferBegin) &&
+                                  (call.func <= ReplayFunc::CmdBufferCmdCopyMemory) ? Get<ICmdBuffer>(call.thisSlot)
+                                                                                    : nullptr;
+
+    switch (call.func)
+    {
+    case ReplayFunc::DeviceCreateCmdAllocator: result = Create(call, ObjectKind::CmdAllocator); break;
+    case ReplayFunc::DeviceCreateCmdBuffer:    result = Create(call, ObjectKind::CmdBuffer);    break;
+    case ReplayFunc::DeviceCreateQueue:        result = Create(call, ObjectKind::Queue);        break;
+    case ReplayFunc::DeviceCreateFence:        result = Create(call, ObjectKind::Fence);        break;
+    case ReplayFunc::DeviceCreateGpuMemory:    result = Create(call, ObjectKind::GpuMemory);    break;
+    case ReplayFunc::DeviceCreateGpuEvent:     result = Create(call, ObjectKind::GpuEvent);     break;
+
+    case ReplayFunc::DeviceResetFences:
+    case ReplayFunc::DeviceWaitForFences:
+        m_fenceScratch.clear();
+        for (uint32 slot : call.slots)
+        {
+            if (Get<IFence>(slot) != nullptr)
+            {
+                m_fenceScratch.push_back(Get<IFence>(slot));
+            }
+        }
+
+        if (m_fenceScratch.empty())
+        {
+            result = Result::ErrorInvalidValue;
+        }
+        else if (call.func == ReplayFunc::DeviceResetFences)
+        {
+            result = m_pDevice->ResetFences(static_cast<uint32>(m_fenceScratch.size()),
+                                            const_cast<IFence*const*>(m_fenceScratch.data()));
+        }
+        else
+        {
+            result = m_pDevice->WaitForFences(static_cast<uint32>(m_fenceScratch.size()),
+                                              m_fenceScratch.data(),
+                                              call.flag,
+                                              call.timeout);
+        }
+        break;
+
+    case ReplayFunc::CmdAllocatorReset:
+        result = (Get<ICmdAllocator>(call.thisSlot) != nullptr) ? Get<ICmdAllocator>(call.thisSlot)->Reset()
+                                                                : Result::ErrorInvalidValue;
+        break;
+
+    case ReplayFunc::QueueSubmit:
+        if (Get<IQueue>(call.thisSlot) != nullptr)
+        {
+            m_cmdBufScratch.clear();
+            for (uint32 slot : call.slots)
+            {
+                m_cmdBufScratch.push_back(Get<ICmdBuffer>(slot));
+            }
+
+            // The object pointers in the CmdBufInfos and memory references change with every loop.
+            ReplayCall& mutableCall = const_cast<ReplayCall&>(call);
+            for (uint32 idx = 0; idx < call.cmdBufInfos.size(); ++idx)
+            {
+                mutableCall.cmdBufInfos[idx].pPrimaryMemory = Get<IGpuMemory>(call.memRefSlots[idx]);
+            }
+
+            for (uint32 idx = 0; idx < call.memRefs.size(); ++idx)
+            {
+                mutableCall.memRefs[idx].pGpuMemory = Get<IGpuMemory>(call.memRefSlots[call.cmdBufInfos.size() + idx]);
+            }
+
+            SubmitInfo submitInfo = {};
+            submitInfo.cmdBufferCount  = static_cast<uint32>(m_cmdBufScratch.size());
+            submitInfo.ppCmdBuffers    = m_cmdBufScratch.data();
+            submitInfo.pCmdBufInfoList = call.cmdBufInfos.empty() ? nullptr : call.cmdBufInfos.data();
+            submitInfo.gpuMemRefCount  = static_cast<uint32>(call.memRefs.size());
+            submitInfo.pGpuMemoryRefs  = call.memRefs.empty() ? nullptr : call.memRefs.data();
+            submitInfo.pFence          = Get<IFence>(call.argSlots[0]);
+
+            result = Get<IQueue>(call.thisSlot)->Submit(submitInfo);
+        }
+        else
+        {
+            result = Result::ErrorInvalidValue;
+        }
+        break;
+
+    case ReplayFunc::QueueWaitIdle:
+        result = (Get<IQueue>(call.thisSlot) != nullptr) ? Get<IQueue>(call.thisSlot)->WaitIdle()
+                                                         : Result::ErrorInvalidValue;
+        break;
+
+    case ReplayFunc::Destroy:
+        DestroyObject(call.thisSlot);
+        break;
+
+    default:
+        if (pCmdBuffer == nullptr)
+        {
+            result = Result::ErrorInvalidValue;
+        }
+        else
+        {
+            switch (call.func)
+            {
+            case ReplayFunc::CmdBufferBegin:
+            {
+                CmdBufferBuildInfo buildInfo = {};
+                buildInfo.flags = call.args.buildFlags;
+                result = pCmdBuffer->Begin(buildInfo);
+                break;
+            }
+            case ReplayFunc::CmdBufferEnd:
+                result = pCmdBuffer->End();
+                break;
+            case ReplayFunc::CmdBufferReset:
+                result = pCmdBuffer->Reset(Get<ICmdAllocator>(call.argSlots[0]), call.flag);
+                break;
+            case ReplayFunc::CmdBufferCmdSetUserData:
+                pCmdBuffer->CmdSetUserData(call.args.bindPoint,
+                                           static_cast<uint32>(call.timeout),
+                                           static_cast<uint32>(call.values.size()),
+                                           call.values.data());
+                break;
+            case ReplayFunc::CmdBufferCmdSetViewports:
+                pCmdBuffer->CmdSetViewports(call.args.viewports);
+                break;
+            case ReplayFunc::CmdBufferCmdSetScissorRects:
+                pCmdBuffer->CmdSetScissorRects(call.args.scissorRects);
+                break;
+            case ReplayFunc::CmdBufferCmdSetGlobalScissor:
+                pCmdBuffer->CmdSetGlobalScissor(call.args.globalScissor);
+                break;
+            case ReplayFunc::CmdBufferCmdSetBlendConst:
+                pCmdBuffer->CmdSetBlendConst(call.args.blendConst);
+                break;
+            case ReplayFunc::CmdBufferCmdSetStencilRefMasks:
+                pCmdBuffer->CmdSetStencilRefMasks(call.args.stencilRefMasks);
+                break;
+            case ReplayFunc::CmdBufferCmdSetDepthBounds:
+                pCmdBuffer->CmdSetDepthBounds(call.args.depthBounds);
+                break;
+            case ReplayFunc::CmdBufferCmdSetDepthBiasState:
+                pCmdBuffer->CmdSetDepthBiasState(call.args.depthBias);
+                break;
+            case ReplayFunc::CmdBufferCmdSetInputAssemblyState:
+                pCmdBuffer->CmdSetInputAssemblyState(call.args.inputAssembly);
+                break;
+            case ReplayFunc::CmdBufferCmdSetTriangleRasterState:
+                pCmdBuffer->CmdSetTriangleRasterState(call.args.triangleRaster);
+                break;
+            case ReplayFunc::CmdBufferCmdSetPointLineRasterState:
+                pCmdBuffer->CmdSetPointLineRasterState(call.args.pointLineRaster);
+                break;
+            case ReplayFunc::CmdBufferCmdSetEvent:
+            case ReplayFunc::CmdBufferCmdResetEvent:
+                if (Get<IGpuEvent>(call.argSlots[0]) == nullptr)
+                {
+                    result = Result::ErrorInvalidValue;
+                }
+                else if (call.func == ReplayFunc::CmdBufferCmdSetEvent)
+                {
+                    pCmdBuffer->CmdSetEvent(*Get<IGpuEvent>(call.argSlots[0]), call.args.pipePoint);
+                }
+                else
+                {
+                    pCmdBuffer->CmdResetEvent(*Get<IGpuEvent>(call.argSlots[0]), call.args.pipePoint);
+                }
+                break;
+            case ReplayFunc::CmdBufferCmdFillMemory:
+                if (Get<IGpuMemory>(call.argSlots[0]) != nullptr)
+                {
+                    pCmdBuffer->CmdFillMemory(*Get<IGpuMemory>(call.argSlots[0]),
+                                              call.args.fill.offset,
+                                              call.args.fill.size,
+                                              call.args.fill.data);
+                }
+                else
+                {
+                    result = Result::ErrorInvalidValue;
+                }
+                break;
+            case ReplayFunc::CmdBufferCmdCopyMemory:
+                if ((Get<IGpuMemory>(call.argSlots[0]) != nullptr) && (Get<IGpuMemory>(call.argSlots[1]) != nullptr))
+                {
+                    pCmdBuffer->CmdCopyMemory(*Get<IGpuMemory>(call.argSlots[0]),
+                                              *Get<IGpuMemory>(call.argSlots[1]),
+                                              static_cast<uint32>(call.regions.size()),
+                                              call.regions.data());
+                }
+                else
+                {
+                    result = Result::ErrorInvalidValue;
+                }
+                break;
+            default:
+                PAL_NEVER_CALLED();
+                break;
+            }
+        }
+        break;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Creates the object a Create call captured, in system memory we allocate ourselves just like a client would.
+Result Replayer::Create(
+    const ReplayCall& call,
+    ObjectKind        kind)
+{
+    Result result = Result::ErrorInvalidValue;
+    size_t size   = 0;
+
+    // Create infos which point at other objects must be patched for this loop's objects.
+    CmdBufferCreateInfo cmdBufferInfo = call.args.cmdBuffer;
+
+    switch (kind)
+    {
+    case ObjectKind::CmdAllocator: size = m_pDevice->GetCmdAllocatorSize(call.args.cmdAllocator, &result); break;
+    case ObjectKind::Queue:        size = m_pDevice->GetQueueSize(call.args.queue, &result);               break;
+    case ObjectKind::Fence:        size = m_pDevice->GetFenceSize(&result);                                break;
+    case ObjectKind::GpuMemory:    size = m_pDevice->GetGpuMemorySize(call.args.gpuMemory, &result);       break;
+    case ObjectKind::GpuEvent:     size = m_pDevice->GetGpuEventSize(call.args.gpuEvent, &result);         break;
+    case ObjectKind::CmdBuffer:
+        cmdBufferInfo.pCmdAllocator = Get<ICmdAllocator>(call.argSlots[0]);
+        if (cmdBufferInfo.pCmdAllocator != nullptr)
+        {
+            size = m_pDevice->GetCmdBufferSize(cmdBufferInfo, &result);
+        }
+        break;
+    default:
+        break;
+    }
+
+    void* pMemory = nullptr;
+    void* pObject = nullptr;
+
+    if (result == Result::Success)
+    {
+        pMemory = malloc(size);
+        result  = (pMemory != nullptr) ? Result::Success : Result::ErrorOutOfMemory;
+    }
+
+    if (result == Result::Success)
+    {
+        switch (kind)
+        {
+        case ObjectKind::CmdAllocator:
+            result = m_pDevice->CreateCmdAllocator(call.args.cmdAllocator, pMemory,
+                                                   reinterpret_cast<ICmdAllocator**>(&pObject));
+            break;
+        case ObjectKind::CmdBuffer:
+            result = m_pDevice->CreateCmdBuffer(cmdBufferInfo, pMemory, reinterpret_cast<ICmdBuffer**>(&pObject));
+            break;
+        case ObjectKind::Queue:
+            result = m_pDevice->CreateQueue(call.args.queue, pMemory, reinterpret_cast<IQueue**>(&pObject));
+            break;
+        case ObjectKind::Fence:
+            result = m_pDevice->CreateFence(call.args.fence, pMemory, reinterpret_cast<IFence**>(&pObject));
+            break;
+        case ObjectKind::GpuMemory:
+            result = m_pDevice->CreateGpuMemory(call.args.gpuMemory, pMemory,
+                                                reinterpret_cast<IGpuMemory**>(&pObject));
+            break;
+        case ObjectKind::GpuEvent:
+            result = m_pDevice->CreateGpuEvent(call.args.gpuEvent, pMemory, reinterpret_cast<IGpuEvent**>(&pObject));
+            break;
+        default:
+            PAL_NEVER_CALLED();
+            break;
+        }
+    }
+
+    if ((result == Result::Success) && (call.createdSlot < m_objects.size()))
+    {
+        DestroyObject(call.createdSlot);
+        m_objects[call.createdSlot] = { kind, pObject, pMemory };
+        m_creationOrder.push_back(call.createdSlot);
+    }
+    else
+    {
+        free(pMemory);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+void Replayer::DestroyObject(
+    uint32 slot)
+{
+    if ((slot != 0) && (slot < m_objects.size()) && (m_objects[slot].pObject != nullptr))
+    {
+        ReplayObject*const pObject = &m_objects[slot];
+
+        switch (pObject->kind)
+        {
+        case ObjectKind::CmdAllocator: static_cast<ICmdAllocator*>(pObject->pObject)->Destroy(); break;
+        case ObjectKind::CmdBuffer:    static_cast<ICmdBuffer*>(pObject->pObject)->Destroy();    break;
+        case ObjectKind::Queue:        static_cast<IQueue*>(pObject->pObject)->Destroy();        break;
+        case ObjectKind::Fence:        static_cast<IFence*>(pObject->pObject)->Destroy();        break;
+        case ObjectKind::GpuMemory:    static_cast<IGpuMemory*>(pObject->pObject)->Destroy();    break;
+        case ObjectKind::GpuEvent:     static_cast<IGpuEvent*>(pObject->pObject)->Destroy();     break;
+        default:                       PAL_NEVER_CALLED();                                       break;
+        }
+
+        free(pObject->pMemory);
+        *pObject = { ObjectKind::Unknown, nullptr, nullptr };
+    }
+}
+
+// =====================================================================================================================
+// Destroys every remaining object in the reverse of the order they were created in, once all queues are idle.
+void Replayer::DestroyAll()
+{
+    for (uint32 slot : m_creationOrder)
+    {
+        if ((m_objects[slot].kind == ObjectKind::Queue) && (m_objects[slot].pObject != nullptr))
+        {
+            static_cast<IQueue*>(m_objects[slot].pObject)->WaitIdle();
+        }
+    }
+
+    while (m_creationOrder.empty() == false)
+    {
+        DestroyObject(m_creationOrder.back());
+        m_creationOrder.pop_back();
+    }
+}
+
+// =====================================================================================================================
+void Replayer::Report(
+    uint32 loops
+    ) const
+{
+    const double replayFreq = static_cast<double>(GetPerfFrequency());
+
+    uint64 totalCalls    = 0;
+    uint64 totalFailures = 0;
+    uint64 totalSkipped  = 0;
+    double totalCaptured = 0.0;
+    double totalReplay   = 0.0;
+
+    printf("\n%-40s %10s %8s %8s %14s %14s\n",
+           "Function", "Calls", "Failed", "Skipped", "Captured (us)", "Replay (us)");
+
+    for (uint32 funcId = 0; funcId < m_stats.size(); ++funcId)
+    {
+        const FuncStats& stats = m_stats[funcId];
+
+        if ((stats.calls > 0) || (stats.skipped > 0))
+        {
+            const std::string name     = std::string(m_capture.FuncObjectName(funcId) + 1) + "::" +
+                                         m_capture.FuncName(funcId);
+            const double      captured = (1000000.0 * stats.capturedTicks) / CaptureTimerFreq;
+            const double      replay   = (1000000.0 * stats.replayTicks) / replayFreq;
+
+            printf("%-40s %10llu %8llu %8llu %14.1f %14.1f\n",
+                   name.c_str(),
+                   static_cast<unsigned long long>(stats.calls),
+                   static_cast<unsigned long long>(stats.failures),
+                   static_cast<unsigned long long>(stats.skipped),
+                   captured,
+                   replay);
+
+            totalCalls    += stats.calls;
+            totalFailures += stats.failures;
+            totalSkipped  += stats.skipped;
+            totalCaptured += captured;
+            totalReplay   += replay;
+        }
+    }
+
+    printf("%-40s %10llu %8llu %8llu %14.1f %14.1f\n",
+           "Total",
+           static_cast<unsigned long long>(totalCalls),
+           static_cast<unsigned long long>(totalFailures),
+           static_cast<unsigned long long>(totalSkipped),
+           totalCaptured,
+           totalReplay);
+
+    printf("\nReplayed %u loop(s).  Captured times include every loop; skipped calls were not replayed and are "
+           "counted once.\n", loops);
+}
+
+} // anonymous namespace
+
+// =====================================================================================================================
+int main(
+    int   argc,
+    char* argv[])
+{
+    const char* pGpuName    = nullptr;
+    const char* pCapture    = nullptr;
+    uint32      loops       = 1;
+    bool        validArgs   = true;
+
+    for (int idx = 1; validArgs && (idx < argc); ++idx)
+    {
+        if ((strcmp(argv[idx], "--gpu") == 0) && (idx + 1 < argc))
+        {
+            pGpuName = argv[++idx];
+        }
+        else if ((strcmp(argv[idx], "--loops") == 0) && (idx + 1 < argc))
+        {
+            loops = static_cast<uint32>(strtoul(argv[++idx], nullptr, 0));
+        }
+        else if ((argv[idx][0] != '-') && (pCapture == nullptr))
+        {
+            pCapture = argv[idx];
+        }
+        else
+        {
+            validArgs = false;
+        }
+    }
+
+    if ((validArgs == false) || (pCapture == nullptr) || (loops == 0))
+    {
+        fprintf(stderr, "Usage: %s [--gpu <null device name>] [--loops <count>] <merged capture>\n", argv[0]);
+        return 1;
+    }
+
+    CaptureFile capture;
+    Result      result = capture.Load(pCapture);
+
+    if (result != Result::Success)
+    {
+        fprintf(stderr, "Failed to load the capture \"%s\".\n", pCapture);
+        return 1;
+    }
+
+    // The replayer must be destroyed before the capture it refers to.
+    {
+        Replayer replayer(capture);
+
+        result = replayer.Init(pGpuName);
+
+        if (result == Result::Success)
+        {
+            result = replayer.Prepare();
+        }
+
+        if (result == Result::Success)
+        {
+            result = replayer.Run(loops);
+        }
+
+        if (result == Result::Success)
+        {
+            replayer.Report(loops);
+        }
+        else
+        {
+            fprintf(stderr, "Replay failed with result %d.\n", static_cast<int>(result));
+        }
+    }
+
+    return (result == Result::Success) ? 0 : 1;
+}